@@ -1,26 +0,0 @@
-size_t mVertexCount = 3497;
-size_t mIndexCount = 15000;
-
-float mPositions[] = {
--1.82181, 2.30481, 0.006451, -1.88781, 2.2463, -0.105978, -1.88345, 2.33499, -0.078892, -1.81772, 1.60129, -0.068221, -1.80811, 1.61441, 0.022762, -1.83221, 1.52894, -0.021582, -0.553601, 1.94064, -0.182124, -0.57631, 1.89967, -0.271907, -0.544067, 1.86993, -0.364953, -1.53168, 3.06357, 1.19855, -1.5171, 2.98894, 1.0664, -1.42563, 3.03714, 1.24416, -0.65999, 1.86111, -0.362659, -0.601839, 1.81062, -0.445096, -1.28176, 0.219902, -0.714299, -1.19755, 0.262162, -0.726043, -1.27079, 0.272349, -0.65979, -0.037841, 2.06659, -0.160404, -0.170138, 2.04832, -0.171159, -0.071768, 2.04861, -0.273906, -1.17882, 2.54314, -0.349989, -1.19181, 2.51978, -0.439646, -1.14605, 2.52548, -0.289712, -1.76235, 0.921648, -0.004619, -1.78607, 0.955743, -0.162529, -1.81429, 1.00918, -0.037788, -1.44384, 2.4612, 1.02686, -1.46089, 2.48846, 1.12132, -1.40381, 2.51266, 1.13662, -1.86918, 1.15301, -0.115491, -1.886, 1.23372, -0.190942, -1.88152, 1.19035, -0.06117, 1.22994, 0.783353, -0.190268, 1.2069, 0.768241, -0.261278, 1.22893, 0.710533, -0.278641, -0.708712, 3.04673, 0.356093, -0.831749, 2.96495, 0.343359, -0.74769, 3.00908, 0.286387, -0.189185, 2.03184, -0.279652, -1.71016, 0.842787, 0.034464, -1.76241, 0.931498, 0.085712, -1.48082, 2.86418, 0.734168, -1.53131, 2.87657, 0.752457, -1.46141, 2.77429, 0.54633, -1.34435, 2.70277, 0.606207, -1.36715, 2.64214, 0.449012, -1.3324, 2.60186, 0.475194, -1.35477, 2.94609, 1.21996, -1.40057, 2.91976, 1.07057, -1.3454, 2.84006, 1.04115, -1.06677, 0.062203, 0.444509, -1.00753, 0.024319, 0.508426, -1.08388, 0.015753, 0.438237, -1.43081, 2.87845, 0.849565, -1.4926, 2.91252, 0.873495, -1.38501, 2.83414, 0.827087, -1.45505, 2.9359, 1.00501, -1.46004, 2.68629, 0.37735, -1.49142, 2.70202, 0.388756, -1.41288, 2.61213, 0.314484, -1.52908, 2.79281, 0.567229, -0.61935, 1.26668, 0.70866, -0.695537, 1.32544, 0.676965, -0.591885, 1.39624, 0.680205, -0.320472, 1.99663, -0.269508, -0.423261, 1.93761, -0.312505, -0.341602, 1.91202, -0.438551, -1.95709, 2.06133, -0.235287, -1.90572, 2.14964, -0.27237, -1.94116, 2.08302, -0.14083, -0.164498, 2.00427, 0.224827, -0.283999, 2.01715, 0.058309, -0.065391, 2.05724, 0.06517, -1.49349, 0.028738, 0.200435, -1.48134, 0.094066, 0.20355, -1.4479, 0.044986, 0.293523, -1.93026, 1.77038, -0.46448, -1.95177, 1.84682, -0.504132, -1.94676, 1.85911, -0.431796, -1.77494, 1.00495, -0.282872, -1.81072, 1.04527, -0.227373, -0.225953, 2.03986, -0.047448, -0.11788, 2.05804, -0.037388, -0.787468, 0.309412, 0.544815, -0.791635, 0.348411, 0.428619, -0.748468, 0.345569, 0.454695, -1.6133, 2.5701, 0.016216, -1.6635, 2.57593, -0.134749, -1.55105, 2.59184, -0.11829, -1.42999, 1.72486, 0.384105, -1.49159, 1.74969, 0.351379, -1.41833, 1.80822, 0.367669, -1.87983, 1.40098, -0.098465, -1.83955, 1.53553, -0.103263, -0.064128, 2.02494, 0.206433, -1.85967, 2.46213, -0.364195, -1.75313, 2.45455, -0.526188, -1.8213, 2.4954, -0.360638, -0.025656, 1.33058, -0.948692, 0.085195, 1.32247, -0.930192, 0.064823, 1.37488, -0.87966, -1.71521, 2.5624, -0.230614, -1.62065, 2.57254, -0.332436, -1.9846, 1.96144, -0.22068, -1.96322, 1.97689, -0.100295, 0.050364, 2.07614, -0.067674, -1.5597, 2.95861, 0.983419, -0.493724, 1.96096, -0.165728, -1.7103, 2.54305, -0.361122, -1.71988, 2.51546, -0.440214, 0.020373, 2.05543, 0.129488, 0.075282, 2.07115, 0.032212, -1.72981, 0.897192, -0.164234, -1.71794, 0.852153, -0.050984, -1.41467, 2.70934, 0.472984, -1.41288, 2.61213, 0.314484, -1.36715, 2.64214, 0.449012, -1.3325, 2.77919, 0.876252, -1.36715, 2.64214, 0.449012, -1.41288, 2.61213, 0.314484, -1.3324, 2.60186, 0.475194, -1.89435, 2.10043, 0.059298, -1.86777, 2.17356, 0.033496, -1.84027, 2.1208, 0.133486, 0.137033, 2.04242, 0.164383, 0.238833, 1.37355, 0.668504, 0.320661, 1.30482, 0.698243, 0.220228, 1.33011, 0.729012, -1.45093, 2.60021, 0.225437, -1.52003, 2.65155, 0.298089, -0.228689, 1.97701, -0.396417, -1.56772, 2.5995, 0.238549, -1.55212, 2.57631, 0.134497, 0.052447, 2.03843, -0.339002, -0.089321, 2.02399, -0.35967, -0.032706, 1.99027, -0.431312, -1.86535, 1.30278, 0.016953, -1.88354, 1.31858, -0.11566, -1.87085, 1.39386, -0.017479, -1.58701, 2.84989, 0.747827, -1.86194, 1.64713, -0.082911, -1.90591, 1.67906, -0.155774, -1.90667, 1.6995, -0.032358, -0.138611, 1.96649, -0.452211, -0.096855, 1.92162, -0.520527, -1.06743, 2.52098, -0.06477, -1.05741, 2.62566, -0.013775, -1.10325, 2.52809, -0.088131, -1.46004, 2.68629, 0.37735, -1.41288, 2.61213, 0.314484, -1.96101, 1.79376, -0.307748, -1.98348, 1.87509, -0.312084, -1.97086, 1.78711, -0.208831, -1.70266, 1.94902, -0.913734, -1.66274, 2.01044, -0.934654, -1.71432, 2.04447, -0.912956, -1.62176, 2.0826, -0.920195, -1.67905, 2.13638, -0.889216, -1.50371, 3.11637, 1.35156, -1.56077, 3.09154, 1.25298, -1.48128, 3.1092, 1.30303, -1.66131, 2.42435, -0.646615, -1.66123, 2.4824, -0.555884, -1.05741, 2.62566, -0.013775, -0.99572, 2.73558, 0.056099, -1.09104, 2.68634, 0.033622, -1.20521, 2.56936, -0.222722, -1.94192, 1.72096, -0.17421, -1.64331, 1.9055, -0.913355, -1.65079, 2.23721, -0.833211, -1.62595, 2.37144, -0.723644, -1.70359, 2.23205, -0.812796, -1.25385, 2.56225, -0.371119, -1.26389, 2.52182, -0.508236, -1.56361, 2.74838, 0.510867, -0.657023, 0.228699, -0.86377, -0.656076, 0.153921, -0.895992, -0.557137, 0.253681, -0.894035, -1.92691, 2.08319, -0.039956, -1.11192, 0.785416, 0.496787, -1.15893, 0.949366, 0.599704, -1.07389, 0.899191, 0.566703, -1.3453, 1.99438, 0.363859, -1.48576, 2.04081, 0.368363, -1.44095, 2.14673, 0.359376, -1.18855, 2.62665, 0.011796, -1.21405, 2.58104, -0.08931, -1.15001, 2.57288, -0.081501, -1.59358, 1.94144, -0.933349, -1.59916, 2.21465, -0.8519, 0.915829, 1.23204, 0.239644, 0.872137, 1.24982, 0.340919, 0.865381, 1.35771, 0.267614, -1.81377, 1.04372, 0.049996, -1.82631, 1.08103, -0.07744, -0.540068, 1.94984, 0.08809, -0.494735, 1.97287, -0.047511, -1.87493, 1.25007, -0.038525, -1.98635, 1.87014, -0.192878, -1.41288, 2.61213, 0.314484, -1.35658, 2.53499, 0.291649, 0.162877, 2.07294, -0.061949, 0.124405, 2.07155, -0.170148, -1.55814, 2.338, -0.763043, -1.10522, 0.307223, -0.128771, -1.05842, 0.339234, -0.177324, -1.07098, 0.415611, -0.12031, -1.48128, 3.1092, 1.30303, 0.177231, 2.06105, 0.051869, -1.61143, 1.76283, -0.899717, -1.5549, 1.85071, -0.939853, -1.52935, 2.04308, -0.903485, -1.56736, 2.14871, -0.88288, -0.31199, 1.14299, 0.990364, -0.275685, 1.21638, 0.95547, -0.19693, 1.10374, 0.986071, -0.840546, 2.44658, 0.150218, -0.778565, 2.47627, 0.226806, -0.738745, 2.50563, 0.186734, -1.94324, 1.9417, -0.008829, -1.86047, 2.23111, -0.040019, -1.82671, 2.22094, 0.088005, -0.80683, 0.452969, 0.413444, -0.812891, 0.532944, 0.426093, -0.742155, 0.469427, 0.405867, -0.678911, 1.162, 0.712849, -0.773577, 1.17191, 0.686288, -1.5364, 1.79496, -0.932255, -1.58394, 2.4499, -0.640575, -1.52727, 2.41088, -0.69399, -1.83189, 2.0543, 0.16474, -1.8849, 2.01067, 0.088258, -1.85399, 1.15251, 0.081881, -1.28559, 2.12318, 0.335994, -1.37129, 2.25962, 0.345675, -1.29498, 2.26028, 0.315958, -1.49073, 1.88498, -0.937306, -1.52895, 2.27318, -0.804757, -1.57632, 1.71753, -0.884711, -1.52068, 1.73452, -0.903527, -1.2958, 2.90162, 1.48205, -1.29472, 2.99264, 1.46001, -1.28309, 2.88419, 1.46437, -1.8366, 1.24446, 0.095414, -0.652014, 2.80685, 0.525747, -0.493662, 2.84686, 0.580088, -0.600577, 2.71717, 0.495125, 0.905306, 1.36191, 0.162341, 0.868348, 1.48651, 0.127614, 0.909578, 1.39971, 0.078387, 1.05901, 0.416832, 0.25585, 1.11238, 0.398143, 0.197005, 1.08249, 0.326312, 0.162046, -0.717046, 2.70465, 0.4741, -1.38268, 2.37056, 0.583288, -1.3389, 2.42101, 0.608438, -1.32375, 2.39859, 0.45962, 0.079281, 1.67159, -0.689381, 0.140021, 1.76272, -0.630893, 0.017026, 1.75426, -0.661452, 0.966908, 0.31903, 0.265426, 0.857657, 1.52726, 0.02594, 0.902443, 1.43025, -0.015479, 1.14807, 0.485401, 0.197868, -1.11964, 2.18352, 0.218829, -1.06, 2.19253, 0.142831, -1.06366, 2.11274, 0.206812, -0.342486, 2.00917, -0.167202, 0.076251, 2.05806, -0.261595, -1.45996, 1.31039, -0.702724, -1.48286, 1.4313, -0.653581, -1.54564, 1.31395, -0.662357, -1.47562, 1.7873, -0.925499, 0.028981, 0.406645, -0.934654, 0.043482, 0.360385, -0.916575, 0.076377, 0.425503, -0.940421, -1.4459, 2.34991, -0.72194, 1.04339, 0.228047, -0.122983, 0.899076, 0.14725, -0.004051, 0.982714, 0.199613, 0.045766, 1.20608, 0.567481, 0.144179, 1.20852, 0.484727, 0.099223, 0.946241, 1.00941, 0.171075, 0.957837, 1.13592, 0.102128, 0.973453, 0.934318, 0.038421, -1.26421, 0.177599, -0.29914, -1.16497, 0.209526, -0.218786, -1.28647, 0.101222, -0.230909, -1.81831, 1.51139, 0.058036, -1.7745, 1.61197, 0.105853, -1.75715, 1.56303, 0.167981, -1.58089, 0.70666, -0.031664, -1.6241, 0.775461, 0.07742, -1.56858, 0.709249, 0.085122, -1.41498, 1.39313, -0.691464, -1.42464, 1.56501, -0.616203, -1.51832, 1.52347, -0.605785, -1.46023, 1.59273, -0.605469, -0.139348, 1.20878, -1.01318, -0.026182, 1.18096, -1.00628, -0.118322, 1.26813, -0.992426, 0.198003, 1.20695, -0.957068, 0.282315, 1.26474, -0.899276, 0.20015, 1.31547, -0.887553, 0.135959, 0.574911, -0.96898, 0.056089, 0.625484, -1.00571, 0.068422, 0.56504, -0.983376, -1.4342, 1.98901, -0.871515, -1.43891, 1.89232, -0.91969, 0.985682, 0.870758, -0.029454, 0.974043, 0.962268, -0.127256, -1.93251, 1.98871, -0.583392, -1.90126, 2.06711, -0.61875, -1.9021, 2.09504, -0.470247, -1.8644, 2.37986, -0.023961, -1.80177, 2.40232, 0.045071, -0.016458, 2.00463, 0.252313, 0.090836, 1.99612, -0.418979, -1.36769, 1.4887, -0.671554, -1.36237, 2.54911, 1.03557, -1.37399, 2.5875, 1.23343, -1.32739, 2.65169, 1.08791, 0.007935, 0.251618, -0.795138, -0.013343, 0.29912, -0.850217, -0.147345, 0.282767, -0.815469, 0.154543, 1.8521, -0.573164, 0.127141, 1.93547, -0.50329, 0.073304, 1.83198, -0.592926, -1.04699, 2.27604, 0.072516, -1.01073, 2.34214, 0.094488, -1.02009, 2.37014, 0.007861, -1.98336, 1.96096, -0.283314, -1.05013, 2.39354, 0.223102, -0.933234, 2.48678, 0.303603, -0.920901, 2.41513, 0.229037, 0.941148, 1.30111, -0.069147, 0.949902, 1.27645, 0.052732, 0.966424, 1.13767, 0.00664, -0.298226, 1.99305, 0.156406, -1.85805, 1.13415, 0.013396, 0.259269, 2.02163, 0.155859, -0.314221, 0.119174, -0.434363, -0.3822, 0.133465, -0.645352, -0.438057, 0.114082, -0.402583, 0.169886, 0.391324, -0.905715, 0.19411, 0.23455, -0.764347, 0.125983, 0.288512, -0.848891, 0.103758, 0.189448, -0.778364, 1.27917, 0.603302, -0.036294, 1.25935, 0.70384, 0.004746, 1.26444, 0.739745, -0.057151, 1.16297, 0.387999, 0.11646, -1.35538, 2.63843, 1.32582, -1.35222, 2.68276, 1.38443, -1.30373, 2.77414, 1.37616, -1.43708, 1.25007, -0.708196, -1.42911, 1.1541, -0.732147, -1.38047, 1.22198, -0.744038, 0.354272, 1.48154, -0.769188, 0.434753, 1.49823, -0.72116, 0.315799, 1.5635, -0.696052, 0.07383, 1.123, -1.01671, 0.101001, 1.23488, -0.967613, 0.164476, 0.464481, -0.926257, 0.109399, 0.505899, -0.940441, -1.42433, 2.28399, -0.739324, -1.38257, 2.45478, -0.619213, 0.93033, 1.09911, 0.228489, 0.939316, 1.07752, 0.16653, 0.886195, 1.02185, 0.324292, -0.647615, 1.95016, -0.165328, 0.287871, 2.035, 0.03802, 0.406614, 1.98682, -0.053805, 0.405414, 1.97653, 0.067022, -1.3457, 0.960583, -0.701777, -1.36784, 1.08537, -0.744627, -1.48357, 1.02785, -0.670755, -1.47191, 1.11748, -0.703713, -1.34755, 1.36501, -0.7119, 0.910546, 0.901402, 0.265678, 0.960131, 0.877703, 0.129067, -0.00926, 0.533786, -0.96273, -0.017995, 0.58114, -0.990974, -0.090667, 0.598503, -0.988091, 0.203118, 1.43341, -0.813091, 0.108283, 1.445, -0.77205, 0.151407, 1.3865, -0.835126, 0.088247, 0.840472, -1.00095, 0.161972, 0.829107, -0.995962, 0.117186, 0.913755, -1.00154, -0.524873, 2.8903, 0.422389, -0.664683, 2.80836, 0.304571, -0.638776, 2.7676, 0.29609, -0.097339, 0.521495, -0.952375, -0.090689, 0.45221, -0.950628, -0.512813, 3.02964, 0.430597, -0.632904, 2.93811, 0.317788, -0.634208, 2.88613, 0.338814, -1.08302, 0.481907, -0.150701, -1.14626, 0.470942, -0.03341, -0.951839, 2.0283, -0.244946, -0.979662, 2.1094, -0.171538, -1.0053, 2.10544, -0.297478, -1.76162, 1.87909, 0.262437, -1.66764, 1.8431, 0.303351, -1.73573, 1.75232, 0.232846, -1.31398, 1.07451, -0.746374, -1.31781, 1.22377, -0.765063, -1.24297, 1.41918, -0.715267, 0.91164, 0.403341, -0.499901, 0.921511, 0.333004, -0.475719, 1.00467, 0.416095, -0.464227, -0.408487, 2.8924, 0.625801, -0.308454, 2.97983, 0.730569, -0.292438, 2.83894, 0.644784, -0.031548, 0.482896, -0.965845, -1.30689, 2.75501, 1.41274, 0.716079, 1.69546, -0.333699, 0.702399, 1.66894, -0.400899, 0.790351, 1.55474, -0.369646, -1.26524, 1.31692, -0.745974, -1.2765, 1.50884, -0.676985, -1.34237, 1.6288, -0.606984, 0.810219, 0.317409, -0.484011, 0.799611, 0.35384, -0.487484, 0.747459, 0.367646, -0.47776, -1.18312, 2.28166, 0.242927, -1.11636, 2.27183, 0.193911, -1.88324, 2.21869, -0.343506, -1.9109, 2.22189, -0.24884, -1.89926, 2.16313, -0.11385, -0.432354, 1.82712, -0.510677, 0.535775, 0.136875, 0.268646, 0.61051, 0.09213, 0.189722, 0.46708, 0.07986, 0.227964, -1.30752, 0.628536, 0.279064, -1.25269, 0.590548, 0.233919, -1.36051, 0.604923, 0.179178, -1.24009, 0.937916, -0.720235, -1.25998, 1.00095, -0.726885, -1.25223, 1.17574, -0.765442, -1.24167, 1.24277, -0.770198, 0.204486, 1.52069, -0.733768, 0.960131, 0.877703, 0.129067, -1.2203, 1.609, -0.615782, 0.160815, 1.12485, -0.99714, -1.4426, 2.99172, 1.38753, -1.39053, 2.79068, 1.41817, -1.4245, 2.78559, 1.35129, -1.21778, 1.07259, -0.746016, -1.19173, 1.3331, -0.735114, -1.24585, 1.68849, -0.578678, -0.005114, 0.453663, -0.966055, -0.080923, 1.09035, -1.01987, -1.57538, 2.46137, 0.768031, -1.56959, 2.49734, 0.786868, -1.53869, 2.43064, 0.788972, 0.890531, 0.549697, -0.465301, 0.855236, 0.601807, -0.444107, 0.814196, 0.493945, -0.472477, 0.089489, 1.52073, -0.711879, -1.38415, 0.07342, 0.335615, -1.44106, 0.094634, 0.28824, -1.40242, 0.156784, 0.289545, -1.19819, 1.16008, -0.756687, 0.223722, 0.288997, -0.794128, -0.979704, 0.729706, -0.650256, -1.00422, 0.609574, -0.58859, -0.936328, 0.591327, -0.64834, -1.45438, 2.58058, 0.149481, -0.672471, 1.94054, -0.224384, -1.13835, 0.143125, 0.405867, -1.31274, 0.150807, 0.339761, -1.06812, 0.213167, 0.394798, -1.24173, 0.858067, -0.683109, -1.15988, 0.877787, -0.698746, -1.17068, 1.24608, -0.764305, -1.16405, 1.48741, -0.689844, 0.111398, 0.737156, -0.987711, 0.11123, 1.6091, -0.693169, 0.024751, 1.60677, -0.713963, -1.31215, 2.40926, 0.345149, -1.30479, 2.41263, 0.274981, -1.32712, 2.32426, 0.341592, 0.252092, 1.49545, -0.771482, -0.056488, 0.384442, -0.935454, 0.0507, 1.41405, -0.803936, -1.4953, 2.49673, 1.12426, -1.46495, 2.5661, 1.24023, -1.46089, 2.48846, 1.12132, -1.40833, 1.89013, 0.371415, -1.30272, 1.89394, 0.368574, -1.16255, 1.03166, -0.762832, -1.17068, 1.24608, -0.764305, -1.15748, 1.57345, -0.645815, -0.002189, 0.923963, -1.04077, -0.043313, 1.01059, -1.02736, -0.125036, 0.969338, -1.03612, 1.2753, 0.603954, -0.144219, 1.27812, 0.690855, -0.110187, 1.26476, 0.688476, -0.206116, -1.11128, 0.175516, -0.787772, -1.19755, 0.262162, -0.726043, -1.20345, 0.167075, -0.790529, -0.767179, 1.87349, -0.398437, -0.647594, 1.74668, -0.507625, -1.37129, 2.25962, 0.345675, -1.28559, 2.12318, 0.335994, -1.36927, 2.13705, 0.354199, -1.38508, 2.32794, 0.448802, -1.43567, 2.33463, 0.499292, -1.15496, 0.785057, -0.63325, -1.1365, 1.00154, -0.754751, -1.12844, 1.10212, -0.770136, -1.17068, 1.24608, -0.764305, -1.17068, 1.24608, -0.764305, -1.15742, 1.40296, -0.720109, -1.14073, 1.71604, -0.549402, 0.960489, 0.513981, -0.489378, 0.890531, 0.549697, -0.465301, 0.858162, 0.454105, -0.489862, 0.451274, 1.22857, -0.827192, 0.434374, 1.33899, -0.80463, 0.357219, 1.3496, -0.814522, -1.1096, 0.247136, -0.745111, 0.783974, 0.095329, -0.127887, 0.749374, 0.07462, -0.022655, -1.16121, 0.324186, -0.626726, -1.25669, 0.07483, 0.383769, -1.118, 0.945641, -0.728106, -1.11411, 1.21926, -0.754077, -1.17068, 1.24608, -0.764305, -1.17068, 1.24608, -0.764305, -0.164245, 0.361754, -0.889194, 0.278716, 1.34186, -0.842071, 0.283851, 1.42659, -0.814796, 0.972001, 0.608858, -0.452147, 0.96996, 0.704913, -0.380295, 0.440394, 1.12241, -0.856446, 0.376076, 1.21895, -0.841293, 0.96996, 0.704913, -0.380295, 0.903222, 0.709817, -0.38421, 0.905474, 0.648552, -0.406182, 0.962215, 0.768368, -0.311684, 0.903222, 0.709817, -0.38421, 1.1152, 0.31078, 0.077819, 1.1977, 0.391408, 0.031265, 1.19398, 0.369057, -0.039724, 0.427639, 1.41933, -0.779164, -0.861151, 0.27658, 0.561568, -0.787552, 0.261974, 0.693823, -0.8871, 0.218113, 0.636619, -1.0053, 2.10544, -0.297478, -1.07294, 2.14431, -0.396627, -1.003, 2.05821, -0.353251, -0.179546, 0.572006, -0.980114, -0.265604, 0.60307, -0.961488, -0.252303, 0.515897, -0.926298, -0.609311, 0.132707, -0.938021, -0.656076, 0.153921, -0.895992, -0.626106, 0.074914, -0.920848, -1.05288, 1.01718, -0.747658, -1.09232, 1.3149, -0.740797, -1.09432, 1.40437, -0.715099, -1.06808, 1.60597, -0.622096, -1.04804, 1.69297, -0.555169, -0.121016, 0.684183, -0.998298, -0.002378, 0.764138, -1.00686, -0.105274, 0.771861, -1.01345, 0.423683, 1.56474, -0.664736, 0.413749, 1.67069, -0.606248, 0.318578, 1.74125, -0.595451, 0.825414, 1.55135, -0.246462, 0.782438, 1.63453, -0.211967, -1.06801, 0.908515, -0.72396, -1.0838, 1.51505, -0.66522, 0.057625, 0.970749, -1.00979, 0.188154, 1.56007, -0.684078, -1.10821, 0.326501, -0.631209, -1.0352, 0.282662, -0.682541, -1.04714, 0.352683, -0.595556, -1.03129, 1.12051, -0.770556, -1.06014, 1.17572, -0.767104, -1.02725, 1.22286, -0.751719, 0.273202, 1.69809, -0.622201, -0.002568, 1.26742, -0.981987, -0.045144, 1.65113, -0.709206, -1.30268, 2.5521, 0.584213, -1.30834, 2.60316, 0.559358, -1.31074, 2.49789, 0.492746, -1.05147, 0.21302, -0.751846, -1.1096, 0.247136, -0.745111, 1.24426, 0.634513, -0.269865, -1.42591, 2.37973, 0.675007, -1.44939, 2.40459, 0.788804, -1.3989, 2.43578, 0.848555, -1.0352, 1.50564, -0.664251, 0.814196, 0.493945, -0.472477, 0.747459, 0.367646, -0.47776, 0.799611, 0.35384, -0.487484, 0.858162, 0.454105, -0.489862, 0.747459, 0.367646, -0.47776, 0.98204, 0.457515, -0.489062, 0.960489, 0.513981, -0.489378, -1.62862, 2.53577, -0.46629, -1.58413, 2.51184, -0.539511, -1.13635, 2.3573, 0.207275, -1.05013, 2.39354, 0.223102, -1.05802, 2.32318, 0.152049, -1.5267, 0.050901, 0.03598, -1.51567, 0.096634, 0.100191, -1.50477, 0.030991, 0.095477, -1.02323, 1.33584, -0.745953, -1.00159, 1.4276, -0.707354, 0.73321, 0.214093, -0.425439, 0.682615, 0.259995, -0.454125, -0.063013, 0.82513, -1.04026, -0.134128, 0.825087, -1.03618, -0.074588, 0.203717, -0.816648, -0.137159, 0.253723, -0.815827, -0.315294, 0.201844, -0.897949, -0.997151, 0.325701, -0.639543, -0.982566, 0.454399, -0.607132, -1.06071, 0.396733, -0.532418, -1.04714, 0.352683, -0.595556, -0.997636, 0.895929, -0.713268, -1.04171, 0.851437, -0.693148, -0.999635, 1.54428, -0.66141, -0.967434, 1.601, -0.631693, -1.32712, 2.32426, 0.341592, -1.3928, 2.29831, 0.381285, -1.3418, 2.34263, 0.423778, -0.997151, 0.325701, -0.639543, -0.927551, 0.380464, -0.636407, -0.954996, 1.03974, -0.72699, -0.961415, 1.09456, -0.745469, -0.936875, 1.30233, -0.720466, -0.955753, 1.22114, -0.72638, -1.92552, 2.36668, -0.284914, -1.91205, 2.38403, -0.12774, -1.93116, 2.32278, -0.1905, 0.191542, 0.32608, -0.854762, -0.920143, 2.84644, 0.134623, -0.938454, 0.227668, -0.714426, -0.93517, 1.15067, -0.731116, -0.965014, 1.8468, -0.398311, -1.03169, 1.7833, -0.480728, -0.233551, 3.13679, 0.774114, -0.215598, 3.07228, 0.80562, -0.256175, 3.12054, 0.79556, 0.000568, 1.50452, -0.737388, -1.41953, 2.56968, 1.2698, -1.40408, 2.53834, 1.21724, -1.05741, 2.62566, -0.013775, -0.981893, 2.65599, 0.019731, -1.8985, 2.45184, -0.090404, -1.84178, 2.47577, -0.029728, -0.919427, 0.298299, -0.663935, -0.919427, 0.298299, -0.663935, -1.44175, 2.82735, 0.688203, 0.712711, 0.961299, 0.555022, 0.646773, 1.03103, 0.605702, 0.71027, 1.06628, 0.576027, -0.946851, 0.812312, -0.698515, -0.948261, 0.964246, -0.707186, -0.925847, 1.39841, -0.70807, -0.93115, 1.50137, -0.686119, -0.90318, 1.79692, -0.461029, -0.417116, 2.78052, 0.554538, -0.330911, 2.73902, 0.52903, -0.661906, 2.55972, 0.34557, -0.593905, 2.62238, 0.415422, -0.510709, 2.60756, 0.349168, -0.953417, 2.6091, 0.032317, -0.920227, 2.71355, 0.062476, -0.981893, 2.65599, 0.019731, -0.899518, 0.926341, -0.71693, -0.873231, 1.66826, -0.571059, -0.849049, 1.76188, -0.499228, -1.04017, 2.31203, -0.004914, -1.07563, 2.36185, -0.116585, 1.11128, 0.285377, -0.035536, 0.960489, 0.513981, -0.489378, 1.02095, 0.606143, -0.454757, 0.972001, 0.608858, -0.452147, -0.883502, 0.771335, -0.696326, -0.883859, 1.01238, -0.709606, -0.890784, 1.56569, -0.646468, -1.35182, 2.43711, 0.729033, 0.146356, 0.667577, -0.986217, 0.005345, 0.689486, -1.00663, -0.920227, 2.71355, 0.062476, -0.873505, 2.83082, 0.114965, -1.05587, 0.431059, -0.158173, -0.881397, 0.487926, -0.653644, -0.885122, 1.13083, -0.711269, -0.8726, 1.37989, -0.695358, -1.94217, 1.99181, -0.442235, -1.31381, 2.75044, 1.22924, -0.019994, 1.44021, -0.748205, -0.868053, 0.212957, -0.702745, -0.820384, 0.526483, -0.661094, -0.824719, 0.633356, -0.687023, -0.831707, 0.950187, -0.71935, -1.3039, 2.8554, 1.29141, -1.3224, 0.256817, -0.544751, -1.27079, 0.272349, -0.65979, -1.25044, 0.300909, -0.535259, -0.082038, 1.52968, -0.743091, -0.197708, 1.56684, -0.730632, -0.164266, 1.51924, -0.738419, -0.868053, 0.212957, -0.702745, -0.819416, 0.281672, -0.665598, -0.802789, 0.370804, -0.643226, -0.806935, 0.754793, -0.696768, -0.828339, 1.066, -0.731621, -0.829855, 1.19157, -0.724802, -0.836337, 1.45582, -0.669997, -1.0242, 2.17628, 0.040693, -1.04017, 2.31203, -0.004914, -1.01936, 2.2008, -0.094824, -0.189059, 2.86826, 0.661327, -0.220628, 2.81394, 0.641606, -0.205938, 2.8687, 0.704977, -0.65997, 2.53905, 0.282305, -0.620023, 2.57862, 0.209001, -0.771514, 0.886185, -0.700157, -0.763959, 1.31991, -0.733262, -0.820363, 1.55426, -0.621043, -0.746175, 1.67247, -0.553843, -0.800811, 1.73189, -0.51436, -0.76417, 1.80553, -0.461639, -0.855573, 1.88753, -0.369372, -1.79588, 2.53436, -0.244946, -1.82734, 2.52192, -0.142725, -1.87049, 2.49848, -0.238822, -0.85873, 2.76505, 0.105116, -0.796749, 2.88588, 0.153964, -0.784563, 2.94457, 0.20216, -0.067264, 1.81302, -0.62319, 0.000652, 1.89788, -0.547424, -0.135307, 1.87376, -0.568281, -0.824593, 0.198393, -0.688981, -0.819416, 0.281672, -0.665598, -0.868053, 0.212957, -0.702745, 1.25347, 0.633882, 0.058772, 1.25293, 0.579267, 0.061024, -0.778628, 2.86256, 0.156027, -0.741208, 0.748816, -0.686981, -0.768294, 1.01383, -0.724465, -0.773345, 1.11761, -0.733957, -0.773345, 1.17662, -0.727622, -0.750131, 1.25513, -0.747111, -0.756214, 1.40651, -0.707081, -0.756214, 1.40651, -0.707081, -0.762423, 1.54399, -0.629399, 0.000463, 0.8527, -1.03037, 0.871611, 1.47032, -0.164992, 0.916524, 1.35556, -0.180482, 0.420252, 0.03922, 0.223881, 0.42966, 0.054436, 0.263511, -0.760844, 0.28464, -0.673512, -0.72195, 0.369141, -0.621843, -0.723697, 0.444403, -0.617086, -0.725023, 0.585076, -0.648319, -0.695874, 0.919185, -0.684814, -0.67687, 1.59919, -0.617992, 0.206296, 1.62181, -0.656759, 0.176515, 1.69173, -0.65356, -0.068358, 0.899297, -1.0518, -0.771283, 2.808, 0.18987, -0.778628, 2.86256, 0.156027, -0.85873, 2.76505, 0.105116, -0.72195, 0.369141, -0.621843, -0.737104, 1.05037, -0.719224, -0.695748, 1.11976, -0.711795, -0.699557, 1.17001, -0.735724, -0.706776, 1.49131, -0.673449, -0.756214, 1.40651, -0.707081, -0.723845, 2.93357, 0.204601, -0.723845, 2.93357, 0.204601, -0.614067, 3.01422, 0.302298, -1.12225, 2.52039, -0.15731, -1.16531, 2.55595, -0.156195, -0.688003, 0.731326, -0.660526, -0.699662, 1.03728, -0.696894, -0.186659, 1.3137, -0.961951, -0.123373, 1.35474, -0.92613, -0.670008, 1.21526, -0.745742, -0.137159, 0.253723, -0.815827, -0.156669, 1.76691, -0.642848, -0.158941, 1.65966, -0.700851, -1.40408, 2.53834, 1.21724, -0.644332, 0.451053, -0.588338, -0.637113, 0.620728, -0.615445, -0.615436, 1.29034, -0.759381, -0.649657, 1.34556, -0.755803, -0.756214, 1.40651, -0.707081, -1.5171, 2.45556, 1.01034, -1.52171, 2.50212, 1.05828, -1.4953, 2.49673, 1.12426, -1.95535, 1.89605, -0.584739, -0.648246, 0.991016, -0.695758, -0.61352, 1.45203, -0.713331, -0.756214, 1.40651, -0.707081, -0.756214, 1.40651, -0.707081, 1.10129, 0.659727, -0.411296, 1.06073, 0.722129, -0.381179, 0.455041, 0.098423, 0.282894, -0.615498, 0.769673, -0.644636, -0.61573, 0.887911, -0.682878, -0.63101, 1.10328, -0.736735, -0.615436, 1.20958, -0.74709, -0.596494, 1.36383, -0.737072, 0.959668, 1.16115, -0.092277, 0.939421, 1.25885, -0.191363, 0.721003, 0.398837, -0.505499, -0.145135, 1.08288, -1.01926, -0.686045, 2.98871, 0.238549, -0.631304, 3.05446, 0.294132, -0.579572, 0.988849, -0.81991, -0.576584, 1.07604, -0.841987, 1.21532, 0.65617, 0.128625, 1.22853, 0.73844, 0.063445, 0.226773, 2.05855, -0.117911, -0.589317, 0.591285, -0.60469, -0.590432, 0.453978, -0.590295, 0.845955, 1.45925, 0.226132, 0.787531, 1.58957, 0.176779, 0.229741, 1.96479, -0.444444, 0.213515, 1.8781, -0.546772, 0.975537, 0.86497, -0.202349, 0.95849, 1.05984, -0.230698, -1.36373, 2.50715, 0.945515, -1.3317, 2.51453, 0.862087, -0.583403, 0.368762, -0.728232, -0.628084, 0.29047, -0.820962, -0.557074, 0.312232, -0.854131, -0.569218, 0.716278, -0.651013, -0.539269, 1.38342, -0.746543, -0.524095, 1.6654, -0.606564, -0.544446, 1.50031, -0.704387, -0.009807, 1.82799, 0.470395, 0.017847, 1.76198, 0.548814, -0.03942, 1.74597, 0.545278, 0.026434, 1.07051, -1.02509, -1.37129, 2.25962, 0.345675, -1.36927, 2.13705, 0.354199, -1.44241, 2.2375, 0.348201, -1.3104, 2.5091, 0.659138, -0.544404, 0.498975, -0.640701, -0.590432, 0.453978, -0.590295, -0.533587, 0.622685, -0.671428, -0.506773, 0.735051, -0.766894, -1.95002, 1.84912, -0.692222, -1.9613, 1.83562, -0.614014, -1.94133, 1.79288, -0.683215, 0.814196, 0.493945, -0.472477, 0.855236, 0.601807, -0.444107, 0.765769, 0.505437, -0.523241, -0.55901, 1.26927, -0.762622, -0.444645, 1.60672, -0.672965, -0.524684, 1.74574, -0.533638, -0.524684, 1.74574, -0.533638, -0.478782, 0.355756, -0.796948, -0.557074, 0.312232, -0.854131, -1.1687, 2.44294, 0.225185, -1.05393, 2.46232, 0.260585, -1.05013, 2.39354, 0.223102, -1.05393, 2.46232, 0.260585, 1.04726, 0.784068, -0.315536, 0.18264, 2.01972, -0.366573, 0.332531, 2.02115, -0.094655, -0.513108, 1.32351, -0.751257, -0.524684, 1.74574, -0.533638, -0.473373, 0.284808, -0.908051, -0.557074, 0.312232, -0.854131, -0.482991, 0.379664, -0.740544, -0.521695, 0.413043, -0.675595, -1.34599, 2.39857, -0.626011, -0.481328, 1.47043, -0.732526, -0.388746, 2.66649, 0.419021, -0.299341, 2.70852, 0.464881, -0.512793, 3.11458, 0.39084, -0.557053, 3.11614, 0.354009, -0.512793, 3.11458, 0.39084, -0.507363, 3.17438, 0.426913, -0.550928, 0.200329, -0.938147, -0.460219, 0.232403, -0.936653, -0.470721, 0.317641, -0.871052, -0.557074, 0.312232, -0.854131, -0.473373, 0.284808, -0.908051, -0.557074, 0.312232, -0.854131, -0.326491, 1.50229, -0.71935, -0.31822, 1.40904, -0.752625, -0.244137, 1.4332, -0.746142, -1.85481, 1.35874, 0.064413, -0.740976, 1.93776, -0.271423, -0.386894, 3.20862, 0.544583, -0.320135, 3.19178, 0.648152, -0.363491, 3.24145, 0.604397, -0.470637, 1.37277, -0.758223, 0.235971, 0.707228, -0.952186, -1.41157, 3.10951, 1.37555, -1.10099, 0.381032, -0.331405, -1.09716, 0.490851, -0.377412, -1.07159, 0.438446, -0.231792, -0.439489, 1.70716, -0.613151, -1.26812, 2.32373, 0.263721, -1.29498, 2.26028, 0.315958, 0.352967, 1.17151, -0.879386, 0.37978, 1.06584, -0.895445, -1.30479, 2.41263, 0.274981, -0.418316, 0.392018, -0.787182, -0.521695, 0.413043, -0.675595, -0.418316, 0.392018, -0.787182, -0.454368, 0.502091, -0.772977, -0.810134, 0.838894, 0.552286, -0.742155, 0.801579, 0.56302, -0.744744, 0.712133, 0.508784, 0.343665, 1.88445, -0.476392, 0.290733, 1.89925, -0.500133, 0.348821, 1.80831, -0.55357, -0.425514, 1.45563, -0.735809, 1.06917, 0.512003, -0.447475, 1.06098, 0.575226, -0.45261, 1.02095, 0.606143, -0.454757, -0.369004, 0.315347, -0.843755, -1.92174, 2.43096, -0.158489, -1.9153, 2.43877, -0.268708, -1.89442, 2.48036, -0.147608, 0.351789, 1.97661, 0.179241, -1.11543, 0.340707, -0.530965, -1.20545, 0.301351, -0.445138, -0.943778, 2.38483, 0.147924, -0.380054, 1.51656, -0.716909, -0.524684, 1.74574, -0.533638, -0.777281, 0.086847, 0.809304, -0.853258, 0.124289, 0.759866, -0.714668, 0.169307, 0.808167, 0.212862, 0.91525, -0.97902, 0.172263, 1.0055, -0.981503, -0.326428, 0.258922, -0.882123, -0.378875, 0.356471, -0.804146, -0.378875, 0.356471, -0.804146, -0.418316, 0.392018, -0.787182, -0.478782, 0.355756, -0.796948, -0.355914, 0.396985, -0.835947, -0.611331, 1.94852, 0.020573, 0.200108, 2.0507, -0.252039, -1.48193, 2.27955, 0.361965, -0.471732, 1.05868, -0.986049, -0.433153, 0.980578, -0.994951, -0.40272, 1.06272, -1.02027, 1.06073, 0.722129, -0.381179, -0.153975, 0.861603, -1.03616, 0.33171, 1.26746, -0.867095, -0.351115, 1.14251, -1.01025, -0.421389, 1.15863, -0.986007, 0.229741, 1.96479, -0.444444, -0.397164, 1.3889, -0.752393, -0.351326, 1.74062, -0.61273, 0.624338, 0.810839, 0.631841, 0.55398, 0.784174, 0.686499, 0.536112, 0.865286, 0.708808, 0.129456, 1.06127, -1.0044, -0.888868, 2.92828, 0.271907, -0.378875, 0.356471, -0.804146, -0.374518, 0.936674, -0.996488, -0.35764, 1.04338, -1.02673, -0.433153, 0.980578, -0.994951, 0.332531, 2.02115, -0.094655, -0.341981, 0.448528, -0.87484, -0.385989, 0.515833, -0.863391, -0.366647, 0.771945, -0.954458, -0.320787, 0.798275, -0.973716, -0.320766, 1.23839, -0.990806, -0.406635, 1.24475, -0.948797, 0.292669, 1.99787, -0.344538, -0.243274, 0.019247, 0.627043, -0.281409, 0.029055, 0.584319, -0.498186, 0.01369, 0.672587, -0.319482, 1.5805, -0.707376, -0.294479, 1.82357, -0.579035, -0.281452, 0.313831, -0.823845, -0.281452, 0.313831, -0.823845, -0.330763, 0.58598, -0.918154, -0.302119, 0.451389, -0.883322, -0.310348, 0.686182, -0.946903, -0.306392, 0.917649, -1.00503, -0.320871, 1.05148, -1.01434, -0.286776, 1.19559, -1.00884, -0.30294, 1.29659, -0.952438, -0.406635, 1.24475, -0.948797, -1.75019, 2.39428, 0.119196, -1.7412, 2.29378, 0.157563, 0.278358, 2.03306, -0.230467, 0.332531, 2.02115, -0.094655, -0.272613, 1.7459, -0.635186, -0.260869, 1.88715, -0.522968, 1.02599, 0.258543, 0.135486, 0.960131, 0.877703, 0.129067, 0.912188, 0.814396, 0.230867, 0.905474, 0.648552, -0.406182, -0.289912, 0.797811, -0.967213, -0.2611, 1.09949, -1.02134, -0.074588, 0.203717, -0.816648, -0.326428, 0.258922, -0.882123, -0.281452, 0.313831, -0.823845, -0.369004, 0.315347, -0.843755, -0.256617, 0.347042, -0.857519, -1.41953, 2.56968, 1.2698, -0.249735, 0.846134, -0.999919, -0.239486, 0.986996, -1.03041, 0.229741, 1.96479, -0.444444, -0.269813, 1.50671, -0.730863, -0.244327, 1.61754, -0.710006, 0.521232, 1.63804, -0.589053, 0.858162, 0.454105, -0.489862, -0.219871, 0.435773, -0.909609, -0.216419, 0.756518, -0.979714, -0.209284, 0.912619, -1.02389, -0.236013, 1.24984, -0.996867, -0.228836, 1.17536, -1.00865, 0.940621, 1.25662, 0.136643, -0.160625, 1.4746, -0.736019, -0.326428, 0.258922, -0.882123, -0.802242, 0.913609, 0.576321, -1.19038, 0.323576, -0.586506, -0.239675, 0.668461, -0.971885, -0.178851, 1.07356, -1.02844, -0.158584, 1.41499, -0.815532, -0.333857, 1.34781, -0.871305, 1.06098, 0.575226, -0.45261, -0.326428, 0.258922, -0.882123, -1.11636, 2.27183, 0.193911, -1.18312, 2.28166, 0.242927, -0.131644, 1.4361, -0.748878, -1.5171, 2.45556, 1.01034, -1.85618, 1.47672, -0.184565, 0.316704, 0.268876, -0.737766, 0.310306, 0.204917, -0.752835, 0.230162, 1.11643, -0.967991, -0.433911, 3.14422, 0.484875, -0.920143, 2.84644, 0.134623, -0.969728, 2.8458, 0.168423, 0.634945, 1.42076, -0.645394, 0.54954, 1.42924, -0.69439, 0.606449, 1.34131, -0.705439, -0.659927, 2.63328, 0.143673, -0.534028, 2.63961, 0.215082, -0.553348, 2.66559, 0.194836, 0.219008, 0.551023, -0.920658, 0.210273, 0.626221, -0.952754, -0.322135, 0.04768, -0.8712, -0.199476, 0.063065, -0.856467, -0.373108, 0.069632, -0.915144, 0.513782, 1.36878, -0.756561, 0.50048, 1.30997, -0.791497, -1.29498, 2.26028, 0.315958, -1.37129, 2.25962, 0.345675, 1.15155, 0.667514, -0.383894, 1.13532, 0.597935, -0.411023, 0.361512, 0.84365, -0.906831, 0.381148, 0.901317, -0.920742, 0.296205, 0.919122, -0.957216, 1.14601, 0.533786, -0.398058, 0.839894, 0.660442, -0.482959, 0.789635, 0.591011, -0.539342, 0.921111, 1.16616, 0.259091, -0.831223, 0.096192, -0.71834, -0.911809, 0.069568, -0.742985, 1.19587, 0.646341, -0.348241, 1.0907, 0.427144, -0.403824, -0.824193, 2.61413, 0.406625, -0.707576, 2.60834, 0.415969, 0.295805, 0.411318, -0.838789, 0.40874, 0.385999, -0.758918, 0.404194, 0.466922, -0.820436, -0.953417, 2.6091, 0.032317, 0.560609, 0.307834, 0.529683, 0.517044, 0.234655, 0.411676, 0.46386, 0.252797, 0.552855, 0.568691, 0.596967, 0.653098, 0.651172, 0.579562, 0.565566, 0.645342, 0.511835, 0.531577, -0.491304, 2.69505, 0.250988, -0.615919, 2.70284, 0.228216, -0.553348, 2.66559, 0.194836, 0.305634, 0.597766, -0.878923, 0.348695, 0.70062, -0.889636, 0.271918, 0.657117, -0.919753, -1.06269, 2.28602, -0.158952, -1.01936, 2.2008, -0.094824, -1.00753, 0.024319, 0.508426, -1.06677, 0.062203, 0.444509, -1.00334, 0.065991, 0.463871, -1.49713, 2.21397, -0.823214, 0.313695, 0.49184, -0.858341, 0.247188, 0.498744, -0.908662, -1.03863, 2.44462, -0.053341, -0.496145, 0.085374, -0.955616, -0.567008, 0.067421, -0.938926, -0.482675, 0.055825, -0.928677, -1.46821, 2.13509, -0.831864, 0.705577, 1.61386, 0.331027, 0.798811, 1.51336, 0.251346, 0.772314, 1.48897, 0.351505, -1.39535, 1.90238, -0.881344, -1.213, 0.367141, 0.08689, -1.18002, 0.431227, 0.028781, -1.20109, 0.451305, 0.134686, 0.424146, 1.7998, -0.537342, 0.718225, 1.34851, -0.607195, 0.615604, 1.54771, -0.586149, 0.604744, 1.48628, -0.616561, 0.374098, 0.531703, -0.844491, -0.780333, 2.6704, 0.150049, -1.34237, 1.6288, -0.606984, -1.44958, 1.62565, -0.636976, -0.502038, 2.70791, 0.48919, 1.17769, 0.424429, -0.304297, 1.08818, 0.334141, -0.324291, -1.65445, 0.771903, -0.064643, -1.40625, 1.82123, -0.899738, -1.39535, 1.90238, -0.881344, -1.40383, 2.08622, -0.773272, -0.740892, 2.77715, 0.240359, -1.37638, 1.77922, -0.841777, -1.43304, 1.75714, -0.892604, -1.42071, 1.71023, -0.827044, -1.40625, 1.82123, -0.899738, -0.690318, 2.66249, 0.137717, -1.35128, 1.88277, -0.826456, -1.39535, 1.90238, -0.881344, 0.94441, 0.895214, -0.303392, 0.949966, 0.245073, -0.353103, 1.0316, 0.243979, -0.25086, -1.32573, 1.83131, -0.768115, -1.35429, 1.96363, -0.797875, -1.39535, 1.90238, -0.881344, -1.39535, 1.90238, -0.881344, -1.35429, 1.96363, -0.797875, 1.21393, 0.597977, -0.325428, 1.19273, 0.50491, -0.327322, 0.801926, 0.68816, -0.555484, 0.757077, 0.709017, -0.611215, 0.743817, 0.602965, -0.607532, 0.816301, 1.30431, -0.500491, 0.82695, 1.43701, -0.395911, 0.773619, 1.39357, -0.507183, -0.76661, 1.27645, 0.679259, -0.825604, 1.39334, 0.645121, -1.38064, 1.69032, -0.706723, -1.45402, 1.66412, -0.769883, -1.33861, 1.74123, -0.712047, -1.40383, 2.08622, -0.773272, -1.37695, 2.25474, -0.685466, -1.42433, 2.28399, -0.739324, 1.24676, 0.492115, -0.015016, 1.18728, 0.729874, -0.320524, 0.809145, 0.898013, -0.553758, 0.778186, 0.986975, -0.598945, 0.746554, 0.843861, -0.625968, 0.605691, 1.04332, -0.753193, 0.598199, 1.15819, -0.747026, 0.54453, 1.1681, -0.797979, 1.1478, 0.753783, -0.332078, -1.33861, 1.74123, -0.712047, -1.33861, 1.74123, -0.712047, -1.33364, 2.04971, -0.693064, 0.487937, 0.540331, -0.781479, 0.519254, 0.646405, -0.767462, 0.460956, 0.587096, -0.811175, 0.760697, 1.08301, -0.614498, 0.808472, 1.14722, -0.556599, 0.724097, 1.1355, -0.669997, -1.29458, 1.91004, -0.722382, -1.34599, 2.39857, -0.626011, -0.45862, 1.549, 0.653835, -0.356797, 1.55135, 0.647016, -0.420673, 1.46908, 0.67627, 0.376665, 0.979399, -0.926467, -0.271371, 3.06875, 0.660106, -0.233445, 3.09255, 0.731053, -1.353, 2.13947, -0.65678, -1.353, 2.13947, -0.65678, 0.263794, 1.1915, -0.939831, 0.423598, 0.649709, -0.824603, 1.0118, 0.336519, -0.408834, -0.414864, 2.84778, 0.457978, -0.240916, 2.91132, 0.596504, -0.332847, 2.99001, 0.576531, -1.34092, 1.67868, -0.615971, -1.44958, 1.62565, -0.636976, -1.34092, 1.67868, -0.615971, -1.33364, 2.04971, -0.693064, 0.888364, 0.965613, -0.430343, -1.33861, 1.74123, -0.712047, -1.32093, 2.20564, -0.588022, -0.817964, 1.48081, 0.61835, -0.698778, 1.53222, 0.618498, 0.839747, 0.785331, -0.5047, 0.568186, 0.385936, -0.631651, 0.658454, 0.418473, -0.592967, 0.609353, 0.487105, -0.666104, 0.410129, 0.16476, -0.713499, 0.456515, 0.151122, -0.675721, 0.476172, 0.223942, -0.676963, 0.543457, 0.280873, -0.621654, 0.398364, 0.23716, -0.721266, 0.455294, 0.318777, -0.672523, 0.573911, 0.243452, -0.576952, 0.516938, 0.323871, 0.597978, -1.28584, 1.76863, -0.650635, -1.33861, 1.74123, -0.712047, -1.24962, 1.83106, -0.66945, -1.29458, 1.91004, -0.722382, -1.26145, 1.98427, -0.674143, -1.28654, 2.07943, -0.635102, -1.30794, 2.16813, -0.588485, -1.32093, 2.20564, -0.588022, -1.31417, 2.27021, -0.594063, 0.51113, 0.462544, -0.722887, 1.02599, 0.258543, 0.135486, -1.33861, 1.74123, -0.712047, -1.29005, 2.3618, -0.597682, -1.31417, 2.27021, -0.594063, -0.799506, 1.56865, 0.604355, 0.54954, 1.42924, -0.69439, -1.24962, 1.83106, -0.66945, -1.20669, 1.90302, -0.662778, -1.18836, 0.09897, -0.801452, -1.11128, 0.175516, -0.787772, -1.07262, 0.112208, -0.790214, 1.02599, 0.258543, 0.135486, -0.694043, 0.702619, 0.570891, 0.54954, 1.42924, -0.69439, 0.411181, 0.568744, -0.838409, -0.342171, 2.67985, 0.387936, -0.446539, 2.64969, 0.282684, -0.454431, 2.62349, 0.328354, -0.278926, 2.80527, 0.481108, -0.231235, 2.80403, 0.521685, -1.42591, 2.61747, 1.32006, -1.37874, 2.64325, 1.35411, -1.41953, 2.56968, 1.2698, -1.24585, 1.68849, -0.578678, -1.20029, 1.73925, -0.584149, -1.34092, 1.67868, -0.615971, -0.481455, 2.96642, 0.466606, -0.378181, 3.11063, 0.564935, 0.352378, 0.325343, -0.735345, 0.493935, 1.75908, -0.521895, -1.19789, 1.96266, -0.645858, -1.22616, 2.2733, -0.498828, -1.26299, 2.31222, -0.562156, -1.29005, 2.3618, -0.597682, -1.24447, 2.47118, -0.541952, -1.05802, 2.32318, 0.152049, -0.943778, 2.38483, 0.147924, -0.876893, 2.462, 0.088363, -0.347916, 2.74169, 0.37857, -0.475688, 2.72599, 0.311727, -0.37656, 2.69724, 0.325091, -1.17564, 1.78394, -0.600102, -1.15178, 1.84642, -0.60427, -1.15178, 1.84642, -0.60427, -1.16843, 2.03264, -0.586317, -1.22496, 2.09893, -0.593074, -1.17929, 2.19577, -0.488936, -1.22698, 2.22826, -0.509267, -1.22616, 2.2733, -0.498828, -1.23337, 2.38647, -0.527619, -1.23337, 2.38647, -0.527619, -1.24447, 2.47118, -0.541952, 1.18501, 0.732189, 0.128099, -0.826466, 2.50601, 0.323261, -1.14014, 1.90255, -0.6069, -1.23337, 2.38647, -0.527619, -1.05499, 0.798759, -0.646993, -1.05147, 0.21302, -0.751846, -1.05147, 0.21302, -0.751846, -0.938454, 0.227668, -0.714426, -0.951481, 0.123299, -0.752709, -0.559431, 2.5823, 0.272244, -0.419368, 2.77635, 0.394187, -1.0979, 2.46569, -0.183302, -1.12225, 2.52039, -0.15731, 0.391398, 0.04869, 0.366574, 0.507405, 1.08413, -0.832432, 0.531882, 0.962751, -0.826855, 0.278548, 0.115175, -0.752646, -0.37656, 2.69724, 0.325091, -1.12002, 2.08862, -0.510129, -1.19547, 2.36069, -0.484074, -1.23337, 2.38647, -0.527619, -0.962952, 0.046859, -0.731957, -1.145, 0.04265, -0.760517, -1.12442, 0.033242, -0.716467, 0.460619, 0.440846, -0.765295, -1.08003, 0.321787, 0.350853, -0.976232, 0.305392, 0.396208, -1.09319, 1.95056, -0.544014, -1.18007, 2.46297, -0.444676, -1.23337, 2.38647, -0.527619, -1.04345, 0.065569, -0.783247, 0.303572, 0.991374, -0.947429, 0.606365, 0.218282, -0.492872, 0.695474, 1.57177, -0.487778, 0.611668, 1.65246, -0.527556, 0.763853, 0.804799, -0.597198, 0.702188, 0.717141, -0.652213, 0.441803, 0.765127, -0.847417, 0.477498, 0.88749, -0.853899, 0.492209, 0.780722, -0.805514, -1.10024, 1.7841, -0.526777, -1.10024, 1.7841, -0.526777, -1.20029, 1.73925, -0.584149, -1.15188, 2.3086, -0.425987, -1.43304, 1.75714, -0.892604, 0.901433, 1.10652, -0.402709, -1.49784, 2.40813, 0.764622, -1.50952, 2.3823, 0.63786, -1.53869, 2.43064, 0.788972, 0.457567, 0.994847, -0.877324, -1.04528, 1.84486, -0.492977, -1.14014, 1.90255, -0.6069, -1.09319, 1.95056, -0.544014, -1.15567, 2.39175, -0.414601, -0.726265, 2.55699, 0.149208, 0.632482, 0.614309, -0.690454, 0.617982, 0.705671, -0.706092, -0.664683, 2.80836, 0.304571, -0.740892, 2.77715, 0.240359, -0.386894, 3.20862, 0.544583, -0.464028, 3.16758, 0.438489, -1.09319, 1.95056, -0.544014, -1.15188, 2.3086, -0.425987, -1.07555, 0.843777, 0.525789, 0.694085, 0.852785, -0.668166, 0.625958, 0.792739, -0.692727, 0.785594, 0.152133, 0.202013, 0.921406, 0.243095, 0.210495, 0.911157, 0.186965, 0.140516, -1.26585, 0.173032, -0.748289, -1.03169, 1.7833, -0.480728, -1.11709, 2.20074, -0.41096, -0.204191, 2.82878, 0.59139, -0.231235, 2.80403, 0.521685, -0.235382, 2.768, 0.523874, 0.682152, 1.27868, -0.676648, 0.823078, 1.58499, -0.092656, 0.695369, 0.605996, -0.653307, -0.389945, 3.02122, 0.542647, -0.610552, 0.384821, 0.650657, -0.537269, 0.389177, 0.749764, -0.548234, 0.309622, 0.734295, -1.04257, 1.93484, -0.484875, -1.09319, 1.95056, -0.544014, -1.04257, 1.93484, -0.484875, -1.04196, 2.03127, -0.452905, -1.09319, 1.95056, -0.544014, -1.09319, 1.95056, -0.544014, -1.17929, 2.19577, -0.488936, -1.11709, 2.20074, -0.41096, 0.277579, 1.07821, -0.932907, 0.609963, 0.86516, -0.730463, 0.606701, 1.24494, -0.740418, -0.332847, 2.99001, 0.576531, 0.650014, 0.968518, -0.729242, 0.545183, 0.895635, -0.792971, -1.04528, 1.84486, -0.492977, -0.491304, 2.69505, 0.250988, 0.706608, 0.537406, -0.622369, 0.689392, 1.17835, -0.704534, 0.640754, 1.09395, -0.721287, -1.13296, 2.45897, -0.343633, -1.91919, 1.74492, -0.336035, -0.988944, 1.95788, -0.384021, -1.04196, 2.03127, -0.452905, 0.50208, 1.54028, -0.644826, 0.568544, 0.56767, -0.73061, -1.91614, 2.29441, -0.273401, -1.91416, 2.23035, -0.18166, 0.549498, 0.737177, -0.74006, 0.540026, 0.790698, -0.753467, -1.03169, 1.7833, -0.480728, -1.00694, 1.87669, -0.422893, -0.036494, 0.136727, -0.810775, 0.498334, 0.389219, -0.680078, -0.320135, 3.19178, 0.648152, 0.535922, 0.442993, 0.640449, 0.611668, 0.467848, 0.563652, 0.563514, 0.388146, 0.609785, -1.20162, 0.273928, -0.381473, -1.31464, 0.226069, -0.415737, -0.813881, 2.68806, 0.444024, -0.524873, 2.8903, 0.422389, -1.06743, 2.52098, -0.06477, -1.05741, 2.62566, -0.013775, 0.864265, 1.20973, -0.445118, 0.545183, 0.895635, -0.792971, -1.54699, 1.28177, 0.494409, -1.592, 1.39873, 0.434974, -1.52794, 1.36341, 0.487738, -1.003, 2.05821, -0.353251, 0.499912, 0.035558, 0.099981, 0.612173, 0.05934, 0.108947, 0.741923, 1.21766, -0.640743, 1.22441, 0.417569, -0.13559, 1.25853, 0.502153, -0.096886, 0.695158, 1.06916, -0.692369, -0.813881, 2.68806, 0.444024, -0.784858, 2.76779, 0.470732, -0.717046, 2.70465, 0.4741, -0.705913, 0.070747, -0.849227, -0.739692, 0.117974, -0.820667, -0.776587, 0.06195, -0.758812, -1.00694, 1.87669, -0.422893, -1.82419, 1.04567, -0.135422, 0.887227, 0.773167, -0.412054, 0.102474, 0.104842, -0.781416, -1.21696, 0.769399, 0.487338, -1.08752, 0.712827, 0.439015, 1.26444, 0.739745, -0.057151, -1.08818, 0.097644, 0.431502, -0.990859, 0.162467, 0.433754, -1.49193, 2.33751, 0.497692, -0.389945, 3.02122, 0.542647, -0.481455, 2.96642, 0.466606, 1.02102, 0.816964, 0.057636, 0.960131, 0.877703, 0.129067, 0.833537, 0.251682, -0.447285, -0.474425, 0.160699, -0.95227, -0.539774, 0.123763, -0.955952, 0.890194, 0.262142, -0.427271, 0.413265, 0.110567, 0.447181, 0.462555, 0.207821, 0.489863, 0.456641, 0.156721, 0.383096, -1.81128, 0.988133, -0.119995, -0.278232, 3.17781, 0.763107, -0.288524, 3.19757, 0.721667, 0.248494, 0.798506, -0.957616, -0.446539, 2.64969, 0.282684, -0.491304, 2.69505, 0.250988, -0.553348, 2.66559, 0.194836, -1.34568, 2.51811, -0.541762, 1.24367, 0.525662, -0.242673, 0.545183, 0.895635, -0.792971, 0.54954, 1.42924, -0.69439, 1.18954, 0.383031, -0.235749, 1.23807, 0.474036, -0.208536, 1.20343, 0.802421, 0.014912, 1.18817, 0.778091, 0.080408, 1.13092, 0.821784, 0.040799, 1.18964, 0.360828, -0.14363, 1.22858, 0.804084, -0.091203, 1.2604, 0.747827, -0.156426, 1.26444, 0.739745, -0.057151, -1.3413, 2.79472, 1.4489, -1.06743, 2.52098, -0.06477, -1.0979, 2.46569, -0.183302, -1.31243, 2.99841, 1.47799, -1.32636, 3.05441, 1.455, -0.370794, 0.124814, -0.918954, -0.351852, 0.013269, 0.7022, -1.64618, 2.85723, 0.890331, -1.5875, 2.90387, 0.875936, -1.5597, 2.95861, 0.983419, -0.439678, 3.2195, 0.500407, -0.464028, 3.16758, 0.438489, -0.278926, 2.80527, 0.481108, 0.658728, 0.903443, -0.714721, -0.970128, 2.52529, -0.005545, -0.326428, 0.258922, -0.882123, -1.06, 2.19253, 0.142831, -1.04699, 2.27604, 0.072516, -0.702104, 2.88089, 0.509078, -0.516476, 3.09543, 0.578068, -0.570627, 2.95364, 0.574111, -1.68989, 0.814943, -0.152701, -0.944599, 2.47396, 0.023036, -1.03863, 2.44462, -0.053341, -0.981893, 2.65599, 0.019731, 1.02599, 0.258543, 0.135486, 1.26444, 0.739745, -0.057151, -1.29239, 2.94032, 1.41022, -1.31628, 3.02674, 1.40087, -1.31569, 2.9286, 1.29492, 0.525652, 0.203381, 0.331616, -0.970128, 2.52529, -0.005545, -0.953417, 2.6091, 0.032317, -0.981893, 2.65599, 0.019731, -0.66704, 1.46548, 0.654361, 0.457693, 1.85635, -0.465954, 0.401311, 1.86193, -0.488873, 0.32123, 0.812207, -0.925562, -1.32055, 2.75695, 1.43404, -1.28309, 2.88419, 1.46437, -1.85641, 1.29444, -0.315788, -1.86809, 1.34815, -0.2597, -1.86946, 1.21021, -0.262352, -0.650183, 0.303666, 0.709124, -0.610552, 0.384821, 0.650657, -0.548234, 0.309622, 0.734295, 0.935507, 1.02846, -0.332815, 0.859214, 1.30886, -0.41921, -0.690318, 2.66249, 0.137717, 0.864265, 1.20973, -0.445118, -0.988944, 1.95788, -0.384021, -1.55313, 1.599, -0.641438, -1.46023, 1.59273, -0.605469, -1.44958, 1.62565, -0.636976, 0.950471, 0.8008, -0.290259, -0.959079, 2.39202, 0.065002, -0.879819, 2.58534, 0.04808, -0.970128, 2.52529, -0.005545, -0.900023, 2.61594, 0.074452, -0.953417, 2.6091, 0.032317, -0.928372, 1.26075, 0.654803, -1.07502, 1.28198, 0.641944, -1.07631, 1.33931, 0.648952, -0.240769, 0.098086, -0.874188, 0.545183, 0.895635, -0.792971, -0.219386, 0.115912, 0.052838, -0.348442, 0.111661, -0.031074, -0.299952, 0.11928, 0.274497, -1.35222, 2.68276, 1.38443, -1.3413, 2.79472, 1.4489, -1.32055, 2.75695, 1.43404, -1.0979, 2.46569, -0.183302, -1.10217, 2.39609, -0.214577, -0.663716, 0.247494, 0.774893, 0.80683, 0.123131, 0.118818, -0.155279, 0.126435, -0.845839, -0.970128, 2.52529, -0.005545, -0.879819, 2.58534, 0.04808, -0.875546, 2.66866, 0.109494, -0.953417, 2.6091, 0.032317, -0.900023, 2.61594, 0.074452, -0.875546, 2.66866, 0.109494, 1.02095, 0.606143, -0.454757, 0.857026, 0.95749, 0.356788, 0.864265, 1.20973, -0.445118, 0.54954, 1.42924, -0.69439, -0.795065, 2.57898, 0.091962, -0.944599, 2.47396, 0.023036, -1.75865, 2.51668, 0.022278, -1.66005, 2.53586, 0.100002, -1.7513, 2.478, 0.095266, 1.02599, 0.258543, 0.135486, 0.872937, 1.10553, 0.376676, -0.795065, 2.57898, 0.091962, -1.5026, 1.9301, 0.364806, -0.773493, 2.63164, 0.095834, -0.875546, 2.66866, 0.109494, -0.315294, 0.201844, -0.897949, 0.545183, 0.895635, -0.792971, 0.54954, 1.42924, -0.69439, -0.795065, 2.57898, 0.091962, -0.773493, 2.63164, 0.095834, -0.879819, 2.58534, 0.04808, -0.194657, 3.0365, 0.778912, -0.201707, 2.97343, 0.781459, -0.373108, 0.069632, -0.915144, 0.960131, 0.877703, 0.129067, -0.797338, 2.71532, 0.178736, -0.797338, 2.71532, 0.178736, -1.28553, 2.84877, 1.42971, -0.557053, 3.11614, 0.354009, -0.597693, 3.10907, 0.349084, -0.614067, 3.01422, 0.302298, -0.326428, 0.258922, -0.882123, -1.53265, 2.35982, 0.513414, -0.736578, 0.407256, 0.4017, -0.791635, 0.348411, 0.428619, -0.914776, 1.92638, -0.290007, -1.59958, 2.74933, 0.563209, -1.61854, 2.8223, 0.750732, -1.62919, 2.72811, 0.62075, -0.378181, 3.11063, 0.564935, -0.283472, 2.73628, 0.43649, -0.857657, 0.343149, 0.421463, -0.325186, 3.21999, 0.705798, -1.85397, 1.64949, -0.205759, -0.984039, 2.10173, 0.013018, -1.0242, 2.17628, 0.040693, -1.01936, 2.2008, -0.094824, 0.545183, 0.895635, -0.792971, -0.659927, 2.63328, 0.143673, -1.0859, 1.08265, 0.638555, -1.10863, 1.16261, 0.644554, -1.03095, 1.21545, 0.643101, 0.54954, 1.42924, -0.69439, 0.54954, 1.42924, -0.69439, -0.614067, 3.01422, 0.302298, -0.597693, 3.10907, 0.349084, -0.631304, 3.05446, 0.294132, -1.84847, 2.32632, -0.567586, -1.88171, 2.32661, -0.466922, -1.87543, 2.22109, -0.608647, -1.34185, 2.65481, 1.23953, -1.83084, 1.12521, -0.287944, -1.88122, 1.38997, -0.184838, -1.31272, 2.5287, 0.794213, -1.30611, 2.60969, 0.894983, -1.29626, 2.60628, 0.730001, -1.31272, 2.5287, 0.794213, -1.30001, 2.68758, 0.900476, -1.3325, 2.77919, 0.876252, -1.30234, 2.67337, 0.727054, -1.93668, 1.74967, -0.570427, -1.26947, 0.114965, -0.768325, -1.3244, 0.127972, -0.71491, -1.30491, 0.072704, -0.740397, -1.79392, 1.63724, -0.332499, -1.81337, 1.58701, -0.200055, -1.26518, 0.054078, -0.761211, -0.376097, 0.109935, -0.242105, -0.542952, 0.1028, -0.236591, -1.79462, 1.52662, -0.306255, -1.77048, 1.58562, -0.336561, -1.96943, 1.93132, -0.367752, -1.94891, 2.04581, -0.346095, -0.909768, 0.279548, 0.431691, -1.92115, 2.10754, -0.335677, -1.31143, 2.75139, 1.03892, -1.87971, 2.17933, -0.457114, 1.17562, 0.629904, 0.169413, -1.95046, 1.7687, -0.066306, 0.510415, 0.494093, 0.694412, 0.73763, 0.168233, -0.383684, 0.609248, 0.130055, -0.389261, 0.706818, 0.11204, -0.298635, -0.708334, 0.028696, -0.592967, -0.882112, 0.031306, -0.514802, -0.757984, 0.059046, -0.437639, 0.63444, 1.12184, 0.613447, 0.744175, 1.14615, 0.544015, -0.194657, 3.0365, 0.778912, -0.194257, 2.94992, 0.693212, -0.183018, 2.94512, 0.746059, -1.95815, 1.83699, -0.052142, -1.05802, 2.32318, 0.152049, -1.94127, 1.93425, -0.67448, -1.88934, 2.02186, -0.72154, -0.183018, 2.94512, 0.746059, -1.14645, 0.272686, -0.313031, -1.32234, 2.50271, 0.378339, 0.389482, 0.111829, 0.544584, -1.10099, 0.381032, -0.331405, -1.09083, 0.32808, -0.271654, -0.686235, 0.595262, 0.509163, 0.350189, 0.109767, 0.60244, 0.293596, 0.039978, 0.575669, -1.29472, 2.99264, 1.46001, 0.018521, 1.39441, 0.696538, 0.146966, 1.36274, 0.705882, 0.054805, 1.34615, 0.781796, 0.795865, 0.983229, 0.463639, 0.806114, 1.08533, 0.488663, 0.768694, 1.03151, 0.525516, 0.806114, 1.08533, 0.488663, -1.37129, 2.25962, 0.345675, -1.44241, 2.2375, 0.348201, -1.48193, 2.27955, 0.361965, 0.686109, 0.436215, 0.41557, 0.7515, 0.486222, 0.37333, 0.698862, 0.379665, 0.336267, -0.283472, 2.73628, 0.43649, 0.252745, 0.062749, 0.641396, -1.34435, 2.70277, 0.606207, -1.8252, 1.40876, 0.109136, -1.85481, 1.35874, 0.064413, 0.786689, 0.844219, 0.449854, 0.736241, 0.731579, 0.514004, 0.705156, 0.838263, 0.542458, -0.204191, 2.82878, 0.59139, -0.189059, 2.86826, 0.661327, -0.55598, 0.246105, 0.77765, -0.663716, 0.247494, 0.774893, -0.548234, 0.309622, 0.734295, -1.79116, 1.09852, -0.356513, -1.85978, 1.69712, 0.061382, -1.06071, 0.396733, -0.532418, -1.10756, 0.367331, -0.427397, -1.85209, 1.12904, -0.141588, 0.806114, 1.08533, 0.488663, 0.864434, 1.17319, 0.389936, 0.813397, 1.20327, 0.448065, -0.139747, 1.45728, 0.678922, -0.179672, 1.40885, 0.696433, -0.261606, 1.4707, 0.685299, -1.3454, 2.84006, 1.04115, -1.29009, 0.019352, 0.380128, -1.34099, 0.016764, 0.352453, 0.592411, 0.964014, 0.656045, 0.645805, 0.899655, 0.621234, -0.204191, 2.82878, 0.59139, 0.820742, 1.34922, 0.347675, 0.745185, 1.3724, 0.436679, 0.772061, 1.43145, 0.391219, -1.05587, 0.431059, -0.158173, -1.11356, 0.506426, -0.257785, -1.88528, 1.84792, 0.109789, -1.89837, 1.75935, 0.064497, 0.747942, 0.906726, 0.487738, -1.30001, 2.68758, 0.900476, -1.85481, 1.35874, 0.064413, -1.83999, 1.31515, 0.099097, 0.731274, 0.637292, 0.4922, 0.802095, 0.669934, 0.418432, 0.525967, 0.69277, 0.679953, 0.614909, 0.733873, 0.613679, 0.59361, 0.661074, 0.61955, -1.91146, 1.88971, 0.055552, -1.89837, 1.75935, 0.064497, -0.878388, 1.97615, 0.271781, -0.88649, 2.00509, 0.161309, -0.779849, 1.98194, 0.176463, -0.092225, 1.96628, 0.330206, 0.075009, 1.99242, 0.277948, -0.050196, 1.89258, 0.402437, -0.241022, 2.93018, 0.748922, -0.229552, 3.0204, 0.799453, -0.201707, 2.97343, 0.781459, -0.246305, 1.35486, -0.901885, 0.426187, 0.08529, -0.643752, 0.498418, 0.142725, -0.597913, -1.88589, 2.24628, -0.432911, -1.88661, 2.21909, -0.534628, 0.77928, 1.28316, 0.429629, -1.31143, 2.75139, 1.03892, -0.235382, 2.768, 0.523874, 0.806114, 1.08533, 0.488663, 0.625916, 0.411613, 0.52541, 0.625937, 0.365016, 0.478393, -1.91014, 2.29938, -0.363438, 0.362207, 0.047954, 0.492999, -1.3324, 2.60186, 0.475194, -1.50342, 0.938506, -0.617108, -1.37948, 0.872357, -0.640406, -0.373908, 3.21466, 0.66903, -0.363491, 3.24145, 0.604397, -0.522642, 1.32334, 0.713501, -0.40089, 1.33815, 0.764391, -0.542594, 1.27956, 0.781396, 0.847786, 0.834621, 0.379413, 0.839957, 0.74065, 0.385348, -1.592, 1.39873, 0.434974, -1.6793, 1.48451, 0.323429, -1.57182, 1.57596, 0.374361, 0.856709, 0.662842, 0.301625, 0.755877, 0.566892, 0.435795, 0.598871, 0.317515, 0.454316, 0.61472, 0.304529, 0.362996, -0.236623, 2.76957, 0.567839, -0.235382, 2.768, 0.523874, -1.63515, 2.96118, 1.05691, -1.65634, 2.94982, 1.08303, 0.817206, 0.565293, 0.319157, 0.35122, 0.08409, -0.721076, 0.469164, 0.085711, -0.512718, 0.402573, 0.055972, -0.587243, -1.28492, 0.24017, -0.077502, -1.16497, 0.209526, -0.218786, -1.21759, 0.283356, -0.0489, -1.06484, 0.356577, -0.219607, -1.05842, 0.339234, -0.177324, -0.112577, 0.017858, 0.65958, 0.029654, 0.037915, 0.673577, 0.136464, 0.027623, 0.622855, 0.817416, 0.522526, 0.294596, 0.809503, 0.46206, 0.314043, -0.825161, 1.02191, 0.616878, -0.752405, 0.931666, 0.591685, -1.37796, 0.266161, 0.088006, -1.31011, 0.285377, 0.032612, -1.21464, 0.331216, 0.030781, -1.9186, 2.28273, -0.145945, -1.50066, 1.68944, -0.856698, -0.205938, 2.8687, 0.704977, -1.37161, 0.090678, -0.3623, -1.35572, 0.174757, -0.410475, -1.32775, 0.13961, -0.346052, -0.414759, 1.26144, 0.912915, -0.395081, 1.19664, 0.962479, -0.490084, 1.18885, 0.942169, 0.723992, 1.51637, 0.399133, 0.772061, 1.43145, 0.391219, 0.696232, 1.46805, 0.453053, 0.772061, 1.43145, 0.391219, -1.64207, 0.800063, -0.264814, 0.913893, 1.23919, -0.332499, 0.864265, 1.20973, -0.445118, -1.68476, 1.76207, -0.842324, -1.65948, 1.80353, -0.881491, -0.332153, 1.42585, 0.683237, -0.123963, 0.038083, 0.69376, -0.067011, 0.06839, -0.823614, -1.89837, 1.75935, 0.064497, 0.489242, 0.627421, 0.711102, -0.802284, 0.656254, 0.474983, -0.874641, 0.774366, 0.536965, 0.525925, 0.10783, -0.435457, -0.233551, 3.13679, 0.774114, -0.360776, 1.36962, 0.708492, -1.31922, 2.82989, 1.14604, -1.09239, 0.276117, -0.224805, -1.10261, 0.262415, -0.18829, 0.879145, 0.770031, 0.313579, -1.03348, 2.18226, -0.222553, 0.772061, 1.43145, 0.391219, -0.212378, 1.37324, 0.767569, -0.06497, 1.37688, 0.760666, -0.172769, 1.34268, 0.83237, -1.10261, 0.262415, -0.18829, -1.05842, 0.339234, -0.177324, -1.10522, 0.307223, -0.128771, 0.428439, 0.224806, 0.614458, 1.11347, 0.678732, 0.19469, 1.11806, 0.547866, 0.244653, 1.05234, 0.602587, 0.25686, 0.671566, 0.666672, 0.572723, -1.88219, 2.40611, -0.398943, -1.35477, 2.94609, 1.21996, 0.77303, 1.64553, 0.102548, 0.363111, 0.23897, 0.669409, -0.179041, 0.127298, 0.457558, -0.405962, 0.121679, 0.482855, -0.233887, 0.111745, 0.513225, -0.828024, 0.051763, -0.710385, -0.857846, 0.035515, -0.668292, -0.909768, 0.279548, 0.431691, -1.89837, 1.75935, 0.064497, -1.81476, 1.71922, 0.137422, -0.893751, 0.025434, 0.757677, -0.819142, 0.016553, 0.795182, -1.54149, 2.51151, 0.935371, -1.55919, 2.46024, 0.870253, -1.31922, 2.82989, 1.14604, -1.76559, 1.00619, 0.135633, -1.09083, 0.32808, -0.271654, -1.09239, 0.276117, -0.224805, -0.347916, 2.74169, 0.37857, -0.37656, 2.69724, 0.325091, -0.342171, 2.67985, 0.387936, -0.755035, 0.037789, 0.833107, 0.869611, 1.39992, -0.326985, 0.080502, 0.066264, 0.686478, -1.12265, 2.3368, -0.326669, 0.047438, 0.072199, 0.495083, 0.174137, 0.056078, 0.450149, 0.093698, 0.099433, 0.456653, 0.864265, 1.20973, -0.445118, -1.31381, 0.187406, -0.12433, -0.036536, 1.24728, 0.906032, -0.134948, 1.26058, 0.916724, -0.017342, 1.30875, 0.858594, 0.885648, 0.641901, 0.237413, -1.31569, 2.9286, 1.29492, -0.229552, 3.0204, 0.799453, 0.932918, 1.21726, -0.281146, 1.1389, 0.311327, -0.184038, -0.816406, 1.0997, 0.645227, -0.746512, 0.99371, 0.653814, -1.09685, 2.29022, -0.247725, -1.08374, 2.20951, -0.314063, -1.09685, 2.29022, -0.247725, -1.11709, 2.20074, -0.41096, -1.71618, 0.94644, -0.378569, -1.75821, 1.01419, -0.384609, -1.7203, 0.923521, -0.306739, -1.08374, 2.20951, -0.314063, -1.03348, 2.18226, -0.222553, -0.882555, 1.1677, 0.649604, -0.769304, 1.10147, 0.659075, -0.229552, 3.0204, 0.799453, -1.06269, 2.28602, -0.158952, -1.09685, 2.29022, -0.247725, 1.10836, 0.309222, -0.262267, -0.546446, 0.01066, 0.737894, -0.699599, 0.012597, 0.74627, -0.697979, 0.013165, 0.809472, 0.402405, 0.298594, 0.649373, 1.02599, 0.258543, 0.135486, -1.33732, 2.74318, 0.729306, -0.730474, 1.07453, 0.695401, -1.01936, 2.2008, -0.094824, -1.43519, 2.97631, 1.13872, -1.34957, 3.08445, 1.41998, -1.36367, 3.07007, 1.36006, -1.31628, 3.02674, 1.40087, -1.36296, 2.5284, 0.226806, -1.52834, 2.32983, 0.41517, -1.61206, 3.04227, 1.17559, -1.14605, 2.52548, -0.289712, -1.19181, 2.51978, -0.439646, -1.13296, 2.45897, -0.343633, -1.35658, 2.53499, 0.291649, -1.53168, 3.06357, 1.19855, -1.35658, 2.53499, 0.291649, -1.42563, 3.03714, 1.24416, -0.954112, 2.01906, 0.150639, -0.984039, 2.10173, 0.013018, -0.948703, 2.06808, -0.050647, 1.26444, 0.739745, -0.057151, 1.19644, 0.821573, -0.176778, 1.14406, 0.809997, -0.266056, 1.14406, 0.809997, -0.266056, 1.14406, 0.809997, -0.266056, -1.53678, 2.58954, -0.287902, -1.52598, 2.55953, -0.438804, -0.545519, 3.15163, 0.468922, -1.30695, 2.54842, -0.46507, -1.42734, 2.55844, -0.452379, -1.41467, 2.70934, 0.472984, 1.20343, 0.802421, 0.014912, 1.17623, 0.833401, -0.040629, 1.15584, 0.84565, -0.136474, 1.13684, 0.83982, -0.209168, 1.14406, 0.809997, -0.266056, -1.06, 2.19253, 0.142831, 1.13684, 0.83982, -0.209168, 1.06877, 0.824477, -0.251302, 1.14406, 0.809997, -0.266056, -0.716057, 3.00942, 0.262373, -0.686045, 2.98871, 0.238549, -0.631304, 3.05446, 0.294132, 1.14406, 0.809997, -0.266056, 1.08466, 0.8527, -0.083332, 1.15584, 0.84565, -0.136474, 1.17623, 0.833401, -0.040629, 1.06332, 0.850638, -0.156321, 1.08906, 0.840094, -0.00685, 1.01458, 0.835905, -0.173747, 0.962215, 0.768368, -0.311684, 1.01458, 0.835905, -0.173747, -1.19181, 2.51978, -0.439646, -0.718751, 2.97694, 0.464123, 0.998583, 0.856804, -0.077671, 1.02102, 0.816964, 0.057636, 0.998583, 0.856804, -0.077671, -0.68855, 1.59921, 0.582572, -0.784563, 2.94457, 0.20216, -1.30731, 2.58927, -0.195615, -0.669882, 1.96594, -0.026802, -1.31628, 3.02674, 1.40087, -1.32636, 3.05441, 1.455, -1.34957, 3.08445, 1.41998, -1.52908, 2.79281, 0.567229, -1.52003, 2.65155, 0.298089, -1.49142, 2.70202, 0.388756, -1.2822, 0.118733, -0.288954, -1.7883, 2.53066, -0.082386, -1.7883, 2.53066, -0.082386, -1.28637, 2.58271, -0.289965, -1.38358, 2.5818, -0.363648, -1.7883, 2.53066, -0.082386, -1.7883, 2.53066, -0.082386, -0.843556, 1.96369, -0.22872, -0.742976, 1.94673, 0.250315, -0.710543, 1.96148, 0.147882, -0.642817, 1.93202, 0.160826, -1.48864, 2.58277, 0.038589, -0.92168, 2.87438, 0.337635, -1.39108, 2.5749, 0.033327, -1.42654, 2.59213, -0.116523, -1.29734, 2.58531, -0.04968, -1.36367, 3.07007, 1.36006, -0.76238, 1.99507, -0.023372, -0.903538, 2.02683, -0.011165, -0.790056, 1.98804, -0.138516, -1.33732, 2.74318, 0.729306, -1.40179, 2.77376, 0.618982, -1.46141, 2.77429, 0.54633, -1.46004, 2.68629, 0.37735, -0.791466, 1.92038, -0.327785, -1.94878, 1.81961, -0.380169, -0.215598, 3.07228, 0.80562, -1.43519, 2.97631, 1.13872, -1.33724, 0.221901, -0.615276, -1.07847, 0.657875, -0.537069, -1.07984, 0.579625, -0.477655, -1.7883, 2.53066, -0.082386, -1.5867, 3.08428, 1.2868, -1.63292, 3.03484, 1.2409, -1.55105, 2.59184, -0.11829, -0.710543, 1.96148, 0.147882, -0.905958, 1.99667, -0.170527, -1.05741, 2.62566, -0.013775, -1.09104, 2.68634, 0.033622, -0.932055, 1.9591, -0.253723, -0.951839, 2.0283, -0.244946, -1.0053, 2.10544, -0.297478, 1.26444, 0.739745, -0.057151, -1.46358, 2.52775, -0.528819, -0.932055, 1.9591, -0.253723, -0.905958, 1.99667, -0.170527, -1.25398, 2.59401, 0.017227, -1.369, 3.09402, 1.44164, -1.44232, 2.59542, -0.257996, -1.55105, 2.59184, -0.11829, -1.37474, 2.54497, 0.164698, -1.05741, 2.62566, -0.013775, -0.043187, 1.43017, -0.776323, -1.49142, 2.70202, 0.388756, -1.46004, 2.68629, 0.37735, -1.56361, 2.74838, 0.510867, -1.58977, 2.66845, 0.403636, -1.32838, 2.55236, 0.121364, -0.580814, 2.8795, 0.566345, -0.652014, 2.80685, 0.525747, -0.948703, 2.06808, -0.050647, -0.979662, 2.1094, -0.171538, -0.905958, 1.99667, -0.170527, -1.87619, 2.1788, -0.36228, -1.47791, 2.49303, -0.588864, -1.27296, 2.58237, 0.09272, -1.35873, 0.140157, -0.645541, -1.37828, 0.167476, -0.559314, -1.40598, 0.092551, -0.516822, -1.31272, 2.5287, 0.794213, -0.932055, 1.9591, -0.253723, -1.55105, 2.59184, -0.11829, -0.534828, 1.93088, 0.181219, -0.88649, 2.00509, 0.161309, -0.903538, 2.02683, -0.011165, -0.824803, 2.00574, 0.077966, -1.55105, 2.59184, -0.11829, -1.3224, 0.256817, -0.544751, -1.36365, 0.184018, -0.481486, 0.637703, 1.73748, -0.419778, -0.543204, 1.17667, 0.92228, -0.567492, 1.08457, 0.949219, -0.613815, 1.10309, 0.8925, -0.984039, 2.10173, 0.013018, 0.759812, 1.67698, -0.036883, -1.8153, 1.43299, -0.350936, -1.83957, 1.4537, -0.279504, -1.14073, 1.71604, -0.549402, 0.706482, 1.73119, -0.274832, -1.66539, 2.82829, 0.931203, -1.55105, 2.59184, -0.11829, -1.7883, 2.53066, -0.082386, 0.708502, 1.74182, -0.177662, -0.979662, 2.1094, -0.171538, -1.7883, 2.53066, -0.082386, -1.7883, 2.53066, -0.082386, -0.779849, 1.98194, 0.176463, -0.824803, 2.00574, 0.077966, -0.911514, 0.477256, 0.423904, -0.870516, 0.603113, 0.453621, -0.988944, 1.95788, -0.384021, -0.914776, 1.92638, -0.290007, -0.507363, 3.17438, 0.426913, -1.2106, 2.64753, 0.09634, 0.722435, 1.66166, 0.231099, 0.559389, 1.7688, -0.465722, 0.550318, 1.83453, -0.390797, -1.4134, 0.189258, -0.0316, -1.41654, 0.235645, 0.024067, 0.311527, 1.39033, 0.664694, 0.28482, 1.46426, 0.638092, 0.392744, 1.41699, 0.649626, 0.691938, 1.76649, -0.011712, 0.640754, 1.80753, -0.254291, 0.603523, 1.82293, -0.332668, -0.824803, 2.00574, 0.077966, 0.690738, 1.75895, 0.090363, 0.615667, 1.84358, -0.074914, 0.557473, 1.87991, -0.245368, 0.648983, 1.73761, 0.250841, 0.663, 1.77358, 0.14845, 0.722435, 1.66166, 0.231099, -1.79462, 1.46687, 0.154596, -0.88649, 2.00509, 0.161309, -1.0053, 2.10544, -0.297478, -1.42668, 3.11292, 1.40864, -1.43401, 3.0955, 1.42179, 0.613099, 1.8372, 0.055299, 0.491157, 1.90581, -0.339571, -0.954112, 2.01906, 0.150639, -0.995279, 2.05354, 0.148345, -1.91687, 1.72747, -0.660906, 0.428481, 1.92587, -0.361291, -1.10756, 0.367331, -0.427397, -1.14645, 0.272686, -0.313031, -0.04527, 1.39866, -0.865223, 0.533397, 1.9103, -0.02615, 0.50511, 1.93008, -0.142662, 0.452579, 1.95014, -0.263362, 0.35423, 1.93395, -0.414327, 0.541436, 1.85726, 0.184692, 0.510309, 1.91093, 0.081312, -0.954112, 2.01906, 0.150639, -0.903538, 2.02683, -0.011165, -0.88649, 2.00509, 0.161309, 0.400132, 1.98638, -0.190416, -0.557053, 3.11614, 0.354009, 0.357408, 1.98192, -0.298678, -0.903538, 2.02683, -0.011165, -0.954112, 2.01906, 0.150639, -1.23337, 2.38647, -0.527619, 0.443445, 1.93618, 0.160783, 0.229741, 1.96479, -0.444444, 0.229741, 1.96479, -0.444444, -1.32234, 2.50271, 0.378339, -0.879145, 1.494, 0.622391, 0.332531, 2.02115, -0.094655, 0.229741, 1.96479, -0.444444, 0.229741, 1.96479, -0.444444, -1.79207, 2.2451, 0.131719, 0.332531, 2.02115, -0.094655, -1.0053, 2.10544, -0.297478, -0.683836, 0.509646, 0.4387, -0.717846, 0.599514, 0.458651, -1.20427, 0.505521, 0.080429, -0.486653, 1.29509, -0.812796, -1.3711, 0.062391, -0.653181, -1.28176, 0.219902, -0.714299, -1.27079, 0.272349, -0.65979, -1.6542, 2.97669, 1.16486, -1.16674, 0.556453, -0.300529, -1.22422, 0.568344, -0.291837, -1.33724, 0.221901, -0.615276, -0.383547, 1.35777, -0.802042, -0.680468, 0.330269, -0.711037, -0.760844, 0.28464, -0.673512, -0.725128, 0.243789, -0.77205, -0.674407, 0.36792, -0.644068, -0.614025, 0.405846, -0.608184, -0.614025, 0.405846, -0.608184, -1.51838, 1.2328, -0.689381, -1.08822, 0.410202, 0.339782, -0.978042, 0.385642, 0.390819, -0.784858, 2.76779, 0.470732, -0.822657, 2.85681, 0.434911, -0.406635, 1.24475, -0.948797, -0.427681, 1.28421, -0.901822, -0.552949, 0.939726, -0.833779, -0.503932, 0.96433, -0.942778, -0.573069, 1.15777, -0.824393, -1.22289, 0.704745, 0.395323, -0.576941, 0.847923, -0.7135, -0.509067, 0.826876, -0.819573, -1.04733, 0.489547, -0.523725, -1.53869, 2.43064, 0.788972, -0.609311, 0.132707, -0.938021, -0.535396, 1.21432, -0.844218, -1.19063, 1.93252, 0.335236, -0.456557, 0.11124, 0.089016, -0.584897, 0.106968, 0.016869, -0.675038, 0.112439, 0.192796, -0.643132, 1.17113, 0.76378, -0.480949, 1.21341, -0.916365, -0.406635, 1.24475, -0.948797, -1.55982, 1.39877, -0.622938, -0.426566, 0.616371, -0.830749, -1.44095, 2.14673, 0.359376, -0.789256, 0.205317, -0.720802, -1.47021, 1.41638, 0.49643, -0.504858, 1.11576, -0.946587, -1.02243, 2.81834, 0.237097, -0.452095, 0.867391, -0.928529, -1.62852, 2.62366, 0.481402, -1.60844, 2.61779, 0.374087, -1.76542, 2.11165, -0.849732, -0.789256, 0.152406, -0.748352, -0.789256, 0.205317, -0.720802, -0.824593, 0.198393, -0.688981, -0.433153, 0.980578, -0.994951, -0.525778, 1.02698, -0.940379, -1.34837, 1.20367, 0.580783, -1.34938, 1.31601, 0.565188, -1.28298, 1.28787, 0.584151, -1.46232, 1.10862, 0.545888, -1.45642, 1.26401, 0.530903, -1.41155, 1.22413, 0.550687, -1.15854, 0.416432, 0.266983, -1.10758, 0.569586, 0.372446, -1.11501, 0.559273, -0.367731, -1.17861, 0.607174, -0.403909, -0.722603, 0.167159, -0.835252, -1.09203, 0.428155, -0.42022, -0.74769, 3.00908, 0.286387, -0.951481, 0.123299, -0.752709, -1.31272, 2.5287, 0.794213, -0.662705, 0.293584, -0.768473, -1.29472, 2.99264, 1.46001, -1.10756, 0.367331, -0.427397, -0.433153, 0.980578, -0.994951, -1.15138, 0.641501, -0.482622, -1.37828, 0.167476, -0.559314, -1.36365, 0.184018, -0.481486, -1.40598, 0.092551, -0.516822, -0.421305, 0.727959, -0.901316, -0.373108, 0.069632, -0.915144, -1.60844, 2.61779, 0.374087, -1.62029, 2.54057, 0.232277, -1.76448, 2.23717, -0.760917, -1.73059, 2.36048, -0.670545, -1.58977, 2.66845, 0.403636, 0.539205, 1.80633, 0.289861, -0.674407, 0.36792, -0.644068, -0.72195, 0.369141, -0.621843, -1.7343, 1.87069, -0.855015, -1.76376, 1.94953, -0.87764, -1.81817, 1.8669, -0.834958, -0.725128, 0.243789, -0.77205, -1.41155, 1.22413, 0.550687, -1.3973, 0.09958, -0.439498, -1.75901, 1.84251, -0.851079, -1.77107, 2.03243, -0.878566, -1.81322, 1.98625, -0.838157, -0.831223, 0.096192, -0.71834, -0.726159, 0.908136, 0.654803, -1.63414, 1.0362, -0.56948, -1.6088, 0.937201, -0.526335, -1.49864, 0.118438, 0.167687, -1.52531, 0.068937, 0.15125, 0.659843, 0.203486, 0.282305, 0.743986, 0.17419, 0.243032, -1.62511, 1.10734, -0.603638, -1.79264, 1.76973, -0.829212, -1.82271, 2.08963, -0.800674, -1.81322, 1.98625, -0.838157, -1.81322, 1.98625, -0.838157, -1.58051, 1.20159, -0.649098, 1.14406, 0.809997, -0.266056, -0.657023, 0.228699, -0.86377, -0.628084, 0.29047, -0.820962, -1.34185, 1.46336, 0.551908, -1.38335, 1.5599, 0.485275, -1.27353, 1.56802, 0.542605, -1.68518, 1.21238, -0.544119, -1.86815, 1.81984, -0.795981, -1.74076, 1.75756, -0.83721, -1.40259, 2.6819, 1.38027, -1.17708, 0.061802, -0.792108, -0.499428, 1.44968, 0.685594, -0.457336, 1.37707, 0.695506, -1.50889, 0.136391, 0.057362, -1.4656, 0.187322, 0.116944, -1.73646, 1.99255, 0.282431, -1.75627, 2.12467, 0.219439, -1.6974, 2.06711, 0.27738, -1.83084, 2.21286, -0.706681, -1.35572, 0.174757, -0.410475, -1.37161, 0.090678, -0.3623, 0.417537, 1.33725, 0.663495, 0.503238, 1.36886, 0.621844, 0.485917, 1.28421, 0.651393, -1.38665, 0.043029, -0.435184, -1.12151, 0.398732, -0.062938, -1.67821, 2.16961, 0.271234, -1.51011, 0.080154, 0.000895, -0.283472, 2.73628, 0.43649, -0.347916, 2.74169, 0.37857, -0.342171, 2.67985, 0.387936, -1.81322, 1.98625, -0.838157, -1.49778, 0.134391, 0.013165, -1.50889, 0.136391, 0.057362, -1.47318, 0.191363, 0.043135, -1.4656, 0.187322, 0.116944, -1.85738, 1.97722, -0.787162, -1.47318, 0.191363, 0.043135, -0.713406, 0.506047, 0.416454, -0.691918, 0.393491, 0.413108, -1.81322, 1.98625, -0.838157, -1.37542, 1.39565, 0.537933, -0.433153, 0.980578, -0.994951, -1.40436, 0.06136, -0.528461, -1.66072, 1.30172, -0.561862, -1.37426, 0.037851, -0.526251, -1.49778, 0.134391, 0.013165, -1.83039, 1.17715, -0.339697, -1.81728, 1.23629, -0.380337, -1.80695, 1.3479, -0.393049, -0.662705, 0.293584, -0.768473, -1.81322, 1.98625, -0.838157, -1.45219, 0.11547, -0.042713, -1.4134, 0.189258, -0.0316, -0.824593, 0.198393, -0.688981, -0.557074, 0.312232, -0.854131, -0.628084, 0.29047, -0.820962, -1.19955, 2.61893, 0.171264, -1.45659, 0.052079, -0.069504, -0.722603, 0.167159, -0.835252, -0.725128, 0.243789, -0.77205, -0.739692, 0.117974, -0.820667, -0.628084, 0.29047, -0.820962, -0.662705, 0.293584, -0.768473, -1.76393, 1.12296, -0.431101, -1.76366, 1.47169, -0.406161, -1.41023, 0.637965, 0.220745, -0.589317, 0.591285, -0.60469, -1.59381, 1.48501, -0.575226, -1.41543, 0.10863, -0.100906, -1.75564, 1.28691, -0.466353, -0.722603, 0.167159, -0.835252, -0.901181, 2.71963, 0.401511, -0.557074, 0.312232, -0.854131, -1.21389, 1.12129, 0.627969, -1.16855, 1.03014, 0.633356, -1.69168, 1.36421, -0.524188, -1.41543, 0.10863, -0.100906, 0.036452, 0.031117, 0.533472, -0.889773, 1.3049, 0.658781, 0.451317, 1.88906, 0.245642, -1.80968, 2.39356, -0.549044, -1.35035, 0.061466, -0.188332, -1.62919, 2.72811, 0.62075, -1.61854, 2.8223, 0.750732, -1.7094, 1.01069, -0.473888, -1.71956, 1.4457, -0.467237, -0.393271, 3.23935, 0.6101, -0.439678, 3.2195, 0.500407, -1.12901, 0.344685, -0.072872, -1.80827, 2.3078, -0.65476, -1.31272, 2.5287, 0.794213, -1.3418, 0.110904, -0.165286, -1.3418, 0.110904, -0.165286, -1.70546, 1.08846, -0.512824, -1.66533, 1.54098, -0.490619, -1.62496, 1.56118, -0.547171, -0.058656, 1.53205, 0.656612, -0.067517, 1.613, 0.636935, 0.054341, 1.56785, 0.617614, -1.56405, 2.20221, 0.324313, -1.6538, 2.26291, 0.28081, -1.59592, 2.30384, 0.306192, -0.406635, 1.24475, -0.948797, -1.66272, 0.912535, -0.431627, -0.667462, 0.044839, 0.829193, -0.559179, 0.036105, 0.796676, -0.134549, 1.52088, 0.664674, -1.91799, 1.89081, -0.744522, -0.958258, 1.37917, 0.64127, -1.09051, 2.75592, 0.147124, -0.628084, 0.29047, -0.820962, -0.662705, 0.293584, -0.768473, -1.12901, 0.344685, -0.072872, -1.21464, 0.331216, 0.030781, -0.60889, 0.973738, 0.921607, -0.548929, 0.90942, 0.958017, -0.549729, 0.803894, 0.930067, -1.76162, 1.87909, 0.262437, -1.66971, 1.94942, 0.312696, 0.201813, 0.025813, 0.508553, 0.132192, 0.02495, 0.578847, -1.4656, 0.187322, 0.116944, -1.28647, 0.101222, -0.230909, -1.28647, 0.101222, -0.230909, -1.32143, 1.67868, 0.470269, -0.590432, 0.453978, -0.590295, -1.18855, 2.62665, 0.011796, -1.09051, 2.75592, 0.147124, -1.63574, 1.69588, -0.82957, 0.038999, 1.68481, 0.600525, -1.86394, 1.75241, -0.771419, -1.18855, 2.62665, 0.011796, -1.09104, 2.68634, 0.033622, -0.969728, 2.8458, 0.168423, -0.573153, 1.0016, 0.95467, 0.610131, 0.24661, 0.314127, -0.739692, 0.117974, -0.820667, -1.2822, 0.118733, -0.288954, -1.26421, 0.177599, -0.29914, -1.28647, 0.101222, -0.230909, -1.33494, 2.92277, 1.47643, -1.2958, 2.90162, 1.48205, 0.344885, 1.70564, 0.510089, 0.456978, 1.61178, 0.501333, 0.352167, 1.61912, 0.542142, -0.175863, 1.6996, 0.567819, -0.260006, 1.73816, 0.530924, -0.140757, 1.77823, 0.507184, -1.31243, 2.99841, 1.47799, -1.38051, 3.02385, 1.45734, -0.112829, 1.68188, 0.596715, -0.164666, 1.605, 0.650867, -0.191711, 1.65077, 0.616288, 0.151807, 1.98337, 0.293522, 0.19813, 1.85709, 0.456231, 0.135012, 1.78728, 0.526631, 0.093972, 1.8407, 0.47713, 1.11663, 0.772998, 0.118081, 0.154585, 1.29495, 0.808651, 0.510373, 1.46652, 0.569376, 0.604512, 1.36722, 0.552181, -1.47581, 2.85904, 1.26096, -1.25922, 0.207548, 0.323829, -1.06812, 0.213167, 0.394798, -1.31274, 0.150807, 0.339761, -1.55751, 3.05601, 1.31867, -1.52491, 3.01228, 1.31065, -0.535543, 0.573038, 0.833528, -0.463923, 0.434217, 0.818185, -1.63292, 3.03484, 1.2409, -1.46863, 2.66034, 1.224, -1.43921, 2.66912, 1.32483, -1.46495, 2.5661, 1.24023, -1.56902, 2.92978, 1.18471, -1.49759, 2.74381, 1.13861, -1.62378, 2.96345, 1.19138, -1.56902, 2.92978, 1.18471, -1.62378, 2.96345, 1.19138, -1.55751, 3.05601, 1.31867, -1.54697, 2.85679, 1.12664, -1.56902, 2.92978, 1.18471, -1.50167, 2.61585, 1.07173, -1.49549, 2.56319, 1.14741, -1.6542, 2.97669, 1.16486, -1.5622, 2.76526, 0.988744, -0.655234, 0.349926, 0.59238, -1.56902, 2.92978, 1.18471, -1.63523, 2.88962, 1.09141, -1.63523, 2.88962, 1.09141, -1.66451, 2.89312, 1.05468, -1.53419, 2.63854, 0.901802, -1.56902, 2.92978, 1.18471, -1.63481, 2.80188, 0.957953, -1.54697, 2.85679, 1.12664, -1.63481, 2.80188, 0.957953, -1.54791, 2.69871, 0.926615, -1.5622, 2.76526, 0.988744, 0.093929, 1.92137, 0.38238, -1.3224, 0.256817, -0.544751, -1.66451, 2.89312, 1.05468, -1.66539, 2.82829, 0.931203, 0.272212, 1.8077, 0.47814, 0.244579, 1.73652, 0.528799, -1.26814, 0.247683, 0.270898, -1.39162, 0.197004, 0.241896, -1.51138, 2.43363, 0.912956, -1.55919, 2.46024, 0.870253, -1.5171, 2.45556, 1.01034, -1.54452, 2.56035, 0.814144, -0.617308, 1.7212, 0.517412, -0.709575, 1.65286, 0.564409, -0.62236, 1.7712, 0.471763, 0.528914, 0.032969, -0.047848, 0.424889, 0.047392, -0.030714, 0.448812, 0.034589, 0.065149, 0.187043, 0.037073, 0.391721, 0.25184, 0.028507, 0.309307, 0.156058, 0.035326, 0.247326, -0.319188, 1.78894, 0.48839, -0.263121, 1.54403, 0.654529, -0.558568, 0.675659, 0.850365, -0.612173, 0.840662, 0.885912, -0.651993, 0.926889, 0.874589, -0.657191, 0.998277, 0.861246, -1.65377, 2.76181, 0.853753, 0.731211, 1.24791, 0.513414, 0.664115, 1.25235, 0.567061, -0.603628, 0.742986, 0.828161, -0.656307, 0.863076, 0.822479, -0.491852, 1.27146, 0.858089, -0.583151, 1.20175, 0.855542, -0.646836, 1.1038, 0.825993, -1.59196, 2.65864, 0.750248, -1.59196, 2.65864, 0.750248, -1.65377, 2.76181, 0.853753, 0.150165, 1.71951, 0.57005, 0.221133, 1.42897, 0.649268, 0.132003, 1.40862, 0.653203, 0.149492, 1.45073, 0.630768, -0.638228, 0.730611, 0.765969, -0.698968, 0.923774, 0.767085, -0.685919, 1.03046, 0.796382, -1.6551, 2.75478, 0.781396, -1.64618, 2.85723, 0.890331, -0.598261, 0.614941, 0.771946, -0.699978, 0.981609, 0.755257, -1.65377, 2.76181, 0.853753, -1.56226, 2.60019, 0.713606, -0.611499, 0.591474, 0.708366, -0.686256, 0.820268, 0.707292, -0.542594, 1.27956, 0.781396, -1.64582, 2.68869, 0.689045, -1.64582, 2.68869, 0.689045, -1.55313, 1.599, -0.641438, -0.014164, 1.43575, 0.665011, -0.57974, 0.442824, 0.713185, -0.653845, 0.675133, 0.662758, -0.930582, 0.066306, 0.694349, -0.9583, 0.036947, 0.633547, -0.930582, 0.066306, 0.694349, -0.853258, 0.124289, 0.759866, -0.890194, 0.069695, 0.75753, -0.863971, 0.179893, 0.690329, -0.863971, 0.179893, 0.690329, -0.802916, 0.199635, 0.749954, -0.853258, 0.124289, 0.759866, -0.623959, 0.528756, 0.632452, -1.71041, 1.59559, -0.435689, -0.962909, 2.74499, 0.356051, -1.02369, 2.77273, 0.290407, -1.60038, 2.60236, 0.634746, -0.6441, 0.106442, 0.817933, -0.144125, 0.072894, 0.713817, 0.067811, 0.120543, -0.361143, 0.110493, 0.137358, -0.516296, -0.055646, 0.120942, -0.344979, -1.59779, 2.46234, 0.538395, -1.57538, 2.46137, 0.768031, 0.283556, 1.92191, 0.327807, 0.198088, 1.90516, 0.390798, -0.946935, 0.127046, 0.627969, -0.863971, 0.179893, 0.690329, -0.8871, 0.218113, 0.636619, -0.610552, 0.384821, 0.650657, -0.719572, 0.305876, 0.653309, -0.71591, 0.823341, 0.622181, -0.72797, 0.247599, 0.754773, -1.55067, 2.41779, 0.609827, -1.59779, 2.46234, 0.538395, -1.59779, 2.46234, 0.538395, -1.59541, 2.49113, 0.602355, -1.57809, 2.54865, 0.583266, -1.57687, 2.52028, 0.592169, -0.339518, 3.1571, 0.731916, -0.387378, 3.06117, 0.693675, -0.450727, 3.0895, 0.641333, -0.977873, 0.080387, 0.558117, -0.312453, 0.043997, 0.732653, -1.62492, 2.5975, 0.583246, -0.490357, 3.16247, 0.561147, -0.926688, 0.188754, 0.562641, -0.8871, 0.218113, 0.636619, -0.946935, 0.127046, 0.627969, -0.637092, 0.40252, 0.555949, -0.655234, 0.349926, 0.59238, -0.648415, 0.505479, 0.559295, -1.19566, 0.018805, 0.418937, -1.10756, 0.367331, -0.427397, -1.63424, 2.60131, 0.533281, -0.977873, 0.080387, 0.558117, -0.637092, 0.40252, 0.555949, 0.61251, 1.4626, 0.515792, 0.67165, 1.40778, 0.491652, -0.586981, 1.50326, 0.664442, -1.55067, 2.41779, 0.609827, -1.57026, 2.40554, 0.482202, -0.951018, 0.199361, 0.482666, -0.926688, 0.188754, 0.562641, -0.658538, 0.467806, 0.486749, 0.545983, 1.74226, 0.356914, 0.56122, 1.6775, 0.405131, 0.430649, 1.72945, 0.459725, -0.987323, 0.034652, -0.652444, -1.3224, 0.256817, -0.544751, -1.63359, 0.863287, 0.296027, -1.56355, 0.880313, 0.380801, -1.51685, 0.811492, 0.341171, -1.76406, 1.64393, -0.41639, -1.58748, 2.50517, 0.486875, -1.51567, 0.096634, 0.100191, -1.00334, 0.065991, 0.463871, -0.988985, 0.124415, 0.47894, -0.951018, 0.199361, 0.482666, -0.660495, 0.395891, 0.476204, -0.660495, 0.395891, 0.476204, 0.091993, 1.49299, 0.636745, -0.219113, 1.29669, 0.894983, -0.317336, 1.28135, 0.90618, -1.09239, 0.276117, -0.224805, -1.05842, 0.339234, -0.177324, -1.09239, 0.276117, -0.224805, 0.596072, 1.58896, 0.449602, 0.532871, 1.6066, 0.469743, 1.13092, 0.821784, 0.040799, -1.61084, 2.53541, 0.45541, -0.660495, 0.395891, 0.476204, -0.691918, 0.393491, 0.413108, -1.54191, 0.989248, 0.473321, -1.62006, 1.05138, 0.424936, -1.55627, 1.08166, 0.50287, -0.712038, 0.046059, -0.804357, -0.362501, 1.30978, 0.859204, -1.49193, 2.33751, 0.497692, -1.57026, 2.40554, 0.482202, -0.689223, 3.04368, 0.428639, -0.990859, 0.162467, 0.433754, -0.909768, 0.279548, 0.431691, 0.245589, 1.98299, 0.250967, 0.083617, 0.110019, 0.263826, 0.048954, 0.049827, 0.135002, -0.017068, 0.093519, 0.083502, -1.60964, 2.4265, 0.372046, -0.256175, 3.12054, 0.79556, -1.63679, 1.15469, 0.43007, -1.68463, 1.24382, 0.38219, -1.60051, 1.22187, 0.471069, -1.65744, 1.31033, 0.407046, -1.37874, 2.64325, 1.35411, -0.593757, 1.64556, 0.562809, -1.52834, 2.32983, 0.41517, -1.57026, 2.40554, 0.482202, -1.49193, 2.33751, 0.497692, -1.61894, 2.53678, 0.375014, -1.62006, 1.05138, 0.424936, -1.67789, 1.07853, 0.368321, -1.63679, 1.15469, 0.43007, -1.65744, 1.31033, 0.407046, -1.71348, 1.34948, 0.328628, -1.59663, 2.47783, 0.373792, -0.274338, 1.62156, 0.608248, -1.69902, 1.16225, 0.348095, -1.68463, 1.24382, 0.38219, -0.550591, 1.89668, 0.278095, -0.690781, 1.89468, 0.308297, -1.59663, 2.47783, 0.373792, -1.61894, 2.53678, 0.375014, -1.61084, 2.53541, 0.45541, -0.45037, 0.038189, 0.772368, -0.525189, 0.093877, 0.797497, 0.341455, 1.12597, 0.793266, 0.275643, 1.22375, 0.799959, 0.352462, 1.20245, 0.754857, -0.353662, 0.142557, 0.764075, -1.74564, 1.26931, 0.314127, -1.65744, 1.31033, 0.407046, 0.332531, 1.8307, 0.424199, -1.52834, 2.32983, 0.41517, -1.57087, 2.33623, 0.334415, -1.60964, 2.4265, 0.372046, 0.4015, 1.23941, 0.707776, 0.477203, 1.12862, 0.708513, -1.65744, 1.31033, 0.407046, 1.11663, 0.772998, 0.118081, 1.11347, 0.678732, 0.19469, 1.02718, 0.746669, 0.148261, -0.499996, 0.117975, 0.417401, -0.170433, 1.18048, 0.953218, -1.6234, 2.49465, 0.301415, -0.017342, 1.30875, 0.858594, -0.460534, 1.63937, 0.598441, -0.573595, 1.56781, 0.631799, -1.66867, 0.990617, 0.331532, -1.75259, 1.18902, 0.302846, -0.410908, 0.11627, 0.279548, -0.370162, 1.72437, 0.546036, -0.496692, 1.72911, 0.511772, -0.385589, 1.82483, 0.41778, -0.420673, 1.46908, 0.67627, 0.1569, 1.66239, 0.595473, -1.17173, 0.505185, 0.254461, -1.17173, 0.505185, 0.254461, -1.13789, 0.567797, 0.343865, -1.57639, 0.787941, 0.232025, -1.74213, 1.06179, 0.275886, -0.357155, 1.64619, 0.596147, -1.62873, 2.39051, 0.275569, -1.19749, 0.350936, 0.216178, -1.69582, 0.918196, 0.246821, -1.73325, 1.00802, 0.23453, -1.7882, 1.19925, 0.247221, -1.7714, 1.3633, 0.252882, -1.70389, 1.60555, 0.226427, -1.60059, 1.64282, 0.315936, -1.23154, 0.310443, 0.179473, -1.19749, 0.350936, 0.216178, -1.26814, 0.247683, 0.270898, -0.148923, 1.88197, 0.423104, -1.40966, 0.729432, 0.327239, -1.51594, 0.716952, 0.199151, -1.51594, 0.716952, 0.199151, -1.74914, 1.46637, 0.25324, -1.70908, 1.66414, 0.202518, -0.420673, 1.46908, 0.67627, -1.64635, 2.45493, 0.236592, -1.07591, 2.75202, 0.240002, -1.33101, 0.26452, 0.173748, -1.26814, 0.247683, 0.270898, -1.39162, 0.197004, 0.241896, -1.19749, 0.350936, 0.216178, -1.14536, 0.312653, 0.308508, -1.17173, 0.505185, 0.254461, -1.20999, 0.558768, 0.206644, -1.18171, 0.60909, 0.305035, -1.41023, 0.637965, 0.220745, -1.51594, 0.716952, 0.199151, -1.66394, 0.857499, 0.201718, -1.78982, 1.06994, 0.185576, -1.80184, 1.33215, 0.19793, -0.420673, 1.46908, 0.67627, -1.69986, 2.31579, 0.216156, -1.25269, 0.590548, 0.233919, -0.719572, 0.305876, 0.653309, -1.81956, 1.13565, 0.164635, -1.80531, 1.23585, 0.184924, -0.254302, 1.87757, 0.388336, -0.694569, 0.06327, -0.178582, -0.635958, 0.085477, -0.322858, -1.02369, 2.77273, 0.290407, -1.1377, 2.60417, 0.236276, -1.45729, 0.178756, 0.179873, -1.39162, 0.197004, 0.241896, -1.48134, 0.094066, 0.20355, -1.45729, 0.178756, 0.179873, -1.41673, 0.232635, 0.150808, -1.23154, 0.310443, 0.179473, -1.17173, 0.505185, 0.254461, -1.83608, 1.82453, 0.187681, -1.85344, 1.93597, 0.171854, -1.80224, 1.92848, 0.241475, -1.8193, 1.99295, 0.215209, 0.544151, 1.19184, 0.661727, 0.605943, 1.2244, 0.612647, -1.68509, 2.47116, 0.171201, -1.19955, 2.61893, 0.171264, -1.07591, 2.75202, 0.240002, -1.1377, 2.60417, 0.236276, -1.49864, 0.118438, 0.167687, -1.20109, 0.451305, 0.134686, -1.17173, 0.505185, 0.254461, -1.72714, 0.905253, 0.146851, 0.651908, 1.57682, 0.416664, -1.16752, 2.68385, 0.154975, -1.07591, 2.75202, 0.240002, -1.19955, 2.61893, 0.171264, -1.16752, 2.68385, 0.154975, -1.02243, 2.81834, 0.237097, -1.45729, 0.178756, 0.179873, -1.41673, 0.232635, 0.150808, -1.45729, 0.178756, 0.179873, -1.20427, 0.505521, 0.080429, -1.17173, 0.505185, 0.254461, -1.17173, 0.505185, 0.254461, -1.68073, 0.837105, 0.119912, -1.19749, 0.350936, 0.216178, -1.23154, 0.310443, 0.179473, -1.19749, 0.350936, 0.216178, 0.554528, 1.0856, 0.671198, -1.41673, 0.232635, 0.150808, -0.691918, 0.393491, 0.413108, -0.791635, 0.348411, 0.428619, -0.736578, 0.407256, 0.4017, -1.85481, 1.35874, 0.064413, -1.85481, 1.35874, 0.064413, -1.89837, 1.75935, 0.064497, -1.89837, 1.75935, 0.064497, 0.158794, 1.23545, 0.849902, 0.246831, 1.15819, 0.833422, 0.642543, 1.66753, 0.356219, -0.189795, 1.94256, 0.347906, -1.34957, 3.08445, 1.41998, -0.412844, 1.85442, 0.384906, 0.539205, 1.80633, 0.289861, 0.459124, 1.78313, 0.394713, 0.539205, 1.80633, 0.289861, 0.897308, 0.585434, 0.256713, 0.539205, 1.80633, 0.289861, 0.387273, 1.86206, 0.34557, 0.288313, 1.28242, 0.740146, 0.960131, 0.877703, 0.129067, 0.934644, 0.77405, 0.163983, 0.34438, 0.02977, 0.135634, 0.322492, 0.068579, 0.049128, 0.283489, 0.045992, 0.07278, 0.080292, 0.127193, 0.354052, -0.029254, 0.119343, 0.133487, 0.376833, 1.54262, 0.557064, 0.400237, 1.49499, 0.590822, 0.365637, 1.46229, 0.636177, -0.441972, 1.89744, 0.312716, -0.017342, 1.30875, 0.858594, -0.690781, 1.89468, 0.308297, -0.755246, 1.83985, 0.407867, -0.760297, 1.89178, 0.358471, 0.934644, 0.77405, 0.163983, 0.963267, 0.666083, 0.209548, 0.772061, 1.43145, 0.391219, -0.650183, 0.303666, 0.709124, -1.11543, 0.340707, -0.530965, -0.787552, 0.261974, 0.693823, -0.863971, 0.179893, 0.690329, -0.8871, 0.218113, 0.636619, -0.104411, 0.13437, -0.588506, -0.046302, 1.66641, 0.597683, 0.968066, 0.775208, 0.120501, 0.963267, 0.666083, 0.209548, 0.963267, 0.666083, 0.209548, 0.970949, 0.553485, 0.284472, 0.897308, 0.585434, 0.256713, -0.341792, 1.93923, 0.260754, 0.960131, 0.877703, 0.129067, 1.02718, 0.746669, 0.148261, 0.968066, 0.775208, 0.120501, -1.16752, 2.68385, 0.154975, -1.30474, 2.46872, 0.21824, -1.28622, 2.52706, 0.162888, -1.30474, 2.46872, 0.21824, -1.32838, 2.55236, 0.121364, -1.30479, 2.41263, 0.274981, -1.36296, 2.5284, 0.226806, -0.897184, 0.08494, -0.079466, -0.864739, 0.056377, -0.231104, -1.25156, 2.40893, 0.223691, -0.017342, 1.30875, 0.858594, -1.23537, 2.49172, 0.197783, -1.25156, 2.40893, 0.223691, -1.26812, 2.32373, 0.263721, -1.30479, 2.41263, 0.274981, -0.535122, 0.177641, 0.798591, -0.72797, 0.247599, 0.754773, -1.1377, 2.60417, 0.236276, -1.23537, 2.49172, 0.197783, -1.29498, 2.26028, 0.315958, -1.26812, 2.32373, 0.263721, -0.584287, 1.84585, 0.373666, -0.255292, 1.95193, 0.293396, 0.806114, 1.08533, 0.488663, -0.017342, 1.30875, 0.858594, 0.835411, 0.266814, 0.279211, -1.19947, 2.31798, 0.231078, 0.960131, 0.877703, 0.129067, 1.02102, 0.816964, 0.057636, -1.18236, 2.20488, 0.26953, -1.18236, 2.20488, 0.26953, -1.19745, 2.12581, 0.302362, -1.05433, 1.61906, 0.573396, -1.00725, 1.65522, 0.551866, -0.9595, 1.5902, 0.579541, -0.006482, 0.052226, 0.010071, 1.08906, 0.840094, -0.00685, 1.05234, 0.602587, 0.25686, -1.26545, 1.84015, 0.381327, -1.13635, 2.3573, 0.207275, -1.11964, 2.18352, 0.218829, -1.14467, 2.12712, 0.267951, -0.707639, 1.79785, 0.434953, 0.263458, 1.51057, 0.603092, 0.772061, 1.43145, 0.391219, -1.12787, 1.92349, 0.338562, -1.10101, 1.86503, 0.411192, -1.16971, 1.74045, 0.492178, -1.27244, 1.78, 0.422915, 0.806114, 1.08533, 0.488663, -0.802916, 0.199635, 0.749954, -0.279495, 0.099307, 0.739388, -0.144125, 0.072894, 0.713817, 0.052531, 1.19704, 0.891679, -0.017342, 1.30875, 0.858594, -1.35658, 2.53499, 0.291649, -1.36296, 2.5284, 0.226806, -1.30479, 2.41263, 0.274981, -0.690781, 1.89468, 0.308297, -1.09702, 2.02712, 0.270624, -1.069, 1.98223, 0.285335, -1.19004, 2.01052, 0.314442, -0.802916, 0.199635, 0.749954, 1.02102, 0.816964, 0.057636, 1.02718, 0.746669, 0.148261, -1.06366, 2.11274, 0.206812, -1.03089, 2.03782, 0.211778, -1.05036, 1.78688, 0.487043, -0.691918, 0.393491, 0.413108, 0.722435, 1.66166, 0.231099, -1.0117, 1.93519, 0.360891, -1.03093, 1.7221, 0.51998, -0.017342, 1.30875, 0.858594, 1.13092, 0.821784, 0.040799, -1.00483, 1.84499, 0.453601, -0.995279, 2.05354, 0.148345, -0.995279, 2.05354, 0.148345, -1.03089, 2.03782, 0.211778, -1.06366, 2.11274, 0.206812, -0.948829, 1.8774, 0.427419, -0.995279, 2.05354, 0.148345, -1.03089, 2.03782, 0.211778, -0.977789, 1.98379, 0.286725, -1.069, 1.98223, 0.285335, -0.940705, 1.78755, 0.493862, 0.806114, 1.08533, 0.488663, -0.954112, 2.01906, 0.150639, -0.977789, 1.98379, 0.286725, -0.995279, 2.05354, 0.148345, -0.887058, 1.91764, 0.385137, -0.893604, 1.70358, 0.524631, -0.954112, 2.01906, 0.150639, -0.878388, 1.97615, 0.271781, -0.878388, 1.97615, 0.271781, -0.877251, 1.95247, 0.331658, -0.977789, 1.98379, 0.286725, -1.59581, 1.57781, -0.597493, -1.55313, 1.599, -0.641438, -1.1687, 2.44294, 0.225185, 0.539205, 1.80633, 0.289861, 0.080102, 1.60925, 0.609153, -0.954112, 2.01906, 0.150639, -0.88649, 2.00509, 0.161309, -0.847155, 1.79513, 0.471721, 0.238812, 0.068032, -0.755824, -0.838547, 1.86429, 0.42744, -0.017342, 1.30875, 0.858594, 0.539205, 1.80633, 0.289861, 1.04726, 0.784068, -0.315536, 1.14406, 0.809997, -0.266056, -0.804515, 1.92941, 0.338119, 1.05244, 0.528588, 0.28119, -0.690781, 1.89468, 0.308297, 0.209284, 1.60407, 0.593768, -0.690781, 1.89468, 0.308297, -0.783301, 1.74603, 0.503269, -0.787194, 1.65271, 0.567881, 1.02718, 0.746669, 0.148261, 0.498923, 0.994637, 0.719563, -1.14536, 0.312653, 0.308508, 1.02718, 0.746669, 0.148261, 0.722435, 1.66166, 0.231099, -0.742976, 1.94673, 0.250315, -0.690781, 1.89468, 0.308297, -0.690781, 1.89468, 0.308297, -0.690781, 1.89468, 0.308297, -1.65744, 1.31033, 0.407046, -1.54699, 1.28177, 0.494409, -1.60059, 1.64282, 0.315936, -1.57182, 1.57596, 0.374361, -1.62111, 1.70446, 0.281105, -1.49254, 1.56937, 0.425903, -1.553, 1.83493, 0.349884, -1.59943, 1.77127, 0.321956, -1.58422, 1.97457, 0.35281, -1.61825, 2.05072, 0.330354, 1.00128, 0.420136, 0.291902, -1.10125, 1.5399, 0.589517, -1.16049, 1.63183, 0.555885, 0.935991, 0.427503, 0.317221, 0.933002, 0.480645, 0.31097, 0.919154, 0.361607, 0.309875, -1.00932, 0.832643, 0.522927, 0.470174, 0.536922, 0.731433, -1.55627, 1.08166, 0.50287, -1.42936, 0.992448, 0.544415, -0.94401, 2.61983, 0.366469, -0.813881, 2.68806, 0.444024, -1.46495, 2.5661, 1.24023, -0.573153, 1.0016, 0.95467, -1.24261, 1.39014, 0.588507, -1.46499, 0.828013, 0.414055, -1.35523, 0.844703, 0.506679, -1.35708, 0.783059, 0.442004, -1.1377, 2.60417, 0.236276, -1.05951, 2.57778, 0.293227, -1.1687, 2.44294, 0.225185, -1.56355, 0.880313, 0.380801, -1.47699, 0.898308, 0.475194, -1.51685, 0.811492, 0.341171, 0.776418, 0.302487, 0.312443, 0.933002, 0.480645, 0.31097, -1.40966, 0.729432, 0.327239, -1.21746, 1.50175, 0.573838, -1.15361, 1.37056, 0.634851, -1.22557, 1.3198, 0.617825, -1.76162, 1.87909, 0.262437, 0.813734, 0.393892, 0.324755, 0.809503, 0.46206, 0.314043, -1.22047, 0.863686, 0.552707, -1.56405, 2.20221, 0.324313, -1.34099, 0.016764, 0.352453, -1.29009, 0.019352, 0.380128, -1.35258, 0.012238, 0.291797, 0.809503, 0.46206, 0.314043, -1.48576, 2.04081, 0.368363, -1.5026, 1.9301, 0.364806, -1.5184, 2.14427, 0.347232, -1.31712, 1.12416, 0.587371, -1.41833, 1.80822, 0.367669, -1.49159, 1.74969, 0.351379, -1.50952, 2.3823, 0.63786, -1.53265, 2.35982, 0.513414, -1.16312, 1.45612, 0.602692, -1.14862, 1.23294, 0.649036, -1.19745, 2.12581, 0.302362, -1.22628, 1.21954, 0.624833, -0.930898, 0.940421, 0.584382, -1.13637, 0.666273, 0.380191, 0.707723, 0.331216, 0.31842, -0.420673, 1.46908, 0.67627, -1.34351, 1.02545, 0.581898, -1.03011, 0.970349, 0.595937, -0.970739, 1.51707, 0.6145, -1.06595, 1.03818, 0.633609, -1.54699, 1.28177, 0.494409, -1.54699, 1.28177, 0.494409, -0.960615, 2.56109, 0.337509, -0.933234, 2.48678, 0.303603, -1.55627, 1.08166, 0.50287, -1.48193, 2.27955, 0.361965, -1.57087, 2.33623, 0.334415, -1.52834, 2.32983, 0.41517, -0.94422, 1.03164, 0.614836, -1.66867, 0.990617, 0.331532, -1.34385, 0.685929, 0.329975, -1.41023, 0.637965, 0.220745, -1.03028, 0.490389, 0.399049, -1.30752, 0.628536, 0.279064, -0.981809, 0.565313, 0.439352, -1.01971, 0.669555, 0.458168, -0.947251, 0.62599, 0.465744, -1.55627, 1.08166, 0.50287, -1.27025, 0.984661, 0.591727, -0.948745, 1.1424, 0.644132, -1.05951, 2.57778, 0.293227, -0.94401, 2.61983, 0.366469, -0.960615, 2.56109, 0.337509, -1.553, 1.83493, 0.349884, -1.32375, 2.39859, 0.45962, -0.933486, 0.850091, 0.560116, 0.281178, 0.134622, 0.657392, -0.072315, 1.13729, 0.951303, -1.38085, 0.902454, 0.536459, 0.480528, 0.71771, 0.73741, 0.465207, 0.835779, 0.75008, -1.07149, 1.42619, 0.638934, -0.970739, 1.51707, 0.6145, 0.426903, 0.386589, 0.707882, -0.017342, 1.30875, 0.858594, -0.963141, 0.767442, 0.51918, 0.406299, 0.968918, 0.767843, -1.1687, 2.44294, 0.225185, 0.420336, 0.45099, 0.754457, 0.410823, 0.61212, 0.75833, 0.412907, 0.716131, 0.780723, 0.37374, 0.782027, 0.8028, 0.330847, 0.858172, 0.810019, 0.329964, 0.3828, 0.739515, 0.31801, 0.564871, 0.786826, -1.51138, 2.43363, 0.912956, -1.00334, 0.065991, 0.463871, -1.40242, 0.156784, 0.289545, -1.39162, 0.197004, 0.241896, 0.354462, 0.475109, 0.779229, -0.444076, 1.12822, 0.980515, -1.14536, 0.312653, 0.308508, 0.305571, 0.665368, 0.812292, 0.32689, 0.917754, 0.807052, -1.8695, 1.69655, -0.318524, 0.293891, 0.265152, 0.703925, 0.257901, 1.06232, 0.83157, 0.970949, 0.553485, 0.284472, -0.029654, 0.067611, -0.088509, -0.077766, 0.109283, -0.090656, 0.281515, 0.329364, 0.742735, 0.225427, 0.456841, 0.810441, 0.24359, 0.881408, 0.844451, 0.241422, 0.728212, 0.834285, 0.258343, 0.777734, 0.848008, 0.225111, 0.98725, 0.857626, -0.813881, 2.68806, 0.444024, -1.40242, 0.156784, 0.289545, 0.22389, 0.235308, 0.708534, 0.171927, 0.254081, 0.713859, 0.213619, 0.342581, 0.76799, 0.21703, 0.517854, 0.815218, 0.16052, 0.612815, 0.839231, 0.205012, 0.635608, 0.839337, -0.970739, 1.51707, 0.6145, 0.109062, 0.180061, 0.690434, 0.132339, 0.682647, 0.869264, -1.02369, 2.77273, 0.290407, -0.962909, 2.74499, 0.356051, -1.1377, 2.60417, 0.236276, 0.092435, 0.119827, 0.692623, 0.114218, 0.742249, 0.8728, 0.136758, 0.795791, 0.889511, 0.184155, 0.869643, 0.886838, 0.154332, 1.1005, 0.874863, -0.890194, 0.069695, 0.75753, 0.139979, 1.16099, 0.877326, 0.125099, 0.378738, 0.796781, 0.113586, 0.534607, 0.834349, 0.159994, 0.977715, 0.89351, 0.14383, 0.463639, 0.82713, 0.101464, 0.858341, 0.911126, 0.104179, 0.948061, 0.908137, 0.092267, 0.269929, 0.747743, -1.1377, 2.60417, 0.236276, 0.078524, 0.318799, 0.794824, 0.069663, 0.578278, 0.867539, 0.039041, 1.08836, 0.917166, 0.015953, 0.788257, 0.909252, -1.05951, 2.57778, 0.293227, 0.078524, 0.318799, 0.794824, 0.027086, 0.366258, 0.822836, 0.01248, 0.418558, 0.826141, 0.045081, 0.474015, 0.843399, -0.004799, 0.219186, 0.712701, -0.004398, 0.967298, 0.937012, -0.020268, 0.260921, 0.758666, 0.078524, 0.318799, 0.794824, -0.024898, 0.557968, 0.88606, -0.018226, 0.66461, 0.909842, -0.096644, 0.114145, 0.718784, -0.035842, 0.312295, 0.813829, 0.078524, 0.318799, 0.794824, 0.078524, 0.318799, 0.794824, -0.047417, 0.861645, 0.939223, -0.008987, 1.05161, 0.949619, -0.092772, 0.707965, 0.917818, -1.09702, 2.02712, 0.270624, -0.167255, 0.179093, 0.729265, -0.076777, 0.397532, 0.846008, -0.092814, 1.04839, 0.972475, -0.110135, 0.47793, 0.875095, -0.11245, 0.953049, 0.972686, -0.124699, 0.768916, 0.94019, -1.76162, 1.87909, 0.262437, -0.170664, 0.220112, 0.734084, -0.185102, 0.296258, 0.81284, -0.129119, 0.574069, 0.914156, -0.155385, 0.880124, 0.967361, -1.76162, 1.87909, 0.262437, -0.422736, 0.106989, 0.546373, -0.173653, 0.256081, 0.782512, -0.172159, 0.354956, 0.837864, -0.17944, 0.652887, 0.938444, -0.970739, 1.51707, 0.6145, -0.198361, 0.471826, 0.892226, -0.223175, 0.434027, 0.886943, -0.193668, 0.558347, 0.908705, -0.180977, 0.975674, 0.981694, -1.05393, 2.46232, 0.260585, -1.44106, 0.094634, 0.28824, -0.221807, 0.737009, 0.952482, -0.210505, 0.835338, 0.976558, -1.4479, 0.044986, 0.293523, -0.310054, 0.939937, 0.994027, -0.235802, 1.04668, 0.994006, -0.289471, 0.397448, 0.86253, -0.259248, 0.555948, 0.926216, -1.00753, 0.024319, 0.508426, -1.28309, 2.88419, 1.46437, -1.32055, 2.75695, 1.43404, -1.3413, 2.79472, 1.4489, -0.278568, 0.764243, 0.981946, -0.315315, 0.060981, 0.562599, -0.890194, 0.069695, 0.75753, -0.229552, 3.0204, 0.799453, -0.241022, 2.93018, 0.748922, -0.308454, 2.97983, 0.730569, -0.288145, 3.07626, 0.775882, -0.365405, 0.215861, 0.76618, -0.331437, 0.253892, 0.770663, -0.304477, 0.634661, 0.959827, -0.337141, 0.86939, 1.00188, -0.337141, 0.86939, 1.00188, -0.333752, 1.0141, 1.00865, -1.41023, 0.637965, 0.220745, -1.41174, 0.018089, 0.313769, -0.608071, 0.093518, -0.444108, -0.288145, 3.07626, 0.775882, -1.55627, 1.08166, 0.50287, -0.361659, 0.320524, 0.809893, -0.35383, 0.595494, 0.940106, -1.54699, 1.28177, 0.494409, -1.52531, 0.068937, 0.15125, 0.818343, 0.169475, -0.341738, -0.378328, 0.792045, 0.993038, -0.337141, 0.86939, 1.00188, -0.970739, 1.51707, 0.6145, 0.198445, 0.043768, 0.036081, 0.083512, 0.025666, 0.07923, 0.200971, 0.026339, 0.147819, -0.288145, 3.07626, 0.775882, -0.308454, 2.97983, 0.730569, -0.406235, 0.531303, 0.897824, -0.37334, 0.700431, 0.976474, -0.389398, 1.05996, 1.00497, -0.445402, 2.98726, 0.646468, -1.76162, 1.87909, 0.262437, -1.32154, 0.034021, -0.310779, -1.35328, 0.044313, -0.326901, -1.28647, 0.101222, -0.230909, -0.425661, 0.928446, 1.00566, -0.337141, 0.86939, 1.00188, -1.41155, 1.22413, 0.550687, -0.446202, 0.28784, 0.772199, -0.461145, 0.719035, 0.952881, -0.337141, 0.86939, 1.00188, -1.45659, 0.052079, -0.069504, -1.46661, 0.031537, -0.022277, -0.408487, 2.8924, 0.625801, -0.445402, 2.98726, 0.646468, -0.408487, 2.8924, 0.625801, -1.17173, 0.505185, 0.254461, -1.44106, 0.094634, 0.28824, -0.484822, 0.837589, 0.98523, -0.488274, 0.917355, 0.991838, -0.487874, 1.02509, 0.990617, -1.41155, 1.22413, 0.550687, -1.35328, 0.044313, -0.326901, -1.2822, 0.118733, -0.288954, -1.28647, 0.101222, -0.230909, -1.35328, 0.044313, -0.326901, -0.420673, 1.46908, 0.67627, -0.446202, 0.28784, 0.772199, -0.580814, 2.8795, 0.566345, -0.445402, 2.98726, 0.646468, -0.408487, 2.8924, 0.625801, -1.69357, 1.6963, -0.797727, -1.25672, 0.635271, -0.421966, -0.548234, 0.309622, 0.734295, -0.691918, 0.393491, 0.413108, -0.990859, 0.162467, 0.433754, -0.652014, 2.80685, 0.525747, -0.580814, 2.8795, 0.566345, -0.493662, 2.84686, 0.580088, -1.65744, 1.31033, 0.407046, -1.54699, 1.28177, 0.494409, -0.573153, 1.0016, 0.95467, -1.1687, 2.44294, 0.225185, -0.573153, 1.0016, 0.95467, -0.573153, 1.0016, 0.95467, -1.55627, 1.08166, 0.50287, 0.320861, 0.049516, -0.20861, 0.323624, 0.042982, -0.457562, 0.277748, 0.039051, -0.48178, 0.325144, 0.039388, -0.594462, 0.179504, 0.040146, -0.579309, 0.277748, 0.039051, -0.48178, 0.0905, 0.044113, -0.662751, 0.25727, 0.046228, -0.713078, 0.069263, 0.060034, -0.78472, 0.103484, 0.021393, -0.038358, 0.066275, 0.024087, -0.063611, -0.379486, 0.039556, -0.85291, -0.603144, 0.044249, -0.879934, 0.944473, 0.173642, -0.152974, -0.029675, 0.084596, -0.173473, 0.03582, 0.070094, -0.261825, -0.023088, 0.108757, -0.245977, 0.060803, 0.034842, -0.212787, 0.019299, 0.038357, -0.145124, 0.86839, 0.160046, -0.252818, -0.029675, 0.084596, -0.173473, -0.554001, 0.035305, -0.731031, -0.200066, 0.11305, -0.143777, -0.049396, 0.061508, 0.519202, 0.101555, 0.037527, -0.730285, -0.05147, 0.040134, -0.689064, 0.212294, 0.085585, -0.464774, -0.171127, 0.042671, -0.815805, -0.059477, 0.040082, -0.776007, 0.393041, 0.059799, -0.227419, 0.468343, 0.075819, -0.110292, 0.503658, 0.03863, -0.189405, 0.42263, 0.046123, -0.405761, 0.272534, 0.022363, -0.255287, -1.35142, 0.042334, -0.64533, -1.51138, 2.43363, 0.912956, -0.554001, 0.035305, -0.731031, -1.51138, 2.43363, 0.912956, -1.51138, 2.43363, 0.912956, 0.135853, 0.109114, 0.39787, 0.628421, 0.042082, -0.023056, -0.065475, 0.125551, 0.242422, -0.198487, 0.12431, 0.341466, 0.176431, 0.037199, -0.322376, -0.373108, 0.069632, -0.915144, 0.176431, 0.037199, -0.322376, -0.182268, 0.039425, -0.72215, -0.029675, 0.084596, -0.173473, -0.023088, 0.108757, -0.245977, -0.077766, 0.109283, -0.090656, -1.68244, 1.60344, -0.534164, -1.79377, 1.66321, -0.45623, -1.20877, 0.519896, 0.000285, -1.11964, 2.18352, 0.218829, 0.34598, 0.055867, -0.684876, -0.023088, 0.108757, -0.245977, -0.055646, 0.120942, -0.344979, -0.077766, 0.109283, -0.090656, 0.150051, 0.022949, -0.008469, -1.87268, 1.71585, -0.414748, 0.681247, 0.059677, 0.036085, 0.594536, 0.043471, -0.153163, 0.189458, 0.082301, -0.415505, 0.496461, 0.061234, -0.349336, -1.89044, 1.70247, -0.50733, -1.89951, 1.69807, -0.609931, 0.156058, 0.035326, 0.247326, 0.158289, 0.078976, 0.326229, -1.51594, 0.716952, 0.199151, -1.80251, 1.64869, -0.536585, 0.187043, 0.037073, 0.391721, 0.158289, 0.078976, 0.326229, 0.334005, 0.030212, 0.246379, 0.295805, 0.031622, 0.489022, -1.8473, 1.65915, -0.597809, -0.023972, 0.130413, 0.402416, -0.200066, 0.11305, -0.143777, -1.8386, 1.67323, -0.70104, -0.052026, 0.11425, 0.481929, -1.36403, 0.032611, -0.142451, -1.35035, 0.061466, -0.188332, -1.89004, 1.72581, -0.716257, -1.80251, 1.64869, -0.536585, -1.78361, 1.63745, -0.647141, -1.8473, 1.65915, -0.597809, -1.78361, 1.63745, -0.647141, -0.237612, 0.137821, -0.633587, -0.055646, 0.120942, -0.344979, -0.376097, 0.109935, -0.242105, -0.200066, 0.11305, -0.143777, -1.05802, 2.32318, 0.152049, 0.704545, 0.072957, -0.158425, -0.686045, 2.98871, 0.238549, -0.042955, 0.022593, 0.590781, -1.70254, 1.61407, -0.61393, -1.70254, 1.61407, -0.61393, -1.74183, 1.65513, -0.746753, -1.77506, 1.70263, -0.794991, 0.189458, 0.082301, -0.415505, 0.145345, 0.126772, -0.437962, -1.50066, 1.68944, -0.856698, -1.52068, 1.73452, -0.903527, 0.094329, 0.087079, -0.337065, -0.023088, 0.108757, -0.245977, 0.03582, 0.070094, -0.261825, -1.65108, 1.61862, -0.710911, 0.62861, 0.06879, -0.234297, -1.74183, 1.65513, -0.746753, -1.77506, 1.70263, -0.794991, -0.490799, 0.130245, -0.625779, -0.029254, 0.119343, 0.133487, -1.59849, 0.740608, -0.197382, -0.542952, 0.1028, -0.236591, -1.59581, 1.57781, -0.597493, -1.51594, 0.716952, 0.199151, -1.46354, 0.633377, 0.108673, -0.055646, 0.120942, -0.344979, -0.376097, 0.109935, -0.242105, -1.68244, 1.60344, -0.534164, -1.62141, 0.82052, -0.371792, -1.55313, 1.599, -0.641438, -1.65108, 1.61862, -0.710911, -1.59581, 1.57781, -0.597493, -0.346653, 0.038567, -0.735472, 0.019299, 0.038357, -0.145124, 0.060803, 0.034842, -0.212787, 0.03582, 0.070094, -0.261825, -1.49666, 0.626558, -0.001273, -1.53219, 0.660885, -0.070494, -1.53196, 0.661263, -0.136095, -1.58194, 1.65345, -0.799074, -1.65108, 1.61862, -0.710911, -0.554001, 0.035305, -0.731031, -1.58194, 1.65345, -0.799074, 0.140189, 0.046817, -0.327826, 0.189458, 0.082301, -0.415505, -1.53461, 0.675091, -0.21163, -1.41023, 0.637965, 0.220745, -1.50948, 0.716468, -0.341381, -1.5597, 0.770409, -0.389871, -1.51609, 1.64368, -0.770746, -1.35706, 0.582361, 0.094825, -1.4426, 0.5916, -0.038272, -1.4801, 0.639543, -0.232971, -1.56506, 0.830412, -0.477549, -1.24177, 0.552538, 0.12892, -1.20999, 0.558768, 0.206644, -1.41174, 0.018089, 0.313769, -1.45358, 0.0155, 0.188102, -1.4419, 0.59421, -0.13921, -1.51609, 1.64368, -0.770746, -1.50066, 1.68944, -0.856698, -1.50066, 1.68944, -0.856698, -0.183018, 2.94512, 0.746059, 0.176431, 0.037199, -0.322376, 0.060803, 0.034842, -0.212787, 0.150279, 0.031533, -0.210024, -1.35258, 0.012238, 0.291797, -1.28892, 0.547761, 0.013628, -1.35877, 0.5578, -0.090972, -1.40238, 0.589727, -0.197024, -1.466, 0.752352, -0.471194, 0.140189, 0.046817, -0.327826, 0.03582, 0.070094, -0.261825, 0.094329, 0.087079, -0.337065, 0.03582, 0.070094, -0.261825, -1.36435, 0.01106, 0.124542, -1.40671, 0.61433, -0.270181, -1.49134, 0.810902, -0.529429, -1.50073, 0.861182, -0.5731, -1.41707, 0.018215, 0.000264, -1.41079, 0.676964, -0.390482, 0.204421, 0.039199, -0.197739, -1.35035, 0.061466, -0.188332, -1.32154, 0.034021, -0.310779, -1.19566, 0.018805, 0.418937, -1.17786, 0.011565, 0.375982, -1.2334, 0.010134, 0.188502, -1.2334, 0.010134, 0.188502, -1.28696, 0.544119, -0.16415, -1.39076, 0.783395, -0.564324, -1.30018, 0.021836, -0.171768, -1.23291, 0.522379, -0.098717, -1.30963, 0.574237, -0.246441, 0.189458, 0.082301, -0.415505, 0.189458, 0.082301, -0.415505, -1.33362, 0.627379, -0.35586, -1.33991, 0.695947, -0.485926, 0.103484, 0.021393, -0.038358, -1.10977, 0.010891, 0.222071, -1.21397, 0.013501, -0.111555, -1.25672, 0.635271, -0.421966, -1.25672, 0.635271, -0.421966, -1.22544, 0.707712, -0.553738, -1.27475, 0.80341, -0.629588, -1.00016, 0.013522, 0.453433, -0.023088, 0.108757, -0.245977, -0.931634, 0.014364, 0.645143, -1.25672, 0.635271, -0.421966, -0.830949, 0.013417, 0.68088, -0.948303, 0.013038, 0.447602, -1.08315, 0.03167, -0.074075, -1.08315, 0.03167, -0.074075, -1.30527, 0.028676, -0.487084, -1.51138, 2.43363, 0.912956, -0.976126, 0.013143, 0.20275, -1.17314, 0.024151, -0.377454, -1.25672, 0.635271, -0.421966, -1.25672, 0.635271, -0.421966, -1.14039, 0.72276, -0.593431, -0.864833, 0.021583, 0.436448, -0.920244, 0.051922, 0.078175, -0.982313, 0.067511, -0.041763, -1.21835, 0.030275, -0.579329, -1.28936, 0.035979, -0.699904, -0.740808, 0.017984, 0.615552, -0.868601, 0.050715, 0.223502, -0.077766, 0.109283, -0.090656, -0.055646, 0.120942, -0.344979, -0.778102, 0.056814, 0.499797, -0.778102, 0.056814, 0.499797, -0.834906, 0.067211, 0.374642, -1.07709, 0.738335, -0.603154, -1.51594, 0.716952, 0.199151, -1.41023, 0.637965, 0.220745, -0.664852, 0.054962, 0.588108, -0.778102, 0.056814, 0.499797, -0.703093, 0.096739, 0.524, -0.778102, 0.056814, 0.499797, -0.801168, 0.116544, 0.337741, -0.778102, 0.056814, 0.499797, -0.778102, 0.056814, 0.499797, -0.5749, 0.019563, 0.633357, -0.920244, 0.051922, 0.078175, -0.982313, 0.067511, -0.041763, -0.98646, 0.030801, -0.45825, -1.09121, 0.031348, -0.545003, -0.373108, 0.069632, -0.915144, -0.373108, 0.069632, -0.915144, -0.548782, 0.061824, 0.592338, -0.647278, 0.119112, 0.479656, -0.733538, 0.111484, 0.275648, -0.314221, 0.119174, -0.434363, -0.58616, 0.114145, 0.546141, 0.189458, 0.082301, -0.415505, 0.187043, 0.037073, 0.391721, 0.156058, 0.035326, 0.247326, 0.158289, 0.078976, 0.326229, 0.067811, 0.120543, -0.361143, -0.373108, 0.069632, -0.915144, -0.554001, 0.035305, -0.731031, -1.15839, 0.512024, -0.173663, -0.897184, 0.08494, -0.079466, -0.828202, 0.061476, 0.087468, -1.09239, 0.022746, -0.296826, -0.554001, 0.035305, -0.731031, -0.554001, 0.035305, -0.731031, -0.554001, 0.035305, -0.731031, -0.3822, 0.133465, -0.645352, -0.237612, 0.137821, -0.633587, 0.110493, 0.137358, -0.516296, 0.179504, 0.040146, -0.579309, 0.179504, 0.040146, -0.579309, 0.007518, 0.039629, -0.630354, -0.104411, 0.13437, -0.588506, 0.347602, 0.056314, -0.076546, 0.204421, 0.039199, -0.197739, 0.249277, 0.03549, -0.147325, 0.307359, 0.048243, -0.106947, 0.284609, 0.053859, -0.120584, -0.104411, 0.13437, -0.588506, 0.007518, 0.039629, -0.630354, 0.320861, 0.049516, -0.20861, 0.198445, 0.043768, 0.036081, -0.713904, 0.098128, 0.081776, -0.694569, 0.06327, -0.178582, 0.007518, 0.039629, -0.630354
-};
-
-float mUVs[] = {
-0.116613, 0.157105, 0.129233, 0.18206, 0.130521, 0.166865, 0.09352, 0.295267, 0.080165, 0.285801, 0.083641, 0.310112, 0.438985, 0.208271, 0.408429, 0.235842, 0.398087, 0.281301, 0.83681, 0.111779, 0.845103, 0.101812, 0.819192, 0.120706, 0.366412, 0.254148, 0.368412, 0.306973, 0.136676, 0.688811, 0.144338, 0.698244, 0.133192, 0.684931, 0.514132, 0.347077, 0.50259, 0.316589, 0.492329, 0.354738, 0.303255, 0.13917, 0.299164, 0.15952, 0.309117, 0.127241, 0.063366, 0.462704, 0.084228, 0.460961, 0.070046, 0.439785, 0.871622, 0.147935, 0.866465, 0.156696, 0.854936, 0.155823, 0.083726, 0.40703, 0.09547, 0.392009, 0.077946, 0.394851, 0.566053, 0.72217, 0.558476, 0.727556, 0.557902, 0.735906, 0.569701, 0.110153, 0.570047, 0.086505, 0.552114, 0.103315, 0.480197, 0.329387, 0.05597, 0.484215, 0.052035, 0.455864, 0.877233, 0.068045, 0.888926, 0.071334, 0.926049, 0.050148, 0.868087, 0.05837, 0.940297, 0.042264, 0.915205, 0.04666, 0.814104, 0.126419, 0.826733, 0.108717, 0.822965, 0.11217, 0.966975, 0.699798, 0.955359, 0.706424, 0.969527, 0.702411, 0.847613, 0.081944, 0.859107, 0.083099, 0.840977, 0.082109, 0.839171, 0.098378, 0.017235, 0.043837, 0.017354, 0.047306, 0.047342, 0.042484, 0.941723, 0.056707, 0.818723, 0.44126, 0.830261, 0.402792, 0.800423, 0.392327, 0.465463, 0.297507, 0.437987, 0.287245, 0.429673, 0.343696, 0.134101, 0.228256, 0.146924, 0.214101, 0.12278, 0.21513, 0.591419, 0.296256, 0.549105, 0.259579, 0.555509, 0.322891, 0.018942, 0.65289, 0.01866, 0.646495, 0.007154, 0.652126, 0.148672, 0.299594, 0.155414, 0.290499, 0.148462, 0.280908, 0.100816, 0.456724, 0.094792, 0.441654, 0.524978, 0.286192, 0.533014, 0.315408, 0.920773, 0.706212, 0.934167, 0.720646, 0.924726, 0.724917, 0.156304, 0.098504, 0.181975, 0.122344, 0.19957, 0.107887, 0.998468, 0.213253, 1.01178, 0.212589, 1.00141, 0.188132, 0.08942, 0.346814, 0.095634, 0.31421, 0.584747, 0.322956, 0.182417, 0.1799, 0.210101, 0.195838, 0.188238, 0.173131, 0.395836, 0.609732, 0.410613, 0.619513, 0.414491, 0.605043, 0.189002, 0.141119, 0.216705, 0.148027, 0.125896, 0.245575, 0.110841, 0.231669, 0.534396, 0.358388, 0.862054, 0.094285, 0.45888, 0.22251, 0.204929, 0.160804, 0.210088, 0.175473, 0.568778, 0.342721, 0.552111, 0.358353, 0.083069, 0.479588, 0.067299, 0.485589, 0.943773, 0.043331, 1.04734, 0.042484, 0.940297, 0.042264, 0.830278, 0.094074, 0.940297, 0.042264, 1.04734, 0.042484, 0.915205, 0.04666, 0.093134, 0.193358, 0.102011, 0.180109, 0.081327, 0.180044, 0.575349, 0.37131, 0.677215, 0.537302, 0.677809, 0.559525, 0.68778, 0.54229, 0.104178, 0.052533, 0.068012, 0.055865, 0.454768, 0.34897, 0.089814, 0.070583, 0.129445, 0.077497, 0.491927, 0.390823, 0.476844, 0.366232, 0.471238, 0.394189, 0.070979, 0.36375, 0.088853, 0.36741, 0.078326, 0.343577, 0.907936, 0.075914, 0.096715, 0.288369, 0.107275, 0.289238, 0.090641, 0.276433, 0.456942, 0.380334, 0.451254, 0.408366, 0.343597, 0.077402, 0.374001, 0.068696, 0.32733, 0.081526, 1.01724, 0.043837, 1.04734, 0.042484, 0.130086, 0.281826, 0.133385, 0.268557, 0.116945, 0.275305, 0.214714, 0.31613, 0.222797, 0.309226, 0.218695, 0.301199, 0.229612, 0.296553, 0.22533, 0.284621, 0.824912, 0.125381, 0.838143, 0.115598, 0.822548, 0.121049, 0.22834, 0.213082, 0.22539, 0.193184, 0.374001, 0.068696, 0.433166, 0.067098, 0.378452, 0.05833, 0.297249, 0.11014, 0.110493, 0.283965, 0.217518, 0.323602, 0.2303, 0.262921, 0.234192, 0.229802, 0.223501, 0.261408, 0.288495, 0.142129, 0.286814, 0.172686, 0.974952, 0.059552, 0.20703, 0.793311, 0.204677, 0.797383, 0.22653, 0.803034, 0.107946, 0.205947, 0.953465, 0.551383, 0.94132, 0.484682, 0.936354, 0.515832, 0.993204, 0.131269, 1.01045, 0.143942, 1.00938, 0.11583, 0.309708, 0.057781, 0.291245, 0.08063, 0.315876, 0.078804, 0.225264, 0.320667, 0.235349, 0.268244, 0.602939, 0.630331, 0.614136, 0.620281, 0.602911, 0.602565, 0.059728, 0.427056, 0.077028, 0.423842, 0.550494, 0.155604, 0.497061, 0.1937, 0.076789, 0.379413, 0.117973, 0.259521, 1.04734, 0.042484, 1.04959, 0.040977, 0.539292, 0.383195, 0.52131, 0.383487, 0.242191, 0.238768, 0.057599, 0.713543, 0.067064, 0.723603, 0.058984, 0.707386, 0.822548, 0.121049, 0.557381, 0.381629, 0.211644, 0.347546, 0.224254, 0.337622, 0.235457, 0.30087, 0.236545, 0.281854, 0.780743, 0.51461, 0.769723, 0.50114, 0.768124, 0.538324, 0.515729, 0.067842, 0.56276, 0.081918, 0.544186, 0.094182, 0.096199, 0.230002, 0.118653, 0.175839, 0.095398, 0.164539, 0.934935, 0.705506, 0.931163, 0.688281, 0.925446, 0.719035, 0.839597, 0.472903, 0.858951, 0.454173, 0.222388, 0.347145, 0.238954, 0.207263, 0.246703, 0.218951, 0.072578, 0.189364, 0.0843, 0.206401, 0.05856, 0.397515, 0.992061, 0.091813, 1.00564, 0.083729, 1.00469, 0.067923, 0.232189, 0.332538, 0.243789, 0.253125, 0.211158, 0.355047, 0.218521, 0.355416, 0.808083, 0.161458, 0.802398, 0.15212, 0.807418, 0.161484, 0.058707, 0.374434, 0.626672, 0.124899, 0.624322, 0.156359, 0.62324, 0.134531, 0.590849, 0.60818, 0.584008, 0.583318, 0.580689, 0.604671, 0.6306, 0.764797, 0.622798, 0.768218, 0.622748, 0.782244, 0.628737, 0.10989, 0.923823, 0.094983, 0.901099, 0.088664, 0.940083, 0.067762, 0.444035, 0.51777, 0.458377, 0.496674, 0.44254, 0.485074, 0.640258, 0.783353, 0.571933, 0.579187, 0.569694, 0.602479, 0.618407, 0.753877, 0.030942, 0.036309, 0.168175, 0.024281, 0.016582, 0.032978, 0.485068, 0.269254, 0.504954, 0.384182, 0.181737, 0.432393, 0.181999, 0.394533, 0.170944, 0.422278, 0.227328, 0.349271, 0.354329, 0.827474, 0.354765, 0.837655, 0.364387, 0.823948, 0.254425, 0.229753, 0.590493, 0.814433, 0.615612, 0.831677, 0.617131, 0.814258, 0.608268, 0.742123, 0.60611, 0.756251, 0.602013, 0.677815, 0.590137, 0.656861, 0.588622, 0.698597, 0.08121, 0.698659, 0.070277, 0.714418, 0.069212, 0.701355, 0.071226, 0.309289, 0.066733, 0.279829, 0.05488, 0.288302, 0.059997, 0.535073, 0.047436, 0.507298, 0.043877, 0.529739, 0.189691, 0.412316, 0.192243, 0.356848, 0.17948, 0.364171, 0.189394, 0.34767, 0.370837, 0.632557, 0.385237, 0.647876, 0.377836, 0.618795, 0.417402, 0.653522, 0.4333, 0.643763, 0.427216, 0.628223, 0.381824, 0.793911, 0.369133, 0.779097, 0.369054, 0.793584, 0.240427, 0.306131, 0.23685, 0.329976, 0.582277, 0.71316, 0.568013, 0.700619, 0.171769, 0.27449, 0.18149, 0.265228, 0.168025, 0.243878, 0.124907, 0.154213, 0.116471, 0.138566, 0.593609, 0.338833, 0.483466, 0.414856, 0.198716, 0.386688, 0.850307, 0.13864, 0.841613, 0.159939, 0.833929, 0.135543, 0.344312, 0.873364, 0.340796, 0.856881, 0.307197, 0.860152, 0.467686, 0.471769, 0.474886, 0.442204, 0.457828, 0.466977, 0.292015, 0.038843, 0.367607, 0.035693, 0.345866, 0.059207, 0.133951, 0.25107, 0.532344, 0.00800198, 0.617848, 0.046537, 0.56712, 0.041851, 0.566778, 0.6317, 0.580867, 0.631358, 0.57926, 0.661093, 0.577208, 0.252756, 0.066936, 0.405101, 0.574628, 0.400691, 0.170132, 0.924823, 0.212266, 0.878924, 0.132214, 0.900595, 0.38237, 0.833867, 0.392458, 0.877561, 0.371672, 0.858787, 0.364483, 0.884033, 0.586824, 0.741693, 0.588642, 0.726086, 0.581202, 0.722884, 0.612522, 0.771439, 0.833269, 0.166029, 0.829082, 0.168396, 0.817029, 0.160416, 0.1806, 0.450415, 0.178076, 0.478013, 0.187432, 0.465845, 0.457363, 0.593046, 0.469024, 0.592316, 0.463276, 0.568753, 0.394865, 0.666879, 0.406268, 0.642192, 0.383962, 0.819018, 0.375624, 0.810387, 0.253555, 0.240729, 0.265834, 0.199893, 0.605761, 0.657253, 0.599406, 0.665071, 0.620183, 0.666608, 0.415679, 0.171697, 0.557572, 0.408884, 0.548152, 0.443024, 0.564196, 0.43884, 0.170025, 0.536549, 0.180294, 0.503306, 0.160502, 0.500564, 0.169761, 0.481219, 0.196466, 0.426701, 0.617485, 0.693075, 0.60133, 0.704591, 0.354725, 0.801097, 0.354879, 0.788046, 0.343486, 0.782838, 0.437941, 0.59784, 0.432446, 0.58879, 0.429051, 0.607727, 0.385685, 0.735746, 0.39583, 0.739515, 0.392977, 0.71961, 0.591833, 0.144407, 0.569278, 0.115796, 0.56943, 0.120812, 0.337907, 0.802175, 0.333758, 0.814396, 0.586043, 0.145191, 0.566226, 0.123111, 0.574152, 0.122484, 0.067595, 0.695065, 0.045986, 0.67304, 0.298059, 0.151627, 0.299762, 0.118982, 0.293979, 0.160215, 0.047121, 0.213019, 0.034773, 0.210035, 0.048393, 0.238846, 0.184416, 0.512953, 0.195415, 0.473253, 0.212006, 0.419693, 0.527686, 0.808044, 0.532807, 0.81787, 0.535952, 0.798451, 0.624717, 0.172151, 0.630391, 0.189706, 0.624889, 0.19557, 0.346823, 0.808877, 0.818357, 0.166124, 0.52675, 0.550762, 0.519144, 0.558072, 0.526487, 0.585749, 0.205134, 0.450776, 0.210969, 0.386461, 0.205007, 0.340315, 0.527053, 0.830676, 0.525402, 0.826154, 0.524263, 0.829402, 0.033209, 0.037417, 0.094726, 0.023033, 0.161902, 0.210018, 0.147653, 0.201447, 0.125012, 0.196308, 0.399341, 0.35928, 0.686635, 0.839287, 0.670325, 0.84804, 0.694922, 0.856781, 0.004012, 0.577739, 0.007264, 0.601255, 0.021615, 0.581421, 0.179465, 0.559147, 0.182483, 0.539446, 0.198773, 0.494017, 0.204879, 0.47659, 0.448461, 0.573428, 0.60133, 0.704591, 0.22008, 0.350418, 0.407024, 0.670622, 0.823251, 0.139721, 0.827531, 0.161044, 0.833851, 0.153351, 0.193307, 0.526703, 0.213622, 0.45225, 0.219473, 0.320824, 0.349601, 0.81436, 0.372685, 0.667523, 0.92544, 0.12056, 0.919565, 0.117726, 0.916841, 0.124754, 0.529854, 0.78673, 0.530849, 0.780836, 0.526483, 0.802554, 0.439029, 0.564108, 0.999684, 0.655617, 1.00763, 0.647333, 1.00597, 0.645205, 0.202489, 0.504887, 0.398775, 0.864028, 0.181729, 0.666063, 0.160791, 0.68951, 0.175144, 0.705885, 0.139432, 0.061109, 0.392056, 0.187381, 0.976329, 0.682181, 0.995507, 0.657032, 0.971514, 0.687501, 0.169907, 0.57883, 0.180345, 0.588804, 0.212472, 0.483523, 0.224887, 0.402007, 0.385033, 0.759714, 0.445549, 0.539302, 0.433739, 0.531716, 0.992935, 0.051393, 1.04214, 0.045835, 0.999062, 0.065725, 0.448372, 0.58383, 0.335487, 0.82879, 0.421436, 0.593794, 0.871243, 0.156281, 0.856293, 0.162053, 0.866465, 0.156696, 0.999633, 0.166121, 0.985289, 0.148481, 0.197929, 0.547243, 0.212472, 0.483523, 0.228913, 0.369216, 0.374179, 0.71017, 0.373532, 0.689025, 0.359052, 0.694029, 0.575171, 0.745763, 0.576754, 0.731578, 0.566519, 0.735605, 0.152186, 0.722412, 0.144338, 0.698244, 0.146755, 0.706972, 0.333864, 0.245856, 0.346085, 0.335016, 1.00564, 0.083729, 0.992061, 0.091813, 1.00069, 0.105401, 0.966636, 0.084291, 0.961808, 0.095207, 0.166172, 0.613778, 0.197728, 0.559802, 0.207442, 0.532602, 0.212472, 0.483523, 0.212472, 0.483523, 0.221828, 0.432637, 0.235409, 0.308839, 0.529531, 0.786835, 0.529854, 0.78673, 0.52626, 0.804918, 0.455628, 0.6578, 0.458202, 0.631336, 0.450754, 0.626514, 0.151048, 0.715956, 0.60127, 0.857517, 0.623853, 0.856981, 0.137039, 0.699813, 0.987256, 0.672225, 0.192779, 0.578381, 0.216319, 0.498356, 0.212472, 0.483523, 0.212472, 0.483523, 0.311613, 0.835054, 0.440425, 0.625424, 0.445458, 0.603825, 0.533608, 0.770625, 0.541481, 0.754058, 0.449832, 0.681839, 0.447297, 0.658987, 0.541481, 0.754058, 0.53912, 0.757874, 0.537188, 0.768693, 0.549064, 0.742399, 0.53912, 0.757874, 0.612232, 0.787348, 0.601817, 0.773361, 0.594281, 0.780048, 0.461403, 0.611674, 0.92916, 0.694909, 0.907962, 0.688421, 0.926061, 0.68727, 0.293979, 0.160215, 0.284484, 0.184242, 0.290094, 0.183245, 0.32576, 0.784494, 0.312658, 0.775671, 0.307754, 0.798278, 0.213436, 0.802021, 0.204677, 0.797383, 0.20486, 0.8067, 0.207693, 0.569934, 0.225349, 0.469875, 0.230026, 0.437962, 0.243717, 0.360244, 0.250209, 0.319793, 0.343767, 0.763252, 0.367759, 0.749776, 0.351492, 0.74347, 0.475004, 0.574417, 0.481568, 0.545912, 0.476701, 0.519837, 0.540978, 0.583765, 0.542685, 0.562967, 0.195029, 0.598153, 0.236629, 0.395868, 0.386811, 0.704157, 0.453293, 0.560138, 0.140793, 0.710319, 0.149945, 0.729091, 0.141053, 0.721369, 0.220759, 0.542684, 0.221017, 0.520649, 0.227783, 0.509729, 0.469824, 0.527689, 0.393674, 0.627413, 0.427316, 0.509801, 0.877331, 0.067495, 0.877071, 0.058441, 0.912388, 0.058884, 0.153766, 0.730836, 0.151048, 0.715956, 0.560513, 0.746474, 0.915025, 0.109844, 0.900535, 0.123429, 0.880313, 0.12589, 0.243388, 0.403157, 0.526483, 0.802554, 0.524263, 0.829402, 0.525402, 0.826154, 0.52626, 0.804918, 0.524263, 0.829402, 0.531125, 0.793949, 0.529531, 0.786835, 0.225998, 0.172701, 0.23627, 0.184813, 0.111695, 0.017432, 0.532344, 0.00800198, 0.295488, 0.017621, 0.038383, 0.653797, 0.031439, 0.646609, 0.030898, 0.656676, 0.237151, 0.472479, 0.245222, 0.4398, 0.536303, 0.854596, 0.527027, 0.853302, 0.360009, 0.730264, 0.349219, 0.727346, 0.316742, 0.873149, 0.306448, 0.864241, 0.263926, 0.840258, 0.149286, 0.733951, 0.154258, 0.720963, 0.133247, 0.714432, 0.141053, 0.721369, 0.201085, 0.616274, 0.189963, 0.619599, 0.252627, 0.393357, 0.26168, 0.371882, 0.999062, 0.065725, 0.99491, 0.083663, 0.963851, 0.07338, 0.149286, 0.733951, 0.158158, 0.74262, 0.220245, 0.58172, 0.225819, 0.562808, 0.245504, 0.49423, 0.235824, 0.52038, 0.160368, 0.18701, 0.139822, 0.167755, 0.144177, 0.18345, 0.387418, 0.850877, 0.488326, 0.074605, 0.158026, 0.753621, 0.233205, 0.548694, 0.274591, 0.235318, 0.257091, 0.275205, 0.625282, 0.196021, 0.631203, 0.202621, 0.629554, 0.194113, 0.425238, 0.561469, 0.848205, 0.16552, 0.849787, 0.162898, 0.374001, 0.068696, 0.418763, 0.071465, 0.139183, 0.154594, 0.134166, 0.14029, 0.157147, 0.752913, 0.157147, 0.752913, 0.875439, 0.063397, 0.654904, 0.661513, 0.660493, 0.642725, 0.652305, 0.638615, 0.198796, 0.650578, 0.212569, 0.607098, 0.255098, 0.460037, 0.262203, 0.419781, 0.287467, 0.271424, 0.619789, 0.171698, 0.613858, 0.189118, 0.60012, 0.115036, 0.611051, 0.133336, 0.59184, 0.150293, 0.429085, 0.071193, 0.457917, 0.076645, 0.418763, 0.071465, 0.217245, 0.628676, 0.284198, 0.344751, 0.297894, 0.297908, 0.314478, 0.061236, 0.307212, 0.091341, 0.599087, 0.797188, 0.529531, 0.786835, 0.534797, 0.767596, 0.533608, 0.770625, 0.203335, 0.675708, 0.226611, 0.605745, 0.27356, 0.395017, 0.883186, 0.106288, 0.386908, 0.774026, 0.364673, 0.765487, 0.457917, 0.076645, 0.489962, 0.083832, 0.066856, 0.711069, 0.173545, 0.736486, 0.237523, 0.564974, 0.261874, 0.473293, 0.156625, 0.259184, 0.821454, 0.144853, 0.419257, 0.580317, 0.161254, 0.770466, 0.185083, 0.744157, 0.197807, 0.721066, 0.230079, 0.6364, 0.812152, 0.143676, 0.116268, 0.678662, 0.133192, 0.684931, 0.11952, 0.686617, 0.414838, 0.544904, 0.401291, 0.517554, 0.403326, 0.538406, 0.161254, 0.770466, 0.165358, 0.776632, 0.170864, 0.772249, 0.212941, 0.697767, 0.242665, 0.598863, 0.253682, 0.553892, 0.27454, 0.446697, 0.271978, 0.047774, 0.314478, 0.061236, 0.298397, 0.089655, 0.621321, 0.212424, 0.622517, 0.209396, 0.627748, 0.211017, 0.580681, 0.113711, 0.554425, 0.12449, 0.231958, 0.670998, 0.278226, 0.517826, 0.285501, 0.403001, 0.313245, 0.355222, 0.306516, 0.316872, 0.324586, 0.284089, 0.310246, 0.222399, 0.178957, 0.152506, 0.159002, 0.144751, 0.167747, 0.161879, 0.488793, 0.08475, 0.513341, 0.096587, 0.527896, 0.097847, 0.43912, 0.453154, 0.457546, 0.43477, 0.439426, 0.419084, 0.16208, 0.782016, 0.165358, 0.776632, 0.161254, 0.770466, 0.596327, 0.734377, 0.598184, 0.742254, 0.516365, 0.099116, 0.221769, 0.71599, 0.247463, 0.629609, 0.257348, 0.592043, 0.262604, 0.570516, 0.275376, 0.545541, 0.286864, 0.483553, 0.286864, 0.483553, 0.296978, 0.417367, 0.371563, 0.727633, 0.552102, 0.599391, 0.553048, 0.624573, 0.70546, 0.865107, 0.707907, 0.85683, 0.173085, 0.788406, 0.176924, 0.793669, 0.183242, 0.784743, 0.202365, 0.758924, 0.247874, 0.680511, 0.32102, 0.408621, 0.459194, 0.54342, 0.457942, 0.521098, 0.36274, 0.711964, 0.529289, 0.097005, 0.516365, 0.099116, 0.488793, 0.08475, 0.176924, 0.793669, 0.256387, 0.624251, 0.270929, 0.608257, 0.27637, 0.587423, 0.30416, 0.454668, 0.286864, 0.483553, 0.533382, 0.108618, 0.533382, 0.108618, 0.55946, 0.127221, 0.316479, 0.097411, 0.306876, 0.095844, 0.226182, 0.736669, 0.260687, 0.638858, 0.372493, 0.601197, 0.385674, 0.595707, 0.286851, 0.575636, 0.306448, 0.864241, 0.424433, 0.453431, 0.413802, 0.490939, 0.849787, 0.162898, 0.191099, 0.807294, 0.217056, 0.77934, 0.304715, 0.556594, 0.302953, 0.529283, 0.286864, 0.483553, 0.885802, 0.147808, 0.87994, 0.148035, 0.871243, 0.156281, 0.16574, 0.290464, 0.266193, 0.666345, 0.319537, 0.491277, 0.286864, 0.483553, 0.286864, 0.483553, 0.541466, 0.753402, 0.543192, 0.74533, 0.70253, 0.847637, 0.24344, 0.747502, 0.260784, 0.708312, 0.283467, 0.625668, 0.297167, 0.587921, 0.314972, 0.530668, 0.567386, 0.66077, 0.5539, 0.644811, 0.517508, 0.826569, 0.363183, 0.66551, 0.542712, 0.115315, 0.55562, 0.124529, 0.285501, 0.665006, 0.294367, 0.635857, 0.603604, 0.729441, 0.594155, 0.719579, 0.533348, 0.402213, 0.221594, 0.797911, 0.201498, 0.819603, 0.595657, 0.58325, 0.587205, 0.555795, 0.48984, 0.446433, 0.475752, 0.47148, 0.5611, 0.721358, 0.553367, 0.685622, 0.85909, 0.130723, 0.85743, 0.117355, 0.214393, 0.809098, 0.211405, 0.796869, 0.227872, 0.80186, 0.247844, 0.769036, 0.327841, 0.533249, 0.360328, 0.411186, 0.33771, 0.483821, 0.641496, 0.378863, 0.655609, 0.401803, 0.66101, 0.393664, 0.38599, 0.677442, 0.005636, 0.083729, 0.000693, 0.105401, 0.015048, 0.099529, 0.873283, 0.085005, 0.224701, 0.815051, 0.201498, 0.819603, 0.246424, 0.791213, 0.272713, 0.753953, 0.173733, 0.309246, 0.165251, 0.303792, 0.170813, 0.317706, 0.526483, 0.802554, 0.530849, 0.780836, 0.515969, 0.804227, 0.313957, 0.57447, 0.36696, 0.458218, 0.372412, 0.367973, 0.372412, 0.367973, 0.240018, 0.817951, 0.227872, 0.80186, 0.11657, 0.014938, 0.613138, 0.014326, 0.532344, 0.00800198, 0.613138, 0.014326, 0.549806, 0.734572, 0.4969, 0.421006, 0.540401, 0.426736, 0.32789, 0.561176, 0.372412, 0.367973, 0.244012, 0.809788, 0.227872, 0.80186, 0.235815, 0.82397, 0.223705, 0.824384, 0.267304, 0.206757, 0.346507, 0.50865, 0.600038, 0.177266, 0.603438, 0.195077, 0.574579, 0.144301, 0.567171, 0.136891, 0.574579, 0.144301, 0.578784, 0.144817, 0.227053, 0.803917, 0.243708, 0.813368, 0.244479, 0.811874, 0.227872, 0.80186, 0.244012, 0.809788, 0.227872, 0.80186, 0.378057, 0.520891, 0.371123, 0.557886, 0.385795, 0.558748, 0.066013, 0.347623, 0.360222, 0.191283, 0.595412, 0.164765, 0.609545, 0.177511, 0.602411, 0.168665, 0.339958, 0.54901, 0.404734, 0.769345, 0.811134, 0.130702, 0.096886, 0.70984, 0.110954, 0.69369, 0.081695, 0.707898, 0.379591, 0.415156, 1.0364, 0.050283, 1.00469, 0.067923, 0.440162, 0.668923, 0.438823, 0.693381, 1.04214, 0.045835, 0.255185, 0.824133, 0.223705, 0.824384, 0.255185, 0.824133, 0.258775, 0.805672, 0.9, 0.587802, 0.888594, 0.611728, 0.900347, 0.647433, 0.492895, 0.481899, 0.486821, 0.473435, 0.48398, 0.504488, 0.355818, 0.523683, 0.538513, 0.778963, 0.536666, 0.769756, 0.534797, 0.767596, 0.261359, 0.830289, 0.146972, 0.165784, 0.163732, 0.175692, 0.150763, 0.156326, 0.579077, 0.425226, 0.126798, 0.709808, 0.108449, 0.696498, 0.478982, 0.038869, 0.369617, 0.506949, 0.372412, 0.367973, 0.903618, 0.694614, 0.914239, 0.686975, 0.893907, 0.693051, 0.407382, 0.722286, 0.405443, 0.700821, 0.266583, 0.835368, 0.2609, 0.830982, 0.2609, 0.830982, 0.255185, 0.824133, 0.240018, 0.817951, 0.2723, 0.822712, 0.504402, 0.13101, 0.513329, 0.408535, 1.01596, 0.099695, 0.312057, 0.643926, 0.312642, 0.668884, 0.322924, 0.64808, 0.543192, 0.74533, 0.348358, 0.717938, 0.441404, 0.645346, 0.336231, 0.632321, 0.326933, 0.621491, 0.48984, 0.446433, 0.355393, 0.554123, 0.397453, 0.421836, 0.675681, 0.683456, 0.687549, 0.682817, 0.686518, 0.664731, 0.400331, 0.68477, 0.544429, 0.075708, 0.2609, 0.830982, 0.319009, 0.686527, 0.328512, 0.657457, 0.312642, 0.668884, 0.540401, 0.426736, 0.282346, 0.809805, 0.279689, 0.79611, 0.308091, 0.732563, 0.318103, 0.728282, 0.347308, 0.609093, 0.335799, 0.59929, 0.50609, 0.441429, 0.846906, 0.789147, 0.854424, 0.793561, 0.882583, 0.756756, 0.38486, 0.492926, 0.414492, 0.403177, 0.278838, 0.843909, 0.278838, 0.843909, 0.29869, 0.78023, 0.291062, 0.811953, 0.311283, 0.757779, 0.328653, 0.696937, 0.335009, 0.660005, 0.349175, 0.62388, 0.35502, 0.595087, 0.335799, 0.59929, 0.10174, 0.127949, 0.086357, 0.138795, 0.520057, 0.423996, 0.540401, 0.426736, 0.40799, 0.43841, 0.429118, 0.384005, 0.624597, 0.797082, 0.60133, 0.704591, 0.616798, 0.711495, 0.537188, 0.768693, 0.323523, 0.732073, 0.346887, 0.651959, 0.316742, 0.873149, 0.266583, 0.835368, 0.278838, 0.843909, 0.261359, 0.830289, 0.289374, 0.835848, 0.848205, 0.16552, 0.333157, 0.719595, 0.343047, 0.682379, 0.48984, 0.446433, 0.38695, 0.528278, 0.398628, 0.492372, 0.489997, 0.560489, 0.52626, 0.804918, 0.306918, 0.816701, 0.333023, 0.745191, 0.343336, 0.703761, 0.36018, 0.613835, 0.35657, 0.634842, 0.590663, 0.631159, 0.402085, 0.55414, 0.266583, 0.835368, 0.891565, 0.560145, 0.130111, 0.694895, 0.322496, 0.763269, 0.357302, 0.664832, 0.392209, 0.575123, 0.357206, 0.577117, 0.536666, 0.769756, 0.266583, 0.835368, 0.094726, 0.023033, 0.033209, 0.037417, 0.403383, 0.570884, 0.885802, 0.147808, 0.104173, 0.334407, 0.42467, 0.869233, 0.417581, 0.877042, 0.417233, 0.67609, 0.589424, 0.157657, 0.488326, 0.074605, 0.491624, 0.063113, 0.489895, 0.616721, 0.479374, 0.612973, 0.481364, 0.634596, 0.529373, 0.118681, 0.555929, 0.144817, 0.548945, 0.140917, 0.398213, 0.803469, 0.397396, 0.785599, 0.244273, 0.857937, 0.270654, 0.871827, 0.241231, 0.843515, 0.469753, 0.626397, 0.464441, 0.639744, 1.00469, 0.067923, 1.00564, 0.083729, 0.545633, 0.748819, 0.543242, 0.760984, 0.430046, 0.74271, 0.432339, 0.728792, 0.41963, 0.72312, 0.54611, 0.769916, 0.523868, 0.771484, 0.514026, 0.787054, 0.607063, 0.642264, 0.158504, 0.787581, 0.153867, 0.772652, 0.55087, 0.748997, 0.546178, 0.789758, 0.630077, 0.082499, 0.620918, 0.108293, 0.413151, 0.835409, 0.441322, 0.841829, 0.43434, 0.822195, 0.429085, 0.071193, 0.701206, 0.780055, 0.698867, 0.808742, 0.717793, 0.787887, 0.693937, 0.719785, 0.679856, 0.731176, 0.680808, 0.746426, 0.563228, 0.153264, 0.554188, 0.126127, 0.548945, 0.140917, 0.417818, 0.797074, 0.426054, 0.77431, 0.410933, 0.78216, 0.298988, 0.105573, 0.298397, 0.089655, 0.955359, 0.706424, 0.966975, 0.699798, 0.959349, 0.708046, 0.244698, 0.263815, 0.417156, 0.818453, 0.401345, 0.813595, 0.344006, 0.075371, 0.226815, 0.820646, 0.213765, 0.814228, 0.22356, 0.828515, 0.243493, 0.276492, 0.604659, 0.537809, 0.597457, 0.568707, 0.609576, 0.56719, 0.239905, 0.3236, 0.026021, 0.665471, 0.035236, 0.666999, 0.018888, 0.649916, 0.49045, 0.513153, 0.498534, 0.633922, 0.49543, 0.586188, 0.491459, 0.600511, 0.429183, 0.809946, 0.51839, 0.092797, 0.205007, 0.340315, 0.196084, 0.344289, 0.616457, 0.154497, 0.560316, 0.782212, 0.558834, 0.80221, 0.066672, 0.512095, 0.234821, 0.341239, 0.239905, 0.3236, 0.244475, 0.274707, 0.549378, 0.100402, 0.231716, 0.342062, 0.227686, 0.35203, 0.221483, 0.353079, 0.234821, 0.341239, 0.524014, 0.112864, 0.240372, 0.319778, 0.239905, 0.3236, 0.547372, 0.71985, 0.554792, 0.827346, 0.571373, 0.81784, 0.23611, 0.320976, 0.243688, 0.300015, 0.239905, 0.3236, 0.239905, 0.3236, 0.243688, 0.300015, 0.554625, 0.754877, 0.555959, 0.770032, 0.511627, 0.768351, 0.5013, 0.766403, 0.50127, 0.786876, 0.514986, 0.642871, 0.525897, 0.612641, 0.511986, 0.623481, 0.849775, 0.411986, 0.854918, 0.35177, 0.214776, 0.340706, 0.210599, 0.354261, 0.223816, 0.33074, 0.244475, 0.274707, 0.254856, 0.23487, 0.253555, 0.240729, 0.592607, 0.75853, 0.552387, 0.735934, 0.510882, 0.727787, 0.503298, 0.710723, 0.498448, 0.740688, 0.474013, 0.701126, 0.475076, 0.675867, 0.465539, 0.672811, 0.550065, 0.734406, 0.223816, 0.33074, 0.223816, 0.33074, 0.245933, 0.266583, 0.452425, 0.807537, 0.459858, 0.786845, 0.446272, 0.798153, 0.500283, 0.691138, 0.509169, 0.676665, 0.49181, 0.680235, 0.24268, 0.29765, 0.267304, 0.206757, 0.754361, 0.359251, 0.734097, 0.381925, 0.757046, 0.399013, 0.433274, 0.711264, 0.615045, 0.189554, 0.621896, 0.196542, 0.247742, 0.245548, 0.247742, 0.245548, 0.425648, 0.659928, 0.441651, 0.787143, 0.545481, 0.80934, 0.598381, 0.166964, 0.612301, 0.199534, 0.60871, 0.180115, 0.209961, 0.329133, 0.196084, 0.344289, 0.209961, 0.329133, 0.245933, 0.266583, 0.528972, 0.710664, 0.223816, 0.33074, 0.253379, 0.222371, 0.846734, 0.31256, 0.810646, 0.309451, 0.519542, 0.7483, 0.482867, 0.838626, 0.497872, 0.826625, 0.481767, 0.815789, 0.441544, 0.879899, 0.456288, 0.881472, 0.460892, 0.869209, 0.481232, 0.858374, 0.44083, 0.869716, 0.460925, 0.857086, 0.493317, 0.863534, 0.710941, 0.76996, 0.227419, 0.314447, 0.223816, 0.33074, 0.238964, 0.304597, 0.24268, 0.29765, 0.249831, 0.274758, 0.251246, 0.25043, 0.252275, 0.227555, 0.253379, 0.222371, 0.26022, 0.21515, 0.46228, 0.824315, 0.624597, 0.797082, 0.223816, 0.33074, 0.271883, 0.205205, 0.26022, 0.21515, 0.833436, 0.277467, 0.479374, 0.612973, 0.238964, 0.304597, 0.250658, 0.288855, 0.145505, 0.71692, 0.152186, 0.722412, 0.151491, 0.736229, 0.624597, 0.797082, 0.885018, 0.646895, 0.479374, 0.612973, 0.436081, 0.801858, 0.592139, 0.18614, 0.572998, 0.163715, 0.584806, 0.162594, 0.600838, 0.194918, 0.605922, 0.204729, 0.844645, 0.166147, 0.835623, 0.168246, 0.848205, 0.16552, 0.219473, 0.320824, 0.231254, 0.309475, 0.209961, 0.329133, 0.595535, 0.15216, 0.602644, 0.168748, 0.434024, 0.858282, 0.496061, 0.52804, 0.255906, 0.273734, 0.27045, 0.19419, 0.270571, 0.203486, 0.271883, 0.205205, 0.286876, 0.183702, 0.295488, 0.017621, 0.478982, 0.038869, 0.470818, 0.06758, 0.58748, 0.182469, 0.575817, 0.155716, 0.579548, 0.177749, 0.240563, 0.302335, 0.250433, 0.289234, 0.250433, 0.289234, 0.263309, 0.248247, 0.260004, 0.238554, 0.271357, 0.201092, 0.266553, 0.201876, 0.27045, 0.19419, 0.280936, 0.188545, 0.280936, 0.188545, 0.286876, 0.183702, 0.601758, 0.719263, 0.609954, 0.073714, 0.257661, 0.278007, 0.280936, 0.188545, 0.178527, 0.631774, 0.153766, 0.730836, 0.153766, 0.730836, 0.158026, 0.753621, 0.15558, 0.759524, 0.573945, 0.138325, 0.589984, 0.166925, 0.316198, 0.105392, 0.316479, 0.097411, 0.72644, 0.843263, 0.457692, 0.691073, 0.458652, 0.71769, 0.405172, 0.890988, 0.579548, 0.177749, 0.273467, 0.221353, 0.284159, 0.181835, 0.280936, 0.188545, 0.147477, 0.76563, 0.140365, 0.731689, 0.135641, 0.737774, 0.449077, 0.828278, 0.977389, 0.675332, 0.961621, 0.693246, 0.266805, 0.253997, 0.296162, 0.164744, 0.280936, 0.188545, 0.149949, 0.746507, 0.42361, 0.707546, 0.5144, 0.867284, 0.509951, 0.581729, 0.501532, 0.560671, 0.503309, 0.748007, 0.492105, 0.767313, 0.443754, 0.761327, 0.449272, 0.733954, 0.454495, 0.758948, 0.247354, 0.2862, 0.247354, 0.2862, 0.231254, 0.309475, 0.285866, 0.173684, 0.227686, 0.35203, 0.531011, 0.681643, 0.91383, 0.122359, 0.940605, 0.111429, 0.916841, 0.124754, 0.446832, 0.709688, 0.262055, 0.263442, 0.257661, 0.278007, 0.266805, 0.253997, 0.293504, 0.163769, 0.527703, 0.100961, 0.480988, 0.789873, 0.478226, 0.77278, 0.569278, 0.115796, 0.549378, 0.100402, 0.595412, 0.164765, 0.580855, 0.152036, 0.266805, 0.253997, 0.285866, 0.173684, 0.94366, 0.537193, 0.489681, 0.740589, 0.481278, 0.755636, 0.652377, 0.824354, 0.639733, 0.801253, 0.634026, 0.814998, 0.139139, 0.696653, 0.257091, 0.275205, 0.281203, 0.181239, 0.614124, 0.20998, 0.605922, 0.204729, 0.608072, 0.205875, 0.488889, 0.649315, 0.557408, 0.570715, 0.491289, 0.788413, 0.603635, 0.168623, 0.882193, 0.705258, 0.864538, 0.695606, 0.871196, 0.708395, 0.272025, 0.242142, 0.266805, 0.253997, 0.272025, 0.242142, 0.281233, 0.216115, 0.266805, 0.253997, 0.266805, 0.253997, 0.271357, 0.201092, 0.281203, 0.181239, 0.424639, 0.688078, 0.475632, 0.739971, 0.477008, 0.656311, 0.60871, 0.180115, 0.47953, 0.71664, 0.462831, 0.733362, 0.262055, 0.263442, 0.563228, 0.153264, 0.496651, 0.800927, 0.485957, 0.671086, 0.480551, 0.69006, 0.304986, 0.143114, 0.133143, 0.291758, 0.282058, 0.208327, 0.281233, 0.216115, 0.482337, 0.584106, 0.468865, 0.800744, 0.155032, 0.194395, 0.138391, 0.193848, 0.46788, 0.76895, 0.465913, 0.757783, 0.257091, 0.275205, 0.269462, 0.236038, 0.319145, 0.883154, 0.466544, 0.841161, 0.609545, 0.177511, 0.705077, 0.746528, 0.689484, 0.75051, 0.703141, 0.757785, 0.097849, 0.700942, 0.098458, 0.684005, 0.632119, 0.088287, 0.591833, 0.144407, 0.343597, 0.077402, 0.374001, 0.068696, 0.523781, 0.661768, 0.462831, 0.733362, 0.989416, 0.355045, 1.00163, 0.321223, 0.988679, 0.330696, 0.290094, 0.183245, 0.673449, 0.875789, 0.659658, 0.860846, 0.496135, 0.662536, 0.581113, 0.775166, 0.583062, 0.759732, 0.487357, 0.694753, 0.632119, 0.088287, 0.627727, 0.096335, 0.628737, 0.10989, 0.186744, 0.801481, 0.18304, 0.794221, 0.16676, 0.797689, 0.269462, 0.236038, 0.083294, 0.435638, 0.533867, 0.747578, 0.35529, 0.893714, 0.966101, 0.538842, 0.960454, 0.5831, 0.581202, 0.722884, 0.969823, 0.693632, 0.960385, 0.703403, 0.973649, 0.101544, 0.603635, 0.168623, 0.595535, 0.15216, 0.593933, 0.716724, 0.60133, 0.704591, 0.535586, 0.838302, 0.23634, 0.816852, 0.223866, 0.810962, 0.540799, 0.831212, 0.725671, 0.822962, 0.715516, 0.803126, 0.709343, 0.825895, 0.079757, 0.449287, 0.623858, 0.187494, 0.618088, 0.184007, 0.409534, 0.74972, 0.572998, 0.163715, 0.563228, 0.153264, 0.548945, 0.140917, 0.273324, 0.179496, 0.565899, 0.761877, 0.462831, 0.733362, 0.479374, 0.612973, 0.569916, 0.785533, 0.571038, 0.768689, 0.587572, 0.712836, 0.595329, 0.714328, 0.590523, 0.711636, 0.581955, 0.785686, 0.576167, 0.715717, 0.57054, 0.725274, 0.581202, 0.722884, 0.82034, 0.165399, 0.343597, 0.077402, 0.316198, 0.105392, 0.804499, 0.152889, 0.802797, 0.145878, 0.247367, 0.838292, 0.860372, 0.766651, 0.898695, 0.09448, 0.883852, 0.086389, 0.862054, 0.094285, 0.588877, 0.155717, 0.580855, 0.152036, 0.600838, 0.194918, 0.481542, 0.730397, 0.400388, 0.072534, 0.266583, 0.835368, 0.168175, 0.024281, 0.292015, 0.038843, 0.620106, 0.114108, 0.610063, 0.14682, 0.620514, 0.139911, 0.079341, 0.502471, 0.414365, 0.06777, 0.344006, 0.075371, 0.418763, 0.071465, 0.624597, 0.797082, 0.581202, 0.722884, 0.805045, 0.150832, 0.802791, 0.142471, 0.808888, 0.137881, 0.690742, 0.82354, 0.400388, 0.072534, 0.429085, 0.071193, 0.418763, 0.071465, 0.810178, 0.347388, 0.500395, 0.500177, 0.494744, 0.494225, 0.422366, 0.748694, 0.819898, 0.167839, 0.807418, 0.161484, 0.113594, 0.386687, 0.1085, 0.370044, 0.10366, 0.402383, 0.887417, 0.700211, 0.882193, 0.705258, 0.871196, 0.708395, 0.541305, 0.695011, 0.52559, 0.640603, 0.524014, 0.112864, 0.523781, 0.661768, 0.282058, 0.208327, 0.184978, 0.350043, 0.189394, 0.34767, 0.196084, 0.344289, 0.550979, 0.736847, 0.41112, 0.052071, 0.457933, 0.079736, 0.400388, 0.072534, 0.463803, 0.073821, 0.429085, 0.071193, 0.885616, 0.395669, 0.912114, 0.373042, 0.908666, 0.351618, 0.266639, 0.861971, 0.462831, 0.733362, 0.882428, 0.913785, 0.95537, 0.910406, 0.874447, 0.853121, 0.829082, 0.168396, 0.82034, 0.165399, 0.819898, 0.167839, 0.316198, 0.105392, 0.304205, 0.115511, 0.886969, 0.694862, 0.640685, 0.833791, 0.287888, 0.871433, 0.400388, 0.072534, 0.457933, 0.079736, 0.486098, 0.076811, 0.429085, 0.071193, 0.463803, 0.073821, 0.486098, 0.076811, 0.534797, 0.767596, 0.627258, 0.677188, 0.523781, 0.661768, 0.479374, 0.612973, 0.495133, 0.090895, 0.414365, 0.06777, 0.133292, 0.121344, 0.124252, 0.099876, 0.113681, 0.119062, 0.624597, 0.797082, 0.623089, 0.646667, 0.495133, 0.090895, 1.01167, 0.170098, 0.500153, 0.097198, 0.486098, 0.076811, 0.263926, 0.840258, 0.462831, 0.733362, 0.479374, 0.612973, 0.495133, 0.090895, 0.500153, 0.097198, 0.457933, 0.079736, 0.628732, 0.206546, 0.632217, 0.208781, 0.241231, 0.843515, 0.60133, 0.704591, 0.525903, 0.08914, 0.525903, 0.08914, 0.809816, 0.160576, 0.567171, 0.136891, 0.566087, 0.12997, 0.55946, 0.127221, 0.266583, 0.835368, 0.976054, 0.104586, 0.927685, 0.72979, 0.934167, 0.720646, 0.295714, 0.182195, 0.964823, 0.067683, 0.917378, 0.080721, 0.955174, 0.07793, 0.602644, 0.168748, 0.596794, 0.196439, 0.943968, 0.708892, 0.616303, 0.177417, 0.11446, 0.296893, 0.280576, 0.055641, 0.271978, 0.047774, 0.298397, 0.089655, 0.462831, 0.733362, 0.529373, 0.118681, 0.922633, 0.446514, 0.922125, 0.415071, 0.907854, 0.402528, 0.479374, 0.612973, 0.479374, 0.612973, 0.55946, 0.127221, 0.566087, 0.12997, 0.55562, 0.124529, 0.19598, 0.220965, 0.183012, 0.210071, 0.191158, 0.240982, 0.832192, 0.154422, 0.104536, 0.425316, 0.100312, 0.355077, 0.856745, 0.105031, 0.840414, 0.112365, 0.848569, 0.086539, 0.856745, 0.105031, 0.830929, 0.105948, 0.830278, 0.094074, 0.84201, 0.079965, 0.158388, 0.314012, 0.138581, 0.702355, 0.130879, 0.6927, 0.132155, 0.701766, 0.133446, 0.308657, 0.112211, 0.308572, 0.135319, 0.70994, 0.062745, 0.923624, 0.064164, 0.879915, 0.124562, 0.331325, 0.132527, 0.319911, 0.143442, 0.263188, 0.14788, 0.240904, 0.950264, 0.705026, 0.151701, 0.228288, 0.823855, 0.120017, 0.17316, 0.228631, 0.609566, 0.733069, 0.097427, 0.267264, 0.708925, 0.731955, 0.546176, 0.860639, 0.540936, 0.881487, 0.565825, 0.870977, 0.143311, 0.826538, 0.118018, 0.79338, 0.11091, 0.822778, 0.657643, 0.622929, 0.643891, 0.62538, 0.628732, 0.206546, 0.621955, 0.20818, 0.628377, 0.211951, 0.097982, 0.253544, 0.295488, 0.017621, 0.176868, 0.293317, 0.18905, 0.283627, 0.628377, 0.211951, 0.088026, 0.713037, 0.972707, 0.044154, 0.736982, 0.807898, 0.096886, 0.70984, 0.083992, 0.718985, 0.896303, 0.686315, 0.746441, 0.799647, 0.758105, 0.81199, 0.802398, 0.15212, 0.700085, 0.504298, 0.690058, 0.528179, 0.707954, 0.516834, 0.640221, 0.664585, 0.638062, 0.642392, 0.645804, 0.650033, 0.638062, 0.642392, 0.005636, 0.083729, 0.015048, 0.099529, 0.015957, 0.099695, 0.669467, 0.770048, 0.656919, 0.763241, 0.662417, 0.786787, 0.596794, 0.196439, 0.765559, 0.799031, 0.868087, 0.05837, 0.060768, 0.332554, 0.066013, 0.347623, 0.645398, 0.692513, 0.660491, 0.708164, 0.660011, 0.686577, 0.614124, 0.20998, 0.621321, 0.212424, 0.872848, 0.708002, 0.886969, 0.694862, 0.871196, 0.708395, 0.11274, 0.437923, 0.076868, 0.268393, 0.133247, 0.714432, 0.112325, 0.709796, 0.086385, 0.414783, 0.638062, 0.642392, 0.622243, 0.632354, 0.628886, 0.621847, 0.712618, 0.460411, 0.724099, 0.469032, 0.729851, 0.432354, 0.822965, 0.11217, 0.98977, 0.673538, 0.995591, 0.667928, 0.672252, 0.651079, 0.66859, 0.667437, 0.614124, 0.20998, 0.612746, 0.598558, 0.62359, 0.585762, 0.615797, 0.577049, 0.066856, 0.711069, 0.089331, 0.685713, 0.074433, 0.236433, 0.07843, 0.257803, 0.648556, 0.678062, 0.830929, 0.105948, 0.066013, 0.347623, 0.059962, 0.356632, 0.663377, 0.726955, 0.649423, 0.725998, 0.694462, 0.700666, 0.678764, 0.699905, 0.685057, 0.712589, 0.084545, 0.233208, 0.07843, 0.257803, 0.790623, 0.052471, 0.664241, 0.010312, 0.620374, 0.050145, 0.612893, 0.324945, 0.59663, 0.363541, 0.628574, 0.352957, 0.632047, 0.203615, 0.633473, 0.202807, 0.632217, 0.208781, 0.369609, 0.584326, 0.456026, 0.896131, 0.479201, 0.884823, 0.173998, 0.216765, 0.183069, 0.232725, 0.625087, 0.606102, 0.823855, 0.120017, 0.608072, 0.205875, 0.638062, 0.642392, 0.687872, 0.763182, 0.685935, 0.775944, 0.167225, 0.203189, 0.742024, 0.823576, 0.915205, 0.04666, 0.148586, 0.517551, 0.155435, 0.551677, 0.613175, 0.169278, 0.602411, 0.168665, 0.793666, 0.436152, 0.771214, 0.452368, 0.802528, 0.44887, 0.635266, 0.69863, 0.640459, 0.715237, 0.001633, 0.321223, 0.025246, 0.300884, 0.01147, 0.268946, 0.633654, 0.735276, 0.65938, 0.743533, 0.689007, 0.787165, 0.677821, 0.799971, 0.614703, 0.206689, 0.608072, 0.205875, 0.871608, 0.103918, 0.874239, 0.108198, 0.642353, 0.752163, 0.424933, 0.894313, 0.496485, 0.901456, 0.464682, 0.907524, 0.050904, 0.67882, 0.070277, 0.714418, 0.046037, 0.68593, 0.075801, 0.720971, 0.067064, 0.723603, 0.825195, 0.791514, 0.801502, 0.793031, 0.784824, 0.805263, 0.64152, 0.761312, 0.647478, 0.769306, 0.885001, 0.509958, 0.879378, 0.561367, 0.03083, 0.647469, 0.036526, 0.661164, 0.034357, 0.674749, 0.135904, 0.183508, 0.214437, 0.359093, 0.627748, 0.211017, 0.086024, 0.689182, 0.095154, 0.682663, 0.085902, 0.691412, 0.785045, 0.471319, 0.787952, 0.491022, 0.802146, 0.481663, 0.614953, 0.556204, 0.615797, 0.577049, 0.623329, 0.561974, 0.615797, 0.577049, 0.093731, 0.517019, 0.537739, 0.652988, 0.523781, 0.661768, 0.201153, 0.339864, 0.208413, 0.337234, 0.745629, 0.434186, 0.825085, 0.782866, 0.302764, 0.886419, 0.07843, 0.257803, 0.704279, 0.708438, 0.917547, 0.655321, 0.915967, 0.596537, 0.524035, 0.894536, 0.625282, 0.196021, 0.758004, 0.449286, 0.817354, 0.127419, 0.073515, 0.724014, 0.066626, 0.722013, 0.62935, 0.714534, 0.293934, 0.130121, 0.615797, 0.577049, 0.738127, 0.472402, 0.717529, 0.493984, 0.739869, 0.484994, 0.066626, 0.722013, 0.067064, 0.723603, 0.057599, 0.713543, 0.72901, 0.782917, 0.612105, 0.727158, 0.622049, 0.743498, 0.623446, 0.737954, 0.674214, 0.715051, 0.18057, 0.192118, 0.814104, 0.126419, 0.577586, 0.546648, 0.73983, 0.773987, 0.83356, 0.82102, 0.876738, 0.794893, 0.843567, 0.806058, 0.154539, 0.792369, 0.144865, 0.790511, 0.950264, 0.705026, 0.07843, 0.257803, 0.065296, 0.256484, 0.921181, 0.69296, 0.911144, 0.698828, 0.894161, 0.132453, 0.90779, 0.131699, 0.817354, 0.127419, 0.047121, 0.434835, 0.083992, 0.718985, 0.073515, 0.724014, 0.58748, 0.182469, 0.579548, 0.177749, 0.592139, 0.18614, 0.901169, 0.699513, 0.535146, 0.61936, 0.791963, 0.789423, 0.292721, 0.14713, 0.793172, 0.82519, 0.769443, 0.83527, 0.780732, 0.831145, 0.523781, 0.661768, 0.056851, 0.681965, 0.734728, 0.524358, 0.746367, 0.508694, 0.724975, 0.513354, 0.625681, 0.742516, 0.808888, 0.137881, 0.633473, 0.202807, 0.544319, 0.655994, 0.578525, 0.797654, 0.87561, 0.478205, 0.868764, 0.531032, 0.290937, 0.129924, 0.286251, 0.154411, 0.290937, 0.129924, 0.281203, 0.181239, 0.111634, 0.480646, 0.113765, 0.461645, 0.101949, 0.481787, 0.286251, 0.154411, 0.293934, 0.130121, 0.883369, 0.439803, 0.865179, 0.484694, 0.633473, 0.202807, 0.298988, 0.105573, 0.290937, 0.129924, 0.568121, 0.802674, 0.88464, 0.740809, 0.902214, 0.721013, 0.897499, 0.712157, 0.729584, 0.768935, 0.624597, 0.797082, 0.844238, 0.074521, 0.857165, 0.499257, 0.298397, 0.089655, 0.827302, 0.112394, 0.803881, 0.139222, 0.806599, 0.133261, 0.802791, 0.142471, 0.099318, 0.044471, 1.00481, 0.101543, 0.853773, 0.110539, 0.309117, 0.127241, 0.299164, 0.15952, 0.304986, 0.143114, 0.049595, 0.040977, 0.83681, 0.111779, 1.04959, 0.040977, 0.819192, 0.120706, 0.071878, 0.01364, 0.280576, 0.055641, 0.302036, 0.077999, 0.581202, 0.722884, 0.566538, 0.717178, 0.556469, 0.723977, 0.556469, 0.723977, 0.556469, 0.723977, 0.227016, 0.13422, 0.240752, 0.161618, 0.588002, 0.139014, 0.279713, 0.162142, 0.258081, 0.16085, 0.943773, 0.043331, 0.587572, 0.712836, 0.581014, 0.711329, 0.570275, 0.713756, 0.562208, 0.717861, 0.556469, 0.723977, 0.168175, 0.024281, 0.562208, 0.717861, 0.557013, 0.724994, 0.556469, 0.723977, 0.54681, 0.109549, 0.542712, 0.115315, 0.55562, 0.124529, 0.556469, 0.723977, 0.576052, 0.713902, 0.570275, 0.713756, 0.581014, 0.711329, 0.567594, 0.717942, 0.585091, 0.712642, 0.565605, 0.723659, 0.549064, 0.742399, 0.565605, 0.723659, 0.299164, 0.15952, 0.602078, 0.109328, 0.576763, 0.717176, 0.593933, 0.716724, 0.576763, 0.717176, 0.799381, 0.278349, 0.527896, 0.097847, 0.269033, 0.105433, 0.461105, 0.11868, 0.802791, 0.142471, 0.802797, 0.145878, 0.803881, 0.139222, 0.941723, 0.056707, 1.06801, 0.055865, 1.01735, 0.047306, 0.077776, 0.701667, 0.15299, 0.133403, 0.15299, 0.133403, 0.279845, 0.124562, 0.262625, 0.141409, 0.15299, 0.133403, 0.15299, 0.133403, 0.329043, 0.157685, 0.683338, 0.079248, 0.583482, 0.075538, 0.594983, 0.105969, 0.174093, 0.079034, 0.57497, 0.06693, 0.200353, 0.068676, 0.227063, 0.096815, 0.255395, 0.075334, 0.806599, 0.133261, 0.421435, 0.089161, 0.323853, 0.063601, 0.367696, 0.126575, 0.844238, 0.074521, 0.879819, 0.056359, 0.926049, 0.050148, 1.01724, 0.043837, 0.335953, 0.207833, 0.140531, 0.283096, 0.631203, 0.202621, 0.827302, 0.112394, 0.122904, 0.680143, 0.149834, 0.663066, 0.134715, 0.680489, 0.15299, 0.133403, 0.84181, 0.119621, 0.854502, 0.118328, 0.19957, 0.107887, 0.583482, 0.075538, 0.30968, 0.127821, 0.374001, 0.068696, 0.378452, 0.05833, 0.293702, 0.163295, 0.298059, 0.151627, 0.293979, 0.160215, 0.581202, 0.722884, 0.254348, 0.178015, 0.293702, 0.163295, 0.30968, 0.127821, 0.265949, 0.058789, 0.806095, 0.140159, 0.242762, 0.12316, 0.19957, 0.107887, 0.141867, 0.050157, 0.374001, 0.068696, 0.412851, 0.58146, 1.01735, 0.047306, 1.01724, 0.043837, 0.974952, 0.059552, 1.02409, 0.065552, 0.183378, 0.048234, 0.624748, 0.139083, 0.626672, 0.124899, 0.302036, 0.077999, 0.299762, 0.118982, 0.30968, 0.127821, 0.162337, 0.217398, 0.253101, 0.191987, 0.233795, 0.045201, 0.122308, 0.686337, 0.11276, 0.680092, 0.104335, 0.684262, 0.856745, 0.105031, 0.293702, 0.163295, 0.19957, 0.107887, 0.598343, 0.158199, 0.664241, 0.010312, 0.323853, 0.063601, 0.453, 0.041334, 0.19957, 0.107887, 0.116268, 0.678662, 0.104316, 0.680542, 0.514165, 0.539766, 0.811047, 0.478988, 0.820749, 0.501819, 0.827465, 0.493558, 0.280576, 0.055641, 0.561204, 0.54545, 0.125118, 0.357392, 0.116134, 0.346834, 0.235409, 0.308839, 0.532601, 0.540243, 0.89914, 0.10256, 0.19957, 0.107887, 0.15299, 0.133403, 0.543404, 0.534159, 0.299762, 0.118982, 0.15299, 0.133403, 0.15299, 0.133403, 0.620374, 0.050145, 0.453, 0.041334, 0.946887, 0.676287, 0.933298, 0.655788, 0.282058, 0.208327, 0.295714, 0.182195, 0.578784, 0.144817, 0.299731, 0.039975, 0.59183, 0.533756, 0.505578, 0.528843, 0.513295, 0.510358, 0.046188, 0.658512, 0.039886, 0.648599, 0.670123, 0.539682, 0.664963, 0.519818, 0.661432, 0.540825, 0.561634, 0.520361, 0.532189, 0.51808, 0.52198, 0.51501, 0.453, 0.041334, 0.573483, 0.51721, 0.551873, 0.499973, 0.529935, 0.494412, 0.592689, 0.510696, 0.579811, 0.509031, 0.59183, 0.533756, 0.055116, 0.315046, 0.664241, 0.010312, 0.293979, 0.160215, 0.813072, 0.133559, 0.815189, 0.135958, 0.567347, 0.495024, 0.516315, 0.486485, 0.071878, 0.01364, 0.097793, 0.021957, 0.167196, 0.326689, 0.510952, 0.476166, 0.112325, 0.709796, 0.088026, 0.713037, 0.402925, 0.590307, 0.55524, 0.47456, 0.540104, 0.472773, 0.523541, 0.468458, 0.500896, 0.468342, 0.582373, 0.476961, 0.568263, 0.466474, 1.07188, 0.01364, 0.323853, 0.063601, 0.664241, 0.010312, 0.530382, 0.44977, 0.567171, 0.136891, 0.515086, 0.451203, 0.323853, 0.063601, 0.071878, 0.01364, 0.280936, 0.188545, 0.577548, 0.448532, 0.48984, 0.446433, 0.48984, 0.446433, 0.972707, 0.044154, 0.860238, 0.301529, 0.540401, 0.426736, 0.48984, 0.446433, 0.48984, 0.446433, 0.088484, 0.154127, 0.540401, 0.426736, 0.293979, 0.160215, 0.909049, 0.71841, 0.907843, 0.690345, 0.02879, 0.64355, 0.329198, 0.575584, 0.119716, 0.693151, 0.136676, 0.688811, 0.133192, 0.684931, 0.866137, 0.114912, 0.098467, 0.662997, 0.096134, 0.646057, 0.122904, 0.680143, 0.352991, 0.567853, 0.193076, 0.796404, 0.173085, 0.788406, 0.188253, 0.789713, 0.187139, 0.802055, 0.194623, 0.816729, 0.194623, 0.816729, 0.171268, 0.446907, 0.978968, 0.660943, 0.961242, 0.681929, 0.627727, 0.096335, 0.610021, 0.088011, 0.335799, 0.59929, 0.336348, 0.585677, 0.286463, 0.682304, 0.299518, 0.66982, 0.301774, 0.610443, 0.980379, 0.563743, 0.266825, 0.722535, 0.283885, 0.722094, 0.138575, 0.703544, 0.916841, 0.124754, 0.213436, 0.802021, 0.313437, 0.595891, 0.972886, 0.115507, 0.94671, 0.867863, 0.988333, 0.850462, 0.962039, 0.804956, 0.830366, 0.472972, 0.322183, 0.600967, 0.335799, 0.59929, 0.170461, 0.396325, 0.280147, 0.778934, 0.00938, 0.11583, 0.170788, 0.78591, 0.982035, 0.313568, 0.310882, 0.626174, 0.516509, 0.047321, 0.300536, 0.703651, 0.999435, 0.079295, 1.03606, 0.073201, 0.213645, 0.283692, 0.17073, 0.788452, 0.170788, 0.78591, 0.16208, 0.782016, 0.312642, 0.668884, 0.300697, 0.649684, 0.959747, 0.384297, 0.9601, 0.346875, 0.950023, 0.358365, 0.976453, 0.408701, 0.976701, 0.361487, 0.970088, 0.375188, 0.995343, 0.652886, 0.974475, 0.622036, 0.1124, 0.6766, 0.118567, 0.65072, 0.190579, 0.791249, 0.115077, 0.704749, 0.552114, 0.103315, 0.15558, 0.759524, 0.856745, 0.105031, 0.200183, 0.796835, 0.802398, 0.15212, 0.112325, 0.709796, 0.312642, 0.668884, 0.134918, 0.649787, 0.11276, 0.680092, 0.104316, 0.680542, 0.104335, 0.684262, 0.293868, 0.744419, 0.241231, 0.843515, 0.036062, 0.073201, 0.084884, 0.085435, 0.214422, 0.254858, 0.218412, 0.226048, 0.02409, 0.065552, 0.596655, 0.482983, 0.187139, 0.802055, 0.176924, 0.793669, 0.203828, 0.3219, 0.207179, 0.311644, 0.195564, 0.320287, 0.188253, 0.789713, 0.970088, 0.375188, 0.095537, 0.684484, 0.20009, 0.326192, 0.210951, 0.298952, 0.202258, 0.301477, 0.158504, 0.787581, 0.870645, 0.564694, 0.140957, 0.47756, 0.132652, 0.501298, 0.023506, 0.642735, 0.025732, 0.645861, 0.67031, 0.819667, 0.659777, 0.820916, 0.148612, 0.463368, 0.192139, 0.336293, 0.204116, 0.281579, 0.202258, 0.301477, 0.202258, 0.301477, 0.160997, 0.446959, 0.556469, 0.723977, 0.20703, 0.793311, 0.211405, 0.796869, 0.958364, 0.29752, 0.973389, 0.264212, 0.947722, 0.25985, 0.143813, 0.429572, 0.186548, 0.324108, 0.196064, 0.33963, 0.836094, 0.166817, 0.143277, 0.723113, 0.775358, 0.390064, 0.77471, 0.427453, 0.036681, 0.644746, 0.029052, 0.641703, 0.045618, 0.186832, 0.063914, 0.165898, 0.047667, 0.167591, 0.2029, 0.252782, 0.095154, 0.682663, 0.086024, 0.689182, 0.665429, 0.561032, 0.654198, 0.562117, 0.662472, 0.578573, 0.093317, 0.692709, 0.048747, 0.69317, 0.052154, 0.146598, 0.042434, 0.654514, 0.596794, 0.196439, 0.58748, 0.182469, 0.592139, 0.18614, 0.202258, 0.301477, 0.041571, 0.649031, 0.036681, 0.644746, 0.038253, 0.643937, 0.029052, 0.641703, 0.194486, 0.297456, 0.038253, 0.643937, 0.91746, 0.717574, 0.919482, 0.738639, 0.202258, 0.301477, 0.965868, 0.319608, 0.312642, 0.668884, 0.104636, 0.688127, 0.151579, 0.410454, 0.104208, 0.695859, 0.041571, 0.649031, 0.112652, 0.41646, 0.120203, 0.405864, 0.126814, 0.380853, 0.200183, 0.796835, 0.202258, 0.301477, 0.047021, 0.661795, 0.046188, 0.658512, 0.16208, 0.782016, 0.227872, 0.80186, 0.211405, 0.796869, 0.289778, 0.023484, 0.049201, 0.669911, 0.190579, 0.791249, 0.188253, 0.789713, 0.18304, 0.794221, 0.211405, 0.796869, 0.200183, 0.796835, 0.123364, 0.438512, 0.136067, 0.353089, 0.018218, 0.561999, 0.221594, 0.797911, 0.167576, 0.368656, 0.053475, 0.671628, 0.134934, 0.402423, 0.190579, 0.791249, 0.622504, 0.068386, 0.227872, 0.80186, 0.939761, 0.420397, 0.936033, 0.455449, 0.148653, 0.39075, 0.053475, 0.671628, 0.799379, 0.820443, 0.874642, 0.382177, 0.589744, 0.456006, 0.202196, 0.208584, 0.062847, 0.692232, 0.955174, 0.07793, 0.917378, 0.080721, 0.125658, 0.471496, 0.144521, 0.365209, 0.604112, 0.164309, 0.588877, 0.155717, 0.049261, 0.699708, 0.206237, 0.232961, 0.856745, 0.105031, 0.060935, 0.687426, 0.060935, 0.687426, 0.133611, 0.455829, 0.15577, 0.344993, 0.166482, 0.346725, 0.693968, 0.451578, 0.686322, 0.425581, 0.674872, 0.461602, 0.033548, 0.124262, 0.052744, 0.127586, 0.044751, 0.112458, 0.335799, 0.59929, 0.118281, 0.496586, 0.891699, 0.709721, 0.881456, 0.727759, 0.705039, 0.440815, 0.182344, 0.307356, 0.885094, 0.343508, 0.432147, 0.041836, 0.211405, 0.796869, 0.200183, 0.796835, 0.049261, 0.699708, 0.034357, 0.674749, 0.834396, 0.530368, 0.828816, 0.551761, 0.835775, 0.581527, 0.047121, 0.213019, 0.035444, 0.187217, 0.77021, 0.826375, 0.78448, 0.813528, 0.029052, 0.641703, 0.069212, 0.701355, 0.069212, 0.701355, 0.966093, 0.221264, 0.201498, 0.819603, 0.309708, 0.057781, 0.432147, 0.041836, 0.200627, 0.351552, 0.666099, 0.42614, 0.181541, 0.333148, 0.309708, 0.057781, 0.378452, 0.05833, 0.491624, 0.063113, 0.826747, 0.524271, 0.67616, 0.814193, 0.18304, 0.794221, 0.077776, 0.701667, 0.08121, 0.698659, 0.069212, 0.701355, 0.811946, 0.157754, 0.808083, 0.161458, 0.633604, 0.472522, 0.631844, 0.508453, 0.641329, 0.493127, 0.682283, 0.374742, 0.683835, 0.339085, 0.662221, 0.3596, 0.804499, 0.152889, 0.812042, 0.146459, 0.680597, 0.395579, 0.700241, 0.407986, 0.695384, 0.387101, 0.597802, 0.382122, 0.625982, 0.415248, 0.642757, 0.418794, 0.635152, 0.398528, 0.600626, 0.716376, 0.703564, 0.538933, 0.643611, 0.543403, 0.641676, 0.573107, 0.83948, 0.135764, 0.994296, 0.66, 0.971514, 0.687501, 0.995507, 0.657032, 0.837962, 0.125421, 0.835888, 0.128255, 0.850147, 0.648906, 0.848237, 0.684551, 0.854502, 0.118328, 0.852118, 0.15016, 0.843454, 0.161221, 0.856293, 0.162053, 0.853355, 0.120493, 0.855731, 0.131637, 0.860152, 0.118648, 0.853355, 0.120493, 0.860152, 0.118648, 0.837962, 0.125421, 0.857514, 0.119959, 0.853355, 0.120493, 0.868789, 0.136484, 0.866028, 0.15141, 0.866137, 0.114912, 0.876758, 0.11205, 0.895598, 0.714603, 0.853355, 0.120493, 0.873602, 0.113976, 0.873602, 0.113976, 0.881781, 0.110189, 0.888574, 0.113487, 0.853355, 0.120493, 0.891664, 0.106948, 0.857514, 0.119959, 0.891664, 0.106948, 0.884574, 0.110679, 0.876758, 0.11205, 0.616373, 0.381101, 0.116268, 0.678662, 0.881781, 0.110189, 0.89914, 0.10256, 0.628016, 0.43882, 0.639476, 0.449908, 1.00158, 0.657257, 1.01126, 0.644807, 0.895632, 0.13837, 0.90779, 0.131699, 0.885802, 0.147808, 0.906958, 0.111865, 0.757496, 0.237063, 0.797842, 0.25105, 0.745059, 0.209654, 0.638614, 0.889388, 0.653766, 0.899152, 0.673984, 0.885757, 0.765534, 0.847802, 0.747392, 0.861957, 0.762131, 0.877439, 0.679645, 0.303735, 0.720046, 0.406342, 0.846976, 0.621911, 0.843959, 0.570012, 0.845173, 0.54249, 0.842016, 0.522125, 0.911352, 0.100072, 0.637073, 0.606438, 0.645431, 0.59963, 0.850634, 0.603922, 0.851803, 0.56603, 0.795323, 0.458363, 0.815954, 0.467869, 0.834359, 0.492698, 0.921516, 0.095884, 0.921516, 0.095884, 0.911352, 0.100072, 0.651468, 0.437563, 0.673166, 0.521894, 0.682688, 0.517438, 0.675717, 0.50888, 0.859683, 0.612056, 0.857643, 0.548817, 0.847081, 0.513495, 0.923867, 0.093098, 0.898695, 0.09448, 0.859913, 0.643094, 0.854695, 0.53152, 0.911352, 0.100072, 0.925277, 0.096306, 0.866954, 0.657885, 0.865547, 0.590451, 0.802528, 0.44887, 0.943622, 0.090114, 0.943622, 0.090114, 0.184978, 0.350043, 0.697226, 0.488844, 0.870089, 0.688594, 0.872003, 0.641835, 0.929079, 0.691289, 0.937951, 0.697922, 0.929079, 0.691289, 0.914239, 0.686975, 0.91969, 0.688586, 0.919637, 0.688144, 0.919637, 0.688144, 0.907235, 0.686021, 0.914239, 0.686975, 0.877883, 0.683357, 0.149144, 0.326582, 0.602905, 0.054406, 0.556916, 0.04249, 0.950472, 0.090763, 0.88744, 0.707512, 0.825581, 0.774977, 0.458697, 0.965828, 0.405982, 0.935106, 0.323317, 0.980175, 0.978482, 0.099796, 0.92544, 0.12056, 0.602335, 0.41966, 0.61445, 0.405904, 0.935416, 0.690281, 0.919637, 0.688144, 0.926061, 0.68727, 0.882193, 0.705258, 0.901196, 0.699377, 0.876876, 0.599075, 0.896363, 0.689449, 0.953428, 0.107269, 0.978482, 0.099796, 0.978482, 0.099796, 0.961114, 0.101106, 0.960926, 0.090227, 0.95928, 0.094509, 0.623241, 0.178117, 0.624784, 0.172557, 0.618209, 0.159707, 0.946426, 0.699428, 0.851682, 0.762087, 0.968504, 0.089119, 0.602722, 0.149523, 0.938614, 0.694739, 0.926061, 0.68727, 0.935416, 0.690281, 0.893566, 0.717611, 0.895598, 0.714603, 0.889589, 0.698904, 0.979657, 0.685504, 0.112325, 0.709796, 0.98413, 0.085888, 0.946426, 0.699428, 0.893566, 0.717611, 0.633358, 0.554551, 0.630676, 0.571468, 0.787667, 0.349231, 0.953428, 0.107269, 0.990463, 0.100242, 0.949931, 0.700012, 0.938614, 0.694739, 0.900948, 0.719108, 0.606677, 0.494741, 0.614268, 0.508375, 0.622849, 0.479938, 0.134365, 0.765845, 0.116268, 0.678662, 0.020024, 0.473254, 0.005734, 0.471251, 0.00817, 0.496058, 0.146103, 0.314925, 0.991299, 0.089161, 0.031439, 0.646609, 0.959349, 0.708046, 0.955404, 0.702442, 0.949931, 0.700012, 0.906193, 0.73115, 0.906193, 0.73115, 0.678832, 0.488536, 0.753506, 0.488961, 0.768917, 0.479378, 0.073515, 0.724014, 0.067064, 0.723603, 0.073515, 0.724014, 0.62162, 0.528931, 0.625395, 0.51854, 0.590523, 0.711636, 1.00486, 0.086438, 0.906193, 0.73115, 0.919482, 0.738639, 0.9925, 0.439886, 1.00368, 0.4196, 0.989429, 0.412485, 0.178319, 0.806701, 0.771524, 0.465756, 0.973649, 0.101544, 0.990463, 0.100242, 0.587809, 0.114084, 0.960385, 0.703403, 0.950264, 0.705026, 0.58981, 0.402336, 0.771824, 0.871462, 0.781947, 0.903999, 0.795947, 0.915742, 1.02957, 0.097563, 0.629554, 0.194113, 1.00431, 0.390477, 1.01403, 0.366079, 0.996579, 0.371885, 1.00949, 0.347423, 0.835623, 0.168246, 0.766255, 0.27796, 1.00481, 0.101543, 0.990463, 0.100242, 0.973649, 0.101544, 1.03322, 0.084464, 0.003681, 0.4196, 0.014326, 0.411278, 0.004309, 0.390477, 0.009492, 0.347423, 0.024188, 0.338516, 1.02955, 0.088776, 0.708748, 0.376008, 0.018737, 0.388725, 0.014029, 0.366079, 0.648783, 0.164757, 0.703783, 0.116957, 0.029548, 0.088776, 0.033219, 0.084464, 0.004861, 0.086438, 0.869026, 0.742963, 0.874718, 0.725558, 0.69534, 0.595019, 0.69596, 0.567356, 0.686619, 0.5815, 0.850849, 0.743447, 0.026593, 0.360532, 0.009492, 0.347423, 0.617599, 0.444727, 0.004809, 0.101543, 0.035573, 0.103995, 0.02957, 0.097563, 0.676266, 0.579794, 0.676761, 0.608548, 0.009492, 0.347423, 0.600626, 0.716376, 0.612105, 0.727158, 0.606666, 0.723288, 0.89997, 0.795925, 0.758258, 0.523746, 0.057201, 0.089933, 0.724975, 0.513354, 0.739182, 0.320651, 0.775791, 0.323246, 0.018046, 0.436259, 0.027395, 0.381865, 0.90007, 0.837632, 0.704809, 0.312438, 0.724205, 0.267618, 0.671246, 0.264509, 0.757046, 0.399013, 0.657609, 0.452755, 0.99828, 0.634807, 0.99828, 0.634807, 0.981581, 0.619302, 0.025387, 0.501305, 0.028996, 0.416061, 0.718275, 0.345663, 0.05983, 0.104869, 1.00533, 0.660425, 0.029359, 0.456548, 0.033391, 0.431867, 0.036258, 0.380439, 0.037691, 0.337735, 0.04486, 0.272018, 0.024989, 0.252467, 0.012375, 0.662832, 0.00533, 0.660425, 0.001581, 0.657257, 0.639957, 0.328586, 0.003687, 0.532073, 0.026671, 0.528381, 0.026671, 0.528381, 0.038835, 0.310184, 0.050749, 0.258242, 0.757046, 0.399013, 0.076385, 0.099711, 0.506138, 0.033216, 0.01762, 0.650683, 0.001581, 0.657257, 0.01126, 0.644807, 1.00533, 0.660425, 0.988535, 0.66804, 0.99828, 0.634807, 1.00872, 0.619978, 0.991084, 0.604863, 0.018218, 0.561999, 0.026671, 0.528381, 0.033369, 0.476505, 0.042319, 0.415537, 0.045837, 0.348003, 0.757046, 0.399013, 0.073423, 0.127443, 1.00726, 0.601255, 0.901196, 0.699377, 0.046906, 0.398976, 0.045816, 0.373103, 0.642636, 0.295446, 0.049364, 0.839233, 0.089486, 0.855375, 0.556916, 0.04249, 0.435099, 0.011377, 0.021194, 0.640506, 0.01126, 0.644807, 0.01866, 0.646495, 0.021194, 0.640506, 0.023736, 0.641503, 0.012375, 0.662832, 0.99828, 0.634807, 0.060412, 0.233753, 0.066962, 0.213536, 0.053468, 0.207676, 0.060714, 0.197638, 0.664465, 0.601129, 0.654347, 0.60023, 0.096453, 0.106109, 0.289778, 0.023484, 0.506138, 0.033216, 0.435099, 0.011377, 0.023506, 0.642735, 1.01889, 0.649916, 0.99828, 0.634807, 0.042986, 0.461996, 0.6167, 0.537589, 0.358828, 0.029208, 0.506138, 0.033216, 0.289778, 0.023484, 0.358828, 0.029208, 0.516509, 0.047321, 0.021194, 0.640506, 0.023736, 0.641503, 0.021194, 0.640506, 1.02879, 0.64355, 0.99828, 0.634807, 0.99828, 0.634807, 0.044205, 0.484059, 0.00533, 0.660425, 0.012375, 0.662832, 0.00533, 0.660425, 0.670052, 0.623703, 0.023736, 0.641503, 0.919482, 0.738639, 0.934167, 0.720646, 0.927685, 0.72979, 0.066013, 0.347623, 0.066013, 0.347623, 0.07843, 0.257803, 0.07843, 0.257803, 0.710356, 0.550997, 0.705288, 0.578031, 0.607003, 0.52019, 0.623425, 0.300817, 0.803881, 0.139222, 0.664078, 0.24371, 0.596655, 0.482983, 0.611896, 0.474035, 0.596655, 0.482983, 0.630049, 0.749516, 0.596655, 0.482983, 0.604589, 0.448771, 0.685893, 0.559157, 0.60133, 0.704591, 0.609782, 0.72231, 0.706124, 0.886225, 0.688202, 0.898694, 0.704992, 0.900902, 0.775986, 0.850666, 0.79774, 0.903123, 0.645581, 0.514152, 0.650528, 0.526193, 0.659359, 0.528227, 0.642794, 0.215245, 0.724975, 0.513354, 0.703783, 0.116957, 0.772008, 0.141712, 0.753297, 0.114285, 0.609782, 0.72231, 0.61855, 0.73608, 0.615797, 0.577049, 0.887417, 0.700211, 0.126798, 0.709808, 0.907962, 0.688421, 0.919637, 0.688144, 0.926061, 0.68727, 0.294521, 0.92335, 0.674913, 0.414472, 0.603725, 0.723153, 0.61855, 0.73608, 0.61855, 0.73608, 0.631586, 0.747905, 0.630049, 0.749516, 0.612633, 0.244864, 0.60133, 0.704591, 0.606666, 0.723288, 0.603725, 0.723153, 0.358828, 0.029208, 0.099717, 0.040322, 0.169158, 0.037563, 0.099717, 0.040322, 0.183378, 0.048234, 0.042135, 0.045835, 0.099318, 0.044471, 0.036097, 0.78305, 0.064988, 0.798775, 0.085199, 0.035969, 0.724975, 0.513354, 0.149645, 0.026891, 0.085199, 0.035969, 0.036401, 0.050283, 0.042135, 0.045835, 0.872126, 0.715122, 0.896363, 0.689449, 0.435099, 0.011377, 0.149645, 0.026891, 0.004686, 0.067923, 0.036401, 0.050283, 0.699235, 0.179006, 0.614563, 0.275776, 0.638062, 0.642392, 0.724975, 0.513354, 0.652238, 0.798377, 0.055427, 0.035807, 0.60133, 0.704591, 0.593933, 0.716724, 0.002832, 0.050826, 1.00283, 0.050826, 0.985622, 0.071137, 0.897543, 0.239285, 0.885984, 0.222264, 0.875777, 0.251736, 0.79682, 0.933584, 0.585091, 0.712642, 0.623446, 0.737954, 0.97561, 0.157997, 0.111695, 0.017432, 1.03094, 0.036309, 0.989665, 0.056031, 0.76447, 0.170204, 0.659813, 0.507481, 0.615797, 0.577049, 0.953427, 0.106941, 0.923711, 0.132587, 0.93101, 0.191011, 0.966792, 0.180652, 0.638062, 0.642392, 0.907235, 0.686021, 0.843509, 0.758521, 0.825581, 0.774977, 0.727, 0.547638, 0.724975, 0.513354, 0.049595, 0.040977, 0.099318, 0.044471, 0.042135, 0.045835, 0.703783, 0.116957, 0.97071, 0.06558, 0.951128, 0.072098, 0.979578, 0.094491, 0.907235, 0.686021, 0.593933, 0.716724, 0.606666, 0.723288, 1.01658, 0.032978, 0.987627, 0.038759, 0.896736, 0.167236, 0.919482, 0.738639, 0.59183, 0.533756, 0.892834, 0.092903, 0.891287, 0.193656, 0.724975, 0.513354, 0.590523, 0.711636, 0.880862, 0.140269, 0.097793, 0.021957, 1.09779, 0.021957, 0.987627, 0.038759, 1.01658, 0.032978, 0.856695, 0.122915, 0.097793, 0.021957, 0.987627, 0.038759, 0.887592, 0.057636, 0.951128, 0.072098, 0.85853, 0.166133, 0.638062, 0.642392, 1.07188, 0.01364, 0.887592, 0.057636, 1.09779, 0.021957, 0.82018, 0.101697, 0.850254, 0.201661, 1.07188, 0.01364, 0.790623, 0.052471, 0.790623, 0.052471, 0.804069, 0.077567, 0.887592, 0.057636, 0.175397, 0.349057, 0.184978, 0.350043, 0.11657, 0.014938, 0.596655, 0.482983, 0.668712, 0.454262, 1.07188, 0.01364, 0.664241, 0.010312, 0.823165, 0.161549, 0.391424, 0.89835, 0.806704, 0.130963, 0.724975, 0.513354, 0.596655, 0.482983, 0.549806, 0.734572, 0.556469, 0.723977, 0.762649, 0.092933, 0.629028, 0.74731, 0.703783, 0.116957, 0.657107, 0.476111, 0.703783, 0.116957, 0.806761, 0.192364, 0.821005, 0.239997, 0.606666, 0.723288, 0.683346, 0.636964, 0.988535, 0.66804, 0.606666, 0.723288, 0.59183, 0.533756, 0.683338, 0.079248, 0.703783, 0.116957, 0.703783, 0.116957, 0.703783, 0.116957, 1.00949, 0.347423, 0.989416, 0.355045, 1.02499, 0.252467, 1.01147, 0.268946, 0.033959, 0.238319, 0.995745, 0.266127, 0.018029, 0.19862, 0.025964, 0.219256, 0.021948, 0.171316, 0.031183, 0.160104, 0.636955, 0.765084, 0.910518, 0.270061, 0.922722, 0.235041, 0.642624, 0.765942, 0.639565, 0.758937, 0.645875, 0.776913, 0.935637, 0.55327, 0.713167, 0.720785, 0.989429, 0.412485, 0.974916, 0.445198, 0.630329, 0.054428, 0.632119, 0.088287, 0.856293, 0.162053, 0.826747, 0.524271, 0.941195, 0.323584, 0.99542, 0.493585, 0.975025, 0.496743, 0.984217, 0.517544, 0.435099, 0.011377, 0.608073, 0.023049, 0.11657, 0.014938, 1.00573, 0.471251, 0.98807, 0.470242, 1.00817, 0.496058, 0.658348, 0.794582, 0.639565, 0.758937, 1.00369, 0.532073, 0.935842, 0.283224, 0.921829, 0.335552, 0.93676, 0.35032, 0.047121, 0.213019, 0.652167, 0.777993, 0.647478, 0.769306, 0.956185, 0.505968, 0.033548, 0.124262, 0.995591, 0.667928, 0.98977, 0.673538, 1.00288, 0.671076, 0.647478, 0.769306, 0.010452, 0.143942, 0.011673, 0.170098, 0.021522, 0.128048, 0.956946, 0.412, 0.00141, 0.188132, 0.01178, 0.212589, 0.940605, 0.111429, 0.976054, 0.104586, 0.924234, 0.301731, 0.924695, 0.386364, 0.985622, 0.071137, 0.938957, 0.385638, 0.911608, 0.524581, 0.975069, 0.592171, 0.662489, 0.795025, 0.757046, 0.399013, 0.96199, 0.441371, 0.924132, 0.496237, 0.880637, 0.285012, 0.922065, 0.464999, 0.989416, 0.355045, 0.989416, 0.355045, 0.629728, 0.046456, 0.617848, 0.046537, 0.989429, 0.412485, 0.015957, 0.099695, 0.035573, 0.103995, 0.004809, 0.101543, 0.905796, 0.485955, 1.01805, 0.436259, 0.999075, 0.553186, 1.01822, 0.561999, 0.963861, 0.651501, 1.00401, 0.577739, 0.951183, 0.641285, 0.950646, 0.606135, 0.941518, 0.631322, 0.989429, 0.412485, 0.954042, 0.460675, 0.897481, 0.440887, 0.608073, 0.023049, 0.630329, 0.054428, 0.629728, 0.046456, 1.01803, 0.19862, 0.940083, 0.067762, 0.919005, 0.557753, 0.75714, 0.788906, 0.74893, 0.545603, 0.972754, 0.475959, 0.701958, 0.689111, 0.697582, 0.665262, 0.904476, 0.318383, 0.880637, 0.285012, 0.725239, 0.747476, 0.724975, 0.513354, 0.931866, 0.582795, 0.696563, 0.635064, 0.11657, 0.014938, 0.725186, 0.731288, 0.716505, 0.705158, 0.711755, 0.683664, 0.713268, 0.668034, 0.713397, 0.651257, 0.738568, 0.744322, 0.731195, 0.708995, 0.895632, 0.13837, 0.959349, 0.708046, 0.005967, 0.645205, 0.01126, 0.644807, 0.732395, 0.724419, 0.79986, 0.503162, 0.988535, 0.66804, 0.72793, 0.687671, 0.709976, 0.639138, 0.130954, 0.297669, 0.748779, 0.766005, 0.709828, 0.601427, 0.631586, 0.747905, 0.802409, 0.957035, 0.827217, 0.958231, 0.74814, 0.751362, 0.750186, 0.721844, 0.723256, 0.639405, 0.732352, 0.671709, 0.728361, 0.660502, 0.719594, 0.613867, 0.632119, 0.088287, 1.00597, 0.645205, 0.760241, 0.769128, 0.766218, 0.765784, 0.757057, 0.745242, 0.747473, 0.711428, 0.749313, 0.690425, 0.742631, 0.687334, 0.880637, 0.285012, 0.779637, 0.777875, 0.749728, 0.672054, 0.556916, 0.04249, 0.602905, 0.054406, 0.435099, 0.011377, 0.786498, 0.783429, 0.748211, 0.659326, 0.743106, 0.646932, 0.733094, 0.633926, 0.721094, 0.581462, 0.91969, 0.688586, 0.718994, 0.565443, 0.767304, 0.734166, 0.75997, 0.703501, 0.729416, 0.608295, 0.760537, 0.716775, 0.744379, 0.629178, 0.73825, 0.610004, 0.777453, 0.756692, 0.435099, 0.011377, 0.77747, 0.741653, 0.76405, 0.689125, 0.737183, 0.571291, 0.758865, 0.639775, 0.608073, 0.023049, 0.77747, 0.741653, 0.782045, 0.728711, 0.78063, 0.72009, 0.773138, 0.709684, 0.794348, 0.766762, 0.751107, 0.59479, 0.794451, 0.752611, 0.77747, 0.741653, 0.778129, 0.685585, 0.771141, 0.662588, 0.815616, 0.772758, 0.794064, 0.735275, 0.77747, 0.741653, 0.77747, 0.741653, 0.76322, 0.615613, 0.746916, 0.572841, 0.77818, 0.648477, 0.97071, 0.06558, 0.821956, 0.760359, 0.79464, 0.715753, 0.758205, 0.563911, 0.794436, 0.696419, 0.766738, 0.585215, 0.779036, 0.630199, 0.047121, 0.213019, 0.819707, 0.754773, 0.816289, 0.729646, 0.791474, 0.672181, 0.776646, 0.599315, 0.047121, 0.213019, 0.875523, 0.781116, 0.817388, 0.741088, 0.810648, 0.717953, 0.793574, 0.65006, 0.880637, 0.285012, 0.80703, 0.68878, 0.812763, 0.693944, 0.801077, 0.671564, 0.774236, 0.572607, 0.613138, 0.014326, 0.007629, 0.647333, 0.794125, 0.627536, 0.786862, 0.603563, 1.00715, 0.652126, 0.793712, 0.567205, 0.777095, 0.548144, 0.824388, 0.698811, 0.810202, 0.664025, 0.955359, 0.706424, 0.807418, 0.161484, 0.819898, 0.167839, 0.82034, 0.165399, 0.800315, 0.612455, 0.859235, 0.792534, 0.91969, 0.688586, 0.633473, 0.202807, 0.632047, 0.203615, 0.630391, 0.189706, 0.630597, 0.190493, 0.848341, 0.733997, 0.84102, 0.73176, 0.811522, 0.640052, 0.8018, 0.580467, 0.8018, 0.580467, 0.79241, 0.54454, 1.01822, 0.561999, 1.00327, 0.659533, 0.1247, 0.856831, 0.630597, 0.190493, 0.989429, 0.412485, 0.840324, 0.713163, 0.820603, 0.646223, 0.989416, 0.355045, 0.025732, 0.645861, 0.556537, 0.851077, 0.811952, 0.595195, 0.8018, 0.580467, 0.880637, 0.285012, 0.719877, 0.915687, 0.769298, 0.915961, 0.741277, 0.895481, 0.630597, 0.190493, 0.630391, 0.189706, 0.832199, 0.660014, 0.816776, 0.617856, 0.796944, 0.526641, 0.624451, 0.163582, 0.047121, 0.213019, 0.078, 0.70373, 0.080254, 0.697086, 0.069212, 0.701355, 0.810095, 0.556297, 0.8018, 0.580467, 0.970088, 0.375188, 0.855728, 0.716065, 0.827872, 0.608196, 0.8018, 0.580467, 0.049201, 0.669911, 0.043448, 0.668548, 0.624717, 0.172151, 0.624451, 0.163582, 0.624717, 0.172151, 0.99828, 0.634807, 0.007629, 0.647333, 0.823725, 0.574143, 0.819394, 0.553397, 0.81274, 0.525431, 0.970088, 0.375188, 0.080254, 0.697086, 0.077776, 0.701667, 0.069212, 0.701355, 0.080254, 0.697086, 0.757046, 0.399013, 0.855728, 0.716065, 0.624748, 0.139083, 0.624451, 0.163582, 0.624717, 0.172151, 0.19335, 0.347014, 0.119492, 0.62663, 0.871196, 0.708395, 0.919482, 0.738639, 0.960385, 0.703403, 0.626672, 0.124899, 0.624748, 0.139083, 0.624322, 0.156359, 1.00949, 0.347423, 0.989416, 0.355045, 0.826747, 0.524271, 0.11657, 0.014938, 0.826747, 0.524271, 0.826747, 0.524271, 0.989429, 0.412485, 0.605395, 0.930733, 0.490951, 0.929371, 0.470288, 0.933879, 0.445205, 0.916829, 0.404505, 0.931307, 0.470288, 0.933879, 0.355706, 0.920785, 0.401328, 0.906103, 0.340654, 0.898045, 0.743138, 0.939571, 0.755707, 0.947476, 0.230813, 0.854084, 0.200525, 0.817402, 0.589531, 0.831982, 0.783925, 0.977198, 0.595052, 0.983717, 0.648371, 0.991108, 0.678707, 0.976344, 0.762486, 0.967917, 0.573745, 0.845104, 0.783925, 0.977198, 0.185511, 0.843185, 0.950803, 0.957531, 0.812503, 0.818692, 0.351777, 0.90963, 0.301291, 0.913966, 0.459968, 0.938088, 0.272305, 0.882818, 0.300461, 0.897736, 0.591967, 0.919102, 0.623827, 0.898226, 0.60166, 0.903096, 0.525613, 0.917599, 0.589169, 0.944215, 0.118688, 0.698703, 0.895632, 0.13837, 0.185511, 0.843185, 0.895632, 0.13837, 0.895632, 0.13837, 0.768676, 0.841974, 0.634386, 0.874228, 0.810161, 0.876291, 0.843149, 0.846516, 0.536996, 0.960368, 0.241231, 0.843515, 0.536996, 0.960368, 0.26122, 0.898229, 0.783925, 0.977198, 0.648371, 0.991108, 0.827217, 0.958231, 0.163222, 0.335675, 0.150155, 0.315869, 0.043096, 0.645772, 0.030942, 0.036309, 0.429379, 0.902559, 0.648371, 0.991108, 1.32332, 0.980175, 0.827217, 0.958231, 0.730239, 0.929684, 0.143488, 0.303203, 0.64032, 0.861076, 0.606639, 0.888072, 0.476031, 0.94673, 0.549546, 0.905942, 0.152243, 0.315578, 0.162004, 0.326813, 0.762131, 0.877439, 0.762568, 0.858373, 0.026671, 0.528381, 0.157936, 0.32763, 0.765534, 0.847802, 0.762568, 0.858373, 0.724441, 0.868513, 0.753243, 0.827693, 0.162077, 0.33245, 0.800423, 0.839553, 0.950803, 0.957531, 0.173216, 0.340284, 0.808472, 0.822547, 0.056413, 0.691275, 0.062847, 0.692232, 0.173796, 0.332325, 0.157936, 0.32763, 0.169983, 0.34154, 0.162077, 0.33245, 0.169983, 0.34154, 0.249853, 0.901737, 1.32332, 0.980175, 1.06274, 0.923624, 0.950803, 0.957531, 0.295488, 0.017621, 0.598923, 0.871096, 0.542712, 0.115315, 0.814157, 0.807503, 0.171052, 0.342644, 0.171052, 0.342644, 0.183125, 0.348903, 0.187275, 0.344827, 0.476031, 0.94673, 0.450445, 0.944551, 0.214437, 0.359093, 0.218521, 0.355416, 0.494586, 0.968206, 0.648371, 0.991108, 0.595052, 0.983717, 0.184804, 0.353152, 0.58335, 0.884573, 0.183125, 0.348903, 0.187275, 0.344827, 0.18664, 0.862368, 0.79774, 0.903123, 0.083415, 0.53318, 1.06416, 0.879915, 0.175397, 0.349057, 0.026671, 0.528381, 0.036329, 0.561774, 0.323317, 0.980175, 0.062745, 0.923624, 0.163222, 0.335675, 0.108502, 0.519861, 0.184978, 0.350043, 0.184804, 0.353152, 0.175397, 0.349057, 0.222115, 0.87603, 0.762486, 0.967917, 0.678707, 0.976344, 0.595052, 0.983717, 0.052676, 0.564473, 0.063712, 0.554819, 0.07285, 0.558101, 0.200365, 0.357432, 0.184804, 0.353152, 0.185511, 0.843185, 0.200365, 0.357432, 0.522979, 0.965508, 0.476031, 0.94673, 0.083691, 0.558146, 0.018218, 0.561999, 0.103277, 0.558226, 0.1105, 0.540358, 0.203349, 0.357383, 0.033927, 0.593303, 0.056285, 0.583564, 0.085933, 0.575928, 0.123864, 0.529395, 0.023157, 0.621248, 0.008715, 0.619978, 0.003269, 0.659533, 0.018762, 0.661392, 0.071134, 0.58837, 0.203349, 0.357383, 0.214437, 0.359093, 0.214437, 0.359093, 0.628377, 0.211951, 0.536996, 0.960368, 0.678707, 0.976344, 0.63641, 0.961362, 0.002879, 0.671076, 0.043897, 0.620553, 0.062248, 0.609842, 0.07958, 0.599422, 0.12345, 0.561574, 0.522979, 0.965508, 0.595052, 0.983717, 0.494586, 0.968206, 0.595052, 0.983717, 0.022812, 0.680384, 0.091277, 0.596219, 0.132476, 0.546114, 0.139737, 0.534593, 0.039446, 0.677351, 0.111112, 0.58564, 0.628904, 0.95029, 0.062847, 0.692232, 0.078, 0.70373, 0.979657, 0.685504, 0.983388, 0.693154, 1.00936, 0.699202, 0.009361, 0.699202, 0.073102, 0.631794, 0.140565, 0.569253, 0.05921, 0.705294, 0.060965, 0.645596, 0.087438, 0.623792, 0.476031, 0.94673, 0.476031, 0.94673, 0.106212, 0.610624, 0.128212, 0.596923, 0.743138, 0.939571, 0.998174, 0.71922, 0.049363, 0.720505, 0.119492, 0.62663, 0.119492, 0.62663, 0.144878, 0.617878, 0.157372, 0.585863, 0.961015, 0.71501, 0.648371, 0.991108, 0.934853, 0.702771, 0.119492, 0.62663, 0.921696, 0.712627, 0.957103, 0.724494, 1.0408, 0.744132, 0.040803, 0.744132, 0.100579, 0.708994, 0.895632, 0.13837, 0.99182, 0.746754, 0.087885, 0.734348, 0.119492, 0.62663, 0.119492, 0.62663, 0.157717, 0.632466, 0.950209, 0.739406, 1.00775, 0.767671, 1.03242, 0.761842, 0.11452, 0.724147, 0.126729, 0.709076, 0.917625, 0.734077, 0.979516, 0.763505, 0.827217, 0.958231, 1.32332, 0.980175, 0.932548, 0.742082, 0.932548, 0.742082, 0.953973, 0.749319, 0.165715, 0.642987, 0.026671, 0.528381, 0.018218, 0.561999, 0.909732, 0.745909, 0.932548, 0.742082, 0.919495, 0.746898, 0.932548, 0.742082, 0.954283, 0.757036, 0.932548, 0.742082, 0.932548, 0.742082, 0.895526, 0.753629, 0.007749, 0.767671, 0.032416, 0.761842, 0.104398, 0.772376, 0.114213, 0.748985, 0.241231, 0.843515, 0.241231, 0.843515, 0.89348, 0.760496, 0.915973, 0.761373, 0.955559, 0.780145, 0.170132, 0.924823, 0.900581, 0.759255, 0.476031, 0.94673, 0.765534, 0.847802, 0.762131, 0.877439, 0.762568, 0.858373, 0.458697, 0.965828, 0.241231, 0.843515, 0.185511, 0.843185, 0.073479, 0.670036, 1.0361, 0.78305, 0.999096, 0.786799, 0.076274, 0.750341, 0.185511, 0.843185, 0.185511, 0.843185, 0.185511, 0.843185, 0.212266, 0.878924, 0.249853, 0.901737, 0.405982, 0.935106, 0.404505, 0.931307, 0.404505, 0.931307, 0.324523, 0.927133, 0.294521, 0.92335, 0.651197, 0.913787, 0.628904, 0.95029, 0.646499, 0.93819, 0.649063, 0.923767, 0.647222, 0.928129, 0.294521, 0.92335, 0.324523, 0.927133, 0.605395, 0.930733, 0.719877, 0.915687, 0.98913, 0.812116, 1.04936, 0.839233, 0.324523, 0.927133
-};
-
-float mNormals[] = {
--0.8591, 0.1179, 0.4981, -0.8981, -0.0312, 0.4386, -0.8569, -0.1331, 0.498, -0.9786, -0.2004, 0.0476, -0.9158, -0.3128, 0.2518, -0.9576, 0.2513, 0.1407, -0.1062, 0.9663, -0.2345, -0.0604, 0.922, -0.3824, -0.2333, 0.8754, -0.4233, 0.1592, 0.8692, -0.4681, 0.353, 0.851, -0.3888, 0.5087, 0.7224, -0.4684, 0.1381, 0.8589, -0.4932, -0.2069, 0.7645, -0.6105, -0.631, 0.4884, -0.6027, -0.1864, 0.7097, -0.6794, -0.5499, 0.7613, -0.3435, -0.0823, 0.9934, -0.0793, -0.168, 0.9834, -0.0687, -0.09, 0.9778, -0.1893, 0.5003, 0.8445, -0.1912, 0.7005, 0.5883, -0.4039, 0.7596, 0.6273, -0.1721, -0.8383, -0.5452, 0.0007, -0.8123, -0.5721, -0.1136, -0.9217, -0.3805, 0.0755, 0.3638, -0.8976, 0.2489, -0.011, -0.911, 0.4122, 0.6264, -0.7513, 0.2078, -0.9116, -0.4059, -0.0656, -0.9961, -0.0662, -0.0582, -0.9864, -0.1471, 0.0737, 0.7408, 0.6041, -0.2937, 0.6409, 0.5986, -0.4806, 0.8394, 0.3094, -0.4468, -0.5402, 0.8415, -0.0065, -0.6169, 0.7563, 0.2179, -0.4168, 0.8526, -0.3151, -0.2065, 0.952, -0.226, -0.7674, -0.6319, 0.1082, -0.8632, -0.46, 0.208, 0.2797, 0.8973, -0.3414, -0.0989, 0.9206, -0.3778, 0.2955, 0.8624, -0.4111, 0.7933, 0.5455, -0.2704, 0.7571, 0.5506, -0.3517, 0.8427, 0.4497, -0.296, 0.7552, 0.5495, -0.3573, 0.6511, 0.7074, -0.2752, 0.8493, 0.4947, -0.1843, -0.3192, 0.2707, 0.9082, -0.7886, -0.1536, 0.5954, -0.2131, -0.8617, 0.4606, 0.4925, 0.8302, -0.2613, 0.2533, 0.9173, -0.3073, 0.6878, 0.6915, -0.2207, 0.5064, 0.8192, -0.2692, 0.3452, 0.7805, -0.5211, 0.1754, 0.8461, -0.5033, 0.6205, 0.6744, -0.4002, -0.1663, 0.8859, -0.4331, -0.4596, 0.4398, 0.7716, -0.1635, 0.1838, 0.9693, -0.1501, 0.207, 0.9668, -0.3159, 0.9009, -0.2977, -0.3204, 0.8832, -0.3424, -0.3271, 0.8159, -0.4768, -0.9329, 0.3598, -0.013, -0.9588, 0.2607, -0.113, -0.9207, 0.3821, 0.079, -0.179, 0.931, 0.3182, -0.2114, 0.9662, 0.1474, -0.1368, 0.9809, 0.1383, -0.7593, -0.5592, 0.3328, -0.8095, 0.3145, 0.4958, -0.7767, -0.0386, 0.6287, -0.9026, -0.4268, 0.0556, -0.996, -0.0343, 0.0829, -0.9838, -0.1068, -0.1443, -0.8702, -0.4254, -0.2484, -0.9454, -0.2717, -0.1798, -0.2049, 0.9781, 0.038, -0.1358, 0.9904, 0.0254, -0.307, 0.9124, 0.2709, -0.1824, 0.648, 0.7395, -0.3706, 0.8666, 0.3341, -0.2305, 0.9664, 0.1141, -0.2069, 0.9781, 0.0221, -0.0786, 0.9961, 0.0388, -0.3989, 0.3694, 0.8393, -0.3637, -0.0111, 0.9315, -0.1785, 0.0581, 0.9822, -0.9781, 0.2007, 0.0555, -0.9511, 0.3085, 0.0144, -0.0843, 0.9388, 0.3341, -0.6741, 0.6506, -0.3497, -0.4865, 0.7436, -0.4588, -0.4813, 0.8258, -0.2938, 0.0813, 0.6525, -0.7534, 0.2466, 0.5664, -0.7864, 0.1354, 0.7896, -0.5985, -0.2819, 0.9586, -0.0407, -0.1798, 0.9706, -0.1601, -0.9853, 0.1583, 0.065, -0.9713, 0.1568, 0.1791, -0.0442, 0.9989, 0.0129, -0.1983, 0.895, -0.3996, -0.2955, 0.9381, -0.1805, -0.3092, 0.9254, -0.2193, -0.3661, 0.8602, -0.355, -0.0308, 0.9646, 0.2618, 0.0116, 0.993, 0.1172, -0.8163, -0.5593, -0.1445, -0.8368, -0.5466, -0.0311, 0.6026, 0.6997, -0.3839, 0.6205, 0.6744, -0.4002, 0.7571, 0.5506, -0.3517, 0.8885, 0.4461, -0.1076, 0.7571, 0.5506, -0.3517, 0.6205, 0.6744, -0.4002, 0.8427, 0.4497, -0.296, -0.8754, 0.224, 0.4284, -0.8739, 0.3985, 0.2784, -0.7892, 0.2913, 0.5406, 0.0712, 0.9464, 0.3149, 0.1036, 0.568, 0.8165, 0.2861, 0.5235, 0.8026, 0.2956, 0.7382, 0.6064, 0.465, 0.8165, -0.3421, -0.1757, 0.8897, -0.4214, -0.2537, 0.8675, -0.4279, -0.647, 0.6967, -0.3098, -0.3252, 0.9402, -0.1012, -0.0019, 0.9339, -0.3575, -0.1174, 0.9185, -0.3775, -0.0236, 0.8385, -0.5444, -0.9735, -0.0353, 0.226, -0.9992, 0.0098, 0.0378, -0.9669, 0.1547, 0.203, -0.5212, 0.7764, -0.3543, -0.6789, -0.7316, 0.0614, -0.6809, -0.7317, -0.0305, -0.7818, -0.5833, 0.2204, -0.1462, 0.8347, -0.5309, -0.0747, 0.7727, -0.6304, 0.562, 0.3632, -0.7431, 0.238, 0.4916, -0.8376, 0.5976, 0.5841, -0.5492, 0.3452, 0.7805, -0.5211, 0.6205, 0.6744, -0.4002, -0.8856, -0.4182, -0.202, -0.9762, -0.1402, -0.1654, -0.9553, -0.2954, -0.0128, -0.3887, -0.2336, -0.8913, -0.175, -0.017, -0.9844, -0.4181, 0.1724, -0.8919, 0.0409, 0.3029, -0.9521, -0.2779, 0.454, -0.8465, -0.3551, 0.8845, 0.3026, -0.1962, 0.9391, -0.2821, 0.2008, 0.9125, -0.3563, -0.3185, 0.7666, -0.5576, -0.3076, 0.8335, -0.459, 0.238, 0.4916, -0.8376, 0.0372, 0.5199, -0.8534, -0.1937, 0.7036, -0.6837, 0.34, 0.9363, -0.0879, -0.8177, -0.5716, -0.0684, -0.4162, -0.2535, -0.8732, -0.1883, 0.5859, -0.7882, -0.234, 0.6918, -0.6831, -0.4343, 0.5637, -0.7026, 0.2446, 0.944, -0.2213, 0.3192, 0.7964, -0.5137, -0.4687, 0.7804, -0.4138, -0.5197, 0.4988, -0.6936, -0.5978, 0.2013, -0.776, -0.3801, 0.5059, -0.7743, -0.928, 0.3141, 0.2004, 0.0684, -0.5525, 0.8307, -0.0094, -0.4414, 0.8973, 0.1004, -0.5191, 0.8488, 0.1324, 0.092, 0.9869, -0.1284, 0.0747, 0.9889, -0.0185, 0.1077, 0.994, -0.3611, 0.8286, -0.4278, 0.0737, 0.9814, -0.1774, 0.27, 0.8077, -0.5242, -0.014, 0.0433, -0.999, 0.0251, 0.5128, -0.8581, 0.9192, 0.2293, 0.3202, 0.8271, 0.2935, 0.4793, 0.8584, 0.3051, 0.4123, -0.9146, -0.367, 0.1698, -0.9481, -0.316, -0.0367, -0.2099, 0.9638, 0.1642, -0.2384, 0.9711, 0.0116, -0.9848, 0.0238, 0.1718, -0.995, -0.0574, 0.0823, 0.6205, 0.6744, -0.4002, 0.8529, 0.4785, -0.2086, 0.1326, 0.9908, 0.0269, 0.0605, 0.9937, -0.0944, 0.0704, 0.6262, -0.7765, -0.6434, 0.5378, -0.5448, -0.9387, 0.3006, -0.169, -0.8402, 0.0275, -0.5415, 0.2008, 0.9125, -0.3563, 0.1614, 0.9756, 0.1486, -0.4239, -0.3606, -0.8308, -0.1874, -0.103, -0.9769, 0.3575, 0.2705, -0.8939, 0.2552, 0.3981, -0.8811, 0.0217, 0.2504, 0.9679, 0.0587, 0.4726, 0.8793, 0.1514, 0.2277, 0.9619, 0.5278, -0.7979, -0.2911, 0.4852, -0.8744, -0.0041, 0.5599, -0.7282, -0.3954, -0.9285, 0.0783, 0.3629, -0.9097, 0.2803, 0.3064, -0.8585, 0.3645, 0.3607, 0.1025, -0.0037, 0.9947, 0.0386, -0.2871, 0.9571, 0.0129, -0.1455, 0.9893, -0.5634, 0.2723, 0.78, -0.3057, -0.0814, 0.9486, -0.0707, -0.2992, -0.9516, -0.1322, 0.8004, -0.5847, 0.0209, 0.7333, -0.6796, -0.7964, 0.2048, 0.569, -0.8749, 0.1005, 0.4737, -0.956, -0.1533, 0.25, 0.3012, 0.1139, 0.9467, 0.2477, -0.1742, 0.953, 0.4771, 0.1924, 0.8575, 0.216, 0.0831, -0.9728, 0.2354, 0.511, -0.8267, -0.1953, -0.642, -0.7414, 0.0765, -0.5684, -0.8192, 0.3955, -0.0816, 0.9148, 0.9294, 0.2665, 0.2553, 0.8701, -0.176, 0.4604, -0.9472, 0.0142, 0.3202, -0.2824, -0.2497, 0.9262, -0.2045, -0.4133, 0.8873, -0.0704, -0.5398, 0.8389, 0.9139, 0.2986, 0.275, 0.8743, 0.4388, 0.2076, 0.9366, 0.3311, 0.1149, 0.562, -0.3578, 0.7458, 0.6762, -0.4239, 0.6026, 0.6175, -0.5915, 0.5185, -0.1803, -0.3941, 0.9012, 0.452, -0.8477, 0.2778, 0.8211, -0.5469, 0.1635, 0.9335, -0.3323, 0.1345, 0.1928, 0.3151, -0.9293, 0.1899, 0.4654, -0.8645, 0.0872, 0.5021, -0.8604, 0.4576, -0.5738, 0.6792, 0.8757, 0.4808, 0.0454, 0.9311, 0.3638, -0.0278, 0.7555, -0.2516, 0.6049, 0.6672, 0.285, 0.6882, 0.8494, 0.2118, 0.4833, 0.6906, 0.3742, 0.6189, -0.2604, 0.9602, -0.1013, 0.0166, 0.9787, -0.2046, -0.2704, 0.1739, -0.9469, -0.3638, 0.3213, -0.8743, -0.533, 0.1974, -0.8228, 0.2495, -0.2894, -0.9241, 0.2075, -0.2056, -0.9564, 0.1393, -0.496, -0.8571, 0.1055, -0.213, -0.9713, 0.3867, 0.4918, -0.7801, 0.5601, -0.8277, -0.0352, 0.4584, -0.8875, 0.0464, 0.5379, -0.8259, 0.1691, 0.8052, -0.0761, 0.5881, 0.8699, -0.2917, 0.3976, 0.9605, 0.0314, 0.2766, 0.9811, 0.0468, 0.1879, 0.9925, 0.0546, 0.1097, -0.6664, 0.5819, 0.4661, -0.5688, 0.8053, -0.167, -0.839, 0.5283, -0.1304, -0.9213, 0.2281, 0.3148, -0.8585, -0.0894, 0.5049, -0.8551, 0.2941, 0.427, -0.7069, -0.7068, 0.0273, -0.6854, -0.6979, 0.2076, -0.6827, -0.694, 0.2287, -0.2003, 0.2385, -0.9503, -0.2219, 0.3225, -0.9202, -0.2762, 0.0015, -0.9611, 0.1104, -0.2923, -0.9499, 0.0331, 0.1579, -0.9869, 0.1022, 0.2307, -0.9676, 0.0411, 0.409, -0.9116, 0.2464, 0.4109, -0.8777, 0.3475, 0.4804, -0.8053, 0.2546, 0.5935, -0.7635, 0.3154, -0.3268, -0.8909, 0.0699, -0.1651, -0.9838, 0.1021, -0.4423, -0.891, 0.5643, 0.3646, -0.7407, 0.4672, 0.1933, -0.8628, 0.9286, 0.3569, 0.1017, 0.9917, 0.1264, -0.0234, -0.9635, 0.2659, -0.0307, -0.9637, 0.2456, -0.1047, -0.927, 0.3638, -0.0907, -0.8309, -0.0213, 0.556, -0.7882, 0.0687, 0.6116, -0.0016, 0.9132, 0.4075, 0.0461, 0.8529, -0.5201, -0.2161, 0.3598, -0.9077, 0.8368, -0.5142, 0.188, 0.8151, -0.5387, 0.2129, 0.9584, -0.263, 0.1112, 0.0623, -0.4442, -0.8938, -0.0743, -0.7323, -0.6769, -0.0366, -0.4936, -0.8689, 0.0747, 0.5899, -0.804, 0.0595, 0.7327, -0.678, 0.0842, 0.6085, -0.7891, 0.9745, -0.1789, 0.1356, 0.6993, -0.7137, -0.0413, 0.8318, -0.3919, -0.3931, -0.982, 0.152, -0.1123, -0.0216, -0.5722, 0.8198, -0.1032, -0.5868, 0.8031, 0.2566, -0.8465, 0.4665, 0.9766, 0.209, -0.0514, 0.9778, 0.2005, 0.0615, 0.9961, 0.0873, 0.0105, -0.2274, 0.9312, 0.2848, -0.9188, -0.3912, 0.0526, 0.2732, 0.9197, 0.2819, 0.0239, -0.9977, -0.0641, 0.0576, -0.9155, 0.3981, 0.0211, -0.998, -0.0603, 0.3093, -0.4047, -0.8605, 0.2166, -0.3263, -0.9201, 0.1612, -0.6892, -0.7064, 0.1702, 0.0444, -0.9844, 0.9907, -0.0435, 0.129, 0.947, 0.1936, 0.2563, 0.9341, 0.3303, 0.1351, 0.7773, -0.46, 0.4291, 0.7768, -0.5716, 0.2642, 0.4306, -0.6497, 0.6264, 0.958, -0.2859, -0.0217, -0.3134, 0.1311, -0.9405, -0.4408, 0.0244, -0.8973, -0.3287, 0.1767, -0.9278, 0.2108, 0.5905, -0.779, 0.3798, 0.5865, -0.7154, 0.0751, 0.6415, -0.7635, 0.1316, 0.2026, -0.9704, 0.2269, 0.3863, -0.894, 0.2393, -0.1438, -0.9602, 0.1831, -0.2438, -0.9524, 0.6471, 0.2797, -0.7092, 0.3034, 0.5943, -0.7448, 0.9627, -0.0269, 0.2694, 0.9742, 0.0388, 0.2223, 0.8865, -0.1057, 0.4504, 0.214, 0.9437, -0.2524, 0.3299, 0.9399, 0.0885, 0.4606, 0.8872, 0.0286, 0.4545, 0.8788, 0.1451, -0.2658, -0.3667, -0.8916, -0.2532, -0.1876, -0.9491, -0.4653, -0.3213, -0.8248, -0.4735, -0.1141, -0.8734, -0.2362, 0.2649, -0.9349, 0.9084, -0.0503, 0.4151, 0.9298, 0.0651, 0.3621, -0.0571, -0.2357, -0.9701, -0.0619, -0.3984, -0.9151, -0.0652, -0.3113, -0.9481, -0.101, 0.5361, -0.8381, -0.1354, 0.7183, -0.6824, 0.0993, 0.643, -0.7594, 0.1587, -0.0896, -0.9833, 0.2232, -0.0768, -0.9717, 0.1661, 0.0277, -0.9857, 0.5147, 0.2804, -0.8102, 0.5334, 0.2799, -0.7982, 0.3595, 0.5572, -0.7485, -0.0817, -0.286, -0.9547, -0.2374, -0.1598, -0.9582, 0.7497, -0.2098, -0.6276, 0.7629, -0.2686, -0.588, 0.6989, -0.0714, -0.7116, -0.6885, -0.6779, -0.2577, -0.7874, -0.4523, -0.4189, 0.8699, 0.3737, -0.3219, 0.8471, 0.5198, -0.1104, 0.8334, 0.4824, -0.2695, -0.5088, -0.1622, 0.8454, -0.435, -0.1719, 0.8839, -0.5387, -0.3528, 0.7651, -0.056, -0.2537, -0.9657, -0.184, 0.0867, -0.9791, -0.0657, 0.3097, -0.9486, 0.1075, -0.1141, -0.9876, 0.3722, -0.5006, -0.7816, 0.4972, -0.3232, -0.8052, -0.3294, -0.4313, 0.8399, -0.5176, -0.34, 0.7852, -0.3054, -0.6193, 0.7233, -0.1624, 0.0342, -0.9861, 0.8924, -0.4, 0.2089, 0.7706, 0.5744, -0.276, 0.7282, 0.4918, -0.4774, 0.815, 0.4199, -0.3992, -0.0949, 0.3093, -0.9462, -0.0585, 0.4421, -0.8951, 0.0554, 0.1421, -0.9883, -0.0293, -0.3112, -0.9499, -0.1459, -0.0353, -0.9887, 0.0226, -0.1243, -0.992, 0.4834, 0.2964, 0.8237, 0.6379, 0.0605, 0.7677, -0.9765, -0.1604, -0.1439, -0.9847, -0.0708, -0.1593, -0.951, 0.252, 0.1793, -0.322, 0.6895, -0.6487, 0.3375, -0.661, 0.6702, 0.2142, -0.8084, 0.5483, 0.4878, -0.7803, 0.3915, -0.2839, -0.8107, 0.512, -0.2959, -0.874, 0.3854, -0.3288, -0.9003, 0.2853, -0.1623, -0.3235, -0.9322, -0.19, -0.2031, -0.9605, 0.0177, -0.1243, -0.9921, -0.0087, 0.1154, -0.9933, -0.1493, 0.7054, -0.6929, 0.9298, 0.0651, 0.3621, -0.0069, 0.5077, -0.8615, 0.3058, 0.1507, -0.9401, -0.7491, -0.2579, 0.6102, -0.701, -0.1377, 0.6998, -0.9109, -0.0761, 0.4055, -0.123, -0.1153, -0.9857, 0.0709, 0.2616, -0.9626, 0.3039, -0.1274, -0.9442, 0.1292, -0.1909, -0.9731, 0.004, 0.1159, -0.9933, -0.8752, -0.3487, 0.3352, -0.9788, -0.0116, 0.2044, -0.6686, -0.7206, 0.1838, -0.1094, 0.4115, -0.9048, 0.63, 0.0606, -0.7742, 0.2678, 0.0054, -0.9635, 0.0766, 0.3766, -0.9232, -0.4769, 0.1373, 0.8682, -0.7309, 0.2948, 0.6155, -0.5775, 0.5291, 0.6217, 0.0097, -0.0647, -0.9979, 0.4314, -0.5463, -0.718, -0.4464, -0.3502, -0.8235, -0.7292, -0.1595, -0.6654, -0.4822, -0.1077, -0.8694, 0.2747, 0.9582, -0.0796, 0.3159, 0.883, -0.3472, -0.2773, 0.3134, 0.9082, -0.353, 0.4074, 0.8423, -0.3249, 0.3614, 0.874, -0.1781, -0.5213, -0.8346, -0.0588, -0.4849, -0.8726, 0.136, 0.1197, -0.9834, 0.0216, 0.4146, -0.9098, 0.1743, -0.0366, -0.984, 0.267, 0.1966, -0.9434, 0.1749, 0.1933, -0.9654, 0.9966, -0.0606, 0.0558, 0.8961, 0.3137, 0.314, 0.8277, -0.2499, 0.5025, -0.0152, 0.6545, -0.7559, -0.1199, -0.524, -0.8432, -0.0163, 0.8976, -0.4405, -0.71, -0.5526, 0.4366, -0.7314, -0.4431, 0.5183, -0.011, -0.911, 0.4122, -0.0533, 0.0385, 0.9978, 0.1111, 0.1962, 0.9743, -0.1299, -0.1498, -0.9801, 0.136, 0.1197, -0.9834, 0.0078, 0.4909, -0.8712, 0.2241, 0.0954, -0.9699, 0.0876, 0.1045, -0.9907, 0.0028, 0.1103, -0.9939, 0.9842, -0.1051, -0.1428, 0.9917, 0.1224, -0.0392, 0.9578, 0.1264, -0.258, 0.0934, 0.3589, -0.9287, -0.1864, 0.7097, -0.6794, -0.2802, 0.3407, -0.8974, 0.1104, 0.7878, -0.606, -0.0633, 0.6863, -0.7245, 0.2477, -0.1742, 0.953, 0.3012, 0.1139, 0.9467, 0.1276, 0.0902, 0.9877, 0.2777, -0.9065, 0.3181, -0.0251, -0.9441, 0.3287, -0.0523, -0.5816, -0.8118, 0.0293, -0.3452, -0.9381, -0.0814, -0.0097, -0.9966, 0.136, 0.1197, -0.9834, 0.136, 0.1197, -0.9834, 0.0237, 0.2788, -0.9601, 0.2693, 0.275, -0.923, 0.0658, 0.2137, -0.9747, -0.1094, 0.4115, -0.9048, -0.1487, 0.1673, -0.9746, 0.2826, 0.212, -0.9355, 0.2298, 0.2433, -0.9423, 0.2856, 0.2666, -0.9205, 0.1089, 0.645, -0.7564, 0.3878, -0.9146, -0.1148, 0.3409, -0.9397, 0.0289, -0.1874, 0.9381, -0.2913, -0.3435, 0.2015, 0.9173, -0.008, -0.333, -0.9429, 0.0392, 0.1632, -0.9858, 0.136, 0.1197, -0.9834, 0.136, 0.1197, -0.9834, -0.1927, -0.5608, -0.8052, 0.2199, 0.4682, -0.8558, 0.1523, 0.3708, -0.9161, -0.1169, 0.4948, -0.8611, -0.096, 0.61, -0.7866, 0.3377, 0.2369, -0.9109, 0.4415, 0.2671, -0.8566, -0.096, 0.61, -0.7866, 0.4842, 0.2921, -0.8247, 0.1314, 0.4258, -0.8952, 0.266, 0.7243, -0.6362, 0.4842, 0.2921, -0.8247, 0.6805, -0.6903, 0.2456, 0.849, -0.4734, 0.2347, 0.8157, -0.5725, 0.0834, 0.3473, 0.4131, -0.8419, -0.566, 0.772, 0.2892, -0.4727, 0.738, 0.4817, -0.7087, 0.5702, 0.4155, 0.8334, 0.4824, -0.2695, 0.7774, 0.4899, -0.3945, 0.8548, 0.3588, -0.375, -0.1677, -0.2736, -0.9471, -0.3791, -0.2047, -0.9024, -0.3709, -0.3509, -0.8598, -0.4116, 0.051, -0.9099, -0.5978, 0.2013, -0.776, -0.5057, -0.4275, -0.7493, 0.1336, -0.2307, -0.9638, -0.0332, 0.1836, -0.9824, 0.013, 0.3502, -0.9366, -0.0149, 0.5057, -0.8626, 0.0589, 0.6413, -0.765, -0.1154, -0.0921, -0.989, 0.1239, -0.1809, -0.9757, -0.0919, -0.3362, -0.9373, 0.317, 0.5226, -0.7915, 0.2856, 0.4624, -0.8394, 0.2033, 0.4528, -0.8681, 0.8781, 0.4479, -0.1683, 0.8309, 0.5464, -0.105, -0.027, -0.3432, -0.9389, 0.09, 0.4342, -0.8963, 0.2565, -0.02, -0.9663, 0.0411, 0.4982, -0.8661, -0.0742, 0.9043, -0.4203, 0.0778, 0.747, -0.6603, -0.3985, 0.6508, -0.6463, 0.1991, -0.0051, -0.98, 0.0228, 0.1706, -0.9851, 0.1842, 0.1278, -0.9745, 0.1253, 0.383, -0.9152, 0.1618, 0.3794, -0.911, 0.0239, 0.3489, -0.9369, 0.9985, -0.0356, -0.0411, 0.9574, 0.2325, -0.1715, 0.9988, -0.01, -0.0483, 0.2605, 0.4557, -0.8512, 0.1089, 0.645, -0.7564, 0.9174, 0.0134, -0.3978, 0.1918, -0.9517, 0.2398, 0.0266, -0.9765, 0.214, 0.5466, -0.8014, 0.2428, -0.0901, 0.406, -0.9094, 0.2678, 0.0054, -0.9635, 0.0226, -0.1243, -0.992, -0.1459, -0.0353, -0.9887, -0.1487, 0.1673, -0.9746, 0.0226, -0.1243, -0.992, 0.3558, -0.0907, -0.9302, 0.0658, 0.2137, -0.9747, -0.2231, 0.9162, -0.3329, -0.1496, 0.8734, -0.4635, 0.2628, -0.0845, 0.9611, -0.0216, -0.5722, 0.8198, 0.6073, -0.5571, 0.5664, -0.9001, -0.3727, -0.2258, -0.9728, 0.2284, 0.0383, -0.6393, -0.7685, -0.025, 0.0833, 0.2148, -0.9731, 0.017, 0.341, -0.9399, 0.0803, -0.5615, -0.8236, 0.2636, -0.4508, -0.8528, 0.0774, -0.2909, -0.9536, -0.1883, -0.2757, -0.9426, 0.2646, 0.2045, -0.9424, 0.2168, 0.2373, -0.9469, 0.3111, 0.1412, -0.9398, -0.1329, 0.5821, -0.8022, -0.669, 0.1047, -0.7358, -0.7852, 0.4275, -0.448, -0.3985, 0.6508, -0.6463, 0.0845, -0.3315, -0.9397, 0.064, -0.5795, -0.8124, -0.1518, 0.4005, -0.9036, 0.0115, 0.5531, -0.833, 0.8277, -0.2499, 0.5025, 0.3505, -0.7758, 0.5246, 0.643, -0.7089, 0.2898, -0.1329, 0.5821, -0.8022, -0.2264, 0.1623, -0.9604, 0.2951, -0.1891, -0.9366, 0.3527, -0.1306, -0.9266, 0.2667, 0.0855, -0.96, 0.3325, 0.0884, -0.9389, -0.9915, 0.0595, -0.1155, -0.9537, -0.0093, 0.3006, -0.9976, -0.0513, 0.0457, 0.4093, -0.569, -0.7132, -0.1979, 0.6979, -0.6883, 0.1616, 0.5186, -0.8396, 0.3681, 0.1253, -0.9213, 0.3347, 0.5754, -0.7463, 0.5567, 0.2564, -0.7902, 0.7658, 0.5779, 0.2821, 0.6738, 0.2103, 0.7083, -0.2083, 0.2382, 0.9486, 0.1163, 0.118, -0.9862, 0.1273, -0.8141, 0.5666, 0.4594, -0.7898, 0.4063, 0.238, 0.4916, -0.8376, 0.3959, 0.3034, -0.8667, -0.8762, 0.2856, 0.3883, -0.7021, 0.5383, 0.4662, 0.0215, 0.4414, -0.8971, 0.0215, 0.4414, -0.8971, 0.4889, 0.8121, -0.3185, 0.7023, -0.1532, 0.6952, 0.5704, 0.0161, 0.8212, 0.5436, -0.0359, 0.8386, -0.142, -0.213, -0.9667, 0.0772, -0.0925, -0.9927, 0.1688, 0.162, -0.9722, 0.1241, 0.3466, -0.9298, -0.0647, 0.7195, -0.6915, -0.1481, -0.5871, 0.7959, -0.0121, -0.7995, 0.6005, 0.2549, -0.8551, 0.4515, 0.1352, -0.764, 0.6309, 0.2975, -0.9159, 0.2695, 0.5549, 0.2294, -0.7997, 0.3754, 0.2384, -0.8957, 0.3959, 0.3034, -0.8667, -0.0943, -0.0248, -0.9952, 0.0729, 0.6018, -0.7953, 0.0239, 0.6337, -0.7732, 0.9926, 0.0627, -0.1042, 0.9491, 0.0611, -0.3089, 0.6641, -0.745, 0.0631, 0.0658, 0.2137, -0.9747, 0.1251, 0.3019, -0.9451, -0.1169, 0.4948, -0.8611, -0.1259, -0.1555, -0.9798, -0.0776, -0.0271, -0.9966, 0.2239, 0.4122, -0.8832, 0.745, -0.639, 0.1916, 0.2795, -0.0403, -0.9593, 0.0709, 0.0217, -0.9972, 0.3754, 0.2384, -0.8957, 0.1483, 0.4324, -0.8894, -0.9728, -0.2294, -0.032, -0.1421, -0.141, -0.9798, 0.1324, 0.02, -0.991, 0.0905, 0.1845, -0.9787, -0.9637, 0.2091, -0.1658, 0.9789, -0.2026, 0.0258, -0.0114, 0.6163, -0.7874, 0.2721, 0.3003, -0.9142, 0.1754, -0.1712, -0.9695, 0.0817, -0.1645, -0.983, -0.0126, -0.0991, -0.995, 0.9916, 0.0544, -0.1172, -0.693, 0.7194, 0.0469, -0.5499, 0.7613, -0.3435, -0.4181, 0.907, 0.0496, -0.0028, 0.1214, -0.9926, -0.1155, 0.1588, -0.9805, -0.1519, -0.0077, -0.9884, 0.2721, 0.3003, -0.9142, 0.0239, 0.3028, -0.9528, 0.0858, 0.1026, -0.991, 0.0617, -0.0658, -0.9959, -0.1616, -0.0344, -0.9863, -0.212, 0.0406, -0.9764, -0.0047, 0.381, -0.9246, 0.9405, 0.2838, 0.1868, 0.9926, 0.0627, -0.1042, 0.931, 0.3613, -0.0512, 0.9624, -0.2656, 0.0562, 0.418, -0.7731, 0.477, 0.3119, -0.6687, 0.6749, 0.3954, -0.9161, 0.066, 0.5024, -0.731, -0.4618, 0.1455, -0.1128, -0.9829, -0.2275, 0.1885, -0.9554, 0.1671, 0.4109, -0.8962, 0.0243, 0.539, -0.842, 0.0783, 0.5796, -0.8111, -0.0141, 0.6423, -0.7663, -0.1012, 0.7978, -0.5943, -0.3802, 0.9176, -0.1163, -0.4277, 0.902, 0.0597, -0.5966, 0.7911, -0.135, 0.59, -0.0016, -0.8074, 0.2365, 0.4539, -0.8591, -0.0456, 0.6976, -0.7151, -0.0152, 0.5755, -0.8176, 0.025, 0.7038, -0.71, -0.1011, 0.672, -0.7336, -0.2793, 0.3614, -0.8896, 0.0239, 0.3028, -0.9528, 0.2721, 0.3003, -0.9142, 0.9301, 0.1013, 0.3531, 0.9213, -0.1297, 0.3665, 0.5824, 0.1298, -0.8025, 0.2649, -0.1139, -0.9575, 0.2217, -0.1408, -0.9649, 0.1228, 0.0061, -0.9924, -0.0242, -0.1324, -0.9909, -0.1432, -0.0724, -0.987, -0.1969, 0.4061, -0.8923, -0.1969, 0.4061, -0.8923, -0.1404, 0.4893, -0.8608, 0.3019, -0.1471, -0.9419, 0.9116, 0.394, -0.1172, 0.9427, 0.3039, -0.1377, 0.3589, -0.923, 0.1391, 0.6922, -0.6829, 0.2335, -0.3912, 0.5512, -0.737, 0.0491, 0.4332, -0.9, 0.3315, -0.0831, -0.9398, 0.3336, -0.1952, -0.9223, 0.1759, -0.1365, -0.9749, -0.1728, 0.5358, -0.8265, 0.2393, 0.2688, -0.933, 0.2862, 0.2774, -0.9171, -0.0145, -0.021, -0.9997, 0.7687, -0.2126, -0.6033, 0.5824, 0.1298, -0.8025, 0.59, -0.0016, -0.8074, 0.0491, 0.4332, -0.9, 0.3569, -0.1414, -0.9234, -0.0132, -0.2181, -0.9758, -0.1505, -0.2545, -0.9553, -0.1946, 0.4756, -0.8579, -0.1969, 0.4061, -0.8923, 0.6038, 0.0381, -0.7962, 0.6038, 0.0381, -0.7962, 0.6688, -0.013, -0.7433, 0.7304, 0.6483, -0.215, 0.4676, 0.8685, -0.1643, 0.3624, -0.1587, -0.9184, 0.2248, -0.1618, -0.9609, -0.0812, 0.6371, -0.7665, -0.0562, 0.7916, -0.6084, -0.0514, -0.1634, -0.9852, 0.2168, 0.2373, -0.9469, -0.1047, 0.5238, -0.8454, -0.0715, 0.3925, -0.917, 0.4594, -0.7898, 0.4063, 0.1224, 0.0701, -0.99, 0.2864, -0.1896, -0.9392, -0.032, 0.0274, -0.9991, -0.025, 0.2449, -0.9692, -0.1969, 0.4061, -0.8923, -0.4689, -0.8314, 0.2981, -0.9652, -0.0795, 0.2492, -0.71, -0.5526, 0.4366, -0.9867, 0.1628, -0.0006, -0.4902, -0.2173, -0.8441, -0.1314, 0.4065, -0.9041, -0.1969, 0.4061, -0.8923, -0.1969, 0.4061, -0.8923, 0.3186, 0.3911, -0.8634, 0.0487, 0.6366, -0.7696, 0.69, -0.621, 0.3718, -0.0468, -0.2427, -0.969, -0.4512, -0.2888, -0.8444, -0.6874, -0.1038, -0.7188, -0.3293, -0.0117, -0.9441, 0.0154, 0.2133, -0.9769, 0.9919, 0.1112, -0.0615, 0.9786, 0.1722, -0.1123, 0.6227, -0.3998, -0.6726, 0.1072, 0.1027, -0.9889, 0.2807, 0.4438, -0.851, 0.1731, 0.6328, -0.7547, -0.8659, -0.2149, -0.4518, -0.8747, 0.0591, -0.481, 0.8029, 0.1381, 0.5799, 0.8333, 0.4043, 0.3771, 0.2526, 0.9666, -0.044, -0.375, -0.1599, -0.9131, -0.4605, 0.1701, -0.8712, 0.8367, 0.4186, 0.3531, 0.8069, 0.4973, 0.3188, 0.2062, 0.8043, -0.5572, 0.1809, 0.6055, -0.775, 0.9299, 0.2683, -0.2516, 0.9842, 0.076, -0.1598, 0.7176, -0.6461, 0.2601, 0.8342, -0.5052, 0.2212, -0.3255, 0.8379, -0.4381, -0.5168, 0.7111, -0.4766, -0.3098, 0.731, -0.6079, -0.6907, -0.2531, -0.6774, -0.1779, 0.1873, -0.9661, -0.2645, 0.571, -0.7772, -0.2222, 0.4261, -0.877, -0.1303, 0.72, 0.6816, -0.0812, 0.6301, 0.7723, -0.1444, 0.6212, 0.7702, 0.0931, 0.0055, -0.9956, 0.2477, -0.1742, 0.953, 0.1276, 0.0902, 0.9877, -0.046, -0.0163, 0.9988, 0.9563, -0.2823, 0.0758, -0.7753, -0.0336, -0.6307, -0.4605, 0.1701, -0.8712, -0.8003, -0.1428, -0.5824, -0.823, -0.2725, -0.4985, -0.9408, -0.012, -0.3388, -0.9941, -0.1025, -0.0365, -0.8826, -0.3099, -0.3536, 0.2678, 0.0054, -0.9635, 0.63, 0.0606, -0.7742, 0.7316, -0.3215, -0.6012, -0.4354, 0.3764, -0.8178, -0.2055, 0.4605, -0.8636, -0.2521, 0.6596, -0.708, -0.2521, 0.6596, -0.708, -0.133, 0.8138, -0.5657, -0.3098, 0.731, -0.6079, -0.2327, -0.118, 0.9654, -0.2573, -0.3965, 0.8812, -0.0216, -0.5722, 0.8198, -0.2573, -0.3965, 0.8812, -0.0582, 0.7813, -0.6214, 0.1318, 0.9148, -0.3818, 0.3774, 0.9258, -0.019, -0.3624, 0.3024, -0.8816, -0.2521, 0.6596, -0.708, -0.0464, 0.624, -0.78, -0.3098, 0.731, -0.6079, -0.3307, 0.8046, -0.4932, -0.6262, 0.4339, -0.6478, 0.5939, 0.1733, -0.7857, -0.0987, 0.3265, -0.94, 0.2317, -0.8931, 0.3855, 0.5069, -0.8507, 0.1388, 0.6906, 0.0285, -0.7227, 0.3352, 0.4562, -0.8243, 0.6906, 0.0285, -0.7227, 0.0059, 0.8103, -0.586, -0.2703, 0.3824, -0.8836, 0.1276, 0.3376, -0.9326, 0.0032, 0.8252, -0.5648, -0.3098, 0.731, -0.6079, -0.0464, 0.624, -0.78, -0.3098, 0.731, -0.6079, -0.0806, 0.2264, -0.9707, -0.1588, 0.6285, -0.7614, -0.1145, 0.5866, -0.8017, -0.946, 0.0742, 0.3154, 0.1903, 0.8961, -0.4009, 0.7833, 0.2065, -0.5863, 0.8064, 0.3614, -0.468, 0.3889, 0.9099, -0.1445, -0.1784, 0.3274, -0.9279, 0.3989, -0.1163, -0.9096, 0.3526, 0.9119, -0.21, -0.9618, 0.1969, 0.1901, -0.9854, -0.1443, -0.0901, -0.964, -0.205, 0.1695, -0.2759, 0.5695, -0.7743, 0.6011, 0.3116, 0.7359, 0.4771, 0.1924, 0.8575, 0.569, 0.1996, -0.7977, 0.4019, 0.2711, -0.8746, 0.8961, 0.3137, 0.314, -0.5683, 0.2321, -0.7894, -0.6262, 0.4339, -0.6478, -0.5683, 0.2321, -0.7894, -0.7709, -0.1203, -0.6255, -0.0741, -0.3541, 0.9323, -0.5901, -0.3207, 0.7409, -0.5222, -0.4215, 0.7414, 0.3029, 0.7036, -0.6428, 0.3438, 0.6905, -0.6364, 0.2532, 0.5743, -0.7785, 0.0256, 0.2626, -0.9646, 0.4419, -0.0821, -0.8933, 0.3071, 0.1154, -0.9447, 0.1251, 0.3019, -0.9451, 0.1462, 0.7279, -0.67, -0.9737, 0.2007, 0.1078, -0.8735, 0.4544, -0.1747, -0.7026, 0.6991, 0.1328, 0.3905, 0.8485, 0.3573, -0.3876, 0.9123, -0.1324, -0.4905, 0.8478, 0.2017, 0.5323, -0.8445, -0.0585, -0.0283, 0.2932, -0.9556, -0.2521, 0.6596, -0.708, -0.3095, 0.2024, 0.9291, -0.5907, 0.4179, 0.6903, -0.1861, 0.3445, 0.9202, 0.2857, 0.0335, -0.9577, 0.3293, -0.0214, -0.944, 0.2654, 0.5099, -0.8182, -0.215, 0.2494, -0.9442, -0.215, 0.2494, -0.9442, -0.5683, 0.2321, -0.7894, -0.133, 0.8138, -0.5657, -0.4972, -0.3722, -0.7838, -0.0708, 0.9956, 0.0606, 0.1824, 0.9627, -0.1996, -0.1974, -0.6474, 0.7361, -0.5467, 0.0218, -0.837, -0.4113, -0.2704, -0.8704, -0.2809, 0.0181, -0.9596, 0.0487, 0.6366, -0.7696, -0.2497, -0.0906, -0.9641, 0.5296, 0.3468, -0.7741, -0.0975, 0.1784, -0.9791, -0.4187, 0.3234, -0.8486, 0.2062, 0.8043, -0.5572, -0.1157, 0.5121, -0.8511, -0.2646, 0.5534, -0.7898, 0.6896, -0.1463, 0.7092, 0.6522, -0.1841, 0.7353, 0.5829, 0.0001, 0.8125, 0.2757, -0.0745, -0.9584, -0.598, 0.8014, -0.0112, -0.215, 0.2494, -0.9442, -0.1942, -0.2576, -0.9465, 0.0927, -0.0612, -0.9938, -0.4113, -0.2704, -0.8704, 0.3774, 0.9258, -0.019, -0.3959, -0.3633, -0.8434, -0.6891, -0.2057, -0.6948, -0.4171, -0.2896, -0.8615, -0.0595, -0.2471, -0.9672, -0.2346, 0.4096, -0.8816, -0.4153, 0.5222, -0.7448, 0.3245, 0.8817, -0.3426, -0.003, -0.9924, -0.123, -0.0653, -0.8647, -0.498, 0.0018, -0.9937, -0.1117, -0.1593, 0.291, -0.9434, -0.2516, 0.6361, -0.7295, -0.0314, 0.0676, -0.9972, -0.0314, 0.0676, -0.9972, -0.4664, -0.2383, -0.8519, -0.2922, -0.3741, -0.8802, -0.2498, -0.1413, -0.9579, -0.1633, -0.2022, -0.9656, -0.0061, -0.051, -0.9987, -0.0511, 0.197, -0.9791, -0.2438, 0.6646, -0.7063, -0.4153, 0.5222, -0.7448, -0.8108, 0.1267, 0.5714, -0.7771, 0.2519, 0.5768, 0.3408, 0.9278, -0.1518, 0.3774, 0.9258, -0.019, -0.1967, 0.4919, -0.8481, -0.2305, 0.7698, -0.5952, 0.5455, -0.7275, 0.416, 0.9298, 0.0651, 0.3621, 0.925, -0.1352, 0.355, 0.1314, 0.4258, -0.8952, -0.105, -0.2612, -0.9596, -0.0645, 0.0923, -0.9936, 0.2646, 0.2045, -0.9424, 0.2654, 0.5099, -0.8182, -0.0314, 0.0676, -0.9972, 0.1462, 0.7279, -0.67, -0.2721, -0.508, -0.8173, 0.1273, -0.8141, 0.5666, -0.31, -0.2524, -0.9166, -0.1327, -0.0344, -0.9906, 0.2062, 0.8043, -0.5572, -0.1266, 0.1651, -0.9781, -0.1559, 0.34, -0.9274, 0.3663, 0.4623, -0.8075, -0.1487, 0.1673, -0.9746, -0.2631, -0.3438, -0.9014, -0.279, -0.2025, -0.9387, -0.1968, -0.0911, -0.9762, -0.073, 0.3778, -0.923, -0.0247, 0.154, -0.9878, 0.96, 0.1889, 0.2069, -0.0582, 0.0955, -0.9937, 0.2654, 0.5099, -0.8182, -0.1252, -0.3004, 0.9456, -0.3135, 0.9447, -0.0965, -0.2658, -0.0306, -0.9635, 0.0385, 0.1101, -0.9932, -0.0952, 0.9117, -0.3997, -0.2896, 0.8346, -0.4686, 0.3071, 0.1154, -0.9447, 0.2654, 0.5099, -0.8182, 0.6379, 0.0605, 0.7677, 0.4834, 0.2964, 0.8237, -0.0287, 0.7782, -0.6274, -0.4689, -0.8314, 0.2981, -0.9351, 0.3085, -0.1746, 0.3559, -0.0679, -0.9321, 0.2107, 0.0608, -0.9757, 0.4585, -0.0284, -0.8882, 0.7915, -0.1594, -0.59, -0.1979, 0.6979, -0.6883, -0.4503, 0.804, -0.3883, 0.5739, 0.442, -0.6894, 0.4646, 0.4721, -0.7491, 0.4844, 0.3463, -0.8034, 0.4462, -0.2257, -0.866, 0.5292, -0.4985, -0.6866, 0.4708, 0.2827, -0.8357, 0.395, -0.2116, -0.894, 0.4498, -0.2174, -0.8663, 0.0976, -0.8835, -0.4581, 0.2581, -0.4878, -0.8339, 0.2263, -0.5511, -0.8031, 0.5135, 0.4121, -0.7527, 0.4233, 0.2717, -0.8643, 0.4771, 0.1924, 0.8575, 0.2477, -0.1742, 0.953, 0.5361, 0.3303, -0.7768, 0.5574, 0.0846, -0.8259, 0.4342, -0.2177, -0.8741, 0.4493, -0.1696, -0.8771, 0.3387, -0.0876, -0.9368, 0.6943, -0.1505, -0.7038, 0.8604, -0.1162, -0.4962, 0.8055, -0.2353, -0.5439, 0.9444, 0.0865, 0.3171, -0.3315, 0.0475, -0.9423, 0.2929, -0.2209, -0.9303, 0.7614, 0.1218, -0.6368, 0.6354, -0.3791, -0.6727, -0.1864, -0.4872, 0.8532, -0.022, -0.608, 0.7936, 0.4551, -0.461, -0.7618, 0.4577, -0.5904, -0.6648, 0.4339, -0.319, -0.8426, 0.5549, 0.2294, -0.7997, 0.668, -0.6265, 0.4015, 0.664, -0.688, 0.2928, 0.7009, -0.5494, 0.4548, 0.6801, -0.0603, 0.7306, 0.6907, -0.2276, 0.6864, 0.7542, -0.2645, 0.601, 0.4038, 0.5709, -0.7148, 0.1707, 0.8076, -0.5645, 0.4708, 0.2827, -0.8357, 0.4746, -0.1613, -0.8653, 0.488, -0.2063, -0.8481, 0.5135, -0.2408, -0.8236, 0.9012, 0.3539, -0.2503, 0.931, 0.3613, -0.0512, -0.7886, -0.1536, 0.5954, -0.3192, 0.2707, 0.9082, -0.7733, 0.3911, 0.499, 0.4618, 0.3621, -0.8097, 0.4257, -0.2134, -0.8793, 0.4405, -0.1864, -0.8782, 0.7934, -0.0544, -0.6063, 0.1114, -0.2816, -0.953, -0.1975, -0.543, -0.8162, 0.0548, -0.8472, -0.5285, 0.6214, 0.2888, -0.7283, 0.7307, 0.5134, 0.45, 0.7944, 0.4941, 0.3532, 0.7997, 0.4194, 0.4296, 0.7101, 0.2171, -0.6697, -0.9583, 0.2826, -0.0424, -0.9245, 0.1006, -0.3677, -0.9969, 0.0757, 0.0221, 0.3444, 0.5497, -0.7611, 0.6708, 0.3739, -0.6405, 0.5155, 0.3875, -0.7643, 0.508, 0.4577, -0.7297, 0.2882, -0.0794, -0.9543, 0.174, 0.7182, -0.6737, 0.0554, 0.1421, -0.9883, 0.3417, -0.7833, -0.5193, 0.0148, -0.7062, 0.7078, 0.78, -0.4008, -0.4806, 0.6108, -0.6133, -0.5008, -0.7087, -0.705, 0.0252, 0.6518, -0.1235, -0.7483, 0.7101, 0.2171, -0.6697, 0.7824, 0.2836, -0.5545, 0.6588, 0.1159, -0.7434, 0.7825, -0.3891, -0.4861, 0.4687, -0.5304, -0.7064, 0.5851, -0.6839, -0.4358, 0.6518, -0.1235, -0.7483, 0.212, 0.6465, -0.7329, 0.8414, 0.0481, -0.5383, 0.7101, 0.2171, -0.6697, 0.9363, -0.0007, -0.3513, 0.4834, -0.7351, -0.4754, 0.5315, -0.7959, -0.2899, 0.8319, -0.2333, -0.5036, 0.7754, 0.3278, -0.5398, 0.7101, 0.2171, -0.6697, 0.7101, 0.2171, -0.6697, 0.7754, 0.3278, -0.5398, 0.8385, -0.0857, -0.5381, 0.7914, -0.2602, -0.5531, 0.8127, -0.1139, -0.5714, 0.7073, -0.0175, -0.7067, 0.7245, -0.1866, -0.6636, 0.8256, 0.2344, -0.5133, 0.8335, 0.3271, -0.4454, 0.762, 0.3438, -0.5488, -0.1114, 0.1284, 0.9854, -0.0881, 0.2485, 0.9646, 0.5907, -0.7397, -0.3223, 0.4092, -0.8464, -0.3407, 0.758, -0.5256, -0.3861, 0.7824, 0.2836, -0.5545, 0.837, 0.0578, -0.5442, 0.6471, 0.2797, -0.7092, 0.928, -0.3364, 0.1603, 0.6477, 0.4235, -0.6333, 0.8069, -0.0395, -0.5894, 0.7418, -0.0203, -0.6703, 0.7183, -0.0667, -0.6925, 0.6346, 0.0863, -0.768, 0.6319, 0.0417, -0.7739, 0.5631, 0.1112, -0.8189, 0.3791, 0.6066, -0.6988, 0.758, -0.5256, -0.3861, 0.758, -0.5256, -0.3861, 0.6878, 0.384, -0.6161, 0.589, -0.2319, -0.7742, 0.5749, 0.0004, -0.8182, 0.5457, -0.0271, -0.8375, 0.7744, -0.0312, -0.6319, 0.8287, 0.0462, -0.5578, 0.7631, -0.0248, -0.6458, 0.7383, 0.1239, -0.663, 0.5939, 0.1733, -0.7857, -0.0103, 0.4047, 0.9144, 0.0111, 0.3892, 0.9211, 0.0388, 0.2771, 0.96, 0.3995, 0.1259, -0.9081, 0.7043, 0.2919, -0.6472, 0.8546, 0.3603, -0.3739, 0.7727, 0.2848, -0.5674, 0.7727, 0.2848, -0.5674, 0.4772, 0.2103, -0.8533, 0.5024, -0.0836, -0.8606, 0.5503, -0.5543, -0.6244, 0.3822, 0.5242, -0.761, 0.6425, 0.4363, -0.6299, 0.552, 0.2652, -0.7905, 0.5242, -0.5262, -0.6696, 0.3417, -0.7833, -0.5193, 0.5242, -0.5262, -0.6696, 0.6878, 0.384, -0.6161, 0.879, -0.0161, -0.4766, 0.758, -0.5256, -0.3861, 0.7504, 0.0753, -0.6567, 0.0029, 0.2246, 0.9744, -0.1513, 0.4094, 0.8997, 0.8334, -0.0333, -0.5516, 0.4843, -0.3678, -0.7939, 0.6071, -0.3786, -0.6986, 0.5385, -0.3531, -0.7651, 0.4593, -0.1457, -0.8763, 0.6699, -0.3878, -0.6331, 0.6201, -0.0798, -0.7805, 0.5566, -0.1037, -0.8243, 0.4064, 0.0943, -0.9088, 0.4751, -0.1348, -0.8695, 0.7257, -0.3792, -0.574, 0.5075, -0.6103, 0.6082, 0.5812, -0.5159, -0.6294, 0.758, -0.5256, -0.3861, 0.582, -0.3316, -0.7425, 0.7383, 0.1239, -0.663, 0.5033, 0.3507, -0.7898, 0.4989, 0.487, -0.7169, 0.604, 0.3569, -0.7126, 0.7504, 0.0753, -0.6567, 0.6974, -0.1563, -0.6994, 0.5848, -0.4266, -0.6899, 0.5455, -0.7275, 0.416, 0.758, -0.5256, -0.3861, 0.6384, -0.0338, -0.7689, 0.6974, -0.1563, -0.6994, 0.0007, 0.3308, 0.9437, 0.4646, 0.4721, -0.7491, 0.582, -0.3316, -0.7425, 0.577, -0.0179, -0.8166, -0.1954, -0.0664, -0.9785, 0.0934, 0.3589, -0.9287, 0.2038, 0.064, -0.9769, 0.5455, -0.7275, 0.416, -0.8322, -0.3216, 0.4516, 0.4646, 0.4721, -0.7491, 0.3847, -0.0692, -0.9204, 0.707, -0.6284, -0.3245, 0.6245, -0.4497, -0.6386, 0.4326, -0.9003, -0.0474, 0.5303, 0.469, -0.7063, 0.7927, 0.1729, -0.5846, -0.4765, -0.5524, 0.684, 0.1145, -0.7232, 0.6811, 0.1273, -0.8141, 0.5666, 0.3039, -0.1274, -0.9442, 0.46, -0.409, -0.7881, 0.5242, -0.5262, -0.6696, 0.6241, 0.0697, -0.7782, 0.7199, 0.0384, -0.693, 0.4676, -0.4623, -0.7535, 0.4324, 0.5243, -0.7336, 0.5806, 0.254, -0.7736, 0.6953, -0.03, -0.7181, 0.7456, -0.1688, -0.6447, 0.6384, -0.0338, -0.7689, 0.6467, 0.3012, -0.7007, 0.6073, -0.5571, 0.5664, 0.5323, -0.8445, -0.0585, 0.5876, -0.5748, -0.5695, 0.5381, 0.4622, -0.7048, 0.2434, 0.7726, -0.5864, 0.6477, 0.2172, -0.7303, 0.5629, -0.4067, -0.7195, 0.6411, -0.2399, -0.729, 0.6411, -0.2399, -0.729, 0.6116, 0.3614, -0.7038, 0.4612, 0.4773, -0.748, 0.567, 0.3898, -0.7257, 0.561, 0.2199, -0.7981, 0.6953, -0.03, -0.7181, 0.7912, -0.0179, -0.6112, 0.7912, -0.0179, -0.6112, 0.6467, 0.3012, -0.7007, 0.551, 0.4518, 0.7017, 0.057, -0.7215, 0.6901, 0.7035, 0.0582, -0.7083, 0.7912, -0.0179, -0.6112, -0.1036, -0.5659, -0.8179, 0.2605, 0.4557, -0.8512, 0.2605, 0.4557, -0.8512, 0.1616, 0.5186, -0.8396, 0.29, 0.1892, -0.9381, 0.4456, -0.8585, -0.254, 0.2626, 0.7079, -0.6557, 0.8984, 0.3109, -0.3102, 0.7304, 0.6483, -0.215, 0.6159, -0.7669, 0.1806, 0.5267, 0.1348, -0.8393, 0.6229, -0.0436, -0.7811, 0.2458, -0.087, -0.9654, 0.6477, 0.2172, -0.7303, 0.684, 0.4065, -0.6057, 0.7904, 0.0056, -0.6125, 0.7912, -0.0179, -0.6112, 0.0952, -0.9166, -0.3883, 0.0013, -0.9267, -0.3759, 0.0173, -0.9944, -0.104, 0.6022, -0.4345, -0.6697, -0.4518, 0.1548, 0.8786, -0.3256, 0.2339, 0.9161, 0.7343, 0.19, -0.6516, 0.8516, 0.1299, -0.5078, 0.7912, -0.0179, -0.6112, 0.1923, -0.4723, -0.8602, 0.2748, 0.1979, -0.9409, 0.6602, -0.5623, -0.498, 0.7066, 0.4049, -0.5803, 0.5753, 0.4938, -0.652, 0.7438, -0.0391, -0.6672, 0.5875, -0.0373, -0.8084, 0.5432, -0.2348, -0.8061, 0.6088, -0.1757, -0.7737, 0.693, -0.2543, -0.6746, 0.6091, -0.2059, -0.7659, 0.6091, -0.2059, -0.7659, 0.46, -0.409, -0.7881, 0.8241, 0.1256, -0.5523, 0.4687, -0.5304, -0.7064, 0.9028, 0.0769, -0.4231, -0.2821, -0.943, 0.1765, -0.3884, -0.8948, 0.2201, -0.6686, -0.7206, 0.1838, 0.5036, 0.0833, -0.8599, 0.7619, -0.0415, -0.6464, 0.7035, 0.0582, -0.7083, 0.7343, 0.19, -0.6516, 0.902, 0.0874, -0.4229, 0.5193, -0.4331, -0.7367, 0.5479, -0.1281, -0.8267, 0.5242, 0.0196, -0.8514, 0.5334, 0.2799, -0.7982, 0.6588, 0.1159, -0.7434, 0.7833, 0.2065, -0.5863, 0.6177, 0.2986, -0.7275, 0.7343, 0.19, -0.6516, 0.8241, 0.1256, -0.5523, 0.0719, -0.5404, 0.8383, 0.6122, -0.1306, -0.7798, 0.5213, -0.0993, -0.8476, 0.3445, -0.7736, 0.5318, 0.4277, -0.69, 0.5839, 0.47, -0.7912, 0.3913, -0.5208, 0.382, -0.7634, 0.5567, 0.2564, -0.7902, 0.8311, 0.3579, -0.4256, 0.9704, -0.1176, -0.211, 0.7927, 0.1729, -0.5846, 0.8805, -0.3447, -0.3255, 0.6123, 0.3011, -0.7311, 0.8714, 0.4879, -0.0507, 0.5737, -0.1624, -0.8028, 0.5728, 0.1397, -0.8077, -0.8247, 0.2807, 0.491, -0.7034, -0.2192, 0.6762, -0.3296, 0.4455, 0.8324, 0.8342, 0.0884, -0.5443, 0.7343, 0.19, -0.6516, 0.8342, 0.0884, -0.5443, 0.7958, 0.3015, -0.5252, 0.7343, 0.19, -0.6516, 0.7343, 0.19, -0.6516, 0.567, 0.3898, -0.7257, 0.8311, 0.3579, -0.4256, 0.4225, 0.1035, -0.9004, 0.5409, -0.2702, -0.7965, 0.5248, 0.1704, -0.834, 0.552, 0.2652, -0.7905, 0.6308, -0.0577, -0.7738, 0.6497, -0.2538, -0.7165, 0.7619, -0.0415, -0.6464, 0.4038, 0.5709, -0.7148, 0.6471, -0.3314, -0.6867, 0.6122, 0.091, -0.7855, 0.5403, 0.0549, -0.8397, 0.9372, 0.1781, -0.3, -0.7494, -0.6407, -0.1669, 0.833, 0.2743, -0.4804, 0.7958, 0.3015, -0.5252, 0.3987, 0.4368, -0.8064, 0.5794, -0.1444, -0.8021, -0.9771, -0.1771, -0.1178, -0.9867, -0.1302, 0.0977, 0.5735, 0.0134, -0.8191, 0.6425, -0.1874, -0.743, 0.5567, 0.2564, -0.7902, 0.7859, 0.1328, -0.6039, 0.2546, 0.0224, -0.9668, 0.5372, -0.5044, -0.6761, 0.8064, 0.3614, -0.468, 0.6882, -0.1795, 0.703, 0.7656, -0.109, 0.634, 0.6935, -0.3242, 0.6434, -0.5085, 0.7503, 0.4226, -0.6161, 0.7115, 0.338, -0.3457, -0.2572, 0.9024, 0.5147, 0.2804, -0.8102, 0.562, 0.3632, -0.7431, 0.238, 0.4916, -0.8376, 0.8732, 0.143, -0.4658, 0.6497, -0.2538, -0.7165, -0.4797, 0.1491, 0.8646, -0.574, 0.2794, 0.7698, -0.4216, 0.2285, 0.8775, 0.8548, 0.3588, -0.375, 0.1665, -0.9698, 0.1781, 0.2273, -0.9319, 0.2828, 0.759, 0.2011, -0.6193, 0.8987, -0.4373, -0.0339, 0.9594, -0.2818, -0.0117, 0.617, -0.03, -0.7864, -0.3457, -0.2572, 0.9024, -0.4196, -0.0754, 0.9046, -0.1803, -0.3941, 0.9012, -0.6055, -0.4717, -0.641, -0.7639, 0.0451, -0.6438, -0.6604, -0.3598, -0.6591, 0.7859, 0.1328, -0.6039, -0.9925, -0.1092, -0.0549, 0.8638, 0.0249, -0.5032, 0.1821, -0.0134, -0.9832, -0.1503, -0.6955, 0.7026, -0.1995, -0.6017, 0.7734, 0.9341, 0.3303, 0.1351, -0.2376, 0.2553, 0.9372, -0.5846, 0.3661, 0.724, -0.2653, -0.9467, 0.1828, 0.5728, 0.1397, -0.8077, 0.6241, 0.0697, -0.7782, 0.351, 0.8128, 0.4649, 0.9298, 0.0651, 0.3621, 0.2067, -0.6459, -0.7349, 0.1359, 0.1044, -0.9852, -0.1415, 0.0151, -0.9898, 0.4093, -0.7032, -0.5813, 0.8257, -0.5211, 0.2161, 0.8101, -0.5195, 0.2718, 0.7611, -0.5837, 0.283, -0.908, -0.4165, -0.0461, 0.0798, 0.7081, 0.7016, 0.7141, 0.688, -0.1293, 0.4154, -0.0993, -0.9042, 0.6245, -0.4497, -0.6386, 0.4038, 0.5709, -0.7148, 0.4708, 0.2827, -0.8357, 0.0942, 0.8533, -0.5128, 0.9127, -0.2012, -0.3556, 0.6497, -0.2538, -0.7165, 0.4646, 0.4721, -0.7491, 0.7871, -0.546, -0.287, 0.925, -0.3158, -0.2111, 0.5973, 0.7425, 0.3031, 0.4831, 0.7023, 0.5228, 0.1982, 0.8929, 0.4044, 0.78, -0.6238, -0.0489, 0.7244, 0.6878, 0.046, 0.9073, 0.3894, -0.1589, 0.9341, 0.3303, 0.1351, -0.1405, -0.3456, 0.9278, 0.562, 0.3632, -0.7431, 0.8984, 0.3109, -0.3102, 0.2047, 0.2279, 0.9519, 0.6074, 0.5816, 0.5411, 0.3104, -0.0294, -0.9502, 0.0771, -0.9636, 0.256, -0.8109, 0.5177, -0.2728, -0.5085, 0.8032, -0.3104, -0.1983, 0.895, -0.3996, -0.0684, 0.9497, -0.3055, 0.6177, 0.2986, -0.7275, 0.5303, 0.469, -0.7063, 0.5848, -0.182, -0.7905, 0.5463, 0.0956, -0.8321, 0.2654, 0.5099, -0.8182, 0.8494, 0.2118, 0.4833, 0.9745, -0.1789, 0.1356, -0.4926, 0.0945, 0.8651, -0.603, 0.2991, 0.7396, -0.5262, 0.0736, 0.8472, -0.7836, -0.6063, -0.1354, 0.6124, -0.2868, -0.7367, 0.7934, -0.0544, -0.6063, 0.3959, 0.3034, -0.8667, 0.5455, -0.7275, 0.416, 0.9341, 0.3303, 0.1351, 0.9772, 0.1412, -0.1585, 0.8761, 0.4183, -0.2396, 0.9249, 0.2862, -0.2504, 0.5661, -0.6372, 0.523, 0.5463, 0.0956, -0.8321, 0.5549, 0.2294, -0.7997, 0.3959, 0.3034, -0.8667, -0.2003, 0.252, 0.9468, 0.4429, 0.7062, -0.5524, 0.2333, 0.7136, -0.6606, 0.4235, -0.1458, -0.8941, 0.3838, -0.4777, 0.7903, 0.8701, -0.176, 0.4604, -0.9156, 0.0337, -0.4007, -0.9566, 0.1184, -0.2663, -0.9467, -0.1719, -0.2723, -0.283, 0.7598, 0.5853, -0.8247, 0.2807, 0.491, -0.3296, 0.4455, 0.8324, 0.9421, 0.0344, -0.3336, 0.8759, 0.2346, -0.4217, 0.212, 0.6465, -0.7329, 0.8732, 0.143, -0.4658, 0.833, 0.2743, -0.4804, 0.0728, -0.8266, -0.5581, 0.1104, -0.2923, -0.9499, 0.3417, -0.7833, -0.5193, 0.8124, 0.3343, -0.4777, 0.6492, -0.6459, -0.4018, 0.402, 0.2579, -0.8786, 0.5463, 0.0956, -0.8321, 0.2822, 0.6046, -0.7448, 0.5549, 0.2294, -0.7997, -0.1232, -0.0245, 0.9921, -0.0684, -0.0265, 0.9973, -0.083, 0.0216, 0.9963, 0.3211, -0.047, -0.9459, 0.6497, -0.2538, -0.7165, 0.018, -0.9995, 0.0272, 0.0187, -0.9997, 0.0145, 0.0284, -0.9993, 0.023, 0.4306, -0.6497, 0.6264, -0.1405, -0.3456, 0.9278, 0.3838, -0.4777, 0.7903, 0.8984, 0.3109, -0.3102, 0.9728, 0.0596, -0.2238, -0.1381, 0.6166, 0.7751, 0.384, -0.888, 0.2529, 0.2916, -0.0144, -0.9564, 0.5463, 0.0956, -0.8321, 0.402, 0.2579, -0.8786, 0.5782, 0.1974, -0.7917, 0.5549, 0.2294, -0.7997, 0.2822, 0.6046, -0.7448, 0.5782, 0.1974, -0.7917, 0.1251, 0.3019, -0.9451, 0.8175, -0.0659, 0.5722, 0.8732, 0.143, -0.4658, 0.4646, 0.4721, -0.7491, 0.5327, -0.2261, -0.8156, 0.6124, -0.2868, -0.7367, -0.5061, 0.7919, 0.3417, -0.4741, 0.8392, 0.2664, -0.6894, 0.4636, 0.5566, 0.5455, -0.7275, 0.416, 0.9037, -0.048, 0.4256, 0.5327, -0.2261, -0.8156, -0.0901, -0.0221, 0.9957, 0.3067, 0.3076, -0.9007, 0.5782, 0.1974, -0.7917, 0.3111, 0.1412, -0.9398, 0.6497, -0.2538, -0.7165, 0.4646, 0.4721, -0.7491, 0.5327, -0.2261, -0.8156, 0.3067, 0.3076, -0.9007, 0.402, 0.2579, -0.8786, 0.9686, 0.2085, 0.1355, 0.4079, -0.3552, 0.8411, 0.2263, -0.5511, -0.8031, 0.9298, 0.0651, 0.3621, 0.6079, 0.204, -0.7674, 0.6079, 0.204, -0.7674, 0.9935, -0.1043, -0.0458, 0.3352, 0.4562, -0.8243, -0.1312, 0.7972, -0.5893, 0.6688, -0.013, -0.7433, 0.2654, 0.5099, -0.8182, -0.6617, -0.7465, 0.0696, -0.0397, 0.0902, 0.9951, -0.1824, 0.648, 0.7395, 0.3089, 0.7916, -0.5272, -0.7006, 0.6286, -0.3377, -0.7468, 0.5933, -0.3005, -0.9141, 0.3334, -0.2308, 0.7199, 0.0384, -0.693, 0.8308, -0.1416, -0.5383, -0.1642, 0.1241, 0.9786, 0.0877, 0.9242, 0.3718, -0.6921, -0.702, -0.1678, 0.8267, 0.5423, 0.1499, 0.9405, 0.2838, 0.1868, 0.931, 0.3613, -0.0512, 0.6497, -0.2538, -0.7165, 0.4462, -0.2257, -0.866, -0.0251, -0.0636, 0.9977, -0.0296, -0.0819, 0.9962, -0.0073, -0.0304, 0.9995, 0.4646, 0.4721, -0.7491, 0.4646, 0.4721, -0.7491, 0.6688, -0.013, -0.7433, -0.1312, 0.7972, -0.5893, 0.1731, 0.6328, -0.7547, -0.8215, 0.4172, -0.3886, -0.9632, 0.1466, -0.2252, -0.9293, 0.2524, -0.2696, 0.9311, -0.3541, 0.0875, -0.8899, -0.4045, -0.211, -0.9855, 0.1268, -0.1127, 0.943, -0.3155, 0.1054, 0.9622, -0.2307, 0.1445, 0.9977, -0.0658, 0.0138, 0.943, -0.3155, 0.1054, 0.9963, 0.0793, 0.0317, 0.8885, 0.4461, -0.1076, 0.9556, 0.2743, -0.1076, -0.9055, -0.423, 0.034, -0.5367, 0.1067, -0.837, -0.7508, 0.2104, -0.6262, -0.6148, -0.3593, -0.7021, -0.7274, -0.6186, -0.2969, -0.9775, -0.0361, -0.2078, -0.3372, -0.6507, -0.6803, 0.0274, -0.9995, -0.016, 0.2716, -0.9624, 0.0101, -0.8778, 0.3213, -0.3554, -0.8916, -0.0242, -0.4521, -0.9649, 0.0477, -0.2583, -0.9173, 0.3517, -0.1865, -0.5019, 0.5114, 0.6976, -0.8804, 0.4419, -0.1721, 0.9883, 0.1448, -0.0478, -0.9992, 0.028, 0.0272, 0.6351, 0.1975, 0.7468, -0.9359, -0.2641, 0.233, 0.6785, -0.2432, 0.6932, 0.2314, -0.7658, -0.6, 0.3376, -0.7371, -0.5854, 0.2856, -0.8915, -0.3517, 0.0763, -0.9904, 0.1153, 0.0209, -0.9962, 0.085, 0.1967, -0.9805, -0.0002, 0.5283, 0.1084, 0.8421, 0.6346, 0.1623, 0.7556, 0.9686, 0.2085, 0.1355, 0.8994, 0.2648, -0.3477, 0.9514, -0.1603, 0.2631, -0.9494, -0.0554, 0.3091, 0.6073, -0.5571, 0.5664, -0.9377, 0.2563, -0.2345, -0.8687, 0.27, -0.4154, 0.9514, -0.1603, 0.2631, -0.6936, 0.6118, 0.3803, 0.9648, 0.2262, -0.1342, 0.752, -0.5628, 0.3432, -0.9618, 0.1969, 0.1901, -0.851, 0.3397, 0.4004, -0.8753, -0.2974, 0.3812, 0.569, -0.5258, 0.6323, 0.4078, -0.8399, 0.3581, 0.9294, 0.2665, 0.2553, 0.1326, 0.8151, 0.564, 0.1887, 0.8095, 0.556, 0.1956, 0.8429, 0.5012, 0.8005, -0.2476, 0.5458, 0.8136, -0.0311, 0.5805, 0.7122, -0.1318, 0.6895, 0.8136, -0.0311, 0.5805, 0.2477, -0.1742, 0.953, -0.046, -0.0163, 0.9988, -0.1974, -0.6474, 0.7361, 0.7725, -0.4499, 0.4482, 0.7357, -0.3508, 0.5795, 0.4599, -0.3982, 0.7937, 0.8308, -0.1416, -0.5383, 0.3388, -0.6311, 0.6978, 0.7933, 0.5455, -0.2704, -0.9142, 0.2146, 0.3438, -0.946, 0.0742, 0.3154, 0.7529, 0.0536, 0.6559, 0.7352, -0.0512, 0.676, 0.7538, -0.0688, 0.6535, 0.9704, -0.1176, -0.211, 0.9624, -0.2656, 0.0562, -0.0013, 0.3662, 0.9305, -0.1381, 0.6166, 0.7751, -0.3296, 0.4455, 0.8324, -0.8824, -0.3252, -0.3401, -0.7381, -0.5247, 0.4241, -0.7852, 0.4275, -0.448, -0.8305, 0.5569, -0.0106, -0.8404, -0.534, -0.0923, 0.8136, -0.0311, 0.5805, 0.8596, 0.1279, 0.4947, 0.7383, 0.2949, 0.6066, 0.1016, 0.2161, 0.9711, 0.008, 0.6046, 0.7965, -0.0378, 0.2688, 0.9625, 0.8493, 0.4947, -0.1843, -0.2207, -0.8457, 0.4859, -0.3739, -0.511, 0.774, 0.5992, 0.0872, 0.7958, 0.6754, -0.0052, 0.7374, 0.9704, -0.1176, -0.211, 0.7816, 0.2643, 0.565, 0.6901, 0.1836, 0.7, 0.7678, 0.2692, 0.5813, -0.9728, -0.2294, -0.032, -0.6906, -0.7061, -0.1568, -0.8954, -0.049, 0.4426, -0.8241, -0.333, 0.4581, 0.7869, -0.1163, 0.606, 0.9963, 0.0793, 0.0317, -0.946, 0.0742, 0.3154, -0.942, -0.0492, 0.332, 0.7484, -0.2141, 0.6277, 0.8146, -0.2335, 0.5309, 0.6831, -0.1539, 0.714, 0.646, -0.1296, 0.7523, 0.6202, -0.0303, 0.7839, -0.8949, 0.0123, 0.4462, -0.8241, -0.333, 0.4581, 0.1904, 0.9333, 0.3046, 0.1699, 0.971, 0.1683, 0.2601, 0.9431, 0.207, -0.026, 0.8425, 0.5381, 0.0045, 0.8558, 0.5173, -0.0023, 0.7169, 0.6972, -0.3144, -0.5255, 0.7906, -0.2988, -0.246, 0.9221, 0.4079, -0.3552, 0.8411, -0.1743, 0.8075, -0.5635, 0.6005, -0.7096, -0.3687, 0.7193, -0.5993, -0.3513, -0.9916, -0.1113, -0.0661, -0.9978, 0.0585, -0.0305, 0.6732, 0.3908, 0.6277, 0.9883, 0.1448, -0.0478, 0.8805, -0.3447, -0.3255, 0.8136, -0.0311, 0.5805, 0.8198, -0.3143, 0.4788, 0.8028, -0.5072, 0.3135, -0.9744, -0.164, -0.1541, 0.5888, -0.7793, 0.2147, 0.8427, 0.4497, -0.296, -0.4821, -0.42, -0.7689, -0.3426, -0.5182, -0.7837, -0.5451, 0.6153, 0.5694, 0.3889, 0.9099, -0.1445, -0.2478, 0.6515, 0.717, -0.2494, 0.8953, 0.369, -0.5184, 0.747, 0.4162, 0.8272, 0.0014, 0.5619, 0.8487, -0.1402, 0.5099, -0.574, 0.2794, 0.7698, -0.6882, 0.2797, 0.6694, -0.5449, 0.3668, 0.7541, 0.8867, -0.2303, 0.4009, 0.7579, -0.3511, 0.5498, 0.7092, -0.6617, 0.2433, 0.6832, -0.6141, 0.3952, 0.5665, -0.7809, 0.2634, 0.8805, -0.3447, -0.3255, -0.5793, 0.7146, -0.3922, -0.8859, 0.4231, -0.1903, 0.8365, -0.2968, 0.4606, 0.4313, -0.5356, -0.726, 0.5601, -0.8042, -0.199, 0.3945, -0.9064, -0.1511, -0.3872, 0.7885, -0.4778, -0.5688, 0.8053, -0.167, -0.458, 0.7501, -0.4771, -0.9575, 0.1205, 0.2621, -0.9387, 0.3006, -0.169, -0.0483, -0.9519, 0.3027, 0.1248, -0.721, 0.6816, 0.112, -0.9577, 0.2651, 0.6179, 0.0396, 0.7852, 0.2782, 0.1207, 0.9529, -0.1545, -0.3408, 0.9273, -0.6699, -0.3351, 0.6625, -0.501, 0.8648, 0.0324, -0.3892, 0.8541, -0.3449, -0.7259, 0.5977, -0.3403, -0.9217, -0.1295, 0.3657, 0.1909, -0.7971, -0.5729, 0.3119, -0.6687, 0.6749, -0.843, 0.2014, 0.4988, -0.7776, 0.4948, 0.3879, -0.6843, 0.4033, 0.6076, -0.2106, 0.6975, 0.6849, -0.1146, 0.4853, 0.8668, -0.33, 0.4948, 0.8039, 0.6706, 0.4372, 0.5993, 0.7678, 0.2692, 0.5813, 0.6014, 0.3445, 0.7208, 0.7678, 0.2692, 0.5813, -0.7185, -0.6535, -0.2381, 0.9166, 0.1823, -0.3559, 0.8732, 0.143, -0.4658, -0.4367, -0.3622, -0.8235, -0.6393, -0.2016, -0.7421, -0.0432, 0.3018, 0.9524, -0.2834, -0.7517, 0.5956, 0.2349, -0.4615, -0.8555, -0.8241, -0.333, 0.4581, 0.6204, -0.0033, 0.7843, -0.0192, -0.3963, 0.9179, 0.0006, -0.3649, 0.931, 0.5464, -0.7627, -0.346, 0.7658, 0.5779, 0.2821, -0.1133, 0.652, 0.7497, 0.92, 0.3374, -0.1993, -0.8225, 0.5144, 0.2425, -0.7058, 0.662, -0.2522, 0.915, -0.1313, 0.3814, 0.8431, 0.4814, -0.2397, 0.7678, 0.2692, 0.5813, -0.1028, 0.9062, 0.4101, 0.072, 0.8874, 0.4554, -0.0101, 0.8467, 0.5319, -0.7058, 0.662, -0.2522, -0.9387, 0.3006, -0.169, -0.6434, 0.5378, -0.5448, 0.7697, -0.3431, 0.5384, 0.2837, 0.4986, 0.8191, 0.5935, 0.0465, 0.8035, 0.1943, 0.4336, 0.8799, 0.643, -0.1254, 0.7556, -0.8569, 0.3878, -0.3395, 0.7552, 0.5495, -0.3573, 0.8027, 0.5711, 0.1716, 0.4818, -0.2796, 0.8305, 0.0019, -0.9947, -0.1025, 0.0077, -0.9954, -0.0959, -0.0797, -0.817, -0.5711, -0.1223, -0.7419, -0.6592, 0.0301, -0.986, -0.1643, -0.5019, 0.5114, 0.6976, -0.8241, -0.333, 0.4581, -0.6647, -0.4326, 0.6091, -0.6435, -0.4738, 0.6012, -0.2882, -0.7499, 0.5955, -0.9704, 0.1856, 0.1546, -0.9064, -0.3946, 0.1509, 0.92, 0.3374, -0.1993, -0.8705, -0.3764, 0.3171, -0.851, 0.3397, 0.4004, -0.8225, 0.5144, 0.2425, 0.5381, 0.4622, -0.7048, 0.6477, 0.2172, -0.7303, 0.707, -0.6284, -0.3245, -0.2093, -0.5257, 0.8245, 0.9084, 0.3214, -0.2675, 0.1711, -0.4312, 0.8859, 0.9567, 0.1185, -0.266, -0.2254, -0.6102, -0.7595, -0.5869, -0.7301, -0.35, -0.2433, -0.8494, -0.4683, 0.8732, 0.143, -0.4658, -0.5198, 0.6201, -0.5876, 0.2562, 0.4215, 0.8699, 0.1278, 0.4821, 0.8667, 0.1881, 0.6722, 0.716, 0.6713, 0.0596, 0.7388, 0.9249, 0.2862, -0.2504, -0.2988, -0.246, 0.9221, 0.9567, 0.1674, -0.2382, 0.6718, -0.7289, -0.1322, -0.3209, -0.2452, 0.9148, -0.7689, -0.2067, 0.6051, 0.9127, 0.2927, -0.2852, 0.8305, 0.4576, -0.3176, 0.9127, 0.2927, -0.2852, 0.8311, 0.3579, -0.4256, -0.7588, -0.5758, -0.3045, -0.85, -0.4116, -0.3288, -0.7855, -0.5745, -0.2301, 0.8305, 0.4576, -0.3176, 0.8431, 0.4814, -0.2397, -0.1942, -0.2493, 0.9488, -0.4823, -0.259, 0.8368, -0.2988, -0.246, 0.9221, 0.9012, 0.3539, -0.2503, 0.9127, 0.2927, -0.2852, 0.6361, -0.6877, -0.3498, 0.0632, -0.9766, 0.2058, -0.0469, -0.9982, 0.0371, 0.0092, -0.8945, 0.4469, 0.5417, -0.3546, 0.7621, 0.5455, -0.7275, 0.416, 0.8209, 0.5381, -0.1914, -0.7797, -0.0396, 0.6249, 0.931, 0.3613, -0.0512, 0.5606, 0.7417, -0.3682, 0.6665, 0.7364, -0.1162, 0.6465, 0.648, -0.4027, 0.8761, 0.4183, -0.2396, 0.6443, 0.7619, 0.0664, -0.5683, -0.7661, 0.3002, -0.5462, 0.7774, -0.3119, 0.7596, 0.6273, -0.1721, 0.7005, 0.5883, -0.4039, 0.9372, 0.1781, -0.3, 0.8529, 0.4785, -0.2086, 0.1592, 0.8692, -0.4681, 0.8529, 0.4785, -0.2086, 0.5087, 0.7224, -0.4684, 0.4467, 0.8529, 0.2702, 0.8267, 0.5423, 0.1499, 0.7463, 0.6636, 0.0508, 0.9341, 0.3303, 0.1351, 0.5413, 0.8089, -0.2296, 0.3153, 0.7958, -0.5169, 0.3153, 0.7958, -0.5169, 0.3153, 0.7958, -0.5169, -0.0792, 0.9892, -0.123, -0.0839, 0.9518, -0.2949, -0.56, 0.8271, 0.0485, 0.1263, 0.9389, -0.3201, 0.0005, 0.9523, -0.3052, 0.6026, 0.6997, -0.3839, 0.5973, 0.7425, 0.3031, 0.3234, 0.9323, 0.1621, 0.2848, 0.9578, -0.0395, 0.1909, 0.9407, -0.2804, 0.3153, 0.7958, -0.5169, 0.8494, 0.2118, 0.4833, 0.1909, 0.9407, -0.2804, -0.0964, 0.9124, -0.3979, 0.3153, 0.7958, -0.5169, -0.2114, 0.7854, -0.5817, 0.2807, 0.4438, -0.851, 0.1731, 0.6328, -0.7547, 0.3153, 0.7958, -0.5169, 0.0246, 0.999, 0.0362, 0.2848, 0.9578, -0.0395, 0.3234, 0.9323, 0.1621, -0.0837, 0.9884, -0.1268, 0.0636, 0.9694, 0.2372, 0.205, 0.9282, -0.3106, 0.266, 0.7243, -0.6362, 0.205, 0.9282, -0.3106, 0.7005, 0.5883, -0.4039, -0.621, 0.4376, 0.6503, 0.581, 0.8131, 0.0368, 0.351, 0.8128, 0.4649, 0.581, 0.8131, 0.0368, 0.0288, 0.4082, 0.9124, -0.0456, 0.6976, -0.7151, 0.0944, 0.9954, -0.0149, 0.25, 0.9675, 0.0393, 0.8761, 0.4183, -0.2396, 0.6074, 0.5816, 0.5411, 0.6665, 0.7364, -0.1162, -0.1663, 0.8859, -0.4331, -0.1757, 0.8897, -0.4214, 0.1754, 0.8461, -0.5033, -0.7879, 0.4057, 0.4633, -0.4058, 0.8964, 0.178, -0.4058, 0.8964, 0.178, 0.1445, 0.9844, -0.1003, 0.0503, 0.9802, -0.1913, -0.4058, 0.8964, 0.178, -0.4058, 0.8964, 0.178, 0.0226, 0.9098, -0.4144, 0.3374, 0.8845, 0.3221, 0.3377, 0.93, 0.1452, 0.1913, 0.9549, 0.2271, -0.0179, 0.9987, 0.0481, -0.6792, 0.5145, 0.5235, 0.1097, 0.9852, 0.132, 0.0248, 0.9981, 0.056, -0.0849, 0.9946, 0.0591, 0.6465, 0.648, -0.4027, 0.2641, 0.9644, -0.0109, 0.322, 0.9467, 0.0041, 0.1738, 0.9572, -0.2315, 0.8209, 0.5381, -0.1914, 0.5942, 0.7356, -0.3254, 0.2955, 0.8624, -0.4111, 0.3452, 0.7805, -0.5211, 0.0308, 0.8805, -0.4731, -0.9295, -0.3145, -0.1927, 0.6738, 0.2103, 0.7083, 0.5606, 0.7417, -0.3682, -0.7995, 0.5149, -0.3093, -0.4367, -0.6125, -0.6589, -0.8961, -0.1624, -0.4131, -0.4058, 0.8964, 0.178, -0.6991, 0.6669, 0.2579, -0.9041, 0.0862, 0.4185, -0.0786, 0.9961, 0.0388, 0.3377, 0.93, 0.1452, 0.5466, 0.7706, -0.3277, 0.238, 0.4916, -0.8376, -0.1937, 0.7036, -0.6837, 0.7409, 0.5326, -0.4092, 0.8699, 0.3737, -0.3219, 0.8334, 0.4824, -0.2695, 0.9341, 0.3303, 0.1351, -0.0299, 0.9048, -0.4248, 0.7409, 0.5326, -0.4092, 0.5466, 0.7706, -0.3277, -0.401, 0.9036, -0.1505, 0.1556, 0.7861, 0.5982, 0.0153, 0.9989, -0.0436, -0.0786, 0.9961, 0.0388, 0.2211, 0.9543, 0.201, 0.238, 0.4916, -0.8376, 0.0086, 0.9442, -0.3293, 0.1754, 0.8461, -0.5033, 0.3452, 0.7805, -0.5211, -0.4687, 0.7804, -0.4138, -0.7301, 0.5939, -0.338, 0.0148, 0.9274, 0.3737, -0.3661, -0.1858, 0.9118, -0.2824, -0.2497, 0.9262, 0.7463, 0.6636, 0.0508, 0.8471, 0.5198, -0.1104, 0.5466, 0.7706, -0.3277, -0.9864, 0.1299, -0.1009, 0.0031, 0.8196, -0.5729, -0.5244, 0.8146, 0.2478, -0.8789, 0.2865, -0.3813, -0.9065, 0.4076, -0.11, -0.9779, 0.1982, -0.0665, 0.943, -0.3155, 0.1054, 0.7409, 0.5326, -0.4092, -0.0786, 0.9961, 0.0388, -0.1438, 0.9503, 0.2761, 0.1699, 0.971, 0.1683, 0.322, 0.9467, 0.0041, 0.2359, 0.9672, 0.0942, -0.0786, 0.9961, 0.0388, -0.693, 0.7194, 0.0469, -0.8578, 0.4996, 0.1206, 0.6464, 0.6035, -0.4669, -0.5437, 0.5026, 0.6721, -0.5261, 0.228, 0.8193, -0.7785, 0.3038, 0.5492, 0.8267, 0.5423, 0.1499, 0.814, 0.5807, 0.0151, -0.8558, 0.2582, -0.4483, -0.9005, 0.3042, -0.3108, 0.2693, 0.275, -0.923, 0.7712, 0.6152, -0.1634, -0.9956, -0.0931, 0.0121, -0.0786, 0.9961, 0.0388, -0.4058, 0.8964, 0.178, 0.7695, 0.6369, -0.0472, 0.8471, 0.5198, -0.1104, -0.4058, 0.8964, 0.178, -0.4058, 0.8964, 0.178, 0.2601, 0.9431, 0.207, 0.2359, 0.9672, 0.0942, -0.0689, -0.2059, 0.9761, 0.027, -0.3539, 0.9349, 0.833, 0.2743, -0.4804, 0.3089, 0.7916, -0.5272, 0.0059, 0.8103, -0.586, -0.6853, 0.7282, -0.0057, 0.7685, 0.5626, 0.3046, 0.536, 0.6054, -0.5884, 0.5688, 0.7169, -0.4031, -0.6206, 0.5385, -0.5699, -0.5103, 0.7689, -0.3852, 0.0486, 0.3271, 0.9437, 0.007, 0.5046, 0.8633, 0.2188, 0.3385, 0.9152, 0.7539, 0.6567, 0.0185, 0.6982, 0.7013, -0.1437, 0.6407, 0.7125, -0.286, 0.2359, 0.9672, 0.0942, 0.7597, 0.6367, 0.1321, 0.6739, 0.7388, -0.0052, 0.6023, 0.7825, -0.1576, 0.6765, 0.6347, 0.3735, 0.686, 0.6852, 0.2448, 0.7685, 0.5626, 0.3046, -0.8967, 0.2246, 0.3813, 0.1699, 0.971, 0.1683, 0.8334, 0.4824, -0.2695, -0.0737, 0.9226, 0.3787, -0.5215, 0.2487, 0.8162, 0.6381, 0.7586, 0.1315, 0.5108, 0.7968, -0.3229, 0.4467, 0.8529, 0.2702, 0.7637, 0.5127, 0.3922, -0.7853, -0.5813, -0.213, 0.3897, 0.8437, -0.3691, -0.8305, 0.5569, -0.0106, -0.6936, 0.6118, 0.3803, 0.0387, 0.8765, -0.4799, 0.569, 0.8201, 0.0604, 0.5546, 0.831, -0.0433, 0.4692, 0.861, -0.1964, 0.3486, 0.7925, -0.5005, 0.5745, 0.7602, 0.3034, 0.562, 0.8099, 0.1681, 0.4467, 0.8529, 0.2702, 0.322, 0.9467, 0.0041, 0.1699, 0.971, 0.1683, 0.4293, 0.8981, -0.0958, 0.3352, 0.4562, -0.8243, 0.3967, 0.8759, -0.2745, 0.322, 0.9467, 0.0041, 0.4467, 0.8529, 0.2702, 0.7912, -0.0179, -0.6112, 0.4979, 0.8216, 0.2777, 0.2062, 0.8043, -0.5572, 0.2062, 0.8043, -0.5572, 0.9648, 0.2262, -0.1342, 0.0288, 0.2139, 0.9764, 0.3774, 0.9258, -0.019, 0.2062, 0.8043, -0.5572, 0.2062, 0.8043, -0.5572, -0.7508, 0.3823, 0.5387, 0.3774, 0.9258, -0.019, 0.8334, 0.4824, -0.2695, -0.8048, -0.2145, 0.5534, -0.4186, -0.4286, 0.8007, -0.8434, -0.5372, 0.0078, -0.5206, 0.641, -0.564, -0.8431, -0.3533, -0.4054, -0.631, 0.4884, -0.6027, -0.5499, 0.7613, -0.3435, -0.9687, -0.0681, 0.2389, -0.3448, -0.8301, -0.4383, -0.2692, -0.8898, -0.3686, -0.7995, 0.5149, -0.3093, -0.3675, 0.8042, -0.4671, -0.4946, 0.7199, -0.4869, -0.3912, 0.5512, -0.737, -0.6742, 0.517, -0.5274, -0.3805, 0.7864, -0.4866, -0.2663, 0.6915, -0.6715, -0.2663, 0.6915, -0.6715, -0.396, 0.0351, -0.9176, -0.572, -0.0736, 0.8169, -0.3365, -0.0714, 0.939, -0.4196, -0.0754, 0.9046, -0.5772, 0.2152, 0.7877, -0.4153, 0.5222, -0.7448, -0.4547, 0.6978, -0.5535, -0.804, -0.375, -0.4614, -0.6978, -0.3101, -0.6457, -0.8051, 0.2513, -0.5373, -0.1992, -0.7446, 0.6371, -0.8107, -0.3235, -0.4879, -0.8056, -0.3236, -0.4963, -0.8695, 0.0779, -0.4877, -0.6686, -0.7206, 0.1838, -0.4116, 0.051, -0.9099, -0.7186, 0.4457, -0.5338, 0.1728, 0.3484, 0.9213, 0.0205, -0.9996, 0.0203, 0.2949, -0.9535, 0.0618, 0.1409, -0.9886, 0.0528, -0.7867, 0.4493, 0.4233, -0.6083, 0.4789, -0.633, -0.4153, 0.5222, -0.7448, -0.5505, 0.2369, -0.8005, -0.7318, -0.2227, -0.6441, -0.0185, 0.1077, 0.994, -0.6761, 0.4443, -0.5877, -0.4189, 0.2493, 0.8731, -0.7198, 0.252, -0.6468, -0.6903, 0.7012, 0.1785, -0.621, -0.3582, -0.6972, -0.9843, 0.1091, -0.1388, -0.9274, 0.334, -0.1687, -0.6147, 0.3767, -0.693, -0.7145, 0.2915, -0.636, -0.6761, 0.4443, -0.5877, -0.2793, 0.3614, -0.8896, -0.4113, -0.2704, -0.8704, -0.7936, -0.0521, -0.6062, -0.2785, 0.0814, 0.957, -0.2999, 0.1605, 0.9404, -0.3743, 0.1078, 0.921, -0.3618, 0.0241, 0.932, -0.345, 0.1412, 0.9279, -0.3621, 0.1106, 0.9255, -0.7915, -0.0039, 0.6112, -0.6544, -0.2387, 0.7175, -0.6704, -0.6263, -0.398, -0.29, -0.8602, -0.4194, -0.7465, 0.2603, -0.6124, -0.9785, 0.0877, -0.1866, -0.4168, 0.8526, -0.3151, 0.29, 0.1892, -0.9381, 0.943, -0.3155, 0.1054, -0.492, 0.7194, -0.4902, 0.9294, 0.2665, 0.2553, -0.8305, 0.5569, -0.0106, -0.4113, -0.2704, -0.8704, -0.2444, -0.8308, -0.5, -0.9065, 0.4076, -0.11, -0.8578, 0.4996, 0.1206, -0.9779, 0.1982, -0.0665, -0.6917, -0.3343, -0.6402, 0.2263, -0.5511, -0.8031, -0.9274, 0.334, -0.1687, -0.8356, 0.5443, 0.0737, -0.5773, 0.5212, -0.6285, -0.4789, 0.649, -0.5912, -0.7301, 0.5939, -0.338, 0.5251, 0.7066, 0.4742, -0.3805, 0.7864, -0.4866, 0.0491, 0.4332, -0.9, -0.2256, -0.2156, -0.9501, -0.4885, -0.2179, -0.8449, -0.488, -0.0715, -0.8699, -0.6742, 0.517, -0.5274, -0.3621, 0.1106, 0.9255, -0.9718, 0.1327, 0.1951, -0.1826, -0.1071, -0.9773, -0.644, 0.1175, -0.7559, -0.7204, 0.0946, -0.687, -0.3315, 0.0475, -0.9423, -0.9291, -0.2325, 0.2876, -0.6257, -0.3442, -0.7, -0.6329, -0.4813, -0.6065, -0.8501, 0.4289, 0.3055, -0.9703, 0.0266, 0.2406, 0.1879, -0.5515, 0.8127, 0.2241, -0.6477, 0.7282, -0.6335, -0.1645, -0.7561, -0.3866, -0.3102, -0.8685, -0.7648, 0.2533, -0.5924, -0.7204, 0.0946, -0.687, -0.7204, 0.0946, -0.687, -0.62, -0.0002, -0.7846, 0.3153, 0.7958, -0.5169, -0.5197, 0.4988, -0.6936, -0.5168, 0.7111, -0.4766, -0.3645, 0.1914, 0.9113, -0.4486, 0.343, 0.8253, -0.3429, 0.3473, 0.8728, -0.7524, -0.0206, -0.6584, -0.6922, -0.1349, -0.709, -0.1023, -0.3649, -0.9254, -0.5269, -0.3615, 0.7692, -0.0274, -0.516, -0.8561, -0.0334, 0.2033, 0.9785, -0.057, 0.2596, 0.964, -0.9237, 0.3814, -0.0363, -0.7888, 0.6006, 0.1305, -0.5011, 0.1425, 0.8536, -0.6455, 0.2773, 0.7117, -0.4946, 0.194, 0.8472, -0.765, 0.393, -0.5102, -0.7776, 0.4948, 0.3879, -0.843, 0.2014, 0.4988, 0.2693, 0.3002, 0.9151, 0.4346, 0.3153, 0.8436, 0.4083, 0.3056, 0.8602, -0.7751, -0.6101, 0.1642, -0.7898, 0.1255, -0.6004, -0.6194, 0.1541, 0.7698, -0.8901, 0.2088, -0.4051, 0.8308, -0.1416, -0.5383, 0.5381, 0.4622, -0.7048, 0.707, -0.6284, -0.3245, -0.7204, 0.0946, -0.687, -0.7692, 0.4217, -0.4801, -0.9237, 0.3814, -0.0363, -0.7343, 0.6528, -0.1861, -0.7888, 0.6006, 0.1305, -0.7463, 0.1356, -0.6516, -0.7343, 0.6528, -0.1861, -0.2839, -0.238, 0.9288, -0.5239, 0.3662, 0.769, -0.7204, 0.0946, -0.687, -0.337, 0.1219, 0.9336, -0.4113, -0.2704, -0.8704, -0.9497, -0.2984, -0.095, -0.6791, 0.1133, -0.7253, -0.4028, -0.913, -0.0645, -0.7692, 0.4217, -0.4801, -0.8768, -0.252, -0.4095, -0.8432, -0.0782, -0.5318, -0.8268, 0.1332, -0.5465, -0.492, 0.7194, -0.4902, -0.7204, 0.0946, -0.687, -0.7079, 0.3614, -0.6068, -0.6206, 0.5385, -0.5699, -0.2793, 0.3614, -0.8896, -0.3098, 0.731, -0.6079, -0.5168, 0.7111, -0.4766, -0.6955, 0.4623, 0.5501, -0.7594, -0.2303, -0.6085, -0.7465, 0.2603, -0.6124, -0.6742, 0.517, -0.5274, -0.7639, 0.0451, -0.6438, -0.5168, 0.7111, -0.4766, -0.492, 0.7194, -0.4902, -0.8449, -0.1832, -0.5025, -0.7867, 0.25, -0.5644, -0.4626, -0.7704, 0.4386, -0.375, -0.1599, -0.9131, -0.6483, 0.0655, -0.7586, -0.6761, 0.4104, -0.6119, -0.7587, 0.0358, -0.6505, -0.7465, 0.2603, -0.6124, -0.525, -0.0088, 0.8511, -0.3098, 0.731, -0.6079, -0.2907, -0.0486, 0.9556, -0.116, -0.1999, 0.9729, -0.7013, 0.1678, -0.6928, -0.6761, 0.4104, -0.6119, -0.1082, -0.8827, -0.4573, -0.1226, 0.1324, 0.9836, 0.4525, 0.7802, 0.4319, -0.6458, 0.6117, -0.4569, -0.7814, -0.0759, -0.6194, -0.9141, 0.3334, -0.2308, -0.7468, 0.5933, -0.3005, -0.757, -0.3795, -0.5319, -0.7107, 0.2249, -0.6666, -0.3943, 0.8883, 0.2355, -0.0684, 0.9497, -0.3055, -0.7143, 0.4094, -0.5677, -0.6515, 0.5423, -0.5306, 0.943, -0.3155, 0.1054, -0.6121, 0.4772, -0.6306, -0.6121, 0.4772, -0.6306, -0.7696, -0.159, -0.6184, -0.7781, 0.0781, -0.6233, -0.7679, -0.3583, -0.531, 0.1466, 0.2225, 0.9638, 0.1751, 0.4221, 0.8895, 0.1628, 0.2844, 0.9448, -0.3442, 0.0336, 0.9383, -0.5722, 0.0979, 0.8142, -0.5173, -0.0399, 0.8549, -0.4153, 0.5222, -0.7448, -0.719, -0.561, -0.4103, 0.1139, -0.116, 0.9867, 0.2107, -0.6023, 0.7699, 0.0337, 0.2299, 0.9726, -0.8137, 0.1367, -0.5649, -0.0315, 0.137, 0.9901, -0.6115, 0.7756, -0.1564, -0.5168, 0.7111, -0.4766, -0.492, 0.7194, -0.4902, -0.7143, 0.4094, -0.5677, -0.7259, 0.5977, -0.3403, -0.6975, -0.0383, 0.7156, -0.56, -0.144, 0.8159, -0.6057, -0.2791, 0.7451, -0.5088, -0.1622, 0.8454, -0.4191, 0.0092, 0.9079, -0.2117, -0.9719, -0.1025, 0.0121, -0.9997, -0.0204, -0.7888, 0.6006, 0.1305, -0.839, 0.5283, -0.1304, -0.839, 0.5283, -0.1304, -0.3927, 0.4288, 0.8136, -0.4605, 0.1701, -0.8712, -0.3611, 0.8286, -0.4278, -0.6115, 0.7756, -0.1564, -0.3907, -0.5944, -0.7029, -0.0265, 0.3908, 0.9201, -0.6168, -0.4648, -0.6352, -0.3611, 0.8286, -0.4278, -0.1937, 0.7036, -0.6837, -0.4503, 0.804, -0.3883, -0.5292, -0.0067, 0.8484, 0.3152, -0.4527, 0.8341, -0.7639, 0.0451, -0.6438, -0.7879, 0.4057, 0.4633, -0.6664, 0.5819, 0.4661, -0.839, 0.5283, -0.1304, -0.3555, -0.0777, 0.9314, 0.3955, -0.0816, 0.9148, 0.3458, 0.4463, 0.8254, 0.3598, 0.4224, 0.8319, 0.3225, 0.3192, 0.8911, -0.068, 0.7402, 0.6689, -0.0163, 0.5921, 0.8057, -0.0369, 0.6244, 0.7802, 0.2047, 0.2279, 0.9519, -0.4221, 0.0787, 0.9031, 0.0579, 0.718, 0.6937, -0.0478, 0.3906, 0.9193, -0.1808, 0.6371, 0.7493, 0.1331, 0.8589, 0.4946, 0.1694, 0.7143, 0.6791, 0.1133, 0.6145, 0.7807, -0.0459, 0.7271, 0.685, 0.1499, 0.7352, 0.6611, 0.3109, 0.6961, 0.6472, 0.3744, 0.4802, 0.7932, 0.5723, 0.2867, 0.7683, -0.8427, -0.3173, 0.435, -0.4113, 0.6181, 0.6699, -0.3249, 0.3614, 0.874, -0.353, 0.4074, 0.8423, -0.6336, -0.2853, 0.7192, -0.6532, -0.5175, 0.5527, -0.6477, -0.3038, 0.6987, -0.4599, -0.3581, 0.8126, -0.9041, 0.0862, 0.4185, -0.9633, 0.0218, 0.2677, -0.8845, -0.0943, 0.4569, -0.7314, -0.4431, 0.5183, -0.4637, -0.6455, 0.6068, -0.9355, -0.1949, 0.2948, -0.5289, -0.6012, 0.599, -0.4637, -0.6455, 0.6068, -0.5289, -0.6012, 0.599, -0.6336, -0.2853, 0.7192, -0.6082, -0.6037, 0.5154, -0.4637, -0.6455, 0.6068, -0.9822, 0.062, 0.1775, -0.9625, 0.0121, 0.2711, -0.9687, -0.0681, 0.2389, -0.7587, -0.5207, 0.3915, -0.612, 0.7574, 0.2276, -0.4637, -0.6455, 0.6068, -0.5535, -0.6516, 0.5187, -0.5535, -0.6516, 0.5187, -0.9111, -0.3273, 0.2505, -0.9663, -0.1607, 0.2012, -0.4637, -0.6455, 0.6068, -0.6178, -0.6699, 0.4118, -0.6082, -0.6037, 0.5154, -0.6178, -0.6699, 0.4118, -0.8575, -0.4285, 0.2846, -0.7587, -0.5207, 0.3915, -0.0168, 0.7844, 0.6201, -0.693, 0.7194, 0.0469, -0.9111, -0.3273, 0.2505, -0.9956, -0.0931, 0.0121, 0.2911, 0.5765, 0.7635, 0.2597, 0.476, 0.8402, -0.5271, 0.734, 0.4283, -0.5446, 0.6821, 0.488, -0.2938, -0.9395, 0.1758, -0.9064, -0.3946, 0.1509, -0.4689, -0.8314, 0.2981, -0.9789, 0.1556, 0.1324, -0.0184, 0.598, 0.8013, 0.0291, 0.527, 0.8494, -0.05, 0.7381, 0.6729, -0.1094, -0.9897, -0.0923, -0.1029, -0.9877, -0.1179, -0.1568, -0.9737, -0.1653, -0.3933, -0.8977, 0.1988, -0.1468, -0.9888, -0.0265, -0.399, -0.8905, 0.2185, -0.1189, 0.7216, 0.682, -0.0922, 0.3801, 0.9204, -0.7196, -0.3245, 0.6139, -0.7464, -0.3034, 0.5923, -0.8256, -0.1437, 0.5456, -0.8529, 0.1125, 0.5098, -0.9263, -0.3501, 0.1392, 0.6314, 0.4272, 0.6471, 0.5393, 0.3436, 0.7688, -0.7838, -0.363, 0.5038, -0.8676, -0.2944, 0.4008, -0.3909, 0.7681, 0.5072, -0.676, 0.5781, 0.457, -0.8546, 0.3118, 0.4152, -0.6966, -0.6313, 0.341, -0.6966, -0.6313, 0.341, -0.9263, -0.3501, 0.1392, 0.1517, 0.5053, 0.8495, -0.0484, 0.3842, 0.922, 0.1254, 0.5362, 0.8347, 0.0511, 0.4023, 0.9141, -0.8488, -0.3074, 0.4302, -0.929, -0.1186, 0.3506, -0.8882, 0.1882, 0.4191, -0.9938, 0.0737, -0.0838, -0.8109, 0.5177, -0.2728, -0.8497, -0.2773, 0.4485, -0.9267, 0.0057, 0.3759, -0.9263, -0.3501, 0.1392, -0.8878, -0.3804, 0.2591, -0.8905, -0.2353, 0.3895, -0.9098, -0.2769, 0.3091, -0.5184, 0.747, 0.4162, -0.9508, -0.2913, 0.1057, -0.9508, -0.2913, 0.1057, 0.0728, -0.8266, -0.5581, 0.1382, 0.3609, 0.9223, -0.8474, -0.1442, 0.5111, -0.9072, -0.2801, 0.3139, -0.8344, 0.2551, 0.4886, -0.8719, -0.3264, 0.365, -0.8344, 0.2551, 0.4886, -0.5907, 0.4179, 0.6903, -0.6468, 0.2248, 0.7288, -0.6811, 0.489, 0.5449, -0.6811, 0.489, 0.5449, -0.5244, 0.5387, 0.6594, -0.5907, 0.4179, 0.6903, -0.9193, -0.1596, 0.3598, -0.7788, -0.462, -0.4244, -0.6155, 0.17, 0.7696, -0.6975, 0.3882, 0.6023, -0.7082, -0.6096, 0.3561, 0.0452, 0.1216, 0.9916, -0.014, -0.4651, 0.8851, -0.262, -0.9086, -0.3253, -0.2877, -0.8925, 0.3473, -0.0147, -0.9978, -0.0651, -0.9661, -0.2415, 0.0909, -0.8752, -0.3487, 0.3352, 0.3151, 0.7935, 0.5207, 0.1652, 0.7993, 0.5778, -0.8571, 0.3525, 0.3758, -0.6811, 0.489, 0.5449, -0.7087, 0.5702, 0.4155, -0.8247, 0.2807, 0.491, -0.4189, 0.8547, 0.3067, -0.8943, -0.2629, 0.3622, -0.3202, 0.6611, 0.6785, -0.7616, -0.6277, 0.161, -0.9661, -0.2415, 0.0909, -0.9661, -0.2415, 0.0909, -0.9578, 0.2826, 0.0524, -0.8986, -0.3531, 0.2604, -0.9573, 0.2799, 0.0725, -0.6065, 0.217, 0.7649, -0.6103, -0.0672, 0.7893, -0.65, 0.1837, 0.7374, -0.9167, 0.2933, 0.2715, 0.1974, -0.4973, 0.8448, -0.7939, -0.5488, 0.2619, -0.6664, 0.5805, 0.468, -0.8325, 0.5022, 0.2339, -0.7087, 0.5702, 0.4155, -0.8571, 0.3525, 0.3758, -0.9534, 0.1473, 0.2634, -0.612, 0.7574, 0.2276, -0.9494, -0.1414, 0.2803, -0.2592, -0.4436, 0.8579, -0.8305, 0.5569, -0.0106, -0.9697, -0.2443, 0.0018, -0.9167, 0.2933, 0.2715, -0.9534, 0.1473, 0.2634, 0.5076, 0.3459, 0.7891, 0.6019, 0.21, 0.7705, -0.1636, 0.3226, 0.9323, -0.7616, -0.6277, 0.161, -0.7643, -0.6348, 0.1132, -0.8142, 0.4887, 0.3135, -0.8325, 0.5022, 0.2339, -0.947, -0.1345, 0.2918, 0.5276, 0.6107, 0.5905, 0.4477, 0.5346, 0.7168, 0.4367, 0.5151, 0.7375, 0.014, -0.998, -0.0612, -0.693, 0.7194, 0.0469, -0.6595, -0.5916, 0.4638, -0.5998, -0.5252, 0.6037, -0.5134, -0.7022, 0.4933, -0.6049, -0.7776, -0.1716, -0.9868, -0.1053, 0.1234, -0.9728, 0.2284, 0.0383, -0.7733, 0.3911, 0.499, -0.9095, 0.2972, 0.2908, -0.8142, 0.4887, 0.3135, -0.8608, 0.3609, 0.3589, -0.8608, 0.3609, 0.3589, 0.1824, 0.2397, 0.9536, 0.0266, 0.6994, 0.7142, -0.0621, 0.7141, 0.6973, -0.8225, 0.5144, 0.2425, -0.9387, 0.3006, -0.169, -0.8225, 0.5144, 0.2425, 0.464, 0.4927, 0.7362, 0.3722, 0.5189, 0.7696, 0.1982, 0.8929, 0.4044, -0.927, -0.3664, 0.0805, -0.8608, 0.3609, 0.3589, -0.5239, 0.3662, 0.769, -0.6151, -0.3684, 0.6971, -0.715, -0.2689, 0.6453, -0.5837, -0.1564, 0.7967, -0.3, -0.8908, -0.3413, -0.1621, 0.8629, 0.4786, -0.2653, -0.9467, 0.1828, -0.7643, -0.6348, 0.1132, -0.631, 0.6941, 0.3466, -0.5846, 0.3661, 0.724, -0.5019, 0.5114, 0.6976, 0.2776, 0.8504, 0.447, -0.5318, -0.7782, 0.334, -0.5533, -0.7692, 0.3198, -0.6725, -0.6783, 0.2962, -0.9365, -0.2285, 0.2659, -0.2083, 0.2382, 0.9486, -0.7493, -0.0918, 0.6558, -0.7392, -0.0419, 0.6722, -0.6092, 0.0466, 0.7916, -0.6826, 0.1621, 0.7125, 0.1145, -0.7232, 0.6811, -0.0811, 0.5406, 0.8374, -0.5683, -0.7661, 0.3002, -0.7643, -0.6348, 0.1132, -0.2653, -0.9467, 0.1828, -0.9891, -0.1391, 0.0482, -0.715, -0.2689, 0.6453, -0.8253, -0.1856, 0.5334, -0.7493, -0.0918, 0.6558, -0.6826, 0.1621, 0.7125, -0.7324, 0.2217, 0.6437, -0.9825, -0.0819, 0.1672, -0.1459, 0.5581, 0.8169, -0.788, -0.1572, 0.5952, -0.7392, -0.0419, 0.6722, -0.0333, 0.9299, 0.3664, 0.2616, 0.823, 0.5041, -0.9825, -0.0819, 0.1672, -0.9891, -0.1391, 0.0482, -0.927, -0.3664, 0.0805, 0.2082, -0.567, 0.797, 0.2101, -0.0537, 0.9762, 0.4711, 0.1633, 0.8668, 0.4587, 0.428, 0.7787, 0.4913, 0.4381, 0.7528, 0.2103, -0.1021, 0.9723, -0.7919, 0.0791, 0.6055, -0.6826, 0.1621, 0.7125, 0.354, 0.6745, 0.6479, -0.5683, -0.7661, 0.3002, -0.7183, -0.4576, 0.5241, -0.9365, -0.2285, 0.2659, 0.3757, 0.3782, 0.8461, 0.4673, 0.2458, 0.8492, -0.6826, 0.1621, 0.7125, 0.1499, 0.7352, 0.6611, 0.2837, 0.4986, 0.8191, 0.0245, 0.692, 0.7214, 0.0095, -0.9999, 0.007, 0.1541, 0.3479, 0.9248, -0.9789, 0.0849, 0.186, 0.1881, 0.6722, 0.716, -0.0835, 0.5721, 0.8159, -0.1655, 0.542, 0.8239, -0.7689, -0.3322, 0.5463, -0.7692, -0.1183, 0.628, 0.0234, -0.9994, 0.0236, -0.0566, 0.6272, 0.7768, -0.0993, 0.6776, 0.7287, -0.1081, 0.7791, 0.6175, 0.0388, 0.2771, 0.96, 0.2096, 0.2888, 0.9342, -0.8835, -0.1995, 0.4237, -0.8835, -0.1995, 0.4237, -0.6917, -0.328, 0.6434, -0.6306, -0.6978, 0.3397, -0.7964, -0.2826, 0.5347, 0.009, 0.5158, 0.8567, -0.7901, -0.0273, 0.6123, -0.8466, 0.3647, 0.3876, -0.8222, -0.4217, 0.3823, -0.8293, -0.408, 0.3819, -0.8964, -0.0485, 0.4406, -0.8356, 0.1555, 0.5269, -0.763, 0.2962, 0.5745, -0.6004, 0.281, 0.7487, -0.6808, 0.7138, 0.1642, -0.8466, 0.3647, 0.3876, -0.5271, 0.734, 0.4283, -0.0717, 0.7114, 0.6991, -0.4898, -0.6916, 0.5308, -0.5814, -0.7018, 0.4115, -0.5814, -0.7018, 0.4115, -0.8088, 0.2692, 0.5229, -0.7009, -0.1302, 0.7013, 0.0388, 0.2771, 0.96, -0.8962, 0.1655, 0.4116, -0.7278, 0.4502, 0.5173, -0.4128, 0.8424, 0.3465, -0.5271, 0.734, 0.4283, -0.5446, 0.6821, 0.488, -0.8466, 0.3647, 0.3876, -0.6073, 0.2987, 0.7362, -0.8835, -0.1995, 0.4237, -0.5901, -0.7327, 0.3389, -0.552, -0.5525, 0.6246, -0.4626, -0.7704, 0.4386, -0.5814, -0.7018, 0.4115, -0.686, -0.6691, 0.2859, -0.8604, -0.3746, 0.3455, -0.9229, 0.081, 0.3765, 0.0388, 0.2771, 0.96, -0.7828, 0.1699, 0.5986, -0.2959, -0.874, 0.3854, -0.4189, 0.8547, 0.3067, -0.925, -0.0569, 0.3757, -0.9478, 0.0122, 0.3186, -0.2433, 0.7579, 0.6054, 0.1357, -0.9898, 0.0433, 0.2274, -0.9733, -0.0299, -0.6975, 0.3882, 0.6023, -0.6163, 0.173, 0.7683, -0.7344, 0.5367, 0.4154, -0.5446, 0.6821, 0.488, -0.8095, 0.3145, 0.4958, -0.7344, 0.5367, 0.4154, -0.5775, 0.7744, 0.2584, -0.6808, 0.7138, 0.1642, -0.8835, -0.1995, 0.4237, -0.733, -0.2298, 0.6403, -0.8554, 0.029, 0.5172, -0.684, -0.0197, 0.7293, -0.7617, 0.1951, 0.6178, 0.4781, 0.2212, 0.85, 0.5082, 0.2714, 0.8174, -0.7603, 0.3815, 0.5257, -0.6955, 0.4623, 0.5501, -0.7278, 0.4502, 0.5173, -0.6163, 0.173, 0.7683, -0.8501, 0.4289, 0.3055, -0.9969, 0.0757, 0.0221, -0.8835, -0.1995, 0.4237, -0.8145, -0.4934, 0.3051, 0.5675, 0.4867, 0.6641, -0.7519, 0.6199, 0.2244, -0.7278, 0.4502, 0.5173, -0.6955, 0.4623, 0.5501, -0.7519, 0.6199, 0.2244, -0.6903, 0.7012, 0.1785, -0.7344, 0.5367, 0.4154, -0.5775, 0.7744, 0.2584, -0.7344, 0.5367, 0.4154, -0.8434, -0.5372, 0.0078, -0.8835, -0.1995, 0.4237, -0.8835, -0.1995, 0.4237, -0.7096, -0.6615, 0.2427, -0.8466, 0.3647, 0.3876, -0.6808, 0.7138, 0.1642, -0.8466, 0.3647, 0.3876, 0.5511, 0.0976, 0.8287, -0.5775, 0.7744, 0.2584, -0.5239, 0.3662, 0.769, -0.1824, 0.648, 0.7395, -0.0397, 0.0902, 0.9951, -0.946, 0.0742, 0.3154, -0.946, 0.0742, 0.3154, -0.8241, -0.333, 0.4581, -0.8241, -0.333, 0.4581, 0.3204, 0.3855, 0.8653, 0.4021, 0.1438, 0.9042, 0.5593, 0.5718, 0.6002, -0.2126, 0.8039, 0.5555, 0.6665, 0.7364, -0.1162, -0.0187, 0.8054, 0.5925, 0.5251, 0.7066, 0.4742, 0.4678, 0.6496, 0.5994, 0.5251, 0.7066, 0.4742, 0.0555, 0.4035, 0.9133, 0.5251, 0.7066, 0.4742, 0.4087, 0.7529, 0.5159, 0.4408, 0.6121, 0.6565, 0.9298, 0.0651, 0.3621, 0.7748, 0.1384, 0.6168, 0.0676, -0.9937, -0.0896, 0.0989, -0.9948, -0.026, 0.1742, -0.9694, -0.173, -0.2237, -0.9745, 0.0198, -0.2238, -0.9662, 0.1276, 0.2713, 0.4359, 0.8581, 0.1859, 0.6757, 0.7133, 0.1896, 0.5733, 0.7971, -0.1103, 0.8777, 0.4663, 0.1881, 0.6722, 0.716, 0.2616, 0.823, 0.5041, 0.3124, 0.6547, 0.6883, 0.3564, 0.6908, 0.6291, 0.7748, 0.1384, 0.6168, 0.1286, 0.5401, 0.8317, 0.7678, 0.2692, 0.5813, -0.283, 0.7598, 0.5853, -0.3876, 0.9123, -0.1324, -0.4727, 0.738, 0.4817, -0.6811, 0.489, 0.5449, -0.7087, 0.5702, 0.4155, -0.1291, -0.9393, 0.3179, 0.0403, 0.546, 0.8368, 0.5296, 0.4274, 0.7327, 0.1286, 0.5401, 0.8317, 0.1286, 0.5401, 0.8317, -0.0059, 0.4265, 0.9045, 0.0555, 0.4035, 0.9133, -0.1548, 0.8719, 0.4646, 0.9298, 0.0651, 0.3621, 0.0245, 0.692, 0.7214, 0.5296, 0.4274, 0.7327, -0.7519, 0.6199, 0.2244, 0.4698, 0.636, 0.6122, -0.2417, 0.607, 0.7571, 0.4698, 0.636, 0.6122, 0.0148, 0.9274, 0.3737, 0.8961, 0.3137, 0.314, 0.6443, 0.7619, 0.0664, 0.1572, -0.9821, 0.104, 0.0053, -0.9427, 0.3337, 0.2746, 0.316, 0.9081, 0.1881, 0.6722, 0.716, -0.3945, 0.2646, 0.88, 0.2746, 0.316, 0.9081, 0.6011, 0.3116, 0.7359, 0.8961, 0.3137, 0.314, 0.1237, 0.142, 0.9821, -0.3202, 0.6611, 0.6785, -0.6163, 0.173, 0.7683, -0.3945, 0.2646, 0.88, 0.4771, 0.1924, 0.8575, 0.6011, 0.3116, 0.7359, -0.0205, 0.836, 0.5483, -0.2668, 0.8415, 0.4698, 0.8136, -0.0311, 0.5805, 0.1881, 0.6722, 0.716, 0.2822, -0.5634, 0.7765, 0.3037, 0.3362, 0.8915, 0.9298, 0.0651, 0.3621, 0.351, 0.8128, 0.4649, 0.5637, 0.2708, 0.7803, 0.5637, 0.2708, 0.7803, 0.4402, 0.1957, 0.8763, -0.0155, 0.3693, 0.9292, 0.0519, 0.4349, 0.899, -0.0381, 0.4069, 0.9127, -0.5528, -0.8247, 0.1196, 0.0636, 0.9694, 0.2372, 0.1943, 0.4336, 0.8799, -0.1117, 0.3968, 0.9111, 0.2628, -0.0845, 0.9611, 0.6672, 0.285, 0.6882, 0.5885, 0.2993, 0.7511, 0.1073, 0.7226, 0.6829, 0.1429, 0.413, 0.8995, 0.7678, 0.2692, 0.5813, -0.1136, 0.6686, 0.7349, -0.2001, 0.6634, 0.721, -0.2407, 0.512, 0.8246, -0.3141, 0.5635, 0.7641, 0.8136, -0.0311, 0.5805, -0.5244, 0.5387, 0.6594, 0.1581, -0.1827, 0.9704, -0.014, -0.4651, 0.8851, 0.2922, 0.2573, 0.9211, 0.1881, 0.6722, 0.716, 0.8529, 0.4785, -0.2086, 0.6443, 0.7619, 0.0664, 0.8961, 0.3137, 0.314, 0.2616, 0.823, 0.5041, 0.4792, 0.3471, 0.8062, 0.1374, 0.6489, 0.7484, 0.322, 0.2131, 0.9224, -0.5244, 0.5387, 0.6594, 0.351, 0.8128, 0.4649, 0.0245, 0.692, 0.7214, 0.6906, 0.3742, 0.6189, 0.5264, 0.5887, 0.6135, -0.1319, 0.5249, 0.8409, -0.5239, 0.3662, 0.769, 0.7685, 0.5626, 0.3046, -0.0949, 0.7699, 0.631, -0.0386, 0.4396, 0.8974, 0.1881, 0.6722, 0.716, 0.1982, 0.8929, 0.4044, -0.0927, 0.6268, 0.7736, 0.7637, 0.5127, 0.3922, 0.7637, 0.5127, 0.3922, 0.5264, 0.5887, 0.6135, 0.6906, 0.3742, 0.6189, 0.0033, 0.6582, 0.7528, 0.7637, 0.5127, 0.3922, 0.5264, 0.5887, 0.6135, 0.0967, 0.8818, 0.4615, 0.1374, 0.6489, 0.7484, 0.0414, 0.4943, 0.8683, 0.8136, -0.0311, 0.5805, 0.4467, 0.8529, 0.2702, 0.0967, 0.8818, 0.4615, 0.7637, 0.5127, 0.3922, 0.0908, 0.7763, 0.6238, 0.0073, 0.4602, 0.8878, 0.4467, 0.8529, 0.2702, 0.1904, 0.9333, 0.3046, 0.1904, 0.9333, 0.3046, 0.1517, 0.8748, 0.4602, 0.0967, 0.8818, 0.4615, -0.4363, -0.7146, -0.5468, 0.0728, -0.8266, -0.5581, -0.2327, -0.118, 0.9654, 0.5251, 0.7066, 0.4742, 0.0529, 0.1286, 0.9903, 0.4467, 0.8529, 0.2702, 0.1699, 0.971, 0.1683, 0.1488, 0.5627, 0.8132, 0.2183, -0.631, -0.7444, 0.2195, 0.6291, 0.7457, 0.1881, 0.6722, 0.716, 0.5251, 0.7066, 0.4742, -0.0582, 0.7813, -0.6214, 0.3153, 0.7958, -0.5169, 0.2933, 0.7947, 0.5315, 0.2951, 0.1319, 0.9463, 0.2616, 0.823, 0.5041, 0.2012, 0.2117, 0.9564, 0.2616, 0.823, 0.5041, 0.0672, 0.6019, 0.7957, -0.0381, 0.4879, 0.8721, 0.0245, 0.692, 0.7214, 0.5092, 0.0958, 0.8553, -0.6073, 0.2987, 0.7362, 0.0245, 0.692, 0.7214, 0.7685, 0.5626, 0.3046, 0.3374, 0.8845, 0.3221, 0.2616, 0.823, 0.5041, 0.2616, 0.823, 0.5041, 0.2616, 0.823, 0.5041, -0.6826, 0.1621, 0.7125, -0.4797, 0.1491, 0.8646, -0.6004, 0.281, 0.7487, -0.5449, 0.3668, 0.7541, -0.534, -0.1547, 0.8312, -0.4593, 0.3505, 0.8162, -0.255, -0.0997, 0.9618, -0.399, -0.2708, 0.876, -0.2884, 0.0111, 0.9575, -0.4008, 0.1381, 0.9057, 0.4423, -0.2016, 0.8739, -0.1457, 0.3084, 0.94, -0.1883, 0.3624, 0.9128, 0.2053, -0.0315, 0.9782, 0.024, 0.2605, 0.9652, 0.2835, -0.3262, 0.9018, -0.1706, -0.4253, 0.8888, 0.4897, -0.0034, 0.8719, -0.5837, -0.1564, 0.7967, -0.4049, -0.256, 0.8778, -0.4113, -0.2485, 0.877, -0.3457, -0.2572, 0.9024, -0.7314, -0.4431, 0.5183, -0.5292, -0.0067, 0.8484, -0.3786, 0.1734, 0.9092, -0.4765, -0.666, 0.5739, -0.3353, -0.6077, 0.7199, -0.3828, -0.7019, 0.6006, -0.6163, 0.173, 0.7683, -0.4887, -0.1164, 0.8646, -0.2327, -0.118, 0.9654, -0.5998, -0.5252, 0.6037, -0.5079, -0.4897, 0.7087, -0.5134, -0.7022, 0.4933, 0.1216, -0.3083, 0.9435, 0.024, 0.2605, 0.9652, -0.4898, -0.6916, 0.5308, -0.2443, 0.2306, 0.9419, -0.2431, 0.1543, 0.9577, -0.4246, 0.1378, 0.8948, -0.5088, -0.1622, 0.8454, 0.0659, -0.0486, 0.9966, 0.2782, 0.1207, 0.9529, -0.1159, -0.4897, 0.8641, -0.3442, 0.0336, 0.9383, -0.3739, -0.511, 0.774, -0.2207, -0.8457, 0.4859, -0.0261, -0.9986, 0.047, 0.2782, 0.1207, 0.9529, -0.1284, 0.0747, 0.9889, -0.0901, -0.0221, 0.9957, -0.2237, 0.1421, 0.9642, -0.2558, 0.003, 0.9667, -0.1785, 0.0581, 0.9822, -0.3637, -0.0111, 0.9315, -0.3884, -0.8948, 0.2201, -0.6617, -0.7465, 0.0696, -0.2925, 0.2884, 0.9118, -0.1261, 0.0214, 0.9918, 0.4402, 0.1957, 0.8763, -0.446, 0.0179, 0.8948, -0.0586, -0.3179, 0.9463, -0.4478, -0.4893, 0.7484, 0.107, -0.2186, 0.9699, 0.0388, 0.2771, 0.96, -0.2691, -0.102, 0.9577, 0.0705, -0.4251, 0.9024, -0.0638, 0.3577, 0.9316, 0.0654, -0.2909, 0.9545, -0.4797, 0.1491, 0.8646, -0.4797, 0.1491, 0.8646, -0.3285, -0.3739, 0.8673, -0.1032, -0.5868, 0.8031, -0.5837, -0.1564, 0.7967, -0.1974, -0.6474, 0.7361, -0.7183, -0.4576, 0.5241, -0.5683, -0.7661, 0.3002, 0.0371, -0.3172, 0.9476, -0.7689, -0.3322, 0.5463, -0.3397, -0.7329, 0.5895, -0.4626, -0.7704, 0.4386, -0.3825, -0.2646, 0.8853, -0.2839, -0.8107, 0.512, -0.2456, -0.2977, 0.9225, -0.4106, -0.307, 0.8586, -0.1262, -0.3111, 0.942, -0.5837, -0.1564, 0.7967, -0.2494, -0.2388, 0.9385, -0.0082, -0.145, 0.9894, -0.4887, -0.1164, 0.8646, -0.4113, -0.2485, 0.877, -0.3285, -0.3739, 0.8673, -0.255, -0.0997, 0.9618, 0.9335, -0.3323, 0.1345, -0.2173, -0.303, 0.9279, 0.2735, -0.3066, 0.9117, 0.2523, 0.2621, 0.9315, -0.3264, -0.4114, 0.851, 0.6044, -0.1272, 0.7865, 0.4746, 0.0456, 0.879, -0.1018, 0.2402, 0.9654, -0.0638, 0.3577, 0.9316, 0.4423, -0.4691, 0.7644, 0.1881, 0.6722, 0.716, -0.2205, -0.3666, 0.9039, 0.431, 0.0547, 0.9007, -0.2327, -0.118, 0.9654, 0.4468, -0.2864, 0.8475, 0.4432, -0.1269, 0.8874, 0.4566, -0.1056, 0.8834, 0.3989, 0.0035, 0.917, 0.3952, 0.0935, 0.9138, 0.3552, -0.4069, 0.8416, 0.3047, -0.071, 0.9498, -0.2938, -0.9395, 0.1758, -0.7733, 0.3911, 0.499, -0.5775, 0.5291, 0.6217, -0.5446, 0.6821, 0.488, 0.2794, -0.234, 0.9312, -0.2153, 0.2845, 0.9342, -0.6073, 0.2987, 0.7362, 0.3074, -0.2475, 0.9188, 0.414, 0.0257, 0.9099, -0.6415, -0.7467, -0.1758, 0.3173, -0.2956, 0.9011, 0.4146, 0.0627, 0.9078, -0.0059, 0.4265, 0.9045, -0.5601, -0.8272, -0.0451, -0.5128, -0.8585, -0.0039, 0.2755, -0.4275, 0.861, 0.2379, -0.2319, 0.9432, 0.4579, -0.026, 0.8886, 0.2421, -0.1463, 0.9592, 0.2905, -0.1259, 0.9486, 0.467, 0.0579, 0.8824, -0.3457, -0.2572, 0.9024, -0.5775, 0.5291, 0.6217, 0.0877, -0.2816, 0.9555, 0.1156, -0.4487, 0.8862, 0.2093, -0.4159, 0.885, 0.2233, -0.0658, 0.9725, 0.2943, -0.296, 0.9087, 0.303, -0.3154, 0.8993, -0.0638, 0.3577, 0.9316, 0.0978, -0.2101, 0.9728, 0.2774, -0.1399, 0.9505, -0.6975, 0.3882, 0.6023, -0.6155, 0.17, 0.7696, -0.6163, 0.173, 0.7683, 0.1592, -0.0653, 0.9851, 0.2394, -0.1616, 0.9574, 0.3098, -0.2405, 0.9199, 0.423, -0.0743, 0.9031, 0.3547, 0.0999, 0.9296, -0.6468, 0.2248, 0.7288, 0.2988, 0.1418, 0.9437, 0.1887, -0.3373, 0.9223, 0.1793, -0.2079, 0.9616, 0.3522, 0.0816, 0.9324, 0.0456, -0.1769, 0.9832, 0.2297, -0.107, 0.9674, 0.2586, 0.0305, 0.9655, 0.254, -0.6252, 0.738, -0.6163, 0.173, 0.7683, 0.2726, -0.5077, 0.8172, 0.3191, -0.2479, 0.9147, 0.3611, 0.1153, 0.9254, 0.2063, -0.2454, 0.9472, -0.4887, -0.1164, 0.8646, 0.2726, -0.5077, 0.8172, 0.2119, -0.1806, 0.9605, 0.2021, -0.2087, 0.9569, 0.2338, -0.2992, 0.9251, 0.1183, -0.4862, 0.8658, 0.3215, -0.0518, 0.9455, 0.123, -0.7193, 0.6838, 0.2726, -0.5077, 0.8172, 0.214, -0.2721, 0.9382, 0.2188, -0.0609, 0.9739, 0.1269, -0.14, 0.982, 0.1139, -0.5102, 0.8525, 0.2726, -0.5077, 0.8172, 0.2726, -0.5077, 0.8172, 0.2265, -0.161, 0.9606, 0.3877, 0.0576, 0.92, 0.2364, -0.0752, 0.9687, 0.4792, 0.3471, 0.8062, 0.1526, -0.0739, 0.9855, 0.16, -0.2953, 0.9419, 0.2132, 0.0161, 0.9769, 0.1516, -0.2904, 0.9448, 0.2159, -0.1049, 0.9708, 0.2271, -0.171, 0.9587, -0.5088, -0.1622, 0.8454, 0.1114, -0.4989, 0.8595, 0.0027, -0.4892, 0.8722, 0.1224, -0.285, 0.9507, 0.196, -0.1524, 0.9687, -0.5088, -0.1622, 0.8454, -0.0681, -0.7947, -0.6032, 0.0449, -0.7088, 0.704, 0.0671, -0.453, 0.889, 0.185, -0.1664, 0.9686, -0.0638, 0.3577, 0.9316, 0.2084, -0.2324, 0.95, 0.0698, -0.3766, 0.9237, 0.1453, -0.28, 0.9489, 0.1208, -0.0798, 0.9895, -0.2573, -0.3965, 0.8812, -0.7309, 0.2948, 0.6155, 0.2655, -0.1838, 0.9464, 0.2529, -0.1185, 0.9602, -0.7767, -0.0386, 0.6287, 0.0907, -0.0661, 0.9937, 0.1305, -0.003, 0.9914, -0.0915, -0.4293, 0.8985, 0.1, -0.3159, 0.9435, -0.7886, -0.1536, 0.5954, 0.8701, -0.176, 0.4604, 0.3838, -0.4777, 0.7903, -0.1405, -0.3456, 0.9278, 0.2029, -0.1832, 0.9619, -0.1176, -0.5955, -0.7947, -0.6468, 0.2248, 0.7288, -0.2988, -0.246, 0.9221, -0.3144, -0.5255, 0.7906, -0.5176, -0.34, 0.7852, -0.5711, -0.0994, 0.8148, 0.1226, -0.0228, 0.9922, -0.0309, -0.4968, 0.8673, 0.1065, -0.2457, 0.9635, 0.1031, -0.0472, 0.9935, 0.1031, -0.0472, 0.9935, 0.0142, -0.0385, 0.9992, -0.4626, -0.7704, 0.4386, -0.4318, -0.757, 0.4904, 0.272, -0.9577, 0.0936, -0.5711, -0.0994, 0.8148, -0.5837, -0.1564, 0.7967, -0.2048, -0.4631, 0.8623, -0.163, -0.3774, 0.9116, -0.4797, 0.1491, 0.8646, -0.9703, 0.0266, 0.2406, 0.3505, -0.8192, -0.4539, -0.0769, -0.1673, 0.9829, 0.1031, -0.0472, 0.9935, -0.0638, 0.3577, 0.9316, 0.1944, -0.9809, 0.0003, -0.0967, -0.9945, 0.0399, 0.0048, -0.9939, -0.1099, -0.5711, -0.0994, 0.8148, -0.5176, -0.34, 0.7852, -0.3196, -0.3971, 0.8603, -0.1612, -0.2706, 0.9491, -0.1034, 0.0566, 0.993, -0.5006, -0.1362, 0.8549, -0.5088, -0.1622, 0.8454, -0.5482, -0.8299, 0.1034, -0.8448, -0.1794, 0.5041, -0.839, 0.5283, -0.1304, -0.0668, -0.0239, 0.9975, 0.1031, -0.0472, 0.9935, -0.3621, 0.1106, 0.9255, -0.2289, -0.1335, 0.9643, -0.4315, -0.3282, 0.8403, 0.1031, -0.0472, 0.9935, -0.7594, -0.2303, -0.6085, -0.4043, -0.878, -0.2561, -0.3294, -0.4313, 0.8399, -0.5006, -0.1362, 0.8549, -0.3294, -0.4313, 0.8399, -0.8835, -0.1995, 0.4237, -0.7309, 0.2948, 0.6155, -0.3816, -0.2051, 0.9013, -0.3137, -0.0683, 0.9471, -0.2849, 0.095, 0.9538, -0.3621, 0.1106, 0.9255, -0.8448, -0.1794, 0.5041, -0.7879, 0.4057, 0.4633, -0.839, 0.5283, -0.1304, -0.8448, -0.1794, 0.5041, 0.0388, 0.2771, 0.96, -0.2289, -0.1335, 0.9643, -0.3661, -0.1858, 0.9118, -0.5006, -0.1362, 0.8549, -0.3294, -0.4313, 0.8399, -0.2137, -0.5731, -0.7912, -0.2389, -0.86, -0.4508, -0.3296, 0.4455, 0.8324, -0.5239, 0.3662, 0.769, -0.5846, 0.3661, 0.724, -0.2824, -0.2497, 0.9262, -0.3661, -0.1858, 0.9118, -0.2045, -0.4133, 0.8873, -0.6826, 0.1621, 0.7125, -0.4797, 0.1491, 0.8646, -0.5292, -0.0067, 0.8484, -0.2327, -0.118, 0.9654, -0.5292, -0.0067, 0.8484, -0.5292, -0.0067, 0.8484, -0.5837, -0.1564, 0.7967, 0.2266, -0.9724, 0.0554, 0.0446, -0.9987, 0.0267, -0.1253, -0.992, 0.0178, 0.1147, -0.9905, -0.0754, -0.0992, -0.9369, 0.3351, -0.1253, -0.992, 0.0178, 0.0213, -0.9997, 0.0074, 0.1201, -0.963, -0.2413, 0.1846, -0.4544, -0.8715, -0.0641, -0.9963, -0.0565, -0.2644, -0.9644, 0.0027, 0.0342, -0.9786, -0.2029, -0.1595, -0.9362, -0.3132, 0.4591, -0.8802, -0.1203, -0.6398, -0.732, -0.2342, -0.5308, -0.7477, -0.3989, -0.4607, -0.829, -0.317, -0.2669, -0.9478, -0.1747, -0.4834, -0.8633, -0.145, 0.3964, -0.8778, -0.2691, -0.6398, -0.732, -0.2342, 0.0982, -0.9835, 0.1516, 0.0017, -1, 0.005, -0.1244, -0.6177, -0.7765, 0.0077, -0.9946, -0.1039, -0.1389, -0.9574, 0.2531, -0.6781, -0.735, 0.0032, 0.1027, -0.9455, -0.309, 0.0509, -0.9682, -0.2448, 0.1065, -0.9648, 0.2404, -0.3165, -0.9486, -0.0004, -0.1264, -0.9903, 0.0582, 0.1843, -0.9809, -0.0623, 0.1765, -0.9841, 0.0209, -0.4086, -0.8759, -0.2566, -0.2938, -0.9395, 0.1758, 0.0982, -0.9835, 0.1516, -0.2938, -0.9395, 0.1758, -0.2938, -0.9395, 0.1758, -0.5368, -0.8303, -0.1496, 0.1883, -0.9817, 0.0287, 0.0061, -0.9994, 0.0348, 0.0308, -0.9992, 0.0235, -0.1908, -0.952, -0.2395, 0.2263, -0.5511, -0.8031, -0.1908, -0.952, -0.2395, -0.0709, -0.9396, 0.3349, -0.6398, -0.732, -0.2342, -0.4607, -0.829, -0.317, -0.5128, -0.8585, -0.0039, -0.5058, -0.851, -0.1414, -0.4708, -0.8773, 0.0934, -0.4338, -0.8982, -0.0707, 0.6672, 0.285, 0.6882, 0.3286, -0.8865, -0.3258, -0.4607, -0.829, -0.317, -0.0147, -0.9978, -0.0651, -0.5128, -0.8585, -0.0039, 0.1729, -0.9834, 0.0558, -0.6039, -0.7971, 0.0066, 0.266, -0.9503, 0.1619, 0.1698, -0.9784, -0.118, -0.4919, -0.736, -0.465, 0.3266, -0.9212, -0.2117, -0.6586, -0.7337, 0.1669, -0.6926, -0.7198, -0.0478, -0.399, -0.8905, 0.2185, -0.7126, -0.6751, 0.1908, -0.5814, -0.7018, 0.4115, -0.3847, -0.9144, 0.1257, -0.3933, -0.8977, 0.1988, -0.7126, -0.6751, 0.1908, 0.0681, -0.9976, 0.0135, 0.1486, -0.9871, 0.0589, -0.4792, -0.8777, 0.0025, -0.066, -0.9892, -0.1308, 0.0017, -1, 0.005, -0.5082, -0.7876, -0.3484, -0.1227, -0.8301, -0.544, -0.3898, -0.8313, -0.3963, -0.7814, -0.0759, -0.6194, -0.7038, -0.5486, -0.4513, -0.3847, -0.9144, 0.1257, -0.3021, -0.944, -0.1324, -0.4792, -0.8777, 0.0025, -0.3021, -0.944, -0.1324, -0.0649, -0.93, 0.3619, -0.0147, -0.9978, -0.0651, 0.0274, -0.9995, -0.016, 0.0017, -1, 0.005, 0.6073, -0.5571, 0.5664, 0.2938, -0.9411, -0.1673, 0.2807, 0.4438, -0.851, 0.0029, -0.9955, -0.0944, -0.294, -0.9526, -0.0788, -0.294, -0.9526, -0.0788, -0.2725, -0.7991, -0.5359, -0.3028, -0.6415, -0.7048, -0.4919, -0.736, -0.465, -0.4361, -0.8841, -0.168, 0.1909, -0.7971, -0.5729, 0.0765, -0.5684, -0.8192, -0.4984, -0.6882, -0.5273, -0.4607, -0.829, -0.317, -0.5308, -0.7477, -0.3989, -0.1359, -0.9423, -0.3059, 0.2931, -0.9096, -0.2945, -0.2725, -0.7991, -0.5359, -0.3028, -0.6415, -0.7048, 0.2642, -0.9159, 0.3021, -0.2238, -0.9662, 0.1276, -0.6799, -0.6922, -0.2421, 0.2716, -0.9624, 0.0101, -0.4363, -0.7146, -0.5468, -0.5814, -0.7018, 0.4115, -0.4976, -0.8318, 0.246, -0.0147, -0.9978, -0.0651, 0.0274, -0.9995, -0.016, -0.5058, -0.851, -0.1414, -0.7119, -0.618, -0.3337, 0.0728, -0.8266, -0.5581, -0.1359, -0.9423, -0.3059, -0.4363, -0.7146, -0.5468, 0.0256, -0.9314, 0.363, -0.4834, -0.8633, -0.145, -0.2669, -0.9478, -0.1747, -0.5308, -0.7477, -0.3989, -0.6229, -0.7789, 0.0727, -0.6879, -0.7258, -0.0067, -0.6508, -0.7564, -0.0659, -0.0882, -0.863, -0.4974, -0.1359, -0.9423, -0.3059, 0.0982, -0.9835, 0.1516, -0.0882, -0.863, -0.4974, -0.364, -0.8204, -0.441, -0.4919, -0.736, -0.465, -0.6581, -0.6615, -0.3597, -0.4626, -0.7704, 0.4386, -0.5671, -0.7566, -0.3255, -0.5885, -0.7303, -0.3468, 0.1847, -0.9191, -0.348, -0.338, -0.9161, 0.2157, -0.437, -0.8963, 0.0757, -0.5466, -0.7644, -0.3419, -0.6118, -0.6171, -0.4949, -0.4469, -0.8631, 0.2352, -0.5901, -0.7327, 0.3389, -0.4318, -0.757, 0.4904, -0.1653, -0.9861, 0.0172, -0.4748, -0.8723, -0.1167, 0.1847, -0.9191, -0.348, 0.1909, -0.7971, -0.5729, 0.1909, -0.7971, -0.5729, 0.9514, -0.1603, 0.2631, -0.1908, -0.952, -0.2395, -0.2669, -0.9478, -0.1747, 0.0559, -0.9976, -0.0402, -0.0261, -0.9986, 0.047, -0.3535, -0.9303, 0.0981, -0.3165, -0.9479, -0.0356, -0.3549, -0.9076, -0.2244, -0.4638, -0.7507, -0.4704, -0.364, -0.8204, -0.441, -0.5308, -0.7477, -0.3989, -0.4984, -0.6882, -0.5273, -0.5308, -0.7477, -0.3989, -0.0366, -0.9991, -0.0191, -0.3679, -0.8614, -0.3501, -0.4728, -0.6726, -0.5693, -0.4931, -0.5439, -0.679, -0.1608, -0.9826, -0.0931, -0.4312, -0.8007, -0.4159, -0.0514, -0.9987, -0.0035, -0.7814, -0.0759, -0.6194, -0.5482, -0.8299, 0.1034, -0.2592, -0.4436, 0.8579, -0.0295, -0.9973, 0.0677, 0.0074, -1, -0.0024, 0.0074, -1, -0.0024, -0.2692, -0.9423, -0.1992, -0.347, -0.6725, -0.6537, -0.2438, -0.9625, -0.1188, -0.2491, -0.9684, -0.0119, -0.2699, -0.9099, -0.3151, -0.4919, -0.736, -0.465, -0.4919, -0.736, -0.465, -0.2946, -0.8659, -0.4043, -0.3256, -0.7996, -0.5046, -0.0641, -0.9963, -0.0565, 0.0254, -0.9977, -0.0621, 0.037, -0.9989, -0.0281, -0.2389, -0.86, -0.4508, -0.2389, -0.86, -0.4508, -0.2336, -0.7597, -0.6069, -0.2218, -0.6241, -0.7492, -0.1416, -0.9854, 0.0947, -0.4607, -0.829, -0.317, -0.3129, -0.9385, 0.1461, -0.2389, -0.86, -0.4508, -0.0123, -0.9999, 0.0091, 0.0333, -0.9994, -0.0085, 0.2138, -0.9762, 0.0357, 0.2138, -0.9762, 0.0357, -0.1243, -0.9919, -0.0263, -0.2938, -0.9395, 0.1758, 0.1325, -0.9783, -0.159, 0.0085, -0.9993, -0.036, -0.2389, -0.86, -0.4508, -0.2389, -0.86, -0.4508, -0.0925, -0.6331, -0.7685, 0.3636, -0.9196, -0.1486, 0.136, -0.9763, -0.1682, 0.3304, -0.9407, -0.0769, -0.0043, -0.9996, -0.0294, -0.2028, -0.9521, -0.2287, 0.1551, -0.9472, -0.2806, 0.2282, -0.9724, -0.0487, -0.5128, -0.8585, -0.0039, -0.0147, -0.9978, -0.0651, 0.5428, -0.7293, -0.4164, 0.5428, -0.7293, -0.4164, 0.721, -0.6805, -0.1308, -0.1667, -0.5649, -0.8081, -0.5814, -0.7018, 0.4115, -0.4626, -0.7704, 0.4386, 0.2121, -0.7223, -0.6583, 0.5428, -0.7293, -0.4164, 0.347, -0.8291, -0.4384, 0.5428, -0.7293, -0.4164, 0.4237, -0.9049, 0.0414, 0.5428, -0.7293, -0.4164, 0.5428, -0.7293, -0.4164, 0.0178, -0.8484, -0.529, 0.136, -0.9763, -0.1682, 0.3304, -0.9407, -0.0769, 0.0283, -0.9992, 0.0287, 0.0159, -0.9996, -0.0232, 0.2263, -0.5511, -0.8031, 0.2263, -0.5511, -0.8031, -0.0346, -0.6462, -0.7624, 0.0805, -0.9941, -0.0728, 0.1403, -0.9768, 0.1619, 0.0239, -0.9977, -0.0641, 0.0648, -0.9114, -0.4064, -0.4919, -0.736, -0.465, -0.3933, -0.8977, 0.1988, -0.399, -0.8905, 0.2185, -0.7126, -0.6751, 0.1908, -0.262, -0.9086, -0.3253, 0.2263, -0.5511, -0.8031, 0.0982, -0.9835, 0.1516, -0.3443, -0.925, -0.1605, 0.1572, -0.9821, 0.104, 0.2256, -0.9676, -0.1131, 0.1119, -0.9936, 0.0151, 0.0982, -0.9835, 0.1516, 0.0982, -0.9835, 0.1516, 0.0982, -0.9835, 0.1516, 0.0576, -0.9155, 0.3981, -0.0649, -0.93, 0.3619, -0.2877, -0.8925, 0.3473, -0.0992, -0.9369, 0.3351, -0.0992, -0.9369, 0.3351, -0.1814, -0.9015, 0.3928, -0.1291, -0.9393, 0.3179, -0.0333, -0.9959, 0.0839, -0.0514, -0.9987, -0.0035, 0.1223, -0.9866, 0.1081, 0.0255, -0.9995, -0.021, 0.0783, -0.9964, 0.0323, -0.1291, -0.9393, 0.3179, -0.1814, -0.9015, 0.3928, 0.2266, -0.9724, 0.0554, 0.1944, -0.9809, 0.0003, 0.1758, -0.9836, 0.0398, 0.1357, -0.9898, 0.0433, -0.1814, -0.9015, 0.3928
-};
-
-float mTangents[] = {
--0.319456, 0.636817, -0.701721, -0.346948, 0.663115, -0.663254, -0.436233, 0.701938, -0.563013, -0.11211, 0.324373, -0.939262, -0.350961, 0.318765, -0.880463, -0.0726707, 0.261893, -0.962357, 0.705234, 0.23945, 0.667314, 0.783778, 0.28104, 0.553813, 0.796307, 0.421848, 0.433519, -0.805225, 0.388663, 0.447833, -0.809621, 0.48612, 0.32894, -0.558008, 0.690941, 0.459595, 0.873822, 0.128748, 0.468891, 0.86183, 0.437775, 0.25613, -0.320238, -0.871634, -0.371082, -0.275968, -0.701499, -0.65707, -0.289824, -0.559654, -0.776396, 0.452323, 0.108143, 0.885273, 0.466654, 0.140721, 0.873173, 0.555884, 0.207025, 0.805067, 0.865523, -0.481592, 0.137621, 0.704323, -0.661124, 0.258543, 0.64996, -0.74207, 0.163965, -0.11251, 0.171738, -0.978697, -0.0184563, 0.219879, -0.975353, -0.148905, 0.167317, -0.974593, -0.787381, -0.439108, -0.432684, -0.894638, -0.17518, -0.411018, -0.59997, -0.634872, -0.4868, -0.0318433, 0.228762, -0.972961, 0.0399152, 0.24993, -0.967441, -0.103966, 0.210094, -0.972138, 0.557335, -0.308728, 0.770756, 0.735714, -0.300286, 0.607086, 0.532008, -0.299757, 0.791904, 0.0199995, 0.0205602, 0.999588, 0.0582281, -0.23224, 0.970914, 0.040069, 0.363553, 0.930712, 0.617099, 0.30596, 0.724967, -0.226874, 0.109823, -0.967712, -0.285245, 0.104463, -0.952745, -0.959361, 0.247413, -0.135695, -0.854823, -0.272951, -0.441334, -0.94008, 0.18586, -0.285841, -0.479326, 0.833417, 0.27507, -0.500398, 0.834776, 0.229675, -0.441634, 0.891864, 0.0976573, -0.367283, 0.806274, 0.463709, -0.542778, 0.687343, 0.48265, -0.359444, 0.797571, 0.484438, -0.646336, -0.763053, 0.000272354, -0.540121, -0.289762, -0.790131, -0.616687, -0.247009, -0.747451, -0.804365, 0.548812, 0.227602, -0.953477, 0.290401, 0.080928, -0.597606, 0.712046, 0.368588, -0.740737, 0.573089, 0.35054, 0.403407, -0.624773, -0.668522, 0.329728, -0.532202, -0.779769, 0.307656, -0.678761, -0.666806, -0.447426, -0.45918, -0.767439, -0.876024, -0.367435, -0.312367, -0.920478, -0.381912, -0.0828461, -0.900589, -0.43209, -0.047306, 0.686719, 0.433596, 0.583448, 0.714526, 0.46266, 0.524785, 0.762305, 0.525996, 0.377118, 0.175423, 0.422716, -0.889122, 0.226981, 0.463531, -0.856515, 0.101328, 0.429669, -0.897283, -0.134319, -0.343511, 0.929494, 0.120322, -0.123938, 0.984968, 0.111444, -0.123486, 0.986069, -0.3738, -0.0438207, -0.926474, -0.567047, -0.199798, -0.799086, -0.593263, -0.290523, -0.750757, -0.281679, 0.48808, -0.826096, -0.0887091, 0.514292, -0.853015, 0.0763025, 0.478833, -0.874584, 0.140083, 0.269742, -0.952689, 0.108473, 0.257895, -0.960065, 0.320885, 0.0304454, 0.946629, 0.311927, 0.018408, 0.949928, -0.701494, -0.0245632, -0.712252, -0.767508, 0.376264, -0.518996, -0.700237, -0.0243816, -0.713494, 0.600623, 0.23354, -0.764664, 0.7597, 0.174853, -0.626324, 0.736393, 0.0842641, -0.671286, -0.827284, 0.249861, -0.50316, -0.87016, 0.360964, -0.335448, -0.890369, 0.415338, -0.186382, -0.000645628, 0.263604, -0.964631, 0.0737974, 0.272299, -0.959379, -0.107373, -0.341888, 0.933586, 0.669466, 0.338128, -0.661426, 0.833624, 0.237815, -0.498512, 0.766563, 0.234018, -0.598011, 0.900599, 0.275737, 0.335993, 0.867474, 0.232764, 0.43967, 0.855267, 0.211806, 0.472924, 0.763772, 0.198529, -0.614198, 0.89268, 0.0926107, -0.441073, 0.0110382, 0.437839, -0.898986, -0.0942384, 0.437625, -0.894206, 0.289126, 0.000430377, 0.957291, -0.970172, -0.121241, 0.209919, 0.613253, 0.331155, 0.717117, 0.844269, 0.160953, -0.511179, 0.865056, 0.173977, -0.470542, -0.0109043, -0.262239, 0.964941, 0.136547, -0.117688, 0.983618, 0.017939, 0.225481, -0.974082, -0.0776751, 0.174762, -0.981542, -0.252436, -0.289217, -0.923379, -0.254983, -0.309091, -0.916213, -0.227102, -0.282955, -0.931859, -0.360808, 0.823999, 0.436855, -0.305433, -0.177577, -0.935509, -0.34964, -0.218881, -0.910957, -0.25354, -0.153527, -0.955064, -0.291264, 0.462881, -0.837202, -0.0894711, 0.431065, -0.897874, -0.361909, 0.490582, -0.792686, -0.0780779, -0.309458, 0.947702, -0.780756, -0.462129, 0.420543, -0.731558, -0.421622, 0.535778, -0.519122, -0.408738, 0.750631, 0.468229, -0.554802, -0.687718, 0.295974, -0.360511, -0.884552, 0.730353, 0.461838, 0.503279, 0.326957, -0.113551, -0.938193, 0.46102, 0.0641932, -0.885065, 0.661394, 0.269315, 0.700019, 0.692628, 0.348158, 0.631706, 0.74369, 0.378643, 0.550958, -0.228363, 0.206535, -0.951417, -0.0342224, 0.246549, -0.968526, -0.164586, 0.229963, -0.959181, -0.406147, -0.590783, -0.697152, -0.482082, 0.381148, -0.788875, -0.401354, 0.407677, -0.820192, -0.505311, 0.385566, -0.77201, 0.767688, 0.434218, 0.471286, 0.793167, 0.429183, 0.432074, 0.620005, -0.779666, 0.0878291, 0.581465, -0.762942, -0.282519, 0.728388, -0.68184, 0.0674158, -0.244128, -0.461458, -0.852911, 0.307656, -0.678761, -0.666806, 0.00988458, 0.417871, -0.908453, 0.0913774, 0.425762, -0.900209, -0.114885, 0.410719, -0.904495, 0.815139, 0.363745, -0.450819, 0.961822, 0.21072, -0.174627, 0.885843, 0.294829, -0.358271, 0.999115, -0.00307948, 0.0419374, 0.959581, 0.171924, -0.222815, -0.932612, -0.35746, -0.0495615, -0.978548, -0.205956, -0.00504194, -0.963334, 0.25, 0.0974047, 0.933409, 0.151073, -0.325462, 0.921566, 0.140885, -0.361756, 0.471114, 0.695752, 0.5422, 0.279471, 0.814514, 0.508393, 0.475087, 0.676999, 0.562108, 0.940158, -0.336195, 0.0554577, -0.214479, 0.412754, -0.88523, 0.795381, 0.363863, -0.484741, 0.981964, 0.0984164, -0.161433, 0.969388, 0.112287, -0.218354, 0.900605, 0.256766, -0.350689, 0.969604, -0.236766, 0.0617189, 0.946549, -0.294485, 0.131615, -0.153129, -0.533151, -0.832046, 0.436424, 0.852946, 0.286386, 0.271423, 0.961615, 0.0403371, 0.24324, 0.862363, 0.444031, -0.0556519, 0.414976, -0.908129, -0.879121, -0.427034, -0.211634, -0.917614, -0.352764, -0.183144, -0.894095, -0.421328, -0.151913, -0.783816, 0.619179, 0.047434, -0.802712, 0.577745, -0.147867, -0.772297, 0.629867, -0.0826195, 0.919218, 0.393511, -0.013708, 0.993959, -0.0867878, -0.0671867, 0.962138, -0.247421, 0.11434, 0.993746, 0.111293, -0.00909845, 0.999302, -0.0366202, 0.00734461, -0.25436, -0.275061, 0.927169, -0.396872, -0.298849, 0.867861, -0.329167, -0.288794, 0.899026, -0.235018, 0.140714, -0.961751, -0.0333648, 0.213502, -0.976373, 0.168308, -0.129818, 0.977149, 0.398587, 0.086945, 0.913, -0.163032, 0.21106, -0.963781, -0.0990336, 0.430121, -0.897323, -0.780984, 0.577634, -0.237494, -0.511305, 0.846374, -0.149057, 0.264012, -0.0614662, 0.962559, 0.394471, 0.0630724, 0.916741, 0.99488, -0.100665, 0.00902025, 0.64076, 0.767741, 0.00114885, 0.340075, 0.888053, -0.309374, 0.322921, 0.827667, -0.459009, -0.63413, 0.398341, 0.662724, 0.10597, -0.166842, 0.980273, 0.723842, 0.416475, -0.550092, 0.942183, 0.262408, -0.208405, 0.926386, -0.224004, 0.302708, 0.963655, -0.179173, 0.198155, -0.89251, -0.431397, 0.131614, -0.845486, -0.444784, 0.295502, -0.865825, -0.43893, 0.240181, 0.307829, -0.139726, 0.941126, 0.110588, 0.0567124, 0.992247, 0.280172, -0.282708, 0.917377, -0.29326, 0.44475, -0.846284, -0.126294, 0.516141, -0.847142, -0.158762, 0.479908, -0.862834, -0.539391, -0.84042, 0.0524555, -0.696453, -0.694592, -0.180266, -0.627326, -0.771604, -0.105303, -0.822659, -0.271949, -0.499275, -0.895621, -0.313534, -0.315531, 0.956785, 0.249422, -0.149505, 0.984728, 0.0386317, -0.169762, 0.995893, -0.0751628, -0.0504742, -0.43398, 0.461727, -0.773608, -0.390126, 0.433254, -0.812461, -0.273146, 0.155147, -0.949379, -0.659595, 0.741884, 0.120598, -0.637314, 0.711609, 0.295708, -0.590774, 0.79261, 0.150851, 0.976284, -0.0331904, 0.213935, 0.967874, -0.200585, 0.151613, 0.72267, 0.416861, -0.551338, 0.961969, 0.258155, -0.0892863, -0.675885, 0.648554, 0.350083, -0.368157, 0.621143, 0.69184, -0.280551, 0.591148, 0.756198, -0.313746, 0.163342, -0.935352, 0.00837372, 0.964846, 0.262681, 0.0168882, 0.90486, 0.425374, -0.0600655, 0.841714, 0.536572, -0.19903, -0.26083, 0.944645, -0.108077, -0.24097, 0.964496, -0.0395767, -0.225827, 0.973363, -0.79156, 0.0290165, 0.610403, -0.679861, -0.0438892, 0.732027, -0.669324, -0.048879, 0.741361, -0.113343, 0.918444, 0.378965, -0.421302, -0.477349, -0.771131, -0.309148, -0.666852, -0.678038, -0.144764, -0.692659, -0.706588, 0.900751, 0.318805, 0.294975, 0.875021, 0.319118, 0.364007, 0.88619, 0.355422, 0.297226, -0.802364, 0.0626793, 0.593534, 0.0584126, -0.198766, 0.978305, 0.102539, -0.187786, 0.976843, -0.638142, -0.0736374, 0.766389, -0.477234, 0.872934, 0.101169, -0.241946, 0.97029, -3.82173e-05, -0.462636, 0.88633, -0.0196613, 0.519305, 0.227731, 0.823687, 0.531918, 0.164625, 0.83064, 0.927804, 0.309649, -0.20808, 0.918208, 0.281561, -0.278598, 0.822374, 0.349624, -0.448847, 0.964702, -0.0087394, 0.263198, 0.964205, 0.207974, 0.164486, 0.986496, 0.144803, 0.0765329, 0.992754, 0.0790595, 0.0904914, 0.910456, -0.338193, 0.238109, -0.226305, -0.193736, 0.954595, -0.38731, -0.152512, 0.909247, -0.461086, -0.120294, 0.879164, -0.592988, -0.0962805, 0.799434, -0.451713, -0.147834, 0.87983, -0.259702, -0.256665, 0.930955, -0.171139, -0.244393, 0.954455, -0.093603, -0.239898, 0.966275, 0.409157, 0.808058, -0.423832, 0.674872, 0.341015, -0.654413, 0.515765, 0.695658, -0.500047, -0.261369, 0.236016, -0.935939, -0.507002, 0.295273, -0.809792, -0.373011, 0.223057, -0.900616, -0.164384, 0.126623, -0.978235, -0.333114, 0.0470237, -0.941713, -0.338674, 0.0231882, -0.940618, 0.952723, 0.273599, -0.132143, 0.969179, 0.176524, -0.171845, 0.94267, 0.195319, -0.270599, 0.992505, -0.0179502, 0.120876, 0.957908, 0.276721, 0.0764018, 0.956051, 0.245942, 0.159619, 0.944341, 0.282141, 0.169162, 0.920743, 0.183436, 0.34436, 0.870088, 0.154966, 0.467903, 0.88044, 0.184312, 0.436869, 0.946619, 0.174224, 0.271217, 0.990496, 0.128594, 0.0487951, 0.992879, 0.100567, 0.0638542, 0.822575, -0.324669, 0.466862, 0.879952, -0.196713, 0.432421, -0.00575233, -0.26017, 0.965546, 0.0499315, -0.211028, 0.976204, 0.171554, 0.525412, -0.833373, 0.229965, 0.564356, -0.792855, 0.277922, 0.504348, -0.817553, -0.399371, 0.718611, -0.569299, -0.391595, 0.710646, -0.584496, -0.203077, -0.399307, 0.894043, 0.720227, 0.332394, 0.608923, 0.961783, 0.238548, -0.134417, -0.319273, -0.737268, -0.595399, -0.330735, -0.734579, -0.59246, -0.156883, -0.810382, -0.564508, 0.986367, 0.16406, -0.0127846, 0.991258, 0.0199744, -0.130415, 0.960965, 0.221226, -0.166149, 0.85867, 0.371914, 0.352655, 0.81268, 0.358841, 0.459112, 0.852275, 0.366314, 0.373418, 0.168153, 0.981919, 0.0869452, 0.671358, 0.635761, 0.380902, 0.501324, 0.834427, 0.228924, 0.167241, 0.422226, -0.89093, -0.146185, 0.813003, 0.56361, -0.30942, 0.786307, 0.534772, -0.0630279, 0.46697, 0.882024, 0.0935161, -0.196958, 0.975942, -0.0151052, -0.225161, 0.974205, 0.00929551, -0.22329, 0.974708, -0.0726153, -0.30787, 0.948653, -0.133051, 0.181483, -0.974352, -0.0653812, -0.274624, 0.959326, 0.549885, 0.0666638, -0.832576, 0.665964, -0.261826, -0.698527, 0.394662, 0.0637266, -0.916614, 0.950928, 0.13914, 0.276363, 0.969767, -0.0366057, 0.241272, 0.985014, 0.0678743, 0.158557, 0.971312, 0.160813, 0.17519, -0.135412, -0.217307, 0.966665, -0.215975, -0.206833, 0.95424, -0.0735628, -0.192243, 0.978586, -0.531875, -0.116299, 0.838799, -0.362364, -0.7489, -0.554835, -0.332428, -0.759466, -0.559199, -0.247339, -0.785761, -0.566924, 0.899376, 0.358868, -0.249673, 0.81958, 0.418595, -0.391238, 0.889886, 0.386973, -0.241567, 0.90862, 0.175539, 0.378939, 0.832065, 0.121369, 0.541238, 0.932964, 0.225106, 0.280902, 0.964045, 0.201824, 0.172874, 0.921323, 0.212438, 0.32563, 0.968446, 0.106249, 0.225442, 0.979368, 0.129506, 0.155133, 0.720197, -0.529465, 0.448311, 0.94216, -0.303929, 0.141283, -0.26596, -0.279932, 0.922444, -0.203881, -0.270904, 0.940768, -0.461455, -0.272101, 0.844405, 0.777838, -0.00831728, 0.62841, 0.139636, -0.141294, 0.98007, 0.176791, -0.123261, 0.9765, 0.0529494, -0.189275, 0.980495, 0.76694, 0.47991, -0.426015, 0.841085, 0.442025, -0.311752, 0.702952, 0.43214, -0.564901, 0.777152, 0.412557, -0.475217, 0.937331, 0.315753, -0.147347, -0.413055, -0.262165, 0.872156, -0.335729, -0.252509, 0.907483, 0.994829, 0.0683167, -0.0751556, 0.993937, 0.0588701, -0.0928635, 0.989089, 0.105622, -0.102698, 0.981149, 0.193177, 0.00532961, 0.974359, 0.221456, 0.0397761, 0.947211, 0.172723, 0.270107, 0.979303, 0.141, 0.145208, 0.970334, 0.112512, 0.213992, 0.978132, 0.122254, 0.16826, 0.0568661, 0.931758, 0.358599, 0.0580869, 0.929313, 0.364697, -0.00198047, 0.802597, 0.596519, 0.98546, 0.120004, -0.120283, 0.970339, 0.00737225, -0.241637, -0.020311, -0.955259, 0.295072, 0.0680801, -0.87115, 0.486274, 0.0754612, -0.982087, 0.172659, 0.0275234, 0.330656, -0.94335, 0.133701, 0.538033, -0.832253, 0.4633, -0.842977, 0.27339, 0.530887, -0.818645, 0.219043, 0.545642, -0.795594, 0.263259, -0.799719, 0.452606, -0.394459, -0.840597, 0.429393, -0.330181, -0.826093, 0.39955, -0.397405, 0.868521, 0.464688, -0.172442, 0.909216, 0.393477, -0.136024, 0.967487, 0.25245, 0.0154133, 0.859836, -0.488044, 0.149981, 0.685607, -0.419335, 0.595064, 0.706176, -0.388441, 0.591971, 0.0871771, 0.871873, 0.481911, 0.16012, 0.862968, 0.479215, 0.0577871, 0.746151, 0.663264, 0.98645, -0.0178888, -0.163082, -0.225961, -0.796795, -0.560411, 0.37282, -0.0550929, 0.926267, 0.54444, 0.00806055, 0.838761, 0.459467, -0.048657, 0.886861, 0.945722, 0.32478, 0.0113135, 0.985549, 0.168349, 0.0187394, 0.995086, 0.0734967, 0.0663479, 0.828549, -0.53915, 0.151076, 0.830289, -0.547739, -0.10297, 0.840512, -0.534896, 0.0861727, -0.540815, 0.841012, 0.0147551, -0.422833, 0.86072, 0.283501, 0.0198791, 0.597884, -0.801336, 0.0968764, 0.537457, -0.837708, -0.0301328, 0.501488, -0.86464, 0.83483, 0.52998, 0.148927, -0.873467, 0.0455157, 0.484752, -0.855132, 0.1161, 0.505243, -0.78056, -0.18903, 0.595814, -0.633347, -0.242359, -0.734938, -0.548425, -0.174901, -0.817703, -0.489131, -0.0960796, -0.866903, 0.800728, 0.508893, -0.316011, 0.828829, 0.491234, -0.267826, 0.911315, 0.410207, -0.0351358, 0.931179, 0.362972, 0.0340145, 0.972938, 0.229787, 0.0242922, -0.332095, -0.27503, 0.902259, 0.99391, 0.0982325, 0.0499301, 0.925138, 0.186267, 0.330792, -0.162398, -0.821512, -0.546575, -0.362664, -0.776037, -0.515985, -0.197869, -0.781862, -0.591219, 0.871221, 0.46308, -0.162883, 0.945703, 0.289247, 0.148262, 0.943657, -0.0960139, 0.316691, 0.96241, 0.260557, 0.0766624, 0.975874, 0.216376, 0.0291771, -0.227083, -0.31573, -0.921275, -0.162739, -0.561724, -0.811161, -0.339585, 0.0760206, -0.937498, 0.866279, -0.406911, -0.2898, 0.646378, -0.593542, 0.479483, 0.831525, -0.506394, 0.228323, 0.952332, 0.246587, 0.179607, -0.657877, -0.710784, -0.248966, -0.631872, -0.63312, -0.447098, -0.707294, -0.704588, -0.0573713, 0.910313, 0.413532, -0.0179643, 0.891964, 0.138899, 0.430241, 0.641271, 0.51664, -0.567322, 0.527864, 0.487665, -0.695372, 0.658189, 0.610406, -0.440672, 0.618044, -0.23939, -0.748809, 0.820169, -0.070157, 0.567804, -0.476122, -0.865891, 0.153428, -0.543338, -0.822134, 0.169941, -0.49452, -0.852631, 0.168733, 0.718726, 0.510385, -0.472166, 0.761608, 0.543305, -0.353233, 0.927443, 0.333662, 0.168876, 0.976099, 0.188081, 0.108885, 0.977606, 0.126105, 0.168477, 0.909284, 0.272896, 0.314214, 0.925461, 0.302391, 0.228212, 0.0118324, -0.565042, -0.824977, 0.417086, -0.353195, -0.837432, 0.23743, -0.655378, -0.717012, 0.961025, 0.218272, 0.169668, 0.986512, 0.0324479, -0.160443, 0.905549, 0.200044, 0.374118, -0.598068, 0.800427, 0.0403733, -0.458994, 0.882037, 0.106471, -0.87555, 0.207907, 0.436105, -0.857965, 0.509516, -0.0654895, -0.837006, 0.546996, -0.0147072, 0.837793, 0.512117, -0.189314, 0.950113, 0.265489, 0.163712, 0.98609, 0.140874, 0.0882093, 0.937153, 0.252006, 0.241322, 0.968158, 0.22519, 0.10936, 0.970742, 0.238343, 0.0291853, 0.112686, -0.251019, 0.961401, 0.0687388, -0.247406, 0.966471, 0.283206, -0.264177, 0.921957, 0.428865, 0.827297, 0.362841, 0.524805, 0.656519, 0.541814, 0.511718, 0.843999, 0.160655, 0.939927, 0.115417, 0.321274, 0.91984, 0.321755, 0.224429, -0.659452, 0.690345, 0.297567, -0.689147, 0.712205, 0.13357, -0.724738, 0.688338, 0.0307673, -0.293823, -0.395391, -0.870249, -0.314112, -0.304703, -0.899161, 0.704803, 0.554401, -0.442597, 0.824407, 0.539037, -0.172603, 0.878976, 0.47071, -0.0763757, 0.913011, 0.370219, 0.171318, 0.918061, 0.357895, 0.170515, 0.960154, 0.261146, 0.0995355, 0.961752, -0.126691, 0.242861, -0.865999, 0.49748, 0.0505993, -0.853088, 0.428328, 0.297952, -0.862261, 0.460588, 0.210629, 0.950008, 0.0731024, 0.303548, 0.958592, 0.110748, 0.262367, 0.938788, 0.115237, 0.324649, 0.380335, 0.675979, 0.631187, -0.23663, -0.219146, 0.946563, -0.441307, -0.1328, 0.887475, -0.122719, -0.316588, -0.940591, -0.592363, -0.804407, -0.0451201, 0.812135, 0.547969, -0.200414, 0.916577, 0.387018, 0.100518, 0.905886, 0.386864, 0.172358, 0.934742, 0.313398, 0.167448, 0.964159, 0.0443043, -0.261599, 0.928771, 0.167842, 0.330475, 0.959406, 0.167151, 0.227157, -0.846628, 0.403619, 0.346862, -0.854614, 0.354627, 0.379306, 0.932395, 0.0482302, 0.358209, 0.875658, 0.079979, 0.476263, 0.938525, -0.207771, -0.275686, 0.857655, -0.344931, 0.381379, 0.931038, -0.363137, -0.0360616, -0.789642, 0.542248, 0.28711, -0.769958, 0.590009, -0.243008, -0.451473, -0.131044, 0.88261, -0.351073, -0.173433, 0.920146, -0.238316, -0.201144, 0.95013, 0.891429, 0.133268, 0.433122, -0.784014, -0.395617, -0.47834, -0.7725, -0.0839501, -0.629441, -0.70501, -0.550029, -0.447693, 0.551599, -0.755725, 0.353012, 0.616341, -0.718499, 0.322308, 0.490709, -0.793984, 0.35888, 0.969815, 0.12672, -0.20833, 0.917172, 0.0462599, -0.395799, 0.913611, 0.0281773, -0.405612, 0.729563, 0.616799, -0.29546, 0.763395, 0.438437, -0.474343, 0.650764, 0.381174, -0.656668, 0.850177, 0.526434, -0.00815994, 0.93775, 0.345747, 0.0329251, 0.957325, 0.266098, 0.112783, 0.984649, 0.157464, 0.0753055, 0.990663, 0.0568391, 0.123923, 0.982592, 0.135349, -0.127255, 0.978935, 0.183083, 0.090367, 0.98193, 0.125783, -0.141393, 0.865443, 0.181998, 0.466782, 0.871973, 0.238015, 0.427798, 0.891738, 0.280495, 0.355142, 0.241286, -0.110768, 0.964112, 0.204685, -0.124693, 0.970853, 0.795057, 0.56194, -0.228271, 0.970333, 0.164542, 0.177144, 0.946364, 0.208422, 0.246893, 0.947152, 0.256579, 0.192537, -0.142638, -0.426772, -0.89304, -0.218313, -0.633451, -0.742347, -0.0400856, -0.716344, -0.696595, 0.873171, 0.454903, 0.175032, 0.8987, 0.428162, 0.0949509, 0.899221, 0.378393, 0.219593, 0.924263, 0.290231, 0.247999, 0.930528, 0.248686, 0.268837, 0.917104, 0.365369, 0.159457, -0.0524494, -0.829978, -0.555325, 0.112389, -0.84657, -0.520277, -0.0378036, -0.784178, -0.619383, -0.304004, -0.79806, -0.520271, -0.210311, -0.728744, -0.651691, 0.384832, -0.284965, 0.877895, -0.713143, -0.303006, -0.632151, -0.886563, -0.121944, -0.446247, -0.579409, -0.571301, -0.581292, 0.965972, 0.257914, 0.0194417, -0.803426, 0.553168, -0.220254, -0.881664, 0.46532, -0.0784018, 0.840436, -0.531634, -0.105036, 0.83106, -0.513007, -0.214859, 0.842408, -0.531958, 0.085847, 0.829239, -0.428383, 0.358958, 0.906742, -0.420545, -0.0309973, 0.932645, 0.101281, -0.346288, 0.972006, 0.0440069, -0.2308, 0.775847, -0.573674, -0.262599, 0.748928, -0.552479, -0.365888, 0.560659, -0.204598, -0.802372, 0.0614067, 0.404525, -0.912463, 0.0307168, 0.291179, -0.956175, -0.179714, 0.180954, -0.966933, 0.930948, 0.331602, 0.152889, 0.951296, 0.283881, 0.120199, 0.724626, -0.534473, 0.435035, 0.736664, -0.476687, 0.479684, 0.980981, 0.192991, 0.0207488, 0.96747, 0.113035, -0.226329, 0.212686, 0.940815, 0.263878, 0.336274, 0.892482, 0.300659, 0.366766, 0.894455, 0.2558, -0.220555, -0.806445, -0.548636, 0.5483, 0.73791, -0.393518, 0.561228, 0.797026, -0.223097, 0.665406, 0.690086, 0.284633, 0.796155, 0.589524, -0.136375, 0.772113, 0.544537, -0.3276, 0.954675, 0.296227, -0.0290861, 0.973846, 0.182857, 0.134858, 0.23601, -0.657376, -0.71565, 0.0345056, -0.549078, -0.835058, -0.157225, -0.492533, -0.855974, 0.449776, 0.756647, 0.474538, 0.491212, 0.870477, 0.0313093, 0.830346, 0.535699, 0.153464, 0.837455, 0.485821, 0.250295, 0.902745, 0.326672, 0.279888, 0.861769, 0.375974, 0.340584, 0.127874, 0.604315, -0.786417, -0.227413, 0.676366, -0.70058, -0.0676567, 0.617871, -0.783364, 0.908021, 0.177595, 0.379418, 0.0751648, 0.710931, 0.699234, -0.265905, -0.796438, -0.543121, 0.825482, 0.411953, 0.385843, 0.941132, -0.244023, 0.233931, 0.814377, -0.356169, 0.458185, -0.0409914, -0.393914, 0.918233, -0.197794, -0.872324, 0.447134, -0.299175, -0.938917, 0.170085, 0.944799, 0.293081, 0.146484, -0.833972, 0.221379, 0.505452, -0.806955, -0.179924, 0.56254, 0.545316, 0.646034, 0.534107, 0.523297, 0.701049, 0.484448, -0.11401, 0.65991, -0.742644, -0.0464839, 0.618627, -0.784309, -0.254054, -0.86541, -0.431882, 0.394568, 0.820684, 0.413271, -0.844611, 0.532007, 0.0600107, -0.704696, -0.28801, 0.648425, -0.786741, -0.276513, 0.551886, -0.818379, -0.244611, 0.520021, 0.773757, 0.585188, -0.2426, 0.808762, 0.588081, 0.00809867, 0.931484, 0.296272, 0.211096, 0.945635, 0.242573, 0.216639, 0.980041, 0.17634, 0.0917828, 0.0275835, 0.801979, 0.596715, 0.0130211, 0.600383, 0.799606, -0.147445, 0.427088, 0.892108, -0.123107, 0.618857, 0.775797, -0.0637897, 0.26258, 0.9628, 0.612311, -0.763335, 0.205901, 0.659045, -0.748144, 0.077079, 0.68137, -0.729811, 0.055775, 0.798719, 0.594858, -0.0905079, 0.969368, 0.144777, 0.198408, 0.975098, 0.1558, 0.157831, -0.0601804, 0.997817, 0.027189, -0.0817462, 0.995171, -0.0543313, -0.287946, -0.176964, 0.941154, 0.901393, -0.431681, -0.0337875, 0.908375, -0.417947, -0.013268, 0.889952, -0.332659, -0.311966, 0.738908, 0.644304, -0.1972, 0.835635, 0.543451, -0.0798441, 0.937747, 0.155769, 0.310429, -0.400347, -0.657995, -0.637781, 0.947916, 0.17054, 0.269019, 0.985282, 0.154369, 0.0734132, -0.0118458, 0.967512, 0.252548, -0.0110609, 0.900016, 0.435717, -0.136176, 0.678225, -0.722127, 0.640627, 0.741454, -0.199608, 0.874119, 0.469017, 0.12625, 0.931915, 0.330862, 0.148545, 0.246439, 0.458968, -0.85359, -0.152688, -0.809866, -0.566395, 0.932435, 0.29097, 0.214246, -0.31337, -0.870611, -0.379257, 0.566044, 0.823254, -0.0429674, 0.636712, 0.767397, -0.0755006, 0.809091, 0.583691, -0.0683802, -0.020969, -0.827276, -0.561404, -0.144151, -0.074534, -0.986745, 0.0958689, -0.351011, -0.931451, 0.0973103, 0.09901, -0.990317, 0.940886, 0.336526, 0.0385047, 0.929528, 0.3653, -0.0503321, 0.928721, 0.341085, -0.145388, 0.3025, 0.875197, 0.377524, 0.340642, 0.893534, 0.292508, 0.441959, 0.887543, 0.130152, 0.706152, 0.708054, -0.0030335, 0.848436, 0.505588, -0.156643, 0.867193, 0.468486, -0.168809, 0.941831, 0.312398, 0.123941, -0.283517, 0.958534, -0.028815, -0.0647757, 0.99776, -0.0167035, -0.363092, 0.931231, -0.0311972, 0.0513102, 0.381264, 0.923041, -0.108918, 0.478644, 0.871227, 0.0468952, 0.720328, 0.692046, -0.0250856, 0.0610574, 0.997819, 0.129804, -0.464273, 0.876129, 0.761799, 0.646665, 0.0385572, 0.894057, 0.429214, -0.128208, 0.943555, 0.197004, 0.266258, 0.944713, 0.263105, 0.195686, 0.959024, 0.178429, 0.220083, 0.952181, 0.242559, 0.185788, 0.970728, 0.209986, 0.11659, 0.715873, 0.212308, -0.66517, 0.577503, 0.323447, -0.749581, 0.593312, 0.321505, -0.737981, -0.00368541, 0.999982, -0.00467405, -0.0376692, 0.887796, 0.458692, 0.0696649, 0.716285, 0.694321, 0.865063, 0.417656, 0.277903, 0.823593, 0.388047, 0.413659, 0.839615, 0.453197, 0.299432, 0.290291, 0.914894, 0.280535, 0.297687, 0.907645, 0.295912, 0.284715, 0.882393, 0.374593, -0.331051, -0.185421, 0.925216, -0.384624, -0.166537, 0.907926, 0.0752126, 0.974335, 0.212167, 0.676152, 0.729912, 0.100235, 0.814969, 0.570085, 0.104063, 0.852626, 0.511102, 0.108645, 0.879926, 0.46763, -0.0839726, 0.882257, 0.442574, -0.160468, 0.912239, 0.409385, -0.014993, 0.922886, 0.383988, -0.0288752, 0.929492, 0.364621, 0.0556549, 0.931287, 0.256781, 0.258395, 0.189333, -0.149379, 0.970484, 0.191057, -0.153358, 0.969525, -0.819046, -0.239937, 0.521146, -0.656623, -0.461627, 0.596445, 0.338261, 0.830867, 0.441859, 0.236297, 0.870435, 0.431865, 0.462817, 0.882347, 0.0852316, 0.582103, 0.812196, 0.0386527, 0.780999, 0.622211, 0.0537962, 0.917554, 0.392635, 0.0626993, 0.906834, 0.281512, 0.313693, 0.891906, 0.272629, 0.360801, 0.979105, 0.202516, -0.0184566, 0.25044, -0.767828, 0.589678, 0.652749, -0.66305, 0.366448, 0.617858, -0.642846, 0.452769, 0.388989, 0.821608, 0.416711, 0.807361, 0.543908, 0.228762, 0.878594, 0.463404, -0.115456, 0.87119, 0.42262, -0.249839, 0.915263, 0.402556, 0.0155562, 0.903228, 0.429143, -0.00400167, 0.234488, 0.946168, 0.223119, 0.374472, -0.895329, 0.241156, 0.153952, -0.97575, 0.155597, 0.679085, -0.723015, 0.126853, 0.883798, -0.462626, 0.0698455, 0.634192, 0.764085, 0.118217, 0.8341, 0.541737, 0.103914, 0.937122, 0.310695, 0.158968, 0.91318, 0.287131, 0.289237, 0.894401, 0.431364, -0.118207, 0.859386, 0.413749, 0.300445, 0.88393, 0.438566, 0.162258, 0.911338, 0.399359, 0.099877, -0.577084, -0.613174, -0.539436, 0.401624, 0.908682, 0.113998, 0.582028, 0.813059, 0.013348, 0.909329, 0.415701, -0.0177245, 0.912979, 0.400548, 0.0776601, 0.921882, 0.38649, -0.0275414, 0.257026, -0.451368, -0.85452, -0.121975, -0.705979, -0.69765, 0.0433734, -0.653061, -0.756062, 0.0852071, 0.513266, -0.853989, 0.789927, 0.298571, -0.535603, 0.914855, 0.401, 0.0473333, 0.907696, 0.419524, -0.00936187, 0.91023, 0.413916, -0.0124728, 0.910983, -0.37804, 0.164912, 0.943072, -0.283127, -0.174511, -0.690292, -0.410117, 0.596071, 0.769309, 0.60999, -0.189937, 0.797519, 0.294118, -0.526743, 0.689533, 0.217512, -0.690821, 0.874431, 0.373496, -0.309631, 0.911598, 0.398393, 0.101355, 0.0822518, -0.192925, 0.97776, 0.141217, -0.166065, 0.975951, 0.620058, -0.272168, 0.735835, 0.954117, 0.269074, 0.131373, 0.151516, -0.896051, -0.417295, 0.130174, -0.774267, -0.619327, 0.471059, -0.0460697, -0.880898, 0.48284, 0.021094, -0.875455, -0.569764, -0.108256, 0.814647, -0.335151, -0.173049, 0.926136, 0.308839, -0.0374474, 0.950377, 0.627941, 0.680797, -0.377101, 0.409809, 0.911351, -0.0386757, -0.25262, -0.277053, 0.927052, -0.207281, -0.267002, 0.94114, 0.750057, 0.235796, 0.617912, 0.827923, 0.331587, 0.45232, 0.316004, -0.23271, 0.919776, 0.170798, -0.171865, 0.970201, -0.403693, -0.690151, -0.600602, -0.296831, -0.749322, -0.591953, 0.508775, -0.235337, -0.828109, 0.588657, -0.109039, -0.800996, 0.676125, -0.280122, -0.68146, 0.677449, 0.101226, -0.728571, 0.909517, 0.406082, -0.0887524, 0.880009, 0.472556, 0.0476927, 0.903839, 0.427339, -0.0213728, -0.66162, -0.575165, 0.481087, -0.710486, -0.580001, 0.398508, -0.715256, -0.603406, 0.352575, 0.977188, 0.191206, 0.0924347, -0.659452, 0.690345, 0.297567, -0.724738, 0.688338, 0.0307673, -0.750864, 0.660028, -0.0238115, -0.183375, -0.781362, -0.596529, 0.631586, -0.0361301, -0.774464, 0.887228, 0.11864, -0.445815, 0.599525, -0.208979, -0.772591, 0.559672, -0.238354, -0.793697, 0.289774, 0.490216, -0.822021, -0.0207576, 0.507956, -0.861133, 0.167426, 0.495606, -0.852258, 0.90473, -0.345283, 0.249485, 0.765472, -0.216452, 0.605971, 0.569895, -0.195589, 0.798101, 0.88483, 0.346295, -0.311699, 0.89126, 0.452549, 0.0292327, 0.858154, 0.490543, 0.151456, 0.867192, 0.478697, 0.137211, 0.563846, -0.407281, -0.718471, 0.540562, -0.39056, -0.745155, 0.941334, 0.222147, 0.254048, 0.914155, 0.19572, 0.354984, 0.934323, 0.280248, 0.220231, -0.325329, 0.894246, 0.307385, -0.855708, 0.281556, 0.434155, 0.64005, 0.215575, 0.737471, 0.217892, -0.0688454, 0.973542, 0.893325, 0.382434, -0.23604, 0.850917, 0.499564, 0.162407, 0.181809, 0.773108, 0.60766, 0.282823, 0.681337, 0.675123, 0.661814, -0.174842, -0.728994, 0.538077, -0.360776, -0.761783, 0.705535, -0.581506, 0.405056, 0.917362, 0.395916, 0.0411934, -0.0362274, 0.388103, 0.920904, -0.110386, 0.0956327, 0.989277, 0.12352, -0.989192, 0.0790114, 0.0317814, 0.868969, 0.493845, 0.259582, 0.922885, 0.28443, 0.0329533, 0.585524, 0.809985, 0.305275, 0.904427, 0.298025, 0.316812, 0.877154, 0.360875, 0.364547, -0.526908, -0.767772, 0.26714, -0.546719, -0.793558, 0.247959, -0.749228, -0.614145, 0.573517, -0.366283, -0.732745, 0.92567, 0.378163, 0.0113392, 0.937762, 0.337261, 0.0828096, 0.922323, 0.362596, 0.133586, -0.292326, 0.224403, -0.929618, 0.910223, -0.00806483, 0.41404, 0.188545, 0.819836, 0.540667, 0.0653318, 0.732172, 0.677979, -0.163838, 0.222632, 0.961037, 0.92786, 0.369839, -0.047898, 0.912796, 0.145182, 0.381739, -0.76844, 0.410232, 0.491132, -0.24054, -0.276766, -0.930345, 0.0900745, 0.00671215, -0.995912, -0.126622, -0.206718, -0.970172, 0.869696, 0.490926, 0.0511859, 0.644558, -0.733424, -0.215949, 0.647806, -0.736366, -0.195227, 0.791423, 0.130496, 0.597177, 0.892533, 0.0974087, 0.440337, 0.414606, -0.844153, -0.339865, 0.814531, 0.0228744, -0.579668, 0.648951, -0.170463, -0.741488, 0.790678, -0.111478, -0.601998, 0.634064, -0.238472, -0.735591, -0.86204, -0.447275, -0.238393, -0.755663, -0.103624, -0.646712, -0.770204, -0.140204, -0.622197, 0.751742, 0.238179, 0.614943, 0.728019, 0.232063, 0.645086, 0.829338, 0.285464, 0.480322, 0.918739, 0.374142, 0.126238, 0.809244, -0.393226, 0.436459, 0.884748, -0.400293, 0.238719, 0.924283, -0.381709, 0.000412344, 0.259144, -0.681767, -0.684133, 0.0379909, 0.609602, -0.791797, 0.399081, 0.462848, -0.791521, 0.313457, 0.471594, -0.824223, -0.155534, -0.321716, 0.933974, 0.0918396, -0.104698, -0.990254, 0.225879, 0.347224, -0.910173, 0.327405, 0.141655, 0.934205, 0.918351, 0.385166, 0.0909813, 0.852061, 0.498165, 0.160694, -0.724794, -0.682698, -0.0927196, -0.670308, -0.730347, -0.131457, -0.568192, -0.801772, 0.185255, 0.950067, 0.120949, 0.287653, 0.933071, 0.1606, 0.321847, 0.147714, -0.860161, -0.488163, 0.371476, -0.873272, -0.315281, 0.293318, 0.938693, 0.181165, 0.195234, 0.970029, 0.144661, 0.448024, 0.55851, 0.698098, 0.843612, 0.00379292, -0.536941, 0.382335, -0.0290243, 0.923568, 0.459977, 0.0958695, 0.88274, -0.0332648, -0.746027, -0.665084, 0.821097, 0.209766, -0.530847, 0.851169, 0.227681, -0.472941, 0.921492, 0.284532, -0.264376, -0.869006, 0.406867, 0.28158, 0.958322, 0.11961, -0.259445, 0.789209, 0.133045, 0.59954, 0.940339, 0.338738, -0.0319199, 0.894965, 0.305454, -0.325169, 0.697222, 0.278786, 0.660424, 0.926082, 0.365431, 0.0939838, 0.859967, 0.506006, 0.0664427, -0.710442, -0.326442, 0.623465, -0.74481, -0.335997, 0.57651, -0.767686, -0.32755, 0.55079, 0.948227, 0.184619, 0.258422, 0.104688, 0.0919565, 0.990245, 0.969053, -0.0655364, -0.237994, 0.930338, 0.257593, -0.260991, 0.930712, 0.359996, 0.0646442, 0.852276, 0.224528, -0.472454, 0.22435, -0.0715172, 0.971881, 0.893474, 0.0597239, -0.445127, 0.724582, -0.183507, -0.664309, 0.877995, 0.116545, -0.464264, 0.944033, 0.300975, -0.134965, 0.942301, 0.318618, -0.10272, 0.904007, 0.328205, -0.273957, 0.547767, 0.12012, 0.827963, -0.910108, 0.0536766, -0.41088, -0.799336, 0.344075, -0.492619, -0.82776, 0.0611951, -0.557735, 0.90581, 0.423089, -0.0224481, 0.842667, 0.514683, 0.158158, 0.974839, 0.22236, -0.0156352, 0.332856, -0.940051, -0.0742346, 0.874489, 0.0208446, -0.484597, 0.91527, 0.15749, -0.37078, 0.941903, 0.19394, -0.274237, 0.946326, 0.244612, -0.211263, 0.948189, 0.316945, -0.0219759, 0.946751, 0.321604, 0.015298, 0.945999, 0.323407, -0.0222261, 0.893833, 0.386435, -0.227445, -0.369568, 0.646219, -0.667698, -0.367384, 0.562562, -0.740644, 0.380749, 0.0114206, 0.924608, 0.285868, -0.0969629, 0.953351, 0.88517, 0.4611, 0.0621411, 0.811487, 0.489624, 0.318993, -0.617681, -0.0135553, 0.786312, -0.338187, -0.236444, 0.910892, -0.378885, -0.260517, 0.888019, -0.845301, 0.519887, 0.123222, 0.94907, 0.2619, -0.17514, 0.954108, 0.297492, -0.0343018, 0.863737, 0.384364, 0.325918, -0.0950752, 0.858382, 0.504124, -0.192032, 0.978713, 0.0724174, -0.154315, 0.685717, 0.711322, 0.923616, 0.100444, -0.369925, -0.54123, -0.53572, -0.648131, 0.932817, 0.105544, -0.344548, 0.961384, 0.238645, -0.137072, 0.749904, 0.235926, 0.618048, 0.921848, 0.383693, -0.0545534, 0.910882, 0.412663, -0.0018342, 0.862539, 0.156853, 0.481066, 0.847923, -0.485566, -0.212727, 0.948801, 0.077063, -0.306329, 0.946523, 0.106947, -0.304396, 0.962012, 0.174212, -0.210197, 0.949484, 0.309543, 0.0516068, 0.95207, 0.304958, 0.0237362, -0.156472, -0.251066, 0.955239, 0.944554, 0.327488, -0.0238477, -0.137255, 0.860021, 0.491453, -0.877749, -0.410729, -0.246695, 0.0332135, -0.0906492, -0.995329, 0.954836, 0.129316, -0.267517, 0.954984, 0.28852, 0.069003, 0.860052, 0.277506, 0.428135, 0.936566, 0.34807, 0.0411215, 0.887526, -0.393004, 0.24051, 0.273966, 0.773824, 0.571086, 0.592624, -0.675192, -0.439218, 0.60408, -0.793947, -0.068815, 0.838472, 0.360443, 0.408712, -0.878817, 0.405365, -0.251714, 0.261481, 0.267738, -0.927332, 0.914938, -0.177823, 0.362308, 0.948572, -0.253935, 0.18902, 0.875636, 0.185095, 0.446095, -0.0760533, -0.983573, 0.163705, 0.253305, 0.714752, 0.651894, 0.284542, 0.541445, 0.791122, 0.757972, 0.0320017, 0.651501, 0.826214, 0.0732283, 0.558577, 0.841229, 0.0677604, 0.536416, 0.163348, -0.930879, 0.326774, 0.026358, -0.799162, 0.600538, 0.258577, -0.949889, -0.175637, 0.916973, 0.150172, 0.369606, 0.889659, 0.194554, 0.413105, 0.83446, 0.3235, -0.446121, 0.779308, 0.615292, -0.11872, 0.819537, 0.553363, -0.148824, 0.801423, 0.0831854, 0.592285, 0.883989, 0.0851071, 0.459697, 0.633731, -0.751344, -0.18403, 0.52936, -0.799536, -0.283761, 0.833281, -0.354232, 0.424456, 0.789066, -0.363367, 0.495318, 0.900167, 0.068083, 0.430191, 0.893187, 0.0651777, 0.444936, 0.939739, 0.0807988, 0.332207, 0.632271, -0.339591, 0.696356, 0.475596, -0.166729, 0.863718, 0.519701, -0.160564, 0.839125, -0.282847, -0.2776, 0.918115, 0.408687, 0.907393, -0.0980402, 0.443969, 0.893121, -0.0722918, 0.637359, -0.320442, 0.700778, 0.577336, -0.345282, 0.739907, -0.221813, 0.86684, 0.446528, -0.185438, 0.78252, 0.594369, 0.878619, 0.0935652, 0.468267, 0.826783, 0.00760441, 0.562469, 0.88513, -0.0236234, 0.464744, -0.03796, 0.967211, 0.25112, -0.711223, -0.378851, 0.592144, -0.683961, -0.400642, 0.609659, -0.70559, -0.440985, 0.554685, -0.693311, -0.376785, 0.61429, -0.72008, -0.303764, 0.623868, -0.655023, -0.367173, 0.6604, 0.193677, 0.710291, 0.67674, 0.0770915, 0.560201, 0.824762, 0.376618, 0.792203, 0.48018, 0.880163, 0.0962808, 0.464804, 0.872661, 0.0956246, 0.478872, 0.857993, 0.158298, 0.488661, -0.386482, 0.917463, -0.0943063, -0.364788, 0.925313, -0.103563, -0.538774, 0.639261, -0.548697, -0.318337, 0.872023, -0.371804, -0.150533, 0.651293, -0.743746, 0.869652, -0.364417, 0.333024, 0.904323, 0.0669828, 0.42156, 0.896287, 0.147218, 0.418325, 0.105524, 0.99321, 0.0489713, 0.65296, 0.743688, -0.143428, 0.701084, 0.503699, -0.504746, 0.734401, 0.392791, -0.553508, 0.761536, -0.441139, 0.474827, -0.325696, -0.317152, 0.890694, -0.235294, -0.285758, 0.928967, -0.31978, -0.308056, 0.896014, 0.697065, -0.350685, 0.625396, 0.240879, 0.719012, -0.651919, 0.31828, 0.734551, -0.599276, 0.0214473, 0.529956, -0.847754, 0.81738, 0.223226, 0.531093, 0.691277, -0.00238688, 0.722586, 0.808885, 0.0743176, 0.583251, 0.804794, 0.0497244, 0.591468, 0.952074, -0.0828866, 0.294424, 0.105639, 0.666589, 0.737902, 0.978662, -0.203884, 0.0255456, 0.790097, -0.0597852, 0.610059, -0.0301079, 0.707272, 0.7063, 0.376791, -0.312382, 0.872035, 0.38256, -0.325179, 0.864816, -0.171944, 0.137979, -0.975396, 0.715732, -0.226101, 0.660762, 0.695226, -0.366464, 0.618358, 0.605135, -0.556688, 0.569131, 0.163406, 0.942446, 0.291709, -0.226968, 0.548733, -0.804598, -0.372015, 0.606785, -0.702437, 0.00370059, 0.53964, -0.841887, -0.58173, 0.551634, -0.597738, 0.158794, 0.717179, 0.678556, -0.477668, 0.532085, -0.699084, -0.679038, 0.462474, -0.57011, 0.344807, -0.189383, 0.91937, 0.357004, -0.330306, 0.873754, 0.123132, -0.266014, 0.956073, -0.300102, 0.574186, -0.761741, -0.628108, 0.488942, -0.605323, -0.682606, 0.445283, -0.579458, 0.683063, -0.443046, 0.580634, 0.627117, -0.500231, 0.597071, 0.491434, -0.307625, 0.814776, 0.472037, -0.314744, 0.823479, 0.556225, -0.140359, 0.819093, 0.695535, -0.161426, 0.700123, 0.645922, -0.152366, 0.748044, 0.537655, -0.0506549, 0.841642, 0.489841, -0.064312, 0.869437, 0.590629, -0.021421, 0.806659, -0.939861, -0.335791, -0.062497, -0.951292, -0.3082, -0.00748629, 0.272469, 0.55885, -0.783228, 0.43121, 0.508485, -0.745319, 0.0236596, 0.613791, -0.789114, -0.573914, 0.674072, -0.465026, -0.397717, 0.747289, -0.532335, -0.675887, 0.640857, -0.363977, -0.236715, -0.199945, 0.950783, 0.761244, -0.325851, 0.560651, 0.582592, -0.111634, 0.805062, 0.667106, -0.0797513, 0.740681, 0.685079, -0.105602, 0.720774, 0.769302, 0.0244103, 0.638419, 0.773504, 0.0288691, 0.633133, 0.819241, 0.0550153, 0.570804, 0.920893, -0.321389, 0.220601, 0.00736556, 0.598871, -0.800812, -0.0412106, 0.552246, -0.832662, 0.71354, -0.513719, 0.476396, 0.793196, -0.0175649, 0.608712, 0.817622, -0.0383646, 0.574476, 0.837695, -0.00783036, 0.546083, 0.630674, -0.0413982, 0.774943, 0.559704, -0.0674424, 0.825943, 0.645301, -0.0256774, 0.763497, -0.607319, 0.549717, -0.573563, -0.618538, 0.722837, -0.308086, -0.853691, -0.479713, 0.202698, -0.833538, -0.505226, 0.223522, -0.841307, -0.509344, 0.181026, 0.908325, 0.0795547, 0.410629, 0.112334, 0.854275, 0.507538, 0.0314159, 0.682885, 0.72985, 0.604901, -0.601406, 0.521924, -0.568747, 0.707612, -0.419299, 0.842542, 0.166553, 0.512233, 0.863347, -0.00588109, 0.504576, 0.524338, -0.352562, 0.775094, 0.056346, 0.808778, 0.585409, 0.0917427, 0.772346, 0.628542, 0.10763, 0.917474, 0.382958, 0.0733763, 0.811262, -0.58006, 0.521533, 0.617716, -0.588583, 0.793168, 0.0154602, 0.608807, -0.718835, 0.478755, -0.504054, 0.470577, -0.132417, 0.872366, 0.0307058, 0.62012, -0.783906, -0.448093, 0.788315, -0.42163, -0.9562, -0.284601, 0.0684449, -0.919589, -0.39216, 0.0238042, 0.54209, -0.144696, 0.827769, 0.783343, -0.221866, 0.580646, 0.678833, -0.209874, 0.703661, 0.769636, -0.163561, 0.617177, 0.87015, -0.124559, 0.476784, 0.687165, 0.000989486, 0.7265, 0.771209, -0.120616, 0.625051, 0.793979, -0.225654, 0.564515, 0.897294, -0.228792, 0.377515, 0.842036, -0.217191, 0.493764, 0.582075, -0.106334, 0.806152, -0.854494, -0.265777, 0.446321, -0.318239, 0.567725, -0.759218, -0.0488853, 0.544585, -0.83728, -0.47202, 0.605752, -0.640517, 0.634662, -0.460338, 0.62072, 0.846677, -0.382849, 0.369546, 0.856727, -0.402016, 0.323113, 0.751369, -0.55315, 0.359819, 0.520286, -0.680058, 0.51655, -0.272262, 0.844973, -0.460319, 0.740983, -0.0651083, 0.66836, -0.621224, -0.0178437, 0.78343, 0.0256162, 0.615552, -0.78768, 0.575791, -0.641998, 0.506264, 0.472895, -0.632956, 0.612974, -0.961951, -0.257618, 0.0910176, 0.808661, 0.118468, 0.576222, 0.573359, -0.480159, 0.663858, 0.710613, -0.481869, 0.512671, 0.541372, 0.82462, -0.164068, 0.477816, 0.802175, 0.358061, 0.477035, 0.864896, 0.156181, -0.675245, -0.0875091, 0.732384, -0.533036, 0.240029, -0.811331, 0.809093, 0.117446, 0.575826, 0.914741, -0.10482, 0.390207, 0.0302496, -0.431546, 0.901583, 0.0453495, -0.795365, 0.604432, -0.0845487, -0.0928641, 0.992083, 0.141783, 0.772279, 0.61926, 0.264315, 0.76665, 0.585137, 0.0205328, -0.784758, -0.619462, 0.0341876, -0.682324, -0.73025, 0.278984, -0.518797, -0.808095, -0.778409, 0.538212, -0.323121, -0.539142, 0.576573, -0.613913, -0.588818, 0.344087, -0.731367, -0.0525699, -0.99001, -0.130828, -0.0670696, -0.989947, -0.124525, 0.847699, -0.00712536, 0.53043, 0.793672, 0.164809, 0.585596, 0.785889, -0.423188, 0.450878, -0.315749, 0.884799, -0.342685, -0.176133, 0.88308, -0.43491, -0.383302, 0.852371, -0.35573, 0.708375, -0.577814, 0.405385, -0.0296438, 0.69654, 0.716905, 0.451143, 0.224538, 0.863744, 0.547207, -0.236186, 0.802982, 0.166272, 0.761571, 0.62639, 0.0652465, 0.590164, 0.804642, 0.349595, 0.766938, 0.538135, -0.450603, 0.578779, -0.679685, -0.492137, 0.600366, -0.630366, 0.531099, -0.547018, 0.647074, 0.768341, -0.483454, 0.419433, 0.877883, -0.367938, 0.306501, 0.789042, -0.509949, 0.342585, 0.716903, -0.611113, 0.335545, 0.525558, -0.660303, 0.53646, -0.331472, 0.827421, -0.453322, -0.2911, 0.86802, -0.402247, -0.55692, 0.814205, -0.164045, -0.792538, 0.0199291, 0.609497, -0.258971, 0.656864, 0.708141, 0.616273, -0.546339, 0.567205, -0.269516, 0.88703, -0.374885, 0.708085, 0.535542, -0.460228, 0.345968, 0.779001, 0.522938, 0.365019, 0.769691, 0.523772, 0.309941, 0.781067, 0.542098, 0.380961, 0.876425, 0.294531, -0.0169526, -0.291746, 0.956346, 0.047986, 0.669119, 0.741605, 0.391457, -0.887075, 0.244662, 0.676805, -0.72933, 0.100061, -0.734081, -0.475343, 0.484948, 0.842375, 0.0496306, 0.536601, 0.782307, 0.0359419, 0.621856, 0.959174, -0.121897, 0.2552, 0.355659, -0.933857, 0.0376609, 0.696717, -0.61008, 0.377342, -0.296015, 0.878937, -0.373958, -0.286598, 0.872129, -0.396551, 0.388885, 0.39332, -0.833107, 0.356825, 0.351573, -0.86549, 0.228107, 0.105202, -0.967936, 0.753207, 0.0312059, 0.657043, -0.604247, -0.777631, -0.173711, -0.528704, -0.848321, 0.0286837, 0.617856, -0.584648, 0.525777, -0.339226, 0.875149, -0.345023, -0.315313, 0.844506, -0.432883, 0.516418, 0.794079, -0.320549, 0.95165, 0.0837378, 0.295552, 0.49138, -0.178117, 0.852537, 0.625798, 0.0251926, 0.779578, 0.709493, 0.0953345, 0.698235, 0.658563, -0.127505, 0.741645, 0.794781, -0.161378, 0.585047, 0.835765, 0.0595332, 0.54585, 0.791601, 0.0697756, 0.607042, 0.709248, 0.0726535, 0.701205, -0.42101, 0.734467, -0.532268, 0.664589, -0.394494, 0.634583, 0.748097, -0.299576, 0.592119, -0.352486, 0.877007, -0.326517, 0.799653, -0.0850201, 0.594413, 0.429538, -0.113868, 0.895841, -0.956977, 0.263569, -0.121349, -0.899615, 0.316475, -0.300892, -0.722223, 0.688072, 0.0703649, 0.858462, 0.0635948, 0.508918, -0.450003, 0.683858, -0.574313, -0.554383, 0.66854, -0.495696, -0.598715, 0.633614, -0.489972, -0.244718, 0.910314, -0.333828, 0.284208, -0.725468, 0.626835, 0.810837, -0.161809, 0.56246, 0.843779, -0.147165, 0.51612, 0.134821, -0.959733, -0.246445, 0.286646, -0.952205, 0.105545, 0.0920118, -0.97134, -0.219163, 0.16635, -0.953791, -0.25022, 0.61963, -0.579621, 0.529243, 0.463657, -0.709711, 0.530408, -0.868914, -0.446609, -0.213372, 0.771999, -0.114433, 0.625238, 0.836808, -0.135303, 0.530515, -0.789212, 0.0681108, 0.610332, -0.774171, 0.0538301, 0.630684, -0.673902, -0.0353443, 0.737975, 0.552083, 0.832824, 0.0401043, 0.787505, -0.465702, 0.403681, 0.531877, -0.735048, 0.42049, -0.179235, -0.936122, -0.302574, -0.0610517, -0.9316, -0.358322, -0.410953, -0.897246, -0.161456, 0.763511, 0.0149935, 0.64562, 0.14792, -0.162819, 0.975505, 0.77922, -0.193766, 0.596046, -0.112292, -0.962706, -0.246145, -0.323359, 0.478241, -0.816532, -0.7105, 0.245286, -0.659564, -0.617505, 0.565213, -0.547012, -0.422379, 0.737012, -0.527645, -0.592029, 0.648868, -0.477987, 0.448777, -0.682438, 0.576956, 0.563912, -0.685059, 0.461191, 0.588384, -0.656855, 0.471535, 0.590098, -0.653157, 0.474521, -0.665332, 0.736108, -0.12441, -0.502933, 0.810339, -0.300682, 0.888872, 0.146873, 0.433975, 0.813673, -0.0716988, 0.576885, 0.842893, 0.0327394, 0.537085, -0.0452786, -0.937141, -0.346, 0.773367, -0.0344963, 0.633019, 0.743692, 0.0170726, 0.668304, 0.540059, -0.510225, 0.669333, 0.193829, -0.817061, -0.542993, 0.675065, -0.169619, 0.717995, 0.788507, 0.00404383, 0.615013, 0.841432, -0.0247813, 0.539794, -0.259869, 0.930077, -0.259662, -0.17868, 0.438445, -0.880818, -0.482243, 0.785602, -0.387649, -0.536946, 0.752325, -0.381702, 0.858, 0.132851, 0.496173, 0.798684, -0.0954982, 0.594124, -0.0173545, 0.618365, -0.7857, -0.15769, 0.615689, -0.77205, 0.817493, -0.0740023, 0.571164, 0.755431, -0.00766703, 0.655183, -0.717261, 0.628234, -0.301427, -0.497287, 0.71619, -0.489671, 0.80328, 0.551744, 0.224322, 0.754743, -0.0704253, 0.652229, 0.211065, -0.915296, -0.343051, -0.7038, -0.40055, 0.586708, -0.611583, -0.429001, 0.664774, -0.717591, -0.390448, 0.576727, 0.351871, 0.628948, -0.693261, 0.427579, 0.662449, -0.615092, -0.142439, 0.96494, 0.220461, 0.0887793, -0.957359, -0.274923, 0.567502, 0.484293, 0.665885, 0.682193, 0.529269, 0.504468, 0.478649, -0.0725577, 0.875003, 0.739837, -0.00540339, 0.672764, -0.868979, 0.0555444, -0.491722, -0.78675, 0.0725959, -0.612988, -0.897649, 0.0317999, -0.439563, -0.496387, 0.77612, -0.388893, -0.773538, -0.0164582, 0.633536, -0.744741, 0.0207702, 0.667031, 0.635001, -0.0183181, 0.772294, -0.072611, -0.224556, 0.971752, -0.0556742, -0.229885, 0.971624, 0.785697, -0.0332468, 0.617717, 0.104863, -0.966266, -0.235231, 0.0120355, -0.996919, -0.0775057, 0.112231, -0.918483, -0.379201, 0.563798, 0.314221, -0.763804, 0.568299, 0.519723, -0.637907, 0.512326, 0.425817, -0.745789, 0.546652, -0.605694, 0.578192, 0.0290517, 0.22553, -0.973803, 0.49752, -0.199617, 0.844172, 0.96629, 0.187516, 0.176412, -0.811962, -0.318611, -0.489085, -0.80894, -0.344295, -0.476526, -0.0683115, -0.206091, 0.976146, -0.487412, -0.865919, 0.112313, -0.429526, -0.896738, 0.106626, -0.572059, 0.00194298, -0.820211, 0.108874, 0.963673, 0.243888, 0.120071, 0.975625, 0.183681, 0.0759616, -0.519571, 0.851044, -0.311293, -0.385175, 0.868756, 0.669221, -0.454603, 0.587775, 0.493467, 0.855165, 0.15869, 0.581381, 0.81055, -0.0707466, 0.495216, -0.363891, 0.788888, -0.540877, -0.622441, 0.565703, -0.566903, -0.575777, 0.589153, -0.61535, -0.511635, 0.599645, -0.0446138, 0.205469, -0.977646, -0.312743, -0.650517, 0.692112, -0.0949169, 0.278154, 0.955835, 0.905469, 0.140209, 0.400585, 0.493455, 0.860925, -0.123738, -0.0791261, 0.800264, 0.594405, 0.0405249, 0.93934, 0.340584, 0.99407, -0.108733, 0.00167816, 0.293994, -0.281, 0.913568, 0.740805, 3.5309e-05, 0.67172, 0.838767, 0.0366171, 0.543258, 0.158771, -0.270269, 0.949603, 0.130064, -0.258838, 0.957124, -0.453729, 0.00121333, 0.891139, -0.766572, 0.0507748, 0.640148, -0.833248, -0.0637932, 0.549207, -0.107714, -0.210847, 0.971566, 0.220352, -0.294273, 0.929972, 0.275266, -0.264166, 0.924362, -0.0246705, -0.317852, 0.947819, -0.459555, 0.8528, 0.248075, -0.312354, 0.925104, 0.215913, -0.326196, 0.945298, 0.00270759, -0.914709, 0.390717, 0.103187, -0.766825, 0.251367, 0.590587, 0.502147, 0.853762, 0.137618, -0.897733, -0.178796, -0.402626, -0.255145, -0.732329, -0.631343, -0.557856, -0.581875, -0.591793, -0.62464, -0.429564, -0.65215, 0.0748912, 0.310284, 0.947689, 0.155831, 0.860282, 0.485419, 0.0314476, -0.843357, -0.536433, 0.791061, -0.0877287, 0.605414, 0.11139, 0.976348, 0.185303, 0.212185, 0.796997, 0.565485, -0.192748, 0.977161, -0.0894644, 0.181485, 0.98337, -0.00683241, -0.0634376, -0.995341, 0.0726051, -0.153987, -0.953262, 0.259962, -0.111714, -0.993596, 0.0169305, 0.00328005, 0.213912, -0.976847, 0.783191, 0.346969, 0.51597, 0.513632, 0.59433, 0.618832, -0.294339, 0.935971, 0.193192, -0.666567, -0.0757337, 0.741588, -0.0351162, -0.291626, 0.955888, 0.0238996, -0.815118, -0.578802, 0.197021, -0.764346, -0.613969, 0.0946801, -0.811037, -0.577281, -0.781576, -0.213184, 0.586252, 0.337083, -0.934556, 0.113933, 0.403041, -0.915021, 0.0171786, 0.452453, -0.885775, -0.103391, -0.909607, -0.406859, -0.0841424, 0.677576, 0.139838, 0.722036, 0.798687, 0.246891, 0.548766, 0.905136, 0.108578, 0.411022, 0.00713659, -0.854252, -0.519809, 0.12687, -0.822633, -0.554237, 0.391791, 0.299079, -0.870087, 0.28963, 0.284772, -0.913794, 0.216736, 0.285283, -0.933616, -0.4393, 0.439798, -0.783322, -0.295858, 0.525774, -0.797514, -0.381727, 0.743506, -0.549075, 0.334792, -0.154541, 0.929533, 0.450116, -0.0822332, 0.889176, 0.189487, -0.76287, -0.618162, 0.478255, -0.0683749, 0.875556, 0.520712, -0.682126, 0.513384, -0.796846, 0.28831, -0.530956, -0.88849, 0.399298, -0.226158, -0.741077, 0.115243, -0.661456, 0.566822, -0.260767, 0.781481, 0.699086, 0.298456, 0.649771, 0.320085, 0.859403, 0.398713, 0.363735, 0.867818, 0.338511, 0.408, 0.627033, 0.6636, 0.728511, 0.330188, 0.600206, -0.95246, -0.277777, -0.125137, -0.973635, -0.216276, -0.0725239, -0.978949, -0.188836, -0.0774609, 0.531237, 0.835775, 0.138808, 0.746849, 0.0375663, 0.663931, -0.915543, -0.0274085, -0.401286, -0.667904, -0.0232831, -0.743884, -0.864496, -0.0361077, -0.501342, -0.444778, -0.756714, -0.47912, -0.542012, -0.757356, -0.36419, -0.337882, -0.869109, -0.361227, -0.341768, 0.938495, -0.0492079, -0.0975196, 0.981893, -0.162405, -0.507436, 0.628024, -0.589996, -0.625554, -0.0487511, 0.778656, 0.639443, 0.746565, 0.183722, 0.83693, -0.101548, 0.537807, 0.913646, -0.0495262, 0.403483, 0.811013, -0.0327677, 0.58411, 0.823954, -0.0186807, 0.566349, 0.827437, -0.546325, -0.129911, 0.607225, -0.752187, 0.255915, 0.941232, -0.337341, 0.0168264, -0.568104, -0.255818, 0.782186, 0.480421, -0.0927976, 0.872115, 0.805705, 0.125601, 0.578847, -0.115976, 0.935058, -0.334986, -0.0463556, 0.917241, -0.395625, 0.162706, 0.476734, -0.863859, 0.198941, 0.396843, -0.896068, -0.170506, 0.642938, -0.746699, -0.665899, -0.0748399, 0.742279, -0.4202, -0.291412, 0.859367, 0.720631, -0.384168, 0.577154, -0.844729, 0.531275, -0.0646469, 0.304902, 0.864704, 0.399151, 0.215733, 0.898784, 0.381638, 0.78212, 0.523758, 0.337588, 0.749449, 0.0561989, 0.659673, 0.812084, 0.110084, 0.573062, 0.310135, -0.84447, 0.436676, 0.581913, -0.809477, -0.07826, 0.572482, -0.81964, 0.0213216, 0.105227, -0.837383, 0.536393, -0.586438, -0.807999, -0.0568215, 0.668568, 0.687552, -0.283354, -0.333968, -0.263512, 0.905001, 0.211508, 0.889927, 0.404097, 0.59893, -0.752312, 0.274425, -0.111594, -0.810436, -0.5751, 0.0493022, 0.865247, 0.498917, 0.00653062, 0.595116, 0.803613, 0.240699, 0.949774, 0.199983, 0.123638, 0.823677, 0.553417, -0.674722, 0.552424, -0.489467, -0.550495, -0.833119, 0.0535524, -0.515725, -0.703382, 0.489164, 0.946618, -0.202173, 0.251078, -0.136295, -0.582426, -0.801376, -0.211341, -0.640127, -0.738628, -0.0325209, -0.627628, -0.777834, 0.227824, 0.930071, 0.288208, 0.425163, 0.78561, 0.449503, -0.53876, -0.842299, 0.0164158, -0.236251, -0.343291, 0.909031, -0.192925, 0.403947, -0.894207, 0.562638, -0.796499, -0.221422, 0.298531, -0.952786, -0.0554814, 0.360738, -0.932441, -0.0205304, 0.749426, 0.0560218, 0.659714, 0.21545, 0.966307, -0.140829, -0.959672, -0.277987, -0.041865, -0.97065, -0.235612, -0.0482111, -0.96899, -0.246671, -0.0145795, 0.823904, 0.0795336, 0.561121, 0.81214, 0.109966, 0.573006, 0.142344, 0.983586, 0.110888, 0.0894891, 0.601521, 0.793829, -0.0854966, 0.773049, 0.628559, 0.562086, 0.478298, -0.674752, 0.267824, 0.592101, -0.760057, 0.367446, 0.558606, -0.743602, -0.24384, -0.782683, -0.572668, 0.105264, 0.267966, -0.957661, 0.143074, 0.264268, -0.953778, -0.202265, -0.795438, -0.571286, -0.114411, -0.824394, -0.554333, -0.0487557, -0.849451, -0.52541, -0.2115, -0.813276, -0.54208, 0.0845076, -0.861276, -0.501062, 0.341378, -0.799234, -0.494658, 0.195144, -0.862788, -0.466385, -0.259697, 0.48899, -0.832734, 0.572496, 0.774757, -0.26833, 0.546398, 0.730489, -0.409677, 0.435546, 0.587478, -0.682033, 0.0142049, 0.419027, -0.907863, 0.184818, 0.328091, -0.92639, 0.444377, 0.527067, -0.724383, -0.0558635, 0.0144499, -0.998334, 0.0114265, -0.00727169, -0.999908, 0.446997, 0.282292, -0.848825, 0.421185, 0.32205, -0.847872, 0.254318, 0.415582, -0.873278, 0.326009, 0.394794, -0.858985, -0.840319, -0.0971778, -0.533311, 0.366312, 0.403213, -0.838591, 0.098741, -0.84658, -0.523023, -0.00347484, 0.630183, -0.776439, -0.761374, -0.00306807, 0.648305, -0.325811, 0.397996, -0.857581, -0.721025, -0.401102, 0.565013, 0.474272, -0.44969, 0.756865, 0.456553, -0.415638, 0.786641, 0.197063, -0.304507, 0.931902, 0.324834, -0.084638, -0.941976, 0.155307, -0.0807494, -0.98456, 0.0968884, 0.0196478, -0.995101, -0.793347, -0.290318, 0.535085, -0.700603, -0.291908, 0.651111, -0.226502, 0.514896, 0.826788, 0.0845302, 0.675141, 0.73283, -0.097679, 0.653002, 0.751031, -0.303147, 0.418575, -0.856094, 0.532702, 0.814474, 0.229915, 0.335814, 0.495907, -0.800816, 0.495396, 0.480329, -0.723787, -0.0250232, 0.810977, 0.584543, 0.370131, 0.755578, -0.540468, 0.0593997, -0.684452, -0.726634, -0.653998, -0.571839, 0.495265, 0.215376, 0.973107, 0.0817136, 0.379747, 0.924817, 0.0224669, -0.474946, 0.381146, -0.793193, -0.818113, -0.439828, 0.370464, -0.905942, -0.323301, 0.273396, 0.365627, -0.758932, -0.538831, -0.512278, -0.430762, 0.742978, -0.485137, -0.415413, 0.769463, -0.410922, -0.393607, 0.822324, -0.598439, -0.28044, 0.750483, -0.56487, -0.278441, 0.776784, -0.693589, -0.283538, 0.662224, -0.559536, -0.312955, 0.767449, -0.642429, 0.706802, 0.296169, -0.666883, 0.744932, -0.0185521, -0.796023, 0.544137, 0.265072, -0.61082, -0.333342, 0.71818, -0.666455, -0.221931, 0.711747, -0.864278, 0.004385, 0.502995, 0.313841, -0.679577, 0.663082, -0.936208, -0.299785, 0.183423, 0.398748, -0.801121, -0.446325, -0.302109, 0.20461, -0.931056, -0.29257, 0.222736, -0.929942, -0.619438, -0.278891, 0.733837, -0.659981, -0.281788, 0.696434, -0.63807, -0.31429, 0.702914, 0.185225, -0.198497, 0.96244, 0.133723, 0.643955, 0.753286, -0.317604, -0.882501, 0.346871, -0.227913, -0.781358, 0.580978, -0.00965782, -0.883213, 0.468872, 0.245185, 0.299138, -0.922172, -0.644137, 0.361077, -0.674323, 0.246133, -0.448401, -0.859276, -0.130215, -0.212624, -0.968419, -0.039514, 0.230251, -0.972329, -0.560908, -0.304508, 0.769843, -0.442139, -0.299115, 0.845602, -0.525732, -0.311788, 0.791451, -0.850577, -0.487374, 0.197446, -0.774419, -0.500167, 0.387439, -0.859996, -0.499244, 0.105649, 0.325625, -0.765685, -0.554703, -0.670471, -0.230245, -0.705305, -0.535608, -0.56234, -0.629998, -0.737139, -0.327739, 0.590943, -0.698943, -0.323369, 0.637896, 0.232228, 0.694612, 0.680871, -0.490724, -0.298628, 0.818543, -0.627319, -0.330526, 0.70514, -0.509713, -0.292992, 0.808918, 0.0379598, -0.0216222, -0.999045, 0.0499745, 0.16969, -0.98423, -0.425269, 0.388816, -0.817293, -0.563221, 0.396588, -0.724913, -0.610771, -0.286735, 0.738066, 0.0839879, -0.842784, -0.531658, -0.297601, 0.186071, -0.936382, -0.335427, 0.171959, -0.926239, -0.662471, -0.286479, 0.692143, -0.579388, -0.285741, 0.763323, -0.710909, -0.364185, 0.601646, -0.74942, -0.29511, 0.592689, -0.748536, -0.321787, 0.579782, -0.400866, 0.41748, -0.815486, -0.559494, 0.353095, -0.74986, -0.804545, -0.0294592, 0.593161, -0.735651, 0.0113335, 0.677265, -0.649412, 0.012213, 0.760339, -0.375269, -0.507131, 0.775881, -0.367339, -0.47972, 0.796825, -0.546697, -0.584678, 0.599394, 0.122383, 0.803424, 0.582694, 0.218399, 0.922943, 0.316981, 0.0740604, 0.931059, 0.357274, 0.933483, 0.317651, 0.166454, 0.604516, 0.101012, 0.790163, 0.473085, 0.052285, 0.879464, -0.0246684, 0.663741, -0.747556, 0.0613504, 0.652739, -0.755094, -0.538825, -0.322089, 0.778413, 0.0937902, -0.824412, -0.558165, 0.472094, 0.700571, 0.535096, -0.561138, -0.303081, 0.770237, -0.572638, -0.436435, 0.693981, -0.55595, -0.446674, 0.701001, 0.0115773, 0.647319, -0.762131, -0.77752, -0.473418, 0.413929, 0.22277, -0.791793, -0.568716, 0.632925, 0.439871, -0.637118, 0.650136, 0.471397, -0.59591, -0.207454, -0.757079, 0.619511, 0.0201015, 0.148456, 0.988715, -0.887414, -0.449587, 0.101821, -0.808297, -0.402334, 0.429864, -0.849186, -0.50702, -0.147696, -0.540303, -0.272618, 0.796085, -0.527556, -0.291567, 0.797918, -0.78675, 0.0725959, -0.612988, -0.658992, 0.144928, -0.738055, -0.758342, 0.168207, -0.629781, -0.455619, -0.287932, 0.842322, -0.64509, -0.277941, 0.711764, -0.617031, -0.415623, 0.668229, -0.66975, -0.311216, 0.674225, -0.202294, 0.178087, 0.962996, 0.175183, -0.401464, 0.898965, -0.439759, -0.679081, -0.58776, -0.230738, -0.757697, -0.610454, -0.536675, -0.274128, 0.798019, 0.85152, -0.0242537, 0.523761, 0.391467, 0.0452163, 0.919081, 0.53279, 0.0916478, 0.84127, -0.533858, -0.614273, -0.581089, -0.52318, -0.510982, -0.682041, -0.515217, -0.66133, -0.545155, -0.288195, -0.439189, -0.850915, 0.13332, -0.135698, -0.981739, -0.961059, -0.0382673, -0.273679, -0.968153, -0.238766, -0.0753011, -0.992602, -0.120404, -0.0156155, -0.784775, -0.0298012, 0.619064, -0.952802, -0.0908393, 0.289684, -0.890308, -0.358908, -0.280243, -0.679509, -0.0828079, -0.728979, -0.490322, -0.252809, -0.83407, -0.511418, -0.511798, -0.6903, -0.257867, -0.695188, -0.670983, -0.352521, 0.673103, -0.650124, 0.139023, 0.599698, -0.788058, 0.0528605, 0.721473, 0.690422, 0.328477, 0.927038, 0.180842, 0.470061, 0.867268, -0.16398, 0.52131, 0.853113, 0.0208572, -0.889407, -0.427494, 0.161874, -0.898457, -0.422911, 0.117992, -0.905496, -0.406606, -0.121439, -0.498124, -0.33326, 0.800506, -0.499495, -0.316647, 0.806374, -0.627683, -0.354428, 0.693105, -0.501593, -0.311834, 0.806948, 0.0962623, 0.245603, -0.964579, 0.379756, -0.118178, 0.917507, 0.481273, -0.103506, 0.870438, 0.732722, 0.387883, -0.559164, 0.600133, 0.472575, -0.645379, -0.867861, -0.48358, 0.113874, -0.947065, 0.121659, -0.297098, 0.855019, 0.516728, -0.0439872, -0.554358, 0.308736, -0.772896, -0.723484, -0.388486, 0.570658, -0.810594, -0.531279, -0.246332, -0.847932, -0.493736, -0.192969, 0.361093, -0.158221, 0.919009, -0.564712, 0.394462, 0.724913, -0.824641, -0.482593, 0.295077, 0.18151, -0.817652, -0.546352, -0.113921, 0.268722, -0.956457, 0.111494, -0.247767, -0.962383, -0.403382, -0.298199, 0.865078, -0.514794, 0.851361, -0.100854, -0.489798, -0.338174, 0.803577, -0.605706, -0.384073, 0.696856, -0.481816, -0.368824, 0.794873, -0.628543, -0.419097, 0.655203, -0.536126, -0.731856, -0.420662, -0.246641, -0.927741, -0.280115, -0.411335, -0.843071, -0.34646, -0.626486, -0.568199, 0.53354, -0.951808, 0.0426169, 0.30372, -0.804737, 0.0500592, 0.591517, -0.980104, 0.122859, 0.155887, -0.756645, -0.256833, 0.601269, 0.500522, 0.468844, -0.72778, 0.282009, -0.764497, -0.579668, -0.0504821, -0.221653, 0.973818, -0.850797, -0.376173, 0.366931, -0.946877, 0.0311754, -0.32008, -0.865897, 0.0413288, -0.498512, -0.799192, 0.394791, -0.453246, 0.474003, 0.539902, -0.695577, 0.340796, 0.164638, -0.925609, -0.494519, -0.83133, 0.253657, -0.566101, 0.458297, -0.685196, -0.747005, 0.371731, -0.55118, -0.656678, -0.0618527, -0.751631, -0.763594, -0.195274, -0.615461, -0.239329, -0.652132, -0.719336, 0.144409, -0.625042, -0.767117, 0.185089, -0.822433, -0.537909, -0.372364, 0.0823822, -0.924423, -0.51542, -0.686164, -0.513344, -0.558635, -0.650948, -0.513998, -9.1042e-05, 0.836272, 0.548314, 0.109859, 0.921866, 0.371611, 0.694992, 0.702315, 0.154081, -0.781934, -0.416336, -0.463943, 0.316849, -0.11161, 0.941887, -0.952284, -0.303032, 0.0364241, -0.194857, 0.939305, -0.282376, -0.722295, 0.627823, -0.290049, -0.707381, 0.672684, -0.217043, -0.894317, 0.383366, -0.230709, 0.48073, -0.0966365, 0.871528, -0.553268, -0.768451, -0.321524, -0.775087, -0.44815, 0.445422, -0.810251, -0.45323, 0.371586, -0.743378, -0.379026, 0.551116, -0.739052, -0.0218521, 0.673294, 0.108629, -0.829878, -0.547268, -0.219938, -0.922442, -0.317377, 0.262528, -0.142364, 0.954364, -0.056602, -0.228445, 0.97191, -0.874422, -0.294388, -0.385644, -0.609458, -0.0493011, -0.791284, -0.36355, 0.900257, -0.239519, -0.536911, 0.809455, -0.237714, -0.363105, 0.901032, -0.237267, -0.467773, 0.863825, -0.187067, 0.156069, 0.293145, -0.943244, 0.212861, 0.302578, -0.929052, 0.095556, 0.25476, -0.962272, 0.538679, -0.804911, 0.248884, 0.530685, -0.816879, 0.226014, -0.907282, -0.322113, -0.270337, -0.801842, -0.254126, -0.540805, -0.213188, -0.92458, -0.315757, 0.411405, -0.880145, 0.236834, 0.368604, -0.890937, 0.265258, 0.190971, -0.29893, 0.934971, -0.836595, -0.164274, -0.522612, -0.752221, 0.0108564, -0.658822, -0.822271, -0.261089, -0.505671, -0.822001, -0.412981, 0.392124, -0.624049, -0.0212966, 0.781095, 0.408937, -0.787722, -0.460722, -0.619506, -0.0962512, -0.779069, 0.364453, -0.913359, 0.181519, -0.594443, 0.670027, 0.444637, 0.50679, -0.561851, -0.653826, 0.335862, -0.715656, -0.6124, 0.217138, -0.786187, -0.578586, 0.567553, -0.418138, -0.709256, 0.0421642, -0.391479, -0.919221, -0.65793, -0.628629, -0.414673, 0.650463, -0.73204, 0.202522, 0.686895, -0.709335, 0.158176, 0.270466, -0.914018, 0.302356, 0.355865, -0.825366, -0.438328, -0.975308, 0.0649474, -0.211085, 0.0185837, -0.427208, -0.903963, 0.394837, -0.679196, -0.618706, -0.824921, 0.50956, -0.244653, -0.533854, 0.840183, -0.0953551, -0.656195, 0.746452, -0.110532, -0.0718404, -0.196801, 0.977808, 0.709365, -0.292692, 0.641197, 0.912027, -0.103638, 0.396821, 0.90309, -0.0843368, 0.421089, 0.937648, -0.177358, 0.298931, 0.937298, 0.0318893, -0.347068, 0.967732, 0.00726418, -0.251879, -0.0224414, -0.0736604, 0.997031, 0.990817, -0.135103, -0.00533866, 0.992281, -0.0383205, -0.117944, -0.695608, 0.696247, 0.177114, 0.026531, -0.396015, 0.917861, 0.078758, -0.197222, 0.97719, 0.710933, -0.183387, 0.678928, 0.951915, -0.107688, 0.286812, 0.938572, -0.181085, 0.293754, 0.49265, -0.646545, -0.582474, -0.857955, 0.298692, 0.417967, -0.82989, 0.147028, 0.538206, -0.874963, 0.454704, 0.166386, 0.0692136, 0.605714, 0.792666, 0.126999, 0.861692, 0.491282, 0.0925357, 0.752436, 0.652133, -0.88067, 0.448319, 0.153072, -0.645001, -0.0118034, 0.764091, -0.73967, 0.245785, 0.626481, -0.59801, 0.0686004, 0.798548, -0.697059, 0.0328585, 0.71626, -0.365358, -0.198562, 0.909443, -0.592089, 0.370298, 0.715758, 0.905034, 0.0396807, 0.423483, 0.807869, 0.0187156, 0.589065, -0.688148, 0.706769, -0.164107, -0.0720961, -0.85802, 0.508532, -0.246806, 0.132929, 0.959905, 0.0977489, -0.525584, 0.845108, 0.264201, -0.231161, 0.936356, -0.922925, -0.339714, 0.181118, 0.0644501, 0.716391, 0.694716, 0.984511, -0.095568, -0.146989, 0.518286, -0.167986, 0.838547, -0.220401, 0.789608, 0.572662, -0.793131, 0.482273, 0.371962, -0.55492, 0.59413, 0.5823, 0.0144775, -0.436962, -0.899363, 0.295974, -0.360511, -0.884552, 0.329728, -0.532202, -0.779769, 0.505522, 0.855726, 0.110367, 0.382213, 0.343381, -0.857906, 0.566513, 0.399558, -0.720706, 0.985851, -0.151929, -0.0708206, 0.9903, -0.0737956, -0.117729, 0.598939, 0.407953, -0.689091, 0.575732, 0.401995, -0.711992, 0.976265, 0.0692233, 0.205219, -0.532854, -0.102618, 0.839962, -0.125824, -0.108273, 0.986126, -0.15553, -0.198959, 0.967587, 0.715532, 0.046396, -0.697038, 0.150218, -0.600684, 0.785247, 0.816043, -0.0134458, -0.577836, 0.907597, 0.00100517, -0.419842, 0.926518, 0.100631, -0.362544, -0.44132, 0.748191, 0.495427, 0.771853, -0.204566, 0.601994, 0.905902, -0.309375, 0.289187, 0.91686, -0.0714862, 0.392757, -0.437914, 0.808159, 0.39384, -0.727584, 0.663997, 0.172423, -0.353355, -0.301129, -0.885698, -0.425989, -0.36444, -0.828081, 0.955502, 0.112988, 0.272489, 0.0379341, 0.438165, -0.898094, -0.679167, 0.553728, 0.481786, 0.455198, -0.647478, -0.611202, -0.239819, -0.745745, -0.621571, 0.489595, 0.452645, -0.745258, 0.339043, 0.350242, -0.873144, 0.369141, 0.338948, -0.865361, -0.708784, -0.598788, -0.372931, -0.34752, -0.718231, -0.602805, 0.702208, 0.0829611, -0.707122, 0.43757, -0.291688, 0.850559, 0.837297, -0.497083, 0.227687, 0.970392, -0.0838391, 0.226517, 0.976928, 0.202227, -0.068672, -0.644077, 0.736134, -0.208018, -0.469825, 0.826465, -0.310193, 0.545186, -0.797454, 0.258533, -0.0873468, -0.155489, 0.983968, 0.992996, -0.0217105, -0.116136, 0.638382, -0.747749, 0.18259, 0.83392, -0.536501, 0.129397, 0.907373, 0.369218, -0.200881, -0.960948, -0.0198329, 0.276018, 0.961778, -0.0266268, -0.272534, 0.861156, 0.0874519, -0.500763, 0.584, 0.0355058, -0.810977, 0.937526, -0.341615, 0.0659079, 0.744584, 0.213766, 0.632375, -0.34891, -0.424624, -0.835438, -0.35408, -0.405906, -0.842537, 0.0701228, -0.434111, -0.898126, 0.0813266, -0.415592, -0.905908, 0.736312, 0.242749, -0.631599, -0.0326735, -0.976694, -0.212137, 0.0334398, -0.967505, -0.250632, 0.660157, -0.747818, 0.070431, 0.531057, -0.835636, 0.140324, 0.825698, -0.561155, 0.0576977, 0.156038, 0.545017, -0.823777, 0.995067, -0.0593371, -0.0795045, 0.687275, 0.576763, -0.441585, 0.473181, 0.624168, -0.621703, 0.34989, 0.579515, -0.736029, 0.115609, 0.247656, -0.961926, -0.19878, -0.788523, -0.581995, 0.670457, -0.622373, 0.403905, 0.840166, 0.0871474, -0.535281, -0.113646, -0.293015, 0.94933, -0.953367, 0.205181, -0.221343, -0.920829, 0.314191, -0.230994, -0.942328, 0.251357, -0.220992, 0.921327, 0.0874515, -0.378825, 0.637341, 0.641763, -0.426541, 0.435233, 0.830937, -0.346576, 0.565123, 0.0324794, 0.824367, -0.838099, -0.282929, -0.466412, -0.844158, -0.256759, -0.470609, -0.605804, -0.134951, -0.784085, 0.547941, -0.836506, 0.0043741, 0.105724, -0.173659, 0.979114, 0.510328, 0.27924, -0.813382, 0.397328, 0.284935, -0.87232, 0.93919, -0.287058, 0.188468, 0.273844, -0.0889264, 0.957654, 0.0623877, -0.752352, -0.6558, 0.894753, 0.0876514, -0.437876, 0.342568, 0.329786, -0.879709, 0.1707, -0.133895, 0.976183, -0.528123, 0.846563, -0.066463, 0.324517, 0.323433, -0.888865, 0.43407, 0.360463, -0.825621, 0.171895, -0.256183, 0.951221, 0.261667, -0.156577, 0.952373, -0.696121, -0.690966, -0.19489, -0.757391, -0.617616, -0.211921, 0.516871, -0.69557, 0.499026, 0.948579, -0.29669, 0.110329, 0.000949767, 0.586005, 0.810307, 0.728241, 0.685314, -0.00323737, -0.16376, -0.287258, 0.943751, 0.675915, 0.109851, 0.728746, 0.542332, 0.0415368, 0.839137, -0.57968, -0.804569, -0.129, -0.619338, -0.639337, -0.455707, -0.917864, -0.357998, 0.171357, -0.880736, -0.405738, 0.244297, -0.861934, -0.372587, 0.343873, 0.117301, -0.162263, 0.979751, 0.276522, -0.0790522, 0.957751, 0.419227, -0.0125896, 0.907794, 0.901384, -0.254003, 0.350699, 0.0082199, -0.212536, 0.977119, 0.159778, -0.138863, 0.977337, 0.324926, -0.060006, 0.943834, -0.231161, -0.298526, 0.925984, -0.0974345, -0.246904, 0.964129, -0.166795, -0.283437, 0.944374, -0.343437, 0.190226, -0.919709, 0.212638, -0.202879, 0.955838, 0.549605, -0.774464, 0.313273, -0.979995, -0.137387, 0.143992, -0.720804, -0.640296, -0.265447, 0.0319091, -0.196709, 0.979942, 0.484083, 0.0438277, 0.873924, 0.821888, -0.271873, -0.500586, 0.633645, -0.479282, -0.607275, -0.12534, 0.486209, -0.864807, 0.564029, 0.0981667, 0.819899, 0.00939526, -0.00502272, -0.999943, -0.401432, 0.110098, -0.909248, 0.79738, 0.262353, 0.543466, 0.119381, -0.155054, 0.980666, 0.230939, -0.103718, 0.967424, 0.395924, -0.00629583, 0.918262, 0.657125, 0.174121, 0.733395, -0.140187, -0.273811, 0.951512, 0.000609768, -0.20363, 0.979048, -0.893224, 0.442392, 0.0802504, -0.946739, 0.321995, 0.00208883, -0.985008, 0.172505, -0.000891511, 0.311986, -0.0479152, 0.948878, 0.165119, -0.889859, -0.425308, 0.489854, 0.0508943, 0.870318, 0.941945, -0.319957, -0.101821, 0.892501, -0.445883, -0.0680535, -0.282625, 0.875698, -0.391506, -0.0901344, -0.269447, 0.958788, 0.708956, 0.269683, 0.651654, 0.773529, 0.214775, 0.596259, -0.196622, 0.959195, 0.203189, -0.979487, -0.18886, 0.0702651, 0.238311, -0.0772796, 0.968109, 0.674108, 0.295985, 0.676736, 0.667987, 0.300403, 0.680846, -0.304599, 0.523266, -0.795872, 0.280875, -0.0948924, 0.955042, 0.536725, -0.822766, 0.187035, -0.593499, 0.281844, -0.753872, -0.823023, -0.193712, -0.533955, -0.187024, 0.279964, -0.941617, 0.846811, 0.303291, -0.43695, 0.254515, 0.401934, -0.879586, 0.661419, 0.744717, -0.0890039, 0.826374, 0.555637, -0.0915051, -0.107837, -0.751011, -0.651425, 0.257045, 0.365577, -0.894585, 0.198389, 0.323273, -0.925276, 0.600221, 0.704535, -0.378635, 0.929381, 0.336208, -0.152365, 0.294405, -0.388333, -0.873226, 0.276158, -0.693605, -0.665319, 0.298802, -0.462108, -0.834969, 0.482559, -0.280024, -0.829893, 0.497101, -0.498337, -0.710317, 0.315332, 0.720821, 0.617238, 0.859853, 0.364851, -0.357123, -0.665576, -0.540428, -0.514729, -0.677293, -0.674418, -0.293997, 0.077766, -0.995866, -0.0469428, 0.00723122, -0.963263, 0.268462, 0.893638, 0.387305, -0.226728, 0.890435, 0.342519, -0.299677, 0.531394, -0.105052, -0.840586, 0.670729, 0.0335179, -0.740945, 0.583137, 0.169562, -0.794481, -0.736361, -0.315237, -0.598663, 0.543548, -0.106417, -0.832605, 0.565433, -0.169748, -0.807138, 0.45386, 0.515488, -0.726831, 0.518039, -0.628606, -0.580077, 0.335467, 0.936812, -0.0992183, 0.66253, 0.205534, -0.720285, -0.822348, 0.56584, -0.0597394, -0.610117, -0.0285923, -0.791795, -0.425404, -0.188929, -0.885064, -0.603975, -0.128095, -0.786642, -0.526678, -0.130856, -0.839933, 0.78828, 0.271266, -0.552294, 0.909669, 0.239411, -0.339388, 0.823039, 0.314607, -0.472895, 0.681032, -0.203365, -0.703447, -0.772297, 0.629867, -0.0826195, 0.166034, -0.685281, -0.7091, -0.895629, 0.0448997, -0.44253, 0.689225, 0.148444, -0.709178, 0.32031, 0.0749355, 0.944344, 0.743452, 0.0126023, -0.66867, 0.0665619, -0.498849, -0.864129, 0.10207, -0.207943, -0.972801, 0.785777, 0.368827, -0.496508, 0.441824, 0.89286, -0.0871299, 0.478916, 0.871231, 0.107679, 0.50267, 0.844403, 0.185222, 0.869561, 0.169893, -0.463681, 0.605551, 0.0292894, -0.795268, -0.956288, -0.116027, -0.268424, -0.953268, -0.0882927, -0.288936, -0.924552, -0.119866, -0.361713, -0.925918, -0.125724, -0.356188, -0.93859, -0.047178, -0.341795, -0.929993, -0.110126, -0.350693, -0.588378, -0.265823, -0.763643, -0.666599, -0.265819, -0.696409, 0.252333, 0.311982, -0.915967, 0.266828, 0.34819, -0.898647, 0.595688, 0.671518, -0.440703, 0.202052, 0.227581, -0.952566, 0.145528, 0.40479, 0.902755, 0.335278, 0.898051, 0.284769, -0.197369, -0.785727, -0.586241, 0.147191, -0.48626, -0.861328, -0.368314, 0.713622, 0.595893, 0.368234, 0.534665, -0.760617, 0.864648, 0.186412, -0.466512, 0.375309, 0.394409, -0.8388, -0.0907514, -0.442581, -0.892125, -0.31785, -0.331297, -0.888377, -0.0100875, -0.362451, -0.931948, 0.70052, -0.094968, -0.707285, 0.692653, 0.670797, -0.265071, 0.10207, -0.207943, -0.972801, 0.0467335, 0.204137, -0.977826, 0.815669, 0.333011, -0.473062, 0.870721, 0.265318, -0.414067, 0.0813266, -0.415592, -0.905908, -0.279307, -0.383254, 0.8804, -0.204516, -0.584716, -0.785035, 0.0314033, -0.90129, -0.432077, 0.936229, 0.22171, -0.272617, 0.763127, 0.362817, -0.53479, 0.824584, 0.289032, -0.486334, 0.554772, 0.825918, 0.100437, -0.931995, -0.0600357, -0.357464, -0.22802, -0.315694, -0.921056, 0.969434, 0.146066, -0.197138, 0.725901, 0.405752, -0.555367, 0.646863, 0.448885, -0.616498, 0.838442, 0.472791, -0.271079, -0.339801, 0.229749, -0.912004, 0.573772, 0.404865, -0.711948, 0.469482, 0.384326, -0.794909, 0.101856, 0.703125, -0.703733, -0.186833, 0.549785, -0.814144, -0.901532, 0.231533, 0.365557, -0.874591, 0.195997, 0.443482, 0.658785, 0.397855, -0.638525, 0.832389, 0.288095, -0.473424, 0.63592, 0.444386, -0.630973, 0.653271, 0.42517, -0.626472, 0.640541, 0.470506, -0.606903, 0.724126, 0.384841, -0.572311, 0.895367, -0.42999, -0.115875, 0.353857, -0.61327, -0.706177, 0.207489, -0.436102, -0.87565, -0.92743, 0.0133557, -0.373758, -0.866966, 0.0572993, -0.495062, -0.923939, 0.0430238, -0.380112, 0.608532, 0.360911, -0.706705, 0.61953, 0.392849, -0.679597, 0.978898, 0.128509, -0.158887, -0.357625, -0.726716, -0.586505, 0.512791, 0.727923, -0.455163, -0.88404, -0.462733, 0.0659631, -0.8912, -0.448473, 0.0680747, 0.0973812, 0.142088, -0.985052, -0.00603685, 0.204755, -0.978795, -0.715066, 0.487382, -0.501137, -0.535647, 0.499878, -0.680592, -0.688425, 0.507554, -0.518131, 0.643704, 0.441762, -0.624893, -0.625779, -0.549397, -0.553682, -0.529919, -0.47029, -0.7057, -0.855923, -0.360943, 0.370293, -0.768653, -0.358294, 0.529903, -0.797721, -0.338651, 0.498956, -0.111357, -0.123905, -0.986026, 0.418355, 0.826046, -0.377661, -0.592573, 0.551426, -0.587185, 0.427701, 0.689714, -0.584265, -0.213895, -0.974058, -0.0738909, 0.0898574, -0.862944, -0.497245, -0.639714, -0.763843, 0.0854944, 0.660393, 0.396127, -0.637938, 0.59934, 0.736698, -0.313158, 0.342082, 0.778378, -0.52641, 0.668561, 0.648044, -0.364782, 0.420034, 0.681795, -0.598939, 0.640722, 0.411452, -0.648215, -0.519229, -0.716747, -0.465484, -0.788284, -0.493564, -0.367428, -0.844985, -0.337155, -0.415123, 0.649332, 0.439962, -0.620323, -0.941505, -0.0415354, -0.33443, 0.864251, 0.187711, -0.466727, 0.0660937, 0.105534, -0.992217, 0.710816, 0.348196, -0.611147, 0.0351824, 0.054974, -0.997868, -0.496881, -0.867136, 0.0344281, 0.328891, 0.306944, -0.893093, 0.48424, 0.319015, -0.814703, 0.559212, 0.299499, -0.773035, 0.161391, -0.477973, -0.86342, 0.648438, 0.443208, -0.618946, 0.558661, 0.812202, -0.168006, 0.654376, 0.756167, 0.00189668, 0.0415709, -0.921048, -0.387225, 0.258182, -0.550689, -0.793779, 0.184091, -0.45142, -0.873115, 0.413199, 0.883623, -0.220174, 0.234646, 0.775374, -0.586291, 0.321049, -0.665233, -0.674086, 0.153377, -0.600528, -0.784756, 0.466101, -0.651435, -0.59865, 0.588515, -0.109185, -0.80108, 0.599988, -0.127781, -0.789739, 0.425478, 0.339112, -0.83903, 0.616878, 0.284296, -0.733919, -0.547023, -0.14128, -0.82511, 0.920151, 0.0553987, -0.387626, 0.734227, 0.317562, -0.600054, 0.58677, 0.802206, -0.110301, 0.624225, 0.325666, -0.71013, 0.186773, 0.965283, 0.182603, 0.0975462, -0.99398, 0.0498923, 0.258701, 0.680114, 0.685943, -0.92712, -0.232577, -0.293865, -0.939806, -0.294889, -0.172644, 0.704103, 0.314844, -0.636484, -0.463805, -0.882377, -0.0793525, -0.929637, 0.252827, -0.268057, -0.954215, -0.288186, -0.0801455, -0.256021, -0.350273, 0.900978, 0.737237, 0.343983, -0.581513, 0.232184, 0.885951, -0.401475, -0.0577379, -0.670403, -0.739748, -0.170674, -0.607677, -0.775629, 0.412535, 0.353694, -0.839473, 0.702381, 0.280401, -0.654245, -0.128808, -0.307152, 0.942903, -0.141985, 0.293817, 0.945258, 0.566426, 0.814538, -0.125253, 0.751639, 0.36636, -0.54847, -0.206714, -0.804083, -0.557423, 0.559884, 0.824643, 0.0805848, -0.513969, -0.84608, -0.141367, 0.534316, 0.369885, -0.76006, 0.61219, 0.316599, -0.724561, 0.372965, 0.423867, -0.825369, -0.830496, -0.501645, 0.242133, -0.766189, -0.508945, 0.392339, -0.81443, -0.501796, 0.291384, -0.734823, 0.612429, -0.291488, -0.608206, 0.615356, -0.50142, -0.666725, 0.645061, -0.373329, 0.909665, 0.236034, -0.341755, 0.268721, 0.320044, -0.908494, -0.674587, -0.738142, -0.00890753, -0.796512, -0.562397, -0.221985, -0.845518, -0.512327, 0.150399, 0.563395, 0.424443, -0.708826, -0.977573, -0.210588, -0.00196239, 0.624824, 0.594649, 0.505951, 0.588859, -0.108801, -0.80088, 0.600334, -0.127405, -0.789536, -0.345273, -0.911639, -0.222935, 0.687606, 0.642015, -0.339138, -0.709466, -0.103687, -0.697071, -0.801776, -0.153905, -0.577468, -0.761225, -0.0693172, -0.644773, -0.783935, 0.493123, -0.377194, -0.798329, 0.472558, -0.373309, -0.977071, 0.21291, -0.000867899, -0.998925, -0.0111727, -0.0449973, -0.537459, -0.571036, -0.620528, 0.531678, 0.846885, 0.010213, -0.465504, -0.820917, -0.330759, -0.87075, 0.111328, -0.478958, 0.383703, -0.846886, -0.368179, 0.642992, 0.553505, 0.529333, 0.54797, 0.557745, 0.623417, 0.532187, 0.477185, -0.699337, -0.785475, -0.577458, 0.222645, 0.45085, 0.452878, -0.769179, 0.899572, 0.430403, 0.0743249, 0.915757, 0.379676, 0.131286, 0.8635, 0.502785, 0.0396809, -0.842555, -0.113643, -0.526485, -0.907412, 0.113644, 0.404583, 0.272409, 0.926857, -0.258322, -0.195596, 0.548519, -0.812938, -0.0942594, 0.554378, -0.82691, 0.301728, 0.252225, -0.919425, -0.674795, -0.668202, -0.313301, -0.62657, -0.752261, 0.203751, -0.693834, -0.470571, 0.545122, -0.728202, -0.430307, 0.533439, -0.764747, -0.46691, 0.444023, -0.696726, -0.515131, 0.499213, -0.711182, -0.573277, 0.406907, -0.664051, -0.598766, 0.44779, -0.844309, -0.450922, 0.289503, -0.716161, -0.639757, -0.278972, -0.703305, -0.463802, 0.538749, -0.800951, -0.56491, 0.198378, -0.758494, -0.575298, 0.306134, -0.309664, -0.438007, 0.843954, -0.560283, -0.497057, 0.662584, -0.654212, -0.545255, 0.524122, -0.624395, -0.556143, 0.548485, -0.988654, 0.11805, 0.0928813, -0.532404, -0.436521, 0.725255, -0.718167, -0.390954, 0.575666, -0.680482, -0.356801, 0.640029, -0.00794418, -0.800492, -0.59929, 0.372419, 0.784765, -0.495428, 0.431446, 0.878987, -0.203069, 0.416998, 0.874377, -0.248146, -0.269024, -0.790293, -0.550512, 0.160802, -0.808133, -0.566625, -0.750165, 0.0940012, -0.654535, -0.864205, -0.029839, -0.502255, -0.318856, -0.788108, -0.526513, -0.19441, -0.744265, -0.638963, -0.243903, -0.74139, -0.625182, -0.106396, -0.676639, -0.728587, 0.214278, -0.746317, -0.630156, -0.0352084, -0.778625, -0.626501, 0.146332, -0.759843, -0.633424, -0.431483, 0.762759, 0.481687, -0.418216, 0.798795, 0.43246, -0.190773, 0.958452, 0.212076, 0.223673, -0.753326, -0.618442, 0.297637, -0.75863, -0.579563, -0.16641, -0.726014, -0.667242, -0.197835, -0.715075, -0.67047, -0.0756616, -0.835164, -0.544772, 0.179024, -0.744463, -0.643215, -0.709915, -0.399292, -0.580161, -0.491308, 0.757326, 0.430203, -0.483689, 0.758505, 0.436709, 0.317463, -0.740852, -0.591908, 0.160976, -0.842077, -0.514774, -0.0106729, -0.755694, -0.654838, 0.312842, -0.760114, -0.569523, 0.408069, -0.720774, -0.560326, -0.447241, 0.797044, 0.405828, -0.52752, 0.741435, 0.414726, 0.187359, -0.775432, -0.602994, -0.385744, 0.843352, 0.374111, -0.517649, -0.5374, 0.665763, 0.545501, 0.565794, -0.618308, 0.0708113, -0.723048, -0.687159, 0.0698313, -0.820589, -0.567237, -0.630198, -0.484892, 0.606407, -0.693869, -0.513157, 0.505189, 0.18621, 0.591494, -0.784513, 0.17889, 0.662941, -0.726985, -0.836063, 0.341793, 0.429158, -0.32802, 0.882456, 0.337157, -0.742577, 0.553843, 0.376614, -0.201888, -0.63726, -0.743735, -0.857971, -0.42094, 0.294441, -0.91059, -0.336507, 0.239978, -0.768534, -0.458699, 0.446039, -0.635798, -0.00170313, 0.771854, -0.652672, -0.022403, 0.75731, -0.762712, 0.0130525, 0.646606, -0.918084, 0.395065, -0.0323401, -0.966929, 0.137799, 0.214614, -0.901685, 0.424357, 0.0829837, -0.650965, -0.575317, 0.495233, -0.837178, -0.530005, 0.135013, -0.67388, 0.113075, -0.730137, -0.638204, 0.0740908, -0.766294, -0.554812, 0.0308719, -0.831403, -0.512845, 0.00220126, -0.858479, 0.181725, -0.738828, -0.64893, -0.552601, -0.337544, 0.762035, -0.689614, -0.343755, 0.637389, -0.594928, 0.206471, -0.776808, -0.461046, 0.174103, -0.870129, -0.907529, -0.413575, -0.0731201, -0.688418, -0.274166, -0.671501, -0.4429, -0.0203386, -0.89634, -0.530133, 0.773095, 0.348256, 0.365002, -0.720942, -0.589081, 0.170865, -0.719661, -0.672974, -0.715138, -0.537179, 0.447232, -0.916925, -0.383158, 0.111529, -0.813813, -0.425618, 0.395673, -0.885138, -0.40564, 0.228006, -0.505462, 0.233021, -0.830789, -0.366466, 0.162138, -0.916195, -0.422258, 0.0250272, -0.90613, 0.00454966, -0.723536, -0.690272, -0.179637, -0.6639, -0.725925, -0.522008, 0.322257, -0.78972, -0.372172, 0.127033, -0.919429, -0.292839, 0.901486, 0.318697, 0.149109, -0.770302, -0.620002, -0.455034, 0.465359, -0.7592, -0.383096, 0.274011, -0.882131, -0.535504, 0.095864, -0.839074, -0.242792, 0.912253, 0.329919, 0.136994, -0.701077, -0.699803, 0.906706, -0.178233, 0.382253, -0.820989, -0.479128, 0.310505, -0.517672, 0.438749, -0.734517, -0.406708, 0.393082, -0.824667, -0.334772, 0.469659, -0.816914, -0.472089, 0.362459, -0.803589, 0.0111054, 0.894059, -0.447813, 0.0846298, 0.882825, -0.462016, -0.0250857, 0.948792, -0.314903, 0.112967, 0.805529, -0.581689, -0.414863, -0.871013, 0.263105, -0.464745, -0.829979, 0.308458, -0.208249, -0.905425, 0.369916, -0.387782, 0.523847, -0.758426, 0.238745, 0.407328, -0.881524, 0.177415, -0.921515, 0.345447, 0.235664, -0.669506, 0.704432, 0.358284, -0.744958, -0.562735, -0.606456, -0.785395, 0.123959, -0.732507, 0.607375, 0.307455, 0.82579, -0.385505, 0.411652, 0.935121, -0.183489, 0.303119, 0.909493, -0.0403931, 0.413751, 0.0850903, -0.630687, -0.771358, 0.213161, -0.900115, -0.379941, -0.360481, -0.407454, 0.839068, -0.428765, -0.469382, 0.771908, -0.251651, 0.350014, -0.902309, -0.490981, 0.247051, -0.835406, -0.46142, 0.0709085, -0.884344, -0.442534, -0.860864, -0.25115, -0.823818, -0.215646, -0.524234, -0.427192, 0.260181, -0.865918, -0.531212, 0.467727, -0.706432, -0.601242, 0.777158, 0.185834, -0.238555, 0.970197, 0.042539, 0.015795, -0.406966, -0.913307, -0.188437, -0.479769, -0.856921, 0.0544555, -0.678697, -0.732397, -0.209081, -0.496938, -0.842222, -0.244307, -0.966356, 0.0804384, -0.157106, -0.966335, -0.203749, -0.179928, -0.979955, 0.0855225, 0.0431056, 0.747896, -0.662415, -0.841551, -0.527976, -0.114158, 0.267803, -0.702219, -0.659674, -0.175371, -0.732041, 0.658302, -0.480718, -0.864702, 0.145604, -0.512828, -0.820776, 0.251664, -0.296727, -0.933947, 0.199239, -0.100937, -0.978178, 0.181605, -0.669554, -0.649371, 0.360576, -0.305791, 0.618814, -0.723575, -0.500085, -0.698303, -0.51214, 0.414687, 0.605491, -0.679276, 0.157855, -0.632163, -0.758585, -0.215537, -0.934853, 0.282124, -0.0985372, 0.672999, -0.73305, -0.705824, -0.358301, 0.611092, -0.693197, -0.341648, 0.634629, -0.8861, -0.463468, 0.00487942, 0.369837, -0.62505, -0.687411, 0.34166, -0.547577, -0.763825, 0.281475, 0.804482, -0.52305, 0.330555, 0.789106, -0.517731, -0.307731, 0.640794, -0.703339, -0.456484, -0.382415, 0.803356, -0.599903, -0.414871, 0.684104, -0.595677, -0.448771, 0.666163, 0.231293, 0.0627807, -0.970856, -0.424634, -0.35475, -0.83297, -0.552829, -0.0363795, -0.8325, -0.661325, -0.0993569, -0.74349, -0.616771, -0.0977519, -0.781049, -0.307966, 0.427169, -0.850108, -0.0573107, -0.485364, -0.872432, 0.143183, 0.72313, -0.675708, -0.00349713, 0.784417, -0.620224, 0.0618052, 0.788227, -0.612273, -0.539837, -0.835936, -0.0989343, -0.27805, -0.924057, 0.26231, -0.0965879, 0.576484, -0.81138, -0.838305, -0.468878, 0.278204, -0.776753, -0.435274, 0.455183, -0.809796, -0.444436, 0.383025, 0.499349, 0.857345, -0.124939, -0.148436, -0.794589, -0.588723, -0.566088, -0.699713, -0.435829, -0.644071, -0.38294, 0.662216, -0.682308, -0.409149, 0.60585, -0.135592, -0.383638, 0.913475, 0.122246, -0.497917, -0.858566, -0.500602, -0.473102, -0.724963, -0.477588, 0.621271, -0.621234, -0.719819, -0.0984057, -0.687151, -0.659676, -0.0460923, -0.750135, -0.794791, -0.0905275, -0.600094, 0.481889, 0.167257, -0.860121, -0.742849, -0.425986, 0.516441, -0.962768, 0.270316, 0.00275555, -0.644297, 0.75903, -0.0935742, -0.045736, -0.479253, 0.876484, -0.000589543, 0.892201, -0.451639, -0.718356, -0.695642, -0.00684864, -0.256696, -0.382702, 0.887494, -0.831234, 0.555105, -0.0301472, -0.811572, 0.584251, 0.00114602, -0.716562, 0.696828, -0.0311554, -0.0990548, -0.555048, -0.825899, -0.304228, -0.937557, 0.168617, -0.657782, -0.0111498, -0.753125, -0.673328, 0.0236799, -0.738965, -0.79297, -0.0273688, -0.608645, -0.720184, 0.0159615, -0.6936, -0.561831, -0.612562, -0.55598, -0.865385, -0.455014, 0.209932, -0.367355, -0.09023, -0.925694, -0.21162, 0.0810808, -0.973983, -0.396243, -0.065788, -0.915786, -0.0273872, -0.147834, -0.988633, -0.659676, -0.0460923, -0.750135, -0.543958, 0.00735582, -0.83908, -0.657782, -0.0111498, -0.753125, -0.709243, 0.0878228, -0.699472, -0.642662, 0.0870265, -0.761191, -0.158555, -0.102674, -0.981997, -0.775078, -0.577603, 0.256183, -0.605095, 0.0196505, -0.795911, -0.673328, 0.0236799, -0.738965, -0.430491, -0.344187, 0.834394, -0.493404, -0.334849, 0.802763, -0.158555, -0.102674, -0.981997, -0.0273872, -0.147834, -0.988633, 0.122246, -0.497917, -0.858566, -0.804788, -0.56238, -0.189856, -0.622681, -0.777135, 0.0912653, -0.776092, -0.390293, 0.495331, -0.657591, -0.42589, 0.621444, -0.637215, -0.408434, 0.653558, -0.683453, -0.726481, 0.071538, -0.601497, 0.0699671, -0.795805, -0.713166, 0.0648121, -0.697993, -0.50881, -0.442364, 0.73853, -0.367355, -0.09023, -0.925694, -0.693644, 0.52952, -0.48833, -0.343126, 0.44151, -0.829056, -0.766704, -0.386015, 0.512989, -0.765643, -0.367763, 0.52777, -0.7107, 0.079523, -0.698987, 0.840133, -0.44723, 0.306857, 0.850395, -0.525534, 0.0253581, 0.918278, -0.300855, 0.257394, -0.762938, -0.0117737, -0.646365, -0.838908, -0.448414, 0.308477, -0.160045, 0.24791, -0.955472, -0.554836, -0.528825, 0.642263, -0.8136, -0.511913, 0.275683, -0.864997, -0.481056, 0.142706, -0.572543, -0.0225757, -0.819564, -0.636016, 0.0463932, -0.77028, -0.813579, -0.0327578, -0.580531, -0.734488, -0.553162, 0.393114, -0.752095, -0.530606, 0.390909, -0.576988, -0.554991, 0.599224, -0.844519, -0.504456, 0.179754, -0.783908, -0.521414, 0.337069, -0.433163, 0.00404532, -0.901307, -0.394392, -0.171091, -0.902875, -0.609591, -0.212525, -0.763696, -0.465371, -0.0103053, -0.885056, -0.565437, 0.0342488, -0.82408, -0.763632, -0.549558, 0.338898, -0.510821, 0.58145, -0.633228, 0.130074, 0.847993, -0.513799, -0.436502, 0.0360728, -0.89898, -0.438527, 0.0515066, -0.897241, -0.443251, 0.0922325, -0.89164, -0.511197, 0.131137, -0.8494, -0.529145, 0.224227, -0.818369, -0.705663, 0.254312, -0.661336, -0.715266, -0.6962, 0.060828, -0.41594, -0.907767, -0.0543483, -0.75903, -0.633265, 0.151157, -0.549972, -0.612933, 0.567312, -0.622601, -0.148716, -0.768278, -0.530414, -0.0565645, -0.84585, -0.540791, -0.0445152, -0.839978, -0.494237, 0.170777, -0.852388, -0.700332, 0.312043, -0.642, -0.871142, -0.461269, 0.16835, -0.304823, 0.444372, -0.842387, 0.309542, -0.457455, 0.833618, -0.0653017, 0.352052, -0.9337, 0.18621, 0.591494, -0.784513, 0.17889, 0.662941, -0.726985, -0.412974, 0.00921734, -0.910696, -0.79142, -0.308718, -0.527586, -0.43633, 0.0219203, -0.89952, -0.449679, -0.0503137, -0.891772, -0.629665, -0.214891, -0.746555, -0.582056, -0.10924, -0.805777, -0.533224, -0.0533252, -0.844292, -0.407016, 0.0271724, -0.913017, -0.404668, 0.0901428, -0.91001, -0.361832, 0.152316, -0.919716, -0.89604, -0.415603, 0.15616, -0.41755, 0.569834, -0.707772, -0.548425, -0.174901, -0.817703, -0.607174, -0.0125106, -0.79447, -0.379855, 0.112968, -0.918122, -0.314167, 0.134663, -0.939769, -0.534415, -0.625574, 0.568382, -0.146199, -0.0632314, -0.987232, 0.0649572, 0.0458, -0.996836, 0.32403, -0.578822, 0.748311, 0.510775, -0.654751, 0.557145, -0.676712, -0.625847, -0.387784, -0.836087, -0.487385, -0.251823, -0.549752, -0.702478, -0.451992, 0.257122, 0.786468, -0.561566, 0.36484, 0.527978, -0.766897, -0.104808, 0.126944, -0.986357, -0.347383, -0.327711, -0.878596, -0.671186, 0.39753, -0.625684, -0.466184, 0.392174, -0.793015, -0.66594, 0.425023, -0.61309, -0.506187, 0.415998, -0.755461, -0.782886, -0.331361, 0.526582, -0.748164, -0.331001, 0.575056, -0.23886, 0.588419, -0.772469, 0.717187, 0.493627, 0.49191, 0.685662, 0.463818, 0.561017, 0.729603, 0.492638, 0.474329, -0.523499, -0.625505, -0.578526, 0.0214473, 0.529956, -0.847754, -0.466824, 0.30321, -0.830746, -0.38125, 0.0588639, -0.922596, -0.55723, -0.366767, 0.744968, 0.535076, 0.374973, 0.757027, 0.633369, 0.152067, 0.758762, 0.666799, 0.129956, 0.733819, 0.566246, 0.432922, 0.701387, 0.432638, 0.202244, 0.878591, 0.0762135, 0.673409, -0.735331, -0.808247, -0.49779, -0.314551, -0.671649, -0.662724, -0.331187, -0.187024, 0.279964, -0.941617, -0.462676, 0.231959, -0.855644, -0.450144, 0.112152, -0.885885, -0.370247, 0.0569924, -0.927183, 0.242738, 0.912731, -0.328634, 0.517687, 0.627542, -0.581542, -0.412974, 0.00921734, -0.910696, -0.769803, -0.323779, 0.550065, -0.213044, 0.162596, -0.963418, 0.0590196, 0.916291, -0.39614, 0.147777, 0.761623, -0.630946, 0.0995103, 0.991321, -0.0859145, -0.300041, 0.166987, -0.939197, -0.300002, 0.167307, -0.939152, -0.566103, 0.458402, -0.685124, -0.559375, 0.351869, -0.750525, -0.763136, -0.436137, 0.476874, -0.811357, -0.401666, 0.424693, -0.488888, -0.357194, 0.795865, -0.435257, -0.58688, 0.682732, -0.590841, 0.61682, 0.520038, -0.556471, -0.5007, 0.663053, -0.371425, -0.311071, 0.874802, -0.449828, -0.408776, 0.794076, -0.355729, -0.323974, 0.87664, -0.964142, 0.259406, -0.0560188, -0.356431, -0.323397, 0.876568, -0.370503, -0.379716, 0.847669, -0.523403, -0.418902, 0.742005, -0.339263, -0.229184, 0.912346, -0.584334, -0.215467, 0.782386, -0.839347, -0.105186, 0.533322, -0.746453, -0.0914305, 0.659127, -0.756914, -0.244195, 0.606176, -0.974601, 0.223406, -0.0155631, -0.973371, 0.214946, -0.0796713, -0.779722, -0.423167, 0.461481, -0.70681, -0.412331, 0.574806, -0.752714, -0.436407, 0.492921, -0.506733, -0.453277, 0.733322, -0.554984, -0.528732, 0.642211, -0.788655, -0.118811, 0.603248, -0.877947, -0.0777251, 0.472407, -0.819051, -0.0929998, 0.566133, -0.594561, 0.491288, 0.636501, -0.972822, 0.231554, 5.4648e-05, -0.509003, -0.294688, 0.808749, -0.782146, 0.170371, -0.599351, 0.747093, 0.394966, 0.534653, -0.734311, -0.631992, 0.247736, -0.540403, -0.837923, 0.0764921, -0.582241, -0.805267, 0.111982, 0.933246, -0.223465, -0.281276, -0.746046, -0.540666, 0.388709, -0.728286, -0.213737, 0.651088, -0.742785, -0.503204, 0.441651, 0.821874, -0.527377, 0.2154, 0.802417, -0.537734, 0.258784, 0.794657, -0.571659, 0.204269, -0.354487, -0.487966, 0.797639, -0.355813, -0.0916998, 0.930047, 0.838814, -0.406834, 0.36177, 0.657348, -0.752725, -0.0360506, 0.652222, 0.749087, 0.116081, 0.793333, -1.29393e-05, -0.608789, 0.162734, 0.794508, -0.585043, -0.229213, 0.757598, -0.611153, 0.0826518, 0.371361, -0.924803, -0.241565, 0.938184, -0.247906, -0.710858, 0.62862, -0.315464, -0.25028, -0.141491, -0.957779, -0.0907461, -0.332783, -0.938627, -0.319558, 0.920763, -0.223782, -0.670678, -0.444686, 0.593671, -0.0135992, 0.95586, -0.293508, 0.685256, -0.726868, 0.0456787, 0.644558, -0.733424, -0.215949, 0.414606, -0.844153, -0.339865, -0.552293, -0.8124, 0.187027, -0.420153, -0.741051, 0.523751, 0.0722205, 0.983879, -0.163607, 0.098224, 0.964303, -0.245911, -0.590774, 0.79261, 0.150851, -0.450608, 0.892667, -0.00992119, -0.640335, -0.432163, 0.634985, -0.349857, -0.538778, 0.766367, -0.562735, -0.292991, 0.772972, -0.690664, -0.427796, 0.583073, -0.877659, 0.17523, 0.446104, -0.515204, 0.845026, -0.143164, -0.359115, -0.053999, 0.93173, -0.670056, -0.128784, 0.731054, -0.573918, 0.807833, 0.134251, -0.573918, 0.807833, 0.134251, -0.614336, 0.777412, 0.134989, -0.999654, 0.0140378, -0.0222549, -0.998597, 0.0131187, 0.0513034, -0.995218, -0.0976588, 0.0019928, -0.825641, 0.561467, 0.0554177, 0.353796, -0.244135, 0.902899, 0.817629, -0.567179, 0.0989514, -0.880505, 0.385511, -0.275847, -0.447296, 0.871978, 0.198949, -0.477234, 0.872934, 0.101169, -0.578883, 0.804493, 0.132988, -0.857573, -0.280264, 0.431302, -0.833867, -0.439308, 0.334176, -0.484994, -0.34859, 0.802038, -0.880853, 0.274364, -0.385774, -0.926219, 0.111885, -0.360001, -0.939002, 0.0921773, -0.331327, -0.866297, 0.159168, -0.473492, -0.561667, -0.299767, 0.771149, -0.530374, -0.812495, 0.241982, -0.785023, -0.619364, 0.0112887, -0.898485, -0.382614, -0.215248, -0.81698, -0.43352, 0.380269, -0.684368, -0.433202, 0.586495, -0.516051, 0.712764, -0.475036, -0.619931, 0.571127, -0.538052, -0.162747, 0.890397, -0.425096, -0.497126, -0.332776, 0.801327, -0.667754, 0.740263, 0.0781973, -0.866029, 0.445398, -0.227187, -0.716072, 0.692192, 0.0900567, -0.520064, 0.410548, -0.748989, 0.755065, -0.539319, 0.372843, 0.843743, -0.401375, 0.356365, -0.462636, 0.88633, -0.0196613, -0.677851, 0.726124, -0.115162, -0.981494, 0.0496503, -0.184945, -0.84693, -0.320049, -0.424593, -0.190726, -0.253005, 0.948479, -0.955569, 0.107243, -0.274565, -0.996487, 0.0498642, -0.0672877, -0.741208, -0.381168, 0.55256, 0.753142, -0.402761, 0.520154, -0.985321, 0.0541052, -0.161911, -0.41978, 0.856038, -0.301635, 0.60642, -0.778119, -0.163664, 0.745117, -0.666934, 0.00066913, 0.577591, -0.800376, -0.160582, -0.998899, 0.0373924, -0.0283167, -0.538621, 0.841029, -0.0505842, -0.707716, 0.703261, -0.0675422, -0.947776, 0.223175, -0.227844, -0.819309, 0.499039, -0.282299, -0.999078, 0.0303956, 0.0303318, -0.559485, -0.313268, 0.767359, -0.762789, 0.520896, -0.383171, -0.890623, 0.283698, -0.355395, -0.41978, 0.856038, -0.301635, -0.994091, 0.0332363, 0.103338, -0.995114, -0.0840784, 0.0517651, -0.89358, 0.440316, 0.0873862, -0.980586, 0.19562, 0.0135834, -0.974826, 0.216403, -0.0536988, -0.983511, 0.0872053, 0.158435, -0.9949, 0.0990043, 0.0192936, 0.542643, 0.275783, -0.793399, 0.597277, 0.484269, -0.63933, -0.271333, 0.961076, 0.0520631, -0.302404, -0.365937, 0.880137, -0.839813, -0.530816, 0.113793, -0.842376, 0.502695, -0.194164, -0.939884, 0.210995, -0.268513, -0.974567, -0.0559063, 0.217011, 0.958532, -0.00454482, 0.284947, -0.963336, 0.0188819, 0.267633, -0.571705, -0.517849, 0.636385, -0.268509, -0.391192, 0.880268, 0.953619, -0.140648, -0.266139, 0.912306, -0.404186, -0.0658045, -0.885052, 0.0154957, 0.465234, -0.938882, 0.223755, 0.261599, -0.727319, -0.175281, 0.663538, -0.834908, -0.473569, 0.280466, -0.795831, -0.111579, 0.595149, -0.957738, -0.184643, 0.220555, -0.967463, -0.236456, 0.0900204, 0.768193, -0.474842, 0.429423, -0.791964, -0.336873, 0.509225, 0.15992, 0.953629, -0.254985, 0.901468, -0.32726, 0.283297, -0.191156, -0.252456, 0.948539, -0.77129, 0.0635847, 0.6333, -0.527243, -0.315641, 0.788914, -0.811511, -0.0951694, 0.576536, -0.78047, -0.126884, 0.612183, -0.72248, -0.0033154, -0.691384, -0.871154, 0.0365137, -0.489651, -0.705663, 0.254312, -0.661336, -0.758342, 0.168207, -0.629781, -0.820237, 0.333231, -0.464938, -0.837805, 0.134393, -0.52917, -0.871775, 0.454011, -0.184069, -0.873523, 0.402779, -0.273361, -0.830736, 0.494336, -0.255948, -0.748128, 0.521295, -0.410556, -0.876703, 0.108257, 0.468693, -0.989328, -0.044368, -0.138789, -0.977915, 0.0166458, -0.208341, -0.939576, 0.273425, 0.205998, -0.940283, 0.333791, -0.0667129, -0.910982, 0.202152, 0.359509, -0.854728, -0.38492, -0.348248, -0.81708, -0.350763, 0.457542, -0.783557, -0.148715, -0.603259, -0.868943, -0.191075, -0.456539, -0.149188, 0.967501, 0.204169, -0.126822, 0.965683, 0.226655, 0.0770218, -0.8089, -0.582879, -0.839599, -0.140082, -0.524834, -0.925555, -0.0751727, -0.371074, -0.677855, -0.137386, -0.722245, -0.788334, -0.237421, -0.567592, -0.708685, -0.193943, -0.678344, 0.387941, 0.915684, 0.105, 0.274869, 0.920046, 0.279217, 0.327426, 0.925163, 0.192006, -0.661325, -0.0993569, -0.74349, -0.747653, -0.158031, -0.645012, -0.616771, -0.0977519, -0.781049, -0.922578, 0.315535, 0.222008, 0.815624, -0.56338, 0.13176, -0.622601, -0.148716, -0.768278, -0.968337, -0.00652551, -0.249559, -0.965188, -0.136742, -0.222967, -0.902234, -0.146658, -0.405542, -0.817947, 0.397324, -0.416049, -0.922576, 0.377553, 0.079417, -0.859394, 0.474378, 0.190809, -0.881807, -0.349684, -0.316446, -0.560006, 0.794787, -0.233895, -0.730925, -0.351357, -0.585061, -0.555437, -0.300535, -0.77535, -0.425868, -0.0314275, -0.904239, 0.781186, -0.605677, -0.15134, -0.802712, 0.577745, -0.147867, -0.844729, 0.531275, -0.0646469, -0.765439, 0.58683, -0.264071, -0.952555, -0.17139, -0.251524, -0.890369, 0.415338, -0.186382, -0.87016, 0.360964, -0.335448, 0.515001, -0.408872, -0.753391, 0.52045, -0.524189, -0.67406, -0.956266, -0.0912258, -0.277909, -0.974815, -0.188054, -0.119882, -0.636947, 0.755946, 0.151142, -0.883248, -0.170451, -0.436829, -0.894152, -0.404812, -0.191363, -0.720685, -0.297913, -0.625988, -0.920037, 0.348068, 0.179947, -0.850564, -0.495087, 0.177285, -0.933424, -0.21737, -0.28543, -0.917752, -0.382102, -0.1083, -0.996983, -0.0642058, -0.0436279, -0.94017, -0.338496, -0.0387444, -0.877335, -0.067876, -0.475055, -0.87714, -0.0563796, -0.476915, -0.275695, 0.916268, 0.290596, -0.303474, 0.78751, 0.536406, -0.799652, -0.0593229, -0.597526, -0.0332648, -0.746027, -0.665084, -0.185708, -0.599869, -0.778248, 0.0421642, -0.391479, -0.919221, -0.923656, -0.372832, -0.088639, -0.572543, -0.0225757, -0.819564, -0.684962, -0.236743, -0.689042, -0.582621, -0.108722, -0.805439, -0.71601, -0.520692, -0.464984, -0.633347, -0.242359, -0.734938, -0.76112, -0.530127, -0.373713, -0.761777, -0.401992, -0.508034, -0.785351, -0.548789, -0.286453, -0.792229, -0.105315, -0.601068, -0.913018, -0.265054, -0.310071, -0.946469, -0.318166, -0.0544724, 0.248233, -0.96865, 0.00989886, 0.214113, -0.961539, -0.172042, 0.314036, -0.909299, -0.273052, -0.871775, 0.454011, -0.184069, -0.0861615, -0.572172, -0.815595, -0.865329, -0.380052, -0.32675, -0.940955, -0.281877, 0.187482, -0.826952, -0.441481, 0.348204, -0.859582, -0.245293, -0.448274, -0.766162, -0.363467, 0.529987, -0.82452, -0.32651, 0.462123, -0.988033, -0.137453, -0.0699876, -0.986142, -0.165859, -0.0038476, -0.896522, -0.254879, 0.362333, -0.810148, -0.305959, 0.50005, -0.828881, -0.418044, -0.371747, -0.842143, -0.334121, 0.423271, 0.547943, -0.835981, 0.0299082, -0.881924, -0.300073, 0.363547, -0.866624, -0.313775, 0.387953, -0.857056, -0.31861, 0.404897, -0.86579, -0.328052, 0.377875, -0.848147, -0.344912, 0.402098, -0.928665, -0.256503, 0.267931, -0.922127, -0.271608, 0.275519, -0.829788, 0.342042, 0.440976, -0.376003, -0.916623, 0.135734, -0.547834, 0.313431, -0.775654, -0.279667, 0.400861, -0.872409, -0.951774, -0.195498, 0.236446, -0.914526, -0.394225, -0.0907092, -0.599577, -0.780267, -0.178019, -0.935399, -0.255892, 0.244023, -0.850534, -0.345238, 0.39674, -0.255987, 0.424406, -0.868533, -0.934899, -0.256836, 0.244948, -0.833109, -0.375189, 0.406401, -0.952689, 0.272467, -0.134702, -0.826136, 0.553676, 0.104607, -0.85677, 0.512045, -0.0612855, -0.953434, -0.235866, 0.187967, -0.953237, -0.242098, 0.180908, -0.823975, -0.387667, 0.413255, -0.947716, -0.247487, 0.201457, -0.930002, -0.270441, 0.248913, -0.800891, -0.395288, 0.4498, 0.178313, -0.962184, -0.205927, 0.195353, 0.828979, -0.524053, -0.992771, -0.103605, 0.0605877, -0.988642, -0.138235, 0.0589721, -0.969284, -0.20778, 0.131588, -0.939715, -0.279614, 0.196854, -0.933448, -0.293067, 0.206851, -0.934162, -0.284955, 0.214807, -0.97895, -0.203793, 0.0112064, -0.967404, -0.249497, 0.043372, -0.911538, -0.350914, 0.21438, -0.0261505, 0.826193, -0.56278, -0.214506, 0.903468, -0.371123, -0.212441, 0.902888, -0.373713, -0.915102, -0.384189, 0.122421, -0.926394, -0.333209, 0.175403, -0.918019, -0.327523, 0.223539, -0.841127, -0.402878, 0.360826, -0.835325, -0.412792, 0.36309, -0.649943, -0.662437, -0.372494, -0.85022, -0.409555, 0.330742, -0.960244, -0.260123, 0.101332, -0.957706, -0.260486, 0.122257, -0.841107, -0.409329, 0.353537, -0.986126, -0.165224, 0.0160073, -0.920906, -0.345502, 0.180445, -0.893837, -0.371461, 0.25114, -0.955872, -0.278721, 0.0928651, 0.318107, -0.837754, 0.44382, -0.919603, -0.387224, 0.0662354, -0.899242, -0.383939, 0.209653, -0.829117, -0.414498, 0.375175, -0.937035, -0.328328, 0.119023, 0.840664, 0.202245, 0.502376, -0.934144, -0.343032, 0.0985074, -0.912064, -0.389571, 0.127963, -0.917984, -0.380819, 0.110822, -0.937376, -0.322031, 0.13275, -0.96206, -0.272005, -0.0212951, -0.869236, -0.412199, 0.272985, -0.974617, -0.217417, -0.0533926, -0.946053, -0.296076, 0.131615, -0.92752, -0.357902, 0.107764, -0.900538, -0.396895, 0.177499, -0.87389, -0.484136, 0.0439078, -0.963118, -0.267255, -0.0312662, -0.942278, -0.312542, 0.120129, -0.933736, -0.344433, 0.0974814, -0.916602, -0.368823, 0.154309, -0.811768, -0.451518, 0.370358, -0.891889, -0.412397, 0.185642, -0.676451, 0.731306, 0.0872135, -0.821595, -0.563706, 0.0849493, -0.928173, -0.369803, 0.0417293, -0.887883, -0.414035, 0.200596, -0.931261, -0.36236, 0.0380502, -0.901722, -0.402797, 0.157012, -0.903512, -0.40439, 0.141897, -0.802852, 0.443836, -0.398042, -0.919172, -0.380491, -0.101727, -0.952671, -0.266394, -0.146467, -0.939597, -0.341781, 0.0185113, -0.907338, -0.402851, 0.120206, -0.809513, 0.424266, -0.405816, -0.669575, 0.484611, -0.562869, -0.962862, -0.218508, -0.158588, -0.945465, -0.313503, -0.0883873, -0.903254, -0.417082, 0.100867, -0.98029, -0.197375, 0.00865287, -0.883652, -0.461074, 0.081052, -0.936555, -0.343599, -0.0693163, -0.924664, -0.379634, 0.0295649, -0.917404, -0.389715, 0.0805697, 0.378548, -0.880417, -0.285602, -0.649599, -0.0240355, -0.759897, -0.879972, -0.447269, 0.16, -0.877245, -0.446644, 0.17593, -0.593263, -0.290523, -0.750757, -0.907301, -0.416857, 0.0550847, -0.903346, -0.412459, 0.117661, -0.941668, -0.25615, -0.218283, -0.917401, -0.39638, -0.0354807, -0.414879, 0.847588, -0.330861, -0.458618, -0.631235, 0.625469, -0.902041, -0.377019, 0.21019, -0.954937, -0.200156, -0.219164, -0.887523, -0.449418, 0.101617, -0.48461, 0.732912, -0.477487, -0.638696, 0.362598, -0.678668, 0.20503, 0.927102, 0.31376, 0.112006, 0.806458, 0.580586, 0.132329, 0.874815, 0.466035, 0.236858, 0.930461, 0.279538, -0.715158, -0.695203, 0.0723923, -0.927203, -0.309815, -0.2105, -0.916274, -0.400551, -0.000864125, -0.895105, -0.440005, 0.0719894, -0.893275, -0.443767, 0.0716291, -0.914656, -0.404225, -0.00257842, -0.580591, -0.11063, -0.806644, -0.531243, -0.225942, -0.816536, 0.286948, -0.0121186, -0.95787, -0.169224, -0.957063, -0.235358, -0.796125, -0.0824447, -0.59949, -0.929542, -0.183944, -0.319557, -0.928021, -0.255049, -0.271526, -0.87723, -0.0607273, -0.476213, -0.224608, -0.469147, -0.85408, 0.359079, -0.330071, 0.872992, -0.928168, -0.34802, -0.131855, -0.915438, -0.395177, 0.0762174, -0.995792, -0.0843553, -0.0358119, -0.83392, -0.165108, 0.526609, -0.961531, 0.103699, 0.254371, -0.933429, -0.043881, 0.356067, -0.236457, -0.930641, -0.279278, -0.0832992, -0.893279, -0.441717, -0.905437, -0.139681, -0.400841, -0.933415, -0.270546, -0.235672, -0.916886, -0.392398, -0.0731067, -0.0899489, -0.974016, -0.207849, -0.801316, 0.448174, -0.396274, -0.109323, -0.0514763, -0.992673, -0.407026, -0.396075, -0.823076, -0.282601, -0.627821, -0.725243, -0.919081, -0.38765, -0.0708366, -0.909736, -0.408358, 0.0749928, -0.928749, -0.127322, -0.348159, -0.895216, -0.36021, -0.26237, -0.866208, -0.109445, -0.48755, -0.892456, -0.44544, 0.0714564, 0.383281, 0.597393, -0.704427, -0.0455661, 0.299009, -0.953162, 0.0700774, 0.875944, 0.477296, 0.200254, 0.942541, 0.267423, 0.0703721, 0.875878, 0.477373, -0.413323, -0.093355, -0.905786, -0.631872, -0.63312, -0.447098, -0.882315, -0.20981, -0.421307, -0.903056, -0.286747, -0.319791, -0.911384, -0.335159, -0.238847, -0.930756, -0.0968165, -0.35259, 0.0912512, 0.880018, 0.466093, -0.318792, 0.374988, -0.870492, 0.199459, 0.075602, -0.976985, -0.52791, 0.125868, -0.839922, -0.868964, -0.465001, 0.169342, 0.163492, -0.981745, -0.0971923, 0.131719, 0.959647, 0.24845, -0.139821, -0.961858, -0.235114, -0.0282049, -0.884678, -0.465349, 0.886999, 0.225535, -0.402947, 0.252205, 0.393372, -0.884111, -0.944109, -0.15991, -0.288249, -0.631382, 0.439027, -0.639228, -0.613756, -0.783194, -0.0995522, -0.0031747, -0.965278, -0.261205, -0.0262652, -0.977408, -0.209721, 0.0333898, -0.908907, -0.415659, -0.723544, -0.0132118, -0.690151, -0.872153, 0.0266666, -0.488506, -0.83179, -0.193266, -0.52036, -0.377262, 0.925839, 0.0222597, -0.810561, -0.291635, -0.507878, -0.811108, -0.28954, -0.508203, -0.793755, -0.096708, -0.6005, -0.149109, 0.0215742, 0.988585, 0.23067, 0.0362969, 0.972355, 0.189242, -0.00628546, 0.98191, 0.699934, 0.0267227, 0.713707, 0.907881, 0.0526221, 0.415911, 0.870398, -0.101281, 0.481819, 0.993161, 0.0220089, 0.114662, 0.932415, 0.0259659, 0.360456, 0.977125, 0.180126, 0.113055, -0.889864, 0.0314393, 0.455141, -0.924692, 0.254306, 0.283326, 0.7362, 0.161969, -0.657096, 0.629204, 0.148062, -0.763008, -0.166843, -0.218432, 0.961484, -0.677816, 0.393796, 0.620879, -0.785403, 0.257203, 0.563018, -0.777406, 0.204587, 0.594798, -0.833802, 0.136193, 0.535001, -0.830638, 0.400062, 0.387286, 0.0472894, -0.27319, 0.960797, -0.766846, 0.628274, 0.131219, 0.451917, -0.0916387, -0.88734, -0.808933, -0.00431444, -0.587884, -0.724259, 0.591445, -0.354459, 0.999543, 0.0046131, 0.0298901, 0.949696, -0.201221, -0.239972, 0.702104, -0.646461, 0.298559, 0.89153, 0.225266, -0.392974, 0.969707, 0.106557, -0.219802, -0.398308, 0.180135, 0.89939, -0.554525, 0.184676, 0.811416, -0.447589, 0.109286, 0.887536, 0.155566, -0.0334754, 0.987258, -0.141895, -0.0044285, 0.989872, 0.175112, 0.200685, -0.963878, -0.902563, 0.212097, -0.374694, 0.650085, -0.0519354, -0.758085, -0.947729, 0.310298, 0.0743244, -0.924182, 0.232253, -0.303226, -0.814241, 0.556313, -0.165913, -0.571434, -0.0857468, 0.816156, -0.989172, -0.0111332, -0.14634, -0.960662, -0.0360882, -0.275366, 0.158702, -0.270676, 0.949499, 0.65838, 0.694236, -0.290814, 0.928339, -0.254244, 0.271195, 0.821287, -0.245525, -0.514981, 0.679251, -0.681127, 0.273285, 0.752476, -0.55424, 0.355805, 0.831191, -0.497614, 0.247995, -0.577622, 0.455836, -0.677175, -0.750439, 0.342541, -0.565249, -0.152001, 0.150305, -0.976885, 0.670431, -0.632384, -0.388088, 0.788765, 0.0678449, 0.610939, 0.041955, 0.336418, -0.940778, -0.0948891, 0.0662026, -0.993284, -0.102646, 0.0658215, -0.992538, -0.866858, -0.125024, 0.482624, -0.560861, 0.419004, -0.714052, -0.642368, -0.0495108, 0.764795, -0.30302, -0.165772, 0.938456, 0.599529, -0.673706, 0.432071, 0.0854097, -0.194296, 0.977218, -0.6275, 0.413143, -0.659967, -0.405017, 0.44283, -0.799914, -0.913714, 0.406136, -0.0133909, -0.699532, 0.70444, -0.120082, -0.496379, -0.0947378, -0.862921, -0.841216, 0.291293, -0.455527, -0.916041, 0.363965, -0.16852, -0.701333, 0.678744, -0.217804, -0.934905, -0.0590848, 0.349945, -0.960987, -0.130104, 0.244085, -0.664751, 0.361073, -0.654012, -0.992027, 0.079155, -0.0980611, -0.910138, -0.00361953, -0.414289, -0.175262, 0.490658, -0.853544, -0.900198, 0.323855, -0.291138, 0.0550028, 0.408541, -0.911081, 0.502761, 0.511405, -0.696919, 0.145412, 0.510586, -0.847442, 0.854657, -0.301451, 0.422716, 0.853096, -0.329717, 0.404368, 0.803329, -0.437444, 0.40411, -0.632989, 0.302521, -0.712605, 0.809668, -0.261075, -0.525621, 0.100825, 0.0632966, -0.992889, -0.0558635, 0.0144499, -0.998334, 0.100205, -0.00480517, -0.994955, 0.259833, 0.813004, 0.521067, -0.17052, -0.223823, 0.959597, 0.000990819, 0.886536, 0.462659, -0.963093, 0.0226294, -0.268217, -0.781672, 0.287048, -0.553707, 0.84266, -0.297215, 0.448985, -0.284924, 0.599016, -0.748331, 0.572187, 0.469048, -0.672752, 0.74702, -0.631168, 0.208776, 0.834711, -0.467147, 0.291602, 0.873683, -0.128081, 0.469332, 0.916754, -0.282968, 0.281942, -0.575507, 0.717476, -0.392454, -0.6939, 0.559133, -0.453733, -0.624278, 0.663337, -0.412626, -0.732586, 0.30345, -0.609291, 0.0537681, -0.291857, 0.954949, 0.734616, 0.186895, -0.652234, 0.917023, 0.00531771, -0.398799, 0.417154, -0.173898, -0.892044, -0.960463, 0.19639, -0.197336, 0.0710635, 0.266397, -0.96124, 0.0114265, -0.00727169, -0.999908, -0.614649, 0.680505, -0.398898, -0.495859, -0.0953072, -0.863157, -0.402727, -0.0296388, -0.91484, 0.482206, 0.0499599, -0.874632, 0.278734, 0.0230101, -0.960093, 0.0985592, 0.105816, -0.989489, 0.187632, 0.29051, -0.938295, 0.9769, 0.171823, -0.127053, 0.966995, -0.0589882, -0.247873, 0.83669, -0.0986206, -0.538724, 0.645862, -0.261764, -0.717176, 0.874283, -0.467765, -0.12971, 0.962813, -0.254268, -0.0913218, 0.840912, -0.523215, -0.138251, -0.219717, 0.0850021, -0.971853, -0.13056, 0.132812, -0.982505, -0.085754, 0.159465, -0.983472, 0.227692, 0.468671, -0.853524, -0.18128, 0.327213, -0.927399, 0.667938, -0.0477804, -0.742682, 0.975103, -0.176798, 0.133855, 0.484939, -0.571162, 0.662275, 0.431751, -0.670032, 0.603861, 0.150139, 0.352837, -0.923561, -0.509971, -0.173418, -0.84253, 0.1607, 0.28596, -0.94467, 0.191582, 0.290769, -0.937416, 0.900971, 0.0168947, 0.43355, -0.412811, -0.0616554, -0.908728, -0.258146, 0.0443528, -0.965087, 0.145893, 0.315121, -0.937771, 0.34553, 0.354314, -0.868948, -0.394017, -0.0461299, -0.917945, -0.449679, -0.0503137, -0.891772, -0.531243, -0.225942, -0.816536, -0.334239, 0.0396038, -0.941656, -0.0680731, 0.168606, -0.98333, 0.694588, 0.372595, -0.615403, 0.914776, -0.0672082, 0.398331, 0.629215, 0.547321, -0.551841, -0.280838, -0.802279, 0.526763, -0.208168, -0.199198, 0.957594, -0.140762, -0.140986, 0.979954, -0.415576, -0.0598593, 0.907587, -0.425868, -0.0314275, -0.904239, -0.295895, 0.0117155, -0.955149, -0.152936, 0.0880321, -0.984307, 0.032178, 0.228018, -0.973125, 0.317843, 0.354627, -0.879327, -0.237991, -0.375836, 0.895605, -0.222318, -0.331361, 0.916938, 0.633869, -0.704176, 0.319917, 0.632523, -0.662827, 0.400719, -0.311547, 0.0295695, -0.94977, 0.164661, 0.310214, -0.936298, 0.421244, 0.39494, -0.816441, 0.527486, 0.433734, -0.730502, -0.211634, 0.126458, -0.969133, 0.252531, 0.335425, -0.907589, -0.5102, 0.0232434, 0.859742, 0.239129, -0.953229, -0.184859, -0.0611675, -0.0835859, -0.994622, -0.802606, -0.395155, -0.446851, -0.495323, -0.0442423, -0.867581, -0.391765, -0.000690115, -0.920065, -0.391765, -0.000690115, -0.920065, -0.0059908, 0.208461, -0.978012, 0.514086, 0.44658, -0.732313, -0.109386, 0.149008, -0.982767, -0.173873, 0.0568061, -0.983128, 0.122433, 0.292152, -0.948503, 0.766239, -0.619617, 0.170151, 0.6438, -0.667103, 0.374827, 0.24218, 0.34161, -0.908103, 0.370956, 0.382861, -0.846055, -0.713307, 0.00613838, 0.700825, -0.411748, 0.0461661, -0.910128, -0.217718, 0.019386, -0.975819, 0.277781, 0.384328, -0.880414, 0.289585, 0.380036, -0.878472, 0.493508, 0.445154, -0.747186, 0.621819, 0.501309, -0.60169, -0.56149, 0.0011616, -0.827483, 0.717295, -0.558116, 0.417126, -0.601218, 0.0766245, -0.795403, 0.391039, 0.339754, -0.855369, -0.680423, 0.00170044, -0.732818, -0.606113, -0.0134318, -0.795265, -0.26671, -0.0934889, -0.959232, -0.26671, -0.0934889, -0.959232, -0.00676929, 0.0273525, -0.999603, -0.931621, 0.240272, -0.272675, -0.506999, 0.0709413, -0.859022, -0.0313833, 0.0357176, -0.998869, 0.334369, 0.363013, -0.869724, 0.368125, 0.3494, -0.861629, 0.627306, 0.562334, -0.538764, -0.651402, -0.136968, -0.746267, -0.353732, 0.110737, -0.928769, -0.254722, -0.0104193, -0.966958, 0.0806423, 0.0289567, -0.996322, 0.200388, 0.188262, -0.961458, -0.691449, 0.0987805, -0.71564, -0.627873, -0.108748, -0.770681, -0.743976, 0.446651, -0.496994, -0.892616, 0.0424334, -0.448816, -0.70744, -0.129867, -0.69474, -0.723051, -0.153619, -0.673498, -0.578044, -0.486535, -0.655095, 0.649407, 0.553821, -0.521108, -0.483029, -0.109223, -0.868766, -0.510035, -0.173364, -0.842502, -0.553617, 0.466288, -0.689988, -0.603015, 0.00666358, -0.797702, -0.637742, 0.134145, -0.758479, -0.444586, 0.171149, -0.879233, -0.645239, -0.333572, -0.687311, -0.731711, -0.167333, -0.660756, -0.743105, -0.186091, -0.642779, -0.649229, 0.392575, -0.65145, -0.353732, 0.110737, -0.928769, -0.254722, -0.0104193, -0.966958, 0.0266616, -0.0279467, -0.999254, 0.10822, 0.0247872, -0.993818, 0.7847, 0.591641, -0.184951, 0.754348, 0.620792, -0.213488, -0.433841, 0.696933, -0.571022, -0.699826, -0.00436088, -0.7143, -0.657254, -0.214171, -0.722598, 0.81776, 0.0563899, -0.57279, -0.646247, 0.271989, -0.713012, 0.7012, -0.651544, 0.289498, 0.91153, -0.352304, 0.212121, 0.912241, -0.361559, 0.192593, 0.700905, -0.673505, 0.234784, 0.836632, -0.381848, 0.392732, 0.707161, 0.659992, -0.253643, 0.551962, -0.0729221, -0.830675, -0.0286272, 0.181225, -0.983025, -0.25028, -0.141491, -0.957779, -0.39724, 0.0146373, -0.917598, -0.109367, -0.0274173, -0.993623, 0.406523, -0.0994074, -0.908217, 0.440071, -0.0937052, -0.89306, 0.382022, -0.103476, -0.918342, 0.387649, -0.346995, -0.854004, 0.5157, -0.341693, -0.785684, 0.868106, -0.396206, -0.299019, 0.924513, -0.211373, -0.317171, 0.310519, 0.290852, 0.904977, 0.268881, 0.338801, 0.901619, 0.29551, 0.269567, 0.916519, -0.690291, 0.0836271, 0.718682, -0.743651, 0.0359445, 0.667601, -0.585901, 0.0161451, 0.810222, -0.681374, -0.0327395, 0.731203, -0.672331, -0.0288552, 0.739688, 0.715571, -0.310176, -0.625898, 0.867984, -0.334568, -0.36697, -0.518006, -0.0721493, 0.852329, -0.804979, -0.159349, 0.571504, -0.42768, -0.11273, -0.896873, -0.146199, -0.0632314, -0.987232, 0.975489, -0.114358, 0.187999
-};
-
-float mBitangents[] = {
-0.314579, 0.889248, 0.332083, 0.150467, 0.915457, 0.373228, 0.0739715, 0.924341, 0.374329, -0.184759, 0.956164, 0.227189, -0.260074, 0.939819, 0.221587, 0.279516, 0.928719, 0.243624, -0.696928, 0.0958772, 0.710703, -0.586227, 0.277307, 0.761208, -0.58894, 0.21919, 0.777885, 0.376188, -0.491794, -0.785252, 0.369389, -0.508564, -0.777762, 0.317731, -0.663157, -0.677695, -0.48444, 0.492908, 0.722744, -0.488683, 0.459835, 0.741445, -0.342167, -0.872494, -0.34882, -0.682052, -0.591205, -0.430443, -0.613757, -0.64728, -0.45203, -0.939323, -0.050738, 0.33926, -0.911253, -0.128336, 0.391341, -0.901926, 0.000597013, 0.431891, -0.114805, 0.283561, 0.952057, -0.0609859, 0.613273, 0.787513, -0.158323, 0.434908, 0.886447, -0.535901, 0.824237, 0.182875, -0.583253, 0.795769, 0.162995, -0.360533, 0.912079, 0.195263, 0.418909, -0.0810031, -0.904408, 0.410376, -0.380023, -0.828959, 0.301424, -0.0123865, -0.95341, -0.410633, 0.890723, 0.194918, -0.0784679, 0.966765, 0.243326, -0.128764, 0.969028, 0.210725, -0.572299, 0.796552, 0.194882, -0.576573, 0.788675, 0.213435, -0.253038, 0.950081, 0.182533, -0.830651, -0.534442, -0.156172, -0.785286, -0.609972, -0.106111, -0.897685, -0.440613, -0.0047957, -0.862218, -0.0678597, 0.501972, -0.606423, 0.770258, 0.197366, -0.425043, 0.884525, 0.192233, 0.521402, -0.44057, -0.730779, 0.559757, -0.262429, -0.786004, 0.581014, -0.503799, -0.639225, 0.397504, -0.800455, -0.448623, 0.422059, -0.823081, -0.380005, 0.366232, -0.881827, -0.297077, 0.248665, -0.744561, -0.619511, 0.370209, -0.612461, -0.698453, 0.277356, -0.715176, -0.641558, 0.116104, 0.962287, -0.246014, -0.192113, 0.981372, -0.0012471, -0.687112, 0.467247, 0.556379, 0.428533, -0.492614, -0.757424, 0.427106, -0.391057, -0.815264, 0.39631, -0.612483, -0.683961, 0.357439, -0.483526, -0.799025, 0.811512, -0.52718, -0.25205, 0.885099, -0.359385, -0.295705, 0.672835, -0.71998, -0.170068, 0.722796, -0.189249, -0.664643, -0.293835, 0.744559, -0.59941, -0.347374, 0.908847, -0.230931, -0.416365, 0.873663, -0.2517, -0.777675, -0.0661025, 0.625181, -0.719672, 0.00807788, 0.694267, -0.690523, 0.138083, 0.710008, 0.315061, 0.833307, 0.454242, 0.183462, 0.871698, 0.454405, 0.377978, 0.823158, 0.423726, -0.982312, -0.151037, -0.110681, -0.969478, -0.226453, 0.0939729, -0.984374, -0.150236, 0.0918566, -0.503483, 0.828844, 0.243974, 0.32831, 0.942543, -0.0618472, -0.00434969, 0.998425, 0.0559265, -0.408065, 0.889671, 0.204863, 0.00339223, 0.90898, 0.416826, -0.150057, 0.930393, 0.334443, -0.472114, 0.864215, 0.173898, -0.305634, 0.930805, 0.200474, -0.933102, -0.206901, 0.294129, -0.954556, -0.137665, 0.264332, -0.518585, -0.399018, 0.75621, -0.493131, -0.710966, 0.501347, -0.468539, -0.485037, 0.738383, 0.820187, 0.129843, 0.557166, 0.716253, 0.136046, 0.684451, 0.775333, 0.0366237, 0.63049, 0.405141, 0.892092, -0.200081, 0.0790598, 0.995953, 0.0427376, 0.12259, 0.99179, -0.0363887, 0.20822, 0.940419, 0.268804, 0.299751, 0.910889, 0.283603, -0.99449, -0.0582925, -0.0871285, 0.308559, 0.678199, 0.666961, 0.246898, 0.620685, 0.744172, 0.429239, 0.514321, 0.742447, -0.536055, 0.665897, 0.51887, -0.513318, 0.764601, 0.389731, -0.607619, 0.543309, 0.579323, 0.682716, 0.230213, 0.69347, 0.551709, 0.234239, 0.800468, 0.171093, 0.905349, 0.388677, 0.212857, 0.908873, 0.358667, -0.976076, -0.0459351, 0.21252, 0.356689, -0.313839, -0.879931, -0.807998, -0.144619, 0.571161, 0.498144, 0.354018, 0.791532, 0.363913, 0.483446, 0.796146, -0.998813, -0.0395915, 0.0283672, -0.993669, -0.00165131, 0.112334, -0.577111, 0.800423, 0.162066, -0.542214, 0.819538, 0.185368, 0.598395, -0.714379, -0.362749, 0.573796, -0.738302, -0.354497, 0.467366, -0.83257, -0.297314, 0.253716, -0.672927, -0.694837, -0.538748, 0.830641, 0.140663, -0.649046, 0.728069, 0.220579, -0.441756, 0.891845, 0.0972824, 0.367071, 0.884641, 0.287523, 0.475529, 0.819648, 0.319452, 0.480817, 0.840756, 0.248887, -0.997176, 0.075105, -0.000254679, -0.773319, 0.562249, -0.293009, -0.722101, 0.668354, -0.178531, -0.764968, 0.563115, -0.312611, 0.857853, -0.511075, -0.0537739, 0.984411, 0.155312, -0.0825351, -0.795465, 0.0645781, 0.602549, 0.708789, 0.699336, 0.0924529, 0.885198, 0.340318, 0.317188, -0.869035, 0.175333, 0.462641, -0.843476, 0.108421, 0.526112, -0.807651, 0.30494, 0.504689, 0.0134841, 0.977446, 0.210755, 0.018826, 0.968978, 0.24643, 0.197714, 0.956962, 0.212445, 0.634362, 0.0747366, -0.769415, -0.72638, 0.681518, 0.0889089, -0.731897, 0.678428, 0.0637334, -0.56685, 0.812092, 0.138521, -0.77766, 0.23474, 0.583218, -0.73784, 0.382428, 0.556184, -0.320351, 0.923889, 0.209294, -0.526364, 0.790107, 0.314121, -0.404852, 0.811114, 0.422125, 0.756503, -0.560065, -0.337684, 0.672835, -0.71998, -0.170068, -0.453274, 0.873066, 0.17972, -0.183715, 0.939991, 0.287517, -0.289993, 0.927613, 0.235451, -0.516865, 0.856066, 0.00103879, -0.474042, 0.877786, 0.069114, -0.315784, 0.893009, 0.320646, -0.356523, 0.894633, 0.269302, -0.172376, 0.843382, 0.508914, -0.038952, 0.309415, -0.950129, 0.2474, -0.230977, -0.94098, 0.168987, -0.390524, -0.90495, 0.132628, 0.618473, 0.774533, 0.229167, 0.533077, 0.81444, -0.450562, 0.819897, 0.353218, -0.497343, 0.750358, 0.435447, -0.509614, 0.523334, 0.682946, 0.0631147, 0.0705398, 0.99551, -0.575506, 0.808858, 0.120586, -0.521751, 0.853097, 0.00102203, -0.0848128, 0.789859, 0.607395, 0.00675406, 0.703758, 0.710407, -0.0288908, 0.770873, 0.636334, 0.0266152, 0.221618, 0.97477, -0.0974493, 0.566757, 0.818102, 0.77764, 0.14233, -0.612387, -0.0328586, 0.799595, 0.59964, -0.215657, 0.891905, 0.397488, -0.0922633, 0.812241, 0.575979, 0.366842, 0.864336, 0.344019, -0.646322, 0.609754, 0.458767, -0.560082, 0.745673, 0.360943, -0.628865, 0.627982, 0.45844, 0.280254, 0.95158, -0.126306, 0.255978, 0.965866, -0.0397235, 0.343397, 0.934389, -0.0948498, -0.152451, 0.40013, 0.903689, 0.0200087, 0.176387, 0.984118, -0.286637, 0.58714, 0.757038, -0.495131, 0.867676, 0.0445478, -0.195543, 0.844338, 0.498856, -0.307756, 0.925513, 0.220705, -0.420509, 0.888995, 0.181271, -0.408492, 0.892811, 0.189798, -0.332663, 0.921583, 0.200048, -0.316738, 0.926948, 0.20111, -0.958784, -0.235813, 0.158508, -0.9223, -0.230129, 0.31049, 0.0617679, 0.973727, 0.219182, -0.0283924, 0.947746, 0.317762, 0.639988, -0.730411, -0.238572, 0.439335, -0.873857, -0.20823, -0.971942, 0.124661, 0.19947, -0.954194, 0.0853365, 0.28676, -0.128254, 0.777639, 0.615491, 0.445136, 0.841812, 0.305297, 0.270786, 0.945941, 0.178524, -0.0650725, 0.986379, 0.151068, 0.410676, -0.408654, -0.815075, -0.98259, 0.144832, 0.11636, -0.567159, 0.820886, -0.0669138, -0.508555, 0.861003, 0.00677618, -0.467782, 0.880279, 0.0792971, -0.327363, 0.893055, 0.308685, -0.463974, 0.860081, -0.212105, -0.511732, 0.770546, -0.379985, -0.48652, 0.864242, -0.128005, -0.7526, -0.598225, 0.275171, -0.867988, -0.482198, 0.118671, -0.7696, -0.633808, 0.0774874, 0.191912, 0.93801, 0.28863, 0.386545, 0.8412, 0.378106, 0.478575, 0.822171, 0.308223, -0.278855, 0.95979, 0.032306, -0.450424, 0.850007, 0.273141, -0.37071, 0.918156, 0.13987, -0.249475, 0.843977, -0.474831, -0.357178, 0.93338, -0.035014, -0.597812, 0.776366, -0.19969, 0.0827065, 0.59673, 0.798168, 0.00307459, 0.679691, 0.733492, 0.371037, 0.908482, 0.192333, 0.231562, 0.945968, 0.226987, -0.104217, 0.974443, 0.198996, 0.894558, 0.310055, -0.321919, 0.966875, 0.106914, -0.231778, 0.877905, -0.0592374, -0.475156, -0.509845, 0.859345, -0.0397952, -0.254733, 0.853322, 0.454921, -0.687136, 0.628975, -0.363641, -0.659349, 0.58747, -0.469189, -0.447498, 0.852697, 0.269542, -0.333023, 0.903751, 0.268942, -0.167982, 0.772263, 0.612693, 0.0724266, 0.982662, 0.170675, -0.573751, -0.729828, -0.371701, -0.793677, -0.460556, -0.397448, -0.689469, -0.581405, -0.431974, -0.358686, 0.911205, 0.202608, -0.475116, 0.861171, 0.18069, -0.348363, 0.915339, 0.201983, 0.105514, 0.925253, 0.36438, 0.236086, 0.899441, 0.367789, 0.417929, 0.805154, 0.420787, -0.482883, -0.762748, -0.430163, 0.6911, 0.135863, -0.709875, 0.45714, 0.458502, -0.762102, 0.341112, 0.707917, -0.618462, -0.423715, 0.880927, 0.21079, -0.529911, 0.789833, 0.308801, -0.555976, 0.741196, 0.37619, 0.327744, 0.818957, 0.471056, -0.480164, 0.856781, 0.188067, -0.35177, 0.915302, 0.196164, 0.0515097, 0.94327, 0.328007, 0.597705, -0.756194, -0.266308, 0.406408, -0.846824, -0.343107, 0.644191, -0.707266, -0.291192, -0.862579, -0.184216, 0.471192, -0.917862, 0.0960736, 0.385097, -0.317713, 0.912333, 0.258279, -0.163195, 0.902121, 0.39943, -0.200068, 0.915431, 0.349225, -0.637438, 0.669306, -0.381709, -0.258937, 0.931249, -0.256372, -0.171791, 0.840292, -0.514195, -0.245364, 0.941012, -0.23301, -0.317193, 0.865248, 0.388246, 0.804669, 0.533429, 0.260693, 0.830213, 0.446276, 0.334041, 0.732791, 0.557221, 0.390541, -0.103613, 0.958421, 0.265882, 0.167126, 0.932965, 0.318818, -0.106654, 0.959304, 0.261458, -0.0934423, 0.964316, 0.247718, -0.0797484, 0.967499, 0.23997, -0.724068, -0.654215, -0.218467, -0.79588, -0.590177, -0.135156, -0.522419, -0.849064, -0.0785482, 0.295301, 0.937307, 0.185074, 0.005983, 0.98287, 0.184204, 0.373096, 0.920901, 0.112873, -0.691475, 0.698666, 0.183651, -0.665823, 0.716155, 0.209289, -0.658553, 0.71998, 0.218945, -0.294827, 0.91029, 0.2906, -0.214433, 0.904478, 0.368699, -0.441858, 0.887853, 0.128366, -0.57762, 0.758924, -0.300649, -0.386885, 0.912483, 0.133018, -0.401142, 0.899696, 0.172141, -0.44308, 0.825222, 0.350269, -0.459226, 0.847045, 0.267631, -0.480497, 0.8287, 0.287016, -0.539757, 0.742309, 0.397038, -0.131679, 0.914675, -0.382138, -0.261213, 0.948769, -0.17778, -0.148821, 0.878839, -0.453315, -0.469682, 0.879631, 0.0751612, -0.478565, 0.875794, -0.0629328, -0.37039, 0.908313, 0.194364, -0.118972, 0.971436, 0.205323, 0.203927, 0.803511, 0.559271, 0.144336, 0.809167, 0.569575, 0.256312, 0.791451, 0.554896, 0.242331, 0.885664, 0.396075, 0.353123, 0.864376, 0.357992, -0.996802, 0.0310984, -0.0736048, -0.831146, 0.32156, 0.453647, -0.191099, 0.896066, 0.400684, 0.244387, 0.0435389, -0.9687, 0.237588, -0.0242794, -0.971063, 0.133372, 0.067973, -0.988732, -0.181806, 0.875476, -0.447759, -0.132719, 0.680007, -0.721094, -0.313591, 0.831249, -0.459005, -0.676554, 0.622298, 0.393726, -0.745069, 0.484592, 0.458304, -0.651526, 0.632788, 0.418442, -0.184931, -0.297317, 0.936698, -0.162635, -0.215072, 0.962961, 0.0957037, -0.596328, 0.797016, 0.0964459, 0.91409, 0.393876, -0.996726, 0.0762301, 0.0269495, -0.994386, 0.0418813, -0.0971751, -0.966237, -0.213025, 0.144934, -0.195031, 0.96034, 0.199272, -0.209122, 0.954116, 0.214315, -0.0874895, 0.972061, 0.217813, -0.973525, -0.210441, -0.0892436, -0.375259, 0.907036, 0.190963, -0.961555, 0.269557, 0.0524462, -0.706744, 0.0284861, -0.706895, -0.795598, -0.282971, -0.535678, -0.887064, 0.00913266, -0.461555, -0.0950945, 0.887217, -0.451445, -0.120219, 0.926398, -0.356838, 0.0418391, 0.719896, -0.69282, -0.34695, 0.937717, -0.0176924, 0.0106549, 0.969444, 0.245081, -0.251244, 0.943619, 0.215545, -0.352504, 0.913048, 0.205147, 0.311596, 0.874112, 0.372607, 0.216895, -0.151015, -0.964443, 0.392906, -0.489857, -0.778245, 0.00298728, 0.085628, -0.996323, -0.348487, 0.905444, 0.242339, -0.371116, 0.905237, 0.206926, -0.312471, 0.906675, 0.283378, -0.610883, 0.701723, 0.366615, -0.572243, 0.756569, 0.316451, -0.671291, 0.598676, 0.436984, -0.377566, 0.915353, 0.139904, -0.44344, 0.858274, 0.258316, -0.227579, 0.953113, -0.199455, -0.214767, 0.935444, -0.280749, -0.421652, 0.906348, -0.0272707, -0.284339, 0.802514, 0.524522, -0.0522995, 0.95783, 0.282537, -0.09852, 0.959396, 0.264299, -0.0458969, 0.948654, 0.312967, -0.613118, 0.330897, 0.717352, -0.935367, 0.312758, 0.16514, -0.873788, 0.447501, 0.190358, -0.889223, 0.438193, 0.13141, -0.683199, 0.724137, -0.0941535, -0.592898, 0.805277, -0.000998264, -0.60079, 0.798927, 0.027707, -0.467409, 0.872989, 0.139353, -0.267402, 0.907256, 0.324626, -0.082771, 0.951461, 0.296429, -0.159937, 0.957882, 0.2385, -0.272489, 0.938515, -0.211991, -0.191983, 0.904506, -0.380803, -0.262882, 0.921893, -0.284615, -0.640458, 0.609601, 0.467119, -0.664933, 0.444733, 0.600064, -0.615437, 0.63938, 0.460901, -0.262213, 0.956287, -0.129459, -0.230459, 0.964471, -0.129164, -0.289778, 0.956842, -0.0219416, -0.374999, 0.923447, 0.0813707, -0.418565, 0.907371, 0.0384789, -0.722996, 0.673451, 0.15408, -0.353467, 0.903988, -0.240556, -0.37604, 0.924591, -0.061029, -0.434749, -0.871185, -0.228101, -0.420801, -0.896858, -0.136281, -0.312042, -0.925749, -0.213585, -0.722594, 0.671512, 0.1641, -0.559204, 0.81002, 0.176518, -0.316382, 0.923461, 0.217076, -0.374673, 0.731571, 0.569582, -0.367467, 0.848091, 0.381719, -0.19223, 0.978698, 0.0721002, -0.120611, 0.983886, 0.131987, -0.330432, 0.923817, 0.193333, -0.69073, 0.70822, -0.146002, -0.43943, 0.88376, 0.160839, -0.305539, 0.898715, 0.314575, 0.425346, 0.903168, -0.0580438, 0.71429, 0.6922, -0.103195, 0.523202, 0.851999, -0.0189142, -0.92506, 0.325579, -0.195609, -0.73851, 0.640933, -0.209303, -0.948312, 0.266585, -0.172155, -0.380838, 0.919787, 0.0946242, 0.163188, -0.145542, -0.975801, -0.530004, 0.818164, 0.222942, -0.450951, 0.8683, 0.206634, -0.377293, 0.90756, 0.184348, -0.292161, 0.899995, 0.323498, -0.194754, 0.874318, 0.444565, -0.27545, 0.953585, 0.121668, 0.874969, 0.451486, -0.174901, 0.899292, 0.411761, -0.147403, 0.889214, 0.456003, -0.0368754, 0.762869, -0.604144, -0.230306, 0.462338, -0.827352, -0.318956, -0.200271, 0.922035, 0.331275, -0.123033, 0.929631, 0.347346, 0.304859, 0.861357, 0.406357, -0.559511, 0.414152, 0.717931, 0.204743, 0.746479, 0.633127, 0.46177, 0.578439, 0.672441, 0.365531, 0.589798, 0.720087, -0.797532, 0.496087, 0.343278, -0.831709, 0.434177, 0.34605, -0.854561, 0.41221, 0.315925, -0.673833, 0.726484, -0.134793, -0.612861, 0.788875, -0.0455768, -0.633322, 0.766411, -0.107323, -0.484233, 0.868597, 0.105154, -0.714082, 0.4078, 0.569021, -0.160271, 0.957601, 0.239404, -0.166401, 0.84893, 0.501625, -0.317416, 0.947042, 0.0485617, -0.395421, 0.913093, -0.099513, -0.385457, 0.89868, -0.20928, -0.261389, 0.866884, -0.424485, -0.59639, 0.802459, -0.0194447, -0.380884, 0.898978, 0.216256, -0.348584, 0.907424, -0.234673, -0.298777, 0.9282, -0.22176, -0.37576, 0.920646, 0.105909, -0.353521, 0.934158, 0.0487004, -0.056905, 0.97447, -0.217185, -0.698414, 0.693286, 0.177686, -0.769407, 0.541261, 0.33919, -0.409892, 0.872732, -0.265193, -0.770371, 0.601743, -0.210792, -0.531706, 0.798708, 0.2817, 0.184954, 0.981285, -0.0535877, 0.314406, 0.945936, -0.0797147, 0.490806, 0.833576, -0.253496, -0.595358, 0.801383, -0.0577435, 0.111365, 0.821989, -0.558509, -0.58919, 0.807636, -0.0240699, -0.383601, 0.90057, 0.204509, -0.454214, 0.879342, 0.142991, 0.939699, -0.250012, 0.233366, -0.448695, 0.461455, 0.765332, 0.277857, 0.931066, -0.236454, 0.348483, 0.892701, -0.285735, 0.258035, 0.922924, -0.28571, -0.768739, 0.603159, -0.212694, -0.756927, 0.591553, -0.277718, -0.293408, 0.953005, 0.0754466, -0.256081, 0.881906, 0.395809, -0.274663, 0.95784, -0.0842793, -0.311039, 0.944157, 0.108728, -0.329672, 0.935437, 0.127574, 0.0650785, 0.994482, -0.0822864, -0.305322, 0.949139, -0.0768958, 0.286917, 0.957948, 0.00381517, -0.677692, 0.549118, 0.489084, -0.266782, 0.835121, -0.481041, -0.645417, 0.327036, 0.690279, 0.216025, -0.760968, -0.611768, 0.145191, -0.843832, -0.516592, 0.46177, -0.370282, -0.806015, 0.125155, 0.991635, -0.0315773, 0.303622, 0.926748, -0.22125, -0.582316, 0.811611, -0.046869, -0.305372, 0.949404, 0.0733539, -0.212883, 0.852056, 0.478207, -0.343065, 0.93922, 0.0131148, -0.357597, 0.931496, 0.0666346, -0.384028, 0.917805, 0.100773, 0.133581, 0.969093, 0.207401, -0.111199, 0.970075, 0.215844, -0.0731755, 0.975733, 0.206374, 0.343024, 0.864063, 0.368416, 0.313668, 0.698316, 0.643403, 0.00461863, 0.935358, 0.353673, -0.387389, 0.595595, 0.703702, -0.419668, 0.640372, 0.643275, 0.38809, 0.919174, 0.0671266, 0.3768, 0.897822, -0.227899, 0.346737, 0.928961, -0.129631, 0.832285, 0.0616455, -0.55091, 0.827548, -0.204085, -0.522985, -0.823001, 0.485534, -0.294831, -0.716945, 0.646686, -0.260359, -0.510267, 0.859371, 0.0333141, -0.69922, 0.71484, -0.00970595, -0.605262, 0.795917, 0.0131606, -0.370291, 0.894473, 0.250603, -0.317648, 0.9301, 0.184428, 0.912265, -0.408642, -0.0279986, 0.957252, -0.201598, -0.20743, 0.898392, -0.389017, -0.203855, -0.318817, 0.940587, 0.116843, -0.346868, 0.925138, 0.154277, -0.354722, 0.921714, 0.156893, 0.23735, 0.722033, 0.649872, 0.898881, 0.347653, 0.266742, 0.866721, 0.326033, 0.377488, -0.826332, -0.310892, -0.469597, 0.205941, 0.969101, -0.13576, -0.701908, 0.673464, -0.231889, -0.467296, 0.875036, 0.12628, -0.634535, 0.772869, 0.00630178, -0.340118, 0.937982, 0.067154, -0.33852, 0.808206, -0.481878, -0.490343, 0.811463, 0.317948, -0.457465, 0.848123, 0.267231, 0.983701, -0.0615905, -0.168936, 0.988628, -0.0334745, -0.146611, -0.331954, 0.935598, 0.120259, -0.334608, 0.93481, 0.119027, -0.648553, 0.561119, 0.51432, -0.286955, 0.943504, 0.165702, -0.591069, 0.75863, 0.274079, 0.955056, -0.287542, 0.0720249, 0.778101, -0.574867, 0.253153, 0.594113, 0.716059, 0.366455, 0.390784, 0.861528, 0.324125, 0.529062, 0.796466, 0.292807, -0.4575, 0.858298, 0.232417, -0.46549, -0.588812, 0.660772, -0.323501, -0.653729, 0.684095, -0.290475, -0.772509, 0.564671, -0.435213, 0.873578, 0.217831, -0.349485, 0.857896, 0.376663, -0.335572, 0.933275, 0.128021, -0.376261, 0.905754, -0.195033, -0.395195, 0.91763, -0.042135, -0.407443, 0.893484, -0.188885, -0.395179, 0.889699, 0.228625, -0.231601, 0.883317, 0.407568, -0.587481, 0.806722, -0.0637671, -0.668455, 0.697014, -0.2595, -0.413679, 0.892302, 0.180741, -0.329502, 0.885849, 0.326651, -0.214562, 0.840969, 0.496724, -0.17712, 0.760901, 0.624226, -0.354545, 0.933926, -0.0456029, -0.276335, 0.938058, -0.209012, -0.285359, 0.910693, -0.298678, -0.548308, 0.781891, 0.296656, -0.529443, 0.806226, 0.263986, -0.53419, 0.794347, 0.289229, -0.415612, 0.888274, 0.19554, -0.519608, 0.829506, 0.204761, -0.687384, 0.6883, -0.231831, -0.273655, 0.876102, 0.396937, -0.270627, 0.958309, -0.0916713, -0.640027, 0.678762, 0.360066, -0.817023, -0.296804, -0.494348, -0.746568, -0.395284, -0.535151, -0.650784, -0.697167, -0.300729, -0.583679, 0.802651, -0.122759, -0.428663, 0.89183, 0.144526, -0.492072, 0.870298, 0.0211231, -0.534174, 0.803398, 0.263079, -0.437863, 0.854894, 0.278268, -0.46833, 0.831843, 0.297831, 0.00519874, 0.814921, -0.579549, -0.264341, 0.944449, -0.195292, -0.00516972, 0.952612, -0.304144, -0.830676, -0.343542, -0.438129, -0.85348, -0.329435, -0.403789, 0.059696, 0.983496, 0.170797, 0.630776, -0.0676525, -0.77301, 0.59807, -0.155987, -0.786117, 0.449148, 0.0358706, -0.892737, -0.28195, 0.865376, 0.41428, 0.820886, -0.524787, 0.225266, 0.895998, -0.437634, 0.0752591, 0.16646, 0.984239, -0.0597109, 0.121601, 0.981199, 0.149874, 0.251038, 0.961155, -0.114719, 0.256009, 0.966668, 0.00366307, 0.00882678, 0.976635, 0.214725, 0.340974, 0.393276, 0.853856, 0.203115, 0.485914, 0.850078, -0.49368, 0.8441, 0.209226, -0.440653, 0.741512, 0.50595, -0.158699, 0.613507, 0.773579, -0.412049, 0.896506, 0.162766, 0.230695, 0.970229, 0.0737244, -0.751849, 0.617988, 0.229811, -0.403518, 0.900127, 0.16415, -0.335968, 0.887335, 0.315852, 0.911848, 0.375103, -0.166827, 0.77583, 0.624449, -0.0902852, -0.241726, 0.922471, -0.301024, -0.294781, 0.9314, -0.213538, -0.29819, 0.946714, 0.121717, -0.302411, 0.938614, 0.165988, -0.410636, 0.911799, 0.00106421, -0.529034, -0.72609, -0.439222, -0.173757, 0.940557, 0.291824, 0.207293, 0.863186, 0.46037, 0.222842, 0.752225, 0.62008, -0.713147, 0.638502, -0.289373, -0.771712, 0.487438, -0.408491, -0.28416, 0.857944, 0.428001, -0.230443, 0.812121, 0.536056, 0.561177, 0.368957, -0.740912, 0.908002, 0.144247, -0.393352, 0.723734, 0.438689, -0.532692, 0.0579072, 0.812543, 0.580017, -0.289419, 0.930277, 0.225437, -0.662633, 0.66569, -0.343183, -0.632163, 0.69682, -0.33884, -0.529165, 0.845484, -0.0717071, -0.568844, 0.812904, -0.124913, 0.00391233, 0.902241, 0.431215, 0.124202, 0.898125, 0.421835, -0.0296127, 0.92131, 0.3877, 0.0794999, 0.80097, -0.593402, -0.593472, 0.473557, 0.650795, -0.565194, -0.648795, -0.50953, -0.55918, 0.821488, -0.111692, -0.328317, 0.81352, 0.479993, -0.0904218, 0.964236, 0.249144, -0.61053, 0.791145, 0.036657, -0.518218, 0.81786, 0.25011, -0.81672, 0.491268, -0.302695, -0.328565, 0.941585, 0.073915, 0.410817, -0.476669, -0.777185, 0.278374, -0.306391, -0.910292, -0.46754, 0.813931, 0.344853, -0.393993, 0.908675, 0.138131, 0.459257, 0.739184, 0.492636, 0.711988, 0.542183, 0.446218, -0.356264, -0.834991, -0.419364, -0.161208, 0.887055, 0.432602, 0.49753, -0.559503, -0.662888, -0.143456, 0.926078, 0.348999, -0.345376, 0.911824, 0.222019, -0.310646, 0.919537, 0.240732, -0.604026, 0.792327, -0.0858522, -0.615149, 0.779157, -0.120441, -0.447335, 0.891553, 0.0708926, -0.360497, 0.888737, 0.283177, -0.186414, 0.672027, 0.71668, -0.910946, -0.232327, -0.340884, -0.933341, -0.206458, -0.293684, -0.899671, -0.38086, -0.213395, -0.852163, -0.414522, -0.319357, -0.911853, -0.356222, -0.204036, 0.243158, -0.963977, -0.107807, 0.265032, -0.953615, -0.142744, 0.296436, -0.935539, -0.192077, -0.506289, 0.861957, 0.0264943, -0.267036, 0.780093, 0.565815, -0.294933, 0.743473, 0.600219, 0.121535, -0.539633, 0.833082, 0.278312, -0.621691, 0.732149, 0.700765, 0.649637, 0.294789, -0.808752, 0.583559, 0.0733398, -0.738513, 0.664447, 0.114493, -0.827023, 0.431566, 0.360255, -0.579304, 0.813278, -0.0546335, -0.503113, 0.864079, 0.0156787, -0.365837, 0.875448, 0.315838, 0.402422, 0.201413, -0.893023, -0.2611, 0.958276, -0.116331, -0.334861, 0.942262, -0.00330368, -0.341946, 0.93381, 0.105226, -0.516366, 0.800874, 0.303262, -0.231163, 0.952881, 0.196421, -0.607364, 0.793993, -0.0261763, -0.540088, 0.839796, -0.0552083, -0.435865, 0.890914, 0.127648, 0.110787, 0.878734, 0.464277, 0.051246, 0.121371, -0.991283, -0.540409, 0.658767, 0.523435, -0.471336, -0.786687, -0.398706, -0.737024, 0.630053, -0.244599, -0.668915, 0.722096, -0.176434, -0.53806, 0.839401, -0.076789, -0.128872, 0.350598, -0.927617, -0.674924, -0.624535, -0.39298, -0.684178, -0.646493, -0.337562, -0.844584, -0.368067, -0.388849, -0.363961, 0.924401, 0.114086, -0.388083, 0.901464, 0.191714, -0.327681, 0.943809, 0.0430049, -0.243471, 0.940628, 0.236517, -0.18451, 0.937996, 0.293462, -0.566567, 0.823221, 0.0361767, -0.577385, 0.811564, -0.0893917, -0.465228, 0.884026, 0.0453911, -0.427512, 0.89461, 0.130022, -0.361796, 0.861295, 0.356755, -0.336715, 0.705088, 0.624079, 0.0553097, 0.530401, 0.845941, -0.190035, 0.599826, 0.777236, -0.220168, -0.884674, -0.410949, -0.714201, -0.604183, -0.353384, -0.453576, -0.728997, -0.512672, -0.912646, -0.399979, -0.0842252, -0.825199, -0.56483, -0.00365633, -0.578665, 0.796121, -0.177025, -0.378434, 0.886857, 0.26509, -0.412279, 0.854845, 0.315065, -0.394316, 0.779099, 0.48736, -0.329095, 0.783037, 0.527777, -0.337432, 0.718375, 0.608339, -0.266002, 0.553943, 0.788917, 0.632893, 0.349779, 0.690726, 0.729323, 0.305296, 0.612277, 0.553627, 0.52748, 0.644408, -0.166586, 0.978241, -0.123669, -0.513076, 0.809192, 0.286288, -0.81059, 0.392511, 0.434602, -0.627115, 0.63142, 0.45611, -0.701847, 0.518098, 0.488861, -0.666511, 0.501694, 0.551421, -0.607843, 0.650651, 0.45517, -0.803742, 0.572549, 0.161825, -0.83351, 0.548307, -0.0679763, -0.192096, 0.953446, 0.232465, 0.023752, 0.959728, 0.279926, -0.299448, 0.952007, -0.0633538, -0.622491, 0.738168, -0.260026, -0.540674, 0.805731, -0.241802, -0.491734, 0.868975, -0.0555062, -0.473532, 0.874462, -0.105277, -0.454398, 0.890798, 0.000582114, -0.328683, 0.830159, 0.450337, -0.335988, 0.827101, 0.450574, -0.331934, 0.795794, 0.506489, -0.244005, 0.94319, -0.225511, -0.368741, 0.909812, 0.190455, -0.276766, 0.942778, 0.185933, 0.507506, 0.318022, 0.800812, 0.310719, 0.573998, 0.757614, -0.0670295, 0.78161, 0.620156, -0.314404, 0.861946, 0.397743, -0.754964, 0.574024, -0.317059, -0.708703, 0.593211, -0.381891, -0.560969, 0.799909, -0.213214, -0.365303, 0.744398, 0.558951, -0.384057, 0.908752, 0.163309, -0.354884, 0.91979, 0.167463, -0.335106, 0.942062, -0.0149278, -0.288688, -0.956934, -0.0306167, -0.101008, -0.967962, -0.229887, -0.107843, -0.991194, -0.0768407, -0.818531, 0.53379, 0.212309, -0.521151, 0.790214, -0.322434, -0.493529, 0.850184, -0.183347, -0.470324, 0.868371, -0.157246, -0.337859, 0.788577, 0.513806, -0.333733, 0.828047, 0.450511, -0.448047, 0.842375, -0.299429, -0.180044, -0.966528, -0.182778, -0.211586, -0.961827, -0.173552, -0.105211, 0.417811, 0.902421, -0.0821524, 0.227778, 0.970241, -0.649987, 0.663185, -0.371083, -0.537224, 0.802123, -0.260746, -0.494675, 0.641872, 0.585916, -0.539058, 0.488872, 0.685872, -0.451908, 0.883549, -0.122964, -0.440864, 0.889256, 0.12191, -0.5776, 0.659965, 0.480441, -0.511511, 0.774809, 0.371521, 0.369309, -0.246165, -0.896111, -0.580603, 0.814064, -0.0141414, -0.693156, 0.635716, -0.339704, -0.425329, 0.904223, 0.0384204, -0.389806, 0.890396, 0.235044, -0.339816, 0.825485, 0.450666, -0.764841, 0.551049, 0.333712, -0.152374, 0.945237, -0.288633, -0.604595, 0.796154, 0.0245632, 0.136979, 0.832198, 0.537292, -0.460037, 0.887052, 0.0388028, -0.386376, 0.818922, 0.424358, -0.356187, 0.818348, 0.451041, -0.35336, 0.819599, 0.450992, -0.523114, 0.832179, 0.183929, -0.856185, 0.42343, 0.296065, 0.217917, 0.668088, 0.711457, -0.578499, 0.797391, -0.171775, -0.486718, 0.872714, -0.0384093, -0.40196, 0.878702, 0.25751, -0.426826, 0.893773, 0.137803, -0.404768, 0.894681, 0.188967, -0.0974633, 0.976284, 0.193314, -0.149802, 0.971414, 0.184158, 0.469942, 0.878395, -0.0870499, -0.361726, 0.930514, 0.0574241, 0.143253, -0.89612, -0.420056, 0.123637, -0.77419, -0.620761, -0.38115, 0.868289, 0.31749, -0.275907, 0.755253, 0.594532, -0.31481, 0.924308, 0.215751, -0.491284, 0.854311, 0.169683, -0.931573, 0.255232, 0.258899, -0.510777, 0.857647, 0.0595721, -0.391145, 0.84216, 0.371176, -0.497952, 0.849899, 0.172384, -0.562247, 0.812057, 0.156339, -0.739152, 0.50121, 0.449937, -0.666094, 0.655197, 0.35642, -0.22739, 0.957004, 0.180105, -0.0487211, 0.984552, 0.168177, 0.336518, -0.00532585, -0.941662, 0.29415, 0.0683028, -0.953316, -0.296948, -0.530491, -0.793978, -0.206802, -0.64396, -0.736579, -0.213003, -0.676501, -0.704965, -0.439116, 0.891065, 0.114805, -0.405065, 0.880755, 0.245343, -0.437917, 0.646897, 0.624302, -0.4327, 0.762937, 0.48031, -0.928885, 0.151736, -0.337858, -0.898396, 0.289271, -0.330465, -0.892222, 0.254843, -0.37282, -0.289519, 0.956924, -0.0217885, 0.38809, 0.919174, 0.0671266, 0.346737, 0.928961, -0.129631, 0.34054, 0.939718, 0.0310175, 0.234645, 0.586766, -0.775014, -0.31076, 0.889642, 0.334612, -0.308378, 0.889679, 0.33671, -0.361801, 0.889506, 0.279067, -0.411545, 0.890833, 0.192475, -0.147662, 0.914094, 0.377661, -0.108674, 0.919314, 0.378221, -0.396499, 0.894737, 0.205512, 0.281841, 0.955803, 0.0837, 0.0968603, 0.983035, 0.155758, 0.349085, 0.934107, -0.0747267, -0.341528, 0.771429, 0.536894, -0.477894, 0.72282, 0.499148, -0.423606, 0.582623, 0.69362, -0.486411, 0.546141, 0.682007, -0.165825, -0.581002, -0.79683, -0.197032, -0.674858, -0.711157, 0.150581, -0.985016, -0.0840783, 0.204611, -0.913615, -0.351343, 0.301046, -0.785679, -0.540444, -0.946317, -0.0812367, -0.312864, 0.995161, -0.00395382, -0.098182, -0.866155, 0.293592, 0.404449, -0.899385, 0.371359, 0.23065, -0.392616, 0.808347, 0.438666, -0.464568, 0.559342, 0.686523, -0.142533, 0.768747, 0.623468, -0.0111996, 0.636574, 0.771134, -0.181657, -0.567105, -0.803363, 0.0174706, -0.822838, -0.568007, -0.362644, 0.929359, -0.0691455, -0.416947, 0.844153, 0.336988, -0.905, -0.343258, -0.251297, -0.803982, -0.52471, -0.279808, -0.26121, -0.921948, -0.285973, -0.347166, 0.87319, 0.342075, -0.188892, 0.971646, -0.142209, -0.674821, 0.435672, 0.595656, -0.219103, 0.869231, 0.443206, -0.334967, 0.899708, 0.279862, -0.0804227, -0.562772, -0.822691, -0.0109771, -0.642107, -0.766536, 0.0367769, -0.779266, -0.625613, -0.120169, -0.664356, -0.737693, -0.420978, 0.875008, 0.239036, -0.448126, 0.641304, 0.622826, -0.490647, 0.668342, 0.559093, 0.135116, 0.975093, 0.175893, -0.415586, 0.44352, 0.79409, -0.223104, 0.973759, 0.0449194, -0.312241, 0.932404, 0.182013, -0.892229, 0.411029, 0.187035, -0.403916, 0.835536, 0.372468, -0.164243, 0.966823, -0.195644, 0.195358, -0.291204, -0.936502, 0.243396, 0.933, 0.265085, -0.163159, 0.951618, 0.260387, -0.160607, 0.956523, 0.243452, -0.500414, 0.60268, 0.621581, -0.515068, 0.855141, 0.0586386, -0.433037, 0.900537, 0.0388908, -0.272527, 0.961044, 0.0460788, -0.341558, 0.930615, 0.131508, -0.391954, 0.891238, 0.228181, 0.211225, -0.886084, -0.412599, -0.0840161, 0.788442, 0.609344, -0.239919, 0.87096, 0.428797, -0.355, 0.896491, 0.265102, -0.452454, 0.845024, 0.28499, -0.36637, 0.924154, 0.108221, -0.414227, 0.885253, 0.211525, -0.694173, 0.625022, 0.357032, -0.667749, 0.656266, 0.351319, -0.622432, 0.712754, 0.323358, -0.405387, 0.884714, 0.230093, 0.334174, 0.939195, 0.0789923, 0.482478, 0.836716, 0.259078, 0.693534, 0.654576, 0.3009, 0.0278088, -0.679996, -0.732688, 0.227528, 0.832788, 0.504674, 0.289678, 0.773554, 0.563649, 0.634918, 0.531603, 0.560605, -0.916021, 0.39679, 0.0588579, -0.824807, -0.407342, -0.392131, -0.847686, -0.410485, -0.336051, -0.793004, -0.521642, 0.314697, -0.414931, 0.866312, 0.278092, -0.496558, 0.539812, 0.67973, -0.118209, 0.961315, -0.248796, 0.0683265, 0.878275, -0.473249, -0.0789023, 0.928257, -0.363474, -0.248674, 0.967747, -0.0403323, -0.225969, 0.968906, -0.100791, 0.0775073, -0.857212, -0.509098, 0.254238, -0.919201, -0.30072, -0.31261, 0.898393, 0.308488, -0.252132, 0.864118, 0.435581, -0.269028, 0.519718, 0.810874, -0.479323, 0.870787, -0.109455, -0.931995, -0.0876853, 0.351704, -0.909501, 0.242347, 0.337751, 0.859498, -0.475435, -0.18768, -0.383712, 0.881992, 0.273597, -0.472798, 0.879759, -0.04987, -0.401295, 0.906011, 0.134559, 0.989777, -0.13417, -0.0483699, -0.364046, 0.931357, 0.00676441, -0.372809, 0.914901, 0.154823, -0.402692, 0.8926, 0.20274, -0.380067, 0.786266, 0.48717, -0.804116, 0.463778, 0.371897, -0.425934, 0.748496, 0.508266, -0.554432, 0.582794, 0.594102, -0.18817, 0.909534, 0.370594, -0.185761, 0.901659, 0.390517, -0.343732, 0.906141, 0.246488, -0.213442, 0.967359, -0.136595, -0.801034, -0.597138, 0.0420675, -0.413255, 0.85279, 0.319328, -0.38806, 0.906367, -0.167056, -0.386756, 0.917523, -0.0925789, -0.371582, 0.921768, -0.110774, -0.9091, 0.374345, 0.182767, -0.473525, 0.867658, -0.151474, -0.404762, 0.904606, 0.133625, -0.423506, 0.900609, -0.0977038, -0.38346, 0.9002, -0.206394, -0.411212, 0.779944, 0.471797, -0.356209, 0.66006, 0.661389, -0.828076, 0.439836, 0.347613, -0.206383, -0.119738, 0.971117, -0.0752931, -0.493379, 0.86655, -0.381662, -0.103932, 0.91844, -0.429042, 0.840209, 0.331619, -0.623203, 0.470191, 0.624931, -0.480559, 0.873805, 0.0743529, 0.195958, -0.977929, -0.0724943, -0.42147, 0.906555, -0.0228418, -0.444874, 0.867854, -0.221169, -0.40226, 0.915031, -0.0300762, -0.371609, 0.919291, -0.129657, -0.380906, 0.923526, -0.0448346, -0.405652, 0.891745, 0.200594, -0.422865, 0.582557, 0.694127, -0.400921, 0.629902, 0.665196, 0.364363, 0.873308, 0.323377, 0.453135, 0.859925, 0.234943, -0.881784, 0.371452, 0.290654, -0.895423, 0.370093, 0.247483, -0.562228, 0.652086, 0.50861, -0.718314, 0.27802, 0.637754, 0.639767, 0.68216, 0.354055, -0.16704, 0.951623, 0.257899, 0.0120873, 0.944523, 0.328222, 0.986981, -0.140689, 0.0779398, -0.364123, 0.907986, -0.207307, -0.390045, 0.914173, 0.110241, -0.430946, 0.899325, 0.0741561, -0.18275, 0.859899, 0.476631, -0.270129, 0.960006, 0.0736071, -0.242963, 0.682903, 0.688921, -0.435922, 0.82223, -0.365936, 0.345819, -0.498973, -0.794629, -0.359898, 0.923523, -0.132587, -0.378504, 0.925414, 0.0185678, -0.800521, 0.466153, 0.376654, -0.409893, 0.889223, 0.203152, -0.471303, 0.799521, 0.372345, -0.505501, 0.827479, 0.244432, -0.783809, 0.580983, 0.219324, -0.405857, 0.887092, -0.219881, -0.367348, 0.92567, -0.0905061, -0.366312, 0.930402, -0.0129783, -0.431206, 0.822544, 0.370786, -0.393792, 0.906679, 0.1512, -0.23467, 0.945539, 0.225579, -0.360255, 0.926331, 0.110125, -0.169309, 0.860143, 0.481132, -0.411481, 0.882949, 0.226017, -0.852514, -0.324748, -0.409584, -0.394132, 0.915596, 0.0796498, -0.378372, 0.92151, 0.0874857, -0.538523, 0.290525, 0.790941, -0.436444, 0.320573, 0.840684, -0.254509, 0.966426, 0.0353044, -0.443677, 0.818094, 0.365887, -0.34787, 0.912041, 0.21718, -0.55349, 0.832473, 0.0252627, -0.568965, 0.503331, 0.650336, 0.375285, -0.493066, -0.784887, 0.242319, 0.915791, 0.320327, -0.170681, 0.975859, -0.136262, -0.309036, 0.951021, -0.00747574, -0.181682, 0.975384, -0.124975, -0.373897, -0.889943, -0.261156, -0.952087, 0.0301671, 0.304336, -0.869187, -0.29523, 0.396678, -0.426139, 0.880066, 0.209499, -0.450016, 0.854511, 0.259417, -0.371822, 0.912745, 0.169247, -0.485325, -0.87405, -0.0222615, -0.688986, -0.724759, -0.00483599, -0.193296, -0.891204, -0.410355, -0.126903, 0.951218, -0.281213, -0.111958, 0.948551, -0.296171, -0.508649, 0.351364, -0.786015, -0.524698, 0.653995, -0.544961, -0.665925, 0.514185, -0.540516, -0.413355, 0.887452, 0.203881, -0.332684, 0.933943, 0.130657, 0.878509, -0.131382, -0.459305, 0.965598, -0.0359063, -0.257551, -0.300441, 0.934668, 0.19008, 0.00926387, 0.994099, 0.108083, -0.00807365, 0.969378, -0.245441, -0.0200463, 0.979652, -0.1997, -0.112716, 0.984708, -0.132833, 0.29314, 0.952233, 0.0855583, 0.150882, 0.988089, 0.0302363, 0.259302, 0.965213, -0.0335486, -0.173313, 0.950795, 0.256809, -0.528081, 0.81828, 0.227041, -0.828107, 0.427757, -0.362302, -0.0211742, 0.986342, 0.163341, 0.538144, 0.842179, 0.0336957, -0.805832, -0.420971, -0.416436, -0.74503, -0.519367, -0.418555, 0.119542, 0.879432, -0.46077, 0.31708, 0.80693, -0.498321, 0.0936755, 0.946125, -0.309955, -0.424397, 0.904802, -0.0349324, 0.224745, 0.684237, 0.693765, 0.303674, 0.605982, 0.735233, 0.117719, 0.718037, 0.685977, -0.259068, 0.912537, 0.31648, -0.112659, 0.903724, 0.413025, -0.0612882, 0.882929, 0.465488, -0.863402, 0.496163, -0.0914342, -0.906842, 0.352825, 0.230546, -0.806704, 0.521461, -0.278043, -0.0781666, 0.971458, -0.223962, -0.0331271, 0.966588, -0.254184, -0.0461117, 0.950686, -0.306707, 0.433175, -0.714337, 0.54962, 0.313935, -0.721475, 0.617186, 0.204919, -0.978595, 0.0189995, -0.462291, -0.881056, 0.100134, -0.247501, -0.910824, 0.330367, -0.431703, 0.889212, 0.151443, -0.0539561, 0.964074, -0.260098, -0.109264, 0.959805, -0.258527, 0.244557, -0.883599, 0.399306, -0.622935, 0.727423, -0.287764, -0.655678, 0.692107, -0.301784, -0.657379, 0.367774, -0.65772, -0.532383, 0.837655, -0.122076, -0.618492, 0.776888, 0.117952, -0.56775, 0.810717, 0.142824, -0.522781, 0.838302, 0.154757, -0.361743, 0.928621, -0.0824964, 0.283055, 0.959091, -0.00502054, 0.0786777, 0.994137, 0.0741695, 0.0765785, 0.996172, 0.042159, -0.577935, 0.762989, 0.289548, -0.351246, 0.920784, 0.169657, -0.390676, 0.900101, 0.192851, -0.445313, 0.864699, 0.232362, -0.12039, 0.985645, -0.118365, -0.820484, 0.484061, 0.304123, -0.915215, 0.402911, 0.00662731, -0.676782, 0.178303, -0.714265, -0.868523, -0.359835, -0.340861, 0.513002, 0.849344, 0.124271, 0.73045, 0.680544, 0.0574697, -0.691591, 0.701386, 0.17251, -0.511236, 0.657233, -0.55379, -0.620492, 0.642505, -0.449641, -0.511984, 0.799799, -0.313358, -0.351804, 0.920828, -0.168255, 0.524328, -0.00927945, 0.851466, 0.706044, -0.255646, 0.660414, 0.582589, -0.0193453, 0.812536, 0.72231, -0.199707, 0.662107, -0.842467, 0.500964, 0.198205, 0.531947, -0.249536, 0.809175, 0.698215, -0.339313, 0.630367, 0.0501097, 0.990038, 0.13158, 0.834292, 0.551307, -0.00414333, 0.843612, 0.528207, 0.0965167, 0.508171, -0.0445717, 0.860102, 0.625648, -0.282483, 0.727164, 0.691605, -0.393147, 0.605902, -0.392596, 0.911759, -0.120681, -0.430691, 0.899591, -0.0723961, 0.193185, 0.970161, 0.14652, 0.374347, 0.921656, 0.102051, 0.136303, 0.99066, -0.00360936, 0.0424307, 0.998942, 0.01773, 0.193882, 0.978961, -0.0636047, -0.197851, 0.972139, 0.125703, -0.2836, 0.944945, 0.163248, -0.307641, 0.937887, 0.160392, -0.294458, 0.942822, -0.156142, -0.295027, 0.918423, -0.26355, 0.573804, 0.104275, 0.812328, 0.6373, -0.00208321, 0.770613, 0.511967, 0.112784, 0.851569, 0.620896, -0.424803, 0.65881, 0.513959, -0.424527, 0.745401, 0.708157, -0.565091, 0.423303, 0.284943, 0.917801, 0.276495, -0.385658, 0.899155, 0.206853, 0.061145, 0.997987, 0.0168264, 0.0284523, 0.999594, 0.00121454, 0.0738579, 0.99708, -0.0194265, -0.129456, 0.991575, 0.00445356, -0.0837072, 0.996383, -0.0146597, -0.159967, 0.98683, 0.0240053, -0.685889, 0.69112, 0.227838, 0.519475, 0.128624, 0.844749, 0.520105, 0.129993, 0.844152, -0.493528, 0.869684, -0.00890933, 0.0906128, 0.970857, -0.22187, -0.0800171, 0.995234, -0.0557372, -0.0835511, 0.992736, -0.0865648, 0.0407342, 0.99917, 0.000585908, -0.0192335, 0.998349, 0.0541147, 0.0253617, 0.999643, -0.00842002, 0.673874, -0.177018, 0.717327, 0.735658, -0.512376, 0.443034, -0.535268, 0.770164, -0.346893, -0.586921, 0.748311, -0.309118, -0.529034, 0.820773, -0.215532, -0.248094, 0.96841, 0.0251207, -0.146075, 0.951645, 0.270247, -0.280292, 0.926266, 0.251927, -0.449238, 0.876753, -0.171728, 0.59785, -0.0257688, 0.801194, -0.306386, 0.949837, 0.0627471, -0.071638, 0.987868, -0.137783, 0.697781, 0.716013, -0.0206537, -0.6902, 0.709529, 0.142102, -0.433651, 0.884797, 0.170531, -0.206593, 0.96201, 0.178481, 0.761842, -0.0616266, 0.644825, 0.734594, -0.122035, 0.667443, -0.52854, 0.415469, -0.740291, 0.67157, -0.0142475, 0.740804, 0.057512, 0.995714, 0.0724339, 0.536834, 0.166637, 0.827068, 0.639703, -0.332874, 0.692802, -0.297, 0.930672, -0.213639, -0.35585, 0.826613, -0.435984, 0.070657, 0.996412, 0.0466004, 0.301605, 0.921915, -0.243119, 0.360823, 0.914676, -0.182137, 0.302683, 0.928423, -0.215437, -0.0130758, 0.985242, -0.170667, 0.239209, 0.920007, -0.310428, 0.00219444, 0.994987, -0.0999851, 0.058523, 0.994609, -0.0856101, -0.209881, 0.977697, 0.00759425, -0.00739643, 0.987549, -0.157139, 0.331875, 0.923841, -0.190729, 0.0811602, 0.736609, 0.671432, 0.628625, -0.206548, 0.749779, 0.47983, 0.0484612, 0.876022, 0.647497, -0.363414, 0.669835, -0.38341, 0.885808, -0.26142, -0.436294, 0.892025, 0.118063, -0.365909, 0.86821, 0.335146, -0.411261, 0.905461, 0.104908, -0.4371, 0.801784, -0.407537, 0.562198, -0.485921, 0.669189, 0.313166, 0.903332, -0.293118, 0.565007, 0.685901, 0.458592, 0.511292, 0.111377, 0.85216, -0.419128, 0.822661, -0.384136, -0.344668, 0.782509, -0.518539, -0.330825, 0.89064, -0.311955, -0.509999, 0.834275, 0.209491, -0.530055, 0.537756, -0.655637, -0.568066, 0.709549, -0.416943, -0.585778, 0.808086, 0.0621397, -0.647521, 0.730449, 0.217167, -0.72921, 0.675736, -0.107856, 0.558008, 0.685691, 0.467392, -0.345669, 0.937848, 0.0308814, -0.472429, 0.84771, 0.241243, -0.117119, 0.985467, -0.123038, -0.705945, -0.654608, -0.270426, -0.703005, -0.679866, -0.208726, -0.89069, -0.418655, -0.177199, -0.628553, 0.776538, 0.0437073, -0.213542, 0.976934, -0.000635726, -0.416105, 0.827015, 0.378025, -0.402671, 0.592964, 0.697316, -0.402388, 0.479738, 0.779702, 0.808681, -0.489461, 0.326288, 0.654207, -0.443999, 0.612273, 0.60365, -0.325015, 0.727991, -0.292478, -0.902756, -0.315416, -0.276233, -0.900133, -0.336832, 0.202562, 0.885713, -0.417709, -0.532692, 0.804955, 0.261317, -0.513037, 0.851878, -0.105341, 0.569314, -0.586848, 0.575753, 0.478692, -0.537388, 0.694312, 0.566443, -0.655741, 0.499146, -0.325954, 0.939743, 0.103138, -0.515405, 0.266268, 0.81453, -0.234596, -0.213555, 0.948345, -0.497072, -0.811785, 0.306471, -0.725201, 0.680068, -0.107662, -0.891927, 0.415823, 0.177644, -0.634685, 0.684071, -0.359474, 0.578256, -0.428213, 0.694445, 0.575953, -0.477392, 0.663607, -0.529327, 0.549576, -0.646358, -0.449384, 0.890828, 0.0669249, -0.376752, 0.86857, 0.32194, -0.356357, 0.910322, 0.210533, -0.484504, 0.868921, -0.101154, -0.343574, 0.863701, -0.368752, 0.469229, -0.623189, 0.625667, 0.447998, -0.663376, 0.599358, 0.674797, -0.654171, 0.341628, -0.689225, 0.720406, 0.0773548, -0.870399, -0.374487, -0.319634, -0.507883, 0.738323, -0.443773, 0.535309, -0.462874, 0.706535, -0.775359, 0.56102, -0.289957, -0.710964, 0.686996, 0.150223, 0.352787, 0.775721, 0.523257, -0.474846, 0.786687, 0.394519, -0.585984, 0.810128, -0.0177538, -0.894699, -0.436908, -0.0928748, -0.903557, 0.418841, 0.0903206, -0.216701, 0.928147, 0.30263, -0.543334, 0.742233, 0.392273, 0.364479, 0.480554, 0.797636, -0.202132, 0.978887, 0.0303717, -0.0489309, 0.994319, -0.0945229, -0.188748, 0.972604, -0.135706, -0.355273, -0.761814, -0.541683, -0.402274, 0.90287, 0.151662, 0.440481, -0.70008, 0.562018, 0.440844, -0.676019, 0.59047, -0.91235, 0.0756911, -0.402354, -0.925666, 0.141098, -0.351046, -0.937468, 0.0200337, -0.347495, 0.24911, 0.899297, -0.359457, 0.0977772, 0.98749, -0.123705, 0.137198, 0.97035, -0.198989, -0.421754, 0.879944, -0.218682, 0.416072, -0.75676, 0.504181, 0.393169, -0.750693, 0.530923, -0.875194, 0.313976, -0.368042, -0.325985, 0.939806, 0.102462, 0.570511, 0.806635, -0.154458, -0.372219, 0.91016, 0.181827, -0.472796, 0.851284, 0.227552, 0.0527086, 0.99861, 0.00023676, 0.0335733, 0.999201, -0.0217039, 0.0472347, 0.967126, -0.249874, 0.0358502, 0.980267, -0.1944, 0.102854, 0.961026, -0.256613, 0.661096, -0.401664, 0.633733, -0.473188, 0.680648, -0.559296, -0.550812, 0.564722, -0.614568, 0.485033, -0.660072, 0.573627, -0.589326, 0.40795, -0.697331, -0.032137, 0.993195, 0.111943, 0.646439, -0.322778, -0.691326, 0.662819, -0.437225, -0.607869, 0.506929, -0.622458, -0.596296, -0.192337, 0.981171, -0.0175937, 0.533051, -0.526747, 0.662113, 0.614492, -0.550516, 0.565095, 0.622682, -0.570695, 0.535326, 0.378043, -0.633088, 0.675487, -0.547749, -0.830393, 0.102073, 0.0873002, 0.991566, -0.0957884, -0.0630989, 0.997881, -0.0158767, -0.0258819, -0.937821, -0.346152, -0.156462, -0.945352, -0.286058, -0.100683, -0.888613, -0.44747, -0.148886, -0.863975, -0.48102, -0.415878, 0.884682, -0.210675, -0.278484, 0.938963, -0.201979, -0.672505, 0.59444, 0.440883, 0.107911, 0.990837, -0.0812257, 0.056925, 0.995041, -0.0815629, 0.527473, 0.628132, 0.572034, 0.473061, 0.721319, 0.505878, 0.609649, 0.611562, 0.504302, 0.0914102, 0.9141, 0.395051, -0.653841, 0.721981, -0.22635, -0.237381, 0.920456, 0.310503, -0.188209, -0.91562, -0.355271, -0.171869, -0.856654, -0.486421, -0.443305, -0.841968, -0.307522, -0.301844, 0.943631, 0.135833, -0.470599, 0.86069, 0.194291, 0.13955, 0.985196, -0.0995711, -0.224544, -0.920935, -0.318526, 0.0530795, 0.902726, -0.426928, -0.339337, 0.939416, -0.0484582, -0.118376, 0.855211, -0.50458, 0.486597, -0.582403, 0.651176, 0.600048, -0.630473, 0.492388, -0.412519, 0.75508, -0.50959, -0.433327, 0.889322, -0.146064, -0.549878, 0.729376, -0.406995, -0.367173, 0.918641, -0.145887, 0.694494, -0.69994, 0.166621, 0.526465, -0.752902, 0.394935, -0.249287, 0.968413, -0.0056571, 0.2095, 0.960429, -0.183539, -0.207415, 0.975827, 0.0688601, -0.180984, -0.887364, -0.424063, 0.0142076, 0.997923, -0.0628301, 0.149701, 0.966875, -0.206743, -0.424196, 0.722175, -0.546371, -0.277558, -0.668119, -0.690347, 0.315342, 0.936284, -0.154696, -0.111548, 0.993361, 0.0281401, -0.0994593, 0.995041, 0.00105967, 0.345261, -0.596886, 0.724239, -0.655748, 0.753088, 0.0534146, 0.523881, -0.670172, 0.525755, 0.571438, -0.660947, 0.486423, -0.450008, 0.859333, 0.24298, 0.0607776, 0.989094, -0.134159, -0.205616, 0.928245, 0.309972, -0.0897121, 0.935768, 0.341013, -0.0708022, 0.996936, -0.0332633, 0.0867464, 0.981189, -0.172463, 0.799573, -0.423478, 0.425852, 0.589828, -0.454139, 0.667728, -0.41785, 0.904138, -0.0890897, 0.32508, 0.863395, -0.385839, 0.0530111, -0.832511, -0.551466, -0.195899, 0.886957, 0.418247, -0.194188, 0.90041, 0.389298, -0.0800949, 0.852806, 0.516049, -0.861054, -0.439356, -0.256031, -0.78746, -0.546166, -0.285676, -0.578086, -0.699145, -0.420728, -0.00913882, -0.94316, -0.332215, -0.346928, 0.919091, 0.186848, -0.442449, 0.822635, 0.357086, -0.113515, 0.989366, 0.0909346, 0.162885, 0.967201, -0.194913, 0.161666, 0.983603, -0.0799316, 0.293636, 0.947706, -0.125024, 0.207384, 0.966378, -0.152004, 0.511851, -0.702253, 0.494822, 0.713588, 0.24317, 0.657009, 0.729303, 0.355318, 0.584693, -0.185879, 0.97845, 0.0899135, 0.433127, 0.872629, 0.225654, 0.276699, 0.932374, 0.232629, -0.000801018, 0.999249, -0.0387487, -0.831248, 0.530115, -0.167349, -0.880396, 0.276431, -0.385342, -0.93978, 0.339483, -0.0395629, -0.593872, 0.803976, -0.03065, -0.235468, 0.909304, 0.343104, -0.525735, 0.848259, 0.0637103, -0.289127, 0.942246, -0.169049, -0.118602, 0.969007, 0.216701, 0.0301349, 0.994436, 0.100938, -0.361299, 0.929048, -0.0795788, -0.699329, 0.577146, 0.421713, -0.630574, 0.682968, 0.368687, -0.352255, 0.914092, 0.20088, 0.224461, 0.953159, -0.202742, 0.224646, 0.930552, -0.28915, 0.761266, -0.322016, -0.562832, 0.0191058, 0.982827, 0.183539, 0.0607985, 0.98866, 0.137314, -0.894248, 0.438227, -0.0909824, -0.205805, 0.907962, 0.365033, 0.893797, 0.4302, -0.126709, -0.487076, 0.872993, 0.0253215, -0.476042, 0.875646, 0.0814122, 0.825799, 0.556461, -0.091694, 0.183228, 0.610025, 0.770907, 0.161862, 0.643726, 0.747942, 0.224128, 0.64602, 0.729675, -0.417089, 0.887692, 0.195038, -0.943222, 0.281308, -0.176632, -0.687106, 0.724189, 0.0586198, -0.151876, 0.972499, -0.176574, 0.352869, 0.891849, -0.282999, -0.261476, 0.820828, 0.507811, -0.12167, 0.959025, 0.255867, -0.0148021, 0.516246, 0.856312, 0.273344, 0.947585, 0.165427, 0.190205, 0.966909, -0.170025, -0.44177, 0.856797, 0.265966, 0.599937, 0.785775, 0.150441, 0.355799, 0.914998, 0.190228, -0.792668, 0.604081, 0.0822427, -0.840205, 0.539846, 0.0512006, -0.968562, 0.241684, -0.0589607, 0.617501, 0.754773, 0.221381, -0.68547, 0.711659, 0.153858, -0.358658, 0.913684, 0.191169, -0.352412, 0.91357, 0.202967, -0.289003, 0.910602, 0.295432, 0.466572, -0.881059, -0.0777525, 0.401977, -0.86661, 0.295638, -0.442675, 0.888934, -0.117625, -0.428472, 0.813441, -0.393352, -0.553061, 0.807361, -0.205649, -0.359925, 0.212549, 0.908447, 0.410123, 0.170253, -0.895998, 0.499234, -0.0187123, -0.866265, 0.494555, -0.260629, -0.829149, -0.840557, 0.110152, 0.530406, -0.533239, 0.838993, -0.108385, -0.344091, -0.642299, -0.684875, 0.143264, 0.98236, -0.120188, 0.298858, -0.950321, 0.0870283, -0.503753, 0.796982, 0.333245, -0.455357, 0.757033, 0.468562, 0.0151747, 0.655137, 0.755357, -0.78706, -0.472534, -0.396545, -0.738569, -0.55972, -0.375806, -0.73996, -0.530541, -0.413503, -0.621192, 0.767578, 0.157938, 0.0174489, -0.926744, 0.375288, 0.327446, -0.80149, 0.500393, 0.368438, -0.917024, -0.152712, 0.506322, 0.681678, 0.52816, -0.35212, 0.914685, 0.198401, -0.207116, 0.470601, -0.857693, -0.463632, 0.595039, -0.656486, -0.375694, 0.585823, -0.718098, 0.2068, 0.723924, 0.658155, -0.241301, 0.969309, -0.0470555, -0.310688, 0.948825, 0.0565997, -0.352029, 0.92188, 0.161904, -0.376673, 0.872276, -0.311852, -0.678282, 0.66683, 0.308661, -0.732069, 0.576021, 0.363696, -0.10074, 0.973262, -0.206426, 0.403583, -0.682992, -0.608804, 0.405418, -0.275693, -0.871567, -0.0895049, 0.954403, 0.284787, 0.0334888, 0.95236, 0.303133, -0.240202, 0.94018, 0.241586, -0.167479, -0.640035, 0.749871, 0.068735, -0.811967, 0.579642, -0.0169116, -0.884313, 0.466589, 0.00935212, 0.991644, 0.128668, -0.192703, 0.971212, 0.140045, 0.149378, -0.762534, -0.629467, -0.103395, 0.988576, 0.10967, -0.407772, 0.891331, -0.198118, 0.806692, -0.280247, 0.520298, 0.895809, -0.384722, 0.222522, 0.750977, -0.104645, 0.651984, -0.275693, 0.942182, 0.190488, -0.301071, -0.703248, 0.644048, -0.480692, 0.8761, 0.0372144, -0.300415, 0.949731, -0.0881066, -0.676501, 0.675916, 0.292377, -0.402091, 0.915452, -0.0164476, -0.310546, 0.950438, -0.0150931, -0.276046, 0.961122, 0.0066061, -0.268893, 0.962198, -0.0432611, -0.487216, 0.848261, -0.207542, 0.145822, 0.96672, -0.21021, -0.479279, 0.0152494, 0.87753, -0.660621, -0.00146858, 0.750718, -0.465096, 0.00715667, 0.885232, -0.226218, 0.594265, 0.7718, -0.413995, 0.87175, 0.262029, -0.299821, 0.744967, 0.59593, 0.419812, -0.400464, 0.814486, 0.225408, -0.46565, 0.855781, -0.162897, -0.786068, 0.596289, 0.737318, 0.459794, 0.494925, -0.500959, 0.849494, -0.165529, 0.198762, -0.979884, 0.0179228, 0.250662, -0.953853, -0.165329, 0.0629574, -0.978188, -0.197951, 0.0724739, -0.970901, -0.228251, 0.342393, -0.788767, -0.510503, 0.139081, -0.979936, -0.142768, -0.0601158, 0.953136, 0.296511, -0.135611, 0.943483, 0.302407, -0.102481, 0.988484, 0.111343, -0.494271, 0.840222, 0.222986, -0.175729, 0.913099, -0.367926, -0.103592, 0.894725, -0.434439, 0.838199, 0.358269, 0.411176, 0.851117, 0.359339, 0.382721, 0.710006, 0.584773, 0.392341, 0.557701, 0.685671, 0.467787, -0.0899116, 0.950294, 0.298088, -0.25878, -0.961016, 0.0973759, 0.0528687, 0.998238, 0.0269409, -0.699943, 0.714177, 0.00558873, -0.451713, 0.88546, -0.109155, -0.665589, 0.738255, -0.109417, 0.115604, 0.96464, -0.236867, -0.428379, 0.86027, 0.276454, -0.229923, -0.966071, 0.117651, -0.189704, -0.907604, -0.374523, -0.0437677, -0.953001, -0.299789, -0.239889, 0.926959, 0.288444, -0.116498, 0.893445, 0.433802, -0.564581, 0.597713, -0.5692, -0.147689, 0.967486, 0.205328, -0.469304, 0.871863, -0.140028, 0.0347248, -0.972334, -0.230998, -0.0288427, 0.158628, -0.986917, -0.931318, 0.292738, -0.216684, -0.98945, -0.142142, 0.0279991, -0.708247, 0.292921, -0.642326, -0.244161, 0.85657, 0.454614, 0.637777, -0.609248, -0.47123, -0.203332, 0.97435, -0.0964275, 0.0782022, 0.759269, -0.646061, -0.144391, 0.586918, 0.796667, 0.695407, 0.495394, -0.52057, 0.624754, 0.470944, -0.622811, 0.395412, 0.859019, -0.325169, 0.150117, 0.966219, 0.209488, 0.152327, 0.988018, -0.024848, -0.0538496, 0.989448, -0.134511, -0.964188, 0.172522, -0.201436, -0.717502, 0.694452, 0.0540985, 0.548306, -0.836277, 0.00152809, 0.258761, -0.95461, 0.147523, 0.364459, -0.913524, 0.180678, 0.123124, 0.965303, -0.230283, -0.127879, 0.941667, -0.311304, -0.295322, 0.953905, 0.0533783, -0.308915, 0.948598, 0.0688077, -0.294339, 0.955322, 0.0269067, -0.496667, 0.839348, 0.220947, -0.493767, 0.840406, 0.22341, 0.0626281, 0.997278, 0.0389214, 0.0122103, 0.595676, 0.803132, -0.178725, 0.773748, 0.607759, 0.110398, 0.785079, 0.609477, 0.0123062, 0.861255, 0.508024, 0.0598181, 0.823242, 0.56453, 0.122291, 0.0770503, -0.989499, -0.442599, 0.877573, 0.184314, 0.0894652, 0.952898, 0.289795, 0.197808, 0.277151, -0.940244, 0.185949, 0.169338, -0.967857, 0.0452865, 0.506008, -0.861339, 0.238564, 0.420679, -0.875281, -0.0524886, 0.861247, -0.505468, -0.458776, 0.868757, -0.186507, -0.293885, 0.913604, -0.280997, -0.407877, 0.889635, 0.205393, -0.23304, 0.934644, 0.268577, -0.0350593, 0.933896, 0.355823, -0.570592, 0.817185, 0.0814472, -0.657181, 0.752555, 0.0421139, -0.0925341, 0.958764, 0.268719, -0.815642, 0.562818, -0.134028, -0.988148, -0.0295003, 0.150642, -0.962387, -0.271652, -0.00399868, 0.180473, 0.908898, 0.375944, -0.170833, 0.942743, 0.286447, -0.0495918, 0.932605, 0.357476, 0.231567, 0.852491, 0.468653, -0.337284, -0.858387, 0.386538, 0.307595, 0.808326, 0.50199, -0.151517, 0.897176, -0.41487, 0.0379021, 0.862789, 0.504142, -0.458955, 0.874091, 0.159142, -0.214739, 0.952293, 0.216855, -0.156727, 0.873966, 0.460023, 0.923678, 0.366555, -0.111614, 0.868517, 0.483709, -0.108184, 0.951374, 0.307935, -0.00799476, -0.905798, -0.117186, -0.407182, -0.952077, -0.0457757, -0.302414, -0.949475, -0.190425, -0.249471, -0.442781, 0.881445, 0.164318, -0.431804, 0.88532, 0.172493, -0.237757, 0.936127, 0.259109, -0.16882, 0.944304, 0.282472, 0.0576116, 0.931465, 0.359241, 0.0386126, 0.956251, 0.289987, -0.218812, 0.56807, 0.793359, 0.0922616, 0.834529, 0.543184, 0.00909293, 0.847003, 0.531511, -0.0558647, -0.929607, -0.364295, -0.71263, -0.659888, -0.238132, -0.230904, 0.972763, -0.0203913, 0.101814, 0.613558, 0.783059, -0.251949, -0.908341, -0.333825, -0.471312, -0.830388, -0.297187, -0.313859, 0.949261, 0.019911, -0.0828437, 0.728328, 0.680202, 0.12776, 0.440832, 0.888451, 0.0629762, 0.567088, -0.821246, -0.739459, 0.460245, -0.491299, -0.767122, 0.474978, -0.431184, -0.733737, 0.46489, -0.495486, 0.0198484, 0.921127, 0.388755, -0.156656, 0.949892, 0.270488, -0.140606, 0.935528, 0.324064, -0.157439, 0.949457, 0.27156, -0.56519, 0.772985, 0.288192, -0.588839, 0.80813, -0.0139262, -0.46999, 0.721494, 0.508484, 0.163322, 0.822774, 0.544398, 0.0677988, 0.889305, 0.452261, -0.0201538, 0.888907, 0.457644, -0.432554, -0.772854, -0.464321, -0.133997, 0.701738, 0.699721, -0.520822, 0.838029, 0.162641, 0.281713, 0.946333, 0.158403, 0.144995, 0.967489, 0.207221, -0.29307, 0.919704, 0.261254, -0.221255, 0.924416, 0.310647, -0.205486, 0.919947, 0.333875, -0.204974, -0.863017, -0.461722, 0.231212, 0.910461, 0.342932, -0.141404, 0.921113, -0.362705, -0.00933338, 0.781731, -0.623546, -0.0855952, 0.863937, -0.496272, -0.404457, 0.893526, 0.194999, -0.504309, 0.846663, 0.169804, -0.316073, -0.89881, -0.303707, -0.501805, -0.75632, -0.419728, -0.541709, 0.822916, 0.171348, -0.16641, 0.944327, 0.283822, -0.2765, 0.930601, 0.239853, -0.473973, 0.866695, 0.155532, -0.594114, 0.796117, -0.115002, -0.659983, 0.601586, -0.450018, -0.60428, 0.760943, -0.236243, -0.515213, 0.852832, -0.0850438, -0.0291505, 0.503641, 0.863421, -0.169423, 0.85812, 0.484691, -0.396013, 0.896205, 0.199977, -0.296462, 0.913695, 0.277978, 0.157361, 0.970483, 0.182759, -0.429134, 0.885214, 0.179557, -0.423739, 0.88665, 0.185192, -0.428802, 0.890147, 0.15417, -0.231237, 0.9539, 0.191324, -0.722834, 0.681261, 0.115733, 0.0607756, 0.97118, 0.230469, -0.319235, 0.941272, 0.109984, -0.121883, 0.933435, 0.337407, 0.0217074, 0.123964, -0.992049, 0.128921, 0.979251, 0.156355, 0.00908208, 0.985098, 0.171753, -0.0796058, 0.910617, 0.405512, -0.00401124, 0.913086, 0.407746, -0.198931, 0.901387, 0.384614, -0.220239, 0.911936, 0.34622, -0.30493, 0.911361, 0.276477, 0.146803, 0.952118, 0.268179, -0.298327, 0.942812, 0.148685, -0.702805, 0.3462, -0.621459, -0.873643, 0.22742, -0.43015, -0.875396, 0.3208, -0.361621, -0.980275, 0.0840077, -0.178897, -0.984438, 0.0946675, -0.148051, -0.944576, 0.227319, -0.236859, -0.741861, -0.383597, -0.549996, -0.700837, -0.59924, -0.386961, -0.461506, -0.875084, -0.14574, -0.471398, 0.434003, 0.76774, 0.516569, 0.696164, -0.49851, 0.507029, 0.798618, -0.324239, -0.128899, 0.895912, 0.42512, 0.0341039, 0.853117, 0.520603, -0.563628, 0.820719, 0.093514, -0.058166, 0.0682288, -0.995973, 0.375895, 0.925957, 0.0361395, -0.134874, 0.961218, 0.24056, 0.0113846, 0.844757, 0.535029, 0.222162, 0.742347, 0.632112, -0.207192, 0.920982, 0.329946, 0.232873, 0.417875, 0.878152, -0.490126, 0.868317, -0.0761742, -0.660098, 0.751171, 0.0035652, -0.74832, 0.654837, -0.105861, -0.837646, -0.427807, -0.339604, -0.839139, 0.285125, -0.463195, -0.390523, 0.610135, -0.689368, -0.33635, 0.277244, -0.900002, -0.213689, 0.35811, -0.908897, -0.202756, 0.933369, 0.296162, -0.0575508, 0.934004, 0.352597, 0.293636, 0.947706, -0.125024, 0.359278, 0.933006, -0.0204763, 0.415938, 0.899051, -0.136758, 0.0631234, 0.919293, 0.38848, 0.0669963, 0.880245, 0.469767, 0.340926, 0.623949, 0.703176, 0.277469, 0.718866, 0.637371, -0.703564, -0.624677, -0.338788, -0.460212, -0.786275, -0.412282, 0.44441, -0.126474, -0.88685, 0.336149, 0.302713, -0.891834, 0.0851095, 0.900773, 0.425869, 0.208377, 0.842093, -0.497452, 0.720673, 0.591433, -0.361714, 0.727871, 0.408597, -0.550683, -0.911732, -0.404568, 0.0712024, -0.814024, -0.580267, -0.0256086, -0.870449, -0.487342, 0.0693999, 0.177652, 0.962152, 0.206646, 0.256587, 0.936211, 0.240152, -0.22183, 0.305695, 0.925928, -0.251109, 0.641654, 0.724724, 0.0247797, 0.269386, 0.962714, -0.369601, 0.896131, 0.245651, -0.424354, 0.905449, 0.00920637, -0.425826, 0.869934, 0.24877, -0.36771, 0.924968, 0.0960415, -0.849495, -0.498596, 0.172509, -0.921144, -0.360059, 0.147821, -0.684867, -0.673761, 0.277494, 0.0263506, 0.919567, 0.392048, 0.707514, -0.292831, 0.643175, -0.927708, -0.367722, 0.0643278, -0.414379, -0.834391, -0.36343, -0.609158, -0.745695, -0.269935, -0.632233, -0.743275, -0.218687, -0.39945, 0.578071, -0.71153, -0.448631, 0.753223, -0.481025, -0.382414, 0.70853, -0.59308, -0.605933, 0.788882, 0.102519, -0.455305, 0.867688, 0.199538, -0.584553, 0.80478, 0.103086, -0.430468, 0.888853, 0.156962, -0.688016, 0.717969, 0.105614, -0.140921, 0.980194, 0.139145, -0.0919199, 0.987147, 0.130738, -0.578365, 0.814158, -0.0513862, -0.436269, 0.889764, 0.134123, -0.588401, 0.762728, -0.268386, -0.306924, 0.659455, 0.686234, -0.400433, 0.756011, -0.517784, -0.195707, 0.926512, 0.321362, -0.334693, 0.90325, 0.268551, -0.495294, 0.801287, 0.335593, -0.488893, 0.81208, 0.318606, 0.760602, 0.624843, -0.176226, -0.630289, 0.761549, 0.150927, -0.560553, 0.581055, -0.590047, -0.346421, 0.938013, -0.0111364, -0.560512, -0.805485, -0.192407, -0.663321, -0.74256, -0.0927939, -0.0121639, 0.936128, 0.351448, 0.514496, -0.592327, 0.620035, -0.442348, 0.879179, 0.177124, -0.552179, 0.290944, -0.781313, -0.659832, 0.384761, -0.64543, -0.58601, 0.426015, -0.689277, -0.645994, -0.747561, -0.154414, -0.283825, -0.95179, -0.116355, -0.632787, -0.774142, -0.0168846, -0.079391, 0.785336, 0.613959, -0.774879, 0.622381, -0.110473, -0.380913, 0.895669, 0.229526, -0.758145, 0.63558, -0.145786, -0.217574, 0.915959, 0.337164, 0.140854, 0.809823, 0.569514, -0.463848, 0.833213, 0.301, -0.594636, 0.788338, 0.157894, -0.257738, 0.860597, 0.439253, -0.0888222, -0.102268, 0.990783, -0.345754, -0.0926319, 0.933742, 0.0248174, -0.574372, 0.818218, -0.87686, 0.391923, -0.278411, -0.917346, 0.0380274, -0.39627, 0.277374, 0.859054, -0.430221, -0.317876, 0.94143, 0.112534, -0.409977, 0.892787, 0.186682, -0.431166, 0.873316, 0.226748, -0.599606, 0.626182, 0.498367, 0.085362, 0.862214, -0.499301, -0.416233, 0.895241, -0.159038, -0.351777, 0.486994, -0.799431, -0.331073, 0.924564, 0.188605, 0.431243, 0.887234, 0.163845, 0.555668, 0.817731, 0.150162, -0.0656629, 0.85669, 0.511636, 0.0494405, 0.944503, 0.32476, 0.678229, 0.732464, 0.0591703, -0.456718, 0.798129, 0.392937, -0.283249, 0.943538, 0.171775, -0.317089, 0.82721, 0.463873, 0.29043, -0.454247, 0.842206, 0.417902, -0.764762, 0.490405, 0.491639, -0.664821, 0.562409, 0.429662, -0.527242, 0.73308, -0.103751, 0.988611, 0.109011, -0.747234, -0.663411, -0.0390892, -0.573228, 0.790856, -0.214374, -0.568015, 0.751967, -0.334523, -0.629572, 0.642108, -0.43742, -0.345439, 0.907046, 0.240706, -0.258726, 0.956161, 0.137179, -0.222489, 0.957539, 0.183352, -0.132107, 0.97869, 0.157204, 0.739728, 0.65065, 0.171629, -0.378209, 0.918726, 0.113581, -0.322379, 0.942541, -0.0876778, 0.386228, -0.845843, 0.367938, 0.539376, -0.803026, 0.253423, 0.363893, -0.264458, 0.893109, 0.50493, -0.165073, 0.847229, -0.626352, 0.773282, 0.0985854, -0.480474, 0.861636, 0.163485, -0.609178, 0.783298, 0.12388, -0.30843, 0.852578, 0.421879, -0.270527, 0.764881, 0.584614, -0.387929, 0.907847, 0.159138, -0.365661, 0.927611, 0.0763557, -0.951246, -0.000707751, -0.308431, -0.339298, 0.93527, 0.100732, -0.265301, 0.955187, 0.131273, 0.75881, 0.639764, 0.122105, -0.489423, 0.14938, 0.859157, -0.552551, 0.056867, 0.831537, -0.557189, 0.366531, 0.745114, -0.166733, 0.843315, 0.510902, 0.6182, 0.684482, 0.386412, -0.482143, 0.832547, 0.272772, -0.260189, 0.928246, -0.26582, -0.205295, 0.634587, 0.745086, 0.301369, -0.596906, -0.743559, -0.552315, 0.59243, 0.586494, -0.43289, 0.746193, 0.505769, -0.321803, 0.877566, 0.355417, 0.763474, -0.645834, 0.00230588, 0.683827, -0.642656, -0.345506, 0.34619, -0.129561, -0.929175, -0.64352, 0.763209, -0.0582516, -0.64688, 0.762507, -0.0113263, -0.235266, 0.957555, -0.166546, 0.449435, -0.876427, -0.172873, 0.37897, -0.491631, -0.784016, -0.439217, 0.873829, 0.208592, -0.423314, 0.683594, 0.594562, -0.772491, 0.215336, 0.597401, -0.531431, 0.66513, 0.524579, -0.526757, 0.542299, 0.654553, -0.352503, 0.913246, 0.204264, -0.799014, 0.579863, 0.159174, -0.821787, 0.501412, 0.270649, -0.790965, 0.521394, 0.32019, -0.806638, 0.511726, 0.295756, 0.461437, 0.145761, 0.875117, 0.340731, 0.305519, 0.889135, -0.819517, -0.544368, -0.179043, 0.0575095, 0.31522, 0.947275, 0.180023, 0.300124, 0.936759, 0.579, -0.714315, -0.393081, -0.796056, 0.59486, 0.111513, -0.94625, 0.31967, 0.0492233, -0.950131, 0.287492, 0.120826, -0.949616, 0.249323, 0.189916, -0.868975, 0.461056, 0.179749, -0.356379, 0.905738, 0.229418, 0.975424, -0.213811, -0.0532316, 0.992606, 0.058495, -0.106357, 0.931192, -0.364466, 0.0068406, -0.976243, -0.140756, 0.164732, -0.952061, 0.241114, -0.188268, -0.983698, 0.0731496, -0.164276, 0.931348, -0.364053, 0.00757037, 0.999679, -0.0243673, -0.00692474, 0.957929, -0.28589, -0.0252655, 0.945985, -0.322676, -0.0315167, 0.996121, 0.0795229, -0.0376611, 0.997083, -0.071771, 0.0259754, 0.977492, -0.178027, 0.113211, -0.529369, 0.661226, 0.531552, -0.845352, 0.327811, 0.421805, 0.705965, -0.653974, 0.271902, -0.734022, -0.615662, -0.286659, 0.813618, -0.581399, -0.000208167, 0.934239, -0.337516, -0.11524, -0.803396, 0.565617, 0.186099, -0.394808, 0.843238, -0.364796, -0.98635, -0.144802, -0.0784004, 0.264414, -0.0106402, 0.96435, -0.837045, 0.195532, 0.511001, 0.0144785, -0.519621, -0.854274, 0.71062, -0.0933773, -0.697352, 0.180237, -0.310407, -0.933361, 0.857287, -0.0871302, -0.507412, 0.984411, 0.155312, -0.0825351, 0.885099, -0.359385, -0.295705, -0.551648, -0.799345, -0.238184, 0.800524, 0.25466, 0.542503, 0.794645, 0.249861, 0.553271, 0.197409, 0.0706468, 0.977772, 0.206594, 0.177195, 0.962248, 0.789709, 0.24589, 0.562048, 0.699211, 0.179101, 0.692118, -0.279277, 0.403755, 0.871198, -0.874434, 0.421218, -0.240707, -0.939212, 0.343087, -0.0130833, -0.97039, 0.218759, -0.102409, 0.829407, -0.012034, 0.558516, -0.675031, -0.717873, -0.170271, 0.758532, -0.168789, 0.629396, 0.574362, -0.0600765, 0.816394, 0.467201, -0.0126517, 0.884061, 0.1436, -0.621752, -0.769937, -0.638391, 0.183274, 0.747574, -0.403131, 0.133202, 0.905396, -0.409955, 0.28406, 0.866745, 0.33827, -0.728114, -0.596173, 0.515052, -0.658683, -0.548506, 0.716039, -0.484778, -0.502274, 0.596446, -0.611177, -0.520303, -0.307649, 0.458686, 0.833642, -0.353983, 0.907412, 0.226496, -0.399431, 0.910169, 0.109762, -0.472247, 0.651627, 0.593603, -0.402356, -0.841425, -0.360714, -0.753086, 0.649542, -0.104678, -0.276859, 0.931933, 0.234202, 0.882895, 0.334171, 0.329889, 0.0539184, 0.408826, -0.911018, -0.403587, 0.149256, -0.902685, 0.785952, 0.0379789, 0.61712, -0.809172, 0.20803, 0.549513, -0.255154, 0.525997, 0.811309, -0.459593, 0.816766, 0.34881, -0.467318, 0.546576, 0.694888, 0.666985, -0.655032, 0.355056, 0.48683, -0.755313, 0.438747, -0.482941, 0.872927, 0.0690437, -0.351938, 0.915453, 0.195154, 0.152067, 0.424158, 0.892729, -0.618804, 0.778144, -0.10758, -0.823232, 0.566163, -0.0418197, 0.113349, 0.211976, 0.970679, -0.177974, 0.617974, -0.765789, 0.413533, 0.0333816, 0.909877, 0.742214, 0.0324859, 0.669375, 0.90227, -0.278395, 0.329249, -0.450874, 0.819805, 0.353035, -0.613846, 0.264943, 0.743639, 0.818704, -0.409292, -0.402744, 0.811457, -0.527219, -0.252146, 0.872422, 0.482436, -0.0783287, 0.671952, 0.713893, -0.197075, 0.819292, -0.225504, 0.527171, -0.819748, -0.39936, -0.410518, -0.90051, -0.263788, -0.345685, 0.108206, -0.196285, 0.974558, 0.210456, -0.137408, 0.967898, 0.332163, 0.1597, 0.929604, 0.0687094, 0.882753, 0.464785, 0.0314416, 0.572549, 0.819267, 0.411564, -0.0122706, 0.911298, 0.14224, 0.920548, 0.363813, 0.342465, 0.862312, 0.37301, 0.16783, 0.933941, 0.315573, 0.224369, 0.36934, -0.901802, -0.0688365, 0.666264, 0.742532, 0.641978, 0.0208115, 0.766441, -0.985425, -0.111887, -0.128133, 0.929738, -0.214551, 0.299259, 0.899726, -0.307356, 0.309881, 0.919637, -0.253517, 0.299994, 0.563697, 0.0123136, 0.82589, -0.689608, -0.642521, -0.334077, -0.509069, -0.793615, -0.333202, -0.560935, 0.790655, 0.245391, -0.270094, 0.653448, -0.707145, -0.344125, 0.82392, -0.450259, -0.213047, 0.695173, -0.686546, 0.0724408, -0.366798, 0.927476, -0.572749, 0.797977, 0.187593, 0.0955507, 0.930529, 0.353534, 0.184756, 0.914546, 0.35982, -0.850663, 0.517231, -0.0940453, -0.578928, 0.784638, 0.221776, -0.0623256, 0.558886, -0.826899, 0.518633, 0.00761907, 0.854963, 0.847515, 0.29623, 0.440417, -0.615759, 0.759502, 0.209755, -0.386016, 0.744711, 0.544424, 0.804669, 0.258111, 0.534683, 0.802449, 0.256272, 0.538888, -0.959429, 0.276601, -0.0546578, -0.965536, 0.222313, 0.135338, -0.382311, 0.909218, 0.164807, -0.489809, 0.810589, 0.320989, 0.218309, 0.634885, 0.741122, -0.883183, 0.444448, 0.149848, -0.97095, -0.135535, -0.197196, 0.0422759, 0.0475972, 0.997972, -0.619717, 0.772979, 0.135848, -0.578997, 0.770832, 0.265669, -0.669351, 0.68831, 0.279638, -0.675577, -0.736202, 0.0400288, -0.84575, -0.529879, 0.0627261, -0.753907, 0.631795, -0.180164, -0.811969, 0.506777, -0.289627, -0.716623, 0.692296, -0.0847291, -0.647264, 0.737656, 0.192124, -0.663912, 0.709434, 0.236483, -0.664933, 0.701196, 0.257269, -0.717095, 0.107835, 0.688583, -0.650166, 0.74021, 0.171386, -0.722845, 0.66077, 0.202185, -0.739707, 0.621384, 0.258293, -0.711316, 0.694495, 0.108192, -0.724382, 0.674789, 0.141176, -0.620514, 0.771498, 0.14055, 0.28843, 0.950122, 0.11864, -0.922152, 0.216872, -0.320317, -0.201922, 0.719847, 0.664115, -0.143601, 0.36595, -0.919488, -0.349376, 0.810471, -0.470184, -0.76935, 0.621599, 0.147358, -0.744549, 0.59775, 0.297222, 0.885005, -0.376943, -0.273277, 0.644203, -0.644542, -0.411787, -0.599907, 0.799514, 0.0298128, -0.796417, 0.510023, 0.324958, 0.523677, 0.787166, 0.325779, 0.697682, 0.701953, 0.143186, -0.597784, 0.405139, 0.691749, -0.814718, 0.552244, 0.17681, -0.804265, 0.548654, 0.228334, -0.812106, 0.508029, 0.287037, -0.755525, 0.553582, 0.350326, -0.812268, 0.575182, 0.096885, -0.826939, 0.54559, 0.136025, 0.259781, -0.412642, 0.873064, 0.382215, -0.133964, 0.914311, 0.361726, -0.220308, 0.90588, -0.858956, 0.438748, 0.263997, 0.0249727, -0.878948, -0.476263, -0.822865, 0.471889, 0.316564, 0.659011, -0.227275, 0.716973, 0.532358, -0.496115, 0.685905, 0.428288, -0.697225, 0.574845, -0.865091, 0.49304, 0.0923544, -0.759581, 0.49059, 0.427035, -0.759472, 0.490646, 0.427164, 0.191353, -0.95374, -0.231872, -0.299711, 0.93374, -0.195713, -0.899122, 0.371288, 0.231786, -0.791225, 0.472118, 0.388673, -0.809289, 0.460296, 0.364937, 0.572874, 0.782832, 0.242877, -0.889391, 0.368122, 0.271054, -0.201062, 0.719012, 0.665279, -0.264232, 0.964403, -0.01046, -0.433203, 0.869102, 0.23874, -0.525729, 0.828213, 0.194093, -0.310866, 0.472929, 0.82444, -0.452084, 0.873915, 0.178586, 0.236186, 0.861002, 0.450436, 0.519015, 0.633723, 0.573601, -0.248411, 0.24729, -0.936557, -0.918215, 0.395218, -0.0261672, -0.951091, 0.305815, -0.0436272, 0.37009, 0.82786, 0.421522, -0.376199, 0.33078, 0.865482, -0.282789, -0.66306, -0.693096, -0.188953, -0.831854, -0.521839, -0.138755, -0.790066, -0.597112, -0.374996, -0.612187, -0.696135, -0.292565, -0.721777, -0.62725, -0.104053, 0.671961, 0.73324, -0.400787, 0.892456, 0.207103, -0.101667, 0.994648, 0.0184249, -0.147945, 0.988747, 0.0221664, -0.728903, -0.565921, -0.385271, -0.71729, -0.594662, -0.363144, -0.403785, 0.627874, 0.665381, -0.339494, 0.438739, 0.832017, -0.434044, 0.900561, 0.0244069, -0.423201, 0.90576, 0.0223535, -0.268036, 0.653933, 0.70748, -0.739087, 0.541055, 0.401261, -0.426642, 0.897204, 0.114026, -0.423018, 0.900653, 0.0993991, -0.0989428, 0.939989, 0.326543, -0.649988, 0.686304, 0.326346, -0.309119, 0.931426, 0.192071, -0.263108, 0.536292, 0.801976, 0.427761, 0.815994, -0.38881, -0.796088, -0.00403655, 0.605168, -0.853902, -0.233956, 0.464883, -0.806468, -0.08368, 0.585326, -0.131288, 0.548263, -0.825936, -0.314383, 0.586893, 0.746136, -0.336569, 0.672481, 0.659159, -0.153447, 0.91384, 0.375967, -0.402553, 0.903864, 0.144849, 0.343397, 0.934389, -0.0948498, -0.123317, -0.854682, -0.504293, 0.213057, 0.961713, -0.172381, -0.326032, 0.699878, 0.63551, -0.685954, -0.712674, 0.146843, -0.419813, 0.90313, -0.0900712, 0.112877, 0.993415, -0.0196238, 0.331057, 0.942487, 0.0460374, -0.0940431, 0.837319, 0.538566, -0.0348154, 0.893124, 0.448461, 0.079735, 0.837148, 0.541134, -0.0413094, 0.921086, 0.38716, -0.341169, 0.931232, -0.128106, -0.374571, 0.826978, 0.41929, -0.0210559, 0.995645, -0.0908145, 0.0493162, 0.987036, -0.152732, -0.0310563, 0.991205, -0.128639, -0.0302339, 0.998837, -0.0375644, 0.08529, 0.989245, -0.118823, 0.0515244, 0.993792, -0.0986015, -0.0183199, 0.999682, -0.0173487, -0.245882, 0.964474, 0.0966053, -0.698032, 0.714182, 0.0519112, -0.929176, 0.358041, -0.0918612, -0.0976728, 0.867475, 0.487798, 0.0249809, 0.948787, 0.314928, -0.762319, -0.13905, 0.632088, -0.91653, 0.33703, -0.215368, 0.171047, 0.188122, -0.967137, -0.262513, -0.659507, -0.704371, 0.346529, -0.39221, -0.852109, 0.493942, 0.74516, 0.448061, -0.472813, 0.879751, -0.0498614, -0.908304, 0.376683, -0.181917, 0.351434, 0.872911, 0.338409, 0.509837, 0.797534, 0.322499, 0.166846, 0.931571, 0.323015, -0.450631, 0.892467, 0.0208518, -0.456529, 0.668379, -0.587239, 0.331057, 0.942487, 0.0460374, 0.543316, 0.799337, 0.256649, 0.0152344, 0.776496, 0.629937, 0.0933641, 0.707252, 0.70077, 0.671952, 0.713893, -0.197075, -0.817718, 0.57334, 0.0511749, -0.316849, -0.605201, -0.730301, -0.281627, -0.858497, -0.428567, -0.581188, 0.812447, -0.0463598, -0.496031, 0.865983, 0.0634537, -0.433663, 0.884787, 0.170553, 0.129625, 0.785866, 0.604658, -0.0256738, 0.991375, -0.128514, 0.188357, 0.934266, 0.302768, -0.536522, 0.84385, 0.00777159, -0.263414, 0.893645, 0.363334, -0.236628, 0.897684, 0.371714, -0.466558, 0.859811, 0.207483, -0.28157, 0.948898, -0.142517, -0.559726, 0.823149, 0.0955607, -0.636748, 0.769174, 0.0540723, 0.437616, 0.898125, -0.0431768, 0.0459009, 0.996128, 0.0749785, 0.172113, 0.833149, 0.525585, 0.32667, 0.753896, 0.570024, -0.436504, 0.882782, 0.173666, -0.581762, 0.812756, -0.0313269, -0.097021, 0.863709, 0.494564, -0.237778, 0.896907, 0.372853, -0.259993, 0.881546, 0.394057, -0.315905, 0.915426, 0.249398, -0.888549, 0.438868, 0.1337, -0.0388705, -0.824824, -0.564052, -0.193032, -0.639223, -0.744401, 0.0723899, 0.98151, -0.177193, 0.239266, 0.935808, -0.258872, 0.165119, 0.936961, -0.30796, -0.262445, 0.926129, 0.270937, -0.388285, 0.897693, 0.208283, -0.671496, 0.711684, -0.206396, -0.432246, 0.893231, 0.123701, -0.880231, 0.418357, -0.223987, -0.478365, 0.856405, -0.19426, -0.484082, 0.837314, -0.254106, 0.380907, 0.924399, 0.0199065, 0.59775, 0.799084, -0.0645049, 0.410267, 0.907579, 0.0893338, 0.51262, 0.848011, 0.134528, 0.46127, 0.884749, 0.0666941, 0.0196927, 0.806124, 0.591419, 0.600467, 0.767374, 0.22489, 0.335727, 0.921486, 0.195325, -0.655232, 0.75347, -0.0543529, -0.616322, 0.787149, 0.0233117, -0.609884, 0.792451, 0.00795451, -0.578017, 0.789689, 0.20564, 0.045793, 0.988177, 0.146318, 0.375598, 0.919214, 0.118205, 0.1871, 0.977933, 0.0929516, -0.353881, -0.880839, -0.31447, -0.187091, -0.749888, -0.634559, -0.698785, -0.691381, -0.183554, -0.234179, 0.89929, 0.369375, 0.438184, 0.894948, 0.0840411, 0.380323, 0.924256, 0.0332362, 0.660702, 0.750241, 0.0247174, 0.601113, 0.798164, -0.039965, -0.186826, 0.896985, 0.400643, -0.674714, -0.732002, 0.0945182, -0.354501, 0.926121, 0.128954, -0.00438907, 0.901702, -0.432337, -0.239576, 0.895709, 0.374577, 0.027827, 0.99244, -0.119537, -0.390529, 0.915168, -0.0997769, -0.312542, 0.922184, 0.227803, -0.194027, 0.925178, 0.32619, -0.914297, 0.404645, -0.0180063, -0.528885, -0.841799, 0.10796, -0.359047, 0.909615, 0.20901, -0.245341, 0.936293, 0.251324, -0.0568046, 0.94682, 0.316711, -0.220846, -0.647832, -0.729069, -0.231175, 0.901238, 0.366507, 0.40701, 0.910911, 0.0676999, 0.601083, 0.793496, 0.095203, -0.123891, -0.932287, -0.339842, -0.157602, -0.670046, -0.725396, -0.20015, -0.641703, -0.740377, 0.4182, -0.362118, 0.833054, -0.153521, 0.972275, -0.176386, -0.0719853, 0.883328, 0.463195, 0.116887, 0.77981, 0.615007, -0.238532, 0.907196, 0.346552, -0.283115, -0.667396, -0.688788, -0.285776, -0.665367, -0.689652, -0.334206, 0.914364, 0.228573, 0.0248823, 0.926419, 0.375672, -0.772697, 0.592952, 0.2266, -0.46439, 0.884908, 0.0357716, -0.248058, 0.923769, 0.291751, 0.430093, 0.89416, 0.124489, -0.201947, 0.93638, 0.287071, -0.0731355, 0.882651, 0.464304, -0.661301, -0.625271, -0.414388, -0.0174034, 0.634956, 0.772352, -0.205066, 0.978667, -0.0126094, -0.338729, 0.928778, 0.150446, -0.12489, 0.927943, 0.351175, -0.551547, -0.832584, 0.0509916, 0.320835, -0.466395, 0.824342, -0.27414, 0.947985, -0.161775, -0.873918, 0.484375, 0.0406074, 0.197735, 0.712009, 0.673754, 0.00447403, 0.991869, -0.127188, 0.300937, 0.176303, -0.937206, 0.441673, 0.104634, -0.891054, -0.517002, 0.845679, 0.132423, -0.0652401, 0.922374, 0.38075, -0.907466, -0.335913, -0.252326, -0.934951, -0.167891, -0.312536, 0.335276, 0.912096, 0.235946, 0.0891724, 0.749239, 0.656269, 0.16596, 0.171595, -0.971088, 0.493917, 0.853437, 0.166406, -0.599883, -0.799759, -0.0229203, -0.361293, 0.906987, 0.21643, -0.164516, 0.932271, 0.322187, -0.489581, 0.862836, 0.125791, -0.623522, 0.777217, -0.084584, -0.699537, 0.689071, -0.189286, -0.683482, 0.7231, -0.0998931, 0.30303, 0.949853, 0.0771483, 0.319614, 0.940968, 0.111475, 0.149063, 0.979443, 0.135912, -0.403326, 0.628198, 0.665354, -0.642074, 0.762124, 0.0831093, -0.408184, 0.9, 0.152926, -0.508712, 0.605006, 0.612519, -0.612649, 0.773648, -0.161644, -0.136388, 0.899897, 0.414227, -0.271179, 0.952236, -0.140388, -0.201651, 0.0383692, 0.978706, -0.210293, -0.645139, -0.734556, -0.212927, -0.645439, -0.733533, -0.588757, -0.789983, 0.171149, 0.570741, 0.799579, 0.186893, -0.323975, 0.907546, -0.267209, -0.375791, 0.921798, -0.0952375, -0.395976, 0.917998, 0.0219697, 0.0671081, 0.971629, 0.226792, 0.187102, 0.979362, 0.0764447, 0.284004, -0.161534, 0.945118, 0.152535, -0.018317, 0.988128, -0.591552, -0.79952, 0.104089, 0.506725, 0.845855, 0.166609, -0.52094, -0.849044, -0.088009, 0.317461, 0.893479, -0.317671, 0.161363, -0.949071, -0.270605, -0.887892, -0.165279, 0.429337, -0.72468, -0.469666, 0.504234, -0.670926, 0.706672, -0.224662, -0.82272, 0.514297, -0.242136, -0.59506, 0.803617, -0.0102118, 0.257513, -0.352317, -0.899755, 0.349638, -0.601627, -0.718191, 0.221098, -0.32095, -0.920927, -0.430467, 0.86383, -0.261718, -0.0203392, 0.875472, 0.48284, -0.23541, 0.909356, 0.343006, 0.5093, 0.852201, 0.119863, 0.667344, 0.744333, 0.0249269, 0.483052, 0.833406, 0.268505, -0.396059, 0.915171, -0.0748211, -0.336459, 0.913936, 0.226971, -0.756923, 0.652527, -0.0357153, -0.737829, 0.674582, -0.0234065, -0.692687, 0.721198, -0.00764748, -0.804127, 0.356204, -0.475919, -0.77909, 0.497545, -0.381402, -0.842491, 0.400458, -0.360336, -0.383346, 0.913496, -0.136275, -0.396019, 0.880132, -0.261794, -0.788648, 0.458923, -0.409175, -0.717999, 0.626399, -0.303483, -0.765622, 0.387044, -0.513828, -0.976937, 0.197762, -0.0805229, -0.916589, 0.367382, -0.157782, -0.883522, 0.421754, -0.203748, -0.931218, 0.217047, -0.292786, -0.946541, 0.29988, -0.118879, -0.718523, 0.617845, -0.319362, -0.739233, 0.671007, -0.0572964, -0.556854, 0.823631, 0.107449, -0.395158, 0.913221, -0.0993865, -0.627722, -0.724974, 0.283511, -0.525484, -0.837318, 0.150882, -0.543064, -0.822279, 0.170115, -0.454425, 0.88952, -0.047462, -0.410489, 0.855428, 0.315819, -0.371395, 0.926623, 0.0586163, -0.396183, 0.901699, 0.173141, -0.00654345, 0.976539, -0.215243, -0.13663, 0.818315, -0.558294, -0.289986, 0.878312, -0.380101, -0.617209, 0.753334, -0.227025, -0.485981, 0.758032, 0.434982, -0.274875, 0.925558, -0.260357, -0.496279, 0.791654, 0.356358, 0.388729, -0.763722, -0.515382, 0.368712, -0.798497, -0.475872, 0.145459, -0.956896, -0.251382, -0.5375, 0.791004, 0.292242, -0.491057, 0.757369, 0.430413, -0.046117, 0.835781, -0.547122, -0.133938, 0.847659, -0.513357, -0.0135721, 0.9748, 0.222666, -0.497433, 0.851085, 0.167975, -0.368092, -0.527512, 0.765663, 0.42401, -0.76309, -0.48776, 0.437662, -0.757444, -0.48449, -0.498917, 0.758104, 0.419953, -0.235869, 0.912459, 0.334342, -0.203949, 0.95462, -0.217038, -0.436161, 0.762516, 0.477842, -0.536401, 0.741943, 0.402237, 0.414274, -0.795263, -0.442645, 0.496604, -0.73842, -0.456202, -0.413247, 0.903333, 0.114958, 0.344091, -0.830591, -0.43786, -0.960256, 0.160154, -0.228604, 0.67742, 0.627547, 0.38378, -0.405158, 0.59977, -0.690016, -0.0819561, 0.924848, 0.371403, -0.843249, 0.531557, -0.0798588, -0.807984, 0.583624, -0.0809004, -0.714499, -0.655618, 0.244245, -0.689076, -0.695597, 0.203272, 0.568168, -0.319598, -0.758315, 0.207937, -0.727651, -0.653672, 0.484449, -0.524312, -0.70029, 0.0871046, 0.90405, -0.418457, -0.589432, 0.640861, -0.4918, -0.473033, 0.755825, -0.452735, -0.671433, 0.473912, -0.569724, 0.926011, -0.135229, 0.352444, 0.91076, -0.141205, 0.388043, 0.844295, -0.218992, 0.48909, 0.549357, -0.0560317, 0.833707, 0.400879, -0.083963, 0.912275, 0.280941, 0.108108, 0.953617, -0.82818, 0.306821, -0.46902, -0.65992, 0.668825, -0.342314, -0.377864, 0.924724, 0.0458738, -0.365363, 0.930722, 0.0163334, -0.29732, 0.932675, -0.204253, -0.21056, 0.819434, -0.533096, -0.360608, 0.930888, -0.0583989, -0.601889, 0.796197, 0.0616474, -0.595812, 0.800878, 0.0600139, -0.378023, 0.922618, 0.0766483, -0.343456, 0.937569, -0.0547961, -0.278676, 0.426411, -0.860531, -0.178571, 0.47316, -0.862689, -0.134117, 0.639946, -0.756625, 0.49521, -0.76692, -0.408166, -0.518568, 0.771408, 0.368806, -0.264533, 0.341338, -0.901948, -0.820142, 0.544044, -0.177151, -0.790257, 0.549798, -0.270586, -0.757716, 0.594876, -0.268307, -0.765089, 0.60405, -0.223075, -0.351992, 0.935644, -0.0259267, -0.231885, 0.924808, -0.301596, -0.135924, 0.763756, -0.631032, 0.0963727, 0.945356, -0.311471, 0.578576, 0.779128, -0.241265, -0.330518, 0.942808, -0.0432559, -0.18914, 0.857042, -0.479275, 0.268939, -0.873168, -0.406508, -0.368251, 0.924767, 0.095901, -0.295205, 0.950084, -0.100965, -0.316069, 0.945035, -0.0837256, -0.159664, 0.393597, -0.905311, 0.215238, -0.866218, -0.450932, -0.296598, 0.954242, -0.0381147, -0.792563, 0.29173, -0.535479, -0.677767, 0.713497, -0.177636, -0.267662, 0.947201, -0.176543, -0.313753, 0.947525, -0.0612765, 0.085157, 0.93547, -0.342993, -0.329893, 0.94243, 0.0547296, 0.0207198, 0.900348, -0.434677, 0.12438, 0.892387, -0.433791, -0.0114696, 0.952605, -0.303995, 0.196973, 0.839199, -0.506899, -0.162247, -0.826554, 0.538966, -0.176135, -0.826303, 0.534977, -0.107463, -0.888579, 0.445959, -0.235362, 0.955564, -0.177488, -0.545472, 0.832797, 0.0943889, -0.575664, -0.763903, -0.291656, -0.550164, -0.828678, -0.103013, -0.525655, 0.792028, 0.310449, -0.257302, 0.960493, -0.106058, -0.34229, 0.833952, 0.432853, 0.746342, 0.0229336, -0.665167, 0.501979, -0.449356, -0.738983, 0.507679, 0.0486398, -0.860172, -0.225685, 0.961599, 0.156187, -0.295454, 0.934098, 0.200421, -0.920513, 0.389063, -0.0358507, -0.953005, 0.280213, -0.115158, 0.192377, 0.895531, -0.401268, 0.226152, 0.848377, -0.478656, 0.323023, 0.785802, -0.52742, 0.141969, -0.737609, 0.660134, -0.403972, -0.477898, 0.780013, -0.309656, 0.947755, -0.0766439, -0.17932, -0.745576, 0.641842, 0.458913, -0.69785, -0.549913, 0.134719, -0.772436, -0.620639, -0.257925, 0.893371, -0.367918, 0.236707, 0.879008, -0.413903, -0.368162, 0.92971, -0.00979939, 0.241684, 0.912262, -0.330707, -0.706568, -0.588239, -0.393366, -0.467314, -0.774009, -0.427233, -0.633454, -0.667014, -0.392209, 0.201253, 0.925637, -0.32046, -0.418946, 0.736319, 0.531336, -0.482933, 0.830739, 0.276856, -0.737532, -0.605352, -0.299323, -0.324039, -0.783859, 0.529682, -0.331153, -0.788856, 0.51773, -0.166092, -0.879456, 0.446061, 0.0562785, -0.770731, 0.634671, -0.361074, -0.523637, 0.771641, -0.203791, 0.956746, -0.207621, -0.0676168, 0.894447, 0.442033, -0.524632, -0.788472, -0.321052, -0.241402, 0.959276, 0.146677, -0.150669, -0.882807, 0.444917, 0.0540214, 0.941982, -0.331286, -0.620421, 0.782253, 0.0561967, -0.49998, 0.851405, 0.158525, -0.435125, 0.824538, -0.361668, -0.576056, 0.769597, 0.275463, -0.590439, 0.759557, 0.272866, 0.347989, 0.842956, -0.410279, 0.378183, 0.823699, -0.42249, -0.19206, 0.965013, -0.1785, -0.771792, 0.635027, 0.03283, -0.767373, 0.6412, 0.00107096, -0.765726, 0.643153, 0.00420953, -0.939196, 0.00787696, -0.34329, 0.678801, 0.629215, 0.378574, -0.552868, 0.799748, 0.233966, -0.505818, 0.833446, 0.22252, -0.666754, 0.688286, 0.285835, -0.775583, 0.624153, -0.0943582, -0.108828, 0.993813, -0.0221855, 0.22844, 0.973551, -0.00361322, 0.253769, 0.912208, -0.321681, 0.208483, 0.931042, -0.299493, -0.308744, -0.821699, 0.47905, -0.0628236, -0.775092, 0.628717, 0.200575, 0.888594, -0.412516, -0.63941, 0.765658, -0.0701554, -0.558387, 0.603013, -0.569719, -0.489577, 0.58702, -0.644765, -0.565014, -0.787751, -0.245373, 0.270066, 0.945538, 0.181721, -0.553383, -0.82229, -0.13269, -0.739387, 0.673101, 0.0155378, -0.785527, 0.617743, -0.0366084, 0.9759, -0.218192, 0.00344104, -0.348592, 0.920608, 0.175966, -0.0373244, -0.74802, 0.662625, 0.00212965, 0.903426, -0.428739, -0.352993, 0.919242, 0.174326, -0.244311, 0.960978, 0.129746, -0.226263, 0.973735, 0.0254012, -0.825299, 0.421795, -0.375461, -0.428407, 0.37539, -0.821918, 0.808961, -0.321705, -0.492024, 0.513076, -0.705006, -0.489611, -0.772903, -0.600976, -0.203592, 0.217802, 0.930459, -0.294633, -0.34241, -0.858086, 0.382681, -0.947317, 0.319681, -0.0198697, -0.0404307, 0.417288, 0.907874, -0.0930025, 0.43853, 0.893891, -0.150409, 0.517074, 0.842622, -0.182988, 0.965503, 0.185253, -0.921521, -0.372787, -0.108756, -0.068985, 0.995777, 0.0605694, -0.0112642, 0.998692, 0.0498642, 0.047249, 0.998631, -0.0224246, 0.162634, 0.984333, -0.0681129, 0.348229, -0.612886, -0.7093, -0.502874, 0.703177, -0.502653, -0.687769, 0.642556, 0.33778, -0.584151, 0.755989, 0.295379, -0.837368, 0.320187, 0.443052, -0.131804, 0.98259, 0.130935, -0.244311, 0.960978, 0.129746, -0.15272, 0.98261, 0.105611, -0.068985, 0.995777, 0.0605694, 0.211351, 0.977208, -0.0198669, 0.269548, 0.962666, -0.0248675, -0.0782841, 0.996535, 0.0281108, -0.74954, 0.47655, -0.459445, -0.117543, 0.987481, 0.105187, -0.0112642, 0.998692, 0.0498642, -0.920897, 0.113909, -0.372792, -0.888153, 0.409728, -0.208102, -0.0782841, 0.996535, 0.0281108, -0.131804, 0.98259, 0.130935, -0.348592, 0.920608, 0.175966, -0.44985, 0.668029, 0.592767, -0.386477, 0.912604, 0.13338, -0.486623, 0.867754, 0.100996, -0.604508, 0.792616, -0.079557, -0.61714, 0.784993, -0.0540717, -0.409186, 0.894037, 0.182385, 0.128025, 0.991044, 0.0379705, 0.149526, 0.985441, -0.0809242, -0.853408, 0.51635, -0.0712647, -0.687769, 0.642556, 0.33778, -0.383448, 0.888914, 0.250601, -0.186752, 0.967009, 0.173253, -0.640005, 0.766157, -0.0582812, -0.545036, 0.836416, 0.0578237, 0.253016, 0.967204, 0.0223495, 0.968688, -0.24306, 0.0506539, 0.915309, -0.395457, -0.0763051, 0.96499, -0.204888, 0.163754, -0.617615, -0.000361923, 0.78648, -0.514462, 0.82733, -0.225508, 0.111044, 0.984608, 0.134968, -0.666823, 0.622666, -0.409431, -0.599589, 0.625134, -0.4997, -0.498497, 0.674875, -0.5441, -0.28888, 0.942743, 0.166684, -0.0739412, 0.992591, 0.096413, -0.535408, 0.00740763, 0.844561, -0.708429, 0.523012, -0.473906, -0.660037, 0.503169, -0.557828, -0.845788, 0.254355, -0.468984, -0.527163, 0.821872, -0.215929, -0.709341, 0.702474, -0.0580143, -0.181905, 0.979888, 0.0820387, -0.154142, 0.978183, 0.139278, -0.311018, 0.939354, 0.144509, -0.655748, 0.713186, 0.247709, -0.233924, 0.959238, 0.158564, -0.674136, 0.635878, -0.375766, 0.0699696, 0.988458, 0.134367, -0.345409, -0.930593, 0.121197, -0.377567, 0.906676, 0.188099, -0.364023, 0.912876, 0.184782, 0.00327566, 0.993244, 0.115998, 0.218289, 0.974117, 0.0586971, 0.386479, 0.921508, 0.038176, 0.391708, 0.919567, -0.0310098, -0.671136, -0.697736, 0.250481, -0.345101, -0.930618, 0.121883, -0.676909, -0.667328, 0.310592, -0.924364, 0.215926, -0.314527, -0.658135, 0.692633, 0.295159, -0.649796, 0.704967, 0.284231, -0.665793, 0.701164, 0.255126, 0.346698, 0.936411, 0.054173, -0.0242718, 0.986983, 0.158982, -0.475913, 0.849937, -0.226084, 0.259154, 0.94835, 0.182952, -0.349652, -0.892533, 0.284829, -0.818438, -0.50996, 0.264763, -0.714499, -0.655618, 0.244245, -0.689076, -0.695597, 0.203272, 0.340055, 0.930931, -0.133154, 0.210228, 0.954019, -0.213663, -0.17947, 0.979894, 0.0871739, -0.683619, 0.676856, 0.273004, -0.526693, 0.811683, 0.252519, -0.715508, 0.616619, 0.328374, -0.658575, 0.703006, 0.268442, -0.629089, 0.742833, 0.22901, -0.330654, 0.926262, 0.180848, 0.137824, 0.982345, 0.126501, -0.526885, 0.822035, -0.215988, 0.343381, 0.920216, 0.187862, -0.831709, 0.434177, 0.34605, -0.279159, -0.442587, 0.852166, -0.00382507, 0.990069, 0.140528, 0.0588635, 0.988786, 0.137249, -0.911125, 0.0354934, -0.410599, -0.988677, -0.132461, 0.0705132, -0.965046, -0.221151, -0.140637, 0.0121439, -0.834016, 0.551606, 0.192489, -0.912896, 0.359957, 0.532227, 0.835248, -0.138186, 0.648964, 0.711305, -0.269985, 0.342973, 0.938676, -0.0354482, -0.558479, -0.825702, 0.079483, -0.753767, -0.627369, 0.195559, -0.681192, -0.699433, 0.216265, -0.174053, 0.979811, 0.0983652, -0.129504, 0.971141, 0.200285, 0.137389, 0.975374, 0.172537, 0.124487, 0.981823, 0.143274, 0.350612, 0.926021, 0.139846, -0.531211, 0.843522, 0.0792762, -0.546133, 0.835388, 0.0621715, 0.568657, 0.782095, 0.254864, -0.352951, -0.886618, 0.298887, -0.405294, -0.890882, 0.205102, -0.142541, -0.983965, 0.107216, 0.432012, 0.899796, -0.0611008, 0.0765785, 0.996172, 0.042159, -0.165241, 0.97935, 0.116487, -0.452753, 0.869497, 0.197456, -0.688418, 0.722956, 0.0584466, -0.0402711, -0.38293, 0.922899, 0.235313, -0.544585, 0.805018, 0.251983, -0.560031, 0.789221, -0.610913, -0.783106, 0.116318, -0.0832429, -0.322032, 0.943062, 0.549806, 0.829345, -0.099495, -0.763109, -0.624537, 0.166186, -0.557981, -0.825926, 0.0806443, -0.525729, 0.828213, 0.194093, -0.13586, 0.975021, 0.175717, -0.188628, 0.979689, 0.0680399, -0.629126, 0.749913, 0.20453, 0.371213, 0.926541, -0.0610068, 0.696277, 0.700309, -0.157371, 0.340055, 0.930931, -0.133154, -0.422772, 0.88889, 0.176462, -0.760296, -0.625472, 0.175313, -0.165667, -0.929422, 0.329742, -0.283107, -0.75486, 0.591639, -0.247482, -0.965772, 0.0776941, 0.117382, 0.985787, 0.12019, 0.145464, 0.967092, 0.208743, -0.310068, 0.942178, 0.127112, -0.184847, 0.92275, 0.338177, -0.600672, 0.789004, -0.129094, -0.489465, 0.868386, 0.0795608, -0.740188, 0.670462, 0.051012, -0.95041, -0.0380613, -0.308661, -0.454673, 0.277991, -0.846164, -0.854775, 0.294524, -0.427334, -0.81522, 0.577623, 0.042038, -0.812162, 0.583429, 0.00155595, -0.802264, 0.596968, -0.00114362, -0.810163, 0.552818, -0.195007, -0.815616, 0.576962, 0.0434208, -0.874473, 0.484848, -0.014819, -0.691954, 0.697616, -0.185829, -0.157976, 0.959512, 0.233198, -0.29769, 0.940662, 0.162901, 0.692983, -0.0178421, 0.720733, 0.80977, 0.0652762, 0.583106, 0.695137, -0.00337482, 0.71887, 0.187967, -0.0231998, 0.981901, 0.0158504, 0.127306, 0.991737, -0.759938, 0.644153, -0.0869546, -0.846932, 0.478261, -0.232322, -0.814931, 0.544711, -0.197932, -0.900999, 0.109754, -0.419709, -0.715561, 0.593185, -0.368924, -0.560085, 0.554868, -0.615164, -0.482872, 0.733424, -0.478459, -0.504585, 0.708993, -0.492669, -0.458884, 0.794327, 0.398082, -0.860783, 0.477267, -0.176832, -0.444439, 0.877394, 0.180704, -0.340672, -0.650095, 0.679205, 0.694629, 0.383418, 0.608672, 0.332988, 0.655595, -0.677728, 0.187011, 0.83576, -0.516267, 0.280976, 0.768304, -0.575119, 0.0515582, -0.326507, -0.943788, -0.793463, 0.526496, -0.305317, -0.591564, 0.805159, -0.0420792, -0.726223, 0.622418, -0.291884, 0.946242, -0.317829, 0.0600907, 0.949456, -0.281488, 0.138916, 0.933441, -0.345652, 0.0959847, -0.945405, 0.00577891, -0.325847, -0.165124, 0.953379, 0.252591, 0.980405, -0.157731, 0.118017, 0.823293, -0.466975, -0.322681, 0.132111, -0.191799, 0.972502, 0.795478, -0.605691, 0.0187906, 0.815898, -0.29521, 0.497154, 0.761192, -0.643072, 0.0839377, 0.812285, -0.229101, 0.536383, 0.396493, -0.883726, -0.248638, 0.764312, -0.638425, -0.0907779, -0.959082, -0.126704, 0.253195, -0.999986, -0.00494693, 0.00189277, 0.824443, -0.563435, -0.0532337, -0.686067, 0.61164, -0.393964, 0.864962, -0.216338, 0.452811, -0.550667, 0.825929, -0.120855, -0.515068, 0.855141, 0.0586386, -0.391954, 0.891238, 0.228181, -0.291061, 0.951369, -0.100896, 0.10389, 0.736425, -0.668494, 0.423149, -0.750037, 0.508321, 0.218954, -0.903, 0.369662, 0.877905, -0.0592374, -0.475156, 0.765512, -0.48894, -0.418247, -0.805726, 0.310886, -0.504138, -0.943978, -0.129932, -0.303354, -0.20015, 0.922547, 0.32992, -0.613232, 0.649859, -0.449032, 0.257581, 0.82417, 0.504376, 0.861683, -0.49616, -0.106431, -0.169016, 0.949814, 0.263223, -0.843209, 0.490287, -0.220494, 0.766016, -0.524772, -0.37126, 0.766016, -0.524772, -0.37126, 0.876009, -0.307781, -0.37132, -0.0582363, 0.927384, -0.369549, -0.0787807, 0.899176, -0.430437, -0.133256, 0.903118, -0.408191, -0.024568, 0.159585, 0.986878, 0.992524, -0.0862495, 0.0863574, 0.931758, -0.36205, -0.0273347, 0.438046, 0.842604, -0.313265, 0.713598, -0.653447, -0.252558, 0.597705, -0.756194, -0.266308, 0.746494, -0.557938, -0.362563, -0.528828, 0.623118, -0.57625, -0.76839, 0.619092, -0.16218, -0.455035, 0.867937, 0.199067, 0.523156, 0.669086, -0.527855, 0.32634, 0.738999, -0.589392, 0.228523, 0.855568, -0.464522, 0.393155, 0.809763, -0.43556, -0.208688, 0.916403, 0.341547, 0.113067, 0.811621, -0.573139, -0.406593, 0.883508, 0.232584, -0.385036, 0.81947, 0.424519, -0.538867, 0.839979, -0.0636953, -0.66978, 0.621049, -0.407054, -0.438726, 0.873678, 0.210254, -0.758366, 0.625235, 0.184289, -0.38323, 0.903731, 0.190802, -0.768748, 0.49352, -0.406773, 0.877708, -0.193495, -0.438393, 0.522727, 0.594266, -0.611232, 0.491379, 0.795202, -0.355247, -0.159669, -0.822899, 0.545291, 0.921107, -0.38901, -0.0153038, 0.973076, -0.181952, 0.141483, 0.644191, -0.707266, -0.291192, 0.840841, -0.467446, -0.272912, 0.10917, 0.85083, -0.513974, -0.195477, -0.930434, 0.309968, -0.620365, 0.771762, 0.139749, 0.324546, 0.623186, -0.711553, -0.031465, 0.89706, -0.440787, -0.553694, 0.674738, -0.488007, 0.972377, -0.231005, 0.033449, 0.031627, 0.778436, -0.626927, 0.619274, -0.75346, -0.220903, -0.58952, 0.801518, 0.10017, -0.712736, 0.698933, -0.0591578, -0.545683, 0.831218, 0.106329, -0.0709771, 0.75108, -0.656385, -0.622976, 0.744596, 0.239745, 0.576299, 0.283461, -0.766505, 0.568695, 0.331604, -0.752745, 0.986264, -0.0196481, -0.164005, -0.110653, 0.865971, -0.487698, -0.204166, 0.919694, 0.335379, 0.891193, -0.450831, -0.0502677, 0.965655, -0.195501, 0.171141, 0.619274, -0.75346, -0.220903, -0.0733925, 0.629896, -0.773204, -0.214027, 0.867957, -0.448155, 0.698237, -0.143509, -0.701335, 0.782177, 0.0432818, -0.621551, -0.234085, 0.344471, -0.909145, -0.234698, 0.484135, -0.84293, -0.194046, 0.471499, -0.860253, -0.770787, 0.610354, -0.182635, -0.78212, 0.299878, -0.546225, 0.638112, -0.767602, 0.0599926, -0.818884, 0.571267, 0.0555219, -0.684818, 0.726422, -0.0577508, -0.183423, 0.382896, -0.905398, -0.250154, 0.207678, -0.945671, -0.285957, 0.811677, -0.509322, 0.0606506, 0.77012, -0.635009, -0.34841, 0.764479, -0.542386, -0.640751, 0.636516, -0.429286, -0.823542, 0.562426, 0.0738692, -0.948732, 0.150435, 0.277988, -0.908126, 0.411159, 0.0790888, -0.454077, 0.605014, -0.654043, -0.624049, 0.776598, 0.0863613, -0.718552, 0.514801, -0.467614, -0.661982, 0.749049, -0.02654, -0.590943, 0.549579, -0.59055, -0.335839, 0.764637, -0.550039, -0.29704, 0.827732, -0.476054, 0.98849, -0.124533, 0.0858982, -0.433382, 0.887137, 0.158647, -0.396999, -0.916742, 0.0444506, 0.956574, -0.225906, 0.184205, -0.6206, 0.771332, 0.141077, -0.420193, 0.447715, -0.789297, -0.71919, 0.514562, -0.466896, -0.764932, 0.495338, -0.411728, -0.583568, 0.550935, -0.596589, 0.194043, 0.98029, -0.0371302, 0.211436, 0.97606, -0.0510136, 0.391708, 0.919567, -0.0310098, 0.415938, 0.899051, -0.136758, -0.0599023, 0.98757, 0.145319, 0.353659, 0.915049, -0.193934, -0.0685962, 0.994029, 0.0848541, -0.25091, 0.951175, 0.179752, 0.10121, 0.994685, 0.0189508, 0.339636, 0.940532, 0.00688817, -0.19877, 0.928141, 0.314714, -0.0585523, 0.945815, -0.319383, 0.0191595, 0.930607, -0.365517, -0.467045, 0.875181, 0.126203, -0.75497, 0.637585, -0.153313, -0.0893652, 0.927292, 0.363515, -0.51077, 0.809563, 0.289347, -0.378265, 0.900154, 0.215961, -0.234087, 0.972023, 0.0193399, -0.301581, 0.943676, 0.136103, -0.899912, -0.0422458, -0.434021, -0.931505, -0.0218314, -0.363072, -0.21039, 0.869638, 0.446616, -0.329381, 0.92317, -0.198154, -0.0187799, 0.980654, -0.194848, -0.632439, 0.71312, 0.302458, -0.608155, 0.723224, 0.327253, -0.664037, 0.661073, 0.349338, -0.362806, 0.803507, -0.471963, -0.547785, 0.812291, -0.200289, -0.556715, 0.830059, -0.0327061, -0.505818, 0.833446, 0.22252, -0.488665, 0.841303, 0.231117, -0.666754, 0.688286, 0.285835, -0.170133, 0.93, 0.325815, 0.941484, -0.330572, 0.0657986, -0.658135, 0.692633, 0.295159, -0.00390724, 0.971072, -0.238755, -0.0903118, 0.97938, -0.180717, -0.0458529, 0.983807, -0.173266, -0.195771, 0.978158, 0.0698644, -0.537015, 0.840098, 0.0764805, -0.720041, 0.682813, 0.123723, -0.58587, 0.736248, 0.338665, -0.481519, 0.851606, -0.207138, -0.865175, 0.492854, -0.0925573, -0.878638, 0.388667, 0.27737, -0.919733, 0.0424062, 0.390246, 0.848207, -0.496401, -0.184749, 0.255978, 0.965866, -0.0397235, 0.0528687, 0.998238, 0.0269409, 0.369745, 0.927736, -0.0509422, -0.128257, 0.99105, -0.037014, 0.12259, 0.99179, -0.0363887, 0.0790598, 0.995953, 0.0427376, -0.791238, 0.446294, 0.418047, -0.6942, 0.645118, 0.319234, 0.00594062, 0.953972, -0.299835, -0.199498, 0.978795, -0.0464839, 0.541765, 0.720399, -0.433031, -0.135577, 0.986912, -0.0873178, -0.446439, 0.856211, 0.25999, -0.479299, 0.837929, 0.26105, -0.366572, 0.898133, 0.242864, -0.547056, 0.809894, -0.211662, -0.193834, 0.979765, 0.0498855, -0.555623, 0.734581, 0.389452, -0.121706, 0.923789, -0.363046, -0.447245, 0.846556, 0.288645, 0.0915581, 0.988583, -0.119668, 0.0710634, 0.988821, -0.131088, -0.896396, -0.1659, -0.411037, -0.839139, -0.382145, -0.387054, -0.112385, 0.987391, 0.111483, 0.859498, -0.475435, -0.18768, 0.489888, -0.867532, -0.0860179, 0.683827, -0.642656, -0.345506, -0.483037, 0.824449, 0.29489, -0.28888, 0.942743, 0.166684, -0.709285, 0.611219, 0.351178, -0.697787, 0.621634, 0.355899, -0.328653, 0.93442, 0.137284, -0.797532, 0.496087, 0.343278, -0.387722, 0.902403, 0.18799, -0.359441, 0.919864, 0.157013, -0.425146, 0.874892, 0.231981, -0.182965, 0.981371, 0.058603, -0.348803, 0.926225, 0.142984, -0.367494, 0.920629, 0.131876, -0.387139, -0.859204, -0.334503, -0.446449, -0.783897, -0.431496, -0.169182, -0.880154, -0.443516, -0.0685962, 0.994029, 0.0848541, 0.345353, 0.934263, -0.0887889, -0.403645, 0.893409, 0.19721, -0.301746, 0.872642, 0.383985, -0.513447, 0.85219, -0.100715, -0.462117, 0.854837, 0.236011, -0.255226, 0.904235, 0.342373, -0.414631, 0.892496, 0.177572, -0.11056, 0.961671, -0.250931, -0.0456455, 0.93153, -0.360789, -0.0930654, 0.823698, 0.55934, -0.672256, 0.619652, -0.405096, -0.437114, 0.865558, 0.244419, -0.435061, 0.88708, 0.154311, -0.324902, 0.945016, 0.0371824, -0.222853, 0.881868, 0.415507, -0.331988, 0.896303, 0.293981, -0.331541, 0.901215, 0.279091, -0.41335, 0.893322, 0.1764, -0.462246, 0.879918, 0.109878, -0.197606, 0.847268, 0.49304, -0.400552, 0.895193, 0.195417, 0.71568, -0.338185, -0.611091, 0.264959, 0.914398, -0.306062, 0.547824, 0.815791, -0.185402, 0.663381, 0.70635, -0.246973, -0.297336, 0.901086, 0.31565, -0.414676, 0.839459, -0.351216, 0.213679, 0.953898, -0.210762, -0.319931, 0.882488, 0.344758, -0.423309, 0.890375, 0.167455, -0.754366, 0.655665, -0.0321911, -0.293806, 0.872788, 0.389769, -0.441417, 0.886252, 0.140388, -0.829597, 0.502921, -0.242567, 0.239653, -0.213902, 0.947002, 0.0166758, -0.0145026, 0.999756, -0.239669, 0.836842, 0.492194, -0.33792, 0.890654, 0.304213, -0.388175, 0.893403, 0.226168, -0.370194, 0.899856, 0.230684, -0.378767, 0.89521, 0.234807, -0.418839, 0.893302, 0.16305, -0.724976, -0.537352, -0.430886, -0.56427, -0.809054, 0.16441, -0.351232, 0.888866, 0.2942, -0.285715, 0.839436, 0.462292, -0.275941, 0.84314, 0.461488, -0.418474, 0.894623, 0.156618, -0.314245, 0.867986, 0.384512, -0.30465, 0.862076, 0.404986, -0.0901738, 0.927661, -0.362373, -0.378776, 0.896041, 0.231601, -0.378143, 0.893589, 0.241883, -0.0331386, 0.822169, -0.568278, -0.221766, 0.899655, -0.376087, -0.219698, 0.899076, -0.378676, -0.416213, 0.900362, 0.126946, -0.373065, 0.895047, 0.244362, -0.323373, 0.883158, 0.339798, -0.367971, 0.896672, 0.246122, -0.467348, 0.880098, 0.083742, -0.0126227, 0.952287, -0.304942, -0.508581, 0.860429, 0.0317421, -0.32917, 0.863109, 0.383, -0.37959, 0.887111, 0.262574, -0.45447, 0.885773, 0.0941486, -0.40052, 0.898391, 0.180214, -0.399746, 0.895861, 0.194002, -0.451649, 0.887342, 0.092939, -0.216233, 0.706992, 0.673354, -0.539279, -0.803657, -0.251622, -0.238553, 0.787216, 0.568668, -0.328492, 0.876415, 0.352122, -0.464545, 0.882675, 0.0712933, -0.346705, 0.886901, 0.305291, -0.0336717, -0.987802, -0.152034, -0.295298, 0.764287, 0.573293, -0.386399, 0.88722, 0.252065, -0.380232, 0.883671, 0.273037, -0.340597, 0.865981, 0.366158, -0.312972, 0.809226, 0.497194, -0.407677, 0.893651, 0.187583, -0.235461, 0.648172, 0.724176, -0.23853, 0.787225, 0.568666, -0.357278, 0.872077, 0.334416, -0.416198, 0.896885, 0.149587, -0.404106, 0.896811, 0.180076, -0.318259, 0.794114, 0.517778, -0.290308, 0.766407, 0.573011, -0.294897, 0.764456, 0.573274, -0.38375, 0.89172, 0.23994, -0.431071, 0.893518, 0.125715, -0.409187, 0.896577, 0.169455, 0.273722, 0.813578, -0.512998, -0.405266, 0.904822, 0.130603, -0.378652, 0.862848, 0.334837, -0.438178, 0.895243, 0.0808733, -0.374739, 0.867622, 0.326807, -0.401994, 0.896495, 0.186271, -0.383959, 0.888996, 0.249521, 0.060664, 0.972893, 0.223155, -0.358459, 0.786465, 0.50297, -0.381431, 0.805734, 0.453103, -0.37415, 0.873962, 0.310166, -0.393937, 0.892395, 0.220102, -0.0472551, 0.985869, 0.160715, -0.194737, -0.582377, 0.789249, -0.305719, 0.661142, 0.685147, -0.377602, 0.813192, 0.442872, -0.39933, 0.887801, 0.22879, -0.345479, 0.867912, -0.356893, -0.384992, 0.873442, 0.298127, -0.377895, 0.846998, 0.373885, -0.379062, 0.870175, 0.314814, -0.419987, 0.899049, 0.123778, -0.122642, -0.891166, -0.436787, 0.279816, 0.95205, -0.123706, -0.383274, 0.880631, 0.278548, -0.399831, 0.890953, 0.215263, -0.00434969, 0.998425, 0.0559265, -0.416622, 0.903767, 0.0981449, -0.43478, 0.898539, 0.0599507, -0.386571, 0.846848, 0.365254, -0.384138, 0.862482, 0.329488, -0.206271, 0.978273, -0.0208458, -0.100243, 0.851359, 0.514916, -0.291399, 0.749413, 0.59453, -0.387326, 0.881601, 0.269737, -0.391307, 0.885324, 0.251157, 0.103594, -0.803244, 0.586573, -0.00230558, 0.954993, -0.29662, -0.142186, 0.966899, 0.21187, -0.492919, 0.802103, 0.337137, -0.198477, 0.940341, 0.276342, 0.232548, 0.932379, 0.276751, -0.368778, 0.927109, 0.0668718, -0.373092, 0.810741, 0.451111, -0.394389, 0.879068, 0.267762, -0.414925, 0.905773, 0.0860978, -0.419108, 0.903814, 0.0864291, -0.424977, 0.904281, 0.0408792, -0.727182, 0.612778, 0.30937, -0.722839, 0.615632, 0.313848, -0.893289, -0.287479, -0.345531, -0.673848, -0.510107, -0.534527, -0.139237, 0.986018, 0.0915515, -0.405583, 0.841949, 0.355843, -0.396263, 0.871195, 0.289818, 0.153011, 0.984571, -0.0848981, 0.0402904, 0.997822, 0.0522245, 0.908547, 0.41507, -0.0475424, -0.403913, 0.906532, 0.1227, -0.415101, 0.905691, 0.0861132, -0.0297492, 0.932452, -0.360067, 0.631705, 0.125426, 0.764995, 0.336078, 0.00510898, 0.94182, 0.497343, -0.0929724, 0.862558, -0.243673, -0.927364, -0.283936, -0.223138, -0.83227, -0.50748, -0.399994, 0.879624, 0.257423, -0.400521, 0.896861, 0.187679, -0.426646, 0.899342, -0.0956876, -0.587337, -0.672042, -0.450992, -0.013199, 0.983444, 0.180731, -0.827355, 0.556234, 0.0780187, -0.272575, 0.955004, -0.116916, 0.351593, 0.709112, 0.611181, -0.410486, 0.911849, -0.0056419, -0.407705, 0.909102, 0.0854993, 0.0838678, 0.992774, -0.0858287, -0.363569, 0.930596, 0.0425221, -0.39661, 0.90564, 0.150058, -0.410235, 0.907945, 0.0856956, -0.577616, 0.669096, 0.467623, -0.910472, 0.359751, 0.204008, -0.812876, -0.323007, -0.484665, -0.191229, 0.980548, 0.0442395, -0.334859, 0.885111, 0.323183, -0.178606, 0.979888, 0.0889881, 0.314406, 0.945936, -0.0797147, -0.389937, 0.91978, 0.0442098, -0.390176, 0.918583, -0.0629925, -0.391418, 0.896804, -0.206238, 0.00520065, 0.993159, -0.116652, -0.135207, -0.839977, -0.525506, -0.558083, -0.788431, -0.258688, -0.505839, -0.845526, -0.170917, -0.19988, -0.768118, -0.608312, -0.526324, 0.822365, -0.216101, -0.25417, 0.964381, 0.0732621, -0.91989, -0.0757805, -0.384786, -0.86414, 0.0197678, -0.502863, -0.933574, 0.0157657, -0.358039, -0.716833, 0.642192, -0.271551, -0.931128, 0.334643, -0.144963, -0.204962, 0.826879, -0.5237, -0.150774, -0.928456, 0.339466, -0.245861, -0.930374, 0.271949, -0.813682, 0.573757, -0.0934079, -0.779278, 0.596775, -0.191273, -0.853185, 0.519629, 0.0453956, 0.159896, 0.98459, -0.070826, 0.17577, 0.98181, -0.0717975, -0.328463, 0.923621, -0.197574, 0.970839, -0.0870335, 0.223376, -0.353018, 0.911049, -0.212998, -0.388932, 0.890639, -0.235571, -0.0855584, 0.987661, 0.131173, 0.972851, 0.228718, 0.0353363, 0.90187, 0.0287514, -0.431049, 0.945095, -0.124817, -0.302019, 0.739566, 0.135822, -0.659238, 0.618717, -0.321819, -0.716674, 0.81018, -0.112641, -0.575257, 0.349209, 0.000504511, -0.937045, 0.476784, 0.269141, -0.836804, -0.205414, 0.849287, -0.48633, 0.49366, -0.0808604, 0.865888, 0.359032, -0.0958326, 0.928392, -0.565307, 0.148479, -0.811407, -0.717223, 0.327897, -0.614878, 0.880292, 0.432493, 0.195027, 0.674859, -0.68089, 0.284524, 0.699551, -0.652291, 0.291796, 0.817387, -0.535487, 0.212444, 0.515351, -0.293543, 0.805137, 0.411893, -0.370467, 0.832525, 0.918063, 0.380991, 0.109572, 0.278156, -0.504616, 0.817307, -0.803447, -0.16823, -0.571114, -0.843284, 0.00125385, 0.537466, 0.251059, -0.776717, 0.577651, 0.194866, 0.103393, -0.975365, 0.139631, -0.271961, -0.952124, 0.627915, -0.581564, -0.517209, -0.366404, 0.252842, -0.895443, -0.1719, 0.232978, -0.957169, 0.988043, 0.129794, 0.0832167, 0.934384, -0.311832, 0.172301, 0.990517, -0.122806, 0.0616023, 0.964454, 0.192695, -0.180826, 0.97466, 0.177693, 0.13588, -0.895586, 0.438971, -0.0723243, 0.554721, -0.317375, -0.769128, -0.69701, -0.176693, -0.694951, 0.628772, -0.328516, -0.704786, 0.528495, -0.312925, -0.789159, 0.504734, -0.458152, 0.73167, 0.880033, 0.181628, 0.438808, -0.0812617, 0.0341895, 0.996106, -0.235542, 0.0155936, 0.971739, 0.960937, -0.131299, -0.243642, -0.387556, 0.705541, -0.593306, 0.934084, -0.101024, -0.342463, -0.0865074, -0.328683, -0.94047, -0.628532, 0.322984, 0.707552, -0.732667, 0.153644, 0.663018, -0.58963, 0.348889, 0.728432, -0.812051, 0.524998, -0.254853, -0.863894, 0.43693, -0.250557, -0.890197, 0.415174, 0.187564, -0.394813, 0.918759, 0.00228592, 0.584573, 0.46184, -0.667067, -0.335294, -0.168131, 0.92699, -0.24675, -0.0594744, 0.967252, -0.178402, 0.102118, 0.978644, 0.474525, 0.132802, 0.870166, -0.792253, 0.599276, -0.114911, 0.833147, 0.311109, 0.45725, 0.961717, 0.138376, 0.236543, 0.744909, -0.0793779, -0.662427, 0.941054, 0.337777, -0.0179923, -0.750824, 0.655478, -0.0813118, -0.716371, 0.694045, -0.0715132, -0.370686, 0.374644, 0.849843, 0.0699417, 0.202256, 0.976832, -0.665485, 0.701247, 0.255699, -0.889791, 0.331187, -0.313987, 0.882551, -0.307911, 0.355379, 0.688538, -0.620893, 0.37471, 0.495681, 0.045574, 0.867308, 0.383483, 0.112428, 0.916679, -0.84438, 0.460227, -0.274252, 0.105205, -0.137255, 0.984933, 0.0911379, 0.00513276, 0.995825, -0.770379, 0.59659, -0.224936, 0.226, -0.557097, 0.799104, -0.920825, 0.357495, 0.155815, -0.515422, 0.638048, 0.572045, -0.606422, 0.794878, -0.0205444, 0.852157, -0.299523, 0.429085, 0.850062, -0.329643, 0.410768, 0.801418, -0.436386, 0.409018, -0.85278, 0.32972, -0.405033, -0.69179, -0.219455, -0.687943, -0.985638, 0.025416, -0.166947, -0.988148, -0.0295003, 0.150642, -0.985415, -0.00252535, -0.170153, -0.793674, -0.457435, 0.401042, 0.94631, 0.26169, 0.189776, -0.608595, 0.767929, 0.199741, 0.0496275, -0.0941443, 0.994321, -0.860389, 0.29964, -0.412245, 0.837711, -0.296485, 0.458625, -0.792581, 0.502207, -0.345838, -0.73639, 0.626957, -0.254274, 0.767179, -0.113918, -0.631237, 0.758037, -0.260282, -0.598024, -0.6702, 0.320585, -0.669371, -0.719074, 0.537707, -0.440232, -0.51671, 0.724153, -0.456743, -0.641064, 0.557834, -0.527122, -0.571647, 0.663415, -0.482805, -0.844055, 0.2718, -0.462272, 0.953463, 0.300869, 0.0196601, -0.768538, 0.515875, -0.378447, -0.719309, 0.638984, -0.272569, -0.681018, -0.398974, -0.614031, -0.764017, 0.255202, 0.592579, -0.729359, 0.672541, 0.125397, -0.962387, -0.271652, -0.00399868, -0.731715, 0.63544, -0.246595, -0.685923, 0.694883, 0.215981, -0.798541, 0.550027, 0.244546, -0.28878, 0.0665687, -0.955078, -0.423408, 0.00289486, -0.905935, -0.84479, 0.521799, -0.118554, -0.675441, 0.732589, 0.0842228, 0.797681, -0.287642, 0.530063, 0.78805, -0.289943, 0.543056, 0.6697, -0.66375, 0.333073, -0.322156, -0.351449, -0.879033, -0.865497, 0.446493, 0.227066, -0.953203, 0.232855, 0.192827, -0.847239, 0.479516, 0.228583, -0.757037, 0.623612, 0.194945, -0.714137, 0.675139, 0.184924, -0.755766, 0.637044, 0.15163, -0.781062, 0.369832, -0.503156, -0.831595, 0.276331, -0.481758, -0.568071, -0.18047, -0.802948, 0.771497, -0.375051, 0.513935, 0.913954, -0.223394, -0.338796, 0.817804, -0.207351, -0.536845, -0.734855, 0.668338, 0.115378, -0.776111, 0.591085, 0.219704, -0.806706, 0.589965, 0.0341493, -0.783952, 0.620358, 0.0239573, 0.731218, -0.10808, 0.673527, -0.882814, 0.388042, 0.264693, -0.877154, 0.443265, 0.184705, -0.827086, 0.556683, 0.0776732, -0.721028, 0.692338, 0.0280515, -0.824691, 0.499374, 0.265538, -0.683619, 0.676856, 0.273004, -0.722839, 0.615632, 0.313848, -0.934979, 0.162232, 0.315427, -0.879011, 0.463483, 0.111904, 0.712643, -0.118583, 0.691432, 0.740756, -0.265966, 0.616882, -0.688368, 0.307357, -0.657024, 0.0559993, 0.929713, 0.364002, 0.816651, -0.289321, 0.499374, 0.932426, -0.299774, 0.201784, 0.851025, 0.0265522, 0.524453, -0.919733, 0.0424062, 0.390246, -0.90878, 0.366382, 0.199709, -0.943253, 0.31053, 0.117668, -0.934291, 0.353004, 0.0498811, -0.834046, 0.549058, -0.0538844, 0.930916, -0.335741, -0.143786, 0.847078, -0.482776, -0.222232, 0.866507, -0.41498, -0.277411, 0.844518, -0.506054, -0.175211, -0.962739, 0.0301306, 0.268749, -0.920887, 0.38973, 0.00880198, -0.793074, 0.60638, -0.0577649, -0.722901, 0.690382, -0.0280362, -0.969392, 0.139495, 0.20204, -0.872943, 0.486767, -0.0320783, 0.979613, -0.0510978, 0.194287, -0.238071, -0.881244, 0.408327, -0.607784, 0.310204, -0.731008, -0.880103, 0.474336, -0.0206046, -0.88102, 0.0579322, 0.469518, -0.937955, -0.00777246, 0.346671, -0.937955, -0.00777246, 0.346671, -0.96306, 0.264925, 0.0482726, -0.822746, 0.552863, -0.132029, -0.965496, 0.229328, 0.123394, -0.9626, 0.246219, 0.11304, -0.958105, 0.286351, -0.00621562, 0.842385, -0.26746, -0.467817, 0.830024, -0.235244, -0.505689, -0.936129, 0.346502, -0.0599869, -0.887145, 0.442956, -0.129474, 0.900905, -0.0821131, 0.426178, -0.90955, -0.0488466, 0.412713, -0.986636, -0.0409813, 0.157699, -0.949581, 0.303994, -0.076709, -0.925999, 0.34155, -0.160841, -0.873384, 0.438262, -0.212433, -0.821463, 0.533561, -0.201275, -0.821921, 0.170343, 0.543534, 0.861122, -0.33098, -0.385903, -0.729066, 0.335906, 0.596347, -0.918504, 0.350796, -0.182462, -0.668857, 0.0149915, 0.74324, -0.769104, -0.0310558, 0.638369, -0.951855, -0.19997, 0.232345, -0.951855, -0.19997, 0.232345, -0.989732, 0.125826, -0.0678185, 0.504725, -0.308678, -0.806207, -0.851961, -0.194401, 0.48618, -0.997114, -0.00575398, -0.0756941, -0.930769, 0.335144, -0.146111, -0.905464, 0.365035, -0.216528, -0.847729, 0.454935, -0.272745, -0.66209, -0.367338, 0.653223, -0.908376, -0.190654, 0.37216, -0.924022, -0.338996, 0.176817, -0.975903, 0.0106082, -0.217949, -0.944196, 0.252051, -0.212048, -0.541718, -0.319075, 0.777646, -0.805609, -0.216672, 0.551405, -0.854832, 0.510179, 0.0947646, -0.99675, 0.00946529, 0.0799987, -0.387651, -0.657443, 0.646139, -0.513108, -0.680531, 0.523066, -0.525217, -0.659777, 0.537441, -0.798441, 0.558237, -0.225529, -0.668665, 0.700374, 0.249728, -0.730655, 0.61156, 0.303541, -0.304536, -0.688913, 0.657767, -0.362406, -0.65069, 0.667281, -0.427454, -0.555878, 0.71294, -0.364737, -0.651381, 0.665334, -0.705531, -0.300982, 0.641589, -0.465985, -0.674058, 0.573153, -0.516341, -0.680875, 0.519424, -0.373105, -0.496515, 0.783751, -0.908376, -0.190654, 0.37216, -0.924022, -0.338996, 0.176817, -0.989416, -0.0320873, -0.141516, -0.971056, -0.00990711, -0.238648, -0.658479, 0.521002, -0.543104, -0.73745, 0.4417, -0.510949, -0.134817, -0.752857, 0.644229, -0.654011, -0.107794, 0.748765, -0.797714, -0.014657, 0.602857, -0.000778235, 0.0640973, -0.997943, -0.385783, -0.398469, 0.832102, 0.818449, -0.208799, -0.535298, -0.173776, 0.284866, 0.942684, -0.165944, 0.30452, 0.937939, -0.186792, 0.444749, 0.875961, 0.935102, -0.322347, 0.14723, -0.64939, 0.529187, -0.546126, -0.779211, -0.170735, -0.603059, -0.938542, 0.334709, 0.0843173, -0.959082, -0.126704, 0.253195, -0.872559, -0.252332, 0.418294, -0.993653, -0.111705, 0.0132257, -0.867192, -0.15933, -0.471797, -0.48714, -0.180405, -0.854487, -0.473489, -0.180229, -0.862163, -0.0685982, -0.401485, -0.913293, 0.0760678, -0.366169, -0.927434, 0.659555, -0.447608, -0.60385, 0.64941, -0.31617, -0.691595, -0.514535, 0.336607, 0.788638, -0.517007, 0.427266, 0.741719, -0.532178, 0.336124, 0.777051, 0.886505, 0.00933144, 0.462625, 0.576358, -0.0325313, 0.816549, 0.921214, 0.153371, 0.35755, 0.83106, 0.00950751, 0.556101, 0.890448, 0.0844694, 0.447176, 0.2627, -0.341518, -0.902416, 0.16812, -0.421996, -0.890873, 0.852003, 0.225459, 0.472503, 0.974244, 0.193103, 0.116448, -0.898083, -0.143694, 0.415691, -0.988677, -0.132461, 0.0705132, 0.230812, -0.42727, -0.874166
-};
-
-uint32_t mIndices[] = {
-2, 1, 0, 221, 0, 220, 315, 314, 0, 220, 0, 1, 995, 994, 0, 314, 2, 0, 0, 994, 315, 2113, 995, 0, 2113, 0, 221, 122, 221, 220, 122, 220, 430, 430, 220, 1, 123, 122, 121, 121, 122, 178, 123, 221, 122, 178, 122, 430, 430, 68, 69, 178, 430, 69, 1, 1384, 430, 1384, 68, 430, 219, 121, 178, 219, 178, 104, 104, 178, 69, 69, 68, 67, 104, 69, 67, 104, 67, 103, 198, 104, 103, 104, 1643, 219, 104, 198, 1643, 1716, 219, 1643, 231, 121, 219, 1716, 231, 219, 1705, 1643, 1630, 1643, 198, 1630, 1705, 1716, 1643, 231, 1716, 1705, 121, 231, 230, 2708, 2710, 231, 2710, 230, 231, 2708, 231, 1705, 123, 121, 230, 230, 2246, 123, 2710, 2246, 230, 2709, 2710, 2708, 2246, 2710, 2245, 2245, 2710, 2709, 2709, 2708, 2707, 2708, 1705, 2707, 3112, 2245, 2709, 3117, 2709, 2707, 2247, 2246, 2245, 2349, 2245, 2348, 2247, 2245, 2349, 2247, 2256, 2246, 2928, 2247, 2349, 2256, 2247, 2928, 2925, 2349, 404, 2925, 2927, 2349, 2928, 2349, 2927, 404, 2349, 3175, 2926, 2925, 404, 2973, 2972, 2925, 2925, 2969, 2927, 2973, 2925, 2926, 405, 404, 403, 2926, 404, 405, 2923, 2926, 405, 2973, 2926, 2923, 2973, 2923, 2663, 2672, 2663, 2923, 2923, 405, 2672, 405, 1836, 2672, 1836, 405, 2707, 2707, 405, 2959, 2662, 2663, 2672, 2662, 2672, 289, 2672, 1836, 289, 1751, 2663, 2662, 1752, 2663, 1751, 2671, 1751, 2662, 2671, 2662, 290, 2662, 289, 290, 1752, 1751, 1750, 1750, 1751, 2608, 2608, 1751, 2661, 2661, 1751, 2671, 2671, 2076, 2661, 2671, 290, 2076, 290, 289, 288, 2076, 290, 288, 1673, 2076, 288, 2661, 2076, 2688, 2688, 2076, 1673, 2608, 2661, 2624, 2624, 2661, 2660, 2660, 2661, 2688, 1750, 2608, 2607, 2624, 2632, 2608, 2612, 2625, 2624, 2624, 2643, 2612, 2643, 2624, 2660, 2606, 2612, 2611, 2612, 2643, 2611, 2611, 2643, 2654, 2643, 2660, 2654, 2606, 2611, 2605, 2605, 2611, 2642, 2611, 2654, 2642, 2606, 2605, 2604, 2605, 2642, 2604, 2642, 2658, 2555, 2642, 2654, 2659, 2659, 2658, 2642, 2642, 2555, 2556, 2654, 2687, 2659, 2660, 2687, 2654, 2659, 1842, 2658, 2687, 1842, 2659, 2660, 2693, 2687, 2693, 232, 2687, 2687, 193, 1842, 232, 193, 2687, 2660, 2688, 2694, 2660, 2694, 2693, 2693, 2694, 243, 2693, 243, 232, 2688, 1710, 2694, 1710, 243, 2694, 2688, 2742, 1710, 2688, 1673, 2743, 1710, 1709, 136, 1710, 136, 243, 136, 197, 243, 232, 243, 197, 138, 137, 136, 136, 137, 197, 896, 138, 136, 197, 137, 30, 197, 31, 232, 31, 197, 30, 31, 30, 29, 1501, 30, 137, 30, 1501, 1502, 30, 1502, 29, 232, 31, 339, 31, 29, 339, 232, 339, 193, 193, 339, 194, 339, 29, 194, 29, 1502, 1603, 1687, 29, 1603, 194, 29, 1687, 194, 1687, 1603, 194, 25, 193, 194, 1420, 25, 194, 1603, 80, 1420, 194, 80, 193, 25, 40, 1842, 193, 40, 40, 23, 39, 40, 25, 23, 1842, 40, 2720, 2720, 40, 2733, 2733, 40, 39, 1842, 2720, 2658, 2658, 2720, 2686, 2720, 2733, 2686, 2686, 2733, 292, 39, 292, 2733, 39, 23, 113, 1123, 292, 39, 113, 1123, 39, 293, 292, 291, 2686, 292, 2653, 293, 2653, 292, 1123, 291, 292, 2555, 2686, 2653, 2658, 2686, 2555, 2555, 2653, 2557, 2653, 2670, 2557, 2653, 293, 3288, 2557, 2556, 2555, 2557, 2669, 2668, 2668, 2685, 2684, 293, 3335, 3334, 291, 3347, 293, 293, 3347, 3335, 1123, 3331, 291, 291, 3349, 3348, 3331, 3349, 291, 291, 3348, 3347, 3347, 3362, 3335, 3348, 3349, 3347, 3349, 3362, 3347, 3331, 3356, 3349, 3356, 3363, 3349, 3349, 3369, 3362, 3363, 3369, 3349, 3335, 3362, 3361, 3362, 3378, 3361, 3362, 3369, 3379, 3362, 3379, 3378, 3363, 3380, 3369, 3369, 3380, 3379, 3380, 3399, 3379, 3379, 3399, 3402, 3379, 3402, 3378, 3363, 3387, 3380, 3380, 3403, 3399, 3387, 3403, 3380, 3399, 3403, 2125, 3471, 3399, 2125, 3471, 3402, 3399, 3378, 3402, 3272, 3471, 3272, 3402, 3471, 399, 3272, 3471, 398, 399, 3471, 1704, 398, 3471, 2125, 1704, 2118, 3272, 399, 3378, 3272, 2118, 1110, 2118, 399, 1111, 2118, 1110, 3366, 3365, 2118, 2118, 3365, 3378, 3378, 3365, 3361, 3361, 3365, 3366, 3361, 3366, 436, 3335, 3361, 437, 437, 3361, 436, 437, 436, 435, 437, 435, 2296, 3335, 437, 3357, 3444, 3443, 3335, 1111, 1110, 1109, 2344, 1110, 2255, 2255, 1110, 399, 1110, 2344, 1109, 2735, 2734, 1109, 2736, 1111, 1109, 1109, 2344, 2735, 2344, 2255, 2319, 399, 206, 2255, 2319, 2255, 206, 399, 398, 206, 206, 205, 204, 693, 205, 206, 206, 398, 693, 2319, 206, 204, 1704, 1703, 398, 1704, 906, 1703, 2125, 2124, 1704, 2182, 905, 1704, 2124, 2182, 1704, 906, 1704, 905, 1703, 906, 1768, 1703, 1768, 1769, 906, 905, 904, 906, 904, 1768, 2182, 1984, 905, 905, 2185, 904, 2185, 905, 1984, 1768, 904, 1843, 2088, 904, 2087, 2185, 2087, 904, 1844, 1768, 1843, 2570, 1768, 1844, 2087, 2185, 2147, 1984, 2147, 2185, 1984, 467, 2147, 467, 622, 2147, 2191, 2147, 623, 2147, 622, 623, 468, 467, 466, 1984, 1983, 467, 467, 468, 622, 467, 1983, 466, 468, 685, 694, 622, 468, 633, 468, 694, 633, 685, 468, 466, 694, 702, 701, 685, 702, 694, 633, 694, 713, 694, 701, 713, 685, 714, 702, 714, 748, 702, 701, 702, 764, 702, 748, 764, 713, 701, 763, 701, 764, 763, 748, 784, 764, 763, 764, 794, 764, 784, 794, 714, 726, 748, 748, 765, 784, 748, 726, 765, 685, 726, 714, 703, 726, 685, 726, 703, 749, 726, 749, 765, 663, 685, 466, 663, 676, 685, 676, 703, 685, 676, 686, 703, 686, 715, 703, 715, 749, 703, 664, 676, 663, 664, 686, 676, 625, 664, 663, 663, 466, 625, 3442, 466, 1983, 3442, 1280, 466, 1280, 625, 466, 511, 3442, 3429, 3429, 3442, 1983, 511, 1280, 3442, 2182, 2193, 1983, 1983, 1984, 2182, 2193, 3413, 1983, 3413, 3429, 1983, 3414, 3429, 3413, 3414, 511, 3429, 3400, 3414, 3413, 3400, 3413, 3407, 3418, 3407, 3413, 3428, 3413, 2193, 2182, 2183, 2193, 3427, 2193, 2183, 2124, 2125, 2183, 2124, 2183, 2182, 2183, 2125, 3206, 3403, 3406, 2125, 3406, 3411, 2125, 3403, 3387, 3406, 3391, 3406, 3387, 3391, 3407, 3406, 3406, 3407, 3412, 3391, 3387, 3363, 3381, 3391, 3358, 3358, 3391, 3363, 3381, 3407, 3391, 3381, 3400, 3407, 3359, 3381, 3358, 3364, 3381, 3359, 3364, 3388, 3381, 3388, 3400, 3381, 1793, 3358, 3331, 1793, 3359, 3358, 3331, 3358, 3363, 3331, 3363, 3356, 1793, 3331, 1481, 1123, 1481, 3331, 112, 1481, 113, 1481, 112, 1793, 113, 1481, 1123, 113, 23, 112, 23, 24, 112, 24, 1873, 112, 1873, 1793, 112, 25, 24, 23, 24, 80, 79, 24, 1440, 80, 25, 1440, 24, 24, 79, 1873, 25, 1420, 1440, 1440, 1420, 80, 80, 1603, 79, 79, 1603, 1683, 1873, 79, 1872, 79, 1683, 1872, 1603, 1502, 2277, 1683, 1603, 2277, 2277, 2294, 1683, 1872, 1683, 2294, 1873, 1872, 1871, 2294, 2315, 1872, 2315, 2334, 1872, 1872, 2334, 1871, 2277, 2278, 2294, 2278, 2236, 2294, 2294, 2324, 2315, 2294, 2236, 2324, 1502, 2278, 2277, 1500, 2278, 1502, 1500, 2279, 2278, 2279, 2300, 2278, 2300, 2236, 2278, 1502, 1501, 1500, 1500, 1501, 2279, 1501, 2039, 2279, 2279, 2039, 2295, 2279, 2306, 2300, 2279, 2295, 2306, 2300, 2274, 2236, 2306, 2274, 2300, 2306, 2158, 2274, 2298, 2158, 2306, 2295, 2316, 2306, 2316, 2298, 2306, 2158, 271, 2274, 2229, 2274, 271, 2274, 2229, 2236, 270, 2158, 296, 2158, 270, 271, 2298, 296, 2158, 271, 270, 269, 2229, 271, 2134, 2134, 271, 269, 2224, 2236, 2229, 2229, 2134, 377, 2224, 2229, 377, 2236, 2224, 2324, 2224, 377, 376, 2218, 2224, 376, 2324, 2224, 2218, 356, 375, 377, 377, 355, 356, 376, 377, 375, 377, 2134, 355, 269, 355, 2134, 357, 356, 355, 294, 355, 269, 357, 355, 378, 355, 294, 378, 357, 375, 356, 357, 407, 375, 357, 378, 420, 357, 420, 407, 294, 318, 378, 378, 318, 408, 378, 408, 420, 269, 270, 294, 270, 318, 294, 270, 295, 318, 408, 318, 421, 318, 422, 421, 422, 318, 295, 296, 295, 270, 296, 297, 295, 422, 295, 297, 421, 422, 444, 451, 444, 422, 1195, 451, 422, 408, 421, 477, 421, 444, 477, 477, 444, 494, 451, 517, 444, 444, 564, 494, 517, 564, 444, 451, 1318, 2041, 1318, 1317, 517, 517, 565, 564, 517, 1317, 1346, 646, 565, 517, 1317, 1372, 1346, 564, 565, 628, 646, 645, 565, 565, 645, 667, 565, 677, 628, 565, 678, 677, 565, 667, 678, 645, 646, 1419, 1419, 1510, 645, 732, 645, 1577, 2055, 645, 1510, 667, 645, 732, 667, 732, 731, 678, 667, 731, 678, 730, 677, 730, 678, 731, 731, 729, 730, 729, 731, 505, 731, 732, 504, 731, 504, 505, 677, 730, 729, 677, 687, 628, 677, 729, 687, 627, 628, 666, 564, 628, 627, 628, 687, 666, 596, 564, 627, 596, 627, 613, 613, 627, 666, 613, 666, 665, 666, 696, 665, 687, 696, 666, 613, 665, 636, 665, 696, 636, 563, 613, 612, 575, 596, 613, 575, 613, 563, 613, 636, 612, 564, 596, 575, 494, 564, 575, 494, 575, 477, 563, 477, 575, 516, 563, 562, 516, 477, 563, 563, 612, 562, 583, 562, 612, 583, 612, 636, 450, 562, 530, 516, 562, 450, 530, 562, 583, 408, 516, 450, 477, 516, 408, 408, 450, 420, 420, 450, 493, 450, 530, 532, 420, 441, 407, 420, 476, 441, 407, 441, 440, 440, 441, 515, 407, 440, 375, 375, 440, 406, 406, 440, 449, 440, 464, 449, 440, 514, 464, 376, 375, 374, 375, 406, 374, 374, 406, 439, 439, 406, 449, 449, 492, 439, 449, 513, 492, 464, 513, 449, 464, 531, 530, 513, 464, 530, 492, 513, 561, 561, 513, 581, 513, 530, 582, 513, 582, 581, 583, 582, 530, 582, 583, 581, 561, 581, 635, 581, 644, 635, 583, 644, 581, 637, 583, 636, 583, 637, 644, 635, 644, 695, 637, 695, 644, 561, 635, 634, 634, 635, 695, 625, 561, 634, 625, 634, 664, 664, 634, 686, 686, 634, 695, 626, 574, 625, 574, 561, 625, 1280, 626, 625, 475, 626, 1280, 574, 626, 475, 529, 574, 475, 529, 561, 574, 492, 561, 512, 529, 512, 561, 475, 512, 529, 438, 475, 474, 475, 511, 474, 438, 512, 475, 475, 1280, 511, 492, 512, 438, 439, 492, 438, 374, 439, 438, 474, 374, 438, 474, 1742, 374, 1742, 474, 3414, 3414, 474, 511, 1742, 1741, 374, 376, 374, 1741, 1741, 1742, 3389, 3389, 1742, 3400, 1742, 3414, 3400, 2219, 2218, 1741, 1741, 2218, 376, 1741, 3389, 2219, 3364, 2219, 3389, 3364, 3389, 3388, 3388, 3389, 3400, 2315, 2218, 2219, 2219, 2334, 2315, 2334, 2219, 3364, 2324, 2218, 2315, 3339, 3364, 3359, 3339, 2334, 3364, 1871, 2334, 1873, 1873, 2334, 3339, 1873, 3339, 1793, 3339, 3359, 1793, 636, 696, 695, 636, 695, 637, 695, 715, 686, 695, 716, 715, 695, 696, 716, 687, 717, 696, 716, 696, 727, 696, 717, 727, 716, 750, 715, 716, 751, 750, 716, 752, 751, 716, 727, 752, 715, 750, 749, 749, 750, 774, 751, 775, 750, 750, 775, 774, 752, 776, 751, 751, 776, 775, 752, 788, 776, 752, 795, 788, 727, 795, 752, 776, 812, 811, 776, 811, 775, 788, 812, 776, 774, 775, 785, 785, 775, 802, 775, 811, 802, 749, 774, 785, 765, 749, 785, 765, 785, 802, 802, 810, 765, 802, 811, 820, 802, 2145, 810, 802, 820, 2145, 784, 765, 809, 765, 810, 809, 810, 838, 809, 810, 2145, 838, 2145, 2146, 853, 2141, 2146, 2145, 820, 2141, 2145, 853, 838, 2145, 809, 838, 825, 838, 853, 852, 852, 2297, 838, 784, 809, 794, 794, 809, 825, 793, 794, 825, 793, 825, 826, 851, 825, 850, 763, 794, 793, 793, 762, 763, 2133, 793, 826, 793, 2133, 762, 713, 763, 773, 633, 713, 712, 713, 762, 761, 761, 712, 713, 624, 633, 632, 624, 622, 633, 632, 633, 658, 633, 712, 658, 658, 712, 711, 742, 712, 761, 1071, 711, 1070, 1284, 1283, 711, 1284, 1281, 1283, 1234, 1284, 1306, 1284, 1071, 1306, 1284, 1234, 1281, 1234, 1233, 1281, 1232, 1233, 1234, 1306, 2240, 1234, 1234, 2240, 1232, 1297, 1306, 1071, 1298, 2240, 1306, 1306, 1297, 1298, 1298, 1618, 2240, 1232, 2240, 1618, 1299, 1298, 1297, 3434, 1618, 1298, 1299, 3434, 1298, 1232, 1618, 1615, 1615, 1618, 3434, 3423, 3254, 3434, 3254, 1615, 3434, 3423, 3434, 3433, 3433, 3434, 1299, 3433, 1299, 3456, 3456, 1299, 2553, 2553, 1299, 1297, 3423, 3433, 3426, 3426, 3433, 3456, 3426, 3456, 3455, 3455, 3456, 2553, 2553, 1297, 1833, 1636, 2553, 1833, 3455, 2553, 1636, 3455, 3474, 3426, 1636, 2801, 3455, 3454, 3455, 2801, 3455, 3454, 3474, 1637, 1636, 1635, 1636, 1833, 1635, 1637, 2801, 1636, 1833, 1832, 1635, 1833, 1297, 1832, 1071, 1832, 1297, 1832, 1071, 1070, 1635, 1832, 2581, 1832, 1070, 1418, 1418, 2581, 1832, 1635, 2581, 3241, 3155, 1637, 1635, 3155, 1635, 3475, 2581, 1416, 3232, 1416, 2581, 1418, 3470, 2581, 3232, 1418, 1417, 1416, 2216, 1417, 1418, 1416, 560, 3232, 559, 1416, 1417, 559, 560, 1416, 2184, 559, 1417, 1070, 2169, 1417, 560, 559, 558, 560, 558, 1102, 3232, 560, 1102, 1435, 1102, 558, 558, 887, 1435, 1103, 1102, 1101, 1102, 1435, 1101, 3232, 1102, 1103, 1435, 1434, 1101, 887, 1434, 1435, 1434, 1465, 1101, 1565, 1101, 1465, 1101, 3469, 1103, 3232, 1103, 3231, 3231, 1103, 3458, 3256, 3232, 3231, 3343, 3231, 3247, 3343, 3352, 3231, 3231, 1054, 3247, 3231, 3457, 1054, 1056, 1055, 1054, 3247, 1054, 1055, 3247, 1055, 1800, 3264, 1523, 1055, 1535, 1800, 1055, 1055, 1523, 1535, 1535, 1389, 1800, 3248, 3247, 1800, 1800, 3228, 3248, 1800, 1389, 3228, 620, 1535, 1523, 1557, 1389, 1535, 620, 1523, 1465, 1465, 1523, 2198, 1434, 620, 1465, 887, 888, 1434, 888, 620, 1434, 887, 177, 875, 887, 875, 888, 887, 176, 177, 176, 887, 2149, 888, 1475, 620, 875, 1573, 888, 177, 876, 875, 177, 176, 175, 2303, 177, 175, 175, 176, 2184, 2301, 2210, 175, 2169, 2170, 2210, 2169, 2210, 2367, 2171, 2170, 2169, 2171, 2169, 1070, 744, 742, 1070, 744, 743, 742, 2187, 744, 1071, 620, 619, 618, 1034, 619, 620, 620, 618, 1389, 619, 322, 347, 1008, 619, 1026, 984, 324, 619, 1009, 1008, 1007, 324, 323, 322, 324, 322, 789, 1010, 324, 984, 1010, 533, 324, 533, 323, 324, 967, 947, 984, 947, 1010, 984, 987, 1010, 947, 987, 1019, 1010, 1019, 533, 1010, 394, 485, 533, 485, 323, 533, 1019, 394, 533, 987, 557, 1019, 557, 555, 1019, 555, 393, 1019, 393, 394, 1019, 557, 556, 555, 986, 556, 557, 987, 986, 557, 1029, 555, 556, 1029, 566, 555, 566, 383, 555, 555, 383, 393, 394, 393, 381, 383, 381, 393, 383, 382, 381, 383, 305, 382, 566, 305, 383, 382, 306, 381, 305, 306, 382, 394, 381, 415, 415, 381, 452, 452, 381, 364, 381, 306, 364, 306, 305, 304, 364, 306, 304, 275, 364, 363, 273, 364, 275, 273, 452, 364, 1052, 364, 304, 1052, 363, 364, 304, 1053, 1052, 305, 689, 304, 689, 1053, 304, 1091, 1089, 1052, 1053, 1091, 1052, 1052, 1099, 363, 1099, 1052, 1089, 275, 363, 344, 344, 363, 1099, 1099, 1098, 1076, 1089, 1098, 1099, 1099, 1076, 344, 274, 275, 344, 346, 274, 344, 346, 344, 641, 344, 1076, 641, 275, 274, 273, 274, 452, 273, 274, 346, 323, 452, 274, 485, 485, 274, 323, 394, 452, 485, 394, 415, 452, 322, 323, 346, 322, 346, 345, 347, 322, 345, 345, 346, 465, 1041, 345, 1040, 347, 345, 1041, 465, 1040, 345, 346, 641, 465, 465, 1252, 1040, 465, 1076, 1252, 641, 1076, 465, 1252, 1211, 1040, 1041, 1040, 1210, 1040, 1211, 1210, 347, 1041, 1292, 1041, 1210, 1292, 1210, 1209, 1208, 1210, 1211, 1209, 1210, 1206, 1292, 1210, 1208, 1206, 1390, 1203, 1211, 1211, 1203, 1209, 1252, 1390, 1211, 1209, 1204, 1212, 1209, 1203, 1204, 1208, 1209, 1212, 1208, 1207, 1206, 1207, 1208, 1212, 1207, 1762, 1206, 1292, 1206, 1762, 1207, 1729, 1728, 1212, 1729, 1207, 1762, 1207, 1728, 1212, 816, 1308, 1212, 1204, 816, 1212, 1308, 1729, 1308, 1805, 1729, 1729, 1805, 1763, 1729, 1763, 1728, 1764, 1728, 1763, 1764, 3274, 1728, 3274, 1762, 1728, 3283, 3252, 1763, 3252, 1764, 1763, 3283, 1763, 1805, 3283, 1805, 3326, 3326, 1805, 1633, 1633, 1805, 1308, 3251, 3283, 3281, 3251, 3252, 3283, 3281, 3283, 3326, 3281, 3326, 3311, 3326, 1633, 1634, 3326, 1634, 3311, 2443, 3281, 3260, 2443, 3251, 3281, 3260, 3281, 3311, 3251, 3250, 3249, 3249, 3252, 3251, 3250, 3251, 2443, 2445, 2444, 2443, 1407, 2443, 3260, 3250, 2443, 2444, 2445, 2443, 1407, 3250, 3220, 3249, 2444, 3220, 3250, 3220, 3252, 3249, 3222, 3221, 3220, 3253, 3222, 3220, 3253, 3220, 3487, 3252, 3220, 3221, 3221, 3223, 3252, 3252, 3223, 1764, 3223, 3221, 3222, 3253, 3263, 3222, 3392, 3263, 3253, 3253, 3487, 3392, 3166, 3487, 3489, 3493, 3392, 3487, 3492, 3489, 3487, 3408, 3376, 3392, 3263, 3392, 3376, 3376, 3375, 3374, 3229, 3237, 3376, 3375, 3383, 3382, 3375, 3354, 3263, 3355, 3263, 3354, 3385, 3384, 3354, 3354, 3384, 3405, 3282, 3246, 3263, 3224, 3225, 3246, 3265, 3246, 3225, 3319, 3246, 3404, 2505, 3481, 3246, 3246, 3319, 2505, 3225, 3224, 3223, 3224, 3227, 3223, 3223, 3227, 3274, 3223, 3274, 1764, 3227, 1762, 3274, 3227, 3224, 3226, 2897, 1762, 3227, 3244, 2897, 3227, 3226, 3244, 3227, 1762, 2897, 1292, 3228, 1292, 2897, 3228, 2897, 3244, 3245, 3244, 3226, 3244, 3248, 3228, 3245, 3248, 3244, 3245, 3226, 3491, 3224, 3496, 3226, 3245, 3491, 3490, 3266, 3248, 3245, 2782, 3266, 3245, 3266, 3247, 3248, 3479, 3343, 3266, 3343, 3247, 3266, 3266, 3490, 3479, 3478, 3343, 3479, 3343, 3329, 3477, 3343, 3478, 3329, 1620, 3329, 343, 1620, 3155, 3329, 343, 3329, 342, 3476, 3329, 3155, 1620, 343, 1619, 2697, 1620, 2696, 1620, 2697, 3155, 343, 342, 341, 1619, 343, 341, 341, 342, 3306, 3337, 341, 3336, 341, 3306, 2782, 3462, 2782, 3336, 2506, 2782, 2505, 2782, 3481, 3480, 2506, 2505, 2504, 3416, 2506, 2504, 2504, 2505, 3319, 2504, 3319, 3318, 3384, 2504, 3464, 3416, 3468, 3384, 2697, 1637, 3155, 2697, 2696, 1637, 2801, 1637, 2696, 2801, 2696, 2800, 3454, 2801, 2800, 3454, 2800, 3453, 3422, 3474, 3454, 3398, 3410, 3422, 3410, 3474, 3422, 3410, 3426, 3474, 3398, 3386, 3410, 3386, 3401, 3410, 3401, 3426, 3410, 3377, 3386, 3398, 3368, 3386, 3377, 3368, 3390, 3386, 3386, 3390, 3401, 3367, 3368, 3377, 73, 3368, 3367, 611, 3368, 73, 3368, 611, 3390, 611, 3186, 3390, 3390, 3186, 3299, 3390, 3299, 3401, 611, 610, 609, 2221, 610, 611, 611, 609, 3186, 2221, 611, 73, 3186, 609, 3185, 3185, 3299, 3186, 3300, 3299, 3185, 3300, 3401, 3299, 3300, 3176, 3401, 3176, 3423, 3401, 3401, 3423, 3426, 3178, 3177, 3176, 2254, 2275, 3176, 3176, 2275, 3423, 2254, 3176, 3177, 2275, 3254, 3423, 2273, 2120, 2275, 3254, 2275, 2120, 2273, 2275, 2254, 2250, 2212, 2254, 2273, 2254, 2212, 2254, 3177, 2250, 2212, 2022, 2273, 2273, 2022, 2020, 2020, 2120, 2273, 2120, 2020, 1614, 1614, 1615, 2120, 2120, 1615, 3254, 1615, 1614, 1613, 2020, 2121, 1614, 2121, 1345, 1614, 1614, 1345, 1613, 1613, 1232, 1615, 1613, 503, 1232, 1345, 503, 1613, 502, 503, 1345, 2121, 502, 1345, 2020, 2122, 2121, 2020, 2126, 2122, 2021, 2126, 2020, 2429, 2126, 2021, 2022, 2021, 2020, 2022, 2212, 2195, 2250, 2249, 2212, 2212, 2249, 2195, 2196, 2195, 2194, 2195, 2554, 2194, 503, 502, 501, 502, 524, 501, 503, 1233, 1232, 501, 524, 1282, 609, 2257, 2288, 2257, 609, 2560, 610, 2243, 2257, 2257, 2263, 2262, 2262, 2282, 2257, 2257, 2282, 2288, 2288, 2299, 2312, 2288, 2282, 2299, 2262, 2283, 2282, 2282, 2283, 2299, 2263, 2264, 2262, 2263, 2265, 2264, 2220, 2265, 2560, 2221, 2220, 610, 2220, 2727, 2244, 610, 2244, 2243, 2299, 2322, 2312, 2322, 2353, 2312, 75, 74, 73, 74, 3161, 73, 73, 3367, 75, 75, 3128, 74, 74, 2700, 2717, 3036, 74, 3035, 2717, 3161, 74, 3035, 74, 3191, 2702, 2701, 2700, 1422, 1292, 3228, 3228, 1389, 1422, 347, 1422, 1389, 1292, 1422, 347, 347, 1389, 1006, 789, 347, 1006, 3238, 3237, 3230, 3230, 3237, 3229, 3240, 3238, 3046, 3046, 3238, 3230, 3234, 3235, 3238, 3167, 3230, 3229, 2828, 3230, 3167, 3046, 3230, 2828, 3167, 3229, 3278, 3229, 3486, 3278, 3167, 3278, 3166, 3486, 3166, 3278, 3168, 3167, 3166, 3168, 3166, 2763, 3489, 3488, 3166, 3488, 2763, 3166, 2447, 3168, 2761, 2763, 2761, 3168, 2448, 3167, 3168, 2448, 3168, 2447, 2763, 2762, 2761, 2763, 3488, 2762, 3492, 3485, 3488, 3492, 3488, 3489, 3488, 3485, 2762, 2444, 2445, 2762, 2761, 2762, 2445, 3485, 2444, 2762, 3492, 2444, 3485, 2761, 2445, 1407, 1408, 433, 1407, 434, 759, 1407, 1408, 1407, 3260, 434, 1407, 433, 759, 2761, 1407, 434, 433, 432, 760, 759, 434, 434, 808, 760, 808, 434, 432, 1490, 808, 432, 2222, 432, 433, 2222, 2366, 432, 432, 2366, 1490, 808, 1490, 1439, 808, 1439, 1437, 1289, 808, 1437, 760, 808, 1289, 759, 760, 1289, 1437, 1739, 1289, 1739, 3293, 1289, 3293, 759, 1289, 1439, 1438, 1437, 1437, 1438, 1650, 1739, 1437, 1650, 1439, 1081, 1438, 1490, 1081, 1439, 1438, 1081, 1082, 1650, 1438, 1820, 1438, 1082, 1820, 1655, 1650, 1654, 1650, 1655, 1739, 1650, 1820, 1654, 1655, 3293, 1739, 1655, 1654, 1671, 1772, 1655, 1671, 1772, 3293, 1655, 1654, 1820, 1828, 1654, 1828, 3014, 3014, 1671, 1654, 1820, 1082, 1885, 1828, 1820, 1885, 1828, 3043, 3014, 1885, 3043, 1828, 3021, 1885, 1213, 3021, 3031, 1885, 3031, 3043, 1885, 1213, 1885, 1082, 1082, 1080, 1213, 1213, 1080, 1394, 1394, 3021, 1213, 1082, 1081, 1080, 1737, 1736, 1080, 1755, 1737, 1080, 1081, 1755, 1080, 1080, 1736, 1394, 1394, 1393, 1392, 1736, 1393, 1394, 1394, 1392, 3021, 1736, 1085, 1393, 1737, 1667, 1736, 1667, 1085, 1736, 1756, 1667, 1737, 1756, 1737, 1755, 1081, 1756, 1755, 1490, 1756, 1081, 1490, 2366, 1756, 2366, 1669, 1756, 1669, 1667, 1756, 1669, 1668, 1667, 1668, 1754, 1667, 1667, 1754, 1085, 1668, 1669, 1774, 2960, 2961, 1669, 2960, 1669, 2982, 2982, 1669, 2366, 2953, 2366, 2222, 2982, 2366, 2953, 2960, 2982, 2953, 2934, 2953, 2818, 2934, 2960, 2953, 2818, 2953, 2222, 2223, 2222, 433, 2818, 2222, 2223, 1343, 2818, 1342, 260, 2818, 1343, 2934, 2818, 260, 2818, 2223, 1342, 2223, 433, 1342, 1408, 1342, 433, 1344, 1343, 1342, 1344, 1342, 1534, 1342, 1408, 1534, 1343, 1485, 260, 1344, 1551, 1343, 252, 250, 260, 1235, 252, 260, 250, 2934, 260, 252, 251, 250, 252, 351, 251, 545, 252, 1224, 545, 351, 252, 251, 263, 250, 351, 263, 251, 351, 281, 263, 546, 281, 351, 545, 546, 351, 281, 280, 263, 280, 1822, 263, 263, 1822, 250, 281, 746, 280, 1159, 746, 281, 546, 1159, 281, 547, 546, 545, 547, 1159, 546, 1159, 348, 746, 1411, 1159, 1410, 1410, 1159, 547, 1411, 348, 1159, 746, 348, 745, 746, 822, 280, 746, 745, 822, 823, 822, 745, 349, 745, 348, 349, 823, 745, 823, 1276, 822, 280, 822, 1629, 1629, 822, 1276, 2388, 1276, 1454, 1276, 823, 1454, 1821, 1276, 2388, 1629, 1276, 1821, 1629, 1822, 280, 1822, 1629, 1821, 1823, 1822, 1821, 2904, 1822, 1823, 1822, 2904, 2929, 1822, 2929, 250, 3045, 2904, 1823, 2904, 2932, 2929, 2904, 2933, 2932, 2933, 2904, 3045, 2929, 2934, 250, 2929, 2932, 2934, 2932, 2960, 2934, 2933, 2960, 2932, 2933, 2961, 2960, 1455, 2388, 1454, 1455, 1454, 1453, 1453, 1919, 1455, 1454, 823, 1453, 1457, 1453, 823, 1907, 1457, 823, 823, 349, 1996, 350, 349, 348, 499, 348, 498, 499, 1425, 348, 498, 348, 1411, 500, 499, 498, 1458, 1486, 499, 500, 1458, 499, 34, 500, 592, 1458, 500, 34, 500, 498, 592, 1459, 1458, 1457, 32, 1457, 1458, 32, 1458, 34, 32, 1908, 1457, 1457, 1919, 1918, 1457, 1920, 1919, 1908, 1920, 1457, 34, 33, 32, 32, 33, 1909, 32, 1910, 1908, 1908, 1921, 1920, 1922, 1921, 1908, 33, 1160, 1167, 33, 1167, 1911, 1160, 33, 34, 1061, 1160, 1072, 1167, 1160, 1061, 1160, 34, 1072, 1167, 806, 807, 806, 1167, 1061, 807, 2230, 1167, 1062, 806, 1061, 1061, 1072, 1062, 683, 807, 806, 683, 806, 1033, 1033, 806, 1062, 684, 807, 683, 2902, 807, 2901, 684, 683, 682, 924, 1062, 1066, 1066, 1062, 1072, 925, 1062, 924, 1073, 924, 1066, 1144, 1066, 1143, 1066, 1072, 1143, 1073, 1066, 1144, 1143, 1072, 592, 34, 592, 1072, 1144, 1143, 1448, 592, 1448, 1143, 1448, 1121, 1144, 1073, 1144, 1121, 1448, 1452, 1121, 592, 498, 1448, 1448, 498, 1452, 1122, 1073, 1121, 1121, 1452, 1451, 1121, 1451, 1122, 1452, 1410, 1451, 1452, 1411, 1410, 498, 1411, 1452, 1451, 1864, 1881, 1451, 1456, 1864, 1410, 1456, 1451, 1881, 1122, 1451, 1410, 547, 1456, 1456, 681, 1864, 1456, 547, 681, 1881, 1864, 1137, 1864, 681, 277, 277, 1137, 1864, 1137, 1122, 1881, 1137, 1136, 1122, 3233, 3239, 1137, 3233, 1137, 277, 3239, 1136, 1137, 279, 278, 277, 277, 681, 279, 278, 3233, 277, 279, 681, 545, 681, 547, 545, 279, 545, 1000, 1534, 279, 1344, 279, 1534, 278, 279, 1886, 1344, 526, 525, 278, 278, 525, 3233, 1534, 526, 278, 1408, 3280, 1534, 3280, 526, 1534, 3280, 3260, 526, 3260, 3311, 526, 526, 3311, 525, 525, 3239, 3233, 525, 3311, 3239, 3311, 1634, 3239, 3239, 3162, 1136, 1634, 3162, 3239, 1634, 1633, 1632, 1634, 1632, 3162, 1632, 1433, 3162, 3162, 1433, 1436, 3162, 1436, 1136, 1136, 410, 1189, 1436, 410, 1136, 1136, 1189, 1122, 410, 1436, 1433, 423, 1433, 614, 1433, 423, 410, 614, 1433, 1632, 1633, 614, 1632, 615, 423, 614, 615, 614, 1633, 615, 1633, 1308, 615, 425, 423, 615, 816, 425, 1308, 816, 615, 425, 424, 423, 424, 409, 423, 423, 409, 410, 411, 410, 409, 409, 603, 602, 409, 602, 411, 599, 600, 409, 600, 603, 409, 603, 924, 602, 924, 603, 1542, 602, 924, 411, 926, 925, 924, 924, 1073, 411, 1189, 1073, 1122, 1189, 411, 1073, 410, 411, 1189, 601, 600, 599, 601, 816, 857, 857, 816, 859, 1204, 859, 816, 859, 858, 857, 859, 1147, 1068, 859, 1068, 858, 1374, 1147, 859, 1204, 1374, 859, 1205, 1204, 1203, 1205, 1374, 1204, 1374, 1353, 1147, 1353, 1374, 1205, 1312, 1147, 1353, 1312, 1353, 1331, 1331, 1353, 1205, 1332, 1312, 1331, 1382, 1331, 1205, 1382, 1332, 1331, 1341, 1312, 1332, 1385, 1341, 1332, 1172, 1332, 1382, 1172, 1385, 1332, 1172, 1382, 1171, 1171, 1382, 1205, 1173, 1172, 1171, 1188, 1386, 1172, 1173, 1188, 1172, 1386, 1385, 1172, 1386, 1341, 1385, 1402, 1367, 1386, 1367, 1341, 1386, 1315, 1524, 1386, 1188, 1315, 1386, 1367, 1340, 1341, 1370, 1367, 1449, 1367, 1473, 1340, 1370, 1473, 1367, 1473, 1370, 1340, 1341, 1340, 1312, 1340, 1162, 1163, 1340, 1370, 1162, 1340, 1163, 1312, 1312, 1163, 1311, 1312, 1146, 1147, 1311, 1146, 1312, 1163, 1162, 1161, 1163, 1161, 1311, 1311, 1161, 1202, 1311, 1202, 1146, 1147, 1146, 1145, 1145, 1146, 1202, 1147, 1145, 1068, 1145, 1202, 1067, 1068, 1145, 1067, 1202, 1197, 1421, 1161, 1197, 1202, 1202, 1421, 1067, 1161, 1175, 1197, 1162, 1175, 1161, 1197, 1175, 1321, 1421, 1197, 1135, 1135, 1197, 1506, 1197, 1321, 1506, 1544, 1321, 1175, 1795, 1794, 1321, 1506, 1321, 1863, 1321, 1794, 1863, 1135, 1506, 832, 1506, 1863, 832, 1794, 1849, 1863, 1863, 1849, 758, 1863, 758, 815, 832, 1863, 815, 1855, 1507, 1794, 1507, 1849, 1794, 1149, 1507, 1148, 1148, 1507, 1509, 1507, 1149, 1849, 1150, 1149, 1148, 1150, 419, 1149, 1149, 419, 1849, 1148, 1401, 1175, 1409, 1148, 1175, 1150, 1148, 1409, 1113, 1150, 1409, 1309, 419, 1150, 1309, 1150, 1113, 1351, 1113, 1409, 1176, 1409, 1175, 1351, 1409, 1375, 1176, 1375, 1409, 1176, 1175, 1174, 1162, 1174, 1175, 1412, 1176, 1174, 1412, 1375, 1176, 1368, 1351, 1375, 1368, 1375, 1412, 1370, 1376, 1412, 1368, 1412, 1376, 1370, 1412, 1162, 1412, 1174, 1162, 1371, 1291, 1370, 1291, 1164, 1370, 1164, 1376, 1370, 1165, 1376, 1164, 1165, 1368, 1376, 1166, 1165, 1164, 1291, 1290, 1164, 1290, 1166, 1164, 1325, 1290, 1291, 1325, 1291, 1314, 1314, 1291, 1589, 521, 1290, 538, 1325, 538, 1290, 1290, 521, 1166, 523, 522, 521, 539, 521, 538, 523, 521, 539, 1058, 521, 522, 521, 1058, 1166, 911, 538, 1325, 911, 539, 538, 911, 910, 539, 956, 539, 910, 956, 523, 539, 1307, 1366, 911, 1307, 911, 1182, 911, 1366, 910, 1182, 911, 1325, 1187, 956, 910, 1366, 1187, 910, 956, 534, 523, 302, 956, 1187, 302, 534, 956, 445, 301, 1187, 1042, 1187, 1366, 1187, 301, 302, 445, 1187, 1042, 303, 302, 301, 303, 534, 302, 362, 301, 361, 362, 303, 301, 301, 445, 361, 965, 361, 445, 445, 1042, 965, 965, 1042, 941, 1042, 1366, 941, 576, 965, 941, 845, 361, 965, 576, 845, 965, 453, 299, 361, 299, 362, 361, 453, 361, 845, 496, 845, 576, 496, 453, 845, 817, 298, 453, 497, 453, 496, 298, 299, 453, 817, 453, 497, 300, 299, 298, 585, 362, 299, 300, 585, 299, 98, 585, 300, 786, 98, 300, 1022, 786, 300, 300, 298, 1022, 99, 362, 585, 98, 99, 585, 99, 303, 362, 100, 99, 98, 100, 303, 99, 787, 98, 786, 2089, 98, 787, 2089, 100, 98, 486, 385, 100, 385, 386, 100, 100, 386, 303, 100, 2089, 486, 386, 534, 303, 386, 385, 384, 384, 534, 386, 384, 385, 442, 385, 460, 442, 486, 699, 385, 699, 460, 385, 699, 486, 2006, 2089, 2006, 486, 650, 460, 699, 1037, 1025, 699, 699, 2006, 1037, 699, 1025, 650, 2089, 1031, 2006, 1037, 2006, 1031, 1031, 895, 1037, 895, 1025, 1037, 1032, 895, 1031, 787, 1727, 1031, 787, 1031, 2089, 1727, 1032, 1031, 895, 894, 893, 895, 1015, 1025, 894, 895, 1032, 895, 893, 1015, 935, 893, 894, 894, 1032, 2127, 960, 894, 2127, 894, 960, 935, 893, 935, 982, 893, 982, 1015, 982, 1016, 1015, 1015, 709, 1025, 1015, 1016, 709, 935, 861, 982, 982, 861, 998, 982, 998, 1016, 1016, 998, 791, 709, 1016, 791, 710, 709, 708, 791, 708, 709, 1025, 709, 710, 710, 708, 1025, 708, 650, 1025, 791, 586, 708, 708, 586, 650, 791, 790, 586, 998, 790, 791, 586, 257, 480, 259, 257, 586, 739, 259, 586, 790, 739, 586, 586, 480, 650, 480, 460, 650, 480, 479, 460, 257, 479, 480, 259, 258, 257, 257, 258, 768, 768, 479, 257, 327, 258, 259, 739, 327, 259, 741, 740, 739, 740, 327, 739, 741, 739, 790, 327, 326, 325, 327, 740, 326, 327, 325, 258, 740, 135, 326, 740, 144, 135, 144, 740, 741, 983, 999, 741, 983, 741, 790, 741, 999, 144, 144, 143, 135, 999, 143, 144, 983, 66, 999, 999, 66, 130, 143, 999, 130, 143, 134, 135, 143, 130, 134, 130, 64, 38, 66, 64, 130, 134, 130, 38, 135, 134, 133, 134, 38, 19, 133, 134, 19, 19, 38, 18, 64, 267, 38, 38, 267, 18, 66, 65, 64, 65, 107, 64, 64, 107, 267, 18, 267, 81, 267, 107, 196, 267, 196, 81, 19, 18, 17, 17, 18, 82, 18, 81, 82, 72, 82, 81, 72, 81, 71, 196, 71, 81, 71, 196, 195, 107, 948, 196, 195, 196, 948, 72, 71, 70, 338, 71, 195, 70, 71, 338, 2026, 338, 195, 2026, 195, 948, 6, 1947, 948, 948, 1947, 1964, 2026, 948, 1964, 6, 948, 107, 1964, 1947, 1963, 1989, 1947, 1971, 1947, 370, 1971, 370, 1947, 6, 1964, 1963, 1962, 1963, 2051, 2050, 1720, 1962, 1963, 1962, 2851, 1964, 1962, 1720, 1718, 1962, 2903, 2917, 1720, 1719, 1718, 2887, 2903, 1718, 2903, 2915, 1718, 2888, 2887, 2886, 2882, 2887, 2888, 2882, 2903, 2887, 2886, 2895, 2894, 2898, 2903, 2882, 2903, 2898, 2772, 2903, 2772, 2773, 2903, 2773, 2918, 2872, 2898, 2882, 2872, 2896, 2898, 2898, 2896, 2772, 2773, 2772, 2771, 2772, 2835, 2907, 2896, 2835, 2772, 2872, 2877, 2896, 2877, 2883, 2896, 2896, 2883, 2908, 2896, 2908, 2835, 2867, 2860, 2877, 2860, 2864, 2877, 2867, 2877, 2872, 2877, 2864, 2883, 2839, 2860, 2867, 2839, 2867, 2872, 2839, 2840, 2860, 2860, 2840, 2864, 2864, 2825, 2826, 2864, 2826, 2883, 2840, 2931, 2864, 2825, 2864, 2931, 2841, 2840, 2839, 2840, 2355, 2235, 2840, 2235, 2931, 2841, 2355, 2840, 2825, 2931, 2930, 2931, 2235, 2956, 2931, 2956, 2930, 2827, 2826, 2825, 2825, 2930, 2827, 2826, 2827, 2883, 2883, 2827, 2909, 2827, 1228, 2909, 2827, 2930, 2986, 2827, 3062, 1228, 2883, 2909, 2908, 2908, 2909, 2441, 1228, 2441, 2909, 2908, 2441, 2835, 2442, 2441, 2440, 2440, 2441, 2599, 2441, 1944, 2599, 2835, 2441, 2442, 2441, 1228, 1944, 2442, 2814, 2835, 2835, 2814, 2905, 2814, 2769, 2613, 2442, 2769, 2814, 2916, 2814, 2613, 2442, 2751, 2769, 2613, 2769, 2026, 2751, 2789, 2769, 2769, 2789, 2026, 2614, 2613, 1964, 2613, 2026, 1964, 2026, 2789, 338, 2751, 2647, 2789, 2647, 2815, 2789, 2789, 2815, 338, 2442, 2647, 2751, 2646, 2449, 2647, 2646, 2647, 2442, 2647, 2695, 2815, 2449, 2695, 2647, 2749, 70, 2815, 2695, 2749, 2815, 2815, 70, 338, 2449, 2667, 2695, 2695, 2667, 2749, 2667, 1721, 2749, 2749, 1721, 70, 94, 72, 70, 70, 1721, 94, 1723, 1722, 1721, 1721, 316, 94, 1721, 1722, 316, 2667, 1723, 1721, 2667, 2378, 1723, 2449, 2378, 2667, 1723, 842, 2428, 1723, 2428, 1722, 844, 842, 1723, 2378, 844, 1723, 1722, 2384, 124, 1722, 124, 316, 2428, 2384, 1722, 110, 94, 316, 316, 124, 110, 124, 111, 110, 340, 208, 124, 208, 111, 124, 2384, 340, 124, 111, 72, 110, 94, 110, 72, 201, 111, 208, 111, 105, 72, 105, 111, 201, 371, 201, 208, 340, 371, 208, 202, 105, 201, 202, 201, 824, 371, 824, 201, 72, 105, 82, 17, 82, 105, 202, 17, 105, 268, 17, 202, 949, 202, 824, 949, 268, 202, 872, 824, 371, 997, 996, 824, 824, 996, 949, 871, 949, 978, 871, 268, 949, 978, 949, 996, 2101, 996, 2099, 2101, 978, 996, 2099, 996, 2114, 2101, 2093, 978, 2111, 978, 2093, 2112, 871, 978, 2086, 2093, 2101, 2086, 2101, 2092, 2092, 2101, 2099, 2082, 1495, 2086, 1495, 2093, 2086, 2082, 2086, 2092, 2072, 2082, 2092, 2072, 2092, 2091, 2092, 2099, 2091, 2072, 2060, 2082, 2060, 1495, 2082, 2067, 2068, 2072, 2067, 2072, 2071, 2068, 2060, 2072, 2072, 2091, 2071, 2091, 2090, 2071, 2091, 372, 2090, 2099, 372, 2091, 2071, 2090, 2081, 2090, 2095, 2081, 2090, 373, 2095, 2090, 372, 373, 373, 372, 371, 372, 971, 371, 2099, 2110, 372, 373, 371, 340, 931, 373, 340, 2095, 373, 2105, 2105, 373, 931, 2081, 2095, 2094, 2095, 2105, 2094, 2310, 2094, 2105, 931, 2310, 2105, 340, 2588, 931, 931, 2509, 2310, 2588, 2509, 931, 2384, 2588, 340, 2384, 2509, 2588, 2510, 2509, 2384, 2385, 2509, 2510, 2509, 2626, 2757, 2509, 2385, 2626, 2509, 2757, 2310, 2757, 2892, 2310, 2310, 2900, 2094, 2757, 2753, 2756, 2757, 2626, 2753, 2754, 2753, 2550, 2552, 2753, 2626, 2552, 2550, 2753, 2552, 2551, 2550, 2752, 2550, 2073, 2550, 2748, 2073, 2550, 2551, 2748, 2374, 2551, 2552, 2626, 2373, 2552, 2373, 2374, 2552, 2432, 2373, 2626, 2385, 2432, 2626, 2375, 2374, 2373, 2375, 2373, 2433, 2432, 2433, 2373, 2385, 2433, 2432, 2387, 2386, 2385, 2387, 2385, 2428, 2386, 2433, 2385, 2428, 2385, 2510, 2386, 2466, 2433, 2649, 2433, 2466, 2649, 2375, 2433, 843, 2386, 2387, 843, 2466, 2386, 842, 2387, 2428, 843, 2387, 842, 2428, 2510, 2384, 844, 843, 842, 843, 844, 2360, 843, 2360, 2466, 2466, 2360, 2649, 2906, 2375, 2649, 2906, 2649, 2893, 2893, 2649, 2360, 2783, 2893, 2360, 844, 2783, 2360, 2378, 2783, 844, 2329, 2783, 2328, 2381, 2328, 2783, 2376, 2783, 2378, 2381, 2783, 2376, 2893, 2783, 2329, 2329, 2906, 2893, 2329, 2328, 2327, 2566, 2906, 2329, 2566, 2329, 2327, 2381, 2382, 2328, 2327, 2328, 2382, 2383, 2382, 2381, 2383, 2381, 2376, 2378, 2377, 2376, 2377, 2610, 2376, 2610, 2383, 2376, 2383, 2610, 2382, 2337, 2327, 2382, 2382, 2450, 2337, 2382, 2610, 2450, 2655, 2610, 2377, 2655, 2450, 2610, 2449, 2377, 2378, 2449, 2645, 2377, 2645, 2655, 2377, 2655, 1180, 2450, 2640, 1180, 2655, 2640, 2655, 2645, 2646, 2640, 2645, 2646, 2645, 2449, 2641, 2640, 2599, 2641, 1179, 2640, 1180, 2640, 1179, 2599, 2640, 2646, 1181, 1180, 1179, 1180, 2983, 1798, 2450, 1180, 1798, 2641, 2544, 1179, 3200, 1179, 2241, 1179, 2544, 2241, 2544, 1494, 63, 2544, 1201, 1494, 2641, 1201, 2544, 2241, 2544, 63, 63, 2242, 2241, 2242, 2673, 2241, 2242, 1745, 1807, 2689, 2242, 1807, 63, 1745, 2242, 1747, 1746, 1745, 1745, 63, 61, 1746, 1807, 1745, 1747, 1745, 61, 2460, 1746, 1747, 2461, 2460, 1747, 61, 2155, 1747, 2582, 1814, 1746, 1746, 1814, 1807, 2460, 2582, 1746, 2582, 1816, 1814, 1786, 2582, 2460, 1786, 2568, 2582, 2568, 1816, 2582, 1816, 1815, 1814, 1814, 1815, 1692, 1814, 1692, 1807, 2567, 2817, 1816, 2568, 2567, 1816, 1816, 2899, 1815, 2639, 1659, 1815, 1815, 1657, 1692, 1659, 1657, 1815, 1659, 1658, 1657, 2770, 2389, 1659, 2389, 1658, 1659, 2485, 1657, 2468, 2485, 1692, 1657, 1658, 2468, 1657, 1658, 2389, 127, 1658, 125, 2468, 127, 125, 1658, 2469, 2468, 2467, 2468, 125, 2467, 2468, 2469, 2566, 2468, 2566, 2485, 127, 126, 125, 125, 2063, 2467, 125, 126, 2063, 127, 2758, 126, 2389, 2758, 127, 2251, 2063, 126, 126, 2622, 2630, 2758, 2622, 126, 126, 2630, 2251, 2065, 2064, 2063, 2251, 2065, 2063, 2467, 2063, 2064, 2064, 2469, 2467, 2064, 2767, 2836, 2064, 2768, 2767, 2064, 2836, 2469, 2768, 2064, 2065, 2065, 2252, 2390, 2251, 2252, 2065, 2768, 2065, 2390, 2768, 2390, 2767, 2766, 2767, 2390, 2766, 2836, 2767, 2836, 2906, 2566, 2836, 2566, 2469, 2906, 2836, 2766, 2374, 2766, 2390, 2766, 2374, 2375, 2906, 2766, 2375, 2374, 2390, 2573, 2374, 2573, 2551, 2573, 2572, 2551, 2390, 2572, 2573, 2572, 2748, 2551, 2542, 1791, 2572, 2572, 1791, 2721, 2390, 2542, 2572, 2572, 2721, 2748, 2073, 2748, 1105, 2721, 1105, 2748, 1791, 1789, 2721, 2721, 1789, 1105, 1107, 1106, 1105, 1105, 1106, 828, 1105, 1789, 1107, 2862, 1105, 828, 2073, 1105, 2914, 1791, 1790, 1789, 2837, 1107, 1789, 1791, 1701, 2776, 2543, 1701, 1791, 2543, 1791, 2542, 1702, 1701, 1700, 1701, 1732, 1700, 2391, 1732, 1701, 2391, 1701, 2543, 2391, 2543, 2542, 2391, 2542, 2390, 2252, 2391, 2390, 2252, 2457, 2391, 2457, 1732, 2391, 2253, 2252, 2251, 2253, 2457, 2252, 2630, 2631, 2253, 2630, 2253, 2251, 2253, 2711, 2712, 2253, 2712, 2457, 2631, 2711, 2253, 2622, 2631, 2630, 2631, 2737, 2711, 2620, 2631, 2622, 2911, 2631, 2620, 2631, 2911, 2737, 1638, 2712, 2711, 1638, 2711, 2737, 2457, 2712, 1638, 1639, 1638, 662, 2457, 1638, 1639, 662, 1638, 661, 1638, 2737, 661, 2737, 2911, 1697, 1697, 661, 2737, 662, 661, 660, 660, 661, 1698, 1698, 661, 1697, 1662, 662, 660, 1639, 662, 1662, 1660, 1662, 660, 1707, 1660, 660, 1707, 660, 1677, 1677, 660, 1698, 1698, 1697, 964, 964, 962, 1698, 1677, 1698, 962, 964, 1697, 2911, 964, 963, 962, 964, 2911, 3018, 963, 964, 3017, 964, 3018, 3017, 1714, 1677, 962, 1714, 962, 963, 1713, 1714, 963, 963, 3017, 1713, 1713, 3017, 1802, 3017, 3028, 3027, 3017, 3027, 1802, 3018, 3028, 3017, 1715, 1714, 1713, 1715, 1713, 1802, 1676, 1677, 1714, 1824, 1714, 1715, 1676, 1714, 1824, 1715, 1083, 1084, 1824, 1715, 1084, 1802, 1083, 1715, 1711, 1676, 1824, 1711, 1824, 1084, 1085, 1084, 1083, 1085, 1754, 1084, 1754, 1711, 1084, 1085, 1083, 1631, 1083, 2936, 1631, 1802, 2936, 1083, 1392, 1085, 1631, 1393, 1085, 1392, 1392, 1631, 3021, 1631, 3026, 3021, 2936, 3026, 1631, 3026, 3037, 3021, 3037, 3031, 3021, 2936, 3037, 3026, 2936, 3032, 3037, 3037, 3049, 3031, 3037, 3032, 3049, 3031, 3048, 3043, 3031, 3058, 3048, 3049, 3058, 3031, 3032, 3059, 3049, 3049, 3075, 3058, 3049, 3078, 3075, 3059, 3078, 3049, 3048, 3058, 3057, 3058, 3075, 3057, 3048, 3057, 3043, 3043, 3056, 3014, 3057, 3056, 3043, 3063, 3056, 3057, 3075, 3081, 3057, 3057, 3092, 3063, 3081, 3092, 3057, 3056, 3063, 3014, 3014, 3068, 1850, 3063, 3068, 3014, 1850, 1671, 3014, 3068, 3063, 3106, 3092, 3106, 3063, 3092, 3081, 3094, 3092, 3113, 3106, 3094, 3113, 3092, 3075, 3083, 3081, 3095, 3094, 3081, 3100, 3099, 3094, 3094, 3119, 3113, 3099, 3119, 3094, 3089, 3099, 3101, 3089, 3107, 3099, 3107, 3114, 3099, 3099, 3114, 3119, 3113, 3119, 3148, 3119, 3114, 3148, 3107, 3120, 3114, 3120, 3134, 3114, 3148, 3114, 3158, 3114, 3134, 3158, 3113, 3148, 3147, 3147, 3148, 3182, 3148, 3158, 3182, 3134, 3171, 3158, 3158, 3171, 2399, 3158, 2399, 3182, 3147, 3182, 1680, 3182, 2399, 1356, 3182, 1356, 3207, 2399, 2398, 1356, 3171, 3183, 2399, 2399, 3183, 2398, 3134, 3159, 3171, 3171, 3159, 3183, 3135, 3159, 3134, 3149, 3159, 3135, 3149, 3172, 3159, 3172, 3183, 3159, 3124, 3134, 3120, 3135, 3134, 3124, 3107, 3124, 3120, 3123, 3124, 3107, 3123, 3135, 3124, 3096, 3107, 3090, 3090, 3107, 3089, 3096, 3109, 3107, 3109, 3123, 3107, 3125, 3123, 3109, 3125, 3135, 3123, 3096, 3115, 3109, 3115, 3125, 3109, 3115, 3121, 3125, 3121, 3135, 3125, 3121, 3149, 3135, 3097, 3121, 3115, 3097, 3104, 3121, 3111, 3129, 3121, 3111, 3121, 3104, 3129, 3149, 3121, 3097, 3115, 3096, 3064, 3097, 3096, 3064, 3069, 3097, 3097, 3069, 3104, 3086, 3104, 3069, 3086, 3111, 3104, 3102, 3111, 3086, 3102, 3116, 3111, 3116, 3129, 3111, 3070, 3086, 3069, 3079, 3086, 3070, 3079, 3102, 3086, 3064, 3051, 3069, 3052, 3070, 3069, 3052, 3069, 3051, 3050, 3071, 3070, 3050, 3070, 3052, 3071, 3079, 3070, 3071, 3080, 3079, 3080, 3093, 3079, 3093, 3102, 3079, 3053, 3071, 3050, 3053, 3077, 3071, 3077, 3080, 3071, 3030, 3041, 3050, 3052, 3030, 3050, 3041, 3053, 3050, 3024, 3053, 3041, 3024, 3044, 3053, 3044, 3072, 3053, 3053, 3072, 3077, 3077, 3085, 3080, 3077, 3072, 3085, 3085, 3093, 3080, 3072, 2846, 3085, 3085, 3103, 3093, 3085, 2846, 3015, 3103, 3085, 3015, 3044, 2747, 3072, 3074, 3072, 2747, 3072, 3074, 2846, 3024, 2620, 3044, 2620, 2747, 3044, 2746, 2747, 2621, 2620, 2621, 2747, 2746, 3074, 2747, 2746, 2846, 3074, 2746, 2621, 2389, 2803, 2746, 2389, 2846, 2746, 3022, 2622, 2621, 2620, 2758, 2621, 2622, 2389, 2621, 2758, 2620, 3024, 2911, 2911, 3024, 3018, 3018, 3024, 3030, 3024, 3041, 3030, 3018, 3029, 3028, 3018, 3030, 3029, 3029, 3030, 3052, 3029, 3040, 3028, 3029, 3052, 3040, 3028, 3040, 3027, 3027, 3040, 3032, 3040, 3052, 3051, 3040, 3060, 3032, 3040, 3061, 3060, 3051, 3061, 3040, 1802, 3027, 2936, 3027, 3032, 2936, 3060, 3059, 3032, 3060, 3076, 3059, 3078, 3059, 3076, 3078, 3076, 3075, 3060, 3084, 3076, 3076, 3091, 3075, 3076, 3084, 3091, 3075, 3089, 3088, 3075, 3090, 3089, 3075, 3091, 3090, 3084, 3096, 3091, 3091, 3096, 3090, 3060, 3064, 3084, 3064, 3096, 3084, 3064, 3060, 3061, 3051, 3064, 3061, 2847, 1857, 2846, 1857, 3015, 2846, 1859, 1858, 1857, 3015, 1857, 1858, 3103, 3015, 3108, 3015, 1858, 2637, 3108, 3015, 215, 3015, 2637, 215, 2637, 1858, 214, 2567, 214, 1858, 2865, 2567, 1858, 215, 2637, 214, 215, 214, 213, 215, 3133, 3108, 215, 213, 3133, 2568, 214, 2567, 1787, 213, 214, 2568, 1787, 214, 3133, 213, 3152, 3152, 213, 3173, 213, 3038, 3173, 213, 1787, 3038, 3108, 3133, 3126, 3126, 3133, 3132, 3133, 3152, 3132, 3152, 3173, 3132, 3173, 3179, 3132, 3179, 3173, 3194, 3038, 3194, 3173, 3038, 1787, 1788, 3038, 2035, 3194, 3038, 1788, 2035, 3179, 3194, 3193, 3193, 3194, 3217, 2035, 3218, 3194, 2036, 2035, 2034, 2035, 2345, 2365, 2035, 2036, 2345, 1788, 2034, 2035, 2461, 2034, 2460, 2460, 2034, 1788, 2036, 2034, 2461, 2036, 2461, 2155, 2461, 2481, 2155, 2155, 61, 225, 2036, 2155, 2462, 2472, 2462, 2155, 2472, 2155, 225, 63, 62, 61, 61, 62, 225, 62, 226, 225, 226, 1888, 225, 2472, 225, 1888, 62, 1152, 1151, 1151, 226, 62, 1494, 1152, 62, 1494, 62, 63, 226, 1151, 1520, 1151, 1152, 2309, 2309, 1520, 1151, 1152, 2339, 2309, 2309, 2339, 1520, 2109, 2339, 1152, 2109, 3019, 2339, 2339, 1522, 1520, 2339, 3019, 1522, 1200, 1228, 2109, 3020, 3019, 2109, 1228, 3122, 2109, 1152, 1200, 2109, 1201, 1200, 1152, 1228, 1200, 1201, 1201, 1944, 1228, 1201, 1152, 1494, 1201, 2641, 2599, 1944, 1201, 2599, 2440, 2599, 2646, 2442, 2440, 2646, 2930, 2976, 3019, 3019, 2957, 1522, 3019, 2976, 2957, 3165, 2930, 3019, 2930, 2956, 2976, 2976, 2956, 2943, 2976, 2943, 2957, 2943, 2956, 2233, 2235, 2233, 2956, 2176, 2943, 2271, 2943, 2958, 2957, 2943, 2233, 2271, 2943, 2176, 2958, 2235, 2234, 2233, 2233, 2234, 2162, 2233, 2162, 2271, 2355, 2234, 2235, 2355, 2924, 2234, 2234, 2924, 2162, 2162, 1404, 1405, 2271, 2162, 2178, 2924, 1404, 2162, 2162, 1405, 2178, 2355, 89, 2924, 89, 2922, 2924, 2924, 2922, 1404, 2841, 89, 2355, 2841, 2839, 2831, 2841, 2831, 89, 2831, 2839, 2838, 2838, 2839, 2863, 2872, 2863, 2839, 2151, 2831, 2838, 2151, 2838, 2853, 2838, 2863, 2853, 2863, 2875, 2853, 2863, 2882, 2875, 2872, 2882, 2863, 2854, 2151, 2853, 2854, 2853, 2852, 2853, 2875, 2874, 2875, 2885, 2884, 2824, 2852, 2834, 2852, 2859, 2834, 2876, 2859, 2852, 2824, 2823, 235, 2834, 2823, 2824, 2834, 2833, 2823, 2834, 2858, 2833, 2834, 2859, 2858, 2859, 2880, 2879, 2881, 2859, 2879, 235, 234, 233, 2978, 235, 233, 2854, 3105, 2978, 2854, 2978, 507, 2151, 2854, 182, 2854, 507, 182, 508, 507, 506, 507, 508, 182, 182, 508, 184, 184, 183, 182, 182, 183, 1554, 491, 182, 490, 182, 1554, 490, 2151, 182, 491, 491, 2831, 2151, 2831, 491, 490, 91, 490, 3011, 490, 1554, 3011, 2831, 490, 91, 2831, 91, 89, 91, 90, 89, 90, 2921, 89, 89, 2921, 2922, 1405, 1404, 1403, 2920, 1404, 2919, 2178, 1405, 3160, 2179, 2178, 2177, 2175, 2178, 2211, 2271, 2178, 2175, 2178, 2989, 2177, 2176, 2175, 2174, 2176, 2271, 2175, 2175, 3195, 2174, 2971, 2176, 2174, 2979, 2958, 2176, 2979, 2176, 2304, 2176, 2971, 2304, 2971, 2174, 2177, 2174, 3181, 2177, 3006, 2971, 2984, 3006, 2304, 2971, 2984, 2971, 2177, 2984, 2177, 2938, 2988, 2596, 2177, 2938, 2177, 3005, 2177, 2596, 3219, 3006, 2984, 2938, 2962, 180, 3006, 2962, 3006, 3016, 180, 2305, 3006, 3006, 2938, 3016, 2305, 2304, 3006, 3016, 2938, 2951, 2945, 3016, 2951, 2945, 2962, 3016, 2944, 2951, 2950, 2951, 2578, 2950, 2951, 2938, 2578, 2945, 2951, 2944, 2946, 2945, 2944, 1423, 2962, 2945, 1423, 2945, 2946, 2998, 2946, 2955, 2955, 2946, 2944, 2998, 1423, 2946, 1424, 179, 1423, 1424, 1423, 2144, 2962, 1423, 179, 2144, 1423, 2998, 180, 2962, 179, 181, 180, 179, 181, 179, 1339, 1424, 2935, 179, 1339, 179, 2935, 2985, 180, 181, 2987, 2305, 180, 2985, 2987, 180, 2935, 181, 1339, 2935, 2985, 181, 2996, 2987, 2985, 2935, 2980, 2985, 2996, 2985, 2980, 1591, 2305, 2987, 3007, 2987, 2996, 2987, 3007, 1591, 2305, 1591, 2304, 1593, 1592, 1591, 1591, 1592, 2304, 3007, 1593, 1591, 3007, 1520, 1593, 1775, 3007, 2996, 1876, 1520, 3007, 1876, 3007, 1775, 2980, 1775, 2996, 1775, 2980, 917, 3013, 2980, 2935, 1804, 2980, 3013, 917, 2980, 1804, 3013, 2935, 3023, 1804, 3013, 3023, 3003, 2935, 1424, 3023, 2935, 3003, 3004, 3023, 3003, 1804, 3023, 2053, 2053, 3023, 3004, 917, 1804, 1803, 1803, 1804, 2053, 2053, 2052, 223, 1803, 2053, 223, 2053, 3004, 2052, 3004, 3003, 3002, 3004, 3002, 2052, 2052, 3002, 3000, 3002, 3003, 3000, 1583, 222, 2052, 223, 2052, 222, 2136, 2052, 3000, 1583, 2052, 2136, 2135, 3000, 2181, 3000, 3003, 2181, 2136, 3000, 2135, 2136, 2135, 1301, 1583, 2136, 1302, 1302, 2136, 1301, 2181, 2180, 2135, 2680, 1301, 2135, 2135, 2180, 2680, 1302, 1301, 473, 1301, 3039, 473, 1834, 1583, 1302, 1302, 473, 1834, 473, 472, 471, 1427, 473, 1426, 473, 471, 1426, 1834, 473, 1427, 1576, 1583, 1834, 1576, 222, 1583, 1576, 1575, 222, 224, 223, 222, 224, 222, 1575, 2269, 2268, 1575, 1575, 2268, 224, 224, 2268, 223, 2117, 1803, 223, 2268, 2117, 223, 2269, 2116, 2268, 2116, 2117, 2268, 1653, 2117, 2116, 919, 2117, 1653, 2117, 919, 1803, 917, 1803, 919, 919, 918, 917, 1236, 918, 919, 1653, 1236, 919, 918, 1027, 917, 1027, 1775, 917, 918, 1776, 1027, 2516, 918, 1236, 1776, 918, 2516, 2516, 1236, 2487, 1236, 1653, 2487, 2217, 2516, 2480, 2480, 2516, 2487, 1776, 2516, 2217, 1776, 1775, 1027, 1776, 1866, 1775, 1776, 2217, 1866, 1866, 1865, 1775, 1865, 1876, 1775, 1877, 1876, 1865, 1866, 1877, 1865, 2476, 1866, 2471, 2476, 1888, 1866, 1866, 2217, 2471, 1888, 1877, 1866, 2471, 2217, 2480, 2453, 2471, 2459, 2454, 2472, 2471, 2454, 2471, 2453, 2472, 2476, 2471, 2471, 2480, 2459, 2472, 1888, 2476, 1888, 226, 1877, 1877, 226, 1876, 226, 1520, 1876, 1522, 1521, 1520, 1593, 1520, 1521, 1521, 1522, 2957, 1593, 1521, 2977, 1521, 2957, 2977, 1593, 2977, 1592, 2957, 2958, 2977, 2304, 2977, 2979, 2977, 2958, 2979, 1592, 2977, 2304, 2454, 2462, 2472, 2345, 2454, 2453, 2345, 2036, 2454, 2454, 2036, 2462, 2347, 2346, 2345, 2345, 2453, 2452, 2452, 2347, 2345, 2942, 2345, 2346, 2453, 2459, 2452, 2347, 2452, 2451, 2452, 2458, 2451, 2452, 2459, 2470, 2452, 2470, 2458, 2459, 2480, 2470, 2451, 2470, 2475, 2458, 2470, 2451, 2470, 2487, 2475, 2470, 2480, 2487, 2451, 2475, 2398, 3183, 2451, 2398, 2451, 3183, 2347, 2475, 2479, 1356, 2475, 1356, 2398, 2487, 2479, 2475, 2479, 2487, 2497, 2487, 1653, 2497, 1356, 2479, 2486, 2479, 2497, 2486, 1357, 1356, 1355, 2486, 1355, 1356, 2497, 1355, 2486, 2497, 2536, 1355, 2497, 1653, 2536, 2536, 1653, 2549, 1653, 2116, 2549, 2536, 2541, 1355, 2536, 2549, 2541, 2541, 2549, 2565, 2549, 2116, 2565, 2565, 2116, 2577, 3183, 3192, 2347, 3192, 2346, 2347, 3172, 3163, 3183, 3163, 3192, 3183, 3163, 3193, 3192, 3192, 3193, 2346, 2346, 3193, 3215, 3163, 3179, 3193, 3140, 3163, 3149, 3164, 3163, 3140, 3163, 3172, 3149, 3180, 3179, 3163, 3132, 3179, 3184, 3116, 3132, 3130, 3126, 3132, 3116, 3132, 3151, 3130, 3110, 3116, 3102, 3110, 3126, 3116, 3116, 3130, 3129, 3130, 3140, 3129, 3130, 3150, 3140, 3129, 3140, 3149, 3110, 3108, 3126, 3093, 3110, 3102, 3093, 3108, 3110, 3103, 3108, 3093, 1427, 50, 3034, 1427, 1426, 50, 52, 51, 50, 528, 2537, 50, 528, 50, 1426, 50, 2537, 52, 471, 528, 1426, 471, 472, 528, 472, 461, 528, 1696, 1695, 528, 528, 461, 1696, 1695, 2537, 528, 472, 463, 461, 463, 462, 461, 3131, 461, 462, 461, 3154, 1696, 3154, 461, 3131, 2966, 2964, 3154, 2966, 2965, 2964, 2965, 2966, 3397, 2965, 3396, 3395, 2965, 3397, 3396, 3396, 3397, 3409, 3409, 3397, 3421, 3395, 3396, 52, 52, 3396, 3409, 52, 3415, 51, 52, 3409, 3415, 2489, 3415, 3417, 51, 3415, 2489, 3417, 3415, 3420, 3409, 3425, 3415, 3415, 3425, 3420, 2489, 3417, 1837, 1837, 3417, 3419, 3417, 3420, 3419, 3420, 3430, 3419, 3430, 3420, 3425, 3409, 3431, 3425, 3430, 3425, 3436, 3436, 3425, 3431, 3419, 3430, 3435, 3435, 3430, 3439, 3430, 3441, 3440, 3430, 3436, 3441, 3451, 3441, 3449, 3436, 3449, 3441, 3450, 3449, 3447, 3447, 3449, 3460, 3449, 3461, 3460, 3436, 3461, 3449, 3448, 3447, 3445, 3445, 3447, 3463, 3447, 3460, 3463, 3460, 3461, 2154, 3463, 3460, 2636, 3460, 2154, 2636, 3436, 2154, 3461, 3431, 3473, 3436, 3473, 2154, 3436, 3409, 3432, 3431, 3473, 3431, 3472, 3473, 3472, 3494, 2154, 3473, 3494, 3495, 3494, 3472, 3494, 2153, 2154, 3495, 2153, 3494, 2153, 3495, 3332, 2154, 2153, 2152, 2153, 3332, 2152, 2152, 3332, 3308, 2636, 2154, 2152, 2636, 2152, 2644, 2152, 3308, 1526, 1527, 2152, 1526, 2644, 2152, 1527, 3309, 3308, 3307, 1526, 3308, 3242, 1527, 1526, 1525, 1525, 1526, 3242, 3330, 1525, 3242, 3242, 3438, 3437, 3261, 1525, 2765, 3262, 1525, 3261, 1527, 1525, 3262, 1829, 3262, 3261, 2764, 3261, 2765, 3295, 3261, 2764, 1829, 3261, 3295, 1829, 1527, 3262, 1831, 1830, 1829, 1830, 1527, 1829, 3298, 1829, 3295, 1831, 1829, 3298, 1854, 3295, 2764, 3298, 3295, 1854, 3298, 1852, 3243, 1831, 3298, 3243, 3298, 1854, 1852, 3118, 1830, 1831, 3118, 1831, 3141, 1831, 3243, 3141, 3141, 3243, 980, 3243, 2308, 980, 3243, 1852, 2308, 1854, 1853, 1852, 2308, 1852, 1853, 3259, 1853, 1854, 2764, 3259, 1854, 2308, 1853, 2350, 3259, 2446, 1853, 2350, 1853, 2446, 3313, 980, 2308, 2351, 2308, 2350, 3313, 2308, 2351, 1772, 2351, 2350, 1772, 2350, 3293, 2350, 2447, 3293, 2350, 2446, 2447, 2448, 2447, 2446, 3293, 2447, 3292, 2447, 2761, 3292, 3293, 3292, 759, 3292, 2761, 759, 2589, 2448, 3287, 2590, 3167, 2448, 2764, 3287, 3259, 2589, 3287, 2764, 2765, 2589, 2764, 2765, 3296, 3047, 2591, 2589, 2765, 3047, 2591, 2765, 3047, 3046, 2828, 3047, 2828, 2591, 3047, 3240, 3046, 2591, 2590, 2589, 2591, 2828, 2590, 2828, 3167, 2590, 2590, 3286, 2589, 3259, 3291, 3290, 1772, 1771, 1770, 1850, 1771, 1772, 1671, 1850, 1772, 1770, 3313, 1772, 1772, 3313, 2351, 1771, 1799, 1770, 1850, 2845, 1771, 2845, 1799, 1771, 3068, 3098, 1850, 3098, 2845, 1850, 2528, 2845, 2844, 3098, 2844, 2845, 1770, 2845, 2528, 3068, 3106, 3098, 3106, 2844, 3098, 3106, 2623, 2844, 2623, 2528, 2844, 2528, 1466, 1770, 2623, 2618, 2528, 1466, 2528, 2618, 3147, 2623, 3106, 3147, 2808, 2623, 2808, 2619, 2623, 2623, 2619, 2618, 3113, 3147, 3106, 2808, 3147, 1680, 2502, 2808, 939, 2808, 2502, 2619, 1680, 939, 2808, 2619, 2336, 2618, 2335, 2336, 2619, 2335, 2619, 2502, 939, 937, 2502, 937, 2335, 2502, 1884, 2336, 2335, 937, 1848, 2335, 1848, 1884, 2335, 2336, 1882, 2618, 1882, 2336, 1884, 1884, 1883, 1882, 1848, 1883, 1884, 937, 1838, 1848, 1838, 1883, 1848, 1838, 3419, 1883, 1883, 3419, 3435, 1883, 3435, 981, 1883, 981, 1882, 1466, 2618, 1882, 1882, 981, 1466, 981, 980, 979, 1466, 981, 979, 981, 3435, 3452, 981, 3452, 980, 3435, 3446, 3445, 3435, 3445, 3452, 3452, 3445, 3459, 3459, 980, 3452, 979, 980, 3313, 3459, 3141, 980, 1466, 979, 1770, 1770, 979, 3313, 1799, 2503, 1770, 3118, 3141, 3459, 3463, 3459, 3445, 3463, 3118, 3459, 3118, 3463, 1830, 3463, 2636, 1830, 2636, 2644, 1830, 1830, 2644, 1527, 1837, 3419, 1838, 1838, 937, 1837, 2489, 1837, 2488, 2488, 1837, 3142, 937, 3073, 1837, 939, 938, 937, 937, 938, 3073, 1681, 939, 1680, 2809, 939, 1681, 2843, 939, 2809, 939, 2843, 938, 1682, 1681, 1680, 3201, 1682, 1680, 2491, 2493, 2488, 2488, 2512, 2511, 2488, 2511, 2489, 2492, 2491, 2490, 2511, 2527, 2489, 3136, 2489, 2527, 2512, 2513, 2511, 2527, 2548, 2547, 2527, 2562, 2561, 2527, 2547, 2562, 2561, 3136, 2527, 2562, 2547, 2586, 2561, 2562, 2586, 3432, 3409, 3421, 2680, 2180, 2679, 2181, 2650, 2180, 2180, 2706, 2679, 2679, 2719, 2718, 2731, 2730, 2718, 2682, 2730, 2732, 2683, 2682, 2681, 2682, 2683, 2691, 2691, 2683, 3001, 2683, 2144, 3001, 3001, 2144, 2998, 3001, 2998, 3153, 2981, 1424, 2144, 2683, 2981, 2144, 2181, 2981, 2683, 3003, 2981, 2181, 3003, 1424, 2981, 2652, 2651, 2181, 2652, 2181, 2683, 2652, 2683, 3190, 2955, 2999, 2998, 2955, 2944, 2952, 2944, 2950, 2952, 2578, 2997, 2950, 2580, 2579, 2578, 2938, 2937, 2578, 2997, 2578, 2579, 2594, 2579, 3157, 2596, 2595, 2594, 2596, 2594, 2992, 2597, 2595, 2596, 2596, 3214, 3213, 1788, 1787, 1786, 2460, 1788, 1786, 1786, 1787, 2568, 1712, 1676, 1711, 1754, 1712, 1711, 1753, 1749, 1712, 1761, 1753, 1712, 1712, 1749, 1676, 1761, 1712, 1754, 1677, 1676, 1675, 1748, 1675, 1676, 1748, 1676, 1749, 1811, 1748, 1749, 1753, 1811, 1749, 379, 1543, 1748, 1811, 379, 1748, 1748, 1543, 1675, 1707, 1677, 1675, 1675, 1543, 1707, 379, 369, 1543, 1543, 1660, 1707, 1543, 369, 1660, 282, 367, 369, 282, 369, 379, 367, 1552, 369, 369, 1661, 1660, 369, 1552, 1735, 1660, 1663, 1662, 1662, 2816, 1639, 1639, 1690, 2456, 2878, 1690, 1639, 2457, 1639, 2456, 191, 1690, 1689, 191, 1732, 1690, 2456, 1690, 1732, 1689, 1690, 2842, 2457, 2456, 1732, 191, 1700, 1732, 192, 1792, 1700, 1700, 191, 192, 192, 191, 190, 192, 190, 247, 247, 827, 192, 192, 1107, 1813, 827, 1107, 192, 247, 190, 1024, 1024, 190, 1069, 190, 191, 1069, 336, 249, 1024, 1024, 1069, 283, 336, 1024, 283, 249, 247, 1024, 262, 336, 335, 337, 335, 336, 336, 283, 337, 262, 249, 336, 249, 248, 247, 262, 261, 249, 261, 248, 249, 828, 827, 248, 248, 827, 247, 1827, 828, 248, 248, 261, 1827, 1352, 261, 262, 1352, 2038, 261, 261, 2038, 1827, 828, 1827, 2058, 2038, 2070, 1827, 2070, 2073, 1827, 1827, 2073, 2075, 827, 828, 1106, 827, 1106, 1107, 2070, 2074, 2073, 2074, 2094, 2073, 2094, 2204, 2073, 2070, 2081, 2074, 2081, 2094, 2074, 2071, 2081, 2070, 2046, 2071, 2066, 2067, 2071, 2046, 2066, 2071, 2070, 573, 2046, 2038, 2042, 2046, 573, 2046, 2066, 2038, 2042, 2067, 2046, 2038, 2066, 2070, 573, 2038, 1352, 417, 573, 572, 572, 573, 1352, 417, 2042, 573, 417, 2067, 2042, 417, 2068, 2067, 419, 418, 417, 417, 418, 2033, 417, 2033, 2068, 417, 572, 419, 1849, 419, 572, 1849, 572, 757, 572, 1352, 757, 757, 1352, 262, 758, 757, 262, 1849, 757, 758, 335, 758, 262, 815, 758, 335, 815, 335, 814, 335, 337, 814, 832, 815, 814, 310, 832, 814, 310, 814, 337, 284, 337, 283, 337, 284, 310, 310, 284, 309, 832, 310, 831, 1943, 310, 309, 831, 310, 1943, 1135, 832, 831, 831, 1514, 1135, 1938, 1514, 831, 831, 1943, 1938, 309, 1431, 1943, 1432, 1431, 309, 1566, 309, 284, 284, 283, 282, 284, 282, 443, 282, 368, 367, 380, 282, 379, 283, 368, 282, 368, 283, 367, 367, 283, 1069, 367, 1069, 1552, 191, 1689, 1069, 1069, 1689, 1552, 1689, 1688, 1552, 1002, 1001, 379, 1002, 379, 1811, 1753, 1002, 1811, 2760, 2759, 1002, 1002, 1860, 2760, 1753, 1860, 1002, 1761, 1860, 1753, 1773, 1860, 1761, 1860, 1773, 2755, 1860, 2775, 2774, 1860, 2755, 2775, 1668, 1761, 1754, 1668, 1773, 1761, 1668, 1774, 1773, 2755, 1773, 1774, 2760, 2785, 2784, 2760, 2784, 2790, 2784, 2821, 2820, 1938, 1937, 1514, 1937, 1421, 1514, 1937, 541, 1421, 1421, 1135, 1514, 858, 1421, 541, 1067, 1421, 858, 542, 541, 540, 541, 542, 458, 458, 542, 457, 459, 458, 457, 1018, 459, 457, 1068, 1067, 858, 418, 419, 1309, 1310, 418, 1309, 1310, 2033, 418, 1310, 1309, 1114, 1114, 1309, 1113, 1114, 1017, 1310, 1017, 1253, 1310, 2033, 1310, 2059, 2059, 1310, 1253, 2033, 2059, 2060, 2033, 2060, 2068, 2060, 2059, 1495, 1495, 2059, 1253, 570, 1112, 1253, 570, 1253, 1017, 1253, 1112, 1495, 1496, 1495, 1112, 1496, 2093, 1495, 570, 922, 1112, 1496, 1112, 922, 571, 570, 569, 570, 1017, 569, 571, 922, 570, 922, 921, 920, 922, 830, 921, 571, 830, 922, 922, 920, 1496, 1496, 920, 2093, 920, 921, 2093, 921, 2106, 2093, 830, 2107, 921, 830, 326, 829, 326, 830, 325, 258, 830, 571, 258, 325, 830, 135, 317, 326, 326, 317, 1014, 317, 135, 133, 317, 133, 871, 959, 317, 871, 133, 19, 268, 871, 133, 268, 268, 19, 17, 584, 768, 258, 571, 584, 258, 584, 571, 360, 577, 584, 360, 768, 584, 767, 577, 767, 584, 768, 767, 479, 577, 479, 767, 442, 577, 360, 460, 479, 577, 460, 577, 442, 384, 442, 484, 442, 360, 484, 484, 535, 384, 384, 535, 534, 360, 358, 484, 484, 358, 535, 535, 523, 534, 548, 522, 535, 535, 522, 523, 548, 535, 358, 360, 359, 358, 358, 359, 548, 1058, 548, 1057, 522, 548, 1058, 548, 359, 1057, 569, 359, 360, 569, 1229, 359, 359, 1237, 1057, 571, 569, 360, 569, 1381, 1545, 1017, 1381, 569, 1115, 1381, 1114, 1381, 1017, 1114, 1595, 1381, 1115, 1115, 1114, 1113, 1046, 1115, 1113, 1594, 1115, 1046, 1046, 1113, 1351, 1048, 1047, 1046, 1046, 1351, 1048, 1368, 1048, 1351, 1368, 1450, 1048, 1166, 1058, 1368, 1058, 1057, 1368, 1057, 1559, 1368, 1368, 1165, 1166, 2485, 2566, 2327, 2327, 1691, 2485, 2485, 1691, 1692, 2327, 2337, 1691, 1693, 1692, 1691, 2337, 1693, 1691, 1693, 1798, 1692, 1798, 1807, 1692, 1693, 2337, 2450, 1693, 2450, 1798, 2648, 1807, 1798, 2050, 2051, 2077, 1989, 1971, 2051, 1973, 1972, 1971, 370, 1973, 1971, 1971, 1972, 2069, 1973, 1990, 1972, 1990, 2014, 1972, 400, 401, 1990, 1961, 1990, 1973, 1577, 2024, 1990, 1577, 1990, 1961, 402, 401, 400, 554, 1995, 400, 1999, 1998, 400, 554, 553, 552, 553, 554, 1361, 1362, 1361, 1360, 1294, 1361, 1363, 1294, 553, 1361, 1270, 1294, 1268, 1268, 1294, 1337, 1270, 1347, 1294, 1347, 553, 1294, 1874, 553, 1347, 1875, 553, 1874, 1874, 1880, 1879, 1875, 1874, 1879, 401, 1875, 1889, 2078, 553, 1875, 2115, 1875, 401, 1269, 1219, 1270, 1219, 1220, 1270, 1220, 1271, 1270, 1269, 1270, 1268, 1272, 1270, 1271, 1272, 1338, 1270, 1218, 1219, 1269, 1218, 1269, 1268, 1218, 1268, 1254, 1254, 1268, 1278, 1268, 1303, 1278, 1170, 1218, 1217, 1170, 1219, 1218, 1217, 1218, 1231, 1231, 1218, 1254, 1254, 1278, 1231, 1267, 1231, 1278, 1217, 1231, 1230, 1231, 1267, 1230, 1185, 1219, 1170, 1185, 1220, 1219, 1126, 1170, 1142, 1126, 1185, 1170, 1221, 1220, 1185, 1220, 1221, 1271, 1272, 1271, 1221, 1104, 1126, 307, 365, 1126, 1104, 1126, 1142, 307, 307, 1142, 1141, 308, 236, 307, 1104, 307, 211, 307, 1108, 308, 211, 307, 236, 211, 1097, 1104, 1097, 365, 1104, 156, 211, 188, 212, 211, 156, 188, 211, 236, 212, 1097, 211, 237, 1097, 212, 237, 276, 1097, 276, 365, 1097, 189, 212, 156, 189, 237, 212, 203, 237, 189, 203, 276, 237, 366, 365, 276, 203, 366, 276, 169, 170, 203, 169, 203, 189, 170, 229, 203, 366, 203, 229, 157, 169, 189, 157, 189, 156, 171, 170, 169, 157, 171, 169, 155, 157, 156, 2168, 157, 155, 171, 157, 2168, 155, 156, 154, 154, 156, 188, 155, 154, 153, 2168, 155, 2214, 2208, 2214, 155, 2208, 155, 153, 154, 168, 153, 168, 154, 188, 188, 236, 210, 168, 188, 210, 210, 236, 227, 227, 236, 272, 1124, 272, 236, 308, 1124, 236, 168, 210, 209, 210, 227, 209, 227, 239, 238, 239, 227, 272, 227, 238, 209, 1124, 1320, 272, 239, 272, 1320, 308, 1125, 1124, 3321, 1320, 3320, 238, 239, 3372, 2359, 209, 238, 2359, 238, 3350, 238, 3372, 3350, 1796, 209, 2359, 3205, 2359, 3327, 3205, 1796, 2359, 2359, 3350, 3327, 3351, 3316, 3350, 3297, 3316, 3305, 3317, 3316, 3297, 3305, 3316, 3325, 3297, 3305, 3294, 3314, 3305, 3325, 3314, 3325, 3333, 3289, 3314, 3270, 3270, 3314, 3333, 3279, 3289, 3271, 3284, 3289, 3279, 3284, 3294, 3289, 3289, 3270, 3271, 3285, 3294, 3284, 3285, 3297, 3294, 3284, 3279, 76, 3284, 1612, 3285, 3284, 76, 1612, 3285, 1612, 2085, 2085, 3297, 3285, 2085, 3301, 3297, 3297, 3301, 2361, 3297, 2361, 3317, 1612, 856, 2085, 3301, 2085, 856, 77, 1612, 76, 1612, 855, 856, 77, 855, 1612, 856, 855, 854, 854, 2237, 856, 856, 2237, 2361, 856, 2361, 3301, 2361, 2237, 2225, 2361, 2225, 3317, 2225, 2238, 3317, 3317, 3205, 3327, 2225, 2209, 2213, 2237, 2209, 2225, 2213, 2238, 2225, 2209, 2208, 2207, 2209, 2207, 2213, 2209, 2261, 2208, 2266, 2209, 2237, 2266, 2281, 2209, 2238, 2213, 2207, 2207, 2208, 168, 1796, 2207, 168, 1796, 2238, 2207, 2208, 2215, 2214, 168, 2208, 153, 1796, 168, 1797, 1797, 168, 209, 1797, 209, 1796, 2238, 1796, 3205, 2238, 3205, 3328, 2228, 2168, 2214, 2227, 2226, 2168, 2248, 2201, 2168, 2226, 2248, 2168, 2201, 171, 2168, 2266, 2226, 2270, 1646, 2226, 2266, 1646, 2248, 2226, 2338, 1646, 2266, 2338, 2266, 2237, 1646, 1645, 312, 312, 1601, 1646, 1645, 1646, 2338, 1646, 1601, 2248, 854, 1645, 2338, 2338, 2237, 854, 311, 312, 1645, 801, 1645, 854, 311, 1645, 801, 801, 854, 855, 77, 311, 801, 801, 855, 77, 313, 312, 311, 313, 311, 697, 697, 311, 77, 78, 77, 76, 697, 77, 78, 1979, 151, 78, 151, 1623, 78, 1979, 78, 76, 1623, 697, 78, 1378, 1979, 76, 1378, 76, 3279, 150, 151, 1979, 150, 1979, 1378, 150, 1378, 167, 1378, 3042, 1585, 167, 1378, 1585, 1378, 3279, 3042, 3279, 1616, 3042, 3279, 2558, 1616, 3271, 2558, 3279, 3042, 1616, 1585, 1617, 1585, 1616, 1617, 1616, 1622, 1622, 1616, 2498, 1616, 2558, 2498, 3271, 3270, 2558, 3270, 2498, 2558, 1622, 2498, 2325, 2498, 2326, 2325, 2498, 3270, 2326, 1617, 1622, 1621, 1622, 2325, 2295, 1622, 2295, 1621, 2295, 2325, 2316, 2325, 2326, 2298, 2325, 2298, 2316, 2326, 3338, 2889, 2326, 2889, 2298, 2889, 296, 2298, 2890, 296, 2889, 296, 2484, 297, 297, 1119, 1118, 1119, 1195, 1118, 2039, 1621, 2295, 2040, 1621, 2039, 1501, 2040, 2039, 1617, 1621, 1039, 1039, 1621, 2040, 1039, 2040, 1501, 137, 1604, 1501, 1039, 1501, 1604, 93, 1039, 92, 92, 1039, 1604, 93, 1617, 1039, 3, 1585, 1617, 93, 3, 1617, 5, 93, 92, 5, 3, 93, 137, 92, 1604, 138, 92, 137, 138, 5, 92, 5, 4, 3, 288, 5, 138, 288, 4, 5, 4, 140, 3, 3, 140, 1585, 1585, 140, 141, 167, 1585, 141, 142, 141, 140, 142, 140, 4, 288, 289, 4, 1684, 142, 4, 1684, 4, 289, 1673, 288, 138, 1674, 1673, 138, 1836, 1684, 289, 1706, 142, 1684, 1836, 1835, 1684, 2707, 2744, 1836, 2707, 1705, 2745, 1705, 1630, 1801, 1630, 152, 167, 198, 152, 1630, 1717, 1630, 142, 1630, 167, 142, 152, 151, 150, 198, 151, 152, 167, 152, 150, 167, 141, 142, 198, 331, 151, 331, 1623, 151, 198, 103, 331, 67, 1624, 331, 331, 697, 1623, 1624, 697, 331, 67, 331, 103, 1626, 1624, 67, 68, 1626, 67, 1626, 697, 1624, 1626, 313, 697, 68, 313, 1626, 429, 428, 68, 1384, 429, 68, 428, 2017, 68, 2017, 313, 68, 1628, 312, 313, 2017, 1628, 313, 428, 1628, 2017, 1628, 1731, 312, 428, 1730, 1628, 1730, 1731, 1628, 1731, 1601, 312, 1600, 1731, 1730, 1600, 1601, 1731, 1738, 1600, 1730, 428, 1738, 1730, 1601, 1600, 1599, 638, 1600, 1738, 638, 1825, 1600, 1600, 1825, 1599, 1601, 1599, 2248, 1825, 2311, 1599, 1599, 2311, 2320, 2248, 1599, 2320, 929, 1825, 638, 929, 95, 1825, 1825, 95, 2311, 2311, 95, 96, 96, 2202, 2311, 2320, 2311, 2202, 2202, 2201, 2320, 2320, 2201, 2248, 2202, 171, 2201, 161, 170, 2202, 2202, 170, 171, 161, 2202, 96, 162, 161, 96, 228, 170, 161, 161, 162, 605, 228, 161, 605, 229, 170, 228, 229, 228, 2018, 228, 605, 2018, 605, 162, 604, 605, 604, 1913, 1997, 605, 1913, 2018, 605, 1997, 162, 96, 109, 162, 109, 604, 1913, 604, 102, 604, 108, 102, 604, 109, 108, 1913, 102, 1912, 1916, 1913, 1912, 1997, 1913, 1916, 1447, 1997, 1916, 1447, 2018, 1997, 1447, 1916, 1915, 1916, 1958, 1915, 1916, 1912, 1958, 366, 1447, 173, 173, 1447, 1915, 366, 2018, 1447, 1915, 1958, 172, 173, 1915, 172, 172, 1958, 1957, 1958, 1912, 2002, 1958, 2002, 1957, 173, 172, 21, 21, 172, 20, 20, 172, 166, 172, 1957, 166, 173, 1258, 366, 21, 1258, 173, 22, 21, 20, 20, 166, 22, 783, 166, 186, 186, 166, 1946, 22, 166, 783, 1957, 1946, 166, 1957, 2002, 1946, 186, 1946, 1969, 1946, 2002, 1968, 1946, 1968, 1969, 187, 186, 185, 186, 2000, 185, 783, 186, 187, 186, 1969, 2000, 22, 783, 782, 782, 783, 187, 1288, 1287, 22, 1288, 147, 1287, 145, 1287, 147, 1897, 1287, 1899, 147, 146, 145, 2005, 147, 187, 147, 782, 187, 187, 185, 165, 187, 1992, 1991, 165, 164, 163, 164, 165, 642, 165, 1045, 1044, 164, 642, 692, 737, 642, 738, 737, 692, 642, 164, 692, 691, 692, 737, 736, 691, 692, 736, 737, 747, 736, 738, 747, 737, 1079, 691, 736, 164, 691, 654, 164, 654, 653, 1400, 654, 1399, 1517, 1079, 1516, 1519, 1518, 1516, 1547, 1516, 1546, 1516, 1518, 1555, 1518, 1556, 1117, 1518, 1117, 1555, 1555, 1117, 1132, 1555, 1132, 1590, 1117, 392, 1087, 1132, 1117, 1087, 1117, 1556, 1567, 1117, 1567, 392, 1132, 1087, 1088, 1088, 1087, 1086, 1087, 392, 1286, 1087, 1286, 1263, 1086, 1087, 1263, 1086, 1263, 1264, 1264, 1263, 1262, 1263, 1286, 1262, 1286, 1190, 1242, 1286, 392, 1190, 1262, 1286, 1242, 1242, 1582, 1262, 1191, 1243, 1242, 1242, 1190, 1191, 1582, 1242, 1734, 1192, 1191, 1190, 390, 1192, 1190, 392, 390, 1190, 1430, 1429, 1192, 390, 1430, 1192, 1581, 1183, 1192, 1192, 1183, 1191, 392, 391, 390, 1127, 391, 392, 1567, 1127, 392, 1184, 1641, 1191, 1699, 1191, 1641, 1191, 1183, 1184, 1699, 1243, 1191, 1642, 1641, 1640, 1679, 1641, 1642, 1699, 1641, 1679, 1641, 1184, 1640, 1184, 1980, 1640, 1184, 1806, 1980, 1442, 1806, 1184, 647, 1442, 1441, 899, 1584, 1442, 1184, 899, 1442, 1442, 1584, 1441, 649, 648, 647, 647, 1441, 649, 2524, 2593, 1441, 2524, 1441, 1584, 1584, 1744, 1743, 1584, 899, 900, 2524, 1584, 1743, 2526, 1743, 2530, 1743, 900, 2317, 2530, 1743, 2317, 1743, 2526, 2524, 900, 899, 898, 900, 2318, 2317, 1470, 900, 898, 2317, 2318, 2530, 2318, 1914, 2530, 2318, 2056, 1914, 37, 35, 1914, 1571, 1914, 2056, 1571, 37, 1914, 2530, 1914, 2585, 1914, 35, 2585, 1570, 1571, 2056, 1572, 1571, 1570, 1571, 1929, 37, 1929, 1928, 1927, 1929, 1927, 37, 738, 1927, 1928, 1945, 37, 1927, 37, 36, 35, 37, 966, 36, 1045, 966, 37, 1966, 36, 966, 1940, 2585, 36, 1966, 1940, 36, 2585, 35, 36, 966, 1045, 2164, 1966, 966, 2164, 2500, 1966, 2164, 2500, 2164, 2675, 2715, 2164, 2725, 2164, 1045, 2358, 1966, 2500, 2499, 2138, 1966, 2499, 2138, 2499, 2302, 2499, 3082, 3008, 2302, 2499, 3008, 1478, 2138, 2137, 2138, 2302, 2137, 2138, 1940, 1966, 1940, 2138, 1478, 3054, 2137, 2302, 3009, 3054, 2302, 3009, 2302, 3008, 3010, 3009, 3008, 3127, 3010, 3008, 1480, 1479, 1478, 1479, 1940, 1478, 2013, 2012, 1478, 1478, 1414, 2013, 1480, 1478, 2012, 2012, 3174, 1480, 2526, 1479, 1480, 2526, 1480, 3174, 2526, 2530, 1479, 2530, 1940, 1479, 2526, 2525, 2524, 3174, 2525, 2526, 3170, 2525, 3174, 3170, 3169, 2525, 3156, 2524, 2525, 2524, 3156, 2593, 2593, 3156, 1878, 649, 1878, 648, 648, 1564, 1563, 1564, 648, 1862, 1563, 1564, 3373, 1940, 2530, 2585, 3204, 3203, 2012, 1415, 2013, 1414, 1415, 1414, 1413, 2358, 1045, 2357, 1045, 738, 1044, 738, 1045, 2186, 738, 779, 747, 738, 3312, 779, 2716, 2715, 2714, 2699, 2698, 2675, 1471, 1470, 898, 886, 1471, 885, 1470, 1471, 886, 886, 885, 884, 1184, 1183, 899, 899, 1183, 1581, 185, 2000, 2057, 2057, 2340, 185, 2000, 1969, 2019, 2000, 2019, 2057, 2287, 2057, 2019, 2722, 2340, 2057, 2287, 2793, 2057, 2726, 2340, 2722, 2724, 2723, 2722, 2795, 2287, 2019, 2795, 2804, 2287, 2287, 2811, 2810, 2797, 2796, 2795, 2795, 2019, 2011, 2796, 2802, 2795, 2795, 2802, 2804, 2810, 2804, 2891, 2804, 2802, 3216, 2798, 2802, 2796, 2813, 2819, 2802, 2802, 2819, 2832, 2891, 2802, 2832, 2799, 2798, 2796, 426, 2832, 2819, 426, 2819, 2813, 2813, 2812, 426, 264, 427, 426, 2812, 2822, 426, 426, 2822, 264, 266, 265, 264, 266, 2868, 265, 1969, 1967, 2011, 2019, 1969, 2011, 2004, 2011, 1967, 2004, 1894, 2011, 2011, 1894, 2794, 1969, 1968, 1967, 1965, 1968, 2003, 2002, 2044, 1968, 1967, 1968, 1965, 1965, 132, 469, 1965, 1988, 86, 1967, 1965, 469, 1965, 86, 132, 88, 87, 86, 132, 86, 1549, 1549, 86, 1955, 86, 87, 1956, 102, 101, 87, 101, 1960, 87, 1912, 102, 87, 1912, 87, 2025, 108, 101, 102, 108, 733, 101, 101, 734, 1959, 101, 733, 734, 109, 97, 108, 108, 97, 733, 735, 734, 733, 97, 735, 733, 735, 930, 734, 734, 930, 2049, 735, 97, 95, 735, 95, 929, 735, 929, 930, 97, 96, 95, 96, 97, 109, 930, 929, 928, 928, 655, 930, 656, 2048, 930, 655, 656, 930, 928, 929, 638, 928, 638, 639, 639, 655, 928, 314, 656, 655, 314, 655, 639, 640, 639, 638, 1780, 639, 640, 2, 639, 1780, 314, 639, 2, 638, 1738, 1383, 638, 1383, 640, 1384, 640, 1383, 1780, 640, 1384, 2, 1780, 1, 1, 1780, 1384, 1384, 1383, 429, 429, 1383, 428, 1383, 1738, 428, 315, 656, 314, 315, 1550, 656, 994, 1550, 315, 2045, 656, 1548, 1548, 656, 1550, 1550, 1549, 1548, 2713, 1550, 994, 2713, 1549, 1550, 2690, 2713, 994, 2690, 994, 995, 2690, 2674, 2713, 2674, 2200, 2713, 2713, 2200, 1549, 1549, 1985, 1548, 1549, 2200, 132, 2200, 2199, 131, 2199, 2200, 2638, 2674, 2638, 2200, 132, 2200, 131, 132, 131, 129, 132, 129, 469, 2203, 129, 131, 2203, 131, 2199, 2199, 2638, 2616, 2616, 2638, 2615, 2629, 2615, 2638, 2638, 2674, 2629, 2617, 2616, 2615, 2629, 2628, 2627, 2629, 2656, 2628, 2629, 2674, 2656, 2656, 2674, 2690, 2656, 2332, 2628, 2332, 2656, 2331, 2331, 2656, 2690, 2332, 1666, 2628, 2332, 2331, 2330, 1666, 2332, 2330, 2256, 2331, 2690, 2330, 2331, 2256, 2256, 2690, 995, 995, 2246, 2256, 2330, 2256, 2928, 2330, 2928, 2970, 848, 2330, 2970, 2968, 2928, 2927, 2970, 2928, 2968, 848, 2970, 2160, 2160, 2970, 2968, 848, 847, 846, 848, 2160, 847, 2969, 2968, 2927, 2246, 2113, 123, 2246, 995, 2113, 123, 2113, 221, 1666, 1665, 1664, 1665, 1666, 2963, 129, 58, 128, 469, 129, 128, 59, 58, 57, 59, 128, 58, 1894, 128, 59, 469, 128, 1894, 2004, 469, 1894, 2004, 1967, 469, 1894, 59, 1900, 2002, 1912, 2030, 1899, 1898, 1897, 879, 1258, 1226, 366, 1258, 879, 366, 879, 365, 1227, 879, 1226, 366, 229, 2018, 732, 1577, 1961, 1978, 1961, 897, 897, 1961, 1973, 1978, 732, 1961, 732, 1978, 504, 504, 1978, 897, 504, 897, 12, 897, 1973, 470, 12, 897, 470, 470, 1973, 370, 12, 470, 370, 7, 370, 6, 7, 12, 370, 8, 7, 6, 8, 12, 7, 13, 12, 8, 12, 505, 504, 505, 12, 13, 8, 6, 65, 431, 13, 8, 66, 8, 65, 8, 66, 431, 65, 6, 107, 13, 431, 874, 840, 936, 431, 840, 431, 907, 907, 431, 961, 961, 431, 983, 431, 66, 983, 861, 840, 907, 861, 907, 961, 861, 961, 998, 961, 983, 998, 998, 983, 790, 841, 840, 861, 841, 861, 880, 880, 861, 935, 803, 840, 841, 839, 803, 841, 839, 841, 880, 880, 901, 839, 901, 880, 923, 880, 935, 923, 923, 935, 960, 901, 923, 960, 901, 2119, 873, 901, 960, 2119, 839, 901, 873, 813, 803, 839, 839, 873, 813, 860, 813, 873, 873, 2119, 860, 803, 813, 796, 796, 813, 795, 813, 860, 795, 812, 795, 860, 812, 860, 2143, 860, 2150, 2143, 2150, 860, 2119, 727, 796, 795, 795, 812, 788, 727, 797, 796, 804, 803, 796, 727, 717, 753, 687, 728, 717, 717, 755, 754, 717, 728, 755, 687, 729, 728, 728, 729, 755, 755, 729, 766, 778, 755, 777, 755, 766, 777, 766, 729, 505, 777, 766, 803, 803, 766, 840, 766, 505, 840, 805, 777, 803, 840, 505, 862, 505, 13, 863, 2143, 811, 812, 2143, 2150, 2163, 811, 2143, 821, 821, 2143, 2163, 811, 821, 820, 821, 2173, 820, 821, 2163, 2173, 2156, 958, 2163, 2163, 958, 951, 2173, 2163, 951, 2150, 2156, 2163, 2150, 2119, 2156, 2157, 958, 2156, 2156, 2119, 2140, 2140, 2333, 2156, 2119, 960, 2127, 2119, 2127, 2140, 2140, 992, 2139, 1032, 992, 2140, 2127, 1032, 2140, 1032, 1727, 992, 993, 992, 976, 976, 992, 1022, 1022, 992, 786, 1727, 786, 992, 787, 786, 1727, 991, 976, 1022, 991, 1022, 1023, 1023, 1022, 298, 957, 976, 991, 1005, 957, 991, 991, 1023, 1005, 1005, 1023, 1030, 1030, 1023, 298, 1030, 298, 817, 1005, 1030, 1013, 1013, 1030, 497, 1030, 817, 497, 957, 1005, 990, 990, 1005, 1013, 990, 1013, 989, 1013, 1021, 989, 1013, 497, 1021, 497, 496, 495, 497, 495, 769, 1021, 497, 769, 989, 1021, 1012, 1021, 955, 1012, 1021, 769, 955, 616, 769, 756, 769, 616, 617, 756, 769, 495, 955, 769, 617, 495, 576, 756, 496, 576, 495, 616, 756, 567, 756, 576, 387, 567, 756, 387, 617, 616, 568, 616, 567, 568, 1012, 617, 1020, 955, 617, 1012, 617, 568, 1020, 568, 567, 566, 1020, 568, 566, 567, 690, 566, 567, 387, 478, 690, 567, 478, 389, 388, 387, 387, 388, 478, 576, 389, 387, 389, 576, 941, 941, 940, 389, 388, 389, 940, 478, 388, 902, 388, 940, 1443, 902, 388, 1443, 690, 478, 689, 689, 478, 902, 1053, 902, 1091, 902, 1090, 1091, 1443, 1090, 902, 1053, 689, 902, 940, 1497, 1443, 1443, 1497, 1090, 1091, 1090, 1089, 1090, 1188, 1089, 1090, 1063, 1313, 1090, 1313, 1188, 1497, 1063, 1090, 940, 1065, 1497, 1065, 1063, 1497, 1065, 1064, 1063, 1064, 1313, 1063, 1064, 1314, 1313, 1313, 1315, 1188, 1313, 1314, 1315, 1065, 1182, 1064, 1064, 1325, 1314, 1182, 1325, 1064, 1065, 1307, 1182, 940, 1307, 1065, 940, 1366, 1307, 940, 941, 1366, 1315, 1314, 1558, 1116, 1188, 1238, 1116, 1089, 1188, 1238, 1188, 1173, 1098, 1116, 1078, 1089, 1116, 1098, 1238, 1078, 1116, 1238, 1173, 1171, 1238, 1171, 1078, 1078, 1077, 1076, 1078, 1171, 1300, 1098, 1078, 1076, 1078, 1300, 1077, 1171, 1205, 1223, 1300, 1171, 1223, 1390, 1300, 1223, 1077, 1300, 1390, 1252, 1076, 1077, 1252, 1077, 1390, 1223, 1203, 1390, 1223, 1205, 1203, 305, 690, 689, 690, 305, 566, 1029, 1020, 566, 1020, 1029, 988, 556, 988, 1029, 1004, 1020, 988, 1004, 1012, 1020, 974, 975, 988, 975, 1004, 988, 988, 556, 986, 974, 988, 986, 975, 989, 1004, 989, 1012, 1004, 968, 975, 974, 968, 989, 975, 968, 990, 989, 953, 969, 968, 953, 968, 970, 968, 969, 990, 2172, 968, 2165, 2165, 968, 974, 969, 957, 990, 953, 957, 969, 953, 952, 951, 958, 957, 953, 958, 953, 951, 957, 958, 976, 958, 977, 976, 2142, 951, 2192, 2173, 951, 2142, 820, 2142, 2141, 2141, 2142, 2165, 2173, 2142, 820, 2165, 2142, 2272, 2141, 2165, 2146, 2197, 2165, 974, 2165, 2197, 2146, 2146, 2197, 853, 2159, 2197, 974, 853, 2197, 2159, 2159, 974, 986, 973, 2159, 986, 2159, 973, 916, 852, 2159, 916, 853, 2159, 852, 972, 973, 986, 986, 987, 972, 973, 972, 947, 916, 973, 947, 972, 987, 947, 916, 947, 915, 915, 947, 967, 916, 915, 914, 852, 916, 850, 850, 916, 914, 2297, 852, 850, 850, 914, 851, 1577, 2054, 2024, 2016, 2015, 2014, 2015, 2037, 2014, 2014, 2103, 2102, 1408, 3260, 3280, 3236, 3235, 3234, 624, 623, 622, 623, 624, 2778, 11, 10, 9, 10, 106, 9, 11, 9, 207, 9, 159, 160, 54, 106, 10, 106, 1896, 1901, 54, 42, 106, 41, 54, 53, 41, 42, 54, 54, 10, 56, 53, 54, 56, 43, 42, 41, 43, 41, 659, 53, 659, 41, 53, 56, 55, 55, 659, 53, 55, 56, 48, 1890, 56, 10, 48, 56, 1890, 49, 48, 47, 55, 48, 49, 47, 48, 1890, 11, 1890, 10, 903, 11, 207, 1970, 11, 903, 1970, 903, 1950, 1950, 903, 2001, 903, 158, 2079, 158, 903, 160, 2079, 2001, 903, 1950, 1949, 1948, 1948, 1949, 2190, 2750, 2001, 1464, 1464, 2001, 2380, 2080, 2380, 2001, 2001, 2079, 2080, 2080, 2079, 158, 2396, 2080, 158, 446, 2080, 2396, 2380, 2080, 446, 2380, 2379, 1464, 2380, 2371, 2379, 2371, 2380, 447, 447, 2380, 446, 241, 1464, 1463, 242, 241, 240, 1463, 240, 241, 1460, 242, 240, 448, 447, 446, 446, 2392, 448, 2396, 2397, 446, 2397, 2392, 446, 2392, 2405, 448, 2397, 2410, 2392, 2392, 2415, 2405, 2410, 2415, 2392, 2396, 2404, 2397, 2411, 2410, 2397, 2422, 2419, 2410, 2414, 2419, 2406, 2414, 2420, 2419, 2419, 2420, 2423, 2400, 2414, 2406, 2396, 2400, 2406, 2396, 1986, 2400, 1896, 1987, 1986, 158, 159, 1986, 1896, 1986, 159, 1986, 2396, 158, 2123, 1987, 1896, 1896, 1760, 2123, 2430, 2123, 1760, 1467, 1760, 1759, 1760, 1467, 2043, 1759, 1760, 1896, 2430, 1760, 2043, 1469, 1759, 1896, 1467, 1759, 1469, 1469, 1468, 1467, 42, 1468, 1469, 139, 1468, 42, 1467, 1468, 139, 60, 42, 43, 60, 139, 42, 174, 139, 60, 1467, 139, 1579, 1578, 1579, 139, 1578, 139, 174, 174, 60, 1952, 2007, 60, 1976, 1578, 174, 2010, 1580, 1579, 1578, 1578, 2010, 1580, 1952, 2010, 2009, 2166, 1580, 2010, 2166, 2010, 2167, 1953, 1952, 1951, 2166, 2167, 2603, 2166, 2603, 2575, 2483, 2166, 2539, 1580, 2166, 2483, 2575, 2539, 2166, 2529, 2575, 2559, 2539, 2575, 2529, 2575, 2609, 2559, 2483, 2539, 2529, 2483, 2529, 2501, 2501, 2529, 2522, 2522, 2529, 2559, 2507, 2521, 2559, 2523, 2559, 2521, 2522, 2559, 2523, 2559, 2609, 2520, 2592, 2507, 2609, 2507, 2592, 2546, 2546, 2592, 2600, 2507, 2546, 2545, 2545, 2546, 2975, 2975, 2974, 2545, 2508, 2507, 2148, 455, 2507, 454, 1840, 455, 2148, 455, 1840, 1839, 799, 1840, 798, 799, 1839, 1840, 799, 2412, 1839, 1839, 2412, 2439, 1839, 2439, 455, 800, 799, 798, 799, 2413, 2412, 800, 2413, 799, 2413, 2401, 2412, 2405, 2412, 2401, 2405, 2421, 2412, 2412, 2421, 2439, 2403, 2413, 800, 2413, 2403, 2401, 2403, 2402, 2401, 448, 2405, 2401, 448, 2401, 2402, 2405, 2426, 2421, 2415, 2426, 2405, 2426, 2478, 2421, 2421, 2478, 2439, 2415, 2464, 2426, 2426, 2464, 2478, 2478, 2522, 2439, 2464, 2501, 2478, 2478, 2501, 2522, 2483, 2501, 2464, 2473, 2483, 2455, 2473, 1580, 2483, 2474, 2473, 2455, 2474, 1580, 2473, 2431, 2455, 2423, 2420, 2431, 2423, 2439, 2522, 2523, 2521, 2439, 2523, 455, 2521, 2520, 455, 2439, 2521, 456, 455, 454, 2239, 448, 2402, 2403, 1244, 2402, 1244, 2239, 2402, 448, 2239, 447, 1529, 447, 2239, 447, 1529, 2371, 1530, 1529, 1528, 1528, 1529, 2239, 2372, 2371, 1529, 2379, 2371, 2372, 1245, 2239, 1244, 1245, 1528, 2239, 1246, 1245, 1244, 2941, 1246, 1244, 2602, 2601, 2600, 114, 1977, 1976, 2008, 2007, 1976, 116, 115, 114, 149, 148, 114, 2314, 2313, 1467, 2043, 1467, 2465, 1917, 43, 1975, 1975, 43, 659, 45, 1917, 44, 44, 1917, 1975, 44, 1975, 55, 55, 1975, 659, 46, 45, 44, 44, 55, 1974, 55, 49, 117, 1974, 55, 117, 46, 200, 199, 2108, 200, 46, 1901, 1896, 159, 160, 159, 158, 16, 15, 14, 527, 15, 16, 705, 16, 1982, 1028, 16, 707, 16, 1028, 527, 527, 1028, 932, 527, 932, 578, 15, 527, 578, 707, 932, 1028, 707, 706, 705, 933, 932, 707, 933, 707, 2031, 1396, 933, 705, 1396, 1395, 933, 1686, 932, 933, 1395, 2538, 933, 2032, 1396, 2031, 285, 1396, 1784, 285, 1395, 1396, 1784, 1396, 2032, 285, 1648, 1395, 1648, 2538, 1395, 287, 286, 285, 1954, 285, 1785, 1785, 285, 1784, 285, 286, 1648, 1785, 1784, 1783, 1954, 1785, 1783, 1954, 1783, 3196, 1652, 1651, 1648, 2569, 1652, 1648, 286, 1809, 1648, 1766, 1810, 1809, 1767, 1766, 1765, 1766, 1767, 1819, 1817, 1766, 1819, 1765, 1766, 1856, 1856, 1766, 2354, 1778, 1767, 1765, 1778, 1765, 2062, 1856, 2062, 1765, 2062, 1856, 2061, 2307, 2061, 1856, 1856, 2323, 2307, 2323, 1856, 2354, 3394, 3393, 2354, 2267, 2061, 2276, 2267, 2062, 2061, 1778, 2062, 1777, 1777, 2062, 2267, 2267, 2352, 1777, 1779, 1778, 1777, 2352, 2728, 1777, 2738, 2676, 1777, 2676, 2705, 1777, 1777, 2705, 1779, 2729, 2728, 2352, 1779, 1767, 1778, 1767, 1779, 2343, 1767, 2343, 1819, 1819, 1818, 1817, 1817, 1818, 2571, 2705, 2676, 2677, 2678, 2677, 2676, 2678, 2704, 2703, 2678, 2676, 2704, 1686, 1685, 932, 578, 932, 580, 580, 579, 578, 15, 578, 579, 579, 580, 621, 591, 579, 590, 579, 643, 590, 621, 643, 579, 579, 591, 15, 621, 657, 643, 657, 700, 643, 28, 27, 26, 26, 27, 1038, 833, 319, 26, 594, 595, 26, 319, 28, 26, 833, 26, 595, 26, 3255, 594, 3424, 26, 1038, 28, 792, 27, 320, 792, 28, 320, 1011, 792, 321, 320, 319, 320, 352, 1011, 320, 321, 1602, 1602, 352, 320, 319, 320, 28, 2598, 1011, 352, 354, 353, 352, 698, 354, 352, 352, 353, 2598, 698, 352, 1602, 321, 698, 1602, 704, 354, 698, 321, 1733, 698, 1733, 704, 698, 354, 416, 353, 354, 1569, 416, 704, 1569, 354, 416, 1498, 353, 416, 1499, 1498, 416, 1569, 1499, 704, 1487, 1569, 1499, 1569, 1487, 1656, 1499, 1487, 1489, 1488, 1487, 1487, 1488, 1656, 704, 1489, 1487, 704, 1841, 1489, 1627, 1841, 704, 1609, 1610, 1627, 1610, 1694, 1627, 1627, 1694, 1808, 1611, 1610, 1609, 1611, 1609, 1607, 1611, 1887, 1610, 587, 588, 1611, 588, 1672, 1611, 587, 1611, 1607, 1611, 1672, 1887, 589, 588, 587, 587, 849, 256, 589, 587, 256, 587, 1607, 849, 1649, 1740, 588, 1649, 588, 589, 1740, 1672, 588, 481, 1649, 589, 256, 481, 589, 256, 255, 254, 255, 256, 849, 631, 483, 256, 256, 254, 631, 688, 255, 849, 255, 688, 254, 688, 593, 254, 834, 595, 688, 688, 595, 593, 2023, 688, 849, 2188, 834, 688, 595, 594, 593, 834, 833, 595, 1323, 594, 1322, 1323, 593, 594, 3258, 1322, 594, 1324, 1323, 1322, 1574, 1428, 1323, 1324, 2518, 1323, 593, 1323, 1428, 3257, 1324, 1322, 2519, 2518, 1324, 3033, 2437, 1324, 2438, 2437, 2436, 254, 1428, 510, 254, 593, 1428, 1895, 510, 1428, 254, 510, 509, 631, 254, 509, 950, 509, 510, 950, 510, 1895, 630, 509, 950, 631, 509, 630, 631, 630, 629, 1060, 630, 950, 1060, 483, 630, 629, 1060, 1059, 483, 482, 481, 483, 909, 908, 483, 908, 912, 3012, 483, 481, 482, 1902, 1649, 481, 482, 1649, 1574, 2584, 2583, 834, 319, 833, 834, 1606, 319, 834, 2321, 1606, 319, 1606, 321, 1607, 1606, 1605, 1606, 1708, 321, 1708, 1606, 1607, 321, 1708, 1733, 849, 1607, 1608, 1694, 1826, 1808, 1808, 1826, 1861, 1893, 1826, 1892, 1826, 1903, 1892, 1826, 1981, 1903, 1893, 1861, 1826, 1893, 1892, 1891, 1038, 489, 487, 489, 488, 487, 652, 651, 489, 488, 489, 651, 85, 84, 83, 549, 83, 84, 83, 2416, 85, 2515, 2416, 83, 549, 2515, 83, 2416, 2576, 85, 85, 2576, 2861, 3208, 84, 85, 549, 84, 1625, 551, 550, 549, 551, 549, 2531, 2531, 549, 2563, 549, 2587, 2563, 550, 2515, 549, 2515, 550, 2777, 2855, 2517, 550, 550, 2494, 2495, 2517, 1503, 550, 1533, 1503, 2517, 1505, 1504, 1503, 1505, 1503, 1533, 1503, 1504, 2692, 2496, 2495, 2494, 2515, 2514, 2416, 2535, 2514, 2534, 2535, 2534, 2564, 2563, 2587, 3209, 2533, 2532, 2531, 2540, 2533, 2531, 120, 119, 118, 218, 217, 216, 1261, 216, 934, 216, 1261, 218, 934, 216, 217, 218, 1330, 725, 1261, 1330, 218, 218, 725, 217, 725, 724, 217, 217, 334, 934, 724, 334, 217, 1515, 1261, 934, 1482, 1261, 1515, 1260, 329, 1515, 1515, 329, 330, 330, 1482, 1515, 330, 1483, 1482, 1100, 1474, 1482, 1537, 1482, 1536, 1261, 1482, 1553, 1100, 1461, 1474, 1461, 1484, 1474, 1100, 1462, 1461, 680, 1462, 1100, 680, 1100, 330, 680, 330, 679, 1092, 680, 679, 1532, 1531, 680, 1869, 1851, 680, 1532, 680, 1851, 1867, 680, 1092, 330, 328, 679, 1093, 1092, 679, 1812, 1092, 1093, 330, 329, 328, 1260, 1259, 329, 1644, 1477, 329, 1260, 334, 1259, 334, 333, 332, 670, 1277, 334, 670, 334, 724, 334, 1277, 333, 334, 332, 3310, 332, 333, 869, 2990, 869, 333, 2991, 1074, 2990, 1074, 2939, 2990, 1074, 2991, 1277, 1075, 253, 1074, 253, 1397, 1074, 1075, 1074, 1277, 1074, 2940, 2939, 671, 1075, 1277, 671, 246, 1075, 253, 1075, 246, 246, 244, 253, 246, 245, 244, 671, 1120, 246, 1120, 668, 246, 668, 245, 246, 668, 3187, 245, 245, 412, 3202, 669, 414, 668, 414, 412, 668, 669, 668, 1120, 881, 669, 1120, 881, 1120, 671, 882, 669, 881, 669, 1757, 722, 669, 722, 414, 669, 882, 1757, 1239, 882, 881, 1239, 1670, 882, 882, 1758, 1757, 1670, 1758, 882, 722, 1757, 1678, 1757, 1758, 1678, 723, 722, 721, 721, 722, 1678, 722, 1782, 414, 723, 721, 1647, 723, 1726, 1724, 723, 1647, 1726, 1726, 1725, 1724, 1782, 1724, 414, 414, 413, 412, 413, 414, 3144, 3145, 3144, 3143, 3143, 3146, 3145, 3189, 3145, 3188, 1241, 1240, 1239, 1240, 1293, 1239, 881, 1241, 1239, 1285, 1240, 1241, 881, 672, 1241, 1241, 672, 1285, 1240, 1373, 1293, 1050, 1051, 1240, 1240, 1285, 1050, 725, 1050, 1285, 672, 724, 1285, 1285, 724, 725, 672, 671, 670, 672, 881, 671, 672, 670, 724, 670, 671, 1277, 1049, 725, 1330, 1049, 1050, 725, 1051, 1050, 1049, 1508, 1051, 1049, 1561, 1049, 1330, 1553, 1330, 1261, 1561, 1330, 1560, 1562, 1561, 1560, 1477, 1476, 718, 1476, 1477, 1644, 719, 1477, 718, 1476, 2873, 718, 720, 719, 718, 718, 2873, 1905, 2047, 720, 1905, 1906, 1905, 1904, 1868, 1365, 1867, 1319, 1365, 1364, 1365, 1319, 1851, 1255, 1295, 1319, 1295, 1329, 1319, 1319, 1329, 1851, 1329, 1377, 1851, 1870, 1851, 1869, 1377, 1532, 1851, 1304, 1329, 1295, 1329, 1304, 1377, 1296, 1295, 1255, 1305, 1304, 1295, 1377, 1304, 1939, 1275, 1939, 1304, 1304, 2104, 1275, 1377, 1531, 1532, 1275, 1274, 1257, 1222, 1257, 1256, 1256, 1257, 1273, 1157, 1222, 1199, 1157, 1178, 1222, 1199, 1222, 1255, 1222, 1256, 1255, 1256, 1279, 1255, 1157, 1199, 1186, 1158, 1157, 1156, 1158, 1178, 1157, 1157, 1186, 1156, 397, 396, 395, 883, 395, 781, 395, 883, 1043, 395, 1251, 1250, 396, 781, 395, 397, 395, 1250, 395, 1043, 1251, 883, 1336, 1043, 883, 781, 2100, 781, 396, 780, 819, 781, 818, 780, 818, 781, 770, 780, 396, 780, 770, 771, 770, 396, 397, 772, 771, 770, 1334, 770, 397, 772, 770, 1568, 770, 1334, 1568, 1334, 397, 1333, 1333, 397, 1398, 397, 1250, 1398, 1250, 1251, 1354, 1251, 1369, 1354, 1251, 1335, 1391, 1043, 1335, 1251, 1336, 1335, 1043, 1541, 772, 1568, 673, 1541, 1540, 675, 674, 673, 1539, 772, 1538, 520, 519, 518, 519, 536, 518, 598, 597, 520, 519, 537, 536, 536, 537, 954, 519, 1003, 537, 544, 543, 537, 870, 537, 543, 954, 537, 870, 870, 543, 1925, 1925, 543, 1936, 870, 1925, 1930, 1926, 1925, 1924, 1925, 1934, 1924, 1925, 1936, 1934, 1931, 1934, 1936, 1931, 1936, 1941, 1924, 1934, 1932, 1931, 1932, 1934, 1933, 1932, 1931, 1933, 1931, 1935, 1935, 1931, 1941, 1935, 1941, 1942, 1935, 2574, 1933, 1942, 2574, 2829, 608, 607, 606, 1036, 1035, 606, 608, 606, 1035, 606, 607, 3025, 1923, 608, 1035, 3273, 1923, 1035, 837, 836, 835, 865, 835, 864, 835, 877, 864, 835, 878, 877, 2132, 835, 2131, 2131, 835, 2128, 835, 2280, 2128, 2132, 878, 835, 2342, 835, 2341, 877, 878, 913, 864, 877, 913, 2356, 878, 2132, 2131, 2206, 2132, 2129, 2131, 2128, 2130, 2129, 2128, 2128, 2189, 2130, 2161, 2129, 2130, 2129, 2206, 2205, 2129, 2161, 2284, 2130, 2232, 2231, 2130, 2293, 2292, 2286, 2285, 2231, 892, 864, 889, 864, 927, 889, 864, 943, 927, 891, 890, 889, 889, 927, 891, 927, 942, 891, 943, 985, 927, 868, 867, 866, 867, 3087, 866, 946, 945, 944, 1096, 1095, 1094, 1130, 1129, 1128, 1129, 1131, 1128, 1128, 1131, 1138, 1130, 1128, 1155, 1169, 1128, 1138, 1129, 1130, 1781, 1781, 1130, 1154, 3370, 1781, 1154, 1154, 1130, 1153, 1194, 3370, 1154, 1194, 1154, 1153, 3340, 3370, 1194, 1194, 1153, 1193, 1130, 1168, 1153, 1193, 1153, 1198, 1225, 1214, 1193, 1215, 1138, 1214, 1138, 1216, 1214, 1214, 1248, 1247, 1214, 1247, 1249, 1216, 1248, 1214, 1131, 1133, 1138, 1177, 1138, 1133, 1138, 1177, 1216, 1216, 1265, 1248, 1216, 1266, 1265, 1248, 1265, 1316, 1265, 1266, 1316, 1266, 1327, 1326, 1316, 1266, 1326, 1328, 1326, 1327, 1359, 1358, 1326, 1326, 1388, 1387, 1358, 1388, 1326, 1380, 1379, 1358, 1358, 1379, 1388, 1380, 1406, 1379, 1379, 1994, 1993, 1994, 1379, 1406, 1139, 1177, 1133, 1139, 1196, 1177, 1140, 1139, 1133, 1131, 1134, 1133, 3342, 3341, 3340, 3340, 3341, 3353, 3340, 3353, 3360, 3353, 3371, 3360, 1350, 1349, 1348, 1472, 1349, 1350, 1446, 1445, 1444, 1493, 1492, 1491, 1513, 1512, 1511, 1588, 1587, 1586, 1586, 2084, 2083, 1598, 1597, 1596, 1847, 1846, 1845, 2029, 2028, 2027, 2098, 2097, 2096, 2260, 2259, 2258, 2291, 2290, 2289, 2364, 2363, 2362, 2370, 2369, 2368, 2395, 2394, 2393, 2435, 2393, 2434, 2657, 2434, 2393, 2912, 2657, 2393, 2912, 2393, 2394, 2393, 2435, 3055, 3055, 2395, 2393, 2409, 2408, 2407, 2408, 2418, 2417, 2418, 2425, 2424, 2424, 2425, 2427, 2427, 2425, 2463, 2425, 2477, 2463, 2477, 2482, 2463, 2635, 2634, 2633, 2633, 2866, 2856, 2910, 2633, 2856, 2913, 2786, 2634, 2786, 2830, 2634, 2788, 2787, 2786, 2792, 2786, 2791, 2786, 2787, 2830, 2787, 2788, 2954, 2788, 2967, 2954, 2857, 2856, 2792, 2666, 2665, 2664, 2741, 2740, 2739, 2781, 2780, 2779, 2807, 2806, 2805, 2850, 2849, 2848, 2871, 2870, 2869, 2949, 2948, 2947, 2995, 2994, 2993, 3067, 3066, 3065, 3139, 3138, 3137, 3199, 3198, 3197, 3212, 3211, 3210, 3269, 3268, 3267, 3277, 3276, 3275, 3304, 3303, 3302, 3302, 3303, 3315, 3324, 3323, 3322, 3346, 3345, 3344, 3467, 3466, 3465, 3484, 3483, 3482
-};
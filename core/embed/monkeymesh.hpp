@@ -1,26 +0,0 @@
-size_t mVertexCount = 959;
-size_t mIndexCount = 2904;
-
-float mPositions[] = {
-0.46875, 0.242188, -0.757812, 0.4375, 0.164062, -0.765625, 0.5, 0.09375, -0.6875, 0.5625, 0.242188, -0.671875, -0.5, 0.09375, -0.6875, -0.4375, 0.164062, -0.765625, -0.46875, 0.242188, -0.757812, -0.5625, 0.242188, -0.671875, 0.546875, 0.054688, -0.578125, 0.625, 0.242188, -0.5625, -0.546875, 0.054688, -0.578125, -0.625, 0.242188, -0.5625, 0.351562, 0.03125, -0.71875, 0.351562, -0.023438, -0.617188, 0.546875, 0.054688, -0.578125, -0.351562, -0.023438, -0.617188, -0.351562, 0.03125, -0.71875, -0.546875, 0.054688, -0.578125, 0.351562, 0.132812, -0.78125, -0.351562, 0.132812, -0.78125, 0.273438, 0.164062, -0.796875, 0.203125, 0.09375, -0.742188, -0.203125, 0.09375, -0.742188, -0.273438, 0.164062, -0.796875, 0.15625, 0.054688, -0.648438, -0.15625, 0.054688, -0.648438, 0.140625, 0.242188, -0.742188, 0.078125, 0.242188, -0.65625, 0.15625, 0.054688, -0.648438, -0.078125, 0.242188, -0.65625, -0.140625, 0.242188, -0.742188, -0.15625, 0.054688, -0.648438, 0.242188, 0.242188, -0.796875, -0.242188, 0.242188, -0.796875, 0.242188, 0.242188, -0.796875, 0.273438, 0.328125, -0.796875, 0.203125, 0.390625, -0.742188, -0.203125, 0.390625, -0.742188, -0.273438, 0.328125, -0.796875, -0.242188, 0.242188, -0.796875, 0.15625, 0.4375, -0.648438, -0.15625, 0.4375, -0.648438, 0.351562, 0.453125, -0.71875, 0.351562, 0.515625, -0.617188, -0.351562, 0.515625, -0.617188, -0.351562, 0.453125, -0.71875, 0.351562, 0.359375, -0.78125, -0.351562, 0.359375, -0.78125, 0.4375, 0.328125, -0.765625, 0.5, 0.390625, -0.6875, -0.5, 0.390625, -0.6875, -0.4375, 0.328125, -0.765625, 0.5, 0.390625, -0.6875, 0.546875, 0.4375, -0.578125, -0.546875, 0.4375, -0.578125, -0.5, 0.390625, -0.6875, 0.5, 0.390625, -0.6875, 0.546875, 0.4375, -0.578125, -0.5, 0.390625, -0.6875, -0.546875, 0.4375, -0.578125, 0.4375, 0.328125, -0.765625, 0.5, 0.390625, -0.6875, -0.4375, 0.328125, -0.765625, -0.5, 0.390625, -0.6875, 0.4375, 0.328125, -0.765625, 0.445312, 0.335938, -0.78125, 0.476562, 0.242188, -0.773438, -0.445312, 0.335938, -0.78125, -0.4375, 0.328125, -0.765625, -0.476562, 0.242188, -0.773438, 0.4375, 0.328125, -0.765625, 0.351562, 0.359375, -0.78125, 0.351562, 0.375, -0.804688, -0.351562, 0.375, -0.804688, -0.4375, 0.328125, -0.765625, -0.445312, 0.335938, -0.78125, 0.273438, 0.328125, -0.796875, 0.265625, 0.335938, -0.820312, -0.265625, 0.335938, -0.820312, -0.351562, 0.375, -0.804688, 0.242188, 0.242188, -0.796875, 0.226562, 0.242188, -0.820312, -0.226562, 0.242188, -0.820312, -0.242188, 0.242188, -0.796875, -0.265625, 0.335938, -0.820312, 0.242188, 0.242188, -0.796875, 0.273438, 0.164062, -0.796875, 0.265625, 0.15625, -0.820312, -0.265625, 0.15625, -0.820312, -0.242188, 0.242188, -0.796875, -0.226562, 0.242188, -0.820312, 0.351562, 0.132812, -0.78125, 0.351562, 0.117188, -0.804688, -0.351562, 0.117188, -0.804688, -0.265625, 0.15625, -0.820312, 0.4375, 0.164062, -0.765625, 0.445312, 0.15625, -0.78125, -0.445312, 0.15625, -0.78125, -0.351562, 0.117188, -0.804688, 0.46875, 0.242188, -0.757812, -0.476562, 0.242188, -0.773438, -0.445312, 0.15625, -0.78125, 0.351562, 0.242188, -0.828125, -0.351562, 0.242188, -0.828125, 0.179688, -0.96875, -0.554688, 0.164062, -0.929688, -0.632812, 0, -0.945312, -0.640625, 0, -0.984375, -0.578125, -0.164062, -0.929688, -0.632812, -0.179688, -0.96875, -0.554688, 0.328125, -0.945312, -0.523438, 0.234375, -0.914062, -0.632812, -0.234375, -0.914062, -0.632812, -0.328125, -0.945312, -0.523438, 0.367188, -0.890625, -0.53125, 0.265625, -0.820312, -0.664062, -0.265625, -0.820312, -0.664062, -0.367188, -0.890625, -0.53125, 0.351562, -0.695312, -0.570312, 0.25, -0.703125, -0.6875, -0.25, -0.703125, -0.6875, -0.351562, -0.695312, -0.570312, 0.3125, -0.4375, -0.570312, 0.210938, -0.445312, -0.710938, 0.25, -0.703125, -0.6875, -0.25, -0.703125, -0.6875, -0.210938, -0.445312, -0.710938, -0.3125, -0.4375, -0.570312, 0.203125, -0.1875, -0.5625, 0.4375, -0.140625, -0.53125, 0.398438, -0.046875, -0.671875, 0.125, -0.101562, -0.8125, -0.398438, -0.046875, -0.671875, -0.4375, -0.140625, -0.53125, -0.203125, -0.1875, -0.5625, -0.125, -0.101562, -0.8125, 0.4375, -0.140625, -0.53125, 0.632812, -0.039062, -0.539062, 0.617188, 0.054688, -0.625, -0.617188, 0.054688, -0.625, -0.632812, -0.039062, -0.539062, -0.4375, -0.140625, -0.53125, 0.828125, 0.148438, -0.445312, 0.726562, 0.203125, -0.601562, 0.617188, 0.054688, -0.625, -0.726562, 0.203125, -0.601562, -0.828125, 0.148438, -0.445312, -0.617188, 0.054688, -0.625, 0.828125, 0.148438, -0.445312, 0.859375, 0.429688, -0.59375, 0.742188, 0.375, -0.65625, -0.742188, 0.375, -0.65625, -0.859375, 0.429688, -0.59375, -0.828125, 0.148438, -0.445312, 0.859375, 0.429688, -0.59375, 0.710938, 0.484375, -0.625, 0.6875, 0.414062, -0.726562, 0.742188, 0.375, -0.65625, -0.6875, 0.414062, -0.726562, -0.710938, 0.484375, -0.625, -0.859375, 0.429688, -0.59375, -0.742188, 0.375, -0.65625, 0.492188, 0.601562, -0.6875, 0.4375, 0.546875, -0.796875, -0.4375, 0.546875, -0.796875, -0.492188, 0.601562, -0.6875, 0.320312, 0.757812, -0.734375, 0.3125, 0.640625, -0.835938, -0.3125, 0.640625, -0.835938, -0.320312, 0.757812, -0.734375, 0.15625, 0.71875, -0.757812, 0.203125, 0.617188, -0.851562, -0.203125, 0.617188, -0.851562, -0.15625, 0.71875, -0.757812, 0.15625, 0.71875, -0.757812, 0.0625, 0.492188, -0.75, 0.101562, 0.429688, -0.84375, -0.101562, 0.429688, -0.84375, -0.0625, 0.492188, -0.75, -0.15625, 0.71875, -0.757812, 0, 0.429688, -0.742188, 0, 0.351562, -0.820312, 0, 0.351562, -0.820312, 0.164062, 0.414062, -0.773438, 0.25, 0.46875, -0.757812, -0.25, 0.46875, -0.757812, -0.164062, 0.414062, -0.773438, 0.328125, 0.476562, -0.742188, -0.328125, 0.476562, -0.742188, 0.429688, 0.4375, -0.71875, 0.328125, 0.476562, -0.742188, -0.429688, 0.4375, -0.71875, -0.328125, 0.476562, -0.742188, 0.601562, 0.375, -0.664062, -0.601562, 0.375, -0.664062, 0.640625, 0.296875, -0.648438, 0.742188, 0.375, -0.65625, -0.742188, 0.375, -0.65625, -0.640625, 0.296875, -0.648438, 0.625, 0.1875, -0.648438, 0.742188, 0.375, -0.65625, -0.742188, 0.375, -0.65625, -0.625, 0.1875, -0.648438, 0.492188, 0.0625, -0.671875, 0.617188, 0.054688, -0.625, -0.617188, 0.054688, -0.625, -0.492188, 0.0625, -0.671875, 0.375, 0.015625, -0.703125, 0.617188, 0.054688, -0.625, 0.492188, 0.0625, -0.671875, -0.617188, 0.054688, -0.625, -0.375, 0.015625, -0.703125, -0.492188, 0.0625, -0.671875, 0.203125, 0.09375, -0.742188, 0.125, -0.101562, -0.8125, -0.125, -0.101562, -0.8125, -0.203125, 0.09375, -0.742188, 0.164062, 0.140625, -0.75, 0, 0.046875, -0.726562, 0.125, -0.101562, -0.8125, -0.164062, 0.140625, -0.75, -0.125, -0.101562, -0.8125, 0.125, 0.304688, -0.765625, -0.125, 0.304688, -0.765625, 0.125, 0.304688, -0.765625, 0, 0.210938, -0.765625, 0.132812, 0.210938, -0.757812, -0.125, 0.304688, -0.765625, -0.132812, 0.210938, -0.757812, 0.0625, -0.882812, -0.695312, 0, -0.890625, -0.6875, 0, -0.890625, -0.6875, -0.0625, -0.882812, -0.695312, 0.117188, -0.835938, -0.710938, -0.117188, -0.835938, -0.710938, 0.109375, -0.71875, -0.734375, -0.109375, -0.71875, -0.734375, 0.210938, -0.445312, -0.710938, 0.078125, -0.445312, -0.75, 0.117188, -0.6875, -0.734375, 0.25, -0.703125, -0.6875, -0.117188, -0.6875, -0.734375, -0.078125, -0.445312, -0.75, -0.210938, -0.445312, -0.710938, -0.25, -0.703125, -0.6875, 0.25, -0.703125, -0.6875, -0.25, -0.703125, -0.6875, 0.085938, -0.289062, -0.742188, 0, -0.328125, -0.742188, 0, -0.445312, -0.75, -0.085938, -0.289062, -0.742188, 0, -0.679688, -0.734375, 0, -0.765625, -0.734375, 0, -0.765625, -0.734375, 0.125, -0.226562, -0.75, 0.132812, -0.226562, -0.796875, 0.09375, -0.273438, -0.78125, -0.09375, -0.273438, -0.78125, -0.132812, -0.226562, -0.796875, -0.125, -0.226562, -0.75, 0.101562, -0.148438, -0.742188, 0.109375, -0.132812, -0.78125, 0.125, -0.226562, -0.75, -0.109375, -0.132812, -0.78125, -0.101562, -0.148438, -0.742188, -0.125, -0.226562, -0.75, 0, -0.140625, -0.742188, 0.039062, -0.125, -0.78125, 0.101562, -0.148438, -0.742188, -0.109375, -0.132812, -0.78125, -0.039062, -0.125, -0.78125, 0, -0.140625, -0.742188, -0.101562, -0.148438, -0.742188, 0, -0.195312, -0.75, 0, -0.1875, -0.796875, 0, -0.140625, -0.742188, -0.039062, -0.125, -0.78125, 0, -0.1875, -0.796875, 0, -0.140625, -0.742188, 0, -0.320312, -0.78125, 0.078125, -0.25, -0.804688, 0, -0.289062, -0.804688, -0.078125, -0.25, -0.804688, 0, -0.1875, -0.796875, 0, -0.203125, -0.828125, 0.046875, -0.148438, -0.8125, -0.046875, -0.148438, -0.8125, 0, -0.203125, -0.828125, 0.046875, -0.148438, -0.8125, 0.09375, -0.15625, -0.8125, -0.09375, -0.15625, -0.8125, -0.046875, -0.148438, -0.8125, 0.109375, -0.226562, -0.828125, -0.109375, -0.226562, -0.828125, 0.109375, -0.226562, -0.828125, -0.109375, -0.226562, -0.828125, 0.109375, -0.226562, -0.828125, 0.046875, -0.148438, -0.8125, -0.109375, -0.226562, -0.828125, -0.046875, -0.148438, -0.8125, 0.109375, -0.226562, -0.828125, -0.109375, -0.226562, -0.828125, 0, -0.140625, -0.742188, 0.101562, -0.148438, -0.742188, 0.125, -0.101562, -0.8125, -0.125, -0.101562, -0.8125, 0, -0.140625, -0.742188, 0.125, -0.226562, -0.75, 0.164062, -0.242188, -0.710938, 0.125, -0.101562, -0.8125, -0.164062, -0.242188, -0.710938, -0.125, -0.226562, -0.75, -0.125, -0.101562, -0.8125, 0.125, -0.226562, -0.75, 0.179688, -0.3125, -0.710938, -0.179688, -0.3125, -0.710938, -0.125, -0.226562, -0.75, 0.210938, -0.445312, -0.710938, -0.210938, -0.445312, -0.710938, 0.257812, -0.3125, -0.554688, 0.210938, -0.445312, -0.710938, -0.257812, -0.3125, -0.554688, -0.210938, -0.445312, -0.710938, 0.234375, -0.25, -0.554688, -0.234375, -0.25, -0.554688, 0.125, -0.101562, -0.8125, -0.125, -0.101562, -0.8125, 0, -0.765625, -0.734375, 0, -0.773438, -0.71875, 0.09375, -0.742188, -0.726562, 0, -0.765625, -0.734375, -0.09375, -0.742188, -0.726562, 0.09375, -0.820312, -0.710938, -0.09375, -0.820312, -0.710938, 0.046875, -0.867188, -0.6875, -0.046875, -0.867188, -0.6875, 0, -0.890625, -0.6875, 0, -0.875, -0.6875, 0, -0.890625, -0.6875, 0.046875, -0.851562, -0.632812, 0, -0.859375, -0.632812, -0.046875, -0.851562, -0.632812, 0.09375, -0.8125, -0.640625, 0.046875, -0.851562, -0.632812, -0.09375, -0.8125, -0.640625, -0.046875, -0.851562, -0.632812, 0.09375, -0.742188, -0.726562, 0.09375, -0.75, -0.664062, -0.09375, -0.75, -0.664062, -0.09375, -0.742188, -0.726562, -0.09375, -0.8125, -0.640625, 0, -0.78125, -0.65625, 0.09375, -0.75, -0.664062, -0.09375, -0.742188, -0.726562, -0.09375, -0.75, -0.664062, 0.046875, -0.851562, -0.632812, 0.09375, -0.75, -0.664062, -0.046875, -0.851562, -0.632812, -0.09375, -0.75, -0.664062, 0.09375, -0.75, -0.664062, 0.046875, -0.851562, -0.632812, -0.046875, -0.851562, -0.632812, -0.09375, -0.75, -0.664062, 0.1875, 0.15625, -0.773438, 0.171875, 0.21875, -0.78125, -0.1875, 0.15625, -0.773438, -0.171875, 0.21875, -0.78125, 0.125, 0.304688, -0.765625, 0.179688, 0.296875, -0.78125, -0.125, 0.304688, -0.765625, -0.179688, 0.296875, -0.78125, 0.125, 0.304688, -0.765625, 0.179688, 0.296875, -0.78125, 0.210938, 0.375, -0.78125, -0.179688, 0.296875, -0.78125, -0.125, 0.304688, -0.765625, -0.210938, 0.375, -0.78125, 0.226562, 0.109375, -0.78125, -0.226562, 0.109375, -0.78125, 0.375, 0.0625, -0.742188, 0.226562, 0.109375, -0.78125, -0.375, 0.0625, -0.742188, -0.226562, 0.109375, -0.78125, 0.492188, 0.0625, -0.671875, 0.476562, 0.101562, -0.71875, -0.476562, 0.101562, -0.71875, -0.492188, 0.0625, -0.671875, 0.492188, 0.0625, -0.671875, 0.578125, 0.195312, -0.679688, -0.578125, 0.195312, -0.679688, -0.492188, 0.0625, -0.671875, 0.585938, 0.289062, -0.6875, -0.585938, 0.289062, -0.6875, 0.5625, 0.351562, -0.695312, -0.5625, 0.351562, -0.695312, 0.421875, 0.398438, -0.773438, -0.421875, 0.398438, -0.773438, 0.328125, 0.476562, -0.742188, 0.335938, 0.429688, -0.757812, 0.421875, 0.398438, -0.773438, -0.335938, 0.429688, -0.757812, -0.328125, 0.476562, -0.742188, -0.421875, 0.398438, -0.773438, 0.328125, 0.476562, -0.742188, 0.273438, 0.421875, -0.773438, -0.273438, 0.421875, -0.773438, -0.328125, 0.476562, -0.742188, 0.234375, 0.359375, -0.757812, 0.28125, 0.398438, -0.765625, -0.234375, 0.359375, -0.757812, -0.28125, 0.398438, -0.765625, 0.335938, 0.40625, -0.75, -0.335938, 0.40625, -0.75, 0.421875, 0.398438, -0.773438, 0.414062, 0.390625, -0.75, -0.421875, 0.398438, -0.773438, -0.414062, 0.390625, -0.75, 0.421875, 0.398438, -0.773438, 0.53125, 0.335938, -0.679688, -0.421875, 0.398438, -0.773438, -0.53125, 0.335938, -0.679688, 0.53125, 0.335938, -0.679688, 0.554688, 0.28125, -0.671875, -0.53125, 0.335938, -0.679688, -0.554688, 0.28125, -0.671875, 0.546875, 0.210938, -0.671875, -0.546875, 0.210938, -0.671875, 0.460938, 0.117188, -0.703125, -0.460938, 0.117188, -0.703125, 0.375, 0.085938, -0.726562, -0.375, 0.085938, -0.726562, 0.226562, 0.109375, -0.78125, 0.242188, 0.125, -0.757812, -0.226562, 0.109375, -0.78125, -0.242188, 0.125, -0.757812, 0.226562, 0.109375, -0.78125, 0.203125, 0.171875, -0.75, -0.226562, 0.109375, -0.78125, -0.203125, 0.171875, -0.75, 0.179688, 0.296875, -0.78125, 0.195312, 0.296875, -0.757812, -0.195312, 0.296875, -0.757812, -0.179688, 0.296875, -0.78125, 0.179688, 0.296875, -0.78125, 0.195312, 0.226562, -0.75, -0.195312, 0.226562, -0.75, -0.179688, 0.296875, -0.78125, 0.109375, 0.460938, -0.609375, 0, 0.40625, -0.601562, -0.109375, 0.460938, -0.609375, 0.15625, 0.71875, -0.757812, 0.195312, 0.664062, -0.617188, -0.195312, 0.664062, -0.617188, -0.15625, 0.71875, -0.757812, 0.15625, 0.71875, -0.757812, 0.320312, 0.757812, -0.734375, 0.335938, 0.6875, -0.59375, 0.195312, 0.664062, -0.617188, -0.335938, 0.6875, -0.59375, -0.15625, 0.71875, -0.757812, -0.195312, 0.664062, -0.617188, 0.492188, 0.601562, -0.6875, 0.484375, 0.554688, -0.554688, -0.484375, 0.554688, -0.554688, -0.335938, 0.6875, -0.59375, 0.679688, 0.453125, -0.492188, -0.679688, 0.453125, -0.492188, 0.859375, 0.429688, -0.59375, 0.796875, 0.40625, -0.460938, 0.679688, 0.453125, -0.492188, -0.796875, 0.40625, -0.460938, -0.859375, 0.429688, -0.59375, -0.679688, 0.453125, -0.492188, 0.859375, 0.429688, -0.59375, 0.828125, 0.148438, -0.445312, 0.773438, 0.164062, -0.375, 0.796875, 0.40625, -0.460938, -0.773438, 0.164062, -0.375, -0.828125, 0.148438, -0.445312, -0.859375, 0.429688, -0.59375, -0.796875, 0.40625, -0.460938, 0.828125, 0.148438, -0.445312, 0.601562, 0, -0.414062, -0.601562, 0, -0.414062, -0.828125, 0.148438, -0.445312, 0.4375, -0.140625, -0.53125, 0.4375, -0.09375, -0.46875, 0.601562, 0, -0.414062, -0.4375, -0.09375, -0.46875, -0.4375, -0.140625, -0.53125, -0.601562, 0, -0.414062, 0, -0.570312, -0.320312, 0, -0.484375, -0.28125, 0.179688, -0.414062, -0.257812, 0.125, -0.539062, -0.359375, -0.179688, -0.414062, -0.257812, 0, -0.484375, -0.28125, 0, -0.570312, -0.320312, -0.125, -0.539062, -0.359375, 0, -0.804688, -0.34375, 0, -0.570312, -0.320312, 0.140625, -0.757812, -0.367188, 0, -0.570312, -0.320312, 0, -0.804688, -0.34375, -0.140625, -0.757812, -0.367188, 0, -0.976562, -0.460938, 0, -0.804688, -0.34375, 0.164062, -0.945312, -0.4375, 0, -0.976562, -0.460938, -0.164062, -0.945312, -0.4375, 0, -0.976562, -0.460938, 0.164062, -0.945312, -0.4375, 0, -0.976562, -0.460938, 0, -0.984375, -0.578125, -0.164062, -0.945312, -0.4375, 0.164062, -0.945312, -0.4375, 0.328125, -0.914062, -0.398438, -0.164062, -0.945312, -0.4375, -0.328125, -0.914062, -0.398438, 0.289062, -0.710938, -0.382812, -0.289062, -0.710938, -0.382812, 0.25, -0.5, -0.390625, -0.289062, -0.710938, -0.382812, -0.367188, -0.890625, -0.53125, -0.25, -0.5, -0.390625, 0.25, -0.5, -0.390625, -0.25, -0.5, -0.390625, 0.328125, -0.914062, -0.398438, 0.164062, -0.945312, -0.4375, -0.164062, -0.945312, -0.4375, 0.234375, -0.351562, -0.40625, -0.234375, -0.351562, -0.40625, 0.234375, -0.351562, -0.40625, -0.234375, -0.351562, -0.40625, 0.21875, -0.28125, -0.429688, 0.210938, -0.226562, -0.46875, -0.210938, -0.226562, -0.46875, -0.21875, -0.28125, -0.429688, 0.234375, -0.351562, -0.40625, -0.234375, -0.351562, -0.40625, 0.203125, -0.171875, -0.5, -0.203125, -0.171875, -0.5, 0.4375, -0.140625, -0.53125, -0.203125, -0.171875, -0.5, -0.4375, -0.140625, -0.53125, 0, 0.070312, 0.828125, 0.335938, 0.054688, 0.664062, 0.34375, -0.148438, 0.539062, 0, -0.195312, 0.671875, -0.34375, -0.148438, 0.539062, -0.335938, 0.054688, 0.664062, 0, 0.070312, 0.828125, 0, -0.195312, 0.671875, 0.296875, -0.3125, 0.265625, 0, -0.382812, 0.351562, -0.296875, -0.3125, 0.265625, 0, -0.382812, 0.351562, 0.210938, -0.390625, -0.164062, 0, -0.460938, -0.1875, -0.210938, -0.390625, -0.164062, 0, -0.460938, -0.1875, 0.234375, -0.351562, -0.40625, -0.234375, -0.351562, -0.40625, 0.601562, 0, -0.414062, 0.734375, -0.046875, -0.070312, 0.851562, 0.234375, -0.054688, -0.734375, -0.046875, -0.070312, -0.601562, 0, -0.414062, -0.851562, 0.234375, -0.054688, 0, 0.5625, 0.851562, 0.460938, 0.4375, 0.703125, -0.460938, 0.4375, 0.703125, 0, 0.5625, 0.851562, 0, 0.898438, -0.289062, 0.453125, 0.851562, -0.234375, 0.453125, 0.929688, 0.070312, 0, 0.984375, 0.078125, -0.453125, 0.929688, 0.070312, -0.453125, 0.851562, -0.234375, 0, 0.898438, -0.289062, 0, 0.984375, 0.078125, 0.453125, 0.867188, 0.382812, 0, 0.898438, 0.546875, -0.453125, 0.867188, 0.382812, 0, 0.898438, 0.546875, 0, 0.898438, 0.546875, 0, 0.898438, 0.546875, 0, 0.5625, 0.851562, 0.679688, 0.453125, -0.492188, 0.726562, 0.40625, -0.335938, 0.632812, 0.453125, -0.28125, -0.726562, 0.40625, -0.335938, -0.679688, 0.453125, -0.492188, -0.632812, 0.453125, -0.28125, 0.726562, 0.40625, -0.335938, 0.796875, 0.5625, -0.125, 0.640625, 0.703125, -0.054688, -0.796875, 0.5625, -0.125, -0.726562, 0.40625, -0.335938, -0.640625, 0.703125, -0.054688, 0.640625, 0.703125, -0.054688, 0.796875, 0.617188, 0.117188, 0.640625, 0.75, 0.195312, -0.796875, 0.617188, 0.117188, -0.640625, 0.703125, -0.054688, -0.640625, 0.75, 0.195312, 0.796875, 0.539062, 0.359375, 0.640625, 0.679688, 0.445312, -0.796875, 0.539062, 0.359375, -0.640625, 0.679688, 0.445312, 0.773438, 0.265625, 0.4375, 0.617188, 0.328125, 0.585938, 0.640625, 0.679688, 0.445312, -0.640625, 0.679688, 0.445312, -0.617188, 0.328125, 0.585938, -0.773438, 0.265625, 0.4375, 0.640625, 0.679688, 0.445312, 0.617188, 0.328125, 0.585938, -0.640625, 0.679688, 0.445312, -0.617188, 0.328125, 0.585938, 0.640625, 0.679688, 0.445312, -0.640625, 0.679688, 0.445312, 0.453125, 0.851562, -0.234375, 0.640625, 0.703125, -0.054688, -0.640625, 0.703125, -0.054688, -0.453125, 0.851562, -0.234375, 0.453125, 0.851562, -0.234375, 0.460938, 0.523438, -0.429688, 0.640625, 0.703125, -0.054688, -0.460938, 0.523438, -0.429688, -0.453125, 0.851562, -0.234375, -0.640625, 0.703125, -0.054688, 0.484375, 0.554688, -0.554688, 0.679688, 0.453125, -0.492188, 0.460938, 0.523438, -0.429688, -0.679688, 0.453125, -0.492188, -0.484375, 0.554688, -0.554688, -0.460938, 0.523438, -0.429688, 0, 0.570312, -0.570312, 0.460938, 0.523438, -0.429688, 0.453125, 0.851562, -0.234375, -0.453125, 0.851562, -0.234375, -0.460938, 0.523438, -0.429688, 0, 0.570312, -0.570312, 0.109375, 0.460938, -0.609375, 0.195312, 0.664062, -0.617188, 0.335938, 0.6875, -0.59375, -0.335938, 0.6875, -0.59375, -0.195312, 0.664062, -0.617188, -0.109375, 0.460938, -0.609375, 0.109375, 0.460938, -0.609375, 0.460938, 0.523438, -0.429688, -0.460938, 0.523438, -0.429688, -0.109375, 0.460938, -0.609375, 0, 0.40625, -0.601562, 0, 0.40625, -0.601562, 0.726562, 0.40625, -0.335938, -0.726562, 0.40625, -0.335938, 0.859375, 0.320312, 0.046875, 0.726562, 0.40625, -0.335938, -0.859375, 0.320312, 0.046875, -0.726562, 0.40625, -0.335938, 0.820312, 0.328125, 0.203125, -0.820312, 0.328125, 0.203125, 0.429688, -0.195312, 0.210938, 0.40625, -0.171875, -0.148438, -0.429688, -0.195312, 0.210938, -0.40625, -0.171875, -0.148438, 0.40625, -0.171875, -0.148438, 0.59375, -0.125, 0.164062, -0.40625, -0.171875, -0.148438, -0.59375, -0.125, 0.164062, 0.601562, 0, -0.414062, 0.40625, -0.171875, -0.148438, -0.40625, -0.171875, -0.148438, -0.601562, 0, -0.414062, 0.40625, -0.171875, -0.148438, -0.40625, -0.171875, -0.148438, 0.40625, -0.171875, -0.148438, -0.40625, -0.171875, -0.148438, 0.640625, -0.007812, 0.429688, 0.484375, 0.023438, 0.546875, 0.617188, 0.328125, 0.585938, -0.484375, 0.023438, 0.546875, -0.640625, -0.007812, 0.429688, -0.617188, 0.328125, 0.585938, 0.617188, 0.328125, 0.585938, -0.617188, 0.328125, 0.585938, 0.640625, -0.007812, 0.429688, -0.640625, -0.007812, 0.429688, 1.02344, 0.476562, 0.3125, 0.890625, 0.40625, 0.234375, 0.921875, 0.359375, 0.21875, 1.01562, 0.414062, 0.289062, -0.921875, 0.359375, 0.21875, -0.890625, 0.40625, 0.234375, -1.02344, 0.476562, 0.3125, -1.01562, 0.414062, 0.289062, 1.01562, 0.414062, 0.289062, 1.1875, 0.4375, 0.390625, 1.23438, 0.507812, 0.421875, -1.1875, 0.4375, 0.390625, -1.01562, 0.414062, 0.289062, -1.23438, 0.507812, 0.421875, 1.26562, 0.289062, 0.40625, 1.35156, 0.320312, 0.421875, -1.26562, 0.289062, 0.40625, -1.35156, 0.320312, 0.421875, 1.21094, 0.078125, 0.40625, 1.28125, 0.054688, 0.429688, -1.21094, 0.078125, 0.40625, -1.28125, 0.054688, 0.429688, 1.28125, 0.054688, 0.429688, 1.21094, 0.078125, 0.40625, 1.03125, -0.039062, 0.304688, 1.03906, -0.101562, 0.328125, -1.03125, -0.039062, 0.304688, -1.21094, 0.078125, 0.40625, -1.28125, 0.054688, 0.429688, -1.03906, -0.101562, 0.328125, 1.03906, -0.101562, 0.328125, 0.828125, -0.070312, 0.132812, 0.773438, -0.140625, 0.125, -0.828125, -0.070312, 0.132812, -1.03906, -0.101562, 0.328125, -0.773438, -0.140625, 0.125, 1.03906, 0, 0.367188, 0.882812, -0.023438, 0.210938, 0.828125, -0.070312, 0.132812, -0.882812, -0.023438, 0.210938, -1.03906, 0, 0.367188, -0.828125, -0.070312, 0.132812, 1.21094, 0.078125, 0.40625, 1.1875, 0.09375, 0.445312, -1.1875, 0.09375, 0.445312, -1.21094, 0.078125, 0.40625, 1.23438, 0.25, 0.445312, 1.21094, 0.078125, 0.40625, -1.23438, 0.25, 0.445312, -1.21094, 0.078125, 0.40625, 1.17188, 0.359375, 0.4375, -1.23438, 0.25, 0.445312, -1.17188, 0.359375, 0.4375, 1.01562, 0.414062, 0.289062, 1.02344, 0.34375, 0.359375, -1.17188, 0.359375, 0.4375, -1.02344, 0.34375, 0.359375, -1.01562, 0.414062, 0.289062, 1.01562, 0.414062, 0.289062, 0.945312, 0.304688, 0.289062, -0.945312, 0.304688, 0.289062, -1.01562, 0.414062, 0.289062, 0.71875, -0.023438, 0.171875, 0.726562, 0, 0.070312, -0.71875, -0.023438, 0.171875, -0.726562, 0, 0.070312, 0.59375, -0.125, 0.164062, 0.773438, -0.140625, 0.125, 0.828125, -0.070312, 0.132812, 0.71875, -0.023438, 0.171875, -0.828125, -0.070312, 0.132812, -0.773438, -0.140625, 0.125, -0.59375, -0.125, 0.164062, -0.71875, -0.023438, 0.171875, 0.820312, 0.328125, 0.203125, 0.84375, 0.289062, 0.210938, -0.84375, 0.289062, 0.210938, -0.820312, 0.328125, 0.203125, 0.828125, -0.070312, 0.132812, 0.8125, -0.015625, 0.273438, 0.71875, -0.023438, 0.171875, -0.8125, -0.015625, 0.273438, -0.828125, -0.070312, 0.132812, 0.84375, 0.015625, 0.273438, 0.71875, 0.039062, 0.1875, 0.8125, -0.015625, 0.273438, -0.71875, -0.023438, 0.171875, -0.71875, 0.039062, 0.1875, -0.84375, 0.015625, 0.273438, -0.8125, -0.015625, 0.273438, 0.757812, 0.09375, 0.273438, 0.71875, 0.039062, 0.1875, 0.820312, 0.085938, 0.273438, -0.757812, 0.09375, 0.273438, -0.820312, 0.085938, 0.273438, 0.835938, 0.171875, 0.273438, 0.796875, 0.203125, 0.210938, -0.796875, 0.203125, 0.210938, -0.835938, 0.171875, 0.273438, 0.835938, 0.171875, 0.273438, 0.890625, 0.242188, 0.265625, -0.835938, 0.171875, 0.273438, -0.890625, 0.242188, 0.265625, 0.796875, 0.203125, 0.210938, 0.84375, 0.289062, 0.210938, -0.84375, 0.289062, 0.210938, -0.796875, 0.203125, 0.210938, 0.71875, 0.039062, 0.1875, -0.71875, 0.039062, 0.1875, -0.796875, 0.203125, 0.210938, 0.890625, 0.234375, 0.320312, 0.953125, 0.289062, 0.34375, -0.890625, 0.234375, 0.320312, -0.953125, 0.289062, 0.34375, 0.835938, 0.171875, 0.273438, 0.84375, 0.171875, 0.320312, -0.84375, 0.171875, 0.320312, -0.835938, 0.171875, 0.273438, 0.835938, 0.171875, 0.273438, 0.765625, 0.09375, 0.320312, -0.765625, 0.09375, 0.320312, -0.835938, 0.171875, 0.273438, -0.84375, 0.171875, 0.320312, 0.820312, 0.085938, 0.273438, 0.828125, 0.078125, 0.320312, -0.828125, 0.078125, 0.320312, -0.820312, 0.085938, 0.273438, 0.820312, 0.085938, 0.273438, 0.851562, 0.015625, 0.320312, -0.851562, 0.015625, 0.320312, -0.820312, 0.085938, 0.273438, 0.8125, -0.015625, 0.273438, 0.8125, -0.015625, 0.320312, 0.851562, 0.015625, 0.320312, -0.8125, -0.015625, 0.320312, -0.8125, -0.015625, 0.273438, -0.851562, 0.015625, 0.320312, 0.8125, -0.015625, 0.273438, 0.882812, -0.015625, 0.265625, -0.882812, -0.015625, 0.265625, -0.8125, -0.015625, 0.273438, 1.03906, 0.328125, 0.414062, -1.03906, 0.328125, 0.414062, 1.02344, 0.34375, 0.359375, 1.1875, 0.34375, 0.484375, -1.1875, 0.34375, 0.484375, 1.23438, 0.25, 0.445312, 1.17188, 0.359375, 0.4375, 1.25781, 0.242188, 0.492188, -1.1875, 0.34375, 0.484375, -1.25781, 0.242188, 0.492188, 1.21094, 0.085938, 0.484375, -1.25781, 0.242188, 0.492188, -1.1875, 0.09375, 0.445312, -1.21094, 0.085938, 0.484375, 1.21094, 0.085938, 0.484375, 1.04688, 0, 0.421875, -1.21094, 0.085938, 0.484375, -1.04688, 0, 0.421875, 1.04688, 0, 0.421875, 0.882812, -0.015625, 0.265625, -1.04688, 0, 0.421875, -0.882812, -0.015625, 0.265625, 0.9375, 0.0625, 0.335938, 0.890625, 0.109375, 0.328125, -0.9375, 0.0625, 0.335938, -0.890625, 0.109375, 0.328125, 0.9375, 0.0625, 0.335938, 1, 0.125, 0.367188, 0.960938, 0.171875, 0.351562, -1, 0.125, 0.367188, -0.9375, 0.0625, 0.335938, -0.960938, 0.171875, 0.351562, 1.05469, 0.1875, 0.382812, 1.01562, 0.234375, 0.375, -1.05469, 0.1875, 0.382812, -1.01562, 0.234375, 0.375, 1.05469, 0.1875, 0.382812, 1.10938, 0.210938, 0.390625, 1.08594, 0.273438, 0.390625, -1.10938, 0.210938, 0.390625, -1.05469, 0.1875, 0.382812, -1.08594, 0.273438, 0.390625, 1.08594, 0.273438, 0.390625, -1.08594, 0.273438, 0.390625, 0.882812, -0.015625, 0.265625, 0.9375, 0.0625, 0.335938, -0.9375, 0.0625, 0.335938, -0.882812, -0.015625, 0.265625, 1.04688, 0, 0.421875, 0.9375, 0.0625, 0.335938, 0.882812, -0.015625, 0.265625, -0.9375, 0.0625, 0.335938, -1.04688, 0, 0.421875, -0.882812, -0.015625, 0.265625, 1.21094, 0.085938, 0.484375, 1.05469, 0.1875, 0.382812, 1.04688, 0, 0.421875, -1.05469, 0.1875, 0.382812, -1.21094, 0.085938, 0.484375, -1.04688, 0, 0.421875, 1.05469, 0.1875, 0.382812, 1.21094, 0.085938, 0.484375, -1.05469, 0.1875, 0.382812, -1.21094, 0.085938, 0.484375, 1.08594, 0.273438, 0.390625, 1.25781, 0.242188, 0.492188, -1.08594, 0.273438, 0.390625, 1.08594, 0.273438, 0.390625, -1.08594, 0.273438, 0.390625, 1.03906, -0.101562, 0.328125, 0.773438, -0.140625, 0.125, 0.789062, -0.125, 0.328125, 1.03906, -0.085938, 0.492188, -0.789062, -0.125, 0.328125, -0.773438, -0.140625, 0.125, -1.03906, -0.101562, 0.328125, -1.03906, -0.085938, 0.492188, 1.28125, 0.054688, 0.429688, 1.03906, -0.101562, 0.328125, 1.3125, 0.054688, 0.53125, -1.03906, -0.101562, 0.328125, -1.28125, 0.054688, 0.429688, -1.3125, 0.054688, 0.53125, 1.35156, 0.320312, 0.421875, 1.28125, 0.054688, 0.429688, 1.36719, 0.296875, 0.5, -1.28125, 0.054688, 0.429688, -1.35156, 0.320312, 0.421875, -1.36719, 0.296875, 0.5, 1.23438, 0.507812, 0.421875, 1.35156, 0.320312, 0.421875, 1.25, 0.46875, 0.546875, -1.35156, 0.320312, 0.421875, -1.23438, 0.507812, 0.421875, -1.25, 0.46875, 0.546875, 1.02344, 0.476562, 0.3125, 1.23438, 0.507812, 0.421875, 1.02344, 0.4375, 0.484375, -1.25, 0.46875, 0.546875, -1.23438, 0.507812, 0.421875, -1.02344, 0.476562, 0.3125, -1.02344, 0.4375, 0.484375, 0.890625, 0.40625, 0.234375, 0.859375, 0.382812, 0.382812, -1.02344, 0.4375, 0.484375, -0.890625, 0.40625, 0.234375, -0.859375, 0.382812, 0.382812, 1.03906, -0.085938, 0.492188, -0.859375, 0.382812, 0.382812, -1.03906, -0.085938, 0.492188, 0.773438, 0.265625, 0.4375, 0.820312, 0.328125, 0.203125, 0.890625, 0.40625, 0.234375, 0.859375, 0.382812, 0.382812, -0.820312, 0.328125, 0.203125, -0.773438, 0.265625, 0.4375, 0.773438, 0.265625, 0.4375, 0.859375, 0.382812, 0.382812, 0.640625, -0.007812, 0.429688, -0.859375, 0.382812, 0.382812, -0.773438, 0.265625, 0.4375, -0.640625, -0.007812, 0.429688, 0.59375, -0.125, 0.164062, 0.640625, -0.007812, 0.429688, 0.773438, -0.140625, 0.125, -0.640625, -0.007812, 0.429688, -0.59375, -0.125, 0.164062, -0.773438, -0.140625, 0.125
-};
-
-float mUVs[] = {
-0.890955, 0.409937, 0.870622, 0.410351, 0.860081, 0.439885, 0.904571, 0.440596, 0.856226, 0.149453, 0.868067, 0.17849, 0.888398, 0.178001, 0.90064, 0.146768, 0.853018, 0.478438, 0.920166, 0.475454, 0.847458, 0.111252, 0.914672, 0.111252, 0.8289, 0.409229, 0.798481, 0.430465, 0.853018, 0.478438, 0.795104, 0.161598, 0.826436, 0.181463, 0.847458, 0.111252, 0.854402, 0.395246, 0.852534, 0.1943, 0.854107, 0.374541, 0.828171, 0.366646, 0.827598, 0.224036, 0.853157, 0.214998, 0.791018, 0.354557, 0.791018, 0.237762, 0.855181, 0.331473, 0.842358, 0.297509, 0.791018, 0.354557, 0.844839, 0.292475, 0.856142, 0.257975, 0.791018, 0.237762, 0.867508, 0.357709, 0.867293, 0.231218, 0.867508, 0.357709, 0.890474, 0.358091, 0.900375, 0.333036, 0.901223, 0.254408, 0.890219, 0.229817, 0.867293, 0.231218, 0.918898, 0.300303, 0.92118, 0.286287, 0.931889, 0.363168, 0.968392, 0.354667, 0.968213, 0.22978, 0.931368, 0.222907, 0.905882, 0.372098, 0.90499, 0.21514, 0.906232, 0.394258, 0.933717, 0.406963, 0.93125, 0.179074, 0.904357, 0.192987, 0.933717, 0.406963, 0.968392, 0.426188, 0.965038, 0.158329, 0.93125, 0.179074, 0.933717, 0.406963, 0.968392, 0.426188, 0.93125, 0.179074, 0.965038, 0.158329, 0.906232, 0.394258, 0.933717, 0.406963, 0.904357, 0.192987, 0.93125, 0.179074, 0.906232, 0.394258, 0.902359, 0.392091, 0.889591, 0.406725, 0.900583, 0.195323, 0.904357, 0.192987, 0.887178, 0.181271, 0.906232, 0.394258, 0.905882, 0.372098, 0.899781, 0.373743, 0.898822, 0.213767, 0.904357, 0.192987, 0.900583, 0.195323, 0.890474, 0.358091, 0.887842, 0.363473, 0.887351, 0.224558, 0.898822, 0.213767, 0.867508, 0.357709, 0.870908, 0.364755, 0.870376, 0.224028, 0.867293, 0.231218, 0.887351, 0.224558, 0.867508, 0.357709, 0.854107, 0.374541, 0.859881, 0.376058, 0.858859, 0.213226, 0.867293, 0.231218, 0.870376, 0.224028, 0.854402, 0.395246, 0.859664, 0.391814, 0.857942, 0.197495, 0.858859, 0.213226, 0.870622, 0.410351, 0.871664, 0.406039, 0.869299, 0.182751, 0.857942, 0.197495, 0.890955, 0.409937, 0.887178, 0.181271, 0.869299, 0.182751, 0.8794, 0.383488, 0.878029, 0.204937, 0.54026, 0.946195, 0.536419, 0.937928, 0.518925, 0.940319, 0.518916, 0.949706, 0.501452, 0.937957, 0.497626, 0.94623, 0.55193, 0.941662, 0.542788, 0.935911, 0.495083, 0.935953, 0.485955, 0.941727, 0.555073, 0.9381, 0.54629, 0.927331, 0.491565, 0.927375, 0.482805, 0.938171, 0.563812, 0.923414, 0.548333, 0.915107, 0.489507, 0.915142, 0.474014, 0.923489, 0.583135, 0.891505, 0.555621, 0.878251, 0.548333, 0.915107, 0.489507, 0.915142, 0.482177, 0.878219, 0.454527, 0.891519, 0.605512, 0.834866, 0.647395, 0.799498, 0.621513, 0.772182, 0.553118, 0.790401, 0.416514, 0.77051, 0.389677, 0.79811, 0.432024, 0.834356, 0.485339, 0.789947, 0.647395, 0.799498, 0.676379, 0.766759, 0.664761, 0.746775, 0.372747, 0.743643, 0.360308, 0.764101, 0.389677, 0.79811, 0.715342, 0.734608, 0.683908, 0.720005, 0.664761, 0.746775, 0.353696, 0.715394, 0.320452, 0.729697, 0.372747, 0.743643, 0.715342, 0.734608, 0.707254, 0.689946, 0.687515, 0.688461, 0.351187, 0.68256, 0.330721, 0.683147, 0.320452, 0.729697, 0.707254, 0.689946, 0.697446, 0.667327, 0.676824, 0.676063, 0.687515, 0.688461, 0.362723, 0.670278, 0.341964, 0.660333, 0.330721, 0.683147, 0.351187, 0.68256, 0.662817, 0.627479, 0.63905, 0.64267, 0.402772, 0.637869, 0.379297, 0.621314, 0.626842, 0.604208, 0.618316, 0.624849, 0.424583, 0.620733, 0.416915, 0.599448, 0.604826, 0.602196, 0.600808, 0.622143, 0.442396, 0.618778, 0.439252, 0.59846, 0.604826, 0.602196, 0.553095, 0.609488, 0.559674, 0.642989, 0.482938, 0.641503, 0.490934, 0.608138, 0.439252, 0.59846, 0.521923, 0.613991, 0.521086, 0.656132, 0.521086, 0.656132, 0.577279, 0.659844, 0.599845, 0.655185, 0.441977, 0.652185, 0.464579, 0.65777, 0.615546, 0.657995, 0.425972, 0.654418, 0.634472, 0.667689, 0.615546, 0.657995, 0.406362, 0.66352, 0.425972, 0.654418, 0.662406, 0.687196, 0.377061, 0.682315, 0.66844, 0.702042, 0.687515, 0.688461, 0.351187, 0.68256, 0.370304, 0.697356, 0.664101, 0.722128, 0.687515, 0.688461, 0.351187, 0.68256, 0.3741, 0.718222, 0.639236, 0.746953, 0.664761, 0.746775, 0.372747, 0.743643, 0.398938, 0.744367, 0.613992, 0.757338, 0.664761, 0.746775, 0.639236, 0.746953, 0.372747, 0.743643, 0.424464, 0.755527, 0.398938, 0.744367, 0.572941, 0.741436, 0.553118, 0.790401, 0.485339, 0.789947, 0.466409, 0.740291, 0.563905, 0.727993, 0.51976, 0.751136, 0.553118, 0.790401, 0.475886, 0.726922, 0.485339, 0.789947, 0.558527, 0.683406, 0.482619, 0.682157, 0.558527, 0.683406, 0.520277, 0.705236, 0.556923, 0.708786, 0.482619, 0.682157, 0.483433, 0.707751, 0.525483, 0.931033, 0.518928, 0.932101, 0.518928, 0.932101, 0.512375, 0.931044, 0.531231, 0.926171, 0.506626, 0.926189, 0.531019, 0.912569, 0.506827, 0.912584, 0.555621, 0.878251, 0.532042, 0.872287, 0.532669, 0.90908, 0.548333, 0.915107, 0.505177, 0.909092, 0.505828, 0.872272, 0.482177, 0.878219, 0.489507, 0.915142, 0.548333, 0.915107, 0.489507, 0.915142, 0.538112, 0.841618, 0.518981, 0.848251, 0.518941, 0.871642, 0.499851, 0.841566, 0.518925, 0.906048, 0.518927, 0.91482, 0.518927, 0.91482, 0.548362, 0.82644, 0.537959, 0.824034, 0.535214, 0.833192, 0.502799, 0.833143, 0.5001, 0.823967, 0.489683, 0.826307, 0.544281, 0.806634, 0.537248, 0.812423, 0.548362, 0.82644, 0.50089, 0.812429, 0.493996, 0.806572, 0.489683, 0.826307, 0.519841, 0.799157, 0.528757, 0.808215, 0.544281, 0.806634, 0.50089, 0.812429, 0.509219, 0.808374, 0.519841, 0.799157, 0.493996, 0.806572, 0.517577, 0.809393, 0.519132, 0.814618, 0.519841, 0.799157, 0.509219, 0.808374, 0.519132, 0.814618, 0.519841, 0.799157, 0.518998, 0.840972, 0.531131, 0.828369, 0.519016, 0.834401, 0.50691, 0.828333, 0.519132, 0.814618, 0.519099, 0.820543, 0.528222, 0.813684, 0.509787, 0.81374, 0.519099, 0.820543, 0.528222, 0.813684, 0.533528, 0.815785, 0.504547, 0.815794, 0.509787, 0.81374, 0.533449, 0.823261, 0.504604, 0.823209, 0.533449, 0.823261, 0.504604, 0.823209, 0.533449, 0.823261, 0.528222, 0.813684, 0.504604, 0.823209, 0.509787, 0.81374, 0.533449, 0.823261, 0.504604, 0.823209, 0.519841, 0.799157, 0.544281, 0.806634, 0.553118, 0.790401, 0.485339, 0.789947, 0.519841, 0.799157, 0.548362, 0.82644, 0.561572, 0.832221, 0.553118, 0.790401, 0.476363, 0.832004, 0.489683, 0.826307, 0.485339, 0.789947, 0.548362, 0.82644, 0.559475, 0.850681, 0.478371, 0.850553, 0.489683, 0.826307, 0.555621, 0.878251, 0.482177, 0.878219, 0.596138, 0.866574, 0.555621, 0.878251, 0.441395, 0.866408, 0.482177, 0.878219, 0.601169, 0.852115, 0.436337, 0.851806, 0.553118, 0.790401, 0.485339, 0.789947, 0.518927, 0.91482, 0.518925, 0.916135, 0.528933, 0.915043, 0.518927, 0.91482, 0.508915, 0.915055, 0.529036, 0.924571, 0.50882, 0.924585, 0.523751, 0.929492, 0.514106, 0.929499, 0.518928, 0.932101, 0.518929, 0.930532, 0.518928, 0.932101, 0.52156, 0.92503, 0.518928, 0.925741, 0.516297, 0.925034, 0.524236, 0.923309, 0.52156, 0.92503, 0.513619, 0.923316, 0.516297, 0.925034, 0.528933, 0.915043, 0.524601, 0.920114, 0.513252, 0.920121, 0.508915, 0.915055, 0.513619, 0.923316, 0.518926, 0.920669, 0.524601, 0.920114, 0.508915, 0.915055, 0.513252, 0.920121, 0.52156, 0.92503, 0.524601, 0.920114, 0.516297, 0.925034, 0.513252, 0.920121, 0.524601, 0.920114, 0.52156, 0.92503, 0.516297, 0.925034, 0.513252, 0.920121, 0.571787, 0.722705, 0.568351, 0.707096, 0.46807, 0.721383, 0.471978, 0.705718, 0.558527, 0.683406, 0.573085, 0.688614, 0.482619, 0.682157, 0.46779, 0.686919, 0.558527, 0.683406, 0.573085, 0.688614, 0.584855, 0.672292, 0.46779, 0.686919, 0.482619, 0.682157, 0.456477, 0.670039, 0.580734, 0.73338, 0.458737, 0.731951, 0.61172, 0.744275, 0.580734, 0.73338, 0.427062, 0.742272, 0.458737, 0.731951, 0.639236, 0.746953, 0.632494, 0.737147, 0.406068, 0.734492, 0.398938, 0.744367, 0.639236, 0.746953, 0.653658, 0.720029, 0.384904, 0.716366, 0.398938, 0.744367, 0.656064, 0.702364, 0.383015, 0.698136, 0.652752, 0.689814, 0.386858, 0.685385, 0.62904, 0.676136, 0.411556, 0.672327, 0.615546, 0.657995, 0.614408, 0.668028, 0.62904, 0.676136, 0.426727, 0.664639, 0.425972, 0.654418, 0.411556, 0.672327, 0.615546, 0.657995, 0.601033, 0.666376, 0.440344, 0.663463, 0.425972, 0.654418, 0.590644, 0.678484, 0.601799, 0.671547, 0.450408, 0.676081, 0.439372, 0.668669, 0.613335, 0.672917, 0.427623, 0.669642, 0.62904, 0.676136, 0.626851, 0.679487, 0.411556, 0.672327, 0.413648, 0.675825, 0.62904, 0.676136, 0.646248, 0.693579, 0.411556, 0.672327, 0.393381, 0.68949, 0.646248, 0.693579, 0.649541, 0.703775, 0.393381, 0.68949, 0.389662, 0.699817, 0.647785, 0.716514, 0.39104, 0.712929, 0.629829, 0.732737, 0.408893, 0.730041, 0.612641, 0.73844, 0.426254, 0.736307, 0.580734, 0.73338, 0.585166, 0.729009, 0.458737, 0.731951, 0.454369, 0.727417, 0.580734, 0.73338, 0.578124, 0.7181, 0.458737, 0.731951, 0.461798, 0.716559, 0.573085, 0.688614, 0.579548, 0.69066, 0.461204, 0.688767, 0.46779, 0.686919, 0.573085, 0.688614, 0.577524, 0.706224, 0.462754, 0.704568, 0.46779, 0.686919, 0.553209, 0.566937, 0.523031, 0.566372, 0.492809, 0.565462, 0.604826, 0.602196, 0.609819, 0.568484, 0.43586, 0.56426, 0.439252, 0.59846, 0.604826, 0.602196, 0.626842, 0.604208, 0.648174, 0.580684, 0.609819, 0.568484, 0.396518, 0.574584, 0.439252, 0.59846, 0.43586, 0.56426, 0.662817, 0.627479, 0.692106, 0.611726, 0.350292, 0.603771, 0.396518, 0.574584, 0.726332, 0.658246, 0.312756, 0.649412, 0.707254, 0.689946, 0.735879, 0.687888, 0.726332, 0.658246, 0.301067, 0.679407, 0.330721, 0.683147, 0.312756, 0.649412, 0.707254, 0.689946, 0.715342, 0.734608, 0.7299, 0.743607, 0.735879, 0.687888, 0.304876, 0.738913, 0.320452, 0.729697, 0.330721, 0.683147, 0.301067, 0.679407, 0.715342, 0.734608, 0.698172, 0.783094, 0.337414, 0.780821, 0.320452, 0.729697, 0.647395, 0.799498, 0.663103, 0.809329, 0.698172, 0.783094, 0.373474, 0.808128, 0.389677, 0.79811, 0.337414, 0.780821, 0.626908, 0.984392, 0.649444, 0.977622, 0.660451, 0.923916, 0.62144, 0.951911, 0.376796, 0.924704, 0.388827, 0.978414, 0.411318, 0.984869, 0.416419, 0.952369, 0.56746, 0.999856, 0.626908, 0.984392, 0.577206, 0.967199, 0.411318, 0.984869, 0.470636, 0.999856, 0.460782, 0.967344, 0.518922, 0.975114, 0.56746, 0.999856, 0.547413, 0.958276, 0.518922, 0.975114, 0.490511, 0.958331, 0.518922, 0.975114, 0.547413, 0.958276, 0.518922, 0.975114, 0.518916, 0.949706, 0.490511, 0.958331, 0.547413, 0.958276, 0.558059, 0.946129, 0.490511, 0.958331, 0.479842, 0.946215, 0.576951, 0.942002, 0.46092, 0.942155, 0.611687, 0.921732, 0.46092, 0.942155, 0.482805, 0.938171, 0.425932, 0.922015, 0.611687, 0.921732, 0.425932, 0.922015, 0.558059, 0.946129, 0.547413, 0.958276, 0.490511, 0.958331, 0.626663, 0.888643, 0.410618, 0.888756, 0.626663, 0.888643, 0.410618, 0.888756, 0.629482, 0.869544, 0.623495, 0.853204, 0.413741, 0.852842, 0.407648, 0.869406, 0.626663, 0.888643, 0.410618, 0.888756, 0.619303, 0.840159, 0.418035, 0.839639, 0.647395, 0.799498, 0.418035, 0.839639, 0.389677, 0.79811, 0.9459, 0.920431, 0.886245, 0.878223, 0.849114, 0.900268, 0.89178, 0.963084, 0.183115, 0.907873, 0.141314, 0.887518, 0.078961, 0.939281, 0.142277, 0.978533, 0.788458, 0.919174, 0.805584, 0.989214, 0.246353, 0.92349, 0.232648, 0.996516, 0.687018, 0.922796, 0.672384, 0.977799, 0.349875, 0.924045, 0.365979, 0.979009, 0.626663, 0.888643, 0.410618, 0.888756, 0.698172, 0.783094, 0.760215, 0.806756, 0.789046, 0.766677, 0.271553, 0.806129, 0.337414, 0.780821, 0.241255, 0.763023, 0.994525, 0.832295, 0.909112, 0.816739, 0.107928, 0.820917, 0.011829, 0.844633, 0.911671, 0.597571, 0.862868, 0.661444, 0.894128, 0.698116, 0.962901, 0.655248, 0.123776, 0.684481, 0.160557, 0.643179, 0.1064, 0.567348, 0.043968, 0.632962, 0.91536, 0.740196, 0.999856, 0.74536, 0.098965, 0.733032, 0.000144, 0.740887, 0.999856, 0.74536, 0.000144, 0.740887, 0.011829, 0.844633, 0.749542, 0.665317, 0.766337, 0.699191, 0.789162, 0.686273, 0.267408, 0.689858, 0.288183, 0.653504, 0.242992, 0.674448, 0.766337, 0.699191, 0.815314, 0.723612, 0.846174, 0.706603, 0.213065, 0.714836, 0.267408, 0.689858, 0.178537, 0.695017, 0.846174, 0.706603, 0.845007, 0.743648, 0.873517, 0.734078, 0.179662, 0.736688, 0.178537, 0.695017, 0.147089, 0.725716, 0.859075, 0.771832, 0.886999, 0.766231, 0.162803, 0.76828, 0.131514, 0.762413, 0.842355, 0.80484, 0.87503, 0.815295, 0.886999, 0.766231, 0.131514, 0.762413, 0.145224, 0.817251, 0.176788, 0.803821, 0.886999, 0.766231, 0.87503, 0.815295, 0.131514, 0.762413, 0.145224, 0.817251, 0.886999, 0.766231, 0.131514, 0.762413, 0.862868, 0.661444, 0.846174, 0.706603, 0.178537, 0.695017, 0.160557, 0.643179, 0.862868, 0.661444, 0.794286, 0.635938, 0.846174, 0.706603, 0.239776, 0.617408, 0.160557, 0.643179, 0.178537, 0.695017, 0.770185, 0.620462, 0.749542, 0.665317, 0.794286, 0.635938, 0.288183, 0.653504, 0.268122, 0.601263, 0.239776, 0.617408, 0.845499, 0.550033, 0.794286, 0.635938, 0.862868, 0.661444, 0.160557, 0.643179, 0.239776, 0.617408, 0.185281, 0.515901, 0.815858, 0.554619, 0.770572, 0.555739, 0.7557, 0.581397, 0.287033, 0.557088, 0.271364, 0.526684, 0.21926, 0.522814, 0.815858, 0.554619, 0.794286, 0.635938, 0.239776, 0.617408, 0.21926, 0.522814, 0.819845, 0.531929, 0.215894, 0.496395, 0.766337, 0.699191, 0.267408, 0.689858, 0.809631, 0.766113, 0.766337, 0.699191, 0.219168, 0.762612, 0.267408, 0.689858, 0.829287, 0.780438, 0.199067, 0.777536, 0.78648, 0.882409, 0.715482, 0.860273, 0.246666, 0.88515, 0.319538, 0.860591, 0.715482, 0.860273, 0.785486, 0.84767, 0.319538, 0.860591, 0.245969, 0.848998, 0.698172, 0.783094, 0.715482, 0.860273, 0.319538, 0.860591, 0.337414, 0.780821, 0.715482, 0.860273, 0.319538, 0.860591, 0.715482, 0.860273, 0.319538, 0.860591, 0.837382, 0.843639, 0.858171, 0.862225, 0.87503, 0.815295, 0.171653, 0.867706, 0.196622, 0.844759, 0.145224, 0.817251, 0.87503, 0.815295, 0.145224, 0.817251, 0.837382, 0.843639, 0.196622, 0.844759, 0.506166, 0.095149, 0.432388, 0.105057, 0.438797, 0.129771, 0.491058, 0.118286, 0.315867, 0.131791, 0.321637, 0.106775, 0.247207, 0.098841, 0.263032, 0.121679, 0.491058, 0.118286, 0.572792, 0.139516, 0.604825, 0.120054, 0.181486, 0.145307, 0.263032, 0.121679, 0.148729, 0.126651, 0.586396, 0.206023, 0.619962, 0.208385, 0.169745, 0.212526, 0.136063, 0.215907, 0.549027, 0.253588, 0.563786, 0.260789, 0.208656, 0.259121, 0.194086, 0.266759, 0.563786, 0.260789, 0.549027, 0.253588, 0.500314, 0.288271, 0.50827, 0.302307, 0.258399, 0.292503, 0.208656, 0.259121, 0.194086, 0.266759, 0.250811, 0.306751, 0.50827, 0.302307, 0.438641, 0.319317, 0.434803, 0.341118, 0.320962, 0.322041, 0.250811, 0.306751, 0.325318, 0.343776, 0.505666, 0.269056, 0.452955, 0.299977, 0.438641, 0.319317, 0.306136, 0.303024, 0.252524, 0.273408, 0.320962, 0.322041, 0.549027, 0.253588, 0.54285, 0.244247, 0.214575, 0.249586, 0.208656, 0.259121, 0.568148, 0.212633, 0.549027, 0.253588, 0.188269, 0.218625, 0.208656, 0.259121, 0.555495, 0.173648, 0.188269, 0.218625, 0.19985, 0.179111, 0.491058, 0.118286, 0.501231, 0.155644, 0.19985, 0.179111, 0.253846, 0.159498, 0.263032, 0.121679, 0.491058, 0.118286, 0.457832, 0.15996, 0.297562, 0.162642, 0.263032, 0.121679, 0.796021, 0.823031, 0.783193, 0.812551, 0.233625, 0.82438, 0.246955, 0.812925, 0.391039, 0.388109, 0.434803, 0.341118, 0.438641, 0.319317, 0.394766, 0.313875, 0.320962, 0.322041, 0.325318, 0.343776, 0.369913, 0.389804, 0.364838, 0.315555, 0.391747, 0.137903, 0.401605, 0.15854, 0.354026, 0.159703, 0.363377, 0.138692, 0.438641, 0.319317, 0.435018, 0.28172, 0.394766, 0.313875, 0.323658, 0.284269, 0.320962, 0.322041, 0.433669, 0.270339, 0.384658, 0.289701, 0.435018, 0.28172, 0.364838, 0.315555, 0.3744, 0.291031, 0.324726, 0.272823, 0.323658, 0.284269, 0.410995, 0.252338, 0.384658, 0.289701, 0.427812, 0.257172, 0.347028, 0.254184, 0.33027, 0.259464, 0.418086, 0.215054, 0.384657, 0.204577, 0.37227, 0.205528, 0.338952, 0.216927, 0.418086, 0.215054, 0.431333, 0.182465, 0.338952, 0.216927, 0.32479, 0.18454, 0.816266, 0.796914, 0.825107, 0.790238, 0.199767, 0.785173, 0.209828, 0.793839, 0.802192, 0.815391, 0.226485, 0.816914, 0.209828, 0.793839, 0.448505, 0.195379, 0.473386, 0.1753, 0.307886, 0.197969, 0.282357, 0.178475, 0.418086, 0.215054, 0.435868, 0.220431, 0.321237, 0.222792, 0.338952, 0.216927, 0.418086, 0.215054, 0.423718, 0.245809, 0.334089, 0.247955, 0.338952, 0.216927, 0.321237, 0.222792, 0.427812, 0.257172, 0.43795, 0.250223, 0.319919, 0.25275, 0.33027, 0.259464, 0.427812, 0.257172, 0.445392, 0.268003, 0.312907, 0.270778, 0.33027, 0.259464, 0.435018, 0.28172, 0.440995, 0.275617, 0.445392, 0.268003, 0.31751, 0.278303, 0.323658, 0.284269, 0.312907, 0.270778, 0.435018, 0.28172, 0.455277, 0.286269, 0.30346, 0.289343, 0.323658, 0.284269, 0.512485, 0.171189, 0.242975, 0.175426, 0.501231, 0.155644, 0.550942, 0.188186, 0.204839, 0.193583, 0.568148, 0.212633, 0.555495, 0.173648, 0.552139, 0.212318, 0.204839, 0.193583, 0.204331, 0.217844, 0.539407, 0.235461, 0.204331, 0.217844, 0.214575, 0.249586, 0.217774, 0.240681, 0.539407, 0.235461, 0.508439, 0.256865, 0.217774, 0.240681, 0.249419, 0.261268, 0.508439, 0.256865, 0.455277, 0.286269, 0.249419, 0.261268, 0.30346, 0.289343, 0.470841, 0.251592, 0.454776, 0.238335, 0.28696, 0.25498, 0.302729, 0.241258, 0.470841, 0.251592, 0.48887, 0.229536, 0.475403, 0.216096, 0.268291, 0.233339, 0.28696, 0.25498, 0.281439, 0.219489, 0.503673, 0.212438, 0.494476, 0.19753, 0.252972, 0.21659, 0.26179, 0.201374, 0.503673, 0.212438, 0.518562, 0.208398, 0.516802, 0.192661, 0.23792, 0.212955, 0.252972, 0.21659, 0.239243, 0.197109, 0.516802, 0.192661, 0.239243, 0.197109, 0.455277, 0.286269, 0.470841, 0.251592, 0.28696, 0.25498, 0.30346, 0.289343, 0.508439, 0.256865, 0.470841, 0.251592, 0.455277, 0.286269, 0.28696, 0.25498, 0.249419, 0.261268, 0.30346, 0.289343, 0.539407, 0.235461, 0.503673, 0.212438, 0.508439, 0.256865, 0.252972, 0.21659, 0.217774, 0.240681, 0.249419, 0.261268, 0.503673, 0.212438, 0.539407, 0.235461, 0.252972, 0.21659, 0.217774, 0.240681, 0.516802, 0.192661, 0.552139, 0.212318, 0.239243, 0.197109, 0.516802, 0.192661, 0.239243, 0.197109, 0.50827, 0.302307, 0.434803, 0.341118, 0.484068, 0.371224, 0.543385, 0.316462, 0.276936, 0.374933, 0.325318, 0.343776, 0.250811, 0.306751, 0.216123, 0.32188, 0.563786, 0.260789, 0.50827, 0.302307, 0.581052, 0.273067, 0.250811, 0.306751, 0.194086, 0.266759, 0.177176, 0.279574, 0.619962, 0.208385, 0.563786, 0.260789, 0.616701, 0.240035, 0.194086, 0.266759, 0.136063, 0.215907, 0.140379, 0.247623, 0.707492, 0.240116, 0.619962, 0.208385, 0.660647, 0.258833, 0.136063, 0.215907, 0.049526, 0.251176, 0.097038, 0.267948, 0.745511, 0.3479, 0.707492, 0.240116, 0.677256, 0.329564, 0.097038, 0.267948, 0.049526, 0.251176, 0.019409, 0.360251, 0.083564, 0.337962, 0.740843, 0.427572, 0.671403, 0.407344, 0.083564, 0.337962, 0.033664, 0.435597, 0.09282, 0.410138, 0.543385, 0.316462, 0.09282, 0.410138, 0.216123, 0.32188, 0.842355, 0.80484, 0.829287, 0.780438, 0.834578, 0.793121, 0.834705, 0.793041, 0.051216, 0.477341, 0.145041, 0.437405, 0.62042, 0.434325, 0.671403, 0.407344, 0.498072, 0.447685, 0.09282, 0.410138, 0.145041, 0.437405, 0.264218, 0.44986, 0.391039, 0.388109, 0.498072, 0.447685, 0.434803, 0.341118, 0.264218, 0.44986, 0.369913, 0.389804, 0.325318, 0.343776
-};
-
-float mNormals[] = {
-0.9777, -0.011, -0.2097, 0.7277, -0.6545, -0.2051, 0.604, -0.5102, -0.6122, 0.8021, -0.0034, -0.5972, -0.604, -0.5102, -0.6122, -0.7277, -0.6545, -0.2051, -0.9777, -0.011, -0.2097, -0.8021, -0.0034, -0.5972, 0.6829, -0.5475, -0.4835, 0.8684, -0.0033, -0.4958, -0.6829, -0.5475, -0.4835, -0.8684, -0.0033, -0.4958, 0.0982, -0.751, -0.653, 0.1159, -0.867, -0.4847, 0.6829, -0.5475, -0.4835, -0.1159, -0.867, -0.4847, -0.0982, -0.751, -0.653, -0.6829, -0.5475, -0.4835, 0.0375, -0.9651, -0.2592, -0.0375, -0.9651, -0.2592, -0.6554, -0.6928, -0.3008, -0.4514, -0.5393, -0.7109, 0.4514, -0.5393, -0.7109, 0.6554, -0.6928, -0.3008, -0.5512, -0.6358, -0.5402, 0.5512, -0.6358, -0.5402, -0.694, -0.0035, -0.7199, -0.8148, -0.0038, -0.5797, -0.5512, -0.6358, -0.5402, 0.8148, -0.0038, -0.5797, 0.694, -0.0035, -0.7199, 0.5512, -0.6358, -0.5402, -0.946, -0.0128, -0.3237, 0.946, -0.0128, -0.3237, -0.946, -0.0128, -0.3237, -0.6622, 0.6914, -0.2889, -0.4551, 0.5251, -0.7191, 0.4551, 0.5251, -0.7191, 0.6622, 0.6914, -0.2889, 0.946, -0.0128, -0.3237, -0.5298, 0.6266, -0.5716, 0.5298, 0.6266, -0.5716, 0.1019, 0.7401, -0.6647, 0.1224, 0.8373, -0.5328, -0.1224, 0.8373, -0.5328, -0.1019, 0.7401, -0.6647, 0.0321, 0.971, -0.2369, -0.0321, 0.971, -0.2369, 0.732, 0.6527, -0.1949, 0.6084, 0.4949, -0.6203, -0.6084, 0.4949, -0.6203, -0.732, 0.6527, -0.1949, 0.6084, 0.4949, -0.6203, 0.6722, 0.5381, -0.5084, -0.6722, 0.5381, -0.5084, -0.6084, 0.4949, -0.6203, 0.6084, 0.4949, -0.6203, 0.6722, 0.5381, -0.5084, -0.6084, 0.4949, -0.6203, -0.6722, 0.5381, -0.5084, 0.732, 0.6527, -0.1949, 0.6084, 0.4949, -0.6203, -0.732, 0.6527, -0.1949, -0.6084, 0.4949, -0.6203, 0.732, 0.6527, -0.1949, 0.722, 0.6499, -0.2374, 0.9737, -0.0122, -0.2273, -0.722, 0.6499, -0.2374, -0.732, 0.6527, -0.1949, -0.9737, -0.0122, -0.2273, 0.732, 0.6527, -0.1949, 0.0321, 0.971, -0.2369, 0.0374, 0.9336, -0.3564, -0.0374, 0.9336, -0.3564, -0.732, 0.6527, -0.1949, -0.722, 0.6499, -0.2374, -0.6622, 0.6914, -0.2889, -0.6263, 0.647, -0.4348, 0.6263, 0.647, -0.4348, -0.0374, 0.9336, -0.3564, -0.946, -0.0128, -0.3237, -0.9113, -0.0123, -0.4116, 0.9113, -0.0123, -0.4116, 0.946, -0.0128, -0.3237, 0.6263, 0.647, -0.4348, -0.946, -0.0128, -0.3237, -0.6554, -0.6928, -0.3008, -0.6181, -0.6538, -0.4364, 0.6181, -0.6538, -0.4364, 0.946, -0.0128, -0.3237, 0.9113, -0.0123, -0.4116, 0.0375, -0.9651, -0.2592, 0.0369, -0.9351, -0.3524, -0.0369, -0.9351, -0.3524, 0.6181, -0.6538, -0.4364, 0.7277, -0.6545, -0.2051, 0.715, -0.6569, -0.2391, -0.715, -0.6569, -0.2391, -0.0369, -0.9351, -0.3524, 0.9777, -0.011, -0.2097, -0.9737, -0.0122, -0.2273, -0.715, -0.6569, -0.2391, 0.1836, -0.0053, -0.983, -0.1836, -0.0053, -0.983, 0.1576, -0.9745, -0.1596, 0.1679, -0.7535, -0.6356, 0, -0.7922, -0.6102, 0, -0.9777, -0.2098, -0.1679, -0.7535, -0.6356, -0.1576, -0.9745, -0.1596, 0.6541, -0.7418, -0.148, 0.363, -0.6184, -0.697, -0.363, -0.6184, -0.697, -0.6541, -0.7418, -0.148, 0.9696, -0.1473, -0.1954, 0.5559, -0.216, -0.8027, -0.5559, -0.216, -0.8027, -0.9696, -0.1473, -0.1954, 0.9758, 0.0949, -0.197, 0.5678, -0.033, -0.8224, -0.5678, -0.033, -0.8224, -0.9758, 0.0949, -0.197, 0.9651, 0.2189, -0.1435, 0.5872, 0.1119, -0.8016, 0.5678, -0.033, -0.8224, -0.5678, -0.033, -0.8224, -0.5872, 0.1119, -0.8016, -0.9651, 0.2189, -0.1435, 0.9053, -0.3891, -0.1703, 0.3605, -0.9316, -0.0454, 0.3809, -0.5176, -0.7662, 0.0663, -0.1929, -0.9789, -0.3809, -0.5176, -0.7662, -0.3605, -0.9316, -0.0454, -0.9053, -0.3891, -0.1703, -0.0663, -0.1929, -0.9789, 0.3605, -0.9316, -0.0454, 0.5889, -0.7908, -0.1668, 0.4987, -0.4011, -0.7683, -0.4987, -0.4011, -0.7683, -0.5889, -0.7908, -0.1668, -0.3605, -0.9316, -0.0454, 0.9126, -0.4027, 0.0698, 0.5489, -0.3266, -0.7694, 0.4987, -0.4011, -0.7683, -0.5489, -0.3266, -0.7694, -0.9126, -0.4027, 0.0698, -0.4987, -0.4011, -0.7683, 0.9126, -0.4027, 0.0698, 0.8801, 0.4238, -0.2138, 0.4875, -0.147, -0.8606, -0.4875, -0.147, -0.8606, -0.8801, 0.4238, -0.2138, -0.9126, -0.4027, 0.0698, 0.8801, 0.4238, -0.2138, 0.51, 0.833, -0.2144, 0.3417, -0.0325, -0.9392, 0.4875, -0.147, -0.8606, -0.3417, -0.0325, -0.9392, -0.51, 0.833, -0.2144, -0.8801, 0.4238, -0.2138, -0.4875, -0.147, -0.8606, 0.5978, 0.7838, -0.1683, 0.3141, -0.0304, -0.9489, -0.3141, -0.0304, -0.9489, -0.5978, 0.7838, -0.1683, 0.2283, 0.9588, -0.1689, 0.2711, 0.213, -0.9387, -0.2711, 0.213, -0.9387, -0.2283, 0.9588, -0.1689, -0.5987, 0.7773, -0.193, -0.1643, 0.159, -0.9735, 0.1643, 0.159, -0.9735, 0.5987, 0.7773, -0.193, -0.5987, 0.7773, -0.193, -0.7917, 0.5829, -0.1826, -0.0729, -0.0287, -0.9969, 0.0729, -0.0287, -0.9969, 0.7917, 0.5829, -0.1826, 0.5987, 0.7773, -0.193, 0, 0.9595, -0.2816, 0, -0.0241, -0.9997, 0, -0.0241, -0.9997, 0.2654, -0.204, -0.9423, 0.266, -0.1257, -0.9557, -0.266, -0.1257, -0.9557, -0.2654, -0.204, -0.9423, 0.1334, -0.0975, -0.9862, -0.1334, -0.0975, -0.9862, 0.1978, -0.0104, -0.9802, 0.1334, -0.0975, -0.9862, -0.1978, -0.0104, -0.9802, -0.1334, -0.0975, -0.9862, 0.2413, -0.3067, -0.9207, -0.2413, -0.3067, -0.9207, 0.363, -0.2123, -0.9073, 0.4875, -0.147, -0.8606, -0.4875, -0.147, -0.8606, -0.363, -0.2123, -0.9073, 0.4415, -0.2058, -0.8733, 0.4875, -0.147, -0.8606, -0.4875, -0.147, -0.8606, -0.4415, -0.2058, -0.8733, 0.4194, -0.3797, -0.8245, 0.4987, -0.4011, -0.7683, -0.4987, -0.4011, -0.7683, -0.4194, -0.3797, -0.8245, 0.3106, -0.3403, -0.8875, 0.4987, -0.4011, -0.7683, 0.4194, -0.3797, -0.8245, -0.4987, -0.4011, -0.7683, -0.3106, -0.3403, -0.8875, -0.4194, -0.3797, -0.8245, -0.1349, -0.2146, -0.9673, 0.0663, -0.1929, -0.9789, -0.0663, -0.1929, -0.9789, 0.1349, -0.2146, -0.9673, -0.3104, -0.1697, -0.9353, 0, 0.0135, -0.9999, 0.0663, -0.1929, -0.9789, 0.3104, -0.1697, -0.9353, -0.0663, -0.1929, -0.9789, 0.0284, -0.1986, -0.9796, -0.0284, -0.1986, -0.9796, 0.0284, -0.1986, -0.9796, 0, -0.2235, -0.9747, -0.1624, -0.1997, -0.9663, -0.0284, -0.1986, -0.9796, 0.1624, -0.1997, -0.9663, -0.0252, -0.4118, -0.9109, 0, -0.3312, -0.9435, 0, -0.3312, -0.9435, 0.0252, -0.4118, -0.9109, 0.0891, -0.3229, -0.9422, -0.0891, -0.3229, -0.9422, 0.1559, -0.1706, -0.9729, -0.1559, -0.1706, -0.9729, 0.5872, 0.1119, -0.8016, 0.1386, 0.0029, -0.9903, 0.1802, -0.0578, -0.9819, 0.5678, -0.033, -0.8224, -0.1802, -0.0578, -0.9819, -0.1386, 0.0029, -0.9903, -0.5872, 0.1119, -0.8016, -0.5678, -0.033, -0.8224, 0.5678, -0.033, -0.8224, -0.5678, -0.033, -0.8224, 0.4969, -0.4356, -0.7505, 0, -0.4576, -0.8892, 0, -0.0041, -1, -0.4969, -0.4356, -0.7505, 0, -0.0342, -0.9994, 0, -0.4257, -0.9048, 0, -0.4257, -0.9048, 0.7215, -0.3646, -0.5885, 0.9246, -0.2129, -0.3159, 0.5803, -0.7306, -0.3597, -0.5803, -0.7306, -0.3597, -0.9246, -0.2129, -0.3159, -0.7215, -0.3646, -0.5885, 0.2528, 0.3479, -0.9028, 0.6218, 0.7744, -0.1168, 0.7215, -0.3646, -0.5885, -0.6218, 0.7744, -0.1168, -0.2528, 0.3479, -0.9028, -0.7215, -0.3646, -0.5885, 0, 0.5692, -0.8221, -0.3018, 0.9416, -0.1492, 0.2528, 0.3479, -0.9028, -0.6218, 0.7744, -0.1168, 0.3018, 0.9416, -0.1492, 0, 0.5692, -0.8221, -0.2528, 0.3479, -0.9028, 0, 0.7592, -0.6508, 0, 0.7851, -0.6193, 0, 0.5692, -0.8221, 0.3018, 0.9416, -0.1492, 0, 0.7851, -0.6193, 0, 0.5692, -0.8221, 0, -0.8574, -0.5146, 0.2206, -0.564, -0.7958, 0, -0.5286, -0.8489, -0.2206, -0.564, -0.7958, 0, 0.7851, -0.6193, 0, 0.1136, -0.9935, -0.1992, 0.6017, -0.7734, 0.1992, 0.6017, -0.7734, 0, 0.1136, -0.9935, -0.1992, 0.6017, -0.7734, 0.3664, 0.4751, -0.8, -0.3664, 0.4751, -0.8, 0.1992, 0.6017, -0.7734, 0.4296, -0.1849, -0.8838, -0.4296, -0.1849, -0.8838, 0.4296, -0.1849, -0.8838, -0.4296, -0.1849, -0.8838, 0.4296, -0.1849, -0.8838, -0.1992, 0.6017, -0.7734, -0.4296, -0.1849, -0.8838, 0.1992, 0.6017, -0.7734, 0.4296, -0.1849, -0.8838, -0.4296, -0.1849, -0.8838, 0, 0.5692, -0.8221, 0.2528, 0.3479, -0.9028, 0.0663, -0.1929, -0.9789, -0.0663, -0.1929, -0.9789, 0, 0.5692, -0.8221, 0.7215, -0.3646, -0.5885, 0.743, 0.0295, -0.6686, 0.0663, -0.1929, -0.9789, -0.743, 0.0295, -0.6686, -0.7215, -0.3646, -0.5885, -0.0663, -0.1929, -0.9789, 0.7215, -0.3646, -0.5885, 0.6464, 0.1424, -0.7496, -0.6464, 0.1424, -0.7496, -0.7215, -0.3646, -0.5885, 0.5872, 0.1119, -0.8016, -0.5872, 0.1119, -0.8016, 0.9385, 0.3251, -0.116, 0.5872, 0.1119, -0.8016, -0.9385, 0.3251, -0.116, -0.5872, 0.1119, -0.8016, 0.9534, 0.2816, -0.1079, -0.9534, 0.2816, -0.1079, 0.0663, -0.1929, -0.9789, -0.0663, -0.1929, -0.9789, 0, -0.4257, -0.9048, 0, -0.9031, -0.4294, -0.114, -0.6151, -0.7801, 0, -0.4257, -0.9048, 0.114, -0.6151, -0.7801, -0.6503, 0.0615, -0.7572, 0.6503, 0.0615, -0.7572, -0.3705, 0.545, -0.7521, 0.3705, 0.545, -0.7521, 0, -0.3312, -0.9435, 0, 0.6467, -0.7627, 0, -0.3312, -0.9435, -0.3272, 0.4745, -0.8171, 0, 0.5289, -0.8487, 0.3272, 0.4745, -0.8171, -0.6748, 0.1147, -0.729, -0.3272, 0.4745, -0.8171, 0.6748, 0.1147, -0.729, 0.3272, 0.4745, -0.8171, -0.114, -0.6151, -0.7801, -0.5163, -0.7041, -0.4874, 0.5163, -0.7041, -0.4874, 0.114, -0.6151, -0.7801, 0.6748, 0.1147, -0.729, 0, -0.6988, -0.7153, -0.5163, -0.7041, -0.4874, 0.114, -0.6151, -0.7801, 0.5163, -0.7041, -0.4874, -0.3272, 0.4745, -0.8171, -0.5163, -0.7041, -0.4874, 0.3272, 0.4745, -0.8171, 0.5163, -0.7041, -0.4874, -0.5163, -0.7041, -0.4874, -0.3272, 0.4745, -0.8171, 0.3272, 0.4745, -0.8171, 0.5163, -0.7041, -0.4874, -0.017, -0.061, -0.998, 0.1649, -0.0897, -0.9822, 0.017, -0.061, -0.998, -0.1649, -0.0897, -0.9822, 0.0284, -0.1986, -0.9796, 0.2358, -0.1089, -0.9656, -0.0284, -0.1986, -0.9796, -0.2358, -0.1089, -0.9656, 0.0284, -0.1986, -0.9796, 0.2358, -0.1089, -0.9656, 0.1633, -0.0836, -0.983, -0.2358, -0.1089, -0.9656, -0.0284, -0.1986, -0.9796, -0.1633, -0.0836, -0.983, 0.0129, -0.156, -0.9876, -0.0129, -0.156, -0.9876, 0.1998, -0.2072, -0.9577, 0.0129, -0.156, -0.9876, -0.1998, -0.2072, -0.9577, -0.0129, -0.156, -0.9876, 0.4194, -0.3797, -0.8245, 0.2858, -0.0425, -0.9573, -0.2858, -0.0425, -0.9573, -0.4194, -0.3797, -0.8245, 0.4194, -0.3797, -0.8245, 0.299, -0.0934, -0.9497, -0.299, -0.0934, -0.9497, -0.4194, -0.3797, -0.8245, 0.187, -0.0655, -0.9802, -0.187, -0.0655, -0.9802, 0.3063, 0.0342, -0.9513, -0.3063, 0.0342, -0.9513, 0.173, -0.1109, -0.9786, -0.173, -0.1109, -0.9786, 0.1334, -0.0975, -0.9862, 0.1657, 0.1129, -0.9797, 0.173, -0.1109, -0.9786, -0.1657, 0.1129, -0.9797, -0.1334, -0.0975, -0.9862, -0.173, -0.1109, -0.9786, 0.1334, -0.0975, -0.9862, 0.1828, 0.0367, -0.9825, -0.1828, 0.0367, -0.9825, -0.1334, -0.0975, -0.9862, 0.501, -0.3839, -0.7756, 0.3063, -0.3431, -0.8879, -0.501, -0.3839, -0.7756, -0.3063, -0.3431, -0.8879, 0.0021, -0.4953, -0.8687, -0.0021, -0.4953, -0.8687, 0.173, -0.1109, -0.9786, -0.1401, -0.762, -0.6322, -0.173, -0.1109, -0.9786, 0.1401, -0.762, -0.6322, 0.173, -0.1109, -0.9786, -0.1943, -0.616, -0.7633, -0.173, -0.1109, -0.9786, 0.1943, -0.616, -0.7633, -0.1943, -0.616, -0.7633, -0.3549, -0.1286, -0.926, 0.1943, -0.616, -0.7633, 0.3549, -0.1286, -0.926, -0.2549, 0.2241, -0.9406, 0.2549, 0.2241, -0.9406, -0.0831, 0.5416, -0.8365, 0.0831, 0.5416, -0.8365, 0.1489, 0.6135, -0.7755, -0.1489, 0.6135, -0.7755, 0.0129, -0.156, -0.9876, 0.4245, 0.5609, -0.7108, -0.0129, -0.156, -0.9876, -0.4245, 0.5609, -0.7108, 0.0129, -0.156, -0.9876, 0.6875, 0.2974, -0.6625, -0.0129, -0.156, -0.9876, -0.6875, 0.2974, -0.6625, 0.2358, -0.1089, -0.9656, 0.7464, -0.2134, -0.6303, -0.7464, -0.2134, -0.6303, -0.2358, -0.1089, -0.9656, 0.2358, -0.1089, -0.9656, 0.8052, 0.015, -0.5928, -0.8052, 0.015, -0.5928, -0.2358, -0.1089, -0.9656, -0.5046, 0.8622, -0.0448, 0, 0.8794, -0.476, 0.5046, 0.8622, -0.0448, -0.5987, 0.7773, -0.193, -0.477, 0.51, 0.7158, 0.477, 0.51, 0.7158, 0.5987, 0.7773, -0.193, -0.5987, 0.7773, -0.193, 0.2283, 0.9588, -0.1689, 0.1146, 0.6555, 0.7464, -0.477, 0.51, 0.7158, -0.1146, 0.6555, 0.7464, 0.5987, 0.7773, -0.193, 0.477, 0.51, 0.7158, 0.5978, 0.7838, -0.1683, 0.3084, 0.9138, 0.2642, -0.3084, 0.9138, 0.2642, -0.1146, 0.6555, 0.7464, 0.3515, 0.9087, 0.2249, -0.3515, 0.9087, 0.2249, 0.8801, 0.4238, -0.2138, 0.7392, 0.6005, 0.3048, 0.3515, 0.9087, 0.2249, -0.7392, 0.6005, 0.3048, -0.8801, 0.4238, -0.2138, -0.3515, 0.9087, 0.2249, 0.8801, 0.4238, -0.2138, 0.9126, -0.4027, 0.0698, 0.9393, -0.3068, 0.1533, 0.7392, 0.6005, 0.3048, -0.9393, -0.3068, 0.1533, -0.9126, -0.4027, 0.0698, -0.8801, 0.4238, -0.2138, -0.7392, 0.6005, 0.3048, 0.9126, -0.4027, 0.0698, 0.5768, -0.811, 0.0972, -0.5768, -0.811, 0.0972, -0.9126, -0.4027, 0.0698, 0.3605, -0.9316, -0.0454, 0.4394, -0.8925, 0.1016, 0.5768, -0.811, 0.0972, -0.4394, -0.8925, 0.1016, -0.3605, -0.9316, -0.0454, -0.5768, -0.811, 0.0972, 0, -0.3178, 0.9481, 0, -0.8051, 0.5931, 0.726, -0.5865, 0.3591, 0.3375, -0.2535, 0.9066, -0.726, -0.5865, 0.3591, 0, -0.8051, 0.5931, 0, -0.3178, 0.9481, -0.3375, -0.2535, 0.9066, 0, -0.2978, 0.9546, 0, -0.3178, 0.9481, 0.1293, -0.1789, 0.9753, 0, -0.3178, 0.9481, 0, -0.2978, 0.9546, -0.1293, -0.1789, 0.9753, 0, -0.8508, 0.5255, 0, -0.2978, 0.9546, 0.0993, -0.7679, 0.6327, 0, -0.8508, 0.5255, -0.0993, -0.7679, 0.6327, 0, -0.8508, 0.5255, 0.0993, -0.7679, 0.6327, 0, -0.8508, 0.5255, 0, -0.9777, -0.2098, -0.0993, -0.7679, 0.6327, 0.0993, -0.7679, 0.6327, 0.5586, -0.4679, 0.6848, -0.0993, -0.7679, 0.6327, -0.5586, -0.4679, 0.6848, 0.6058, 0.0208, 0.7953, -0.6058, 0.0208, 0.7953, 0.7766, -0.0093, 0.6299, -0.6058, 0.0208, 0.7953, -0.9696, -0.1473, -0.1954, -0.7766, -0.0093, 0.6299, 0.7766, -0.0093, 0.6299, -0.7766, -0.0093, 0.6299, 0.5586, -0.4679, 0.6848, 0.0993, -0.7679, 0.6327, -0.0993, -0.7679, 0.6327, 0.9601, -0.0016, 0.2794, -0.9601, -0.0016, 0.2794, 0.9601, -0.0016, 0.2794, -0.9601, -0.0016, 0.2794, 0.9731, -0.2302, -0.0002, 0.9537, -0.1999, -0.2246, -0.9537, -0.1999, -0.2246, -0.9731, -0.2302, -0.0002, 0.9601, -0.0016, 0.2794, -0.9601, -0.0016, 0.2794, 0.814, -0.5544, -0.1732, -0.814, -0.5544, -0.1732, 0.3605, -0.9316, -0.0454, -0.814, -0.5544, -0.1732, -0.3605, -0.9316, -0.0454, 0, -0.3004, 0.9538, 0.4237, -0.324, 0.8459, 0.5191, -0.6556, 0.5483, 0, -0.6966, 0.7174, -0.5191, -0.6556, 0.5483, -0.4237, -0.324, 0.8459, 0, -0.3004, 0.9538, 0, -0.6966, 0.7174, 0.5213, -0.8255, 0.2162, 0, -0.941, 0.3385, -0.5213, -0.8255, 0.2162, 0, -0.941, 0.3385, 0.5887, -0.8081, 0.0185, 0, -0.9863, 0.165, -0.5887, -0.8081, 0.0185, 0, -0.9863, 0.165, 0.9601, -0.0016, 0.2794, -0.9601, -0.0016, 0.2794, 0.5768, -0.811, 0.0972, 0.7152, -0.695, -0.0736, 0.9762, -0.2019, -0.0787, -0.7152, -0.695, -0.0736, -0.5768, -0.811, 0.0972, -0.9762, -0.2019, -0.0787, 0, 0.3141, 0.9494, 0.4534, 0.1969, 0.8693, -0.4534, 0.1969, 0.8693, 0, 0.3141, 0.9494, 0, 0.8267, -0.5627, 0.461, 0.7338, -0.4989, 0.4198, 0.9069, -0.0349, 0, 0.9997, -0.0232, -0.4198, 0.9069, -0.0349, -0.461, 0.7338, -0.4989, 0, 0.8267, -0.5627, 0, 0.9997, -0.0232, 0.4258, 0.8032, 0.4165, 0, 0.8325, 0.5539, -0.4258, 0.8032, 0.4165, 0, 0.8325, 0.5539, 0, 0.8325, 0.5539, 0, 0.8325, 0.5539, 0, 0.3141, 0.9494, 0.3515, 0.9087, 0.2249, 0.7652, 0.6244, -0.1565, 0.4721, 0.7778, -0.4149, -0.7652, 0.6244, -0.1565, -0.3515, 0.9087, 0.2249, -0.4721, 0.7778, -0.4149, 0.7652, 0.6244, -0.1565, 0.7475, 0.5326, -0.3969, 0.6514, 0.6814, -0.3335, -0.7475, 0.5326, -0.3969, -0.7652, 0.6244, -0.1565, -0.6514, 0.6814, -0.3335, 0.6514, 0.6814, -0.3335, 0.8548, 0.5181, 0.0301, 0.6788, 0.7318, 0.0612, -0.8548, 0.5181, 0.0301, -0.6514, 0.6814, -0.3335, -0.6788, 0.7318, 0.0612, 0.8739, 0.307, 0.3769, 0.644, 0.5379, 0.5438, -0.8739, 0.307, 0.3769, -0.644, 0.5379, 0.5438, 0.626, -0.0259, 0.7794, 0.586, -0.0155, 0.8101, 0.644, 0.5379, 0.5438, -0.644, 0.5379, 0.5438, -0.586, -0.0155, 0.8101, -0.626, -0.0259, 0.7794, 0.644, 0.5379, 0.5438, 0.586, -0.0155, 0.8101, -0.644, 0.5379, 0.5438, -0.586, -0.0155, 0.8101, 0.644, 0.5379, 0.5438, -0.644, 0.5379, 0.5438, 0.461, 0.7338, -0.4989, 0.6514, 0.6814, -0.3335, -0.6514, 0.6814, -0.3335, -0.461, 0.7338, -0.4989, 0.461, 0.7338, -0.4989, 0.3916, 0.828, -0.4012, 0.6514, 0.6814, -0.3335, -0.3916, 0.828, -0.4012, -0.461, 0.7338, -0.4989, -0.6514, 0.6814, -0.3335, 0.3084, 0.9138, 0.2642, 0.3515, 0.9087, 0.2249, 0.3916, 0.828, -0.4012, -0.3515, 0.9087, 0.2249, -0.3084, 0.9138, 0.2642, -0.3916, 0.828, -0.4012, 0, 0.6204, -0.7843, 0.3916, 0.828, -0.4012, 0.461, 0.7338, -0.4989, -0.461, 0.7338, -0.4989, -0.3916, 0.828, -0.4012, 0, 0.6204, -0.7843, -0.5046, 0.8622, -0.0448, -0.477, 0.51, 0.7158, 0.1146, 0.6555, 0.7464, -0.1146, 0.6555, 0.7464, 0.477, 0.51, 0.7158, 0.5046, 0.8622, -0.0448, -0.5046, 0.8622, -0.0448, 0.3916, 0.828, -0.4012, -0.3916, 0.828, -0.4012, 0.5046, 0.8622, -0.0448, 0, 0.8794, -0.476, 0, 0.8794, -0.476, 0.7652, 0.6244, -0.1565, -0.7652, 0.6244, -0.1565, 0.9989, -0.0455, -0.0062, 0.7652, 0.6244, -0.1565, -0.9989, -0.0455, -0.0062, -0.7652, 0.6244, -0.1565, 0.8965, 0.3044, -0.322, -0.8965, 0.3044, -0.322, 0.5809, -0.8007, 0.1463, 0.573, -0.8037, -0.16, -0.5809, -0.8007, 0.1463, -0.573, -0.8037, -0.16, 0.573, -0.8037, -0.16, 0.2744, -0.96, 0.0552, -0.573, -0.8037, -0.16, -0.2744, -0.96, 0.0552, 0.5768, -0.811, 0.0972, 0.573, -0.8037, -0.16, -0.573, -0.8037, -0.16, -0.5768, -0.811, 0.0972, 0.573, -0.8037, -0.16, -0.573, -0.8037, -0.16, 0.573, -0.8037, -0.16, -0.573, -0.8037, -0.16, 0.402, -0.6167, 0.6767, 0.5443, -0.4959, 0.6766, 0.586, -0.0155, 0.8101, -0.5443, -0.4959, 0.6766, -0.402, -0.6167, 0.6767, -0.586, -0.0155, 0.8101, 0.586, -0.0155, 0.8101, -0.586, -0.0155, 0.8101, 0.402, -0.6167, 0.6767, -0.402, -0.6167, 0.6767, 0.0163, 0.8736, -0.4863, -0.2878, 0.7388, -0.6094, 0.459, -0.0631, -0.8862, 0.542, -0.0674, -0.8376, -0.459, -0.0631, -0.8862, 0.2878, 0.7388, -0.6094, -0.0163, 0.8736, -0.4863, -0.542, -0.0674, -0.8376, 0.542, -0.0674, -0.8376, 0.3174, -0.093, -0.9437, 0.3604, 0.8605, -0.36, -0.3174, -0.093, -0.9437, -0.542, -0.0674, -0.8376, -0.3604, 0.8605, -0.36, -0.1201, -0.0897, -0.9887, 0.7896, 0.179, -0.5869, 0.1201, -0.0897, -0.9887, -0.7896, 0.179, -0.5869, -0.024, 0.2739, -0.9614, 0.6731, -0.4998, -0.545, 0.024, 0.2739, -0.9614, -0.6731, -0.4998, -0.545, 0.6731, -0.4998, -0.545, -0.024, 0.2739, -0.9614, 0.4922, 0.2738, -0.8263, 0.4719, -0.7796, -0.4116, -0.4922, 0.2738, -0.8263, 0.024, 0.2739, -0.9614, -0.6731, -0.4998, -0.545, -0.4719, -0.7796, -0.4116, 0.4719, -0.7796, -0.4116, 0.3413, 0.3527, -0.8712, -0.0439, -0.6481, -0.7602, -0.3413, 0.3527, -0.8712, -0.4719, -0.7796, -0.4116, 0.0439, -0.6481, -0.7602, -0.1665, 0.9539, -0.2497, 0.233, 0.8788, -0.4164, 0.3413, 0.3527, -0.8712, -0.233, 0.8788, -0.4164, 0.1665, 0.9539, -0.2497, -0.3413, 0.3527, -0.8712, -0.024, 0.2739, -0.9614, -0.7613, 0.6471, -0.0399, 0.7613, 0.6471, -0.0399, 0.024, 0.2739, -0.9614, -0.981, -0.0934, -0.1698, -0.024, 0.2739, -0.9614, 0.981, -0.0934, -0.1698, 0.024, 0.2739, -0.9614, -0.141, -0.7728, -0.6188, 0.981, -0.0934, -0.1698, 0.141, -0.7728, -0.6188, 0.542, -0.0674, -0.8376, 0.5587, -0.6583, -0.5044, 0.141, -0.7728, -0.6188, -0.5587, -0.6583, -0.5044, -0.542, -0.0674, -0.8376, 0.542, -0.0674, -0.8376, 0.6878, -0.5533, -0.4698, -0.6878, -0.5533, -0.4698, -0.542, -0.0674, -0.8376, 0.745, 0.0855, -0.6615, 0.8615, -0.488, 0.14, -0.745, 0.0855, -0.6615, -0.8615, -0.488, 0.14, 0.2744, -0.96, 0.0552, -0.0439, -0.6481, -0.7602, 0.3413, 0.3527, -0.8712, 0.745, 0.0855, -0.6615, -0.3413, 0.3527, -0.8712, 0.0439, -0.6481, -0.7602, -0.2744, -0.96, 0.0552, -0.745, 0.0855, -0.6615, 0.8965, 0.3044, -0.322, 0.7427, -0.2611, -0.6166, -0.7427, -0.2611, -0.6166, -0.8965, 0.3044, -0.322, 0.3413, 0.3527, -0.8712, 0.5933, 0.5663, -0.572, 0.745, 0.0855, -0.6615, -0.5933, 0.5663, -0.572, -0.3413, 0.3527, -0.8712, 0.8837, -0.0624, -0.4639, 0.921, -0.1749, -0.348, 0.5933, 0.5663, -0.572, -0.745, 0.0855, -0.6615, -0.921, -0.1749, -0.348, -0.8837, -0.0624, -0.4639, -0.5933, 0.5663, -0.572, 0.8589, 0.0371, -0.5108, 0.921, -0.1749, -0.348, 0.5731, 0.7262, -0.3795, -0.8589, 0.0371, -0.5108, -0.5731, 0.7262, -0.3795, 0.7481, -0.5799, -0.3224, 0.872, -0.424, -0.2446, -0.872, -0.424, -0.2446, -0.7481, -0.5799, -0.3224, 0.7481, -0.5799, -0.3224, 0.6963, -0.5412, -0.4714, -0.7481, -0.5799, -0.3224, -0.6963, -0.5412, -0.4714, 0.872, -0.424, -0.2446, 0.7427, -0.2611, -0.6166, -0.7427, -0.2611, -0.6166, -0.872, -0.424, -0.2446, 0.921, -0.1749, -0.348, -0.921, -0.1749, -0.348, -0.872, -0.424, -0.2446, 0.6669, -0.4348, -0.6052, 0.6358, -0.4092, -0.6544, -0.6669, -0.4348, -0.6052, -0.6358, -0.4092, -0.6544, 0.7481, -0.5799, -0.3224, 0.5714, -0.4259, -0.7015, -0.5714, -0.4259, -0.7015, -0.7481, -0.5799, -0.3224, 0.7481, -0.5799, -0.3224, 0.7837, 0.2514, -0.568, -0.7837, 0.2514, -0.568, -0.7481, -0.5799, -0.3224, -0.5714, -0.4259, -0.7015, 0.5731, 0.7262, -0.3795, 0.4447, 0.374, -0.8138, -0.4447, 0.374, -0.8138, -0.5731, 0.7262, -0.3795, 0.5731, 0.7262, -0.3795, 0.3739, 0.3687, -0.851, -0.3739, 0.3687, -0.851, -0.5731, 0.7262, -0.3795, 0.5933, 0.5663, -0.572, 0.66, 0.3495, -0.665, 0.3739, 0.3687, -0.851, -0.66, 0.3495, -0.665, -0.5933, 0.5663, -0.572, -0.3739, 0.3687, -0.851, 0.5933, 0.5663, -0.572, -0.0507, 0.9518, -0.3023, 0.0507, 0.9518, -0.3023, -0.5933, 0.5663, -0.572, 0.4844, -0.3373, -0.8072, -0.4844, -0.3373, -0.8072, 0.5587, -0.6583, -0.5044, -0.2485, -0.5826, -0.7738, 0.2485, -0.5826, -0.7738, -0.981, -0.0934, -0.1698, -0.141, -0.7728, -0.6188, -0.7433, -0.0973, -0.6618, 0.2485, -0.5826, -0.7738, 0.7433, -0.0973, -0.6618, -0.5392, 0.4506, -0.7114, 0.7433, -0.0973, -0.6618, 0.7613, 0.6471, -0.0399, 0.5392, 0.4506, -0.7114, -0.5392, 0.4506, -0.7114, 0.0873, 0.74, -0.6668, 0.5392, 0.4506, -0.7114, -0.0873, 0.74, -0.6668, 0.0873, 0.74, -0.6668, -0.0507, 0.9518, -0.3023, -0.0873, 0.74, -0.6668, 0.0507, 0.9518, -0.3023, 0.3854, 0.1162, -0.9153, 0.1983, 0.0051, -0.9801, -0.3854, 0.1162, -0.9153, -0.1983, 0.0051, -0.9801, 0.3854, 0.1162, -0.9153, 0.4315, -0.0331, -0.9015, 0.3281, 0.0002, -0.9446, -0.4315, -0.0331, -0.9015, -0.3854, 0.1162, -0.9153, -0.3281, 0.0002, -0.9446, 0.3447, -0.0767, -0.9355, 0.3178, 0.0937, -0.9435, -0.3447, -0.0767, -0.9355, -0.3178, 0.0937, -0.9435, 0.3447, -0.0767, -0.9355, 0.4365, -0.0136, -0.8996, 0.3573, 0.298, -0.8851, -0.4365, -0.0136, -0.8996, -0.3447, -0.0767, -0.9355, -0.3573, 0.298, -0.8851, 0.3573, 0.298, -0.8851, -0.3573, 0.298, -0.8851, -0.0507, 0.9518, -0.3023, 0.3854, 0.1162, -0.9153, -0.3854, 0.1162, -0.9153, 0.0507, 0.9518, -0.3023, 0.0873, 0.74, -0.6668, 0.3854, 0.1162, -0.9153, -0.0507, 0.9518, -0.3023, -0.3854, 0.1162, -0.9153, -0.0873, 0.74, -0.6668, 0.0507, 0.9518, -0.3023, -0.5392, 0.4506, -0.7114, 0.3447, -0.0767, -0.9355, 0.0873, 0.74, -0.6668, -0.3447, -0.0767, -0.9355, 0.5392, 0.4506, -0.7114, -0.0873, 0.74, -0.6668, 0.3447, -0.0767, -0.9355, -0.5392, 0.4506, -0.7114, -0.3447, -0.0767, -0.9355, 0.5392, 0.4506, -0.7114, 0.3573, 0.298, -0.8851, -0.7433, -0.0973, -0.6618, -0.3573, 0.298, -0.8851, 0.3573, 0.298, -0.8851, -0.3573, 0.298, -0.8851, 0.4719, -0.7796, -0.4116, -0.0439, -0.6481, -0.7602, -0.0797, -0.8453, 0.5283, -0.0418, -0.6989, 0.714, 0.0797, -0.8453, 0.5283, 0.0439, -0.6481, -0.7602, -0.4719, -0.7796, -0.4116, 0.0418, -0.6989, 0.714, 0.6731, -0.4998, -0.545, 0.4719, -0.7796, -0.4116, 0.6149, -0.4906, 0.6174, -0.4719, -0.7796, -0.4116, -0.6731, -0.4998, -0.545, -0.6149, -0.4906, 0.6174, 0.7896, 0.179, -0.5869, 0.6731, -0.4998, -0.545, 0.9234, 0.0856, 0.3741, -0.6731, -0.4998, -0.545, -0.7896, 0.179, -0.5869, -0.9234, 0.0856, 0.3741, 0.3604, 0.8605, -0.36, 0.7896, 0.179, -0.5869, 0.3048, 0.6219, 0.7213, -0.7896, 0.179, -0.5869, -0.3604, 0.8605, -0.36, -0.3048, 0.6219, 0.7213, 0.0163, 0.8736, -0.4863, 0.3604, 0.8605, -0.36, -0.4176, 0.5586, 0.7166, -0.3048, 0.6219, 0.7213, -0.3604, 0.8605, -0.36, -0.0163, 0.8736, -0.4863, 0.4176, 0.5586, 0.7166, -0.2878, 0.7388, -0.6094, -0.6562, 0.5715, 0.4927, 0.4176, 0.5586, 0.7166, 0.2878, 0.7388, -0.6094, 0.6562, 0.5715, 0.4927, -0.0418, -0.6989, 0.714, 0.6562, 0.5715, 0.4927, 0.0418, -0.6989, 0.714, 0.626, -0.0259, 0.7794, 0.8965, 0.3044, -0.322, -0.2878, 0.7388, -0.6094, -0.6562, 0.5715, 0.4927, -0.8965, 0.3044, -0.322, -0.626, -0.0259, 0.7794, 0.626, -0.0259, 0.7794, -0.6562, 0.5715, 0.4927, 0.402, -0.6167, 0.6767, 0.6562, 0.5715, 0.4927, -0.626, -0.0259, 0.7794, -0.402, -0.6167, 0.6767, 0.2744, -0.96, 0.0552, 0.402, -0.6167, 0.6767, -0.0439, -0.6481, -0.7602, -0.402, -0.6167, 0.6767, -0.2744, -0.96, 0.0552, 0.0439, -0.6481, -0.7602
-};
-
-float mTangents[] = {
-0.0857229, 0.932535, 0.350755, 0.661838, 0.748553, -0.0404845, 0.560557, 0.818054, -0.128696, 0.243871, 0.914672, 0.322339, -0.521699, 0.833878, -0.180216, -0.649608, 0.753645, -0.100148, -0.0688123, 0.96027, 0.270455, -0.209393, 0.938102, 0.275898, 0.617893, 0.786071, -0.0173315, 0.183856, 0.930836, 0.315819, -0.597838, 0.799318, -0.0606584, -0.176461, 0.936566, 0.302828, 0.633385, 0.553257, -0.541045, 0.608737, 0.447588, -0.65506, 0.517073, 0.829902, -0.209522, -0.419786, 0.485001, -0.767172, -0.507522, 0.602202, -0.616258, -0.329005, 0.821528, -0.465669, 0.748029, 0.199095, -0.633099, -0.659041, 0.218861, -0.719559, 0.00310465, 0.395786, -0.918338, 0.373289, 0.609501, -0.699402, -0.243505, 0.692006, -0.679583, 0.101294, 0.47529, -0.873979, 0.199631, 0.528158, -0.825347, -0.169755, 0.548462, -0.818763, 0.356602, 0.867026, -0.347996, 0.273461, 0.879213, -0.390133, 0.107176, 0.588182, -0.801596, -0.241534, 0.906827, -0.345437, -0.291743, 0.912834, -0.285692, 0.0353819, 0.664745, -0.746232, 0.1673, 0.836451, -0.521881, -0.153878, 0.861618, -0.483669, 0.021436, 0.994571, -0.101827, 0.644395, 0.722203, 0.251351, 0.47555, 0.826123, 0.302281, -0.415847, 0.839467, 0.349809, -0.6143, 0.721681, 0.319079, -0.00941357, 0.99772, -0.066831, 0.532297, 0.770324, 0.351086, -0.399343, 0.778844, 0.48366, 0.402717, 0.580302, 0.707861, 0.229768, 0.498364, 0.835966, -0.0896254, 0.52534, 0.846159, -0.199628, 0.639386, 0.742518, 0.453163, 0.197124, 0.869359, -0.341221, 0.212137, 0.915733, -0.141393, 0.425646, 0.893775, 0.130415, 0.708717, 0.693335, -0.0987425, 0.728412, 0.677987, 0.236908, 0.512325, 0.825468, 0.363837, 0.520692, 0.772336, 0.0518227, 0.650854, 0.757432, -0.0247997, 0.669988, 0.741957, -0.0848746, 0.736589, 0.670994, 0.0317801, 0.765876, 0.642202, -0.0440151, 0.714619, 0.698128, 0.00622231, 0.784652, 0.619905, 0.10352, 0.748362, 0.655162, -0.300063, 0.566023, 0.767842, 0.0721334, 0.744002, 0.664272, 0.338214, 0.596798, 0.727629, -0.0288369, 0.767424, 0.640491, -0.489577, 0.703056, 0.515777, -0.30097, 0.603945, 0.738016, 0.0882619, 0.940663, 0.327663, 0.350211, 0.639167, 0.684702, 0.394112, 0.639114, 0.660461, -0.165595, 0.722851, 0.670869, -0.248608, 0.522074, 0.815863, -0.785098, 0.171177, 0.595248, 0.516075, 0.287367, 0.8069, -0.480373, 0.295941, 0.825628, 0.277726, 0.546937, 0.789765, -0.558376, -0.344668, 0.7546, -0.258682, 0.15092, 0.9541, 0.608495, 0.75442, 0.246137, -0.590182, 0.757962, 0.277811, -0.832307, 0.168279, 0.528154, 0.0210567, 0.994693, -0.100711, 0.0798067, 0.975324, -0.205849, -0.0655452, 0.982472, -0.17451, -0.0358105, 0.988988, -0.143596, -0.655196, 0.739164, 0.15606, 0.105852, 0.932016, -0.346614, -0.53942, 0.708121, -0.455621, -0.123158, 0.62886, -0.767703, 0.214931, 0.674599, -0.706202, -0.0981512, 0.940798, -0.324447, -0.374738, 0.389763, -0.841223, -0.53028, 0.200634, -0.823741, 0.783704, 0.245877, -0.570396, -0.748318, 0.259578, -0.610442, -0.78091, -0.447219, -0.436092, 0.129025, 0.424288, -0.896288, 0.662069, 0.746151, -0.0701711, -0.650212, 0.750565, -0.117797, -0.964147, 0.126049, -0.233522, 0.0508521, 0.981308, 0.185604, -0.0353088, 0.994586, 0.0977347, -0.660037, 0.747102, -0.0786801, 0.387736, 0.919298, 0.0674629, -0.347402, 0.935805, 0.0598405, 0.90169, 0.0761168, 0.42563, 0.975204, 0.0326658, 0.218883, 0.999814, -0.0117612, 0.0152719, 0.983019, -0.0384957, 0.17942, 0.980208, -0.0590133, -0.188969, 0.921574, -0.0870828, -0.378309, 0.645035, 0.444808, 0.621349, 0.912655, 0.0851535, 0.399763, 0.924998, -0.149011, -0.349535, 0.627309, -0.422642, -0.654108, 0.241019, 0.712868, 0.658581, 0.824242, 0.268363, 0.498605, 0.827519, -0.235197, -0.509798, 0.24432, -0.627209, -0.739538, 0.0915596, 0.640812, 0.762218, 0.62401, 0.668862, 0.404024, 0.805656, -0.226919, -0.547199, 0.0801285, -0.683063, -0.72595, 0.0218755, 0.478894, 0.8776, 0.589336, 0.61975, 0.51826, 0.754987, 0.41889, 0.504505, 0.754624, -0.419893, -0.504214, 0.6939, -0.440275, -0.569791, 0.0214809, -0.48018, -0.876907, 0.292375, 0.280036, 0.914383, 0.712091, 0.243429, 0.658536, 0.875709, -0.0640109, 0.478577, 0.976274, -0.190105, 0.10368, 0.866266, 0.0899641, -0.491416, 0.70919, -0.242135, -0.662133, 0.290309, -0.274164, -0.916818, 0.98167, 0.163032, -0.0987149, 0.758209, 0.264321, 0.596032, 0.58918, 0.278794, 0.75838, 0.824711, -0.0531349, 0.563052, 0.820437, 0.0674394, -0.567746, 0.600387, -0.289895, -0.745316, 0.750616, -0.260844, -0.607072, 0.141949, 0.472231, 0.86997, 0.827964, 0.0861196, 0.554129, 0.841292, 0.0108278, 0.540472, 0.832413, -0.129878, -0.538721, 0.129278, -0.446213, -0.88554, 0.835204, 0.0145111, -0.549748, 0.198375, 0.585569, 0.785975, 0.240826, -0.0103368, 0.970513, 0.816627, 0.425552, 0.389905, 0.826556, -0.395278, -0.400701, 0.187439, -0.103843, -0.976772, 0.18161, -0.552356, -0.813585, 0.162343, 0.154807, 0.974515, 0.522196, -0.101764, 0.846732, 0.918019, 0.225421, 0.32623, 0.818767, 0.419295, 0.39219, 0.935177, -0.1107, -0.336436, 0.36066, -0.0191956, -0.9325, 0.186001, -0.106797, -0.976728, 0.870103, -0.163016, -0.465131, 0.463109, -0.166289, 0.870562, 0.948166, -0.0406813, 0.315161, 0.948218, 0.0395872, -0.315143, 0.630419, 0.329945, -0.702643, 0.846507, -0.109803, 0.520931, 0.941619, 0.143591, 0.304524, 0.947067, -0.115198, -0.299655, 0.835617, 0.103952, -0.539387, 0.770425, 0.62481, 0.126721, 0.842093, 0.536574, -0.0544795, 0.874398, -0.480259, 0.0691303, 0.762854, -0.626856, -0.158445, 0.800698, 0.586617, -0.121503, 0.609992, 0.770367, -0.185594, 0.767569, 0.636627, -0.0744535, 0.821702, -0.56478, 0.076352, 0.61062, -0.746714, 0.263746, 0.800309, -0.571262, 0.182113, 0.998738, 0.0141545, 0.0481813, 0.942655, 0.333673, -0.00804566, 0.915579, -0.402021, 0.00969684, 0.903889, 0.392727, 0.16956, 0.915248, 0.344153, 0.209475, 0.911217, -0.356276, -0.206761, 0.9153, -0.360429, -0.179766, 0.958713, 0.264873, 0.103495, 0.951599, -0.290624, -0.0999861, 0.978018, 0.0694224, 0.196623, 0.990325, 0.0515504, 0.12884, 0.980135, -0.0169262, -0.197606, 0.987761, 0.068102, -0.14032, 0.970218, 0.0969901, 0.221968, 0.970439, -0.0809067, -0.227383, 0.931628, 0.0644469, 0.357654, 0.872279, 0.125607, 0.472602, 0.873131, -0.0796235, -0.480939, 0.931026, -0.0431956, -0.362388, 0.894856, 0.0299075, 0.445353, 0.87302, 0.0974781, 0.477843, 0.872876, -0.0584649, -0.484426, 0.893403, -0.0107704, -0.449127, 0.887883, -0.0176128, 0.459732, 0.844248, 0.0240299, 0.535413, 0.849515, -0.0502443, -0.525167, 0.88369, 0.0371503, -0.466596, 0.9423, -0.0124318, 0.334539, 0.844418, 0.0248214, 0.53511, 0.899482, 0.0512029, 0.433949, 0.840533, -0.00734826, -0.54171, 0.940269, 0.0268671, -0.339371, 0.884349, 0.0341962, -0.465571, 0.987539, -0.108991, -0.113525, 0.989281, -0.115198, 0.0897373, 0.979599, 0.173915, -0.100691, 0.981133, 0.165387, 0.100125, 0.949035, 0.00129918, -0.315168, 0.997392, 0.0721652, 0.000977024, 0.997552, 0.0345278, 0.0608174, 0.950405, 0.0353704, 0.308997, 0.995523, -0.07907, -0.051786, 0.885387, 0.459931, -0.067479, 0.961019, -0.275072, 0.027896, 0.93778, 0.344606, -0.0426185, 0.999783, 0.020312, -0.00465761, 0.955115, 0.214074, -0.204759, 0.951443, -0.305898, 0.034375, 0.984157, -0.0378273, 0.173219, 0.999405, 0.0110794, -0.0326583, 0.999999, -0.00118109, 0.000417616, 0.999055, 0.0410146, -0.0144123, 0.999574, -0.00301234, 0.0290161, 0.995684, 0.0535423, 0.0758058, 0.995799, -0.048924, -0.0774015, 0.980615, 0.14509, 0.131695, 0.974913, -0.184991, -0.123784, 0.755007, 0.28135, 0.592289, 0.969909, 0.201714, 0.136339, 0.973517, 0.153253, 0.169642, 0.783555, 0.327892, 0.527758, 0.968143, -0.186862, -0.166677, 0.981233, -0.134949, -0.137731, 0.755451, -0.279897, -0.592411, 0.811183, -0.192254, -0.552286, 0.782094, 0.333307, 0.526532, 0.781737, -0.334614, -0.526233, 0.864999, 0.179321, 0.468637, 0.999811, 0.0172684, -0.0088866, 0.999962, 0.0087258, -3.57856e-05, 0.865302, -0.314338, -0.390442, 0.998977, 0.0452023, -0.00154691, 0.979559, 0.182021, -0.085627, 0.979324, -0.183056, 0.0861139, 0.61675, -0.0473422, 0.785734, 0.3496, 0.144808, 0.925641, 0.776617, 0.363549, 0.514488, 0.80023, -0.42957, -0.418451, 0.378496, -0.419547, -0.825058, 0.613311, 0.0574036, -0.787753, 0.445869, -0.870017, -0.210407, 0.603426, -0.378674, 0.701772, 0.0958248, -0.789276, 0.606516, -0.240602, -0.330821, -0.912507, 0.501573, 0.84506, 0.185198, 0.653538, -0.0789294, -0.752767, 0.999817, 0.0156861, 0.0109701, 0.930714, 0.324917, 0.167933, 0.962621, -0.1842, 0.198571, 0.687468, 0.468262, -0.555085, 0.875116, -0.335686, -0.34855, 0.99987, -0.0131979, -0.0092437, 0.961915, 0.190648, -0.195888, 0, -0.650488, -0.759516, 0, -0.619009, -0.785384, 0, 0.823206, 0.567743, 0.953151, -0.301353, 0.0262777, 0.894956, -0.276379, -0.350241, 0.772175, -0.522469, -0.361625, 0.999501, -0.0162545, 0.0270931, 0.971405, 0.0535697, 0.231307, 0.999973, 0.00629125, -0.00391195, 0.971105, -0.0508065, -0.233182, 0.94134, 0.209074, 0.264891, 0.833222, 0.549361, 0.0628012, 0.976168, 0.191128, -0.102788, 0.976852, -0.184652, 0.108003, 0.987134, -0.158858, -0.0181553, 0.916815, 0.393163, 0.069805, 0.889856, 0.0722825, 0.450479, 0.866725, -0.138458, -0.479184, 0.934086, -0.355243, -0.0358555, 0.902906, 0.0990335, 0.418275, 0.902926, -0.0968422, -0.418743, 0.901308, 0.0283626, 0.43225, 0.90226, -0.0474061, -0.428578, 0.90274, 0.0630875, 0.425535, 0.979779, 0.137584, -0.145274, 0.87498, -0.327273, -0.356794, 0.943775, -0.330295, -0.0139028, 0.901568, 0.0319713, 0.431454, 0.897761, -0.192673, -0.396108, 0.98301, 0.150918, 0.104472, 0.945916, 0.10721, 0.306184, 0.993619, 0.102611, 0.0468285, 0.995902, -0.0734826, -0.0527248, 0.983376, -0.149298, -0.103351, -0.471578, 0.362921, -0.803681, 0.644315, 0.238726, 0.726545, 0.996394, -0.0397045, 0.074979, 0.645644, -0.231513, -0.727699, 0.670242, -0.154637, -0.725854, 0.996857, 0.0296623, -0.0734608, 0.679888, 0.212405, 0.701881, 0.703791, 0.268177, 0.657844, 0.705803, -0.261611, -0.658332, 0.67886, -0.20542, -0.704948, 0.780158, 0.185745, 0.597372, 0.780473, -0.184314, -0.597403, -0.013778, 0.371097, 0.928492, 0.670543, 0.487404, 0.559293, -0.00945958, -0.360175, -0.932837, 0.65471, -0.516613, -0.551784, -0.00775842, 0.380597, 0.924708, 0.00294587, -0.349115, -0.937075, 0.417042, 0.896862, -0.14736, 0.851985, -0.521642, 0.0448416, 0.978428, 0.186942, -0.0879315, 1, 0.000235927, -0.000492727, 0.97118, 0.0964679, -0.217952, 0.97728, -0.191795, 0.0902173, 0.969819, -0.101475, 0.221707, 0.759594, 0.0373693, -0.649323, 0.756108, -0.149001, 0.63726, 0.911921, 0.0596496, -0.406008, 0.920248, -0.105581, 0.376823, 0.999999, -0.00114797, 0.000386874, 0.999621, -0.0209891, -0.0177985, 1, -0.000407798, 0.000159177, 0.944942, 0.168432, -0.280562, 0.999541, 0.0257144, 0.0160292, 0.944938, -0.169179, 0.280127, 0.736712, 0.162566, -0.656375, 0.921778, -0.0297967, -0.386572, 0.730875, -0.240697, 0.63866, 0.892738, 0.12803, 0.432004, 0.132526, 0.768751, -0.625667, 0.709707, -0.670439, 0.216396, 0.710166, 0.670215, -0.215585, 0.152717, 0.786858, -0.59794, 0.0571879, 0.976748, 0.206622, 0.998942, 0.0328939, -0.0321337, 0.842252, -0.31418, -0.438067, 0.970515, -0.0989461, 0.219798, 0.829156, 0.268375, 0.490382, 0.939939, 0.0742743, -0.333163, 0.833031, -0.280696, -0.476727, 0.940094, -0.0756769, 0.332411, 0.838027, 0.532707, 0.118046, 0.856188, -0.438168, -0.273773, 0.932859, 0.300169, -0.199179, 0.932733, -0.300861, 0.198727, 0.856216, 0.437374, 0.274949, 0.996472, -0.0830743, -0.0118965, 0.978355, 0.141109, 0.151363, 0.967024, 0.254683, 0.000904375, 0.984384, 0.0472539, -0.169573, 0.963152, 0.267661, -0.026382, 0.93641, 0.291247, 0.195734, 0.971319, -0.236943, 0.0199185, 0.969909, -0.0888758, -0.226667, 0.955294, 0.293931, -0.0319145, 0.927023, 0.323408, 0.189832, 0.945224, 0.298712, 0.131618, 0.937762, -0.286239, -0.196644, 0.965025, -0.260968, 0.0249602, 0.954526, -0.265297, -0.136004, 0.972552, -0.22757, 0.0485198, 0.96729, 0.248342, -0.0517346, 0.979055, 0.00314988, 0.203573, 0.982808, -0.179969, 0.0412336, 0.978755, 0.00372338, -0.204998, 0.996882, 0.0748924, -0.024856, 0.900037, 0.0555202, 0.432262, 0.952452, 0.12266, 0.278909, 0.955483, -0.0889867, -0.281306, 0.899183, -0.0490281, -0.434817, 0.895518, 0.0243308, 0.44436, 0.951493, 0.104835, 0.289258, 0.953966, -0.0537588, -0.295058, 0.891311, -7.36521e-05, -0.453392, 0.980001, 0.0815561, 0.18151, 0.981779, -0.0468056, -0.184174, 0.942077, 0.13255, 0.308094, 0.950458, -0.04461, -0.307635, 0.98481, 0.00569876, 0.173542, 0.98415, 0.0194452, -0.176271, 0.990799, -0.00940941, 0.135016, 0.981345, 0.0793292, 0.175124, 0.984402, -0.0124256, 0.175496, 0.976221, -0.122021, -0.179175, 0.989547, -0.0681412, -0.127096, 0.983359, -0.0754546, -0.165265, 0.963397, 0.246239, 0.105987, 0.946328, 0.264366, 0.185943, 0.955913, -0.226962, -0.186329, 0.970869, -0.212706, -0.110311, 0.859934, 0.321773, 0.396201, 0.939703, 0.258018, 0.224468, 0.864457, -0.264649, -0.427404, 0.94413, -0.228665, -0.23734, 0.987818, 0.136205, -0.0752635, 0.993562, -0.0994362, 0.0542844, 0.983922, -0.0257162, 0.176739, 0.949582, 0.0774479, -0.303804, 0.982422, 0.0515769, -0.17941, 0.980631, 0.0185184, 0.194986, 0.984503, 0.0484509, 0.168543, 0.98068, -0.140161, -0.136459, 0.973607, 0.130962, -0.186919, 0.980298, 0.150066, 0.128434, 0.975393, -0.0387512, -0.21704, 0.932476, 0.0226012, -0.360523, 0.978321, 0.064954, 0.196642, 0.933322, 0.106295, 0.342945, 0.966007, 0.102323, -0.237402, 0.96412, 0.0156396, 0.265005, 0.991632, 0.128161, -0.0155349, 0.995205, -0.088556, 0.0415286, 0.977296, 0.0282445, 0.209987, 0.981286, -0.00515954, -0.192489, 0.992537, -0.117773, 0.0316387, 0.874011, -0.04882, 0.483447, 0.990502, 0.133218, -0.0340487, 0.882144, 0.0792993, -0.464256, 0.973519, -0.223488, 0.0480988, 0.720844, -0.169025, 0.672171, 0.976767, 0.20933, -0.0459075, 0.720498, 0.165378, -0.673449, 0.93547, 0.294552, 0.195284, 0.664445, 0.291454, 0.688163, 0.664867, -0.198959, -0.719977, 0.94434, -0.260129, -0.201381, 0.937116, 0.28848, 0.19645, 0.588626, 0.100905, 0.802083, 0.59299, 0.0243339, -0.804842, 0.94674, -0.249817, -0.203163, 0.86222, 0.500585, -0.0774048, 0.996954, 0.037166, 0.0685724, 0.862392, -0.500896, 0.0733685, 0.79522, 0.605682, -0.0278506, 0.550992, 0.808034, -0.208541, 0.515046, -0.822133, 0.24254, 0.78592, -0.616668, -0.0452851, 0.774379, 0.623336, 0.108578, 0.946285, -0.177713, 0.270118, 0.78902, -0.516578, 0.332558, 0.877142, 0.32777, 0.350983, 0.916573, 0.359515, -0.175052, 0.779226, -0.621046, -0.0843131, 0.835349, -0.00987346, -0.549631, 0.733752, -0.450392, 0.508679, 0.415091, -0.379201, 0.826986, 0.347578, 0.366807, -0.862927, 0.141499, 0.754496, -0.64087, 0.0708702, -0.2654, 0.96153, 0.124122, 0.283378, -0.950942, 0.346323, -0.265309, 0.899817, -0.29368, -0.119867, 0.948359, 0.192961, -0.305426, 0.93246, -0.268236, 0.152619, -0.951187, 0.212353, -0.0511374, -0.975854, -0.294936, 0.120525, -0.947885, 0.210535, 0.0549675, 0.97604, -0.213815, -0.324793, 0.921299, 0.0138147, 0.480536, 0.876866, -0.434138, 0.0789081, 0.897384, 0.0381294, -0.537658, -0.8423, 0.108752, -0.40416, -0.9082, 0.237427, 0.00322426, -0.9714, -0.600541, -0.382985, -0.701907, 0.162261, 0.51379, 0.842432, 0.393719, 0.380366, 0.836843, 0.382975, -0.373679, -0.844804, 0.15569, -0.500495, -0.851625, 0.59357, 0.191648, 0.78163, 0.629723, 0.386719, 0.673719, 0.48679, 0.436896, 0.756411, 0.629425, -0.386611, -0.674059, 0.691939, -0.234537, -0.682797, 0.572472, -0.486303, -0.660141, -0.277194, 0.91099, 0.305385, -0.194612, 0.581779, 0.789721, -0.107596, 0.418867, 0.90165, -0.357878, 0.856196, 0.372628, -0.0454963, -0.480067, -0.876051, -0.0937464, -0.5905, -0.801574, -0.264619, -0.914346, -0.306509, -0.397009, -0.834894, -0.38123, -0.298596, 0.911078, 0.284215, -0.29947, 0.904643, 0.303215, -0.30531, 0.928625, 0.21081, -0.340844, -0.891383, -0.298767, -0.171865, -0.940423, -0.293372, -0.119153, -0.973659, -0.194398, 0.703626, 0.3734, 0.604552, 0.689743, 0.691197, 0.215641, 0.691586, 0.510485, 0.510993, 0.704533, -0.372928, -0.603787, 0.149206, -0.640274, -0.753517, 0.841905, 0.283573, 0.45911, 0.942038, 0.277339, 0.188804, 0.842429, -0.283143, -0.458414, 0.874575, 0.101709, -0.474104, 0.840989, -0.404634, -0.359179, 0.669734, 0.521846, 0.528331, 0.234955, 0.881094, 0.410452, 0.671009, -0.521201, -0.527348, 0.265203, -0.883071, -0.387109, -0.385255, 0.882308, 0.270392, -0.36095, -0.898044, -0.251461, -0.485001, 0.6293, 0.607253, -0.472911, -0.813294, -0.338981, 0.227341, -0.837662, -0.496626, -0.375, -0.79662, -0.474101, -0.318522, 0.856887, 0.405325, -0.357876, -0.816374, -0.453275, 0.00307122, 0.82687, 0.562384, 0.449588, 0.60196, 0.659935, 0.453871, -0.600896, -0.657971, -0.233111, 0.546918, 0.804077, -0.231406, -0.556069, -0.798272, -0.263084, 0.331955, 0.905866, -0.202888, -0.683681, -0.701011, 0.0733087, 0.309133, 0.948189, 0.262164, 0.187061, 0.94672, 0.262032, -0.186203, -0.946925, 0.0681229, -0.28713, -0.955466, -0.25826, 0.376825, 0.889553, -0.264962, -0.312393, -0.912253, 0.387421, 0.296078, 0.873065, 0.293005, -0.134478, -0.946607, 0.501201, 0.152454, 0.851795, 0.537495, -0.605965, -0.586435, 0.759514, -0.264996, -0.594067, -0.756524, 0.623758, 0.196462, -0.622555, 0.574168, 0.531748, -0.305896, 0.456538, 0.835464, -0.538048, 0.604723, 0.58721, -0.209194, -0.524573, -0.825264, -0.476435, -0.714523, -0.512315, -0.57847, -0.778025, -0.245049, -0.339498, -0.674816, -0.65526, 0.0241124, 0.267508, 0.963254, -0.192681, 0.332147, 0.923338, 0.0908487, -0.305606, -0.947814, 0.0112139, -0.338466, -0.940912, 0.223407, 0.184663, 0.957073, 0.0627056, 0.164674, 0.984353, 0.265106, -0.214648, -0.940024, 0.134027, -0.16351, -0.977395, -0.245058, 0.475961, 0.844635, -0.244324, -0.480738, -0.842138, 0.421948, 0.397743, 0.814715, 0.375203, 0.292981, 0.879423, 0.176317, 0.528885, 0.830177, 0.373144, -0.290687, -0.881059, 0.405158, -0.387387, -0.828118, 0.170741, -0.492964, -0.853132, -0.998258, 0.0560164, -0.0185375, -0.828441, 0.452893, 0.329506, -0.761812, -0.59189, -0.263267, -0.926442, -0.357385, 0.118247, -0.712101, 0.395044, 0.58039, -0.622465, 0.668113, 0.40763, -0.751922, 0.369083, 0.546251, -0.825078, 0.0131188, 0.564866, -0.757564, -0.371331, -0.536852, -0.588119, -0.673667, -0.447536, -0.662631, -0.421415, -0.619136, -0.806447, -0.0137289, -0.591147, -0.88541, 0.275106, 0.374653, -0.92616, -0.208875, 0.314006, -0.900446, -0.331016, -0.282181, -0.987749, 0.0864171, -0.129936, -0.979513, -0.111522, 0.167682, -0.982468, 0.103242, -0.155238, -0.998258, 0.0560164, -0.0185375, -0.68069, 0.0831809, 0.727834, -0.306987, 0.56759, 0.763938, -0.424889, 0.613143, 0.665977, -0.279919, -0.541615, -0.792653, -0.641918, -0.0591121, -0.764491, -0.397206, -0.607854, -0.687562, -0.373511, 0.628706, 0.682069, -0.236367, 0.771715, 0.590412, -0.332, 0.651336, 0.682303, -0.203485, -0.75243, -0.626453, -0.381379, -0.635633, -0.671208, -0.336107, -0.653343, -0.678362, -0.367749, 0.668101, 0.64684, -0.386235, 0.596357, 0.703691, -0.598546, 0.503057, 0.623439, -0.3918, -0.606211, -0.692098, -0.3591, -0.664165, -0.655692, -0.589593, -0.493413, -0.639471, -0.485198, 0.5983, 0.637667, -0.759894, 0.368397, 0.535579, -0.485395, -0.593082, -0.642375, -0.764907, -0.445715, -0.465031, -0.590828, 0.636561, 0.495693, -0.63542, 0.611614, 0.47135, -0.764964, 0.452012, 0.45882, -0.764923, -0.460285, -0.45059, -0.706339, -0.480164, -0.520122, -0.565404, -0.673255, -0.476493, -0.764141, 0.417225, 0.491948, -0.686309, 0.522014, 0.50644, -0.763661, -0.408839, -0.499673, -0.810322, 0.0148303, -0.585798, -0.763962, 0.48854, 0.421533, -0.756916, -0.345354, -0.554805, -0.537421, 0.678308, 0.501076, -0.425715, 0.692184, 0.582793, -0.412648, -0.687124, -0.597981, -0.444865, -0.677611, -0.58561, -0.53495, 0.678473, 0.50349, -0.609907, 0.560162, 0.560564, -0.568603, 0.729617, 0.379933, -0.360205, -0.539257, -0.761219, -0.502382, -0.679351, -0.534878, -0.366711, -0.667705, -0.647838, -0.695358, 0.0270032, 0.718156, -0.64671, 0.0620026, 0.760212, -0.532597, 0.559516, 0.635045, -0.609656, -0.0399069, -0.791661, -0.51005, 0.0756415, -0.856812, -0.443304, -0.551856, -0.706354, -0.560714, 0.649397, 0.513695, -0.638004, 0.558591, 0.530026, -0.53365, 0.678509, 0.50482, -0.496045, -0.679336, -0.540779, -0.564262, -0.56059, -0.606092, -0.636285, -0.605046, -0.478603, -0.863318, -0.504404, 0.016071, -0.514882, -0.822191, 0.242691, -0.37664, -0.666651, 0.64321, 0.141499, 0.754496, -0.64087, -0.490504, 0.830268, -0.264691, -0.863363, 0.503838, -0.0274202, -0.261911, -0.103483, 0.959528, -0.620923, 0.559544, 0.548968, -0.561298, -0.560425, -0.60899, -0.142973, 0.0323338, -0.989198, -0.694972, 0.342324, 0.63232, -0.661991, -0.356834, -0.659119, -0.289955, 0.551359, 0.782259, -0.0714313, -0.324026, -0.943348, 0.033041, 0.618546, 0.785054, -0.190923, 0.452376, 0.871151, 0.0367793, -0.712012, -0.701203, -0.424253, -0.672139, -0.606827, -0.011206, 0.742056, 0.670244, 0.0400843, -0.667954, -0.743123, 0.15099, 0.28262, 0.947274, 0.276108, 0.00554598, 0.961111, 0.15832, -0.287455, -0.944619, 0.366921, -0.0770553, -0.927055, 0.346618, 0.0607758, 0.936036, 0.374937, 0.159685, 0.913194, 0.371345, -0.0806025, -0.92499, 0.431443, -0.174219, -0.885158, 0.403104, 0.386079, 0.829729, 0.505938, 0.193336, 0.840624, 0.509582, -0.19652, -0.837679, 0.408026, -0.38912, -0.825894, 0.547355, 0.230037, 0.804665, 0.527521, -0.212341, -0.822577, 0.508214, 0.195357, 0.838781, 0.512573, -0.199173, -0.835224, -0.462202, 0.501354, 0.731447, -0.371305, 0.58083, 0.724409, -0.646834, 0.593212, 0.479276, -0.314496, -0.627104, -0.712624, -0.323992, -0.595504, -0.735122, -0.541455, -0.736318, -0.405786, -0.686256, 0.522116, 0.506407, -0.574027, -0.6977, -0.42861, -0.0883871, 0.709465, 0.699176, -0.227301, -0.648723, -0.726287, 0.832236, 0.257728, 0.490876, 0.826585, 0.512984, 0.231528, 0.873595, 0.213622, 0.437261, 0.813855, 0.290482, 0.503251, 0.868557, -0.241703, -0.432652, 0.867639, -0.470521, -0.160663, 0.8211, -0.265852, -0.505092, 0.816613, -0.277523, -0.506086, 0.796959, 0.357414, 0.486941, 0.910952, 0.306412, 0.276184, 0.736938, -0.0260341, 0.675458, 0.898784, -0.346854, -0.268104, 0.789178, -0.38337, -0.479818, 0.726611, 0.0169456, -0.68684, 0.928643, 0.341959, -0.143829, 0.510736, 0.338464, 0.790311, 0.914425, -0.377757, 0.14535, 0.472568, -0.432779, -0.767712, 0.982696, 0.183144, 0.0276783, 0.720536, 0.609265, 0.331095, 0.976874, -0.210816, -0.0357056, 0.735786, -0.378335, -0.561677, 0.719404, 0.271673, 0.639258, 0.991033, 0.132968, 0.0131855, 0.869939, -0.121193, 0.478036, 0.840765, 0.257417, 0.476288, 0.866858, 0.0676445, -0.493945, 0.996842, -0.0793754, 0.0021725, 0.722348, -0.286308, -0.629477, 0.697754, -0.0448691, -0.714931, 0.573557, -0.0831267, 0.814937, 0.939731, -0.146494, 0.308941, 0.714234, -0.552419, 0.429771, 0.939906, 0.123446, -0.318336, 0.585802, 0.0716693, -0.807279, 0.631083, 0.607886, -0.481881, 0.971272, 0.202327, 0.125282, 0.959311, -0.137505, 0.246607, 0.939849, -0.141287, 0.311, 0.970093, 0.180094, -0.162743, 0.968807, -0.205396, -0.138653, 0.875122, 0.457499, -0.157659, 0.985915, 0.165714, 0.0225773, 0.598376, 0.677585, -0.42758, 0.638275, -0.737196, 0.221692, 0.981797, -0.187716, -0.028951, 0.117911, 0.407871, -0.905394, 0.998256, -0.0451835, -0.0379815, 0.104431, -0.483416, 0.869139, 0.884344, -0.45435, -0.107245, 0.959269, 0.0479001, -0.278405, 0.125948, -0.358791, 0.924882, 0.885605, -0.180931, 0.427747, 0.798142, 0.353288, 0.488012, 0.808409, 0.296473, 0.508507, 0.989944, 0.117215, 0.0791989, 0.822227, -0.360096, -0.440765, 0.791067, -0.377323, -0.481498, 0.824962, 0.232524, 0.51514, 0.675883, 0.252166, 0.692527, 0.683206, -0.274857, -0.676523, 0.820758, -0.256419, -0.510495, 0.664131, -0.00273318, 0.747611, 0.120828, 0.464932, 0.877062, 0.643076, -0.171208, -0.746419, 0.107465, -0.444789, -0.889165, 0.808974, 0.199366, -0.553005, 0.954341, -0.252332, 0.15988, 0.878131, -0.450288, 0.161638, 0.296929, -0.930612, 0.213999, 0.888856, 0.422599, -0.177047, 0.998511, 0.00388152, 0.0544074, 0.815724, -0.201927, 0.542052, 0.631026, 0.412168, -0.657209, 0.375298, -0.135552, 0.916939, 0.666048, 0.193083, 0.720485, 0.663096, -0.415064, -0.622916, 0.366014, 0.0993802, -0.925288, 0.894224, -0.407461, 0.185307, 0.803624, -0.458325, 0.37964, 0.664131, -0.00273318, 0.747611, 0.804573, 0.44047, -0.398307, 0.905953, 0.370515, -0.204863, 0.365088, -0.528324, 0.766541, 0.238161, -0.454131, 0.858513, 0.80401, -0.383054, 0.454793, 0.643076, -0.171208, -0.746419, 0.240012, 0.448911, -0.86074, 0.400941, 0.410496, -0.818987, 0.80412, 0.384955, -0.45299, 0.511903, -0.031607, 0.858462, 0.384654, 0.266541, 0.88374, 0.808947, -0.427238, 0.403822, 0.508475, 0.180951, -0.841849, 0.815476, 0.460042, -0.351227, 0.461027, 0.104771, 0.88118, 0.381078, 0.274397, 0.882885, 0.269345, 0.00162901, -0.963042, 0.475159, -0.129, -0.870392, 0.456777, 0.0976061, 0.884211, 0.642756, 0.177937, 0.745119, 0.472486, -0.124373, -0.872518, 0.630893, -0.148366, -0.761552, 0.381078, 0.274397, 0.882885, 0.513864, 0.812662, 0.274816, 0.663096, -0.415064, -0.622916, 0.481419, -0.833293, -0.271769, 0.389405, 0.429456, 0.81482, 0.388958, -0.458728, -0.798924, 0.269345, 0.00162901, -0.963042, 0.72064, 0.16963, 0.672238, 0.761453, 0.194, 0.618509, 0.722095, -0.176512, -0.668896, 0.770184, -0.281012, -0.572581, 0.527149, 0.224427, 0.819601, 0.79289, 0.0659846, 0.605782, 0.801961, -0.108303, -0.587476, 0.502711, -0.178293, -0.845869, 0.479242, 0.136235, 0.867045, 0.620987, -0.296302, 0.725659, 0.621138, 0.322336, -0.714344, 0.490586, -0.15631, -0.857258, 0.151991, 0.785081, -0.600456, 0.76281, -0.303566, 0.570937, 0.886575, -0.312966, 0.340642, 0.894943, 0.149079, -0.420539, 0.792501, 0.373402, -0.482197, 0.760684, -0.299529, 0.575885, 0.904709, 0.0569761, 0.422204, 0.901861, -0.0695244, -0.426396, 0.753398, 0.285062, -0.592564, 0.513764, 0.280515, 0.810776, 0.745679, -0.197438, 0.636381, 0.761392, 0.401819, 0.508747, 0.749298, 0.242801, -0.616117, 0.256707, -0.539964, -0.801586, -0.843497, 0.246764, 0.477095, 0.711119, -0.0358103, 0.702159, 0.98929, 0.00639246, -0.145824, 0.992136, -0.0133309, 0.124454, 0.700468, 0.01314, -0.713563, 0.872915, 0.247593, 0.420378, 0.871611, -0.265328, -0.412184, 0.828664, 0.468176, 0.306802, 0.967355, -0.190378, -0.167274, 0.952863, 0.00343381, 0.303383, 0.139949, 0.264263, -0.954243, -0.434017, 0.610031, -0.662941, 0.458802, 0.645787, -0.610295, 0.952699, 0.291317, 0.0866017, 0.54376, 0.664119, 0.5131, 0.613503, 0.788943, 0.0343931, 0.366057, -0.768983, 0.524087, 0.456587, -0.491564, 0.741548, 0.36437, 0.636393, 0.679882, 0.745195, 0.648858, -0.153845, 0.952225, 0.134773, 0.27405, 0.741095, -0.65517, 0.146733, 0.896577, -0.233522, -0.376322, 0.977438, 0.0656145, 0.200775, 0.976905, 0.110175, 0.18308, 0.972315, -0.0823487, -0.218681, 0.974012, -0.114037, -0.195696, 0.921354, -0.103009, 0.374827, 0.974632, -0.106897, 0.196634, 0.92238, 0.0766158, -0.378609, 0.978252, 0.0630712, -0.197597, 0.920166, -0.122527, 0.371863, 0.891362, -0.138169, 0.431721, 0.942105, -0.073271, 0.327216, 0.896966, 0.0908488, -0.432665, 0.922399, 0.0751595, -0.378854, 0.944549, 0.0137033, -0.328084, 0.936693, 0.0933895, 0.337467, 0.934693, 0.136137, 0.328353, 0.935048, -0.115991, -0.335009, 0.92321, -0.196185, -0.330447, 0.9082, 0.279285, 0.311726, 0.881837, 0.204745, 0.424786, 0.881727, 0.204962, 0.42491, 0.886593, -0.176583, -0.427519, 0.929373, -0.168139, -0.328626, 0.917128, -0.0673526, -0.392862, 0.852753, 0.282447, 0.439358, 0.85961, -0.265699, -0.436435, 0.955427, -0.0418758, -0.292241, 0.911527, 0.106629, 0.397176, 0.908471, -0.126334, -0.398397, 0.978395, 0.0133844, 0.206311, 0.95406, 0.130378, 0.269763, 0.893653, -0.294017, 0.339026, 0.827498, 0.209456, 0.520937, 0.903909, 0.246823, -0.349324, 0.95365, -0.131333, -0.270747, 0.822152, -0.211573, -0.528492, 0.778853, 0.588315, -0.217426, 0.936909, -0.0334023, 0.347975, 0.940578, 0.159242, 0.299925, 0.924768, 0.143301, -0.352519, 0.772601, -0.601, 0.204662, 0.948559, -0.142683, -0.282625, 0.937929, 0.0686864, 0.339957, 0.588749, 0.805755, 0.0642957, 0.936015, -0.103507, -0.336395, 0.79901, -0.540807, 0.262888, 0.803197, 0.385591, 0.454086, 0.0197155, 0.985808, -0.166715, 0.835286, -0.322035, -0.445635, 0.779125, 0.427509, 0.458476, 0.767705, -0.446023, -0.460101, 0.535465, -0.117397, 0.836358, 0.554739, -0.648593, 0.521145, 0.48805, 0.429032, 0.760091, 0.481253, 0.612178, 0.627402, 0.49878, -0.425055, -0.755346, 0.675046, 0.580131, -0.455808, 0.551401, 0.103249, -0.827827, 0.523062, -0.593562, -0.611629, 0.700566, 0.195009, 0.686425, 0.728311, 0.081687, 0.68036, 0.162315, 0.844891, 0.509718, 0.678994, -0.0236631, -0.733763, 0.705043, -0.2114, -0.676922, 0.118257, -0.83143, -0.542899, 0.223206, 0.807187, 0.54647, 0.695242, 0.678862, 0.23619, -0.179397, 0.958023, 0.223626, 0.736543, -0.518823, -0.433968, 0.215546, -0.814633, -0.538435, -0.220071, -0.916709, -0.333488, -0.867945, 0.168045, -0.467367, -0.528519, 0.684335, -0.502349, -0.366791, 0.775603, -0.513716, -0.350037, -0.917009, 0.19123, -0.827558, -0.116951, 0.549063, -0.64741, -0.69079, 0.321976, 0.385949, -0.454126, -0.803002, -0.0195115, -0.378864, -0.925247, 0.111401, 0.814209, -0.569784, -0.402736, -0.770471, 0.494144, -0.588785, 0.0894603, 0.803324, 0.388843, 0.453572, 0.801919, -0.613299, -0.408608, 0.675947, 0.759465, -0.2116, -0.615174, 0.224962, 0.771434, -0.595215, 0.220425, -0.827412, 0.516528, 0.832841, 0.121095, 0.540104, 0.0814657, -0.702786, 0.706722, 0.00391127, 0.7145, 0.699624, 0.691333, -0.717024, -0.0890771, -0.478812, -0.641227, -0.599639, -0.125256, -0.98981, 0.0677246, -0.0538507, -0.646395, -0.7611, -0.503352, 0.424666, 0.752526, -0.750319, -0.56342, -0.345802, -0.412744, -0.308974, 0.856842, 0.64944, -0.570586, 0.502652, 0.185585, 0.975681, -0.116641, 0.646801, 0.762319, -0.0227747, 0.532444, 0.758797, 0.375141, 0.569242, -0.803566, 0.173914, 0.194906, -0.972924, 0.124219, 0.541344, -0.756243, -0.367482, 0.374937, 0.159685, 0.913194, 0.641648, 0.716999, 0.272396, 0.969221, -0.212096, 0.125006, 0.151326, -0.773507, -0.615457, 0.431443, -0.174219, -0.885158, 0.489569, 0.677248, -0.549233
-};
-
-float mBitangents[] = {
--0.174531, 0.512747, -0.840613, -0.297976, -0.0323321, -0.954026, -0.561998, 0.271996, -0.781138, -0.527047, 0.466223, -0.710533, -0.615993, -0.188536, 0.764858, -0.398591, 0.160185, 0.903032, -0.184269, -0.433951, 0.881891, -0.562487, -0.331667, 0.757367, -0.469412, 0.178207, -0.864809, -0.448938, 0.419226, -0.789116, -0.490952, -0.146077, 0.858852, -0.485322, -0.199074, 0.851371, -0.790724, 0.339526, -0.509389, -0.795561, 0.211136, -0.567895, -0.503422, 0.126866, -0.854676, -0.802717, -0.205644, 0.559782, -0.85227, -0.275312, 0.444792, -0.593465, 0.0299177, 0.804303, -0.835379, 0.112068, -0.538129, -0.883963, -0.0889331, 0.459022, -0.732906, 0.679592, 0.0316674, -0.829238, 0.547762, 0.110998, -0.8424, -0.520296, -0.140192, -0.747332, -0.652486, -0.12553, -0.733773, 0.677631, -0.0489218, -0.752873, -0.658133, 0.00648503, -0.60049, 0.554463, 0.576179, -0.536514, 0.383769, 0.751581, -0.823063, 0.520471, 0.227328, -0.567669, -0.208107, -0.79652, -0.678612, -0.337134, -0.652554, -0.788836, -0.186292, -0.58569, -0.251833, 0.658074, 0.70959, -0.279251, -0.539432, -0.794375, -0.284789, 0.509715, 0.811841, -0.498974, -0.119235, 0.858375, -0.739182, 0.227493, 0.633922, -0.796243, -0.121513, -0.592648, -0.589405, 0.242533, -0.770571, -0.291304, -0.471473, -0.832379, -0.708348, 0.0437507, 0.704506, -0.731947, -0.00268084, -0.681357, -0.938674, 0.292793, 0.182109, -0.936746, 0.274838, 0.21673, -0.95433, -0.24671, -0.168489, -0.955774, -0.258146, -0.14091, -0.962948, 0.0935453, 0.252943, -0.98561, -0.0701084, -0.153808, -0.680168, 0.683794, -0.264191, -0.772468, 0.548598, -0.319895, -0.780416, -0.515129, 0.354392, -0.678995, -0.675595, 0.287292, -0.774181, 0.542101, -0.326756, -0.734572, 0.570509, -0.36732, -0.738478, -0.536312, 0.408681, -0.787205, -0.475563, 0.392617, -0.789252, 0.458811, -0.408135, -0.740184, 0.475866, -0.475058, -0.791973, -0.428212, 0.435217, -0.705057, -0.255973, 0.661341, -0.637647, 0.55585, -0.533327, -0.790802, 0.443486, -0.421844, -0.629978, -0.539762, 0.558377, -0.791703, -0.324735, 0.51745, -0.252978, -0.00495911, -0.967459, -0.688271, 0.639516, -0.342495, -0.188628, 0.515773, -0.835702, -0.684371, -0.620304, 0.383222, -0.659727, -0.608362, 0.4412, -0.126091, -0.802573, 0.583076, -0.680136, 0.6835, -0.265033, -0.996691, 0.0133901, -0.080179, -0.997174, 0.0581153, 0.0476016, -0.999289, -0.0366354, 0.00886378, -0.678119, -0.670556, 0.300849, -0.691293, -0.663281, 0.286659, -0.744455, -0.563125, 0.358716, -0.711851, -0.247306, 0.657349, -0.742187, 0.324186, -0.586568, -0.729385, -0.269326, -0.628857, -0.238018, -0.650233, 0.721487, -0.273487, 0.765342, 0.582629, -0.287697, -0.734142, -0.615033, -0.224094, -0.746989, -0.62593, 0.41779, -0.749483, -0.513542, -0.237715, 0.706096, 0.667023, -0.504728, 0.105467, 0.856812, -0.754717, 0.64886, 0.0968616, -0.765337, -0.627245, -0.144302, -0.251978, -0.656827, -0.710693, -0.199363, -0.887772, -0.414869, -0.953719, 0.0428738, -0.297627, -0.922721, 0.103522, -0.371306, -0.944366, -0.0827131, 0.318326, -0.733256, -0.67965, -0.0202844, -0.625193, -0.509975, -0.590812, -0.463538, -0.189485, -0.86558, -0.511612, 0.258584, 0.819382, -0.229479, -0.335243, 0.913757, -0.169341, -0.631801, -0.756407, -0.196674, -0.45753, 0.867171, 0.284156, -0.585567, 0.759188, -0.89573, 0.411014, -0.169516, -0.912873, -0.37001, 0.172496, 0.383631, 0.209352, -0.899444, 0.163683, 0.657128, -0.735793, -0.000849368, 0.610224, -0.792228, 0.255621, 0.202853, -0.945256, -0.0907192, 0.653846, -0.75117, -0.452253, 0.21491, -0.86561, 0.382676, 0.493289, -0.781169, 0.0598642, 0.761957, -0.644855, -0.114171, 0.771907, -0.6254, -0.237486, 0.387156, -0.890905, 0.0258142, 0.855644, -0.516921, -0.126181, 0.932533, -0.338321, 0.178772, 0.911988, -0.369214, -0.0263866, 0.856809, -0.514958, -0.169924, 0.896115, -0.410004, -0.419295, 0.848233, -0.323562, 0.334798, 0.903543, -0.267433, 0.177636, 0.8694, -0.461074, -0.25594, 0.904175, -0.341999, -0.467723, 0.855214, -0.22326, -0.324632, 0.909226, -0.260621, 0.325491, 0.908753, -0.261196, 0.400331, 0.90093, -0.167511, 0.255993, 0.903816, -0.342905, 0.185471, 0.722849, -0.66565, 0.702173, 0.303131, -0.644256, 0.309315, 0.852226, -0.421943, 0.741357, 0.666184, -0.0811728, -0.286301, 0.853935, -0.434542, -0.697864, 0.301768, -0.649555, -0.18725, 0.725502, -0.662257, -0.438245, 0.887052, -0.145189, 0.720236, 0.309028, -0.621098, 0.645652, 0.584471, -0.491455, 0.196659, 0.915706, -0.35044, -0.215593, 0.916007, -0.338306, -0.616223, 0.572888, -0.540434, -0.726566, 0.311065, -0.61265, 0.401076, 0.849597, -0.342524, 0.15318, 0.944219, -0.291525, 0.239431, 0.915731, -0.32266, -0.133899, 0.942972, -0.304753, -0.402352, 0.855252, -0.326585, -0.247596, 0.915461, -0.317217, 0.399371, 0.842432, -0.361678, -0.472024, 0.828616, -0.30098, -0.119243, 0.965272, -0.232447, 0.0767981, 0.974678, -0.21001, 0.471174, 0.834488, -0.2857, -0.401376, 0.850927, -0.338853, -0.449163, 0.889304, -0.0859652, -0.82073, 0.545878, 0.168581, -0.433062, 0.88152, -0.188094, -0.5818, 0.680328, -0.445716, 0.384368, 0.907157, -0.171255, 0.824342, 0.544534, 0.154734, 0.442482, 0.895596, -0.0460133, 0.365925, 0.860583, -0.354254, -0.681018, 0.607268, 0.409194, -0.349006, 0.925806, -0.145185, 0.289407, 0.948851, -0.126195, 0.629142, 0.588801, 0.507437, -0.598106, 0.275048, 0.75274, -0.284823, 0.949288, 0.133146, 0.267474, 0.953471, 0.139105, 0.457998, 0.258877, 0.850423, 0.00925951, 0.247794, 0.968768, -0.449049, 0.866672, 0.217337, 0.330613, 0.920961, 0.206216, 0.0680382, 0.190867, 0.979255, -0.0586273, 0.197897, 0.978468, -0.037993, 0.251392, 0.967139, -0.215631, 0.976397, -0.0123245, 0.189019, 0.981867, -0.0144269, -0.0694138, 0.382855, 0.921197, 0.0334491, 0.216601, 0.975687, -0.103925, 0.280089, 0.954332, -0.0849254, 0.996098, -0.0240088, 0.0392775, 0.998938, -0.0240723, -0.197296, 0.945184, -0.260195, -0.211439, 0.959706, -0.18509, 0.29197, 0.934384, -0.204158, 0.147654, 0.957228, -0.248821, -0.364067, 0.920742, -0.140321, 0.195769, 0.972941, -0.122717, -0.271637, 0.960202, -0.0649976, -0.200784, 0.971846, -0.123298, 0.223387, 0.973154, -0.0554036, 0.184833, 0.975235, -0.121463, -0.154237, 0.924565, -0.34841, 0.130431, 0.929886, -0.343948, -0.0239184, 0.971254, -0.23684, -0.052669, 0.978977, -0.197052, 0.351884, 0.868995, -0.347886, 0.00277227, 0.973448, -0.22889, 0.041811, 0.977, -0.209099, -0.0838174, 0.973287, -0.213743, 0.0544289, 0.978686, -0.198019, -0.0634423, 0.978064, -0.198408, 0.170578, 0.925108, -0.339231, 0.200217, 0.915821, -0.348116, -0.225537, 0.916002, -0.331774, -0.193624, 0.92484, -0.327385, 0.039656, 0.93754, -0.345611, 0.132965, 0.911391, -0.38947, 0.175291, 0.925098, -0.336849, -0.154889, 0.913453, -0.376316, -0.140929, 0.93988, -0.311071, -0.130845, 0.92412, -0.359002, -0.0953484, 0.974544, -0.202909, 0.00671948, 0.981209, -0.192833, -0.113115, 0.976259, -0.184723, 0.0687169, 0.975939, -0.206933, -0.0752225, 0.985235, -0.153794, 0.00679792, 0.999886, 0.0134994, -0.000968267, 0.98113, -0.193346, 0.08099, 0.98508, -0.151845, -0.0532619, 0.980432, -0.189514, -0.203443, 0.95839, -0.200251, 0.170769, 0.96468, -0.200576, -0.133348, 0.970552, -0.200618, -0.00250262, 0.974701, -0.223501, -0.127751, 0.975319, -0.180093, 0.106787, 0.973853, -0.200516, 0.034979, 0.979855, -0.196623, 0.0126375, 0.911006, -0.412199, 0.0332001, 0.94301, -0.331104, -0.000416858, 0.943539, -0.331261, -0.0747543, 0.907885, -0.412501, -0.0227243, 0.945085, -0.326034, 0.0598975, 0.942538, -0.328685, -0.0931884, 0.978038, -0.186435, 0.116272, 0.974954, -0.189593, -0.316589, 0.943251, -0.100244, -0.200685, 0.979331, -0.0252223, -0.159621, 0.983322, -0.0871766, -0.243527, 0.947733, -0.206145, 0.172088, 0.981023, -0.0893299, 0.131588, 0.991183, -0.0155156, 0.316867, 0.943134, -0.100464, 0.100896, 0.988872, -0.109327, -0.266512, 0.938, -0.221646, 0.267192, 0.937699, -0.222103, 0.079941, 0.884182, -0.460251, -0.0637166, 0.887365, -0.456643, -0.00138355, 0.999991, -0.00410025, -0.163707, 0.896415, -0.411874, -0.0171604, 0.999268, -0.0341956, 0.00022878, 0.904876, -0.425675, 0.000228669, 0.904876, -0.425675, 0.187986, 0.92128, -0.340448, 0.127639, 0.954457, -0.269668, 0.410961, 0.644077, -0.645195, -0.436412, 0.651933, -0.620103, -0.130169, 0.955908, -0.263242, -0.190098, 0.921704, -0.33812, -0.310125, 0.913017, 0.264995, -0.61449, 0.574895, 0.540275, 0.355852, 0.92457, -0.136162, 0.716528, 0.622756, 0.314265, 0.328899, 0.908446, 0.257975, -0.279749, 0.931195, -0.233701, -0.274462, 0.790054, 0.548166, -0.0893275, 0.127885, 0.987758, 0.911212, -0.399277, 0.10134, 0.599434, 0.56658, 0.56539, 0.83527, -0.185711, 0.517529, -0.368905, 0.763629, 0.529886, 0.96251, 0.185269, -0.198114, 0, 0.650813, 0.759238, 0, 0.619316, 0.785142, 0, 0.822122, 0.569311, -0.0302043, 0.165895, 0.985681, -0.02588, 0.619118, 0.784871, -0.0377367, 0.821561, 0.568871, -0.0991339, 0.512079, -0.853198, 0.320306, 0.81252, -0.487047, -0.161658, 0.837715, -0.521632, -0.323325, 0.812033, -0.485864, -0.00393713, 0.619307, 0.785139, -0.00726512, 0.993495, 0.113647, -0.33641, 0.69929, 0.630731, 0.340266, 0.697666, 0.630461, 0.173136, 0.978519, 0.111909, -0.337826, 0.698701, 0.630627, -0.273578, 0.876811, 0.395421, 0.27551, 0.876648, 0.39444, 0.388368, 0.676155, 0.626086, -0.0268561, 0.975778, -0.217109, 0.0245804, 0.97607, -0.216064, 0.198687, 0.974168, -0.107332, -0.166848, 0.978194, -0.123685, -0.107351, 0.961433, -0.253226, -0.237981, 0.73598, 0.633797, 0.0248382, 0.976037, -0.216181, 0.143681, 0.762847, 0.630412, -0.0289276, 0.975486, -0.218152, -0.267075, 0.961024, -0.0714363, 0.00206472, 0.822219, 0.569168, -0.069642, 0.937237, 0.341667, -0.122951, 0.972066, -0.199928, 0.108532, 0.973906, -0.199317, 0.00195198, 0.822219, 0.569168, 0.0984561, 0.895513, -0.434008, -0.275484, 0.923945, -0.265393, -0.124515, 0.971862, -0.199952, 0.265219, 0.930213, -0.253698, 0.0254891, 0.835522, -0.548866, 0.111145, 0.973588, -0.199432, 0.0907004, 0.892533, -0.441768, -0.312777, 0.945544, -0.0900924, 0.300881, 0.950391, -0.0789145, -0.0957481, 0.894461, -0.436774, -0.325389, 0.939484, -0.1072, 0.323793, 0.940179, -0.105934, -0.345188, 0.881599, -0.321913, -0.594741, 0.731454, -0.333555, 0.344396, 0.904626, -0.251085, 0.301682, 0.949294, -0.0884798, -0.301586, 0.891691, -0.33754, 0.299108, 0.928683, -0.219275, -0.462378, 0.863485, -0.201495, 0.170046, 0.964587, -0.201634, -0.185117, 0.889212, -0.41837, -0.129795, 0.42577, -0.895474, -0.310903, 0.767902, -0.560058, -0.00134193, 0.904813, -0.425807, -0.0203589, 0.783638, -0.620884, 0.0514775, 0.997994, 0.0368472, -0.164726, 0.984419, -0.061516, 0.105026, 0.82914, 0.549087, -0.257337, 0.838292, 0.48067, -0.00065538, 0.943567, -0.331181, -0.0127638, 0.76267, 0.646662, -0.000655446, 0.943567, -0.331181, 0.447229, 0.839505, 0.308572, -0.107216, 0.843797, 0.525844, -0.447416, 0.839446, 0.308463, 0.232711, 0.970523, -0.0626891, 0.199065, 0.879943, 0.431363, -0.247065, 0.96596, -0.076681, -0.589253, 0.778493, 0.21617, -0.0548112, 0.787987, -0.613247, -0.329644, 0.688789, -0.645681, 0.329835, 0.688831, -0.64554, 0.0454778, 0.787692, -0.614389, -0.224238, 0.97301, -0.0544956, 0.000383761, 0.715304, -0.698813, -0.268203, 0.673378, -0.688933, 0.728839, 0.585354, -0.355183, -0.222711, 0.439126, -0.870384, 0.243592, 0.877964, 0.412119, -0.326104, 0.688009, -0.648306, -0.242452, 0.878044, 0.412621, 0.360863, 0.695111, -0.62177, -0.354601, 0.693914, -0.626691, 0.232124, 0.878708, 0.417122, -0.231452, 0.878747, 0.417413, 0.354925, 0.693977, -0.626438, -0.137207, 0.988837, -0.0581025, -0.0932563, 0.989976, -0.106067, 0.116876, 0.991416, -0.0586063, 0.0684791, 0.992411, -0.10213, -0.141864, 0.969344, -0.200614, -0.12592, 0.981901, -0.141475, 0.111043, 0.973372, -0.200539, 0.0301215, 0.992409, -0.11924, -0.353348, 0.914799, -0.195671, -0.0869194, 0.98736, -0.132532, -0.257061, 0.95838, -0.124208, 0.0608861, 0.990098, -0.126486, 0.119783, 0.972333, -0.20055, 0.113899, 0.988143, -0.10296, -0.176197, 0.971934, -0.155881, 0.151482, 0.976039, -0.156211, 0.0421837, 0.978298, -0.202863, -0.251962, 0.955348, -0.154352, -0.0966531, 0.976787, -0.191169, -0.238318, 0.959755, -0.148574, 0.0695173, 0.919065, -0.387926, 0.0921416, 0.995606, -0.0167007, -0.131687, 0.99128, -0.00469149, -0.160789, 0.925009, -0.344247, 0.170048, 0.925088, -0.339551, 0.0258811, 0.995626, -0.0897763, -0.0379925, 0.995575, -0.085953, -0.191141, 0.924881, -0.328725, -0.0805792, 0.99339, -0.0817524, 0.038177, 0.996537, -0.0738743, -0.262028, 0.963778, -0.0497259, 0.212087, 0.976687, -0.0331785, -0.341128, 0.925411, -0.165067, 0.294925, 0.942233, -0.158799, -0.294853, 0.946199, -0.133302, -0.335921, 0.940477, 0.0515688, -0.252005, 0.955602, -0.152702, 0.237591, 0.968734, 0.071452, 0.191405, 0.973884, -0.122121, 0.170732, 0.975228, -0.140642, -0.233442, 0.964063, -0.126839, -0.278888, 0.96019, -0.0160279, 0.219744, 0.975547, -0.00444945, 0.191149, 0.973938, -0.122094, -0.0734357, 0.874128, -0.480111, -0.133832, 0.908, -0.39702, -0.00492754, 0.897467, -0.441053, 0.0524619, 0.925274, -0.375655, -0.213733, 0.848423, -0.484249, 0.154725, 0.858098, -0.48962, -0.484389, 0.85556, -0.182715, -0.15966, 0.647536, -0.745121, 0.449077, 0.875434, -0.178733, 0.231882, 0.64602, -0.727248, -0.366685, 0.914938, -0.168615, -0.108486, 0.786891, -0.607481, 0.473743, 0.861741, -0.181576, 0.0396301, 0.782435, -0.62147, -0.208297, 0.786404, -0.581533, -0.0686776, 0.991404, -0.111362, 0.172955, 0.787563, -0.591465, 0.0386199, 0.991665, -0.122919, -0.0162088, 0.971648, 0.235877, -0.0216063, 0.97385, 0.22616, -0.0908477, 0.831802, 0.547587, 0.0354898, 0.837277, 0.545626, -0.175146, 0.788226, 0.589935, 0.0791467, 0.789139, 0.609095, -0.266663, 0.951468, -0.153622, -0.162793, 0.819509, 0.549458, 0.233751, 0.959939, -0.154525, 0.155066, 0.818456, 0.553248, -0.25595, 0.954349, -0.153974, -0.120925, 0.946442, 0.299374, 0.177285, 0.971767, -0.155686, 0.0762885, 0.936825, 0.341378, -0.200886, 0.966768, -0.15813, -0.0212692, 0.939045, -0.343136, 0.00531478, 0.945238, -0.326338, -0.0834239, 0.992294, -0.0916193, -0.0668651, 0.989525, -0.127941, -0.0991649, 0.989009, -0.109671, 0.0858998, 0.992086, -0.0915748, 0.0427252, 0.991576, -0.122274, 0.126656, 0.125262, 0.984006, -0.162809, 0.469612, 0.867732, -0.100424, 0.110162, 0.988827, -0.00842663, 0.234766, 0.972015, 0.355753, -0.632689, 0.687855, -0.383871, -0.611748, 0.691671, 0.204856, 0.0842253, 0.975162, -0.342899, -0.0310845, 0.938858, 0.168293, 0.131972, 0.976863, -0.582863, -0.56406, 0.584899, 0.237762, -0.70918, 0.663726, 0.385219, -0.66325, 0.641643, 0.277081, 0.0249814, 0.960522, 0.142362, -0.848503, 0.509682, -0.408324, 0.478379, 0.777448, -0.824109, 0.117963, 0.554012, 0.803514, 0.101604, 0.58655, 0.984827, -0.0235423, 0.171935, -0.89436, 0.25498, 0.367567, 0.880764, 0.239597, 0.408471, -0.453798, 0.883498, -0.116183, -0.672678, 0.680561, 0.290416, -0.936043, 0.33702, 0.101194, 0.673423, 0.652752, 0.34701, 0.440209, 0.897294, -0.0328692, 0.933375, 0.321602, 0.159323, -0.472409, 0.8258, -0.308034, 0.398181, 0.837681, -0.373822, 0.34236, 0.811559, -0.473457, -0.3284, 0.716612, -0.615322, -0.339707, 0.770693, -0.539103, -0.396669, 0.831666, -0.388567, 0.470929, 0.835942, -0.281828, 0.341091, 0.724159, -0.599375, 0.39764, 0.834925, -0.380503, 0.724983, 0.453475, -0.518421, -0.730024, 0.458448, -0.506844, -0.400026, 0.844613, -0.355821, 0.747042, 0.317527, -0.584042, 0.749465, 0.301911, -0.589196, 0.664889, 0.397007, -0.632699, -0.776142, 0.320282, -0.54316, -0.811361, 0.337195, -0.477486, -0.689319, 0.419358, -0.590744, 0.95243, 0.288968, 0.0968217, 0.999061, 0.0257204, 0.0348811, 0.682093, 0.680651, -0.267328, 0.872964, 0.444598, -0.200663, -0.682288, 0.679648, -0.269373, -0.995466, 0.0564254, 0.0765755, -0.955674, 0.279175, 0.0935389, -0.891495, 0.395265, -0.221365, 1, -0.000376308, -0.00012888, 0.999989, -0.00441925, -0.00150479, 0.986872, 0.119195, -0.108975, -0.948033, 0.301691, 0.101078, -0.997835, -0.062785, -0.0195993, -0.973992, 0.207474, -0.0910773, 0.909102, -0.218906, -0.354419, 0.898871, -0.418329, -0.13051, 0.892454, -0.212522, -0.397944, -0.908541, -0.219549, -0.35546, -0.951401, -0.113002, -0.286473, 0.000330661, -0.525502, -0.850792, 0.641754, -0.436489, -0.630578, 0.000331544, -0.525502, -0.850792, 0.000304751, 0.209785, -0.977747, -0.0703808, -0.628792, -0.774382, 0.872432, -0.238572, -0.42655, 0.677897, -0.218094, -0.702062, -0.870452, -0.241021, -0.429211, -0.772166, -0.00803604, -0.635371, 0.7634, 0.266353, -0.588453, -0.714846, 0.424547, -0.555657, 0.268314, 0.909545, -0.317388, -0.757569, -0.320355, -0.568738, 0.226732, -0.240444, -0.943811, -0.59855, -0.300941, -0.74241, 0.573585, 0.424018, -0.700864, -0.467107, 0.679438, -0.56584, 0.80974, 0.486523, -0.32805, 0.992542, 0.0311839, -0.117848, -0.992429, 0.0301749, -0.119055, 0.117644, 0.909334, -0.399089, -0.119101, 0.906924, -0.404109, 0.0848769, 0.954388, -0.286251, -0.184014, 0.756133, -0.628014, 0.213159, 0.901488, -0.376674, 0.0951201, 0.909213, -0.405318, -0.114968, 0.932682, -0.341886, -0.21628, 0.914608, -0.341636, 0.0652847, 0.973548, -0.218958, -0.113741, 0.915565, -0.385752, 0.311085, 0.667979, -0.67604, -0.430296, 0.77594, -0.461261, 0.751819, 0.319015, -0.577059, -0.270097, 0.625183, -0.732253, -0.765074, 0.323142, -0.556993, 0.717482, 0.664406, 0.209248, 0.686897, 0.723671, -0.0668753, 0.801696, 0.595923, -0.04646, 0.889258, 0.32818, 0.318618, -0.817745, 0.5676, -0.0955208, -0.733754, 0.670323, -0.110779, -0.775502, 0.602187, 0.189652, -0.918413, 0.283856, 0.275579, 0.853102, 0.497856, -0.156063, 0.98881, 0.0504772, 0.140383, -0.851066, 0.484354, -0.202702, -0.999783, 0.00702609, 0.0195936, 0.779484, 0.561495, -0.277719, 0.998797, -0.00809453, -0.0483642, -0.778315, 0.560526, -0.282908, -0.986738, -0.0267863, -0.160094, 0.108413, 0.923731, -0.367379, -0.110083, 0.921225, -0.37313, 0.693491, 0.423389, -0.582934, 0.562971, 0.635322, -0.52861, 0.109236, 0.772136, -0.625998, -0.580428, 0.649341, -0.491384, -0.741906, 0.470559, -0.477651, -0.130953, 0.83905, -0.52806, 0.276176, 0.912467, -0.301878, 0.351553, 0.856721, -0.377411, -0.418508, 0.814068, -0.402672, -0.618037, 0.746363, -0.246929, -0.77404, -0.356268, -0.523389, -0.720997, -0.0180107, -0.692704, -0.472619, 0.185616, -0.861497, -0.661722, -0.0173914, -0.749547, 0.464744, 0.181777, -0.866585, 0.583367, -0.173034, -0.793563, 0.832756, -0.311534, -0.457672, 0.537852, -0.0195593, -0.842812, -0.195102, 0.53102, -0.824592, -0.475354, 0.487316, -0.732504, 0.168251, 0.522613, -0.835803, 0.394682, 0.508932, -0.764993, 0.0637852, 0.552837, -0.830845, -0.117238, 0.550143, -0.8268, 0.276176, 0.912467, -0.301878, -0.629002, 0.407193, -0.662232, -0.600592, 0.605014, -0.522731, -0.755544, 0.114525, -0.645009, 0.60935, 0.624218, -0.488922, 0.679462, 0.412917, -0.606491, 0.820369, 0.215367, -0.529729, -0.338402, 0.18307, -0.923022, -0.653505, 0.482716, -0.583023, -0.521216, 0.0822684, -0.84945, 0.655556, 0.495256, -0.570059, 0.61647, 0.640642, -0.45776, 0.743946, 0.487312, -0.457244, -0.633761, 0.247132, -0.732989, -0.334251, 0.593986, -0.731749, -0.400243, 0.438553, -0.804659, 0.337439, 0.598926, -0.726238, 0.642161, 0.261172, -0.720707, 0.432965, 0.466136, -0.77153, 0.0471868, 0.718105, -0.694334, -0.060122, 0.744283, -0.665152, -0.0149713, 0.757975, -0.652112, 0.135331, 0.779815, -0.611207, 0.460933, 0.818464, -0.343013, 0.482511, 0.809887, -0.333566, 0.0425932, 0.684702, -0.727578, -0.047518, 0.681516, -0.730259, -0.434788, 0.849696, -0.298289, -0.467134, 0.812745, -0.348183, 0.020671, 0.698562, -0.715251, 0.390559, 0.881392, -0.265728, -0.0202073, 0.698848, -0.714985, -0.399109, 0.875642, -0.271963, -0.0667701, 0.747693, -0.660679, 0.060526, 0.744483, -0.664892, -0.741031, 0.00913564, -0.671409, -0.59262, 0.182602, -0.784512, 0.600336, 0.194241, -0.775801, 0.737385, 0.00408909, -0.67546, -0.761561, 0.0386373, -0.64694, -0.737173, 0.0214341, -0.675364, -0.619468, 0.223945, -0.752401, 0.797675, 0.0882027, -0.596603, 0.770193, 0.0516959, -0.635712, 0.661579, 0.295015, -0.689406, -0.806172, 0.398486, -0.437374, -0.658725, 0.410818, -0.630325, -0.851188, 0.160482, -0.499724, 0.647213, 0.409473, -0.642999, 0.762136, 0.403576, -0.506236, 0.802672, 0.0942961, -0.588919, -0.760028, -0.509703, -0.403188, -0.650323, -0.0594335, -0.757329, -0.725429, -0.012232, -0.688188, 0.735603, 0.00148651, -0.677412, 0.772703, 0.0591466, -0.632006, 0.864281, -0.394509, -0.312059, -0.827732, -0.497897, -0.258762, -0.781874, 0.125747, -0.610623, -0.912293, 0.366831, -0.182088, 0.984827, -0.0235423, 0.171935, 0.801903, 0.0808226, -0.591962, 0.831536, -0.499321, -0.243363, -0.832686, -0.499718, -0.23857, -0.772006, 0.0584626, -0.632921, 0.785454, 0.0737388, -0.614512, 0.836259, -0.500994, -0.222882, -0.950975, -0.147262, -0.271958, 0.962631, -0.128954, -0.238143, -0.620815, 0.651804, -0.435593, 0.596268, 0.595964, -0.537858, 0.0320207, 0.786922, -0.616221, -0.611974, 0.630285, -0.477733, -0.0315814, 0.778637, -0.626679, 0.565525, 0.536017, -0.626791, -0.442326, 0.658288, -0.609102, 0.436155, 0.734399, -0.520025, 0.806179, 0.541174, -0.239176, 0.705511, 0.583187, -0.402675, -0.8076, 0.544535, -0.226417, -0.748946, 0.592883, -0.295922, 0.685753, 0.577148, -0.443446, 0.854402, 0.217077, -0.472097, -0.767351, 0.594754, -0.239666, -0.881982, 0.228401, -0.412238, 0.630867, 0.366791, -0.683719, 0.700197, 0.581609, -0.414072, -0.691102, 0.578852, -0.432792, -0.644759, 0.379059, -0.663777, 0.590515, 0.540334, -0.599443, -0.624969, 0.555017, -0.548972, 0.718225, 0.586605, -0.374229, -0.710286, 0.584523, -0.392206, 0.69958, 0.683773, 0.207467, 0.752695, 0.644814, -0.132913, 0.376917, 0.890287, -0.255583, -0.771053, 0.61348, -0.170646, -0.854197, 0.51879, -0.0347122, -0.597313, 0.683879, -0.41896, 0.460108, 0.829372, -0.316926, -0.546651, 0.745595, -0.381131, 0.906886, 0.370088, -0.201478, -0.904552, 0.382176, -0.189014, -0.569943, 0.40781, 0.713341, -0.101316, 0.609236, 0.78649, -0.103433, 0.986896, -0.123844, -0.176639, 0.965383, -0.191925, 0.115561, 0.98476, -0.129974, 0.208758, 0.572606, 0.792807, 0.600951, 0.397353, 0.693518, 0.0457784, 0.99294, -0.109426, -0.206637, 0.955496, -0.210544, -0.252368, 0.951006, -0.178603, -0.776106, 0.490767, 0.395989, 0.35171, 0.912654, -0.208236, 0.273309, 0.928453, -0.251548, 0.859788, 0.456174, 0.2295, -0.253275, 0.965723, -0.0568492, -0.277361, 0.957331, -0.0811675, 0.290778, 0.955411, -0.0513582, 0.291774, 0.950979, -0.102502, -0.442132, 0.859672, 0.255897, 0.104934, 0.794177, -0.598558, 0.466687, 0.847455, 0.253029, 0.0153088, 0.727513, -0.685923, 0.376906, 0.866022, -0.328553, -0.0875502, 0.957467, 0.274938, 0.129757, 0.915562, 0.380669, 0.564645, 0.625998, -0.537869, -0.114913, 0.9205, 0.373464, -0.260844, 0.930145, 0.25844, -0.350305, 0.864635, -0.360129, -0.652706, 0.622892, -0.431254, 0.720562, 0.61017, -0.329367, 0.406249, 0.780559, 0.475069, 0.345821, 0.704149, -0.620146, -0.389765, 0.790404, 0.472594, -0.702239, 0.614762, -0.359066, -0.578118, 0.604203, -0.548378, -0.139567, 0.227887, 0.963633, 0.015691, 0.424741, 0.905179, 0.0213553, 0.923739, 0.382427, 0.0361648, 0.435726, 0.899353, -0.0438959, 0.260155, 0.964569, -0.29426, 0.840214, 0.455468, -0.0378722, 0.960762, 0.274776, 0.22734, 0.324113, 0.918296, -0.212513, 0.307255, 0.927595, 0.0714564, 0.958771, 0.275048, -0.167522, 0.84913, 0.500913, -0.0694134, 0.958945, 0.274966, 0.165577, 0.85922, 0.484071, 0.220352, 0.936617, 0.272385, -0.401974, 0.615885, -0.677571, 0.058086, 0.977594, -0.202328, 0.522519, 0.588979, -0.616504, -0.175344, 0.96575, -0.191266, 0.174892, 0.688059, -0.704264, 0.327511, 0.626257, -0.707488, -0.0655778, 0.641375, -0.76442, 0.199522, 0.957935, -0.206282, -0.176405, 0.965428, -0.191913, 0.197281, 0.765385, -0.61259, -0.286327, 0.801588, -0.524856, 0.20129, 0.957331, -0.207365, 0.171059, 0.934117, 0.313312, 0.490986, 0.730694, -0.474363, -0.0485621, 0.982186, 0.18153, -0.492918, 0.737955, -0.460928, 0.953877, 0.279045, 0.110688, 0.830481, 0.399375, -0.38833, 0.418872, 0.772743, 0.47688, 0.379512, 0.761298, 0.525734, -0.4052, 0.781181, 0.474941, -0.639938, 0.566209, -0.519506, -0.952156, 0.279321, 0.124015, -0.397093, 0.739989, 0.542894, -0.300303, 0.951718, 0.0636446, 0.0989893, 0.95354, -0.284539, -0.082891, 0.949617, -0.302252, 0.306227, 0.950832, 0.0463067, 0.364966, 0.804426, 0.46872, 0.166677, 0.608704, 0.775692, 0.171059, 0.934117, 0.313312, -0.148353, 0.621434, 0.769293, -0.353646, 0.810587, 0.46678, 0.222031, 0.928355, 0.298094, 0.274952, 0.924857, 0.262758, 0.457066, 0.348119, 0.818476, -0.0485621, 0.982186, 0.18153, -0.284334, 0.912575, 0.293871, -0.217113, 0.932649, 0.288147, -0.0788031, 0.666398, 0.741421, 0.248677, 0.841697, 0.479276, 0.374908, 0.639817, 0.670878, -0.397194, 0.651304, 0.64656, -0.215366, 0.878738, 0.425955, 0.577627, 0.686677, 0.441385, 0.58279, 0.806621, -0.09858, 0.331741, 0.879339, -0.341631, -0.401391, 0.90538, -0.138464, -0.576176, 0.808788, -0.117823, 0.467766, 0.805602, -0.363595, 0.35495, 0.830537, -0.429208, -0.458069, 0.802963, -0.381345, -0.381316, 0.835399, -0.395862, 0.331741, 0.879339, -0.341631, -0.668979, -0.24874, -0.700426, -0.082891, 0.949617, -0.302252, -0.168018, 0.728626, -0.663983, 0.0692744, 0.9528, -0.295589, -0.049566, 0.938849, -0.340742, -0.401391, 0.90538, -0.138464, 0.313603, 0.900469, -0.301344, 0.208278, 0.907404, -0.365018, -0.302255, 0.900156, -0.313626, -0.264216, 0.912048, -0.313622, 0.42738, 0.792847, -0.434442, 0.419236, 0.886328, -0.196631, -0.39409, 0.892187, -0.220669, -0.444337, 0.798743, -0.405678, 0.574673, 0.80922, -0.122124, -0.0838172, 0.94887, 0.304336, 0.0459321, 0.935383, 0.350642, -0.566381, 0.811276, -0.145063, -0.442218, 0.879869, -0.173993, -0.376553, 0.644667, 0.665291, -0.323304, 0.914392, 0.243644, 0.341314, 0.910827, 0.232163, 0.349858, 0.635572, 0.68822, -0.498376, 0.676643, 0.542011, -0.0252825, 0.921294, 0.388043, 0.0880163, 0.927546, 0.363198, 0.514812, 0.679525, 0.522698, 0.404464, 0.404815, 0.820081, 0.158048, 0.80083, 0.57766, 0.611467, 0.591939, 0.525087, -0.151014, 0.805451, 0.5731, -0.663566, -0.746215, -0.0533156, -0.740825, 0.433447, 0.51313, 0.137754, 0.628604, 0.765429, -0.18721, 0.288263, 0.939072, 0.212059, 0.285524, 0.934616, -0.126348, 0.636193, 0.761114, -0.0425435, 0.912511, -0.406834, -0.138028, 0.940595, -0.310208, -0.469425, 0.250374, -0.846731, -0.594245, 0.72258, -0.353201, -0.607908, 0.528145, -0.592883, -0.0485726, 0.966665, -0.251395, -0.632156, 0.551301, -0.544468, -0.096439, 0.994616, -0.0379316, 0.708368, 0.654198, -0.26503, 0.290101, 0.938384, 0.187823, 0.276182, 0.892634, 0.35627, 0.0699176, 0.995248, -0.0677708, -0.351187, 0.463284, 0.813656, -0.384259, 0.883383, 0.268289, 0.412259, 0.877818, 0.243881, 0.00202434, 0.669135, 0.743138, -0.39505, 0.881344, 0.25917, -0.774962, 0.370103, 0.512306, 0.0593365, 0.664247, 0.745154, -0.150949, 0.291908, 0.94446, -0.033488, 0.66674, 0.744538, 0.0542745, 0.299595, 0.952521, 0.0469507, 0.988287, 0.145208, 0.0389104, 0.999157, 0.0130764, -0.0236888, 0.990468, 0.135692, -0.13693, 0.990036, 0.0328569, 0.063522, 0.986344, 0.151956, 0.0698609, 0.997552, -0.00318818, 0.0523957, 0.998457, 0.0184093, -0.0365378, 0.999148, -0.0191967, -0.0263692, 0.990247, 0.136803, -0.0400644, 0.999097, 0.0141298, -0.0188126, 0.995893, -0.0885657, -0.0691648, 0.994745, 0.0754881, 0.0497696, 0.993762, -0.0997972, 0.115102, 0.991558, 0.0596991, -0.121093, 0.984697, -0.125336, -0.168616, 0.980933, -0.0966443, -0.258697, 0.942235, 0.212766, 0.237092, 0.962805, -0.129596, 0.21914, 0.962546, -0.159636, 0.346461, 0.922407, 0.170674, -0.398563, 0.905749, 0.144106, 0.166458, 0.952892, 0.253551, 0.58936, 0.272984, 0.760352, 0.344069, 0.902345, 0.259597, -0.323258, 0.912118, 0.252082, -0.0200204, 0.30366, 0.95257, 0.0486025, 0.665514, 0.744802, 0.143389, 0.972438, 0.183861, 0.209988, 0.306255, 0.9285, 0.0146481, 0.99269, 0.119801, -0.0246132, 0.667769, 0.743961, -0.175011, 0.306654, 0.935593, 0.456316, 0.866396, 0.202817, 0.122166, 0.991845, -0.0363226, 0.159089, 0.650636, 0.742538, -0.0585202, 0.996472, -0.0601542, -0.446987, 0.869148, 0.211624, -0.0479604, 0.665697, 0.744679, -0.26092, 0.949542, -0.174041, 0.346869, 0.888694, 0.299842, 0.28004, 0.94286, -0.180537, -0.471549, 0.861557, 0.188046, -0.574257, 0.817523, 0.0434165, -0.302769, 0.931168, 0.203119, 0.318083, 0.929905, 0.18466, -0.330803, 0.926664, 0.178502, 0.360718, 0.918218, 0.163581, 0.750666, 0.60014, -0.276282, 0.941517, 0.227611, -0.248474, 0.952324, -0.221147, -0.210173, 0.970787, -0.197405, -0.136394, -0.944515, -0.233462, -0.231056, -0.952052, 0.203464, -0.228474, -0.735532, 0.605532, -0.303849, -0.993047, -0.107771, -0.0473539, 0.172951, 0.822929, -0.54118, 0.40488, 0.606384, -0.684376, 0.788259, 0.405228, -0.463074, -0.717724, 0.610866, -0.334238, -0.141733, 0.810497, -0.568336, -0.787843, 0.416448, -0.453734, -0.600915, 0.0321918, -0.798665, -0.477882, 0.268402, -0.836415, 0.335007, 0.29571, -0.894609, 0.0524281, 0.702897, -0.709357, 0.593184, -0.0219258, -0.804768, -0.26476, 0.56359, -0.782476, 0.298373, -0.472019, -0.829561, -0.29174, -0.73191, -0.615788, 0.891884, 0.07929, -0.445259, 0.591975, -0.0293435, -0.805422, -0.309852, -0.474473, -0.823934, -0.411069, 0.597253, -0.688702, 0.939035, 0.153697, 0.307554, 0.917649, -0.257761, 0.302457, 0.908356, 0.275891, 0.314283, -0.952123, -0.217958, -0.214375, -0.912944, -0.246167, 0.325476, -0.928457, 0.167291, 0.331634, -0.906046, 0.315458, 0.282077, 0.71234, 0.590448, 0.379399, 0.74182, 0.369037, 0.559924, -0.901037, 0.152916, 0.405892, -0.585278, 0.639345, 0.498686, -0.733968, 0.331879, 0.592578, 0.878289, 0.31497, 0.359726, -0.496011, -0.165397, 0.852418, -0.996719, -0.0787484, -0.0187328, 0.040515, -0.99702, -0.0656556, -0.111724, -0.547879, -0.829063, -0.52553, 0.41014, 0.745388, -0.75201, -0.441621, -0.489338, -0.131918, 0.510331, 0.8498, -0.00903962, 0.999623, 0.0259417, 0.779642, 0.0426737, -0.62477, -0.00211058, 0.651531, -0.758619, 0.716884, -0.247689, -0.651711, -0.64135, 0.76644, -0.03521, -0.777429, -0.0576309, -0.626325, -0.694276, -0.276579, -0.664443, 0.854402, 0.217077, -0.472097, 0.699975, -0.269453, -0.661385, 0.961038, 0.180392, -0.209439, -0.667018, -0.309164, -0.677868, -0.881982, 0.228401, -0.412238, -0.943368, -0.277418, 0.181922
-};
-
-uint32_t mIndices[] = {
-3, 1, 0, 61, 3, 0, 61, 0, 60, 66, 64, 0, 3, 2, 1, 2, 18, 1, 96, 99, 1, 9, 8, 2, 9, 2, 3, 14, 12, 2, 2, 12, 18, 12, 20, 18, 92, 95, 18, 14, 13, 12, 12, 21, 20, 13, 21, 12, 21, 32, 20, 87, 91, 20, 13, 24, 21, 28, 26, 21, 21, 26, 32, 28, 27, 26, 26, 36, 35, 26, 35, 34, 27, 36, 26, 27, 40, 36, 40, 42, 36, 36, 42, 46, 36, 46, 35, 77, 80, 35, 72, 77, 76, 77, 81, 80, 81, 77, 102, 77, 72, 102, 65, 72, 71, 72, 76, 46, 72, 65, 102, 42, 48, 46, 42, 49, 48, 40, 43, 42, 43, 52, 42, 43, 53, 52, 66, 96, 102, 102, 96, 92, 92, 87, 102, 87, 81, 102, 65, 66, 102, 66, 65, 64, 96, 66, 99, 92, 96, 95, 87, 92, 91, 81, 87, 86, 81, 86, 85, 65, 71, 70, 57, 9, 3, 57, 3, 56, 7, 5, 4, 11, 7, 4, 11, 4, 10, 17, 4, 16, 4, 5, 19, 4, 19, 16, 59, 7, 11, 59, 58, 7, 7, 6, 5, 63, 6, 7, 63, 62, 6, 69, 6, 68, 101, 5, 6, 101, 6, 100, 69, 68, 67, 103, 69, 67, 103, 67, 73, 75, 47, 73, 103, 73, 78, 75, 74, 47, 37, 38, 47, 37, 47, 45, 45, 47, 51, 79, 47, 38, 30, 39, 38, 30, 38, 37, 79, 38, 78, 84, 38, 83, 31, 22, 30, 31, 30, 29, 22, 33, 30, 29, 30, 37, 16, 23, 22, 15, 16, 22, 15, 22, 25, 22, 23, 33, 17, 16, 15, 16, 19, 23, 90, 89, 23, 90, 23, 88, 94, 23, 19, 94, 19, 93, 98, 19, 5, 93, 97, 103, 103, 88, 93, 103, 82, 88, 103, 97, 100, 103, 78, 82, 98, 5, 97, 84, 83, 82, 29, 37, 41, 41, 37, 45, 41, 45, 44, 45, 51, 50, 44, 45, 55, 44, 55, 54, 107, 105, 104, 104, 105, 111, 104, 111, 110, 511, 107, 104, 516, 515, 104, 516, 104, 110, 110, 111, 115, 110, 115, 114, 519, 516, 110, 519, 110, 114, 114, 115, 119, 114, 119, 118, 521, 519, 114, 521, 114, 118, 525, 501, 519, 501, 527, 519, 525, 494, 501, 501, 494, 500, 501, 500, 499, 507, 501, 506, 501, 528, 527, 494, 493, 492, 494, 492, 491, 493, 494, 521, 493, 521, 530, 492, 493, 557, 534, 557, 493, 534, 493, 561, 492, 557, 558, 558, 557, 553, 665, 553, 557, 678, 557, 534, 558, 553, 554, 554, 553, 547, 665, 664, 553, 664, 547, 553, 554, 547, 548, 548, 547, 546, 664, 681, 547, 547, 681, 546, 669, 664, 668, 688, 681, 664, 688, 664, 669, 682, 681, 680, 546, 681, 686, 682, 680, 610, 606, 611, 610, 662, 606, 610, 607, 606, 601, 606, 612, 611, 662, 601, 606, 595, 601, 662, 595, 662, 658, 662, 794, 793, 662, 793, 658, 602, 601, 595, 607, 601, 602, 596, 595, 594, 602, 595, 600, 659, 595, 658, 620, 602, 575, 602, 623, 622, 602, 622, 575, 620, 575, 581, 576, 575, 574, 582, 581, 575, 582, 575, 576, 569, 570, 581, 569, 581, 585, 617, 616, 581, 617, 581, 570, 545, 570, 569, 545, 546, 570, 546, 686, 570, 548, 546, 545, 576, 574, 573, 573, 640, 639, 573, 639, 638, 638, 651, 632, 638, 632, 650, 638, 650, 654, 634, 633, 632, 632, 646, 645, 632, 645, 644, 634, 590, 633, 590, 589, 476, 590, 476, 588, 596, 594, 590, 628, 590, 627, 476, 475, 474, 476, 474, 473, 656, 475, 476, 475, 482, 137, 475, 137, 481, 565, 563, 475, 656, 565, 475, 130, 138, 137, 130, 137, 136, 144, 142, 137, 487, 485, 137, 144, 143, 142, 143, 150, 149, 143, 149, 148, 195, 200, 143, 195, 143, 199, 199, 143, 204, 193, 196, 195, 388, 391, 195, 388, 195, 199, 391, 193, 195, 199, 204, 203, 384, 388, 199, 384, 199, 387, 425, 391, 388, 427, 425, 388, 427, 388, 384, 391, 393, 193, 422, 393, 391, 425, 422, 391, 393, 395, 189, 393, 189, 193, 418, 417, 393, 422, 421, 393, 189, 156, 193, 193, 156, 196, 157, 156, 155, 156, 163, 162, 156, 162, 155, 189, 163, 156, 157, 155, 154, 462, 465, 155, 462, 155, 162, 469, 467, 155, 163, 166, 162, 163, 167, 166, 167, 170, 166, 456, 461, 166, 167, 171, 170, 171, 167, 187, 190, 167, 163, 171, 176, 175, 171, 175, 174, 176, 171, 184, 171, 187, 184, 176, 180, 175, 448, 447, 175, 448, 175, 180, 447, 450, 175, 176, 181, 180, 177, 178, 180, 177, 180, 182, 448, 180, 178, 448, 178, 449, 172, 179, 178, 172, 178, 177, 449, 178, 453, 449, 453, 452, 177, 186, 185, 177, 185, 172, 223, 186, 177, 223, 177, 182, 376, 186, 375, 405, 185, 186, 405, 186, 376, 172, 185, 188, 400, 406, 185, 400, 185, 405, 410, 405, 376, 412, 400, 405, 412, 405, 410, 402, 401, 400, 416, 415, 400, 416, 400, 412, 402, 191, 401, 192, 191, 164, 191, 194, 158, 191, 158, 164, 394, 194, 191, 394, 191, 396, 192, 164, 168, 158, 165, 164, 164, 165, 169, 164, 169, 168, 161, 159, 158, 158, 159, 165, 194, 197, 158, 464, 169, 165, 464, 165, 463, 463, 165, 159, 168, 169, 173, 460, 459, 169, 460, 169, 458, 168, 173, 172, 172, 188, 168, 161, 160, 159, 463, 159, 466, 472, 159, 471, 472, 471, 470, 194, 198, 197, 392, 198, 194, 392, 194, 394, 198, 202, 145, 198, 145, 201, 389, 202, 198, 389, 198, 392, 424, 392, 394, 426, 389, 392, 426, 392, 424, 420, 394, 419, 424, 394, 423, 420, 419, 416, 428, 389, 426, 385, 202, 389, 428, 385, 389, 430, 385, 428, 381, 386, 385, 385, 390, 202, 430, 381, 385, 434, 381, 430, 382, 211, 381, 381, 211, 386, 434, 433, 381, 438, 437, 434, 438, 365, 437, 445, 365, 438, 366, 220, 365, 365, 220, 216, 365, 216, 378, 445, 366, 365, 441, 366, 445, 366, 228, 220, 370, 228, 366, 441, 446, 366, 409, 442, 441, 410, 376, 409, 409, 376, 442, 376, 375, 374, 228, 227, 181, 228, 181, 225, 225, 220, 228, 370, 369, 228, 222, 181, 176, 226, 225, 181, 226, 181, 224, 222, 176, 183, 176, 184, 183, 373, 371, 183, 404, 373, 183, 404, 183, 184, 398, 404, 184, 398, 184, 403, 408, 373, 404, 411, 408, 404, 411, 404, 398, 399, 398, 397, 414, 411, 398, 414, 398, 413, 399, 397, 189, 190, 163, 189, 418, 414, 417, 408, 407, 373, 407, 440, 439, 407, 439, 373, 373, 372, 371, 440, 444, 364, 440, 364, 443, 444, 436, 363, 444, 363, 364, 364, 363, 217, 364, 217, 226, 368, 364, 226, 363, 377, 213, 363, 213, 217, 436, 435, 363, 436, 432, 435, 432, 429, 379, 432, 379, 431, 429, 427, 384, 429, 384, 379, 380, 379, 207, 379, 384, 383, 379, 383, 207, 380, 207, 213, 209, 130, 207, 207, 130, 214, 207, 214, 213, 209, 208, 130, 131, 130, 129, 131, 129, 128, 323, 325, 128, 540, 323, 128, 542, 540, 128, 323, 308, 325, 309, 308, 307, 308, 314, 247, 308, 247, 313, 314, 308, 323, 309, 307, 260, 262, 261, 260, 262, 255, 261, 268, 261, 267, 261, 289, 288, 261, 288, 267, 255, 289, 261, 268, 267, 266, 275, 267, 274, 267, 285, 284, 267, 284, 283, 275, 274, 273, 278, 273, 277, 278, 277, 276, 276, 277, 287, 276, 287, 286, 269, 276, 291, 297, 296, 287, 299, 287, 298, 300, 281, 287, 297, 289, 296, 255, 292, 289, 247, 256, 255, 247, 255, 254, 256, 294, 255, 238, 248, 247, 279, 256, 247, 279, 247, 248, 314, 238, 247, 238, 249, 248, 242, 250, 248, 242, 248, 249, 279, 248, 250, 279, 250, 257, 281, 256, 279, 281, 279, 257, 250, 258, 257, 281, 257, 282, 257, 258, 295, 257, 295, 282, 281, 280, 256, 300, 280, 281, 301, 284, 281, 301, 281, 282, 256, 280, 294, 250, 259, 258, 265, 263, 258, 258, 269, 290, 258, 290, 293, 265, 264, 263, 218, 306, 264, 218, 264, 305, 312, 264, 311, 312, 311, 310, 310, 316, 250, 310, 250, 315, 315, 324, 310, 324, 326, 310, 315, 250, 242, 315, 242, 318, 322, 321, 315, 315, 321, 324, 244, 243, 242, 244, 242, 241, 251, 241, 242, 251, 242, 249, 241, 236, 116, 241, 116, 246, 251, 236, 241, 113, 117, 116, 113, 116, 112, 117, 120, 116, 116, 236, 234, 116, 234, 112, 117, 121, 120, 520, 117, 113, 121, 127, 126, 121, 126, 125, 524, 121, 523, 533, 127, 121, 533, 121, 526, 322, 127, 321, 321, 127, 539, 324, 321, 537, 321, 539, 537, 324, 134, 326, 324, 537, 536, 541, 134, 324, 541, 324, 536, 135, 134, 133, 544, 134, 543, 135, 133, 132, 132, 141, 140, 132, 140, 139, 212, 211, 132, 212, 132, 210, 211, 215, 132, 211, 216, 215, 382, 216, 211, 221, 216, 220, 221, 220, 218, 225, 218, 220, 219, 218, 217, 225, 217, 218, 218, 304, 303, 218, 303, 302, 225, 226, 217, 219, 217, 213, 368, 226, 367, 147, 140, 146, 477, 484, 140, 477, 140, 483, 490, 140, 489, 147, 146, 145, 145, 153, 152, 145, 152, 151, 202, 205, 145, 202, 206, 205, 490, 489, 488, 544, 543, 488, 566, 675, 488, 566, 488, 674, 677, 488, 536, 488, 541, 536, 677, 536, 537, 537, 562, 495, 537, 495, 559, 537, 559, 679, 498, 496, 495, 495, 531, 526, 495, 526, 498, 496, 559, 495, 560, 555, 559, 496, 560, 559, 667, 559, 555, 498, 497, 496, 504, 502, 498, 526, 504, 498, 526, 520, 504, 504, 503, 502, 509, 503, 504, 504, 520, 518, 504, 518, 529, 520, 113, 518, 518, 113, 109, 518, 109, 517, 109, 113, 112, 107, 109, 108, 109, 112, 108, 514, 109, 513, 112, 234, 232, 112, 232, 108, 107, 108, 106, 108, 232, 231, 108, 231, 106, 107, 106, 105, 511, 510, 107, 105, 106, 230, 105, 230, 229, 111, 105, 229, 111, 229, 233, 334, 233, 229, 337, 334, 229, 337, 229, 336, 115, 111, 233, 115, 233, 235, 332, 235, 233, 334, 332, 233, 340, 339, 334, 340, 334, 337, 343, 332, 334, 332, 329, 235, 343, 342, 332, 342, 346, 332, 329, 328, 327, 329, 327, 235, 352, 328, 329, 331, 330, 328, 352, 351, 328, 354, 353, 328, 354, 328, 351, 331, 236, 330, 333, 236, 331, 251, 253, 236, 333, 234, 236, 335, 234, 333, 345, 335, 333, 345, 333, 344, 350, 333, 349, 335, 232, 234, 337, 232, 335, 340, 337, 335, 340, 335, 341, 337, 338, 232, 356, 355, 340, 356, 340, 351, 358, 351, 340, 358, 340, 357, 350, 349, 348, 362, 361, 344, 251, 249, 238, 251, 238, 239, 251, 239, 235, 251, 235, 252, 240, 239, 238, 240, 238, 237, 314, 317, 238, 239, 245, 115, 239, 115, 235, 320, 314, 319, 314, 323, 319, 320, 319, 122, 323, 534, 319, 319, 534, 538, 319, 538, 122, 323, 535, 534, 540, 535, 323, 676, 534, 535, 676, 535, 486, 535, 540, 486, 542, 486, 540, 487, 486, 485, 564, 673, 486, 564, 486, 672, 565, 564, 563, 669, 668, 564, 753, 669, 564, 658, 753, 564, 658, 564, 565, 659, 658, 565, 793, 753, 658, 753, 752, 669, 793, 797, 753, 797, 752, 753, 118, 123, 122, 532, 118, 122, 118, 124, 123, 532, 521, 118, 342, 347, 346, 342, 360, 359, 514, 513, 512, 509, 508, 503, 556, 549, 555, 560, 556, 555, 667, 555, 666, 666, 555, 549, 556, 552, 549, 552, 550, 549, 666, 549, 683, 550, 683, 549, 671, 670, 666, 689, 671, 666, 689, 666, 683, 685, 684, 683, 550, 687, 683, 685, 615, 684, 608, 615, 614, 663, 615, 608, 609, 603, 608, 608, 614, 613, 663, 608, 603, 597, 660, 663, 597, 663, 603, 663, 660, 796, 663, 796, 795, 605, 597, 603, 609, 605, 603, 599, 598, 597, 605, 604, 597, 661, 660, 597, 621, 577, 605, 605, 577, 625, 605, 625, 624, 621, 583, 577, 580, 578, 577, 584, 580, 577, 584, 577, 583, 587, 586, 583, 587, 583, 571, 619, 571, 583, 619, 583, 618, 551, 572, 571, 551, 571, 550, 550, 571, 687, 552, 551, 550, 580, 579, 578, 579, 643, 642, 579, 642, 641, 643, 653, 636, 643, 636, 652, 655, 653, 643, 637, 636, 635, 636, 649, 648, 636, 648, 647, 637, 635, 593, 593, 592, 480, 593, 480, 591, 599, 593, 598, 631, 629, 593, 480, 479, 478, 480, 478, 477, 657, 480, 477, 568, 477, 567, 657, 477, 568, 568, 567, 566, 661, 568, 660, 660, 568, 566, 671, 566, 670, 755, 566, 671, 660, 566, 755, 799, 660, 755, 755, 671, 754, 799, 755, 798, 755, 754, 798, 631, 630, 629, 524, 523, 522, 269, 291, 290, 299, 298, 290, 272, 270, 269, 272, 271, 270, 447, 451, 450, 456, 462, 461, 457, 456, 455, 457, 455, 454, 469, 468, 467, 628, 627, 626, 507, 506, 505, 693, 691, 690, 700, 698, 690, 693, 692, 691, 691, 692, 765, 691, 765, 764, 744, 749, 692, 744, 692, 748, 749, 765, 692, 790, 786, 765, 749, 790, 765, 801, 790, 749, 831, 801, 749, 831, 749, 744, 699, 740, 744, 699, 744, 743, 700, 699, 698, 705, 704, 699, 705, 699, 700, 704, 740, 699, 704, 736, 740, 834, 833, 740, 709, 708, 704, 709, 704, 705, 737, 736, 704, 737, 733, 736, 841, 838, 736, 841, 736, 733, 714, 726, 733, 714, 733, 732, 846, 845, 733, 846, 733, 726, 728, 727, 726, 728, 726, 714, 850, 849, 726, 850, 726, 727, 770, 769, 727, 770, 727, 768, 822, 828, 727, 822, 727, 827, 775, 770, 774, 775, 774, 773, 780, 774, 786, 782, 781, 780, 780, 786, 785, 805, 809, 780, 805, 780, 808, 809, 813, 780, 790, 789, 786, 801, 800, 790, 800, 804, 790, 873, 864, 801, 873, 801, 831, 801, 864, 859, 801, 859, 800, 800, 805, 804, 859, 805, 800, 859, 858, 857, 859, 857, 854, 864, 858, 859, 859, 854, 805, 864, 863, 858, 869, 867, 864, 880, 858, 879, 887, 858, 886, 880, 879, 881, 887, 886, 885, 869, 868, 867, 892, 891, 868, 892, 868, 838, 896, 868, 895, 838, 834, 837, 838, 837, 836, 834, 831, 833, 896, 895, 834, 834, 898, 831, 809, 805, 854, 809, 814, 813, 809, 854, 814, 854, 853, 818, 854, 818, 814, 814, 818, 773, 814, 773, 817, 818, 876, 875, 818, 875, 822, 823, 822, 821, 823, 821, 773, 782, 773, 781, 715, 714, 713, 722, 721, 714, 722, 714, 720, 715, 713, 712, 697, 695, 694, 746, 751, 694, 746, 694, 750, 695, 766, 694, 750, 694, 766, 697, 696, 695, 695, 767, 766, 792, 766, 787, 750, 766, 792, 803, 750, 792, 832, 746, 750, 832, 750, 803, 792, 787, 791, 803, 792, 802, 802, 792, 807, 783, 788, 787, 783, 787, 777, 784, 783, 777, 812, 811, 783, 812, 783, 810, 810, 783, 816, 779, 778, 777, 779, 777, 776, 784, 777, 778, 815, 820, 778, 815, 778, 819, 826, 778, 825, 810, 816, 815, 856, 815, 819, 810, 815, 856, 856, 819, 855, 819, 824, 878, 819, 878, 877, 862, 856, 861, 862, 806, 856, 810, 856, 806, 862, 861, 860, 866, 862, 860, 866, 860, 865, 882, 883, 860, 890, 888, 860, 872, 866, 871, 874, 803, 866, 803, 862, 866, 872, 871, 870, 894, 842, 870, 894, 870, 893, 842, 897, 870, 844, 738, 842, 842, 839, 897, 844, 843, 738, 739, 706, 738, 739, 738, 734, 707, 701, 706, 711, 707, 706, 711, 706, 710, 706, 701, 742, 706, 742, 741, 707, 703, 701, 703, 702, 701, 701, 747, 746, 701, 746, 745, 703, 696, 702, 835, 742, 746, 835, 746, 832, 874, 832, 803, 832, 899, 839, 803, 802, 862, 802, 807, 806, 862, 802, 806, 840, 742, 839, 840, 741, 742, 716, 735, 734, 716, 734, 730, 848, 730, 734, 848, 734, 847, 731, 716, 730, 731, 730, 729, 852, 729, 730, 852, 730, 851, 763, 772, 729, 763, 729, 771, 824, 830, 729, 824, 729, 829, 763, 762, 761, 763, 761, 760, 826, 825, 824, 719, 717, 716, 725, 724, 716, 725, 716, 723, 719, 718, 717, 890, 889, 888, 882, 884, 883, 759, 757, 756, 759, 758, 757, 903, 901, 900, 903, 902, 901, 910, 903, 909, 934, 902, 938, 949, 902, 948, 955, 902, 954, 934, 928, 926, 934, 926, 933, 934, 938, 928, 938, 910, 922, 938, 922, 928, 928, 922, 927, 928, 927, 926, 922, 916, 921, 922, 921, 920, 910, 916, 922, 916, 910, 915, 916, 915, 914, 910, 909, 908, 955, 954, 953, 949, 948, 947, 907, 905, 904, 939, 907, 904, 952, 950, 904, 958, 956, 904, 907, 906, 905, 913, 911, 907, 939, 935, 907, 913, 912, 911, 919, 917, 913, 940, 929, 913, 925, 919, 913, 919, 918, 917, 925, 923, 919, 925, 924, 923, 932, 930, 929, 940, 935, 929, 932, 931, 930, 937, 936, 931, 937, 931, 935, 937, 946, 945, 937, 945, 936, 958, 957, 956, 952, 951, 950, 944, 942, 941, 944, 943, 942
-};
@@ -1,26 +0,0 @@
-size_t mVertexCount = 843;
-size_t mIndexCount = 2880;
-
-float mPositions[] = {
-0, -0.92388, 0.382683, 0, -0.83147, 0.55557, 0.108386, -0.83147, 0.544895, 0.074658, -0.92388, 0.37533, 0, 0.19509, 0.980785, 0, 0.382683, 0.92388, 0.18024, 0.382683, 0.906127, 0.191342, 0.19509, 0.96194, 0, -0.980785, 0.19509, 0.03806, -0.980785, 0.191342, 1e-06, -0, 0.999999, 0.19509, -0, 0.980785, 0, 0.980785, 0.19509, -0, 1, -0, 0.03806, 0.980785, 0.191342, 0, -1, -0, 0, -0.19509, 0.980785, 0.191342, -0.19509, 0.96194, 0, 0.92388, 0.382683, 0.074658, 0.92388, 0.37533, 0, -0.382683, 0.923879, 0.18024, -0.382683, 0.906127, 0, 0.83147, 0.55557, 0.108386, 0.83147, 0.544895, 0, -0.55557, 0.83147, 0, -0.382683, 0.923879, 0.162212, -0.55557, 0.815493, 0, 0.707107, 0.707107, 0.13795, 0.707107, 0.69352, 0, -0.707107, 0.707107, 0.13795, -0.707107, 0.69352, 0, 0.55557, 0.83147, 0, 0.707107, 0.707107, 0.162212, 0.55557, 0.815493, 0, -0.707107, 0.707107, 0, 0.382683, 0.92388, 0.270598, -0.707107, 0.653281, 0.212608, -0.83147, 0.51328, 0.31819, 0.55557, 0.768178, 0.353553, 0.382683, 0.853553, 0.212608, -0.83147, 0.51328, 0.146447, -0.92388, 0.353553, 0.37533, 0.19509, 0.906127, 0.074658, -0.980785, 0.18024, 0.382683, -0, 0.923879, -0, 1, -0, 0.074658, 0.980785, 0.18024, 0, -1, -0, 0.37533, -0.19509, 0.906127, 0.146447, 0.92388, 0.353553, 0.353553, -0.382683, 0.853553, 0.212608, 0.83147, 0.51328, 0.31819, -0.55557, 0.768178, 0.212608, 0.83147, 0.51328, 0.270598, 0.707107, 0.653281, 0.108386, 0.980785, 0.162212, 0.212608, 0.92388, 0.31819, 0.544895, -0.19509, 0.815493, 0.51328, -0.382683, 0.768178, 0.212608, 0.83147, 0.51328, 0.308658, 0.83147, 0.46194, 0.51328, -0.382683, 0.768178, 0.46194, -0.55557, 0.691342, 0.212608, 0.83147, 0.51328, 0.308658, 0.83147, 0.46194, 0.392848, 0.707107, 0.587938, 0.392848, -0.707107, 0.587938, 0.392848, 0.707107, 0.587938, 0.46194, 0.55557, 0.691342, 0.212608, -0.83147, 0.51328, 0.392848, -0.707107, 0.587938, 0.308658, -0.83147, 0.46194, 0.51328, 0.382683, 0.768178, 0.212608, -0.83147, 0.51328, 0.308658, -0.83147, 0.46194, 0.212608, -0.92388, 0.31819, 0.51328, 0.382683, 0.768178, 0.544895, 0.19509, 0.815493, 0.108386, -0.980785, 0.162212, 0.55557, -0, 0.831469, -0, 1, -0, 0, -1, -0, 0.51328, 0.382683, 0.768178, 0.587938, 0.55557, 0.587938, 0.653281, 0.382683, 0.653281, 0.308658, -0.83147, 0.46194, 0.392848, -0.83147, 0.392847, 0.270598, -0.92388, 0.270598, 0.51328, 0.382683, 0.768178, 0.69352, 0.19509, 0.69352, 0.13795, -0.980785, 0.13795, 0.707107, -0, 0.707107, -0, 1, -0, 0.13795, 0.980785, 0.13795, 0, -1, -0, 0.69352, -0.19509, 0.69352, 0.270598, 0.92388, 0.270598, 0.51328, -0.382683, 0.768178, 0.653282, -0.382683, 0.653281, 0.308658, 0.83147, 0.46194, 0.392848, 0.83147, 0.392847, 0.51328, -0.382683, 0.768178, 0.587938, -0.55557, 0.587938, 0.392848, 0.707107, 0.587938, 0.308658, 0.83147, 0.46194, 0.392848, 0.83147, 0.392847, 0.5, 0.707107, 0.5, 0.392848, -0.707107, 0.587938, 0.5, -0.707107, 0.5, 0.392848, 0.707107, 0.587938, 0.5, 0.707107, 0.5, 0.308658, -0.83147, 0.46194, 0.392848, -0.707107, 0.587938, 0.5, -0.707107, 0.5, 0.392848, -0.83147, 0.392847, 0.815493, -0.19509, 0.544895, 0.768178, -0.382683, 0.51328, 0.392848, 0.83147, 0.392847, 0.31819, 0.92388, 0.212607, 0.46194, 0.83147, 0.308658, 0.768178, -0.382683, 0.51328, 0.691342, -0.55557, 0.46194, 0.5, 0.707107, 0.5, 0.392848, 0.83147, 0.392847, 0.46194, 0.83147, 0.308658, 0.587938, 0.707107, 0.392847, 0.5, -0.707107, 0.5, 0.587938, -0.707107, 0.392847, 0.5, 0.707107, 0.5, 0.587938, 0.707107, 0.392847, 0.691342, 0.55557, 0.46194, 0.392848, -0.83147, 0.392847, 0.5, -0.707107, 0.5, 0.587938, -0.707107, 0.392847, 0.46194, -0.83147, 0.308658, 0.768178, 0.382683, 0.51328, 0.392848, -0.83147, 0.392847, 0.46194, -0.83147, 0.308658, 0.31819, -0.92388, 0.212608, 0.768178, 0.382683, 0.51328, 0.815493, 0.19509, 0.544895, 0.162212, -0.980785, 0.108386, 0.83147, -0, 0.55557, -0, 1, -0, 0.162212, 0.980785, 0.108386, 0, -1, -0, 0.46194, -0.83147, 0.308658, 0.51328, -0.83147, 0.212607, 0.353554, -0.92388, 0.146447, 0.768178, 0.382683, 0.51328, 0.853553, 0.382683, 0.353553, 0.906127, 0.19509, 0.37533, 0.18024, -0.980785, 0.074658, 0.923879, -0, 0.382683, -0, 1, -0, 0.18024, 0.980785, 0.074658, 0, -1, -0, 0.906127, -0.19509, 0.37533, 0.353554, 0.92388, 0.146447, 0.768178, -0.382683, 0.51328, 0.853553, -0.382683, 0.353553, 0.46194, 0.83147, 0.308658, 0.51328, 0.83147, 0.212607, 0.768178, -0.382683, 0.51328, 0.768178, -0.55557, 0.31819, 0.587938, 0.707107, 0.392847, 0.46194, 0.83147, 0.308658, 0.51328, 0.83147, 0.212607, 0.653281, 0.707107, 0.270598, 0.587938, -0.707107, 0.392847, 0.653281, -0.707107, 0.270598, 0.587938, 0.707107, 0.392847, 0.768178, 0.55557, 0.31819, 0.46194, -0.83147, 0.308658, 0.587938, -0.707107, 0.392847, 0.51328, -0.83147, 0.212607, 0.768178, 0.382683, 0.51328, 0.51328, 0.83147, 0.212607, 0.37533, 0.92388, 0.074658, 0.544895, 0.83147, 0.108386, 0.906128, -0.382683, 0.18024, 0.815493, -0.55557, 0.162212, 0.51328, 0.83147, 0.212607, 0.69352, 0.707107, 0.13795, 0.69352, -0.707107, 0.13795, 0.815493, 0.55557, 0.162212, 0.51328, -0.83147, 0.212607, 0.544895, -0.83147, 0.108386, 0.906127, 0.382683, 0.18024, 0.51328, -0.83147, 0.212607, 0.37533, -0.92388, 0.074658, 0.96194, 0.19509, 0.191342, 0.191342, -0.980785, 0.03806, 0.980785, -0, 0.19509, -0, 1, -0, 0.191342, 0.980785, 0.03806, 0, -1, -0, 0.96194, -0.19509, 0.191342, 0.923879, 0.382683, -0, 0.980785, 0.19509, -0, 0.382684, -0.92388, -0, 0.19509, -0.980785, -0, 1, -0, -0, -0, 1, -0, 0.19509, 0.980785, -0, 0, -1, -0, 0.980785, -0.19509, -0, 0.382684, 0.92388, -0, 0.92388, -0.382683, -0, 0.55557, 0.83147, -0, 0.92388, -0.382683, -0, 0.831469, -0.55557, -0, 0.707107, 0.707107, -0, 0.707107, -0.707107, -0, 0.707107, 0.707107, -0, 0.831469, 0.55557, -0, 0.707107, -0.707107, -0, 0.55557, -0.83147, -0, 0.923879, 0.382683, -0, 0.92388, -0.382683, -0, 0.906127, -0.382683, -0.18024, 0.815493, -0.55557, -0.162212, 0.707107, 0.707107, -0, 0.544895, 0.83147, -0.108386, 0.69352, 0.707107, -0.13795, 0.707107, -0.707107, -0, 0.69352, -0.707107, -0.13795, 0.707107, 0.707107, -0, 0.815493, 0.55557, -0.162212, 0.707107, -0.707107, -0, 0.544895, -0.83147, -0.108386, 0.923879, 0.382683, -0, 0.906127, 0.382683, -0.18024, 0.37533, -0.92388, -0.074658, 0.923879, 0.382683, -0, 0.96194, 0.19509, -0.191342, 0.191342, -0.980785, -0.03806, 0.980785, -0, -0.19509, -0, 1, -0, 0.191342, 0.980785, -0.03806, 0, -1, -0, 0.96194, -0.19509, -0.191342, 0.37533, 0.92388, -0.074658, 0.92388, -0.382683, -0, 0.353554, -0.92388, -0.146447, 0.18024, -0.980785, -0.074658, 0.906127, 0.19509, -0.37533, 0.923879, -0, -0.382683, -0, 1, -0, 0.18024, 0.980785, -0.074658, 0, -1, -0, 0.906127, -0.19509, -0.37533, 0.353553, 0.92388, -0.146447, 0.853553, -0.382683, -0.353554, 0.51328, 0.83147, -0.212608, 0.768178, -0.55557, -0.31819, 0.51328, 0.83147, -0.212608, 0.653281, 0.707107, -0.270598, 0.653281, -0.707107, -0.270598, 0.768178, 0.55557, -0.31819, 0.51328, -0.83147, -0.212608, 0.853553, 0.382683, -0.353553, 0.51328, -0.83147, -0.212608, 0.691342, -0.55557, -0.46194, 0.587938, -0.707107, -0.392847, 0.587938, 0.707107, -0.392847, 0.691341, 0.55557, -0.46194, 0.51328, -0.83147, -0.212608, 0.587938, -0.707107, -0.392847, 0.46194, -0.83147, -0.308658, 0.768178, 0.382683, -0.51328, 0.51328, -0.83147, -0.212608, 0.46194, -0.83147, -0.308658, 0.31819, -0.92388, -0.212608, 0.768178, 0.382683, -0.51328, 0.815493, 0.19509, -0.544895, 0.162212, -0.980785, -0.108386, 0.831469, -0, -0.55557, -0, 1, -0, 0.162212, 0.980785, -0.108386, 0, -1, -0, 0.815493, -0.19509, -0.544895, 0.31819, 0.92388, -0.212608, 0.768178, -0.382683, -0.51328, 0.51328, 0.83147, -0.212608, 0.46194, 0.83147, -0.308658, 0.768178, -0.382683, -0.51328, 0.51328, 0.83147, -0.212608, 0.46194, 0.83147, -0.308658, 0.587938, 0.707107, -0.392847, -0, 1, -0, 0.13795, 0.980785, -0.13795, 0, -1, -0, 0.13795, -0.980785, -0.13795, 0.707106, -0, -0.707107, 0.69352, -0.19509, -0.69352, 0.270598, 0.92388, -0.270598, 0.768178, -0.382683, -0.51328, 0.653281, -0.382683, -0.653282, 0.46194, 0.83147, -0.308658, 0.392847, 0.83147, -0.392847, 0.768178, -0.382683, -0.51328, 0.587938, -0.55557, -0.587938, 0.587938, 0.707107, -0.392847, 0.46194, 0.83147, -0.308658, 0.392847, 0.83147, -0.392847, 0.5, 0.707107, -0.5, 0.587938, -0.707107, -0.392847, 0.5, -0.707107, -0.5, 0.587938, 0.707107, -0.392847, 0.5, 0.707107, -0.5, 0.587938, 0.55557, -0.587938, 0.46194, -0.83147, -0.308658, 0.587938, -0.707107, -0.392847, 0.5, -0.707107, -0.5, 0.392847, -0.83147, -0.392847, 0.768178, 0.382683, -0.51328, 0.653281, 0.382683, -0.653281, 0.46194, -0.83147, -0.308658, 0.392847, -0.83147, -0.392847, 0.270598, -0.92388, -0.270598, 0.768178, 0.382683, -0.51328, 0.69352, 0.19509, -0.69352, 0.5, 0.707107, -0.5, 0.392847, 0.707107, -0.587938, 0.46194, 0.55557, -0.691342, 0.392847, -0.83147, -0.392847, 0.5, -0.707107, -0.5, 0.392847, -0.707107, -0.587938, 0.308658, -0.83147, -0.46194, 0.51328, 0.382683, -0.768178, 0.392847, -0.83147, -0.392847, 0.308658, -0.83147, -0.46194, 0.212608, -0.92388, -0.31819, 0.51328, 0.382683, -0.768178, 0.544895, 0.19509, -0.815493, 0.108386, -0.980785, -0.162212, 0.55557, -0, -0.831469, -0, 1, -0, 0.108386, 0.980785, -0.162212, 0, -1, -0, 0.544895, -0.19509, -0.815493, 0.212608, 0.92388, -0.31819, 0.51328, -0.382683, -0.768178, 0.392847, 0.83147, -0.392847, 0.308658, 0.83147, -0.46194, 0.51328, -0.382683, -0.768178, 0.46194, -0.55557, -0.691342, 0.5, 0.707107, -0.5, 0.392847, 0.83147, -0.392847, 0.308658, 0.83147, -0.46194, 0.392847, 0.707107, -0.587938, 0.5, -0.707107, -0.5, 0.392847, -0.707107, -0.587938, 0.382683, -0, -0.923879, 0.37533, -0.19509, -0.906127, 0.074658, 0.980785, -0.18024, 0.146447, 0.92388, -0.353554, 0.51328, -0.382683, -0.768178, 0.353553, -0.382683, -0.853553, 0.308658, 0.83147, -0.46194, 0.212607, 0.83147, -0.51328, 0.51328, -0.382683, -0.768178, 0.31819, -0.55557, -0.768178, 0.392847, 0.707107, -0.587938, 0.308658, 0.83147, -0.46194, 0.212607, 0.83147, -0.51328, 0.270598, 0.707107, -0.653281, 0.392847, -0.707107, -0.587938, 0.270598, -0.707107, -0.653281, 0.392847, 0.707107, -0.587938, 0.31819, 0.55557, -0.768178, 0.308658, -0.83147, -0.46194, 0.392847, -0.707107, -0.587938, 0.212607, -0.83147, -0.51328, 0.51328, 0.382683, -0.768178, 0.353553, 0.382683, -0.853553, 0.308658, -0.83147, -0.46194, 0.212607, -0.83147, -0.51328, 0.146447, -0.92388, -0.353554, 0.51328, 0.382683, -0.768178, 0.37533, 0.19509, -0.906127, 0.074658, -0.980785, -0.18024, -0, 1, -0, 0, -1, -0, 0.212607, -0.83147, -0.51328, 0.13795, -0.707107, -0.69352, 0.108386, -0.83147, -0.544895, 0.162212, 0.55557, -0.815493, 0.18024, 0.382683, -0.906127, 0.212607, -0.83147, -0.51328, 0.074658, -0.92388, -0.37533, 0.191342, 0.19509, -0.961939, 0.03806, -0.980785, -0.191342, 0.19509, -0, -0.980785, -0, 1, -0, 0.03806, 0.980785, -0.191342, 0, -1, -0, 0.191342, -0.19509, -0.961939, 0.074658, 0.92388, -0.37533, 0.18024, -0.382683, -0.906127, 0.212607, 0.83147, -0.51328, 0.108386, 0.83147, -0.544895, 0.162212, -0.55557, -0.815493, 0.212607, 0.83147, -0.51328, 0.13795, 0.707107, -0.69352, 0, 0.980785, -0.19509, -0, 0.92388, -0.382684, -0, -0.19509, -0.980785, -0, -0.382683, -0.92388, -0, 0.83147, -0.55557, -0, -0.382683, -0.92388, -0, -0.55557, -0.831469, 0, 0.707107, -0.707107, 0, -0.707107, -0.707107, 0, 0.707107, -0.707107, -0, 0.55557, -0.831469, 0, -0.707107, -0.707107, -0, -0.83147, -0.55557, 0, 0.382683, -0.923879, 0, -0.92388, -0.382684, 0, 0.382683, -0.923879, -0, 0.19509, -0.980785, -0, -0.980785, -0.19509, -0, -0, -0.999999, -0, 1, -0, 0, -1, -0, 0, 0.382683, -0.923879, -0.162212, 0.55557, -0.815493, -0.18024, 0.382683, -0.906127, -0.108386, -0.83147, -0.544895, -0.074658, -0.92388, -0.37533, 0, 0.382683, -0.923879, -0.191342, 0.19509, -0.961939, -0.03806, -0.980785, -0.191342, -0.19509, -0, -0.980785, -0, 1, -0, -0.03806, 0.980785, -0.191342, 0, -1, -0, -0.191342, -0.19509, -0.961939, -0.074658, 0.92388, -0.37533, -0, -0.382683, -0.92388, -0.18024, -0.382683, -0.906127, -0.108386, 0.83147, -0.544895, -0, -0.382683, -0.92388, -0.162212, -0.55557, -0.815493, 0, 0.707107, -0.707107, -0.13795, 0.707107, -0.69352, 0, -0.707107, -0.707107, -0.13795, -0.707107, -0.69352, 0, 0.707107, -0.707107, 0, -0.707107, -0.707107, -0.37533, -0.19509, -0.906127, -0.353553, -0.382683, -0.853553, -0.146447, 0.92388, -0.353553, -0.212608, 0.83147, -0.51328, -0.31819, -0.55557, -0.768178, -0.212608, 0.83147, -0.51328, -0.270598, 0.707107, -0.653281, -0.270598, -0.707107, -0.653281, -0.318189, 0.55557, -0.768177, -0.212608, -0.83147, -0.51328, -0.353553, 0.382683, -0.853553, -0.212608, -0.83147, -0.51328, -0.146447, -0.92388, -0.353553, -0.37533, 0.19509, -0.906127, -0.074658, -0.980785, -0.18024, -0.382683, -0, -0.923879, -0, 1, -0, -0.074658, 0.980785, -0.18024, 0, -1, -0, -0.212608, -0.83147, -0.51328, -0.308658, -0.83147, -0.46194, -0.212608, -0.92388, -0.31819, -0.51328, 0.382683, -0.768178, -0.544895, 0.19509, -0.815493, -0.108386, -0.980785, -0.162212, -0.55557, -0, -0.831469, -0, 1, -0, -0.108386, 0.980785, -0.162212, 0, -1, -0, -0.544895, -0.19509, -0.815493, -0.212608, 0.92388, -0.31819, -0.51328, -0.382683, -0.768178, -0.212608, 0.83147, -0.51328, -0.308658, 0.83147, -0.46194, -0.51328, -0.382683, -0.768178, -0.46194, -0.55557, -0.691342, -0.212608, 0.83147, -0.51328, -0.308658, 0.83147, -0.46194, -0.392847, 0.707107, -0.587938, -0.392847, -0.707107, -0.587938, -0.392847, 0.707107, -0.587938, -0.46194, 0.55557, -0.691341, -0.212608, -0.83147, -0.51328, -0.392847, -0.707107, -0.587938, -0.308658, -0.83147, -0.46194, -0.51328, 0.382683, -0.768178, -0.51328, -0.382683, -0.768178, -0.653281, -0.382683, -0.653281, -0.587938, -0.55557, -0.587938, -0.392847, 0.707107, -0.587938, -0.308658, 0.83147, -0.46194, -0.392847, 0.83147, -0.392847, -0.5, 0.707107, -0.5, -0.392847, -0.707107, -0.587938, -0.5, -0.707107, -0.5, -0.392847, 0.707107, -0.587938, -0.5, 0.707107, -0.5, -0.587937, 0.55557, -0.587938, -0.308658, -0.83147, -0.46194, -0.392847, -0.707107, -0.587938, -0.5, -0.707107, -0.5, -0.392847, -0.83147, -0.392847, -0.51328, 0.382683, -0.768178, -0.653281, 0.382683, -0.653281, -0.308658, -0.83147, -0.46194, -0.392847, -0.83147, -0.392847, -0.270598, -0.92388, -0.270598, -0.51328, 0.382683, -0.768178, -0.69352, 0.19509, -0.69352, -0.13795, -0.980785, -0.13795, -0.707106, -0, -0.707106, -0, 1, -0, -0.13795, 0.980785, -0.13795, 0, -1, -0, -0.69352, -0.19509, -0.69352, -0.270598, 0.92388, -0.270598, -0.51328, -0.382683, -0.768178, -0.308658, 0.83147, -0.46194, -0.392847, 0.83147, -0.392847, -0.31819, -0.92388, -0.212608, -0.162212, -0.980785, -0.108386, -0.815493, 0.19509, -0.544895, -0.831469, -0, -0.555569, -0, 1, -0, -0.162212, 0.980785, -0.108386, 0, -1, -0, -0.815493, -0.19509, -0.544895, -0.31819, 0.92388, -0.212608, -0.768178, -0.382683, -0.51328, -0.392847, 0.83147, -0.392847, -0.46194, 0.83147, -0.308658, -0.768178, -0.382683, -0.51328, -0.691341, -0.55557, -0.46194, -0.5, 0.707107, -0.5, -0.392847, 0.83147, -0.392847, -0.46194, 0.83147, -0.308658, -0.587938, 0.707107, -0.392847, -0.5, -0.707107, -0.5, -0.587938, -0.707107, -0.392847, -0.5, 0.707107, -0.5, -0.587938, 0.707107, -0.392847, -0.691341, 0.55557, -0.46194, -0.392847, -0.83147, -0.392847, -0.5, -0.707107, -0.5, -0.587938, -0.707107, -0.392847, -0.46194, -0.83147, -0.308658, -0.768178, 0.382683, -0.51328, -0.392847, -0.83147, -0.392847, -0.46194, -0.83147, -0.308658, -0.768178, 0.382683, -0.51328, -0.587938, 0.707107, -0.392847, -0.46194, 0.83147, -0.308658, -0.51328, 0.83147, -0.212607, -0.653281, 0.707107, -0.270598, -0.587938, -0.707107, -0.392847, -0.768177, -0.55557, -0.31819, -0.653281, -0.707107, -0.270598, -0.587938, 0.707107, -0.392847, -0.768177, 0.55557, -0.31819, -0.46194, -0.83147, -0.308658, -0.587938, -0.707107, -0.392847, -0.51328, -0.83147, -0.212607, -0.768178, 0.382683, -0.51328, -0.853553, 0.382683, -0.353553, -0.46194, -0.83147, -0.308658, -0.51328, -0.83147, -0.212607, -0.353553, -0.92388, -0.146447, -0.768178, 0.382683, -0.51328, -0.906127, 0.19509, -0.37533, -0.18024, -0.980785, -0.074658, -0.923879, -0, -0.382683, -0, 1, -0, -0.18024, 0.980785, -0.074658, 0, -1, -0, -0.906127, -0.19509, -0.37533, -0.353553, 0.92388, -0.146447, -0.768178, -0.382683, -0.51328, -0.853553, -0.382683, -0.353553, -0.46194, 0.83147, -0.308658, -0.51328, 0.83147, -0.212607, -0.768178, -0.382683, -0.51328, -0.961939, 0.19509, -0.191342, -0.980784, -0, -0.19509, -0, 1, -0, -0.191342, 0.980785, -0.03806, 0, -1, -0, -0.191342, -0.980785, -0.03806, -0.961939, -0.19509, -0.191342, -0.37533, 0.92388, -0.074658, -0.906127, -0.382683, -0.18024, -0.51328, 0.83147, -0.212607, -0.544895, 0.83147, -0.108386, -0.815493, -0.55557, -0.162212, -0.51328, 0.83147, -0.212607, -0.69352, 0.707107, -0.13795, -0.69352, -0.707107, -0.13795, -0.815493, 0.55557, -0.162212, -0.51328, -0.83147, -0.212607, -0.544895, -0.83147, -0.108386, -0.906127, 0.382683, -0.18024, -0.51328, -0.83147, -0.212607, -0.37533, -0.92388, -0.074658, -0.831469, -0.55557, -0, -0.707107, -0.707107, -0, -0.707107, 0.707107, -0, -0.831469, 0.55557, -0, -0.707107, -0.707107, -0, -0.55557, -0.83147, 0, -0.923879, 0.382683, -0, -0.382683, -0.92388, -0, -0.923879, 0.382683, -0, -0.980785, 0.19509, 0, -0.19509, -0.980785, -0, -0.999999, -0, 0, -0, 1, -0, -0.19509, 0.980785, -0, 0, -1, -0, -0.980785, -0.19509, 0, -0.382683, 0.92388, -0, -0.923879, -0.382683, 0, -0.55557, 0.83147, 0, -0.923879, -0.382683, 0, -0.707107, 0.707107, -0, -0.19509, 0.980785, -0, -0, 1, -0, -0.191342, 0.980785, 0.03806, 0, -1, -0, -0.19509, -0.980785, -0, -0.191342, -0.980785, 0.03806, -0.980785, -0.19509, 0, -0.999999, -0, 0, -0.980784, -0, 0.195091, -0.961939, -0.19509, 0.191342, -0.382683, 0.92388, -0, -0.37533, 0.92388, 0.074658, -0.923879, -0.382683, 0, -0.906127, -0.382683, 0.18024, -0.55557, 0.83147, 0, -0.544895, 0.83147, 0.108386, -0.831469, -0.55557, -0, -0.923879, -0.382683, 0, -0.815493, -0.55557, 0.162212, -0.707107, 0.707107, -0, -0.69352, 0.707107, 0.13795, -0.707107, -0.707107, -0, -0.69352, -0.707107, 0.13795, -0.831469, 0.55557, -0, -0.707107, 0.707107, -0, -0.815493, 0.55557, 0.162212, -0.55557, -0.83147, 0, -0.707107, -0.707107, -0, -0.544895, -0.83147, 0.108386, -0.923879, 0.382683, -0, -0.906127, 0.382683, 0.18024, -0.382683, -0.92388, -0, -0.37533, -0.92388, 0.074658, -0.980785, 0.19509, 0, -0.923879, 0.382683, -0, -0.961939, 0.19509, 0.191342, -0.653281, 0.707107, 0.270598, -0.768177, 0.55557, 0.318189, -0.653281, -0.707107, 0.270598, -0.51328, -0.83147, 0.212607, -0.853553, 0.382683, 0.353553, -0.51328, -0.83147, 0.212607, -0.353553, -0.92388, 0.146446, -0.906127, 0.19509, 0.37533, -0.18024, -0.980785, 0.074658, -0.923878, -0, 0.382683, -0, 1, -0, -0.18024, 0.980785, 0.074658, 0, -1, -0, -0.906127, -0.19509, 0.37533, -0.353553, 0.92388, 0.146447, -0.853553, -0.382683, 0.353553, -0.51328, 0.83147, 0.212607, -0.768177, -0.55557, 0.318189, -0.51328, 0.83147, 0.212607, -0.831469, -0, 0.55557, -0.815493, -0.19509, 0.544895, -0.162212, 0.980785, 0.108386, -0.318189, 0.92388, 0.212607, -0.768177, -0.382683, 0.51328, -0.51328, 0.83147, 0.212607, -0.461939, 0.83147, 0.308658, -0.768177, -0.382683, 0.51328, -0.691341, -0.55557, 0.461939, -0.51328, 0.83147, 0.212607, -0.461939, 0.83147, 0.308658, -0.587938, 0.707107, 0.392847, -0.587938, -0.707107, 0.392847, -0.587938, 0.707107, 0.392847, -0.691341, 0.55557, 0.461939, -0.51328, -0.83147, 0.212607, -0.587938, -0.707107, 0.392847, -0.461939, -0.83147, 0.308658, -0.768177, 0.382683, 0.51328, -0.51328, -0.83147, 0.212607, -0.461939, -0.83147, 0.308658, -0.318189, -0.92388, 0.212607, -0.768177, 0.382683, 0.51328, -0.815493, 0.19509, 0.544895, -0.162212, -0.980785, 0.108386, -0, 1, -0, 0, -1, -0, -0.461939, -0.83147, 0.308658, -0.587938, -0.707107, 0.392847, -0.5, -0.707107, 0.5, -0.392847, -0.83147, 0.392847, -0.768177, 0.382683, 0.51328, -0.587937, 0.55557, 0.587937, -0.653281, 0.382683, 0.653281, -0.461939, -0.83147, 0.308658, -0.392847, -0.83147, 0.392847, -0.270598, -0.92388, 0.270598, -0.768177, 0.382683, 0.51328, -0.693519, 0.19509, 0.69352, -0.13795, -0.980785, 0.13795, -0.707106, -0, 0.707106, -0, 1, -0, -0.13795, 0.980785, 0.13795, 0, -1, -0, -0.693519, -0.19509, 0.69352, -0.270598, 0.92388, 0.270598, -0.768177, -0.382683, 0.51328, -0.653281, -0.382683, 0.653281, -0.461939, 0.83147, 0.308658, -0.392847, 0.83147, 0.392847, -0.768177, -0.382683, 0.51328, -0.587937, -0.55557, 0.587937, -0.587938, 0.707107, 0.392847, -0.461939, 0.83147, 0.308658, -0.392847, 0.83147, 0.392847, -0.5, 0.707107, 0.5, -0.587938, -0.707107, 0.392847, -0.5, -0.707107, 0.5, -0.587938, 0.707107, 0.392847, -0.5, 0.707107, 0.5, -0.544895, -0.19509, 0.815493, -0.51328, -0.382683, 0.768178, -0.392847, 0.83147, 0.392847, -0.212607, 0.92388, 0.318189, -0.308658, 0.83147, 0.461939, -0.51328, -0.382683, 0.768178, -0.461939, -0.55557, 0.691341, -0.5, 0.707107, 0.5, -0.392847, 0.83147, 0.392847, -0.308658, 0.83147, 0.461939, -0.392847, 0.707107, 0.587937, -0.5, -0.707107, 0.5, -0.392847, -0.707107, 0.587937, -0.5, 0.707107, 0.5, -0.392847, 0.707107, 0.587937, -0.461939, 0.55557, 0.691341, -0.392847, -0.83147, 0.392847, -0.5, -0.707107, 0.5, -0.392847, -0.707107, 0.587937, -0.308658, -0.83147, 0.461939, -0.51328, 0.382683, 0.768177, -0.392847, -0.83147, 0.392847, -0.308658, -0.83147, 0.461939, -0.212607, -0.92388, 0.318189, -0.51328, 0.382683, 0.768177, -0.544895, 0.19509, 0.815493, -0.108386, -0.980785, 0.162212, -0.555569, -0, 0.831469, -0, 1, -0, -0.108386, 0.980785, 0.162212, 0, -1, -0, -0.308658, -0.83147, 0.461939, -0.212607, -0.83147, 0.513279, -0.146446, -0.92388, 0.353553, -0.51328, 0.382683, 0.768177, -0.353553, 0.382683, 0.853553, -0.37533, 0.19509, 0.906127, -0.074658, -0.980785, 0.18024, -0.382683, -0, 0.923879, -0, 1, -0, -0.074658, 0.980785, 0.18024, 0, -1, -0, -0.37533, -0.19509, 0.906127, -0.146446, 0.92388, 0.353553, -0.51328, -0.382683, 0.768178, -0.353553, -0.382683, 0.853553, -0.308658, 0.83147, 0.461939, -0.212607, 0.83147, 0.513279, -0.51328, -0.382683, 0.768178, -0.318189, -0.55557, 0.768177, -0.392847, 0.707107, 0.587937, -0.308658, 0.83147, 0.461939, -0.212607, 0.83147, 0.513279, -0.270598, 0.707107, 0.653281, -0.392847, -0.707107, 0.587937, -0.270598, -0.707107, 0.653281, -0.392847, 0.707107, 0.587937, -0.318189, 0.55557, 0.768177, -0.308658, -0.83147, 0.461939, -0.392847, -0.707107, 0.587937, -0.212607, -0.83147, 0.513279, -0.51328, 0.382683, 0.768177, -0.212607, 0.83147, 0.513279, -0.074658, 0.92388, 0.37533, -0.108386, 0.83147, 0.544895, -0.18024, -0.382683, 0.906127, -0.162212, -0.55557, 0.815493, -0.212607, 0.83147, 0.513279, -0.13795, 0.707107, 0.69352, -0.13795, -0.707107, 0.69352, -0.162212, 0.55557, 0.815493, -0.212607, -0.83147, 0.513279, -0.108386, -0.83147, 0.544895, -0.18024, 0.382683, 0.906127, -0.212607, -0.83147, 0.513279, -0.074658, -0.92388, 0.37533, -0.191341, 0.19509, 0.961939, -0.03806, -0.980785, 0.191342, -0.19509, -0, 0.980784, -0, 1, -0, -0.03806, 0.980785, 0.191342, 0, -1, -0, -0.191341, -0.19509, 0.961939, 0, 0.382683, 0.92388, -0, 1, -0, 0, -1, -0, 0, -0.382683, 0.923879, 0, -0.382683, 0.923879, 0, 0.707107, 0.707107, 0, -0.707107, 0.707107, 0, 0.707107, 0.707107, 0, -0.707107, 0.707107, 0, 0.382683, 0.92388
-};
-
-float mUVs[] = {
-0.75, 0.875, 0.75, 0.8125, 0.71875, 0.8125, 0.71875, 0.875, 0.75, 0.4375, 0.75, 0.375, 0.71875, 0.375, 0.71875, 0.4375, 0.75, 0.9375, 0.71875, 0.9375, 0.75, 0.5, 0.71875, 0.5, 0.75, 0.0625, 0.734375, 0, 0.71875, 0.0625, 0.734375, 1, 0.75, 0.5625, 0.71875, 0.5625, 0.75, 0.125, 0.71875, 0.125, 0.75, 0.625, 0.71875, 0.625, 0.75, 0.1875, 0.71875, 0.1875, 0.75, 0.6875, 0.75, 0.625, 0.71875, 0.6875, 0.75, 0.25, 0.71875, 0.25, 0.75, 0.75, 0.71875, 0.75, 0.75, 0.3125, 0.75, 0.25, 0.71875, 0.3125, 0.75, 0.75, 0.75, 0.375, 0.6875, 0.75, 0.6875, 0.8125, 0.6875, 0.3125, 0.6875, 0.375, 0.6875, 0.8125, 0.6875, 0.875, 0.6875, 0.4375, 0.6875, 0.9375, 0.6875, 0.5, 0.703125, 0, 0.6875, 0.0625, 0.703125, 1, 0.6875, 0.5625, 0.6875, 0.125, 0.6875, 0.625, 0.6875, 0.1875, 0.6875, 0.6875, 0.6875, 0.1875, 0.6875, 0.25, 0.65625, 0.0625, 0.65625, 0.125, 0.65625, 0.5625, 0.65625, 0.625, 0.6875, 0.1875, 0.65625, 0.1875, 0.65625, 0.625, 0.65625, 0.6875, 0.6875, 0.1875, 0.65625, 0.1875, 0.65625, 0.25, 0.65625, 0.75, 0.65625, 0.25, 0.65625, 0.3125, 0.6875, 0.8125, 0.65625, 0.75, 0.65625, 0.8125, 0.65625, 0.375, 0.6875, 0.8125, 0.65625, 0.8125, 0.65625, 0.875, 0.65625, 0.375, 0.65625, 0.4375, 0.65625, 0.9375, 0.65625, 0.5, 0.671875, 0, 0.671875, 1, 0.65625, 0.375, 0.625, 0.3125, 0.625, 0.375, 0.65625, 0.8125, 0.625, 0.8125, 0.625, 0.875, 0.65625, 0.375, 0.625, 0.4375, 0.625, 0.9375, 0.625, 0.5, 0.640625, 0, 0.625, 0.0625, 0.640625, 1, 0.625, 0.5625, 0.625, 0.125, 0.65625, 0.625, 0.625, 0.625, 0.65625, 0.1875, 0.625, 0.1875, 0.65625, 0.625, 0.625, 0.6875, 0.65625, 0.25, 0.65625, 0.1875, 0.625, 0.1875, 0.625, 0.25, 0.65625, 0.75, 0.625, 0.75, 0.65625, 0.25, 0.625, 0.25, 0.65625, 0.8125, 0.65625, 0.75, 0.625, 0.75, 0.625, 0.8125, 0.59375, 0.5625, 0.59375, 0.625, 0.625, 0.1875, 0.59375, 0.125, 0.59375, 0.1875, 0.59375, 0.625, 0.59375, 0.6875, 0.625, 0.25, 0.625, 0.1875, 0.59375, 0.1875, 0.59375, 0.25, 0.625, 0.75, 0.59375, 0.75, 0.625, 0.25, 0.59375, 0.25, 0.59375, 0.3125, 0.625, 0.8125, 0.625, 0.75, 0.59375, 0.75, 0.59375, 0.8125, 0.59375, 0.375, 0.625, 0.8125, 0.59375, 0.8125, 0.59375, 0.875, 0.59375, 0.375, 0.59375, 0.4375, 0.59375, 0.9375, 0.59375, 0.5, 0.609375, 0, 0.59375, 0.0625, 0.609375, 1, 0.59375, 0.8125, 0.5625, 0.8125, 0.5625, 0.875, 0.59375, 0.375, 0.5625, 0.375, 0.5625, 0.4375, 0.5625, 0.9375, 0.5625, 0.5, 0.578125, 0, 0.5625, 0.0625, 0.578125, 1, 0.5625, 0.5625, 0.5625, 0.125, 0.59375, 0.625, 0.5625, 0.625, 0.59375, 0.1875, 0.5625, 0.1875, 0.59375, 0.625, 0.5625, 0.6875, 0.59375, 0.25, 0.59375, 0.1875, 0.5625, 0.1875, 0.5625, 0.25, 0.59375, 0.75, 0.5625, 0.75, 0.59375, 0.25, 0.5625, 0.3125, 0.59375, 0.8125, 0.59375, 0.75, 0.5625, 0.8125, 0.59375, 0.375, 0.5625, 0.1875, 0.53125, 0.125, 0.53125, 0.1875, 0.53125, 0.625, 0.53125, 0.6875, 0.5625, 0.1875, 0.53125, 0.25, 0.53125, 0.75, 0.53125, 0.3125, 0.5625, 0.8125, 0.53125, 0.8125, 0.53125, 0.375, 0.5625, 0.8125, 0.53125, 0.875, 0.53125, 0.4375, 0.53125, 0.9375, 0.53125, 0.5, 0.546875, 0, 0.53125, 0.0625, 0.546875, 1, 0.53125, 0.5625, 0.5, 0.375, 0.5, 0.4375, 0.5, 0.875, 0.5, 0.9375, 0.5, 0.5, 0.515625, 0, 0.5, 0.0625, 0.515625, 1, 0.5, 0.5625, 0.5, 0.125, 0.5, 0.625, 0.5, 0.1875, 0.5, 0.625, 0.5, 0.6875, 0.5, 0.25, 0.5, 0.75, 0.5, 0.25, 0.5, 0.3125, 0.5, 0.75, 0.5, 0.8125, 0.5, 0.375, 0.5, 0.625, 0.46875, 0.625, 0.46875, 0.6875, 0.5, 0.25, 0.46875, 0.1875, 0.46875, 0.25, 0.5, 0.75, 0.46875, 0.75, 0.5, 0.25, 0.46875, 0.3125, 0.5, 0.75, 0.46875, 0.8125, 0.5, 0.375, 0.46875, 0.375, 0.46875, 0.875, 0.5, 0.375, 0.46875, 0.4375, 0.46875, 0.9375, 0.46875, 0.5, 0.484375, 0, 0.46875, 0.0625, 0.484375, 1, 0.46875, 0.5625, 0.46875, 0.125, 0.5, 0.625, 0.4375, 0.875, 0.4375, 0.9375, 0.4375, 0.4375, 0.4375, 0.5, 0.453125, 0, 0.4375, 0.0625, 0.453125, 1, 0.4375, 0.5625, 0.4375, 0.125, 0.4375, 0.625, 0.4375, 0.1875, 0.4375, 0.6875, 0.4375, 0.1875, 0.4375, 0.25, 0.4375, 0.75, 0.4375, 0.3125, 0.4375, 0.8125, 0.4375, 0.375, 0.4375, 0.8125, 0.40625, 0.6875, 0.40625, 0.75, 0.40625, 0.25, 0.40625, 0.3125, 0.4375, 0.8125, 0.40625, 0.75, 0.40625, 0.8125, 0.40625, 0.375, 0.4375, 0.8125, 0.40625, 0.8125, 0.40625, 0.875, 0.40625, 0.375, 0.40625, 0.4375, 0.40625, 0.9375, 0.40625, 0.5, 0.421875, 0, 0.40625, 0.0625, 0.421875, 1, 0.40625, 0.5625, 0.40625, 0.125, 0.40625, 0.625, 0.4375, 0.1875, 0.40625, 0.1875, 0.40625, 0.625, 0.4375, 0.1875, 0.40625, 0.1875, 0.40625, 0.25, 0.390625, 0, 0.375, 0.0625, 0.390625, 1, 0.375, 0.9375, 0.375, 0.5, 0.375, 0.5625, 0.375, 0.125, 0.40625, 0.625, 0.375, 0.625, 0.40625, 0.1875, 0.375, 0.1875, 0.40625, 0.625, 0.375, 0.6875, 0.40625, 0.25, 0.40625, 0.1875, 0.375, 0.1875, 0.375, 0.25, 0.40625, 0.75, 0.375, 0.75, 0.40625, 0.25, 0.375, 0.25, 0.375, 0.3125, 0.40625, 0.8125, 0.40625, 0.75, 0.375, 0.75, 0.375, 0.8125, 0.40625, 0.375, 0.375, 0.375, 0.40625, 0.8125, 0.375, 0.8125, 0.375, 0.875, 0.40625, 0.375, 0.375, 0.4375, 0.375, 0.25, 0.34375, 0.25, 0.34375, 0.3125, 0.375, 0.8125, 0.375, 0.75, 0.34375, 0.75, 0.34375, 0.8125, 0.34375, 0.375, 0.375, 0.8125, 0.34375, 0.8125, 0.34375, 0.875, 0.34375, 0.375, 0.34375, 0.4375, 0.34375, 0.9375, 0.34375, 0.5, 0.359375, 0, 0.34375, 0.0625, 0.359375, 1, 0.34375, 0.5625, 0.34375, 0.125, 0.34375, 0.625, 0.375, 0.1875, 0.34375, 0.1875, 0.34375, 0.625, 0.34375, 0.6875, 0.375, 0.25, 0.375, 0.1875, 0.34375, 0.1875, 0.34375, 0.25, 0.375, 0.75, 0.34375, 0.75, 0.3125, 0.5, 0.3125, 0.5625, 0.3125, 0.0625, 0.3125, 0.125, 0.34375, 0.625, 0.3125, 0.625, 0.34375, 0.1875, 0.3125, 0.1875, 0.34375, 0.625, 0.3125, 0.6875, 0.34375, 0.25, 0.34375, 0.1875, 0.3125, 0.1875, 0.3125, 0.25, 0.34375, 0.75, 0.3125, 0.75, 0.34375, 0.25, 0.3125, 0.3125, 0.34375, 0.8125, 0.34375, 0.75, 0.3125, 0.8125, 0.34375, 0.375, 0.3125, 0.375, 0.34375, 0.8125, 0.3125, 0.8125, 0.3125, 0.875, 0.34375, 0.375, 0.3125, 0.4375, 0.3125, 0.9375, 0.328125, 0, 0.328125, 1, 0.3125, 0.8125, 0.28125, 0.75, 0.28125, 0.8125, 0.28125, 0.3125, 0.28125, 0.375, 0.3125, 0.8125, 0.28125, 0.875, 0.28125, 0.4375, 0.28125, 0.9375, 0.28125, 0.5, 0.296875, 0, 0.28125, 0.0625, 0.296875, 1, 0.28125, 0.5625, 0.28125, 0.125, 0.28125, 0.625, 0.3125, 0.1875, 0.28125, 0.1875, 0.28125, 0.6875, 0.3125, 0.1875, 0.28125, 0.25, 0.25, 0.0625, 0.25, 0.125, 0.25, 0.5625, 0.25, 0.625, 0.25, 0.1875, 0.25, 0.625, 0.25, 0.6875, 0.25, 0.25, 0.25, 0.75, 0.25, 0.25, 0.25, 0.3125, 0.25, 0.75, 0.25, 0.8125, 0.25, 0.375, 0.25, 0.875, 0.25, 0.375, 0.25, 0.4375, 0.25, 0.9375, 0.25, 0.5, 0.265625, 0, 0.265625, 1, 0.25, 0.375, 0.21875, 0.3125, 0.21875, 0.375, 0.21875, 0.8125, 0.21875, 0.875, 0.25, 0.375, 0.21875, 0.4375, 0.21875, 0.9375, 0.21875, 0.5, 0.234375, 0, 0.21875, 0.0625, 0.234375, 1, 0.21875, 0.5625, 0.21875, 0.125, 0.25, 0.625, 0.21875, 0.625, 0.21875, 0.1875, 0.25, 0.625, 0.21875, 0.6875, 0.25, 0.25, 0.21875, 0.25, 0.25, 0.75, 0.21875, 0.75, 0.25, 0.25, 0.25, 0.75, 0.1875, 0.5625, 0.1875, 0.625, 0.1875, 0.125, 0.1875, 0.1875, 0.1875, 0.6875, 0.1875, 0.1875, 0.1875, 0.25, 0.1875, 0.75, 0.1875, 0.3125, 0.1875, 0.8125, 0.1875, 0.375, 0.1875, 0.8125, 0.1875, 0.875, 0.1875, 0.4375, 0.1875, 0.9375, 0.1875, 0.5, 0.203125, 0, 0.1875, 0.0625, 0.203125, 1, 0.1875, 0.8125, 0.15625, 0.8125, 0.15625, 0.875, 0.15625, 0.375, 0.15625, 0.4375, 0.15625, 0.9375, 0.15625, 0.5, 0.171875, 0, 0.15625, 0.0625, 0.171875, 1, 0.15625, 0.5625, 0.15625, 0.125, 0.15625, 0.625, 0.1875, 0.1875, 0.15625, 0.1875, 0.15625, 0.625, 0.15625, 0.6875, 0.1875, 0.1875, 0.15625, 0.1875, 0.15625, 0.25, 0.15625, 0.75, 0.15625, 0.25, 0.15625, 0.3125, 0.1875, 0.8125, 0.15625, 0.75, 0.15625, 0.8125, 0.15625, 0.375, 0.15625, 0.625, 0.125, 0.625, 0.125, 0.6875, 0.15625, 0.25, 0.15625, 0.1875, 0.125, 0.1875, 0.125, 0.25, 0.15625, 0.75, 0.125, 0.75, 0.15625, 0.25, 0.125, 0.25, 0.125, 0.3125, 0.15625, 0.8125, 0.15625, 0.75, 0.125, 0.75, 0.125, 0.8125, 0.15625, 0.375, 0.125, 0.375, 0.15625, 0.8125, 0.125, 0.8125, 0.125, 0.875, 0.15625, 0.375, 0.125, 0.4375, 0.125, 0.9375, 0.125, 0.5, 0.140625, 0, 0.125, 0.0625, 0.140625, 1, 0.125, 0.5625, 0.125, 0.125, 0.15625, 0.625, 0.15625, 0.1875, 0.125, 0.1875, 0.09375, 0.875, 0.09375, 0.9375, 0.09375, 0.4375, 0.09375, 0.5, 0.109375, 0, 0.09375, 0.0625, 0.109375, 1, 0.09375, 0.5625, 0.09375, 0.125, 0.09375, 0.625, 0.125, 0.1875, 0.09375, 0.1875, 0.09375, 0.625, 0.09375, 0.6875, 0.125, 0.25, 0.125, 0.1875, 0.09375, 0.1875, 0.09375, 0.25, 0.125, 0.75, 0.09375, 0.75, 0.125, 0.25, 0.09375, 0.25, 0.09375, 0.3125, 0.125, 0.8125, 0.125, 0.75, 0.09375, 0.75, 0.09375, 0.8125, 0.09375, 0.375, 0.125, 0.8125, 0.09375, 0.8125, 0.09375, 0.375, 0.09375, 0.25, 0.09375, 0.1875, 0.0625, 0.1875, 0.0625, 0.25, 0.09375, 0.75, 0.0625, 0.6875, 0.0625, 0.75, 0.09375, 0.25, 0.0625, 0.3125, 0.09375, 0.8125, 0.09375, 0.75, 0.0625, 0.8125, 0.09375, 0.375, 0.0625, 0.375, 0.09375, 0.8125, 0.0625, 0.8125, 0.0625, 0.875, 0.09375, 0.375, 0.0625, 0.4375, 0.0625, 0.9375, 0.0625, 0.5, 0.078125, 0, 0.0625, 0.0625, 0.078125, 1, 0.0625, 0.5625, 0.0625, 0.125, 0.09375, 0.625, 0.0625, 0.625, 0.09375, 0.1875, 0.0625, 0.1875, 0.09375, 0.625, 0.03125, 0.4375, 0.03125, 0.5, 0.046875, 0, 0.03125, 0.0625, 0.046875, 1, 0.03125, 0.9375, 0.03125, 0.5625, 0.03125, 0.125, 0.03125, 0.625, 0.0625, 0.1875, 0.03125, 0.1875, 0.03125, 0.6875, 0.0625, 0.1875, 0.03125, 0.25, 0.03125, 0.75, 0.03125, 0.3125, 0.0625, 0.8125, 0.03125, 0.8125, 0.03125, 0.375, 0.0625, 0.8125, 0.03125, 0.875, 0, 0.6875, 0, 0.75, 0, 0.25, 0, 0.3125, 0, 0.75, 0, 0.8125, 0, 0.375, 0, 0.875, 0, 0.375, 0, 0.4375, 0, 0.9375, 0, 0.5, 0.015625, 0, 0, 0.0625, 0.015625, 1, 0, 0.5625, 0, 0.125, 0, 0.625, 0, 0.1875, 0, 0.625, 0, 0.25, 1, 0.0625, 0.984375, 0, 0.96875, 0.0625, 0.984375, 1, 1, 0.9375, 0.96875, 0.9375, 1, 0.5625, 1, 0.5, 0.96875, 0.5, 0.96875, 0.5625, 1, 0.125, 0.96875, 0.125, 1, 0.625, 0.96875, 0.625, 1, 0.1875, 0.96875, 0.1875, 1, 0.6875, 1, 0.625, 0.96875, 0.6875, 1, 0.25, 0.96875, 0.25, 1, 0.75, 0.96875, 0.75, 1, 0.3125, 1, 0.25, 0.96875, 0.3125, 1, 0.8125, 1, 0.75, 0.96875, 0.8125, 1, 0.375, 0.96875, 0.375, 1, 0.875, 0.96875, 0.875, 1, 0.4375, 1, 0.375, 0.96875, 0.4375, 0.9375, 0.25, 0.9375, 0.3125, 0.9375, 0.75, 0.9375, 0.8125, 0.9375, 0.375, 0.9375, 0.8125, 0.9375, 0.875, 0.9375, 0.4375, 0.9375, 0.9375, 0.9375, 0.5, 0.953125, 0, 0.9375, 0.0625, 0.953125, 1, 0.9375, 0.5625, 0.9375, 0.125, 0.9375, 0.625, 0.9375, 0.1875, 0.9375, 0.6875, 0.9375, 0.1875, 0.90625, 0.5, 0.90625, 0.5625, 0.90625, 0.0625, 0.90625, 0.125, 0.90625, 0.625, 0.9375, 0.1875, 0.90625, 0.1875, 0.90625, 0.625, 0.90625, 0.6875, 0.9375, 0.1875, 0.90625, 0.1875, 0.90625, 0.25, 0.90625, 0.75, 0.90625, 0.25, 0.90625, 0.3125, 0.9375, 0.8125, 0.90625, 0.75, 0.90625, 0.8125, 0.90625, 0.375, 0.9375, 0.8125, 0.90625, 0.8125, 0.90625, 0.875, 0.90625, 0.375, 0.90625, 0.4375, 0.90625, 0.9375, 0.921875, 0, 0.921875, 1, 0.90625, 0.8125, 0.90625, 0.75, 0.875, 0.75, 0.875, 0.8125, 0.90625, 0.375, 0.875, 0.3125, 0.875, 0.375, 0.90625, 0.8125, 0.875, 0.8125, 0.875, 0.875, 0.90625, 0.375, 0.875, 0.4375, 0.875, 0.9375, 0.875, 0.5, 0.890625, 0, 0.875, 0.0625, 0.890625, 1, 0.875, 0.5625, 0.875, 0.125, 0.90625, 0.625, 0.875, 0.625, 0.90625, 0.1875, 0.875, 0.1875, 0.90625, 0.625, 0.875, 0.6875, 0.90625, 0.25, 0.90625, 0.1875, 0.875, 0.1875, 0.875, 0.25, 0.90625, 0.75, 0.875, 0.75, 0.90625, 0.25, 0.875, 0.25, 0.84375, 0.5625, 0.84375, 0.625, 0.875, 0.1875, 0.84375, 0.125, 0.84375, 0.1875, 0.84375, 0.625, 0.84375, 0.6875, 0.875, 0.25, 0.875, 0.1875, 0.84375, 0.1875, 0.84375, 0.25, 0.875, 0.75, 0.84375, 0.75, 0.875, 0.25, 0.84375, 0.25, 0.84375, 0.3125, 0.875, 0.8125, 0.875, 0.75, 0.84375, 0.75, 0.84375, 0.8125, 0.84375, 0.375, 0.875, 0.8125, 0.84375, 0.8125, 0.84375, 0.875, 0.84375, 0.375, 0.84375, 0.4375, 0.84375, 0.9375, 0.84375, 0.5, 0.859375, 0, 0.84375, 0.0625, 0.859375, 1, 0.84375, 0.8125, 0.8125, 0.8125, 0.8125, 0.875, 0.84375, 0.375, 0.8125, 0.375, 0.8125, 0.4375, 0.8125, 0.9375, 0.8125, 0.5, 0.828125, 0, 0.8125, 0.0625, 0.828125, 1, 0.8125, 0.5625, 0.8125, 0.125, 0.84375, 0.625, 0.8125, 0.625, 0.84375, 0.1875, 0.8125, 0.1875, 0.84375, 0.625, 0.8125, 0.6875, 0.84375, 0.25, 0.84375, 0.1875, 0.8125, 0.1875, 0.8125, 0.25, 0.84375, 0.75, 0.8125, 0.75, 0.84375, 0.25, 0.8125, 0.3125, 0.84375, 0.8125, 0.84375, 0.75, 0.8125, 0.8125, 0.84375, 0.375, 0.8125, 0.1875, 0.78125, 0.125, 0.78125, 0.1875, 0.78125, 0.625, 0.78125, 0.6875, 0.8125, 0.1875, 0.78125, 0.25, 0.78125, 0.75, 0.78125, 0.3125, 0.8125, 0.8125, 0.78125, 0.8125, 0.78125, 0.375, 0.8125, 0.8125, 0.78125, 0.875, 0.78125, 0.4375, 0.78125, 0.9375, 0.78125, 0.5, 0.796875, 0, 0.78125, 0.0625, 0.796875, 1, 0.78125, 0.5625, 0.75, 0.375, 0.765625, 0, 0.765625, 1, 0.75, 0.625, 0.75, 0.625, 0.75, 0.25, 0.75, 0.75, 0.75, 0.25, 0.75, 0.75, 0.75, 0.375
-};
-
-float mNormals[] = {
-0, -0.9217, 0.3879, 0, -0.8286, 0.5598, 0.1092, -0.8286, 0.549, 0.0757, -0.9217, 0.3804, 0, 0.1939, 0.981, 0, 0.3805, 0.9247, 0.1804, 0.3805, 0.907, 0.1914, 0.1939, 0.9622, 0, -0.9796, 0.201, 0.0392, -0.9796, 0.1971, 0, 0, 1, 0.1951, 0, 0.9808, 0, 0.9796, 0.201, 0, 1, -0, 0.0392, 0.9796, 0.1971, 0, -1, -0, 0, -0.1939, 0.981, 0.1914, -0.1939, 0.9622, 0, 0.9217, 0.3879, 0.0757, 0.9217, 0.3804, 0, -0.3805, 0.9247, 0.1804, -0.3805, 0.907, 0, 0.8286, 0.5598, 0.1092, 0.8286, 0.549, 0, -0.5528, 0.8333, 0, -0.3805, 0.9247, 0.1626, -0.5528, 0.8173, 0, 0.704, 0.7101, 0.1385, 0.704, 0.6965, 0, -0.704, 0.7101, 0.1385, -0.704, 0.6965, 0, 0.5528, 0.8333, 0, 0.704, 0.7101, 0.1626, 0.5528, 0.8173, 0, -0.704, 0.7101, 0, 0.3805, 0.9247, 0.2717, -0.704, 0.6561, 0.2142, -0.8286, 0.5171, 0.3189, 0.5528, 0.7699, 0.3539, 0.3805, 0.8544, 0.2142, -0.8286, 0.5171, 0.1484, -0.9217, 0.3583, 0.3754, 0.1939, 0.9063, 0.0769, -0.9796, 0.1856, 0.3827, 0, 0.9239, 0, 1, -0, 0.0769, 0.9796, 0.1856, 0, -1, -0, 0.3754, -0.1939, 0.9063, 0.1484, 0.9217, 0.3583, 0.3539, -0.3805, 0.8544, 0.2142, 0.8286, 0.5171, 0.3189, -0.5528, 0.7699, 0.2142, 0.8286, 0.5171, 0.2717, 0.704, 0.6561, 0.1116, 0.9796, 0.1671, 0.2155, 0.9217, 0.3225, 0.545, -0.1939, 0.8157, 0.5137, -0.3805, 0.7689, 0.2142, 0.8286, 0.5171, 0.311, 0.8286, 0.4654, 0.5137, -0.3805, 0.7689, 0.463, -0.5528, 0.6929, 0.2142, 0.8286, 0.5171, 0.311, 0.8286, 0.4654, 0.3945, 0.704, 0.5904, 0.3945, -0.704, 0.5904, 0.3945, 0.704, 0.5904, 0.463, 0.5528, 0.6929, 0.2142, -0.8286, 0.5171, 0.3945, -0.704, 0.5904, 0.311, -0.8286, 0.4654, 0.5137, 0.3805, 0.7689, 0.2142, -0.8286, 0.5171, 0.311, -0.8286, 0.4654, 0.2155, -0.9217, 0.3225, 0.5137, 0.3805, 0.7689, 0.545, 0.1939, 0.8157, 0.1116, -0.9796, 0.1671, 0.5556, 0, 0.8314, 0, 1, -0, 0, -1, -0, 0.5137, 0.3805, 0.7689, 0.5893, 0.5528, 0.5893, 0.6539, 0.3805, 0.6539, 0.311, -0.8286, 0.4654, 0.3958, -0.8286, 0.3958, 0.2743, -0.9217, 0.2743, 0.5137, 0.3805, 0.7689, 0.6937, 0.1939, 0.6937, 0.1421, -0.9796, 0.1421, 0.7071, 0, 0.7071, 0, 1, -0, 0.1421, 0.9796, 0.1421, 0, -1, -0, 0.6937, -0.1939, 0.6937, 0.2743, 0.9217, 0.2743, 0.5137, -0.3805, 0.7689, 0.6539, -0.3805, 0.6539, 0.311, 0.8286, 0.4654, 0.3958, 0.8286, 0.3958, 0.5137, -0.3805, 0.7689, 0.5893, -0.5528, 0.5893, 0.3945, 0.704, 0.5904, 0.311, 0.8286, 0.4654, 0.3958, 0.8286, 0.3958, 0.5021, 0.704, 0.5021, 0.3945, -0.704, 0.5904, 0.5021, -0.704, 0.5021, 0.3945, 0.704, 0.5904, 0.5021, 0.704, 0.5021, 0.311, -0.8286, 0.4654, 0.3945, -0.704, 0.5904, 0.5021, -0.704, 0.5021, 0.3958, -0.8286, 0.3958, 0.8157, -0.1939, 0.545, 0.7689, -0.3805, 0.5137, 0.3958, 0.8286, 0.3958, 0.3225, 0.9217, 0.2155, 0.4654, 0.8286, 0.311, 0.7689, -0.3805, 0.5137, 0.6929, -0.5528, 0.463, 0.5021, 0.704, 0.5021, 0.3958, 0.8286, 0.3958, 0.4654, 0.8286, 0.311, 0.5904, 0.704, 0.3945, 0.5021, -0.704, 0.5021, 0.5904, -0.704, 0.3945, 0.5021, 0.704, 0.5021, 0.5904, 0.704, 0.3945, 0.6929, 0.5528, 0.463, 0.3958, -0.8286, 0.3958, 0.5021, -0.704, 0.5021, 0.5904, -0.704, 0.3945, 0.4654, -0.8286, 0.311, 0.7689, 0.3805, 0.5137, 0.3958, -0.8286, 0.3958, 0.4654, -0.8286, 0.311, 0.3225, -0.9217, 0.2155, 0.7689, 0.3805, 0.5137, 0.8157, 0.1939, 0.545, 0.1671, -0.9796, 0.1116, 0.8314, 0, 0.5556, 0, 1, -0, 0.1671, 0.9796, 0.1116, 0, -1, -0, 0.4654, -0.8286, 0.311, 0.5171, -0.8286, 0.2142, 0.3583, -0.9217, 0.1484, 0.7689, 0.3805, 0.5137, 0.8544, 0.3805, 0.3539, 0.9063, 0.1939, 0.3754, 0.1856, -0.9796, 0.0769, 0.9239, 0, 0.3827, 0, 1, -0, 0.1856, 0.9796, 0.0769, 0, -1, -0, 0.9063, -0.1939, 0.3754, 0.3583, 0.9217, 0.1484, 0.7689, -0.3805, 0.5137, 0.8544, -0.3805, 0.3539, 0.4654, 0.8286, 0.311, 0.5171, 0.8286, 0.2142, 0.7689, -0.3805, 0.5137, 0.7699, -0.5528, 0.3189, 0.5904, 0.704, 0.3945, 0.4654, 0.8286, 0.311, 0.5171, 0.8286, 0.2142, 0.6561, 0.704, 0.2717, 0.5904, -0.704, 0.3945, 0.6561, -0.704, 0.2717, 0.5904, 0.704, 0.3945, 0.7699, 0.5528, 0.3189, 0.4654, -0.8286, 0.311, 0.5904, -0.704, 0.3945, 0.5171, -0.8286, 0.2142, 0.7689, 0.3805, 0.5137, 0.5171, 0.8286, 0.2142, 0.3804, 0.9217, 0.0757, 0.549, 0.8286, 0.1092, 0.907, -0.3805, 0.1804, 0.8173, -0.5528, 0.1626, 0.5171, 0.8286, 0.2142, 0.6965, 0.704, 0.1385, 0.6965, -0.704, 0.1385, 0.8173, 0.5528, 0.1626, 0.5171, -0.8286, 0.2142, 0.549, -0.8286, 0.1092, 0.907, 0.3805, 0.1804, 0.5171, -0.8286, 0.2142, 0.3804, -0.9217, 0.0757, 0.9622, 0.1939, 0.1914, 0.1971, -0.9796, 0.0392, 0.9808, 0, 0.1951, 0, 1, -0, 0.1971, 0.9796, 0.0392, 0, -1, -0, 0.9622, -0.1939, 0.1914, 0.9247, 0.3805, -0, 0.981, 0.1939, -0, 0.3879, -0.9217, -0, 0.201, -0.9796, -0, 1, 0, -0, 0, 1, -0, 0.201, 0.9796, -0, 0, -1, -0, 0.981, -0.1939, -0, 0.3879, 0.9217, -0, 0.9247, -0.3805, -0, 0.5598, 0.8286, -0, 0.9247, -0.3805, -0, 0.8333, -0.5528, -0, 0.7101, 0.704, -0, 0.7101, -0.704, -0, 0.7101, 0.704, -0, 0.8333, 0.5528, -0, 0.7101, -0.704, -0, 0.5598, -0.8286, -0, 0.9247, 0.3805, -0, 0.9247, -0.3805, -0, 0.907, -0.3805, -0.1804, 0.8173, -0.5528, -0.1626, 0.7101, 0.704, -0, 0.549, 0.8286, -0.1092, 0.6965, 0.704, -0.1385, 0.7101, -0.704, -0, 0.6965, -0.704, -0.1385, 0.7101, 0.704, -0, 0.8173, 0.5528, -0.1626, 0.7101, -0.704, -0, 0.549, -0.8286, -0.1092, 0.9247, 0.3805, -0, 0.907, 0.3805, -0.1804, 0.3804, -0.9217, -0.0757, 0.9247, 0.3805, -0, 0.9622, 0.1939, -0.1914, 0.1971, -0.9796, -0.0392, 0.9808, 0, -0.1951, 0, 1, -0, 0.1971, 0.9796, -0.0392, 0, -1, -0, 0.9622, -0.1939, -0.1914, 0.3804, 0.9217, -0.0757, 0.9247, -0.3805, -0, 0.3583, -0.9217, -0.1484, 0.1856, -0.9796, -0.0769, 0.9063, 0.1939, -0.3754, 0.9239, 0, -0.3827, 0, 1, -0, 0.1856, 0.9796, -0.0769, 0, -1, -0, 0.9063, -0.1939, -0.3754, 0.3583, 0.9217, -0.1484, 0.8544, -0.3805, -0.3539, 0.5171, 0.8286, -0.2142, 0.7699, -0.5528, -0.3189, 0.5171, 0.8286, -0.2142, 0.6561, 0.704, -0.2717, 0.6561, -0.704, -0.2717, 0.7699, 0.5528, -0.3189, 0.5171, -0.8286, -0.2142, 0.8544, 0.3805, -0.3539, 0.5171, -0.8286, -0.2142, 0.6929, -0.5528, -0.463, 0.5904, -0.704, -0.3945, 0.5904, 0.704, -0.3945, 0.6929, 0.5528, -0.463, 0.5171, -0.8286, -0.2142, 0.5904, -0.704, -0.3945, 0.4654, -0.8286, -0.311, 0.7689, 0.3805, -0.5137, 0.5171, -0.8286, -0.2142, 0.4654, -0.8286, -0.311, 0.3225, -0.9217, -0.2155, 0.7689, 0.3805, -0.5137, 0.8157, 0.1939, -0.545, 0.1671, -0.9796, -0.1116, 0.8314, 0, -0.5556, 0, 1, -0, 0.1671, 0.9796, -0.1116, 0, -1, -0, 0.8157, -0.1939, -0.545, 0.3225, 0.9217, -0.2155, 0.7689, -0.3805, -0.5137, 0.5171, 0.8286, -0.2142, 0.4654, 0.8286, -0.311, 0.7689, -0.3805, -0.5137, 0.5171, 0.8286, -0.2142, 0.4654, 0.8286, -0.311, 0.5904, 0.704, -0.3945, 0, 1, -0, 0.1421, 0.9796, -0.1421, 0, -1, -0, 0.1421, -0.9796, -0.1421, 0.7071, 0, -0.7071, 0.6937, -0.1939, -0.6937, 0.2743, 0.9217, -0.2743, 0.7689, -0.3805, -0.5137, 0.6539, -0.3805, -0.6539, 0.4654, 0.8286, -0.311, 0.3958, 0.8286, -0.3958, 0.7689, -0.3805, -0.5137, 0.5893, -0.5528, -0.5893, 0.5904, 0.704, -0.3945, 0.4654, 0.8286, -0.311, 0.3958, 0.8286, -0.3958, 0.5021, 0.704, -0.5021, 0.5904, -0.704, -0.3945, 0.5021, -0.704, -0.5021, 0.5904, 0.704, -0.3945, 0.5021, 0.704, -0.5021, 0.5893, 0.5528, -0.5893, 0.4654, -0.8286, -0.311, 0.5904, -0.704, -0.3945, 0.5021, -0.704, -0.5021, 0.3958, -0.8286, -0.3958, 0.7689, 0.3805, -0.5137, 0.6539, 0.3805, -0.6539, 0.4654, -0.8286, -0.311, 0.3958, -0.8286, -0.3958, 0.2743, -0.9217, -0.2743, 0.7689, 0.3805, -0.5137, 0.6937, 0.1939, -0.6937, 0.5021, 0.704, -0.5021, 0.3945, 0.704, -0.5904, 0.463, 0.5528, -0.6929, 0.3958, -0.8286, -0.3958, 0.5021, -0.704, -0.5021, 0.3945, -0.704, -0.5904, 0.311, -0.8286, -0.4654, 0.5137, 0.3805, -0.7689, 0.3958, -0.8286, -0.3958, 0.311, -0.8286, -0.4654, 0.2155, -0.9217, -0.3225, 0.5137, 0.3805, -0.7689, 0.545, 0.1939, -0.8157, 0.1116, -0.9796, -0.1671, 0.5556, 0, -0.8314, 0, 1, -0, 0.1116, 0.9796, -0.1671, 0, -1, -0, 0.545, -0.1939, -0.8157, 0.2155, 0.9217, -0.3225, 0.5137, -0.3805, -0.7689, 0.3958, 0.8286, -0.3958, 0.311, 0.8286, -0.4654, 0.5137, -0.3805, -0.7689, 0.463, -0.5528, -0.6929, 0.5021, 0.704, -0.5021, 0.3958, 0.8286, -0.3958, 0.311, 0.8286, -0.4654, 0.3945, 0.704, -0.5904, 0.5021, -0.704, -0.5021, 0.3945, -0.704, -0.5904, 0.3827, 0, -0.9239, 0.3754, -0.1939, -0.9063, 0.0769, 0.9796, -0.1856, 0.1484, 0.9217, -0.3583, 0.5137, -0.3805, -0.7689, 0.3539, -0.3805, -0.8544, 0.311, 0.8286, -0.4654, 0.2142, 0.8286, -0.5171, 0.5137, -0.3805, -0.7689, 0.3189, -0.5528, -0.7699, 0.3945, 0.704, -0.5904, 0.311, 0.8286, -0.4654, 0.2142, 0.8286, -0.5171, 0.2717, 0.704, -0.6561, 0.3945, -0.704, -0.5904, 0.2717, -0.704, -0.6561, 0.3945, 0.704, -0.5904, 0.3189, 0.5528, -0.7699, 0.311, -0.8286, -0.4654, 0.3945, -0.704, -0.5904, 0.2142, -0.8286, -0.5171, 0.5137, 0.3805, -0.7689, 0.3539, 0.3805, -0.8544, 0.311, -0.8286, -0.4654, 0.2142, -0.8286, -0.5171, 0.1484, -0.9217, -0.3583, 0.5137, 0.3805, -0.7689, 0.3754, 0.1939, -0.9063, 0.0769, -0.9796, -0.1856, 0, 1, -0, 0, -1, -0, 0.2142, -0.8286, -0.5171, 0.1385, -0.704, -0.6965, 0.1092, -0.8286, -0.549, 0.1626, 0.5528, -0.8173, 0.1804, 0.3805, -0.907, 0.2142, -0.8286, -0.5171, 0.0757, -0.9217, -0.3804, 0.1914, 0.1939, -0.9622, 0.0392, -0.9796, -0.1971, 0.1951, 0, -0.9808, 0, 1, -0, 0.0392, 0.9796, -0.1971, 0, -1, -0, 0.1914, -0.1939, -0.9622, 0.0757, 0.9217, -0.3804, 0.1804, -0.3805, -0.907, 0.2142, 0.8286, -0.5171, 0.1092, 0.8286, -0.549, 0.1626, -0.5528, -0.8173, 0.2142, 0.8286, -0.5171, 0.1385, 0.704, -0.6965, 0, 0.9796, -0.201, 0, 0.9217, -0.3879, 0, -0.1939, -0.981, 0, -0.3805, -0.9247, 0, 0.8286, -0.5598, 0, -0.3805, -0.9247, 0, -0.5528, -0.8333, 0, 0.704, -0.7101, 0, -0.704, -0.7101, 0, 0.704, -0.7101, 0, 0.5528, -0.8333, 0, -0.704, -0.7101, 0, -0.8286, -0.5598, 0, 0.3805, -0.9247, 0, -0.9217, -0.3879, 0, 0.3805, -0.9247, 0, 0.1939, -0.981, 0, -0.9796, -0.201, 0, 0, -1, 0, 1, -0, 0, -1, -0, 0, 0.3805, -0.9247, -0.1626, 0.5528, -0.8173, -0.1804, 0.3805, -0.907, -0.1092, -0.8286, -0.549, -0.0757, -0.9217, -0.3804, 0, 0.3805, -0.9247, -0.1914, 0.1939, -0.9622, -0.0392, -0.9796, -0.1971, -0.1951, 0, -0.9808, 0, 1, -0, -0.0392, 0.9796, -0.1971, 0, -1, -0, -0.1914, -0.1939, -0.9622, -0.0757, 0.9217, -0.3804, 0, -0.3805, -0.9247, -0.1804, -0.3805, -0.907, -0.1092, 0.8286, -0.549, 0, -0.3805, -0.9247, -0.1626, -0.5528, -0.8173, 0, 0.704, -0.7101, -0.1385, 0.704, -0.6965, 0, -0.704, -0.7101, -0.1385, -0.704, -0.6965, 0, 0.704, -0.7101, 0, -0.704, -0.7101, -0.3754, -0.1939, -0.9063, -0.3539, -0.3805, -0.8544, -0.1484, 0.9217, -0.3583, -0.2142, 0.8286, -0.5171, -0.3189, -0.5528, -0.7699, -0.2142, 0.8286, -0.5171, -0.2717, 0.704, -0.6561, -0.2717, -0.704, -0.6561, -0.3189, 0.5528, -0.7699, -0.2142, -0.8286, -0.5171, -0.3539, 0.3805, -0.8544, -0.2142, -0.8286, -0.5171, -0.1484, -0.9217, -0.3583, -0.3754, 0.1939, -0.9063, -0.0769, -0.9796, -0.1856, -0.3827, 0, -0.9239, 0, 1, -0, -0.0769, 0.9796, -0.1856, 0, -1, -0, -0.2142, -0.8286, -0.5171, -0.311, -0.8286, -0.4654, -0.2155, -0.9217, -0.3225, -0.5137, 0.3805, -0.7689, -0.545, 0.1939, -0.8157, -0.1116, -0.9796, -0.1671, -0.5556, 0, -0.8314, 0, 1, -0, -0.1116, 0.9796, -0.1671, 0, -1, -0, -0.545, -0.1939, -0.8157, -0.2155, 0.9217, -0.3225, -0.5137, -0.3805, -0.7689, -0.2142, 0.8286, -0.5171, -0.311, 0.8286, -0.4654, -0.5137, -0.3805, -0.7689, -0.463, -0.5528, -0.6929, -0.2142, 0.8286, -0.5171, -0.311, 0.8286, -0.4654, -0.3945, 0.704, -0.5904, -0.3945, -0.704, -0.5904, -0.3945, 0.704, -0.5904, -0.463, 0.5528, -0.6929, -0.2142, -0.8286, -0.5171, -0.3945, -0.704, -0.5904, -0.311, -0.8286, -0.4654, -0.5137, 0.3805, -0.7689, -0.5137, -0.3805, -0.7689, -0.6539, -0.3805, -0.6539, -0.5893, -0.5528, -0.5893, -0.3945, 0.704, -0.5904, -0.311, 0.8286, -0.4654, -0.3958, 0.8286, -0.3958, -0.5021, 0.704, -0.5021, -0.3945, -0.704, -0.5904, -0.5021, -0.704, -0.5021, -0.3945, 0.704, -0.5904, -0.5021, 0.704, -0.5021, -0.5893, 0.5528, -0.5893, -0.311, -0.8286, -0.4654, -0.3945, -0.704, -0.5904, -0.5021, -0.704, -0.5021, -0.3958, -0.8286, -0.3958, -0.5137, 0.3805, -0.7689, -0.6539, 0.3805, -0.6539, -0.311, -0.8286, -0.4654, -0.3958, -0.8286, -0.3958, -0.2743, -0.9217, -0.2743, -0.5137, 0.3805, -0.7689, -0.6937, 0.1939, -0.6937, -0.1421, -0.9796, -0.1421, -0.7071, 0, -0.7071, 0, 1, -0, -0.1421, 0.9796, -0.1421, 0, -1, -0, -0.6937, -0.1939, -0.6937, -0.2743, 0.9217, -0.2743, -0.5137, -0.3805, -0.7689, -0.311, 0.8286, -0.4654, -0.3958, 0.8286, -0.3958, -0.3225, -0.9217, -0.2155, -0.1671, -0.9796, -0.1116, -0.8157, 0.1939, -0.545, -0.8314, 0, -0.5556, 0, 1, -0, -0.1671, 0.9796, -0.1116, 0, -1, -0, -0.8157, -0.1939, -0.545, -0.3225, 0.9217, -0.2155, -0.7689, -0.3805, -0.5137, -0.3958, 0.8286, -0.3958, -0.4654, 0.8286, -0.311, -0.7689, -0.3805, -0.5137, -0.6929, -0.5528, -0.463, -0.5021, 0.704, -0.5021, -0.3958, 0.8286, -0.3958, -0.4654, 0.8286, -0.311, -0.5904, 0.704, -0.3945, -0.5021, -0.704, -0.5021, -0.5904, -0.704, -0.3945, -0.5021, 0.704, -0.5021, -0.5904, 0.704, -0.3945, -0.6929, 0.5528, -0.463, -0.3958, -0.8286, -0.3958, -0.5021, -0.704, -0.5021, -0.5904, -0.704, -0.3945, -0.4654, -0.8286, -0.311, -0.7689, 0.3805, -0.5137, -0.3958, -0.8286, -0.3958, -0.4654, -0.8286, -0.311, -0.7689, 0.3805, -0.5137, -0.5904, 0.704, -0.3945, -0.4654, 0.8286, -0.311, -0.5171, 0.8286, -0.2142, -0.6561, 0.704, -0.2717, -0.5904, -0.704, -0.3945, -0.7699, -0.5528, -0.3189, -0.6561, -0.704, -0.2717, -0.5904, 0.704, -0.3945, -0.7699, 0.5528, -0.3189, -0.4654, -0.8286, -0.311, -0.5904, -0.704, -0.3945, -0.5171, -0.8286, -0.2142, -0.7689, 0.3805, -0.5137, -0.8544, 0.3805, -0.3539, -0.4654, -0.8286, -0.311, -0.5171, -0.8286, -0.2142, -0.3583, -0.9217, -0.1484, -0.7689, 0.3805, -0.5137, -0.9063, 0.1939, -0.3754, -0.1856, -0.9796, -0.0769, -0.9239, 0, -0.3827, 0, 1, -0, -0.1856, 0.9796, -0.0769, 0, -1, -0, -0.9063, -0.1939, -0.3754, -0.3583, 0.9217, -0.1484, -0.7689, -0.3805, -0.5137, -0.8544, -0.3805, -0.3539, -0.4654, 0.8286, -0.311, -0.5171, 0.8286, -0.2142, -0.7689, -0.3805, -0.5137, -0.9622, 0.1939, -0.1914, -0.9808, 0, -0.1951, 0, 1, -0, -0.1971, 0.9796, -0.0392, 0, -1, -0, -0.1971, -0.9796, -0.0392, -0.9622, -0.1939, -0.1914, -0.3804, 0.9217, -0.0757, -0.907, -0.3805, -0.1804, -0.5171, 0.8286, -0.2142, -0.549, 0.8286, -0.1092, -0.8173, -0.5528, -0.1626, -0.5171, 0.8286, -0.2142, -0.6965, 0.704, -0.1385, -0.6965, -0.704, -0.1385, -0.8173, 0.5528, -0.1626, -0.5171, -0.8286, -0.2142, -0.549, -0.8286, -0.1092, -0.907, 0.3805, -0.1804, -0.5171, -0.8286, -0.2142, -0.3804, -0.9217, -0.0757, -0.8333, -0.5528, -0, -0.7101, -0.704, -0, -0.7101, 0.704, -0, -0.8333, 0.5528, -0, -0.7101, -0.704, -0, -0.5598, -0.8286, -0, -0.9247, 0.3805, -0, -0.3879, -0.9217, -0, -0.9247, 0.3805, -0, -0.981, 0.1939, -0, -0.201, -0.9796, -0, -1, 0, -0, 0, 1, -0, -0.201, 0.9796, -0, 0, -1, -0, -0.981, -0.1939, -0, -0.3879, 0.9217, -0, -0.9247, -0.3805, -0, -0.5598, 0.8286, -0, -0.9247, -0.3805, -0, -0.7101, 0.704, -0, -0.201, 0.9796, -0, 0, 1, -0, -0.1971, 0.9796, 0.0392, 0, -1, -0, -0.201, -0.9796, -0, -0.1971, -0.9796, 0.0392, -0.981, -0.1939, -0, -1, 0, -0, -0.9808, 0, 0.1951, -0.9622, -0.1939, 0.1914, -0.3879, 0.9217, -0, -0.3804, 0.9217, 0.0757, -0.9247, -0.3805, -0, -0.907, -0.3805, 0.1804, -0.5598, 0.8286, -0, -0.549, 0.8286, 0.1092, -0.8333, -0.5528, -0, -0.9247, -0.3805, -0, -0.8173, -0.5528, 0.1626, -0.7101, 0.704, -0, -0.6965, 0.704, 0.1385, -0.7101, -0.704, -0, -0.6965, -0.704, 0.1385, -0.8333, 0.5528, -0, -0.7101, 0.704, -0, -0.8173, 0.5528, 0.1626, -0.5598, -0.8286, -0, -0.7101, -0.704, -0, -0.549, -0.8286, 0.1092, -0.9247, 0.3805, -0, -0.907, 0.3805, 0.1804, -0.3879, -0.9217, -0, -0.3804, -0.9217, 0.0757, -0.981, 0.1939, -0, -0.9247, 0.3805, -0, -0.9622, 0.1939, 0.1914, -0.6561, 0.704, 0.2717, -0.7699, 0.5528, 0.3189, -0.6561, -0.704, 0.2717, -0.5171, -0.8286, 0.2142, -0.8544, 0.3805, 0.3539, -0.5171, -0.8286, 0.2142, -0.3583, -0.9217, 0.1484, -0.9063, 0.1939, 0.3754, -0.1856, -0.9796, 0.0769, -0.9239, 0, 0.3827, 0, 1, -0, -0.1856, 0.9796, 0.0769, 0, -1, -0, -0.9063, -0.1939, 0.3754, -0.3583, 0.9217, 0.1484, -0.8544, -0.3805, 0.3539, -0.5171, 0.8286, 0.2142, -0.7699, -0.5528, 0.3189, -0.5171, 0.8286, 0.2142, -0.8314, 0, 0.5556, -0.8157, -0.1939, 0.545, -0.1671, 0.9796, 0.1116, -0.3225, 0.9217, 0.2155, -0.7689, -0.3805, 0.5137, -0.5171, 0.8286, 0.2142, -0.4654, 0.8286, 0.311, -0.7689, -0.3805, 0.5137, -0.6929, -0.5528, 0.463, -0.5171, 0.8286, 0.2142, -0.4654, 0.8286, 0.311, -0.5904, 0.704, 0.3945, -0.5904, -0.704, 0.3945, -0.5904, 0.704, 0.3945, -0.6929, 0.5528, 0.463, -0.5171, -0.8286, 0.2142, -0.5904, -0.704, 0.3945, -0.4654, -0.8286, 0.311, -0.7689, 0.3805, 0.5137, -0.5171, -0.8286, 0.2142, -0.4654, -0.8286, 0.311, -0.3225, -0.9217, 0.2155, -0.7689, 0.3805, 0.5137, -0.8157, 0.1939, 0.545, -0.1671, -0.9796, 0.1116, 0, 1, -0, 0, -1, -0, -0.4654, -0.8286, 0.311, -0.5904, -0.704, 0.3945, -0.5021, -0.704, 0.5021, -0.3958, -0.8286, 0.3958, -0.7689, 0.3805, 0.5137, -0.5893, 0.5528, 0.5893, -0.6539, 0.3805, 0.6539, -0.4654, -0.8286, 0.311, -0.3958, -0.8286, 0.3958, -0.2743, -0.9217, 0.2743, -0.7689, 0.3805, 0.5137, -0.6937, 0.1939, 0.6937, -0.1421, -0.9796, 0.1421, -0.7071, 0, 0.7071, 0, 1, -0, -0.1421, 0.9796, 0.1421, 0, -1, -0, -0.6937, -0.1939, 0.6937, -0.2743, 0.9217, 0.2743, -0.7689, -0.3805, 0.5137, -0.6539, -0.3805, 0.6539, -0.4654, 0.8286, 0.311, -0.3958, 0.8286, 0.3958, -0.7689, -0.3805, 0.5137, -0.5893, -0.5528, 0.5893, -0.5904, 0.704, 0.3945, -0.4654, 0.8286, 0.311, -0.3958, 0.8286, 0.3958, -0.5021, 0.704, 0.5021, -0.5904, -0.704, 0.3945, -0.5021, -0.704, 0.5021, -0.5904, 0.704, 0.3945, -0.5021, 0.704, 0.5021, -0.545, -0.1939, 0.8157, -0.5137, -0.3805, 0.7689, -0.3958, 0.8286, 0.3958, -0.2155, 0.9217, 0.3225, -0.311, 0.8286, 0.4654, -0.5137, -0.3805, 0.7689, -0.463, -0.5528, 0.6929, -0.5021, 0.704, 0.5021, -0.3958, 0.8286, 0.3958, -0.311, 0.8286, 0.4654, -0.3945, 0.704, 0.5904, -0.5021, -0.704, 0.5021, -0.3945, -0.704, 0.5904, -0.5021, 0.704, 0.5021, -0.3945, 0.704, 0.5904, -0.463, 0.5528, 0.6929, -0.3958, -0.8286, 0.3958, -0.5021, -0.704, 0.5021, -0.3945, -0.704, 0.5904, -0.311, -0.8286, 0.4654, -0.5137, 0.3805, 0.7689, -0.3958, -0.8286, 0.3958, -0.311, -0.8286, 0.4654, -0.2155, -0.9217, 0.3225, -0.5137, 0.3805, 0.7689, -0.545, 0.1939, 0.8157, -0.1116, -0.9796, 0.1671, -0.5556, 0, 0.8314, 0, 1, -0, -0.1116, 0.9796, 0.1671, 0, -1, -0, -0.311, -0.8286, 0.4654, -0.2142, -0.8286, 0.5171, -0.1484, -0.9217, 0.3583, -0.5137, 0.3805, 0.7689, -0.3539, 0.3805, 0.8544, -0.3754, 0.1939, 0.9063, -0.0769, -0.9796, 0.1856, -0.3827, 0, 0.9239, 0, 1, -0, -0.0769, 0.9796, 0.1856, 0, -1, -0, -0.3754, -0.1939, 0.9063, -0.1484, 0.9217, 0.3583, -0.5137, -0.3805, 0.7689, -0.3539, -0.3805, 0.8544, -0.311, 0.8286, 0.4654, -0.2142, 0.8286, 0.5171, -0.5137, -0.3805, 0.7689, -0.3189, -0.5528, 0.7699, -0.3945, 0.704, 0.5904, -0.311, 0.8286, 0.4654, -0.2142, 0.8286, 0.5171, -0.2717, 0.704, 0.6561, -0.3945, -0.704, 0.5904, -0.2717, -0.704, 0.6561, -0.3945, 0.704, 0.5904, -0.3189, 0.5528, 0.7699, -0.311, -0.8286, 0.4654, -0.3945, -0.704, 0.5904, -0.2142, -0.8286, 0.5171, -0.5137, 0.3805, 0.7689, -0.2142, 0.8286, 0.5171, -0.0757, 0.9217, 0.3804, -0.1092, 0.8286, 0.549, -0.1804, -0.3805, 0.907, -0.1626, -0.5528, 0.8173, -0.2142, 0.8286, 0.5171, -0.1385, 0.704, 0.6965, -0.1385, -0.704, 0.6965, -0.1626, 0.5528, 0.8173, -0.2142, -0.8286, 0.5171, -0.1092, -0.8286, 0.549, -0.1804, 0.3805, 0.907, -0.2142, -0.8286, 0.5171, -0.0757, -0.9217, 0.3804, -0.1914, 0.1939, 0.9622, -0.0392, -0.9796, 0.1971, -0.1951, 0, 0.9808, 0, 1, -0, -0.0392, 0.9796, 0.1971, 0, -1, -0, -0.1914, -0.1939, 0.9622, 0, 0.3805, 0.9247, 0, 1, -0, 0, -1, -0, 0, -0.3805, 0.9247, 0, -0.3805, 0.9247, 0, 0.704, 0.7101, 0, -0.704, 0.7101, 0, 0.704, 0.7101, 0, -0.704, 0.7101, 0, 0.3805, 0.9247
-};
-
-float mTangents[] = {
--0.999835, 0.00704043, 0.016729, -0.999867, 0.0091355, 0.013523, -0.983294, -0.00913319, 0.181798, -0.983886, -0.00707153, 0.178659, -0.999993, -0.00374634, 0.000741305, -0.999299, -0.0346288, 0.0142639, -0.981317, 0.00692463, 0.192276, -0.980921, 0.00374845, 0.19437, -0.999814, 0.00387726, 0.018896, -0.984291, -0.00387327, 0.176509, -1, 0, 0, -0.980784, 0, 0.195097, -0.999814, -0.00387777, 0.0188985, -0.999929, 0, 0.0119371, -0.984291, 0.00387335, 0.176509, -0.999929, 0, 0.0119371, -0.999993, 0.00374645, 0.000741328, -0.980921, -0.00374849, 0.19437, -0.999835, -0.00704146, 0.0167315, -0.983886, 0.00707197, 0.178658, -0.999299, 0.0346297, 0.0142643, -0.981317, -0.00692622, 0.192275, -0.999867, -0.00913591, 0.0135236, -0.983294, 0.00913279, 0.181798, -0.999941, 0.00907351, 0.0060197, -0.999298, 0.0346309, 0.0142648, -0.981897, -0.00908827, 0.189199, -0.997604, -0.0491193, 0.0487113, -0.982602, 0.00981701, 0.185467, -0.997604, 0.0491193, 0.0487113, -0.982601, -0.00981709, 0.185467, -0.999941, -0.00907391, 0.00601997, -0.997604, -0.0491206, 0.0487126, -0.981897, 0.0090887, 0.189199, -0.997605, 0.0491186, 0.0487106, -0.999298, -0.0346315, 0.0142651, -0.927543, -0.0098031, 0.373588, -0.946614, -0.0455358, 0.319137, -0.926129, 0.00907326, 0.377098, -0.924946, 0.00693023, 0.380035, -0.946614, -0.0455358, 0.319137, -0.930133, -0.00702966, 0.367156, -0.924158, 0.00374604, 0.381993, -0.930938, -0.00389548, 0.365156, -0.923876, 0, 0.382691, -0.999929, 0, 0.0119371, -0.930939, 0.00389586, 0.365155, -0.999929, 0, 0.0119371, -0.924158, -0.0037462, 0.381993, -0.930133, 0.00702958, 0.367156, -0.924946, -0.00693009, 0.380035, -0.946614, 0.0455358, 0.319137, -0.926129, -0.0090735, 0.377097, -0.946614, 0.0455358, 0.319137, -0.927543, 0.00980324, 0.373587, -0.84182, 0.00383388, 0.539745, -0.840628, 0.00705194, 0.541567, -0.83189, -0.00374176, 0.554928, -0.838837, -0.0346117, 0.543282, -0.895018, -0.0455194, 0.443702, -0.866156, 0.0455494, 0.497694, -0.838837, -0.0346117, 0.543282, -0.834756, -0.00908243, 0.550545, -0.89502, -0.0455156, 0.443697, -0.866156, 0.0455494, 0.497694, -0.856541, 0.0491246, 0.513735, -0.856541, -0.0491246, 0.513735, -0.856541, 0.0491246, 0.513735, -0.834756, 0.00908231, 0.550545, -0.895018, 0.0455194, 0.443702, -0.856541, -0.0491246, 0.513735, -0.866156, -0.0455494, 0.497694, -0.838837, 0.0346117, 0.543282, -0.895021, 0.0455143, 0.443695, -0.866156, -0.0455494, 0.497694, -0.840629, -0.00705275, 0.541565, -0.838837, 0.0346117, 0.543282, -0.83189, 0.003742, 0.554928, -0.841822, -0.00383466, 0.539742, -0.831435, 0, 0.555622, -0.999929, 0, 0.0119371, -0.999929, 0, 0.0119371, -0.822989, -0.0346519, 0.566999, -0.711319, 0.00907487, 0.70281, -0.709104, 0.00693019, 0.70507, -0.791253, 0.0455133, 0.609793, -0.752428, -0.0455293, 0.657099, -0.718818, -0.0070398, 0.695163, -0.82299, -0.0346496, 0.566999, -0.707625, 0.00374715, 0.706578, -0.72034, -0.00387753, 0.69361, -0.707107, 0, 0.707107, -0.999929, 0, 0.0119371, -0.720342, 0.00387798, 0.693608, -0.999929, 0, 0.0119371, -0.707625, -0.0037472, 0.706578, -0.718818, 0.00703992, 0.695163, -0.822989, 0.0346507, 0.566999, -0.709104, -0.00693079, 0.70507, -0.791257, -0.0455094, 0.609788, -0.752428, 0.0455293, 0.657099, -0.822989, 0.0346503, 0.566999, -0.711319, -0.00907432, 0.702811, -0.80241, -0.0491145, 0.594749, -0.791255, -0.0455109, 0.60979, -0.752428, 0.0455293, 0.657099, -0.739858, 0.0491155, 0.670968, -0.80241, 0.0491145, 0.594749, -0.739858, -0.0491155, 0.670968, -0.802411, -0.0491129, 0.594748, -0.739858, 0.0491155, 0.670968, -0.791257, 0.0455094, 0.609788, -0.802411, 0.0491128, 0.594748, -0.739858, -0.0491155, 0.670968, -0.752428, -0.0455293, 0.657099, -0.556159, -0.00375196, 0.831067, -0.566999, -0.0346504, 0.822989, -0.657098, -0.04553, 0.752429, -0.569395, 0.00703204, 0.822034, -0.609788, 0.0455087, 0.791257, -0.566999, -0.0346504, 0.822989, -0.560552, -0.00906506, 0.82807, -0.670966, -0.0491178, 0.739859, -0.657098, -0.0455299, 0.752429, -0.609788, 0.0455087, 0.791257, -0.594747, 0.0491122, 0.802411, -0.670966, 0.0491178, 0.739859, -0.594747, -0.0491122, 0.802411, -0.670967, -0.0491171, 0.739859, -0.594747, 0.0491122, 0.802411, -0.560552, 0.00906497, 0.82807, -0.657098, 0.04553, 0.752429, -0.670966, 0.0491178, 0.739859, -0.594747, -0.0491122, 0.802411, -0.609788, -0.0455087, 0.791257, -0.566999, 0.0346519, 0.822989, -0.657103, 0.0455254, 0.752425, -0.609788, -0.0455087, 0.791257, -0.569398, -0.00703363, 0.822032, -0.566999, 0.0346519, 0.822989, -0.556159, 0.00375194, 0.831067, -0.571169, -0.0039183, 0.820823, -0.555624, 0, 0.831433, -0.35337, 0, 0.935484, -0.57117, 0.00391863, 0.820822, -0.35337, 0, 0.935484, -0.497694, 0.0455489, 0.866156, -0.443699, -0.0455174, 0.895019, -0.398075, -0.0070507, 0.917326, -0.543282, -0.0346109, 0.838837, -0.385304, 0.00693222, 0.922764, -0.383365, 0.00374712, 0.923589, -0.400078, -0.00385631, 0.916473, -0.382689, 0, 0.923877, -0.35337, 0, 0.935484, -0.400075, 0.00385572, 0.916474, -0.35337, 0, 0.935484, -0.383365, -0.00374729, 0.923589, -0.398077, 0.00705182, 0.917325, -0.543282, 0.0346117, 0.838837, -0.385304, -0.00693213, 0.922764, -0.497691, -0.0455514, 0.866157, -0.443699, 0.0455174, 0.895019, -0.543282, 0.0346102, 0.838836, -0.388219, -0.00907562, 0.921522, -0.513737, -0.0491229, 0.856541, -0.497691, -0.0455515, 0.866158, -0.443699, 0.0455174, 0.895019, -0.391627, 0.009889, 0.920071, -0.513737, 0.0491229, 0.856541, -0.391627, -0.00988918, 0.920071, -0.513738, -0.0491212, 0.85654, -0.388219, 0.0090752, 0.921522, -0.497691, 0.0455514, 0.866157, -0.513737, 0.0491227, 0.856541, -0.443699, -0.0455174, 0.895019, -0.543282, -0.0346117, 0.838837, -0.319139, -0.0455345, 0.946613, -0.211477, 0.00700832, 0.977358, -0.208327, 0.00913729, 0.978017, -0.197871, -0.00693716, 0.980204, -0.201005, -0.00905698, 0.979548, -0.319142, -0.045532, 0.946612, -0.20462, 0.00987766, 0.978792, -0.20462, -0.00987788, 0.978792, -0.201005, 0.00905689, 0.979548, -0.319139, 0.0455345, 0.946613, -0.208329, -0.00913823, 0.978016, -0.19787, 0.00693605, 0.980204, -0.319131, 0.04554, 0.946616, -0.211475, -0.00700728, 0.977358, -0.19582, 0.00374629, 0.980633, -0.213585, -0.00388163, 0.976917, -0.195096, 0, 0.980784, -0.35337, 0, 0.935484, -0.21359, 0.00388266, 0.976916, -0.35337, 0, 0.935484, -0.19582, -0.00374621, 0.980633, -0.0142643, 0.0346297, 0.999299, -0.000741364, 0.00374663, 0.999993, -0.0167379, -0.00704416, 0.999835, -0.018896, -0.00387726, 0.999814, 0, 0, 1, -0.35337, 0, 0.935484, -0.018891, 0.00387623, 0.999814, -0.35337, 0, 0.935484, -0.000741336, -0.0037465, 0.999993, -0.0167354, 0.00704313, 0.999835, -0.0142643, -0.0346295, 0.999299, -0.0135232, 0.00913563, 0.999867, -0.0142643, -0.0346295, 0.999299, -0.00601925, -0.00907283, 0.999941, -0.0487113, 0.0491193, 0.997604, -0.0487113, -0.0491193, 0.997604, -0.0487113, 0.0491193, 0.997604, -0.00601931, 0.00907292, 0.999941, -0.0487113, -0.0491193, 0.997604, -0.0135218, -0.0091347, 0.999867, -0.0142643, 0.0346297, 0.999299, 0.0142639, 0.0346287, 0.999298, 0.192276, -0.00692522, 0.981317, 0.189198, -0.00908999, 0.981897, 0.0487113, -0.0491193, 0.997604, 0.181798, 0.00913279, 0.983294, 0.185467, 0.009817, 0.982601, 0.0487113, 0.0491193, 0.997604, 0.185467, -0.00981709, 0.982602, 0.0487095, -0.0491175, 0.997605, 0.189198, 0.00909042, 0.981897, 0.0487106, 0.0491186, 0.997605, 0.181796, -0.00913439, 0.983294, 0.0142643, -0.0346297, 0.999299, 0.192275, 0.00692575, 0.981317, 0.178664, -0.00706965, 0.983885, 0.0142639, -0.0346288, 0.999299, 0.19437, 0.00374845, 0.980921, 0.176509, -0.00387327, 0.984291, 0.195097, 0, 0.980784, -0.35337, 0, 0.935484, 0.176509, 0.00387335, 0.984291, -0.35337, 0, 0.935484, 0.19437, -0.00374855, 0.980921, 0.178665, 0.00706916, 0.983885, 0.0142651, 0.0346315, 0.999298, 0.367152, -0.00703159, 0.930135, 0.365156, -0.00389548, 0.930938, 0.381993, 0.00374604, 0.924158, 0.382691, 0, 0.923876, 0.505021, 0, 0.863107, 0.365155, 0.00389586, 0.930939, 0.505021, 0, 0.863107, 0.381993, -0.0037461, 0.924158, 0.367156, 0.00702958, 0.930133, 0.380035, -0.00693025, 0.924946, 0.319137, 0.0455358, 0.946614, 0.377098, -0.00907318, 0.926129, 0.319137, 0.0455358, 0.946614, 0.373588, 0.00980234, 0.927543, 0.373588, -0.00980276, 0.927543, 0.377098, 0.00907275, 0.926129, 0.319137, -0.0455358, 0.946614, 0.380035, 0.00693023, 0.924946, 0.319137, -0.0455358, 0.946614, 0.550545, -0.00908286, 0.834756, 0.513737, -0.0491229, 0.856541, 0.513737, 0.0491229, 0.856541, 0.550546, 0.00908123, 0.834756, 0.443702, 0.0455194, 0.895018, 0.513737, -0.0491229, 0.856541, 0.497694, -0.0455494, 0.866156, 0.543282, 0.0346117, 0.838837, 0.443703, 0.0455198, 0.895017, 0.497694, -0.0455494, 0.866156, 0.54157, -0.00705019, 0.840626, 0.543282, 0.0346117, 0.838837, 0.554928, 0.00374184, 0.83189, 0.539742, -0.00383466, 0.841822, 0.555622, 0, 0.831435, 0.505021, 0, 0.863107, 0.539745, 0.00383388, 0.84182, 0.505021, 0, 0.863107, 0.554928, -0.00374176, 0.83189, 0.541568, 0.00705151, 0.840627, 0.543282, -0.0346108, 0.838837, 0.443702, -0.0455194, 0.895018, 0.497694, 0.0455494, 0.866156, 0.543282, -0.0346108, 0.838837, 0.443699, -0.0455172, 0.895019, 0.497694, 0.0455494, 0.866156, 0.513737, 0.0491229, 0.856541, 0.505021, 0, 0.863107, 0.693607, 0.00387831, 0.720343, 0.505021, 0, 0.863107, 0.69361, -0.00387753, 0.72034, 0.707107, 0, 0.707107, 0.706578, -0.00374721, 0.707625, 0.695161, 0.00704104, 0.71882, 0.566999, 0.0346507, 0.822989, 0.70507, -0.00693079, 0.709104, 0.609792, -0.0455121, 0.791254, 0.657102, 0.0455266, 0.752426, 0.566999, 0.0346503, 0.822989, 0.702811, -0.00907432, 0.711319, 0.594747, -0.0491122, 0.802411, 0.609788, -0.0455088, 0.791257, 0.657102, 0.0455266, 0.752426, 0.670966, 0.0491178, 0.739859, 0.594747, 0.0491122, 0.802411, 0.670966, -0.0491178, 0.739859, 0.594746, -0.0491105, 0.802412, 0.670966, 0.0491178, 0.739859, 0.70281, 0.00907621, 0.71132, 0.609792, 0.0455121, 0.791254, 0.59475, 0.0491158, 0.802409, 0.670966, -0.0491178, 0.739859, 0.657102, -0.0455266, 0.752426, 0.566999, -0.0346519, 0.822989, 0.70507, 0.00693019, 0.709104, 0.609793, 0.0455133, 0.791253, 0.657102, -0.0455266, 0.752426, 0.695163, -0.0070398, 0.718818, 0.566999, -0.0346496, 0.82299, 0.706578, 0.00374712, 0.707625, 0.739859, -0.0491171, 0.670967, 0.802411, 0.0491122, 0.594747, 0.82807, 0.00906497, 0.560552, 0.752426, 0.0455266, 0.657102, 0.739857, 0.0491142, 0.670969, 0.802411, -0.0491122, 0.594747, 0.791254, -0.0455121, 0.609792, 0.822989, 0.0346519, 0.566999, 0.752425, 0.0455254, 0.657103, 0.791254, -0.0455121, 0.609792, 0.822032, -0.00703363, 0.569398, 0.822989, 0.0346519, 0.566999, 0.831067, 0.00375211, 0.55616, 0.820823, -0.0039183, 0.571169, 0.831433, 0, 0.555624, 0.505021, 0, 0.863107, 0.820823, 0.00391839, 0.571169, 0.505021, 0, 0.863107, 0.831067, -0.00375196, 0.556159, 0.822032, 0.0070334, 0.569398, 0.822989, -0.0346504, 0.566999, 0.752426, -0.0455266, 0.657102, 0.791254, 0.0455121, 0.609792, 0.822989, -0.0346504, 0.566999, 0.82807, -0.00906505, 0.560552, 0.739859, -0.0491178, 0.670966, 0.752429, -0.0455299, 0.657098, 0.791254, 0.0455121, 0.609792, 0.802411, 0.0491122, 0.594747, 0.739859, 0.0491178, 0.670966, 0.802411, -0.0491122, 0.594747, 0.923877, 0, 0.382689, 0.923589, -0.00374689, 0.383365, 0.916474, 0.00385572, 0.400075, 0.917326, 0.00705047, 0.398075, 0.838837, 0.0346117, 0.543282, 0.922764, -0.00693175, 0.385303, 0.866157, -0.0455514, 0.497691, 0.895019, 0.0455174, 0.443699, 0.838836, 0.0346102, 0.543282, 0.921522, -0.00907562, 0.388219, 0.856541, -0.0491229, 0.513737, 0.866158, -0.0455515, 0.497691, 0.895019, 0.0455174, 0.443699, 0.920071, 0.009889, 0.391627, 0.856541, 0.0491229, 0.513737, 0.920071, -0.00988918, 0.391627, 0.85654, -0.0491212, 0.513738, 0.921522, 0.0090752, 0.388219, 0.866157, 0.0455514, 0.497691, 0.856541, 0.0491227, 0.513737, 0.895019, -0.0455174, 0.443699, 0.838837, -0.0346117, 0.543282, 0.922764, 0.00693186, 0.385303, 0.866156, 0.0455489, 0.497694, 0.895019, -0.0455174, 0.443699, 0.917326, -0.0070507, 0.398075, 0.838837, -0.0346109, 0.543282, 0.923589, 0.00374692, 0.383365, 0.916473, -0.00385631, 0.400078, 0.967412, 0, 0.253207, 0.967412, 0, 0.253207, 0.946613, 0.0455345, 0.319139, 0.978792, -0.00987788, 0.20462, 0.978016, -0.00913822, 0.208329, 0.979548, 0.00905689, 0.201005, 0.980204, 0.00693642, 0.19787, 0.946616, 0.04554, 0.319131, 0.977358, -0.00700728, 0.211475, 0.980633, 0.00374571, 0.19582, 0.976917, -0.00388163, 0.213585, 0.980784, 0, 0.195096, 0.967412, 0, 0.253207, 0.976916, 0.00388266, 0.21359, 0.967412, 0, 0.253207, 0.980633, -0.00374605, 0.19582, 0.977358, 0.00700832, 0.211477, 0.980204, -0.00693641, 0.19787, 0.946613, -0.0455345, 0.319139, 0.978017, 0.00913729, 0.208327, 0.979548, -0.00905698, 0.201005, 0.946612, -0.045532, 0.319142, 0.978792, 0.00987766, 0.20462, 0.999814, 0.00387624, 0.018891, 0.999835, 0.00704313, 0.0167354, 0.999993, -0.0037469, 0.000741418, 0.999298, -0.0346315, 0.0142651, 0.999867, 0.00913563, 0.0135232, 0.999298, -0.0346315, 0.0142651, 0.999941, -0.00907283, 0.00601925, 0.997604, 0.0491193, 0.0487113, 0.997604, -0.0491193, 0.0487113, 0.997604, 0.0491193, 0.0487113, 0.999941, 0.00907292, 0.00601931, 0.997604, -0.0491193, 0.0487113, 0.999867, -0.0091347, 0.0135218, 0.999299, 0.0346297, 0.0142643, 0.999835, -0.00704416, 0.0167379, 0.999299, 0.0346297, 0.0142643, 0.999993, 0.00374723, 0.000741484, 0.999814, -0.00387726, 0.018896, 1, 0, 0, 0.967412, 0, 0.253207, 0.967412, 0, 0.253207, 0.999299, -0.0346297, -0.0142643, 0.981897, 0.0090897, -0.189198, 0.981317, 0.0069261, -0.192275, 0.983294, -0.00913319, -0.181798, 0.983884, -0.00706873, -0.178666, 0.999298, -0.0346306, -0.0142647, 0.980921, 0.00374804, -0.19437, 0.984291, -0.00387327, -0.176509, 0.980784, 0, -0.195097, 0.967412, 0, 0.253207, 0.984291, 0.00387335, -0.176509, 0.967412, 0, 0.253207, 0.980921, -0.00374807, -0.19437, 0.983885, 0.00706916, -0.178665, 0.999298, 0.0346315, -0.0142651, 0.981317, -0.00692511, -0.192276, 0.983294, 0.00913279, -0.181798, 0.999299, 0.0346287, -0.0142639, 0.981897, -0.00908999, -0.189198, 0.997604, -0.0491193, -0.0487113, 0.982601, 0.00981622, -0.185468, 0.997604, 0.0491193, -0.0487113, 0.982602, -0.00981709, -0.185467, 0.997605, -0.0491175, -0.0487095, 0.997605, 0.0491186, -0.0487106, 0.924158, -0.00374678, -0.381993, 0.924946, -0.00693009, -0.380035, 0.930133, 0.00702958, -0.367156, 0.946614, 0.0455358, -0.319137, 0.926129, -0.00907318, -0.377098, 0.946614, 0.0455358, -0.319137, 0.927543, 0.00980318, -0.373587, 0.927543, -0.00980276, -0.373588, 0.926129, 0.00907138, -0.377099, 0.946614, -0.0455358, -0.319137, 0.924946, 0.00693023, -0.380035, 0.946614, -0.0455358, -0.319137, 0.930133, -0.00702966, -0.367156, 0.924158, 0.00374662, -0.381993, 0.930938, -0.00389548, -0.365156, 0.923876, 0, -0.382691, 0.863107, 0, -0.505021, 0.930939, 0.00389586, -0.365155, 0.863107, 0, -0.505021, 0.895021, 0.0455143, -0.443695, 0.866156, -0.0455494, -0.497694, 0.840629, -0.00705275, -0.541565, 0.838837, 0.0346117, -0.543282, 0.83189, 0.00374172, -0.554928, 0.841822, -0.00383466, -0.539742, 0.831435, 0, -0.555622, 0.863107, 0, -0.505021, 0.84182, 0.00383388, -0.539745, 0.863107, 0, -0.505021, 0.83189, -0.00374162, -0.554928, 0.840627, 0.00705151, -0.541568, 0.838837, -0.0346117, -0.543282, 0.895018, -0.0455194, -0.443702, 0.866156, 0.0455494, -0.497694, 0.838837, -0.0346117, -0.543282, 0.834756, -0.00908286, -0.550545, 0.895019, -0.0455172, -0.443699, 0.866156, 0.0455494, -0.497694, 0.856541, 0.0491229, -0.513737, 0.856541, -0.0491229, -0.513737, 0.856541, 0.0491229, -0.513737, 0.834756, 0.0090832, -0.550544, 0.895018, 0.0455194, -0.443702, 0.856541, -0.0491229, -0.513737, 0.866156, -0.0455494, -0.497694, 0.838837, 0.0346117, -0.543282, 0.822989, 0.0346503, -0.566999, 0.709104, -0.00693, -0.70507, 0.711319, -0.00907388, -0.702811, 0.802411, -0.0491122, -0.594747, 0.791257, -0.0455088, -0.609788, 0.752426, 0.0455266, -0.657102, 0.739859, 0.0491178, -0.670966, 0.802411, 0.0491122, -0.594747, 0.739859, -0.0491178, -0.670966, 0.802411, -0.0491125, -0.594748, 0.739859, 0.0491178, -0.670966, 0.711319, 0.00907511, -0.70281, 0.791254, 0.0455121, -0.609792, 0.802409, 0.0491158, -0.59475, 0.739859, -0.0491178, -0.670966, 0.752426, -0.0455266, -0.657102, 0.822989, -0.0346519, -0.566999, 0.709104, 0.00693019, -0.70507, 0.791253, 0.0455133, -0.609793, 0.752426, -0.0455266, -0.657102, 0.718818, -0.0070398, -0.695163, 0.82299, -0.0346496, -0.566999, 0.707625, 0.00374715, -0.706578, 0.72034, -0.00387753, -0.69361, 0.707107, 0, -0.707107, 0.863107, 0, -0.505021, 0.720343, 0.00387831, -0.693607, 0.863107, 0, -0.505021, 0.707625, -0.00374737, -0.706578, 0.71882, 0.00704104, -0.695161, 0.822989, 0.0346519, -0.566999, 0.791254, -0.0455121, -0.609792, 0.752426, 0.0455266, -0.657102, 0.569397, -0.00703279, -0.822033, 0.571169, -0.0039183, -0.820823, 0.55616, 0.00375221, -0.831067, 0.555624, 0, -0.831433, 0.863107, 0, -0.505021, 0.571167, 0.00391792, -0.820824, 0.863107, 0, -0.505021, 0.556159, -0.00375196, -0.831067, 0.569396, 0.00703255, -0.822033, 0.566999, -0.0346519, -0.822989, 0.657102, -0.0455266, -0.752426, 0.609792, 0.0455121, -0.791254, 0.566999, -0.0346519, -0.822989, 0.560551, -0.00906372, -0.82807, 0.670966, -0.0491178, -0.739859, 0.657098, -0.0455299, -0.752429, 0.609792, 0.0455121, -0.791254, 0.594747, 0.0491122, -0.802411, 0.670966, 0.0491178, -0.739859, 0.594747, -0.0491122, -0.802411, 0.670967, -0.0491171, -0.739859, 0.594747, 0.0491122, -0.802411, 0.560552, 0.00906497, -0.82807, 0.657102, 0.0455266, -0.752426, 0.670969, 0.0491142, -0.739857, 0.594747, -0.0491122, -0.802411, 0.609792, -0.0455121, -0.791254, 0.566999, 0.0346519, -0.822989, 0.657103, 0.0455254, -0.752425, 0.609792, -0.0455121, -0.791254, 0.566999, 0.0346519, -0.822989, 0.513737, -0.0491229, -0.856541, 0.497691, -0.0455515, -0.866158, 0.443699, 0.0455174, -0.895019, 0.391628, 0.0098896, -0.920071, 0.513737, 0.0491229, -0.856541, 0.38822, -0.00907617, -0.921522, 0.391627, -0.00988918, -0.920071, 0.513738, -0.0491212, -0.85654, 0.388219, 0.00907575, -0.921522, 0.497691, 0.0455514, -0.866157, 0.513737, 0.0491227, -0.856541, 0.443699, -0.0455174, -0.895019, 0.543282, -0.0346117, -0.838837, 0.385303, 0.00693186, -0.922764, 0.497687, 0.0455544, -0.86616, 0.443699, -0.0455174, -0.895019, 0.398071, -0.00704906, -0.917327, 0.543282, -0.0346109, -0.838837, 0.383365, 0.00374673, -0.923589, 0.400078, -0.00385631, -0.916473, 0.382689, 0, -0.923877, 0.253207, 0, -0.967412, 0.400078, 0.00385622, -0.916473, 0.253207, 0, -0.967412, 0.383365, -0.00374689, -0.923589, 0.398071, 0.00704883, -0.917328, 0.543282, 0.0346117, -0.838837, 0.385304, -0.00693217, -0.922764, 0.497691, -0.0455514, -0.866157, 0.443699, 0.0455174, -0.895019, 0.543282, 0.0346102, -0.838836, 0.19582, 0.00374591, -0.980633, 0.195096, 0, -0.980784, 0.253207, 0, -0.967412, 0.213587, 0.00388215, -0.976916, 0.253207, 0, -0.967412, 0.213585, -0.00388163, -0.976917, 0.19582, -0.00374584, -0.980633, 0.211481, 0.00701017, -0.977357, 0.19787, -0.00693604, -0.980204, 0.319139, -0.0455345, -0.946613, 0.208327, 0.00913729, -0.978017, 0.201006, -0.00905864, -0.979548, 0.319142, -0.045532, -0.946612, 0.20462, 0.00987766, -0.978792, 0.20462, -0.00987788, -0.978792, 0.201006, 0.00905854, -0.979548, 0.319139, 0.0455345, -0.946613, 0.208327, -0.00913701, -0.978017, 0.19787, 0.00693642, -0.980204, 0.319139, 0.045534, -0.946613, 0.211479, -0.00700913, -0.977357, 0.00601925, -0.00907283, -0.999941, 0.0487113, -0.0491193, -0.997604, 0.0487113, 0.0491193, -0.997604, 0.00601931, 0.00907292, -0.999941, 0.0487113, -0.0491193, -0.997604, 0.0135236, -0.00913591, -0.999867, 0.0142643, 0.0346297, -0.999299, 0.0167334, -0.00704229, -0.999835, 0.0142643, 0.0346297, -0.999299, 0.00074145, 0.00374705, -0.999993, 0.018896, -0.00387726, -0.999814, 0, 0, -1, 0.253207, 0, -0.967412, 0.0188935, 0.00387675, -0.999814, 0.253207, 0, -0.967412, 0.000741457, -0.0037471, -0.999993, 0.016731, 0.00704125, -0.999835, 0.0142643, -0.0346297, -0.999299, 0.0135232, 0.00913563, -0.999867, 0.0142643, -0.0346297, -0.999299, 0.0487113, 0.0491193, -0.997604, 0.0188935, 0.00387675, -0.999814, 0.253207, 0, -0.967412, -0.176509, 0.00387335, -0.984291, 0.253207, 0, -0.967412, 0.018896, -0.00387726, -0.999814, -0.176509, -0.00387327, -0.984291, 0.000741457, -0.0037471, -0.999993, 0, 0, -1, -0.195097, 0, -0.980784, -0.19437, -0.00374807, -0.980921, 0.016731, 0.00704125, -0.999835, -0.178659, 0.00707177, -0.983886, -0.0142643, 0.0346297, -0.999299, -0.192275, -0.00692567, -0.981317, 0.0135232, 0.00913563, -0.999867, -0.181798, 0.00913254, -0.983293, 0.00601925, -0.00907283, -0.999941, -0.0142639, 0.0346287, -0.999298, -0.189199, -0.00908927, -0.981897, -0.0487113, -0.0491193, -0.997604, -0.185468, 0.00981623, -0.982601, -0.0487113, 0.0491193, -0.997604, -0.185467, -0.00981683, -0.982601, 0.00601931, 0.00907292, -0.999941, -0.0487095, -0.0491175, -0.997605, -0.189198, 0.0090897, -0.981897, 0.0135236, -0.00913591, -0.999867, -0.0487106, 0.0491186, -0.997605, -0.181798, -0.00913258, -0.983293, -0.0142643, -0.0346297, -0.999299, -0.192275, 0.0069261, -0.981317, 0.0167334, -0.00704229, -0.999835, -0.17866, -0.00707126, -0.983885, 0.00074145, 0.00374705, -0.999993, -0.0142647, -0.0346306, -0.999298, -0.19437, 0.00374798, -0.980921, -0.373588, 0.0098029, -0.927543, -0.377099, 0.00907066, -0.926129, -0.373588, -0.00980239, -0.927543, -0.319139, -0.0455345, -0.946613, -0.380035, 0.00692988, -0.924946, -0.319139, -0.0455345, -0.946613, -0.36716, -0.00702798, -0.930131, -0.381993, 0.0037468, -0.924158, -0.365156, -0.00389548, -0.930938, -0.382691, 0, -0.923876, -0.42723, 0, -0.904143, -0.365158, 0.00389514, -0.930937, -0.42723, 0, -0.904143, -0.381993, -0.00374659, -0.924158, -0.36716, 0.00702801, -0.930131, -0.380035, -0.00692975, -0.924946, -0.319139, 0.0455345, -0.946613, -0.377099, -0.00907103, -0.926129, -0.319139, 0.0455345, -0.946614, -0.555622, 0, -0.831435, -0.554928, -0.00374163, -0.83189, -0.539742, 0.00383461, -0.841822, -0.541572, 0.00704945, -0.840625, -0.543282, -0.03461, -0.838836, -0.443704, -0.045521, -0.895017, -0.497696, 0.0455477, -0.866155, -0.543282, -0.03461, -0.838836, -0.550544, -0.00908286, -0.834756, -0.443699, -0.0455172, -0.895019, -0.497696, 0.0455477, -0.866155, -0.513737, 0.0491229, -0.856541, -0.513737, -0.0491229, -0.856541, -0.513737, 0.0491229, -0.856541, -0.550545, 0.00908271, -0.834756, -0.443704, 0.045521, -0.895017, -0.513737, -0.0491229, -0.856541, -0.497696, -0.0455477, -0.866155, -0.543282, 0.03461, -0.838836, -0.443703, 0.0455198, -0.895017, -0.497696, -0.0455477, -0.866155, -0.541568, -0.00705153, -0.840627, -0.543282, 0.03461, -0.838836, -0.554928, 0.00374156, -0.83189, -0.539742, -0.00383466, -0.841822, -0.42723, 0, -0.904143, -0.42723, 0, -0.904143, -0.609788, 0.0455089, -0.791257, -0.594747, 0.0491123, -0.802411, -0.670966, -0.0491178, -0.739859, -0.657098, -0.0455299, -0.752429, -0.566999, -0.0346504, -0.822989, -0.702811, 0.00907445, -0.711319, -0.70507, 0.00693104, -0.709104, -0.609783, 0.0455046, -0.791261, -0.657098, -0.0455299, -0.752429, -0.695158, -0.00704252, -0.718822, -0.566999, -0.034651, -0.822989, -0.706578, 0.00374681, -0.707625, -0.69361, -0.00387753, -0.72034, -0.707107, 0, -0.707107, -0.42723, 0, -0.904143, -0.69361, 0.00387757, -0.720341, -0.42723, 0, -0.904143, -0.706578, -0.00374703, -0.707625, -0.695157, 0.00704325, -0.718823, -0.566999, 0.0346504, -0.822989, -0.70507, -0.00693127, -0.709104, -0.609788, -0.0455089, -0.791257, -0.657098, 0.0455299, -0.752429, -0.566999, 0.0346503, -0.822989, -0.702811, -0.00907378, -0.711319, -0.594747, -0.0491122, -0.802411, -0.609788, -0.0455088, -0.791257, -0.657098, 0.0455299, -0.752429, -0.670966, 0.0491178, -0.739859, -0.594747, 0.0491122, -0.802411, -0.670966, -0.0491178, -0.739859, -0.594748, -0.0491129, -0.802411, -0.670966, 0.0491178, -0.739859, -0.831067, -0.00375234, -0.55616, -0.822989, -0.0346519, -0.566999, -0.752429, -0.0455299, -0.657098, -0.822037, 0.00702936, -0.56939, -0.791257, 0.0455089, -0.609788, -0.822989, -0.0346519, -0.566999, -0.82807, -0.00906568, -0.560552, -0.739861, -0.0491206, -0.670964, -0.752431, -0.0455326, -0.657095, -0.791257, 0.0455089, -0.609788, -0.802413, 0.0491093, -0.594745, -0.739861, 0.0491206, -0.670964, -0.802413, -0.0491093, -0.594745, -0.739859, -0.0491171, -0.670967, -0.802413, 0.0491093, -0.594745, -0.82807, 0.00906545, -0.560552, -0.752429, 0.0455299, -0.657098, -0.739859, 0.0491177, -0.670966, -0.802413, -0.0491093, -0.594745, -0.791257, -0.0455089, -0.609788, -0.822989, 0.0346504, -0.566999, -0.752433, 0.0455341, -0.657093, -0.791257, -0.0455089, -0.609788, -0.822037, -0.00702957, -0.56939, -0.822989, 0.0346504, -0.566999, -0.831067, 0.00375259, -0.55616, -0.820823, -0.0039183, -0.571169, -0.831433, 0, -0.555624, -0.999929, 0, 0.0119371, -0.820823, 0.00391839, -0.571169, -0.999929, 0, 0.0119371, -0.866156, 0.0455489, -0.497694, -0.895019, -0.0455175, -0.443699, -0.917325, -0.00705191, -0.398078, -0.838837, -0.0346109, -0.543282, -0.922764, 0.00693281, -0.385304, -0.923589, 0.00374667, -0.383365, -0.916473, -0.00385631, -0.400078, -0.923877, 0, -0.382689, -0.999929, 0, 0.0119371, -0.916473, 0.00385638, -0.400078, -0.999929, 0, 0.0119371, -0.923589, -0.00374683, -0.383365, -0.917324, 0.00705227, -0.398078, -0.838837, 0.0346117, -0.543282, -0.922764, -0.0069323, -0.385304, -0.866157, -0.0455513, -0.497691, -0.895019, 0.0455175, -0.443699, -0.838836, 0.0346103, -0.543282, -0.921522, -0.00907632, -0.38822, -0.856539, -0.0491196, -0.513739, -0.866156, -0.0455486, -0.497695, -0.895019, 0.0455175, -0.443699, -0.92007, 0.00989172, -0.391629, -0.856539, 0.0491196, -0.513739, -0.92007, -0.00989196, -0.39163, -0.85654, -0.0491213, -0.513738, -0.921522, 0.0090759, -0.388219, -0.866157, 0.0455513, -0.497691, -0.856541, 0.0491226, -0.513737, -0.895019, -0.0455175, -0.443699, -0.838836, -0.03461, -0.543282, -0.946612, -0.0455307, -0.319144, -0.977356, 0.00701099, -0.211483, -0.978016, 0.00913963, -0.208331, -0.980204, -0.00693648, -0.197871, -0.979548, -0.00905971, -0.201006, -0.946612, -0.045532, -0.319142, -0.978792, 0.00987828, -0.204621, -0.978792, -0.00987788, -0.20462, -0.979548, 0.0090601, -0.201007, -0.946612, 0.0455307, -0.319144, -0.978016, -0.00913936, -0.20833, -0.980204, 0.00693683, -0.197871, -0.946612, 0.0455322, -0.319142, -0.977357, -0.00700996, -0.211481, -0.980633, 0.00374574, -0.19582, -0.976917, -0.00388163, -0.213585, -0.980784, 0, -0.195096, -0.999929, 0, 0.0119371, -0.976916, 0.00388215, -0.213587, -0.999929, 0, 0.0119371, -0.980633, -0.00374569, -0.19582, -0.999298, 0.0346315, -0.0142651, -0.999929, 0, 0.0119371, -0.999929, 0, 0.0119371, -0.999299, -0.0346297, -0.0142643, -0.999299, -0.0346297, -0.0142643, -0.997604, 0.0491193, -0.0487113, -0.997604, -0.0491193, -0.0487113, -0.997604, 0.0491193, -0.0487113, -0.997604, -0.0491193, -0.0487113, -0.999298, 0.0346315, -0.0142651
-};
-
-float mBitangents[] = {
--0.0346637, 0.387667, 0.921147, -0.030374, 0.559554, 0.828237, 0.131794, 0.559522, 0.81827, 0.111306, 0.386929, 0.915367, 0.0113766, 0.980957, -0.193892, 0, 0.924775, -0.380515, -0.0560911, 0.924621, -0.376735, -0.0154917, 0.980768, -0.194559, -0.0376905, 0.200855, 0.978896, 0.116528, 0.200387, 0.972762, 0.00384276, 0.999993, 0, 0.00753463, 0.999971, -0.00149815, -0.0196645, 0.20096, -0.979402, -0.0119388, 0, -0.999929, -0.171788, 0.200921, -0.964427, 0.0119388, 0, 0.999929, -0.00384167, 0.981013, 0.193902, 0.030289, 0.980993, 0.191663, 0.0376206, 0.387626, -0.921049, -0.105406, 0.38676, -0.916137, 0, 0.924775, 0.380515, 0.0518728, 0.924539, 0.37754, 0.0346456, 0.559476, -0.828122, -0.0932281, 0.558432, -0.824295, -0.0185023, 0.833167, 0.552711, 0, 0.924764, 0.380542, 0.071466, 0.832743, 0.549028, 0, 0.71014, -0.70406, -0.0775179, 0.708858, -0.701079, 0, 0.71016, 0.704041, 0.088277, 0.709288, 0.699369, 0.0248872, 0.833051, -0.552636, 0, 0.71016, -0.704041, -0.0588627, 0.83228, -0.551221, 0, 0.71014, 0.70406, 0, 0.924764, -0.380542, 0.246321, 0.709946, 0.659775, 0.173403, 0.553293, 0.814738, -0.188485, 0.833061, -0.520079, -0.111343, 0.924151, -0.365443, 0.317117, 0.559738, 0.765592, 0.28775, 0.386896, 0.876077, -0.0531581, 0.980765, -0.187815, 0.304071, 0.200328, 0.931348, 0.00710091, 0.99997, -0.00294032, -0.0119388, 0, -0.999929, -0.356641, 0.200863, -0.912393, 0.0119388, 0, 0.999929, 0.0671008, 0.980991, 0.182084, -0.282118, 0.386726, -0.877982, 0.124527, 0.924543, 0.360158, -0.152686, 0.551316, -0.820206, 0.177199, 0.832748, 0.524529, -0.317111, 0.559762, -0.765576, -0.212803, 0.708856, -0.672486, -0.544239, 0.200941, -0.81451, -0.44797, 0.386775, -0.806057, 0.10453, 0.981014, 0.163356, 0.163724, 0.923277, 0.347496, -0.317117, 0.559738, -0.765592, -0.309757, 0.551344, -0.774643, 0.211418, 0.924766, 0.316401, 0.276119, 0.832754, 0.479874, -0.317111, 0.559762, -0.765576, -0.460371, 0.559785, -0.688984, -0.260728, 0.701933, -0.662805, 0.284662, 0.704632, 0.649971, -0.391149, 0.710149, -0.585398, -0.265315, 0.832292, -0.486721, 0.317111, 0.559762, 0.765576, 0.391167, 0.710123, 0.585417, 0.329009, 0.553314, 0.765243, -0.133719, 0.920816, -0.366356, 0.317117, 0.559738, 0.765592, 0.460368, 0.559768, 0.689, 0.453126, 0.386943, 0.803089, -0.211398, 0.924776, -0.316387, -0.0887729, 0.980767, -0.173826, 0.47992, 0.200371, 0.854125, 0.00638986, 0.99997, -0.00427204, -0.0119388, 0, -0.999929, 0.0119388, 0, 0.999929, -0.211418, 0.924766, -0.316401, -0.373144, 0.83308, -0.40834, -0.242728, 0.924144, -0.295027, 0.460368, 0.559768, 0.689, 0.585947, 0.559766, 0.585942, 0.601082, 0.386981, 0.699247, -0.211398, 0.924776, -0.316387, -0.120975, 0.980768, -0.153164, 0.637328, 0.200386, 0.744082, 0.00543339, 0.99997, -0.00543391, -0.0119388, 0, -0.999929, -0.678642, 0.200921, -0.706453, 0.0119388, 0, 0.999929, 0.131666, 0.980993, 0.142538, -0.596607, 0.386814, -0.703161, 0.211398, 0.924776, 0.316387, 0.252885, 0.924538, 0.285096, -0.460368, 0.559768, -0.689, -0.454929, 0.551345, -0.699327, 0.211418, 0.924766, 0.316401, 0.364421, 0.832766, 0.416771, -0.391167, 0.710123, -0.585417, -0.460371, 0.559785, -0.688984, -0.585933, 0.559784, -0.585939, -0.385027, 0.701937, -0.599199, 0.391149, 0.710149, 0.585398, 0.405992, 0.704634, 0.581947, -0.391149, 0.710149, -0.585398, -0.497838, 0.71015, -0.497838, 0.460371, 0.559785, 0.688984, 0.391167, 0.710123, 0.585417, 0.497853, 0.710126, 0.497858, 0.471979, 0.553316, 0.68635, 0.159086, 0.981014, 0.110921, 0.28425, 0.923276, 0.258388, -0.585947, 0.559766, -0.585942, -0.74493, 0.387605, -0.542993, -0.582622, 0.551351, -0.597129, 0.316401, 0.924766, 0.211418, 0.438741, 0.832755, 0.337678, -0.497853, 0.710126, -0.497858, -0.585933, 0.559784, -0.585939, -0.688986, 0.559785, -0.460368, -0.494524, 0.701934, -0.512576, 0.497838, 0.71015, 0.497838, 0.511724, 0.704632, 0.49156, -0.497838, 0.71015, -0.497838, -0.585396, 0.710149, -0.391153, -0.431379, 0.832293, -0.348139, 0.585933, 0.559784, 0.585939, 0.497853, 0.710126, 0.497858, 0.58542, 0.710123, 0.391163, 0.596802, 0.55332, 0.581089, -0.263742, 0.920812, -0.287307, 0.585947, 0.559766, 0.585942, 0.689, 0.559768, 0.460368, 0.725962, 0.386944, 0.568554, -0.316387, 0.924776, -0.211398, -0.148536, 0.980767, -0.126624, 0.770248, 0.200364, 0.605452, 0.00426817, 0.99997, -0.00638971, -0.935483, 0, -0.353372, -0.803428, 0.200901, -0.560484, 0.935483, 0, 0.353372, 0.689, 0.559768, 0.460368, 0.765593, 0.559738, 0.317114, 0.822952, 0.386894, 0.416008, -0.316387, 0.924776, -0.211398, -0.344399, 0.924625, -0.162661, -0.170394, 0.980765, -0.0952165, 0.873571, 0.200331, 0.443555, 0.00294153, 0.999971, -0.00709884, -0.935483, 0, -0.353372, -0.897343, 0.200864, -0.392975, 0.935483, 0, 0.353372, 0.176201, 0.980991, 0.0813042, -0.820315, 0.386725, -0.42134, 0.316387, 0.924776, 0.211398, 0.342725, 0.924543, 0.166615, -0.688997, 0.559768, -0.460372, -0.687939, 0.551319, -0.472005, 0.316401, 0.924766, 0.211418, 0.496197, 0.832748, 0.245599, -0.58542, 0.710123, -0.391163, -0.688986, 0.559785, -0.460368, -0.765575, 0.559762, -0.317116, -0.625997, 0.708851, -0.32505, 0.585396, 0.710149, 0.391153, 0.630553, 0.709282, 0.315153, -0.585396, 0.710149, -0.391153, -0.491019, 0.832286, -0.257296, 0.688986, 0.559785, 0.460368, 0.58542, 0.710123, 0.391163, 0.698718, 0.553295, 0.453495, -0.316401, 0.924766, -0.211418, -0.765593, 0.559738, -0.317114, -0.896026, 0.387593, -0.216587, -0.797226, 0.558431, -0.229313, 0.370949, 0.924719, 0.0853961, 0.534583, 0.832744, 0.144077, -0.765575, 0.559762, -0.317116, -0.67738, 0.708854, -0.196679, 0.679918, 0.709285, 0.186082, -0.531786, 0.832282, -0.156559, 0.765575, 0.559762, 0.317116, 0.799351, 0.558747, 0.220996, -0.365725, 0.924146, -0.110451, 0.765593, 0.559738, 0.317114, 0.888282, 0.386933, 0.247463, -0.185678, 0.980769, -0.0601405, 0.943308, 0.200386, 0.264603, 0.00149991, 0.99997, -0.00753713, -0.935483, 0, -0.353372, -0.956754, 0.200921, -0.210361, 0.935483, 0, 0.353372, 0.188664, 0.980993, 0.0453649, -0.380515, 0.924775, 0, -0.193855, 0.980766, -0.0227622, 0.921147, 0.387667, 0.0346637, 0.976797, 0.200425, 0.0754887, 0, 0.99997, -0.00768358, -0.935483, 0, -0.353372, -0.979402, 0.20096, -0.0196645, 0.935483, 0, 0.353372, 0.193898, 0.980992, 0.00768549, -0.919081, 0.386798, -0.0753489, 0.379897, 0.923276, 0.0569232, -0.826623, 0.558463, -0.0693751, 0.380542, 0.924764, 0, 0.552427, 0.832739, 0.0370172, -0.695938, 0.70195, -0.151449, 0.698569, 0.704643, 0.124418, -0.704041, 0.71016, 0, -0.552121, 0.832275, -0.0498053, 0.70406, 0.71014, 0, 0.827085, 0.558778, 0.0608045, -0.378915, 0.920812, -0.0923549, 0.380542, 0.924764, 0, 0.375391, 0.924719, -0.0630594, 0.549028, 0.832743, -0.0714655, -0.70406, 0.71014, 0, -0.818988, 0.559447, 0.127583, -0.701079, 0.708858, 0.0775179, 0.704041, 0.71016, 0, 0.699369, 0.709288, -0.0882772, -0.704041, 0.71016, 0, -0.551221, 0.83228, 0.058863, 0.70406, 0.71014, 0, 0.823075, 0.558748, -0.101725, -0.380542, 0.924764, 0, -0.380153, 0.924146, 0.0379123, 0.915367, 0.386929, -0.111306, -0.380515, 0.924775, 0, -0.194559, 0.980768, 0.0154914, 0.972762, 0.200387, -0.116528, -0.00149863, 0.99997, -0.007537, -0.935483, 0, -0.353372, -0.964427, 0.200921, 0.171788, 0.935483, 0, 0.353372, 0.191664, 0.980993, -0.0302867, -0.916137, 0.38676, 0.105406, 0.380515, 0.924775, 0, 0.864323, 0.387595, -0.320494, 0.931348, 0.200328, -0.30407, -0.18349, 0.980956, 0.0636869, -0.00294032, 0.99997, -0.00710091, -0.863108, 0, 0.505019, -0.912393, 0.200863, 0.356641, 0.863108, 0, -0.505019, 0.182085, 0.980991, -0.0670991, -0.877982, 0.386726, 0.282118, 0.360157, 0.924543, -0.124528, -0.820206, 0.551316, 0.152686, 0.524529, 0.832748, -0.1772, -0.765576, 0.559762, 0.317111, -0.672486, 0.708856, 0.212803, 0.668711, 0.709287, -0.22302, -0.529138, 0.832286, 0.165267, 0.814738, 0.553294, -0.173403, -0.365443, 0.924151, 0.111343, 0.765591, 0.559738, -0.317119, 0.46982, 0.833184, -0.291673, 0.649971, 0.704632, -0.284662, -0.585394, 0.710149, 0.391155, -0.486721, 0.832292, 0.265315, 0.765576, 0.559762, -0.317111, 0.58542, 0.710123, -0.391163, 0.765243, 0.553314, -0.329009, -0.366356, 0.920816, 0.133719, 0.765591, 0.559738, -0.317119, 0.689, 0.559768, -0.460368, 0.803089, 0.386943, -0.453127, -0.316387, 0.924776, 0.211398, -0.173826, 0.980767, 0.0887729, 0.854125, 0.200371, -0.479919, -0.00427204, 0.99997, -0.00638986, -0.863108, 0, 0.505019, -0.825277, 0.200903, 0.527784, 0.863108, 0, -0.505019, 0.165488, 0.980992, -0.101331, -0.806057, 0.386775, 0.44797, 0.347498, 0.923277, -0.16372, -0.765592, 0.559738, 0.317117, -0.774643, 0.551344, 0.309757, 0.316401, 0.924766, -0.211418, -0.765576, 0.559762, 0.317111, -0.688986, 0.559785, 0.460368, -0.662805, 0.701933, 0.260728, -0.863108, 0, 0.505019, -0.706453, 0.200921, 0.678642, 0.863108, 0, -0.505019, 0.732125, 0.200628, -0.650954, -0.00271755, 0.999993, -0.0027181, 0.142537, 0.980993, -0.131666, -0.703162, 0.386814, 0.596606, 0.316387, 0.924776, -0.211398, 0.285096, 0.924538, -0.252885, -0.689, 0.559768, 0.460368, -0.699327, 0.551345, 0.454929, 0.316401, 0.924766, -0.211418, 0.416771, 0.832766, -0.36442, -0.58542, 0.710123, 0.391163, -0.688986, 0.559785, 0.460368, -0.585936, 0.559784, 0.585936, -0.599201, 0.701936, 0.385024, 0.585396, 0.710149, -0.391153, 0.581944, 0.704634, -0.405995, -0.585394, 0.710149, 0.391155, -0.497838, 0.71015, 0.497838, -0.425591, 0.832306, 0.355159, 0.688986, 0.559785, -0.460368, 0.58542, 0.710123, -0.391163, 0.497856, 0.710126, -0.497856, 0.686353, 0.553316, -0.471976, -0.316403, 0.924766, 0.211415, -0.295028, 0.924144, 0.242727, 0.689, 0.559768, -0.460368, 0.585944, 0.559766, -0.585944, 0.699247, 0.386981, -0.601082, -0.316387, 0.924776, 0.211398, -0.153163, 0.980768, 0.120976, -0.497838, 0.71015, 0.497838, -0.391153, 0.710149, 0.585396, -0.348139, 0.832293, 0.431379, 0.585936, 0.559784, -0.585936, 0.497856, 0.710126, -0.497856, 0.391163, 0.710123, -0.58542, 0.581086, 0.55332, -0.596804, -0.287307, 0.920812, 0.263742, 0.585944, 0.559766, -0.585944, 0.460368, 0.559768, -0.689, 0.568555, 0.386944, -0.725961, -0.211398, 0.924776, 0.316387, -0.126625, 0.980767, 0.148535, 0.605452, 0.200364, -0.770248, -0.0063878, 0.99997, -0.00426689, -0.863108, 0, 0.505019, -0.560485, 0.200901, 0.803427, 0.863108, 0, -0.505019, 0.114112, 0.980992, -0.156949, -0.573268, 0.386776, 0.722335, 0.258388, 0.923276, -0.28425, -0.585944, 0.559766, 0.585944, -0.597131, 0.551351, 0.58262, 0.211418, 0.924766, -0.316401, 0.337678, 0.832755, -0.438741, -0.497856, 0.710126, 0.497856, -0.585936, 0.559784, 0.585936, -0.460368, 0.559785, 0.688986, -0.512574, 0.701934, 0.494526, 0.497838, 0.71015, -0.497838, 0.49156, 0.704632, -0.511724, -0.00355068, 0.999993, -0.00146967, 0.0813049, 0.980991, -0.1762, -0.374881, 0.200903, 0.905043, -0.421341, 0.386725, 0.820314, 0.211398, 0.924776, -0.316387, 0.166615, 0.924543, -0.342725, -0.460368, 0.559768, 0.689, -0.472001, 0.551319, 0.687941, 0.211418, 0.924766, -0.316401, 0.245599, 0.832748, -0.496197, -0.391163, 0.710123, 0.58542, -0.460368, 0.559785, 0.688986, -0.317116, 0.559762, 0.765575, -0.32505, 0.708851, 0.625997, 0.391153, 0.710149, -0.585396, 0.315153, 0.709282, -0.630553, -0.391153, 0.710149, 0.585396, -0.257296, 0.832286, 0.491019, 0.460368, 0.559785, -0.688986, 0.391163, 0.710123, -0.58542, 0.453495, 0.553295, -0.698718, -0.211418, 0.924766, 0.316401, -0.179675, 0.92415, 0.337139, 0.460368, 0.559768, -0.689, 0.317114, 0.559738, -0.765593, 0.416008, 0.386894, -0.822952, -0.211398, 0.924776, 0.316387, -0.0952165, 0.980765, 0.170394, 0.443555, 0.200331, -0.873571, -0.253206, 0, 0.967412, 0.253206, 0, -0.967412, 0.317116, 0.559762, -0.765575, 0.161746, 0.709946, -0.68543, 0.220996, 0.558748, -0.799351, -0.132221, 0.833057, 0.537153, -0.110452, 0.924146, 0.365725, 0.317114, 0.559738, -0.765593, 0.247463, 0.386933, -0.888282, -0.0601403, 0.980769, 0.185678, 0.264603, 0.200386, -0.943308, -0.00753733, 0.99997, -0.00149995, -0.253206, 0, 0.967412, -0.210361, 0.200921, 0.956754, 0.253206, 0, -0.967412, 0.0453647, 0.980993, -0.188664, -0.253205, 0.386765, 0.886736, 0.0965534, 0.924539, -0.368653, -0.317114, 0.559738, 0.765593, -0.229313, 0.558431, 0.797226, 0.144077, 0.832744, -0.534583, -0.317116, 0.559762, 0.765575, -0.196679, 0.708854, 0.67738, 0, 0.200998, 0.979592, -0.0753489, 0.386798, 0.919081, 0.00384269, 0.981013, -0.193903, 0.0569232, 0.923276, -0.379897, -0.0693751, 0.558463, 0.826623, 0, 0.924764, -0.380542, 0.0370173, 0.832739, -0.552427, -0.151449, 0.70195, 0.695938, 0.124418, 0.704643, -0.698569, 0, 0.71016, 0.704041, -0.0498053, 0.832275, 0.552121, 0, 0.71014, -0.70406, 0.0608045, 0.558778, -0.827085, -0.0923549, 0.920812, 0.378915, 0.0694114, 0.386965, -0.919478, 0, 0.924775, 0.380515, -0.0227622, 0.980766, 0.193855, 0.0754887, 0.200425, -0.976797, -0.00768358, 0.99997, 0, -0.253206, 0, 0.967412, 0.253206, 0, -0.967412, 0, 0.924764, 0.380542, 0.0834034, 0.833056, 0.546865, 0.0379127, 0.924146, 0.380153, -0.131794, 0.559522, -0.81827, -0.111306, 0.386929, -0.915367, 0, 0.924775, 0.380515, 0.0154912, 0.980768, 0.194559, -0.116528, 0.200387, -0.972762, -0.0075364, 0.99997, 0.00149851, -0.253206, 0, 0.967412, 0.171788, 0.200921, 0.964427, 0.253206, 0, -0.967412, -0.0302873, 0.980993, -0.191664, 0.105406, 0.38676, 0.916137, 0, 0.924775, -0.380515, -0.0518734, 0.924539, -0.37754, 0.0932282, 0.558432, 0.824295, 0, 0.924764, -0.380542, -0.0714655, 0.832743, -0.549028, 0, 0.71014, 0.70406, 0.0775179, 0.708858, 0.701079, 0, 0.71016, -0.704041, -0.0882772, 0.709288, -0.699369, 0, 0.71016, 0.704041, 0, 0.71014, -0.70406, -0.070655, 0.981012, -0.18062, -0.124528, 0.924543, -0.360158, 0.317726, 0.387556, 0.865362, 0.152686, 0.551316, 0.820206, -0.177199, 0.832748, -0.524529, 0.317111, 0.559762, 0.765576, 0.212802, 0.708856, 0.672486, -0.22302, 0.709287, -0.668711, 0.165267, 0.832286, 0.529138, -0.173403, 0.553293, -0.814738, 0.111344, 0.924151, 0.365443, -0.317117, 0.559738, -0.765592, -0.28775, 0.386896, -0.876077, 0.0531588, 0.980765, 0.187815, -0.304071, 0.200328, -0.931348, -0.00710165, 0.99997, 0.00294062, 0.505019, 0, 0.863108, 0.356641, 0.200863, 0.912393, -0.505019, 0, -0.863108, -0.317117, 0.559738, -0.765592, -0.460368, 0.559768, -0.689, -0.453126, 0.386943, -0.803089, 0.211398, 0.924776, 0.316387, 0.0887729, 0.980767, 0.173826, -0.479919, 0.200371, -0.854125, -0.00638986, 0.99997, 0.00427204, 0.505019, 0, 0.863108, 0.527784, 0.200903, 0.825277, -0.505019, 0, -0.863108, -0.101331, 0.980992, -0.165488, 0.44797, 0.386775, 0.806057, -0.163724, 0.923277, -0.347496, 0.317117, 0.559738, 0.765592, 0.309757, 0.551344, 0.774643, -0.211418, 0.924766, -0.316401, -0.276121, 0.832754, -0.479873, 0.317111, 0.559762, 0.765576, 0.460368, 0.559785, 0.688986, 0.260728, 0.701933, 0.662805, -0.284662, 0.704632, -0.649971, 0.391155, 0.710149, 0.585394, 0.265315, 0.832292, 0.486721, -0.317111, 0.559762, -0.765576, -0.391163, 0.710123, -0.58542, -0.329009, 0.553314, -0.765243, 0.13372, 0.920817, 0.366355, -0.211418, 0.924766, -0.316401, -0.260992, 0.924717, -0.277096, -0.36442, 0.832766, -0.416771, 0.391163, 0.710123, 0.58542, 0.460368, 0.559785, 0.688986, 0.585936, 0.559784, 0.585936, 0.385024, 0.701936, 0.599201, -0.391153, 0.710149, -0.585396, -0.405995, 0.704634, -0.581944, 0.391155, 0.710149, 0.585394, 0.497836, 0.71015, 0.497841, 0.35516, 0.832306, 0.425591, -0.460368, 0.559785, -0.688986, -0.391163, 0.710123, -0.58542, -0.497856, 0.710126, -0.497856, -0.471976, 0.553316, -0.686353, 0.211415, 0.924766, 0.316403, 0.242728, 0.924144, 0.295027, -0.460368, 0.559768, -0.689, -0.585944, 0.559766, -0.585944, -0.601082, 0.386981, -0.699247, 0.211398, 0.924776, 0.316387, 0.120975, 0.980768, 0.153164, -0.637328, 0.200386, -0.744082, -0.00543339, 0.99997, 0.00543391, 0.505019, 0, 0.863108, 0.678642, 0.200921, 0.706453, -0.505019, 0, -0.863108, -0.131667, 0.980993, -0.142537, 0.596606, 0.386814, 0.703162, -0.211398, 0.924776, -0.316387, 0.460368, 0.559768, 0.689, 0.454929, 0.551345, 0.699327, -0.746655, 0.387645, -0.540591, -0.770248, 0.200364, -0.605452, 0.154892, 0.980958, 0.117178, -0.00426802, 0.99997, 0.00638948, 0.505019, 0, 0.863108, 0.803427, 0.200901, 0.560485, -0.505019, 0, -0.863108, -0.156948, 0.980992, -0.114113, 0.722335, 0.386776, 0.573268, -0.284252, 0.923276, -0.258385, 0.585944, 0.559766, 0.585944, 0.58262, 0.551351, 0.597131, -0.316403, 0.924766, -0.211415, -0.43874, 0.832755, -0.337679, 0.497856, 0.710126, 0.497856, 0.585936, 0.559784, 0.585936, 0.688986, 0.559785, 0.460368, 0.494526, 0.701934, 0.512574, -0.497838, 0.71015, -0.497838, -0.511724, 0.704632, -0.49156, 0.497836, 0.71015, 0.497841, 0.585394, 0.710149, 0.391155, 0.431378, 0.832293, 0.348139, -0.585936, 0.559784, -0.585936, -0.497856, 0.710126, -0.497856, -0.58542, 0.710123, -0.391163, -0.596804, 0.55332, -0.581086, 0.263743, 0.920812, 0.287305, -0.585944, 0.559766, -0.585944, -0.689, 0.559768, -0.460368, 0.316387, 0.924776, 0.211398, 0.58542, 0.710123, 0.391163, 0.688986, 0.559785, 0.460368, 0.765575, 0.559762, 0.317116, 0.625997, 0.708851, 0.325051, -0.585394, 0.710149, -0.391155, -0.503544, 0.833177, -0.228602, -0.630552, 0.709282, -0.315155, 0.585394, 0.710149, 0.391155, 0.491019, 0.832286, 0.257296, -0.688986, 0.559785, -0.460368, -0.58542, 0.710123, -0.391163, -0.698718, 0.553295, -0.453495, 0.316403, 0.924766, 0.211415, 0.33714, 0.924151, 0.179674, -0.689, 0.559768, -0.460368, -0.765594, 0.559738, -0.317113, -0.822952, 0.386894, -0.416008, 0.316387, 0.924776, 0.211398, 0.170394, 0.980765, 0.0952165, -0.873571, 0.200331, -0.443555, -0.0029411, 0.999971, 0.0070978, 0.967412, 0, 0.253206, 0.897343, 0.200864, 0.392976, -0.967412, 0, -0.253206, -0.176201, 0.980991, -0.0813031, 0.820315, 0.386725, 0.421341, -0.316387, 0.924776, -0.211398, -0.342725, 0.924543, -0.166614, 0.689, 0.559768, 0.460368, 0.687941, 0.551319, 0.472001, -0.316403, 0.924766, -0.211415, 0.187937, 0.980959, 0.0489844, -0.00149991, 0.99997, 0.00753713, 0.967412, 0, 0.253206, 0.956754, 0.200921, 0.210361, -0.967412, 0, -0.253206, -0.947995, 0.200629, -0.247091, -0.188664, 0.980993, -0.0453649, 0.886735, 0.386765, 0.253206, -0.368653, 0.924539, -0.0965534, 0.765594, 0.559738, 0.317113, 0.797227, 0.558431, 0.229312, -0.534583, 0.832744, -0.144077, 0.765575, 0.559762, 0.317116, 0.67738, 0.708854, 0.196679, -0.679918, 0.709285, -0.186082, 0.531786, 0.832282, 0.15656, -0.765575, 0.559762, -0.317116, -0.799351, 0.558747, -0.220996, 0.365725, 0.924146, 0.110451, -0.765594, 0.559738, -0.317113, -0.888282, 0.386933, -0.247462, -0.552712, 0.833167, -0.0185023, -0.698569, 0.704643, -0.124418, 0.704041, 0.71016, 0, 0.552121, 0.832275, 0.0498053, -0.70406, 0.71014, 0, -0.827085, 0.558778, -0.0608045, 0.378915, 0.920812, 0.0923549, -0.919478, 0.386965, -0.0694114, 0.380515, 0.924775, 0, 0.193855, 0.980766, 0.0227622, -0.976797, 0.200425, -0.0754887, 0, 0.99997, 0.00768358, 0.967412, 0, 0.253206, 0.979402, 0.20096, 0.0196645, -0.967412, 0, -0.253206, -0.193898, 0.980992, -0.00768549, 0.919081, 0.386798, 0.0753489, -0.379897, 0.923276, -0.0569232, 0.826623, 0.558463, 0.0693751, -0.380542, 0.924764, 0, 0.695938, 0.70195, 0.151449, 0.979402, 0.20096, 0.0196645, 0.967412, 0, 0.253206, 0.964427, 0.200922, -0.171788, -0.967412, 0, -0.253206, -0.976797, 0.200425, -0.0754887, -0.97039, 0.200629, 0.134501, -0.193898, 0.980992, -0.00768549, 0, 0.99997, 0.00768358, 0.000750411, 0.999993, 0.00376908, -0.191663, 0.980993, 0.0302884, 0.919081, 0.386798, 0.0753489, 0.916137, 0.38676, -0.105406, -0.380515, 0.924775, 0, -0.37754, 0.924539, 0.051873, 0.826623, 0.558463, 0.0693751, 0.824295, 0.558432, -0.0932281, -0.552712, 0.833167, -0.0185023, -0.380542, 0.924764, 0, -0.549028, 0.832743, 0.0714657, 0.70406, 0.71014, 0, 0.701079, 0.708858, -0.0775179, -0.704041, 0.71016, 0, -0.699369, 0.709288, 0.0882772, 0.552121, 0.832275, 0.0498053, 0.704041, 0.71016, 0, 0.551221, 0.83228, -0.058863, -0.827085, 0.558778, -0.0608045, -0.70406, 0.71014, 0, -0.823075, 0.558748, 0.101725, 0.380542, 0.924764, 0, 0.380153, 0.924146, -0.0379127, -0.919478, 0.386965, -0.0694114, -0.915367, 0.386929, 0.111306, 0.193855, 0.980766, 0.0227622, 0.380515, 0.924775, 0, 0.194559, 0.980768, -0.0154935, 0.661754, 0.709842, -0.241261, 0.529138, 0.832286, -0.165267, -0.659774, 0.709946, 0.246323, -0.814738, 0.553294, 0.173403, 0.365443, 0.924151, -0.111344, -0.765592, 0.559738, 0.317117, -0.876078, 0.386896, 0.287748, 0.187814, 0.980765, -0.0531596, -0.931349, 0.200328, 0.30407, 0.00293975, 0.99997, 0.00709953, 0.904143, 0, -0.427231, 0.912393, 0.200863, -0.356641, -0.904143, 0, 0.427231, -0.182083, 0.980991, 0.0671029, 0.877982, 0.386726, -0.282117, -0.360157, 0.924543, 0.124529, 0.820206, 0.551316, -0.152686, -0.52453, 0.832748, 0.177198, 0.765575, 0.559762, -0.317116, 0.00213272, 0.999993, 0.0031944, -0.165488, 0.980992, 0.101331, 0.81451, 0.200941, -0.544239, 0.806056, 0.386775, -0.447971, -0.347495, 0.923277, 0.163724, 0.765594, 0.559738, -0.317113, 0.774645, 0.551343, -0.309752, -0.316399, 0.924766, 0.211421, -0.479872, 0.832754, 0.276122, 0.765575, 0.559762, -0.317116, 0.688988, 0.559785, -0.460365, 0.662803, 0.701933, -0.260732, -0.649972, 0.704631, 0.28466, 0.585397, 0.710149, -0.391152, 0.48672, 0.832292, -0.265316, -0.765575, 0.559762, 0.317116, -0.585421, 0.710123, 0.391161, -0.765241, 0.553315, 0.329013, 0.366355, 0.920817, -0.13372, -0.765592, 0.559738, 0.317117, -0.688997, 0.559768, 0.460372, -0.803089, 0.386943, 0.453126, 0.316389, 0.924776, -0.211395, 0.173826, 0.980767, -0.0887724, -0.854126, 0.200371, 0.479918, 0.904143, 0, -0.427231, -0.904143, 0, 0.427231, -0.688988, 0.559785, 0.460365, -0.585421, 0.710123, 0.391161, -0.497856, 0.710126, 0.497856, -0.686355, 0.553316, 0.471974, 0.316399, 0.924766, -0.211421, 0.40834, 0.83308, -0.373145, 0.295025, 0.924144, -0.24273, -0.688997, 0.559768, 0.460372, -0.585944, 0.559766, 0.585944, -0.699246, 0.386981, 0.601083, 0.316389, 0.924776, -0.211395, 0.153166, 0.980768, -0.120973, -0.744083, 0.200386, 0.637328, 0.00543339, 0.99997, 0.00543288, 0.904143, 0, -0.427231, 0.706453, 0.200921, -0.678642, -0.904143, 0, 0.427231, -0.142536, 0.980993, 0.131667, 0.703162, 0.386814, -0.596605, -0.316389, 0.924776, 0.211395, -0.285097, 0.924537, 0.252884, 0.688997, 0.559768, -0.460372, 0.699324, 0.551346, -0.454933, -0.316399, 0.924766, 0.211421, -0.41677, 0.832766, 0.364421, 0.585421, 0.710123, -0.391161, 0.688988, 0.559785, -0.460365, 0.585936, 0.559784, -0.585936, 0.599203, 0.701936, -0.385021, -0.585397, 0.710149, 0.391152, -0.581945, 0.704634, 0.405994, 0.585397, 0.710149, -0.391152, 0.497839, 0.71015, -0.497839, -0.110921, 0.981014, 0.159086, -0.258382, 0.923276, 0.284254, 0.585944, 0.559766, -0.585944, 0.542993, 0.387605, -0.74493, 0.597131, 0.551351, -0.58262, -0.211419, 0.924766, 0.3164, -0.337678, 0.832755, 0.43874, 0.497856, 0.710126, -0.497856, 0.585936, 0.559784, -0.585936, 0.460368, 0.559785, -0.688986, 0.512574, 0.701934, -0.494526, -0.497839, 0.71015, 0.497839, -0.49156, 0.704632, 0.511725, 0.497839, 0.71015, -0.497839, 0.39115, 0.710149, -0.585398, 0.348139, 0.832293, -0.431378, -0.585936, 0.559784, 0.585936, -0.497856, 0.710126, 0.497856, -0.391163, 0.710123, 0.58542, -0.581086, 0.55332, 0.596804, 0.287308, 0.920812, -0.263741, -0.585944, 0.559766, 0.585944, -0.460372, 0.559768, 0.688997, -0.568555, 0.386944, 0.725961, 0.211395, 0.924776, -0.316389, 0.126622, 0.980767, -0.148538, -0.605451, 0.200364, 0.770248, 0.00639091, 0.99997, 0.00426897, -0.0119388, 0, -0.999929, 0.560485, 0.200901, -0.803427, 0.0119388, 0, 0.999929, -0.460372, 0.559768, 0.688997, -0.317119, 0.559738, 0.765591, -0.416009, 0.386894, 0.822951, 0.211395, 0.924776, -0.316389, 0.162663, 0.924625, -0.344398, 0.0952158, 0.980765, -0.170394, -0.443554, 0.200331, 0.873572, 0.0070978, 0.999971, 0.0029411, -0.0119388, 0, -0.999929, 0.392974, 0.200864, -0.897343, 0.0119388, 0, 0.999929, -0.0813031, 0.980991, 0.176201, 0.421342, 0.386725, -0.820314, -0.211398, 0.924776, 0.316387, -0.166616, 0.924543, 0.342724, 0.460372, 0.559768, -0.688997, 0.472005, 0.551319, -0.687939, -0.211419, 0.924766, 0.3164, -0.245599, 0.832748, 0.496197, 0.391163, 0.710123, -0.58542, 0.460368, 0.559785, -0.688986, 0.317114, 0.559762, -0.765575, 0.325049, 0.708851, -0.625998, -0.39115, 0.710149, 0.585398, -0.31515, 0.709282, 0.630554, 0.39115, 0.710149, -0.585398, 0.257295, 0.832286, -0.491019, -0.460368, 0.559785, 0.688986, -0.391163, 0.710123, 0.58542, -0.453495, 0.553295, 0.698718, 0.211421, 0.924766, -0.316399, 0.317119, 0.559738, -0.765591, 0.216586, 0.387593, -0.896026, 0.229315, 0.558431, -0.797226, -0.0853958, 0.924719, 0.370949, -0.144079, 0.832744, 0.534582, 0.317114, 0.559762, -0.765575, 0.196678, 0.708854, -0.67738, -0.18608, 0.709285, 0.679918, 0.156558, 0.832282, -0.531786, -0.317114, 0.559762, 0.765575, -0.220995, 0.558748, 0.799351, 0.110451, 0.924146, -0.365725, -0.317119, 0.559738, 0.765591, -0.247464, 0.386933, 0.888282, 0.0601417, 0.980769, -0.185677, -0.264602, 0.200386, 0.943309, 0.00753615, 0.99997, 0.00149972, -0.0119388, 0, -0.999929, 0.210361, 0.200921, -0.956754, 0.0119388, 0, 0.999929, -0.0453639, 0.980993, 0.188665, 0, 0.924775, -0.380515, -0.0119388, 0, -0.999929, 0.0119388, 0, 0.999929, -0.0569181, 0.923276, 0.379898, 0, 0.924764, 0.380542, 0.151449, 0.70195, -0.695938, -0.124418, 0.704643, 0.698569, 0, 0.71016, -0.704041, 0, 0.71014, 0.70406, 0.0923549, 0.920812, -0.378915
-};
-
-uint32_t mIndices[] = {
-3, 1, 0, 9, 3, 0, 9, 0, 8, 8, 0, 825, 0, 1, 822, 0, 822, 825, 9, 8, 15, 43, 3, 9, 43, 9, 47, 8, 825, 827, 8, 827, 835, 827, 825, 783, 827, 783, 787, 827, 787, 831, 783, 782, 781, 783, 781, 773, 787, 783, 773, 825, 824, 783, 787, 773, 776, 787, 776, 791, 773, 772, 771, 773, 771, 726, 776, 773, 726, 776, 726, 729, 776, 729, 780, 726, 725, 724, 726, 724, 711, 729, 726, 711, 729, 711, 714, 729, 714, 733, 711, 710, 709, 711, 709, 677, 714, 711, 677, 714, 677, 679, 714, 679, 716, 677, 676, 663, 677, 663, 667, 679, 677, 667, 679, 667, 640, 679, 640, 683, 667, 663, 661, 667, 661, 666, 640, 667, 666, 663, 657, 662, 663, 662, 661, 674, 657, 663, 657, 653, 651, 657, 651, 656, 674, 673, 657, 673, 653, 657, 653, 648, 652, 653, 652, 651, 688, 648, 653, 673, 688, 653, 702, 688, 673, 707, 706, 673, 707, 673, 705, 688, 686, 648, 698, 686, 688, 702, 698, 688, 686, 684, 644, 686, 644, 648, 694, 684, 686, 698, 697, 686, 741, 740, 698, 747, 741, 698, 747, 698, 746, 741, 737, 740, 756, 737, 741, 762, 756, 741, 762, 741, 761, 737, 734, 691, 737, 691, 736, 751, 734, 737, 756, 755, 737, 691, 690, 680, 691, 680, 684, 694, 691, 684, 734, 690, 691, 690, 713, 678, 690, 678, 680, 730, 713, 690, 734, 730, 690, 680, 678, 670, 680, 670, 643, 684, 680, 643, 684, 643, 644, 644, 643, 642, 643, 670, 668, 643, 668, 642, 670, 665, 669, 670, 669, 668, 678, 665, 670, 665, 660, 658, 665, 658, 664, 675, 660, 665, 678, 675, 665, 660, 659, 658, 660, 655, 659, 672, 655, 660, 675, 672, 660, 708, 672, 675, 713, 712, 675, 713, 675, 678, 672, 671, 655, 704, 671, 672, 708, 704, 672, 671, 689, 650, 671, 650, 655, 701, 699, 671, 704, 703, 671, 723, 722, 704, 723, 704, 721, 722, 748, 704, 728, 723, 727, 770, 722, 723, 775, 774, 723, 775, 723, 728, 728, 727, 713, 730, 728, 713, 777, 775, 728, 777, 728, 730, 786, 784, 775, 788, 786, 775, 788, 775, 777, 750, 777, 730, 792, 788, 777, 792, 777, 750, 750, 730, 734, 751, 750, 734, 795, 792, 750, 795, 750, 794, 832, 788, 792, 815, 832, 792, 815, 792, 795, 799, 795, 798, 816, 815, 795, 816, 795, 799, 836, 832, 815, 24, 837, 815, 24, 815, 816, 819, 816, 799, 839, 24, 816, 839, 816, 819, 26, 25, 24, 30, 26, 24, 30, 24, 29, 26, 21, 25, 52, 21, 26, 36, 52, 26, 36, 26, 30, 2, 30, 34, 37, 36, 30, 37, 30, 2, 66, 52, 36, 71, 70, 36, 71, 36, 69, 66, 62, 52, 62, 61, 50, 62, 50, 52, 102, 101, 62, 108, 102, 62, 108, 62, 107, 102, 98, 101, 121, 98, 102, 127, 121, 102, 127, 102, 126, 98, 95, 57, 98, 57, 97, 116, 95, 98, 121, 120, 98, 58, 57, 48, 57, 79, 44, 57, 44, 48, 95, 79, 57, 58, 48, 50, 48, 44, 11, 48, 11, 17, 50, 48, 17, 44, 42, 7, 44, 7, 11, 79, 42, 44, 11, 7, 4, 11, 4, 10, 17, 11, 10, 17, 10, 16, 21, 17, 16, 50, 17, 21, 52, 50, 21, 21, 16, 20, 16, 10, 828, 16, 828, 832, 836, 16, 832, 10, 4, 826, 10, 826, 828, 828, 826, 786, 828, 786, 788, 832, 828, 788, 826, 823, 785, 826, 785, 786, 4, 823, 826, 786, 785, 784, 785, 807, 765, 785, 765, 811, 823, 807, 785, 807, 803, 806, 807, 806, 765, 820, 803, 807, 823, 820, 807, 765, 764, 763, 765, 763, 722, 770, 765, 722, 722, 749, 748, 820, 818, 803, 31, 818, 820, 842, 31, 820, 842, 820, 823, 818, 814, 817, 818, 817, 803, 838, 814, 818, 31, 840, 818, 803, 802, 801, 803, 801, 800, 33, 32, 31, 6, 33, 31, 6, 31, 35, 33, 28, 32, 39, 38, 33, 39, 33, 6, 38, 28, 33, 7, 6, 5, 42, 39, 6, 42, 6, 7, 72, 38, 39, 77, 76, 39, 77, 39, 42, 79, 77, 42, 89, 88, 77, 91, 89, 77, 91, 77, 79, 95, 91, 79, 142, 89, 91, 115, 142, 91, 115, 91, 95, 89, 84, 88, 140, 84, 89, 142, 140, 89, 153, 140, 142, 157, 153, 142, 157, 142, 115, 116, 115, 95, 160, 157, 115, 160, 115, 159, 197, 153, 157, 180, 197, 157, 180, 157, 160, 164, 160, 163, 181, 180, 160, 181, 160, 164, 208, 197, 180, 211, 210, 180, 211, 180, 181, 184, 181, 164, 213, 211, 181, 213, 181, 184, 221, 219, 211, 226, 221, 211, 226, 211, 225, 221, 220, 219, 255, 220, 221, 258, 255, 221, 258, 221, 226, 230, 226, 229, 260, 258, 226, 260, 226, 230, 264, 255, 258, 269, 268, 258, 269, 258, 267, 264, 263, 255, 263, 286, 253, 263, 253, 255, 302, 301, 263, 308, 302, 263, 308, 263, 307, 302, 298, 301, 347, 298, 302, 353, 347, 302, 353, 302, 352, 298, 295, 281, 298, 281, 297, 343, 295, 298, 347, 346, 298, 281, 277, 247, 281, 247, 251, 283, 281, 251, 295, 277, 281, 277, 275, 246, 277, 246, 247, 295, 294, 277, 294, 275, 277, 247, 246, 235, 247, 235, 237, 251, 247, 237, 246, 261, 232, 246, 232, 235, 275, 261, 246, 235, 232, 234, 235, 234, 199, 237, 235, 199, 237, 199, 202, 241, 237, 202, 251, 237, 241, 199, 198, 188, 199, 188, 191, 202, 199, 191, 202, 191, 193, 206, 202, 193, 241, 202, 206, 191, 188, 150, 191, 150, 151, 193, 191, 151, 188, 185, 172, 188, 172, 150, 218, 185, 188, 151, 150, 149, 150, 172, 130, 150, 130, 176, 172, 168, 171, 172, 171, 130, 185, 168, 172, 130, 129, 128, 130, 128, 83, 135, 130, 83, 84, 83, 68, 83, 110, 109, 83, 109, 68, 135, 83, 84, 84, 68, 82, 140, 139, 84, 68, 67, 54, 68, 54, 38, 72, 68, 38, 54, 53, 23, 54, 23, 28, 38, 54, 28, 65, 63, 54, 23, 19, 18, 23, 18, 22, 28, 23, 22, 51, 19, 23, 28, 22, 27, 22, 18, 813, 22, 813, 814, 838, 22, 814, 814, 813, 793, 813, 830, 790, 813, 790, 793, 18, 830, 813, 814, 793, 812, 793, 790, 779, 793, 779, 753, 797, 793, 753, 790, 789, 779, 830, 829, 790, 12, 834, 830, 18, 12, 830, 14, 13, 12, 19, 14, 12, 19, 12, 18, 46, 45, 14, 49, 46, 14, 49, 14, 19, 51, 49, 19, 56, 46, 49, 60, 56, 49, 60, 49, 59, 56, 55, 46, 55, 80, 46, 96, 55, 56, 100, 96, 56, 100, 56, 99, 93, 92, 55, 96, 93, 55, 119, 118, 96, 119, 96, 117, 118, 93, 96, 144, 143, 93, 118, 144, 93, 158, 144, 118, 162, 158, 118, 162, 118, 161, 155, 154, 144, 158, 155, 144, 179, 178, 158, 179, 158, 177, 178, 155, 158, 195, 194, 155, 178, 195, 155, 207, 195, 178, 209, 207, 178, 209, 178, 179, 204, 203, 195, 207, 204, 195, 242, 204, 207, 223, 242, 207, 223, 207, 209, 212, 209, 179, 224, 223, 209, 224, 209, 222, 254, 242, 223, 257, 256, 223, 257, 223, 224, 228, 224, 227, 259, 257, 224, 259, 224, 228, 266, 265, 257, 266, 257, 259, 289, 287, 257, 261, 259, 228, 270, 266, 259, 270, 259, 261, 311, 309, 266, 317, 311, 266, 317, 266, 316, 311, 310, 309, 325, 323, 311, 330, 325, 311, 330, 311, 317, 322, 317, 321, 335, 334, 317, 335, 317, 322, 322, 321, 275, 294, 322, 275, 337, 335, 322, 337, 322, 294, 381, 380, 335, 354, 381, 335, 354, 335, 337, 341, 337, 294, 355, 354, 337, 355, 337, 341, 341, 294, 295, 343, 341, 295, 359, 355, 341, 359, 341, 358, 398, 354, 355, 400, 398, 355, 400, 355, 359, 363, 359, 362, 403, 400, 359, 403, 359, 363, 409, 398, 400, 412, 411, 400, 412, 400, 403, 386, 403, 363, 414, 412, 403, 414, 403, 386, 445, 444, 412, 449, 445, 412, 449, 412, 448, 445, 442, 444, 456, 442, 445, 459, 456, 445, 459, 445, 449, 430, 449, 451, 461, 459, 449, 461, 449, 430, 491, 456, 459, 496, 495, 459, 496, 459, 494, 491, 487, 456, 487, 486, 453, 487, 453, 456, 500, 498, 487, 506, 500, 487, 506, 487, 505, 500, 499, 498, 544, 499, 500, 550, 544, 500, 550, 500, 549, 499, 526, 481, 499, 481, 528, 540, 526, 499, 544, 543, 499, 481, 477, 467, 481, 467, 452, 483, 481, 452, 526, 477, 481, 477, 475, 465, 477, 465, 467, 522, 475, 477, 526, 522, 477, 467, 465, 433, 467, 433, 435, 452, 467, 435, 465, 462, 429, 465, 429, 433, 475, 462, 465, 433, 429, 432, 433, 432, 422, 435, 433, 422, 435, 422, 424, 439, 435, 424, 452, 435, 439, 422, 421, 389, 422, 389, 392, 424, 422, 392, 424, 392, 394, 408, 424, 394, 439, 424, 408, 392, 389, 376, 392, 376, 381, 394, 392, 381, 389, 388, 371, 389, 371, 376, 419, 388, 389, 376, 371, 325, 376, 325, 375, 381, 376, 380, 394, 381, 354, 398, 394, 354, 409, 408, 398, 408, 394, 398, 442, 439, 408, 442, 408, 441, 453, 439, 442, 456, 453, 442, 453, 452, 439, 483, 452, 453, 325, 324, 323, 371, 370, 325, 371, 367, 370, 388, 367, 371, 367, 366, 365, 367, 365, 364, 405, 404, 367, 388, 405, 367, 416, 405, 388, 419, 416, 388, 405, 402, 404, 413, 402, 405, 416, 415, 405, 429, 428, 416, 429, 416, 427, 428, 450, 416, 462, 428, 429, 428, 447, 450, 460, 447, 428, 462, 460, 428, 475, 474, 462, 497, 460, 462, 460, 458, 447, 493, 458, 460, 497, 493, 460, 458, 457, 443, 458, 443, 447, 490, 488, 458, 493, 492, 458, 509, 507, 493, 515, 509, 493, 515, 493, 514, 509, 508, 507, 553, 551, 509, 558, 553, 509, 558, 509, 515, 520, 515, 519, 533, 561, 515, 533, 515, 520, 520, 519, 475, 522, 520, 475, 534, 533, 520, 534, 520, 522, 580, 579, 533, 582, 580, 533, 582, 533, 534, 538, 534, 522, 586, 582, 534, 586, 534, 538, 538, 522, 526, 540, 538, 526, 589, 586, 538, 589, 538, 588, 599, 582, 586, 601, 599, 586, 601, 586, 589, 567, 589, 592, 604, 601, 589, 604, 589, 567, 631, 599, 601, 614, 633, 601, 614, 601, 604, 607, 604, 567, 615, 614, 604, 615, 604, 607, 607, 567, 568, 610, 607, 568, 619, 618, 607, 619, 607, 610, 568, 567, 544, 568, 544, 566, 573, 568, 572, 610, 568, 609, 567, 592, 544, 613, 610, 612, 621, 619, 610, 621, 610, 613, 613, 612, 578, 598, 613, 578, 624, 621, 613, 624, 613, 598, 578, 577, 576, 578, 576, 531, 581, 578, 531, 598, 578, 581, 598, 581, 597, 624, 598, 628, 581, 531, 532, 581, 532, 585, 532, 531, 518, 531, 560, 559, 531, 559, 518, 532, 518, 521, 532, 521, 537, 518, 517, 516, 518, 516, 473, 521, 518, 473, 521, 473, 476, 521, 476, 525, 473, 472, 471, 473, 471, 464, 476, 473, 464, 476, 464, 466, 476, 466, 480, 464, 463, 430, 464, 430, 431, 466, 464, 431, 466, 431, 434, 466, 434, 470, 431, 430, 418, 431, 418, 420, 434, 431, 420, 430, 451, 418, 418, 417, 386, 418, 386, 387, 420, 418, 387, 420, 387, 391, 423, 420, 391, 434, 420, 423, 434, 423, 438, 423, 391, 393, 423, 393, 426, 391, 387, 390, 391, 390, 379, 393, 391, 379, 387, 386, 369, 387, 369, 385, 369, 363, 347, 369, 347, 368, 374, 369, 373, 386, 363, 369, 363, 362, 347, 374, 373, 372, 379, 378, 377, 379, 377, 333, 382, 379, 333, 393, 379, 382, 333, 332, 331, 333, 331, 320, 336, 333, 320, 382, 333, 336, 382, 336, 384, 393, 382, 397, 336, 320, 293, 336, 293, 340, 320, 319, 318, 320, 318, 273, 293, 320, 273, 293, 276, 292, 293, 273, 276, 273, 272, 271, 273, 271, 244, 276, 273, 244, 276, 244, 245, 276, 245, 280, 245, 244, 233, 244, 262, 230, 244, 230, 233, 245, 233, 236, 245, 236, 250, 233, 230, 217, 233, 217, 200, 236, 233, 200, 230, 229, 217, 217, 216, 184, 217, 184, 187, 200, 217, 187, 201, 200, 190, 200, 187, 190, 236, 200, 201, 236, 201, 240, 201, 190, 192, 201, 192, 205, 190, 187, 189, 190, 189, 148, 192, 190, 148, 187, 184, 170, 187, 170, 186, 170, 164, 121, 170, 121, 169, 175, 170, 174, 184, 164, 170, 164, 163, 121, 175, 174, 173, 148, 147, 146, 148, 146, 138, 152, 148, 138, 192, 148, 152, 138, 137, 136, 138, 136, 87, 141, 138, 87, 152, 138, 141, 152, 141, 156, 192, 152, 196, 141, 87, 90, 141, 90, 145, 87, 86, 85, 87, 85, 75, 90, 87, 75, 90, 75, 78, 90, 78, 94, 75, 74, 73, 75, 73, 41, 78, 75, 41, 78, 41, 43, 78, 43, 81, 41, 40, 2, 41, 2, 3, 43, 41, 3, 3, 2, 1, 2, 34, 1, 1, 841, 819, 1, 819, 822, 819, 799, 805, 822, 819, 805, 822, 805, 821, 825, 822, 824, 805, 799, 756, 805, 756, 804, 810, 805, 809, 799, 798, 756, 810, 809, 808, 573, 572, 571, 599, 594, 582, 629, 594, 599, 631, 629, 599, 594, 593, 580, 594, 580, 582, 625, 593, 594, 629, 625, 594, 593, 611, 575, 593, 575, 580, 623, 611, 593, 625, 623, 593, 580, 575, 579, 575, 570, 553, 575, 553, 574, 611, 570, 575, 570, 565, 569, 570, 569, 553, 608, 565, 570, 611, 608, 570, 553, 552, 551, 608, 606, 565, 617, 606, 608, 620, 617, 608, 620, 608, 611, 606, 603, 605, 606, 605, 565, 617, 616, 606, 634, 603, 606, 603, 600, 587, 603, 587, 602, 632, 600, 603, 634, 632, 603, 600, 596, 584, 600, 584, 587, 630, 596, 600, 632, 630, 600, 587, 584, 536, 587, 536, 539, 591, 587, 539, 584, 583, 536, 596, 595, 584, 627, 626, 596, 630, 627, 596, 536, 535, 524, 539, 536, 524, 524, 523, 479, 527, 524, 479, 539, 524, 527, 479, 478, 469, 482, 479, 469, 527, 479, 482, 530, 527, 482, 542, 539, 527, 542, 527, 541, 482, 469, 454, 485, 482, 454, 530, 482, 529, 455, 454, 440, 454, 469, 437, 454, 437, 440, 485, 454, 484, 455, 440, 443, 440, 437, 406, 440, 406, 407, 443, 440, 407, 437, 436, 406, 469, 468, 437, 407, 406, 396, 406, 425, 396, 407, 396, 399, 410, 407, 399, 443, 407, 410, 447, 443, 410, 410, 399, 402, 413, 410, 402, 447, 410, 446, 399, 396, 356, 399, 356, 357, 402, 399, 357, 396, 395, 356, 357, 356, 339, 356, 383, 339, 357, 339, 342, 361, 357, 342, 402, 357, 401, 339, 338, 291, 342, 339, 291, 342, 291, 296, 345, 342, 296, 361, 342, 360, 291, 290, 279, 296, 291, 279, 296, 279, 282, 300, 296, 282, 345, 296, 344, 279, 278, 249, 282, 279, 249, 282, 249, 252, 285, 282, 252, 300, 282, 299, 249, 248, 239, 252, 249, 239, 252, 239, 242, 254, 252, 242, 285, 252, 284, 239, 238, 204, 242, 239, 204, 591, 539, 590, 565, 564, 563, 565, 563, 562, 623, 622, 611, 490, 489, 488, 275, 274, 261, 261, 228, 232, 228, 227, 215, 232, 228, 215, 232, 215, 231, 215, 214, 183, 215, 183, 185, 218, 215, 185, 183, 179, 182, 183, 182, 168, 185, 183, 168, 212, 179, 183, 168, 167, 166, 168, 166, 165, 289, 288, 287, 779, 778, 732, 753, 779, 732, 732, 731, 692, 735, 732, 692, 753, 732, 735, 754, 753, 735, 797, 753, 796, 735, 692, 693, 739, 735, 693, 754, 735, 752, 693, 692, 682, 692, 715, 682, 693, 682, 685, 696, 693, 685, 739, 693, 738, 682, 681, 637, 685, 682, 637, 685, 637, 646, 687, 685, 646, 696, 685, 695, 637, 636, 635, 646, 637, 635, 646, 635, 645, 650, 646, 645, 687, 646, 650, 650, 645, 649, 655, 650, 649, 655, 649, 654, 65, 64, 63, 151, 149, 140, 153, 151, 140, 193, 151, 153, 197, 193, 153, 206, 193, 197, 208, 206, 197, 220, 241, 206, 220, 206, 243, 253, 241, 220, 255, 253, 220, 253, 251, 241, 283, 251, 253, 7, 5, 4, 4, 833, 823, 701, 700, 699, 644, 642, 641, 648, 644, 641, 648, 641, 647, 640, 666, 639, 640, 639, 638, 106, 104, 103, 106, 105, 104, 114, 112, 111, 114, 113, 112, 125, 123, 122, 125, 124, 123, 134, 132, 131, 134, 133, 132, 306, 304, 303, 306, 305, 304, 315, 313, 312, 315, 314, 313, 329, 327, 326, 329, 328, 327, 351, 349, 348, 351, 350, 349, 504, 502, 501, 504, 503, 502, 513, 511, 510, 513, 512, 511, 548, 546, 545, 548, 547, 546, 557, 555, 554, 557, 556, 555, 720, 718, 717, 720, 719, 718, 745, 743, 742, 745, 744, 743, 760, 758, 757, 760, 759, 758, 769, 767, 766, 769, 768, 767
-};
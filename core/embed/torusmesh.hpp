@@ -1,26 +0,0 @@
-size_t mVertexCount = 779;
-size_t mIndexCount = 3456;
-
-float mPositions[] = {
-1.25, 0, -0, 1.23931, 0, 0.163158, 1.2061, 0.125, 0.158786, 1.21651, 0.125, -0, 1.21651, 0.125, -0, 1.11538, 0.216506, 0.146842, 1.125, 0.216506, -0, 0.991445, 0.25, 0.130526, 1, 0.25, -0, 0.867514, 0.216506, 0.11421, 0.875, 0.216506, -0, 0.776791, 0.125, 0.102266, 0.783494, 0.125, -0, 0.743584, 0, 0.097895, 0.75, 0, -0, 0.75, 0, -0, 0.743584, 0, 0.097895, 0.776791, -0.125, 0.102266, 0.783494, -0.125, -0, 0.867514, -0.216506, 0.11421, 0.875, -0.216506, -0, 0.991445, -0.25, 0.130526, 1, -0.25, -0, 1.11538, -0.216506, 0.146842, 1.125, -0.216506, -0, 1.2061, -0.125, 0.158786, 1.21651, -0.125, -0, 1.21651, -0.125, -0, 1.20741, 0, 0.323524, 1.17506, 0.125, 0.314855, 1.17506, 0.125, 0.314855, 1.08667, 0.216506, 0.291171, 0.965926, 0.25, 0.258819, 0.845185, 0.216506, 0.226467, 0.756797, 0.125, 0.202783, 0.724444, 0, 0.194114, 0.724444, 0, 0.194114, 0.756797, -0.125, 0.202783, 0.845185, -0.216506, 0.226467, 0.965926, -0.25, 0.258819, 1.08667, -0.216506, 0.291171, 1.17506, -0.125, 0.314855, 1.17506, -0.125, 0.314855, 1.15485, 0, 0.478354, 1.1239, 0.125, 0.465537, 1.17506, 0.125, 0.314855, 1.17506, 0.125, 0.314855, 1.03936, 0.216506, 0.430519, 0.92388, 0.25, 0.382683, 0.808395, 0.216506, 0.334848, 0.723854, 0.125, 0.29983, 0.723854, 0.125, 0.29983, 0.69291, 0, 0.287013, 0.69291, 0, 0.287013, 0.723854, -0.125, 0.29983, 0.723854, -0.125, 0.29983, 0.808395, -0.216506, 0.334848, 0.92388, -0.25, 0.382683, 1.03936, -0.216506, 0.430519, 1.1239, -0.125, 0.465537, 1.17506, -0.125, 0.314855, 1.17506, -0.125, 0.314855, 1.08253, 0, 0.625, 1.05352, 0.125, 0.608253, 0.974279, 0.216506, 0.5625, 0.866025, 0.25, 0.5, 0.757772, 0.216506, 0.4375, 0.678525, 0.125, 0.391747, 0.723854, 0.125, 0.29983, 0.723854, 0.125, 0.29983, 0.649519, 0, 0.375, 0.649519, 0, 0.375, 0.678525, -0.125, 0.391747, 0.723854, -0.125, 0.29983, 0.723854, -0.125, 0.29983, 0.757772, -0.216506, 0.4375, 0.866025, -0.25, 0.5, 0.974279, -0.216506, 0.5625, 1.05352, -0.125, 0.608253, 0.991692, 0, 0.760952, 0.965119, 0.125, 0.740562, 0.892523, 0.216506, 0.684856, 0.793353, 0.25, 0.608761, 0.694184, 0.216506, 0.532666, 0.621587, 0.125, 0.476961, 0.595015, 0, 0.456571, 0.595015, 0, 0.456571, 0.621587, -0.125, 0.476961, 0.694184, -0.216506, 0.532666, 0.793353, -0.25, 0.608761, 0.892523, -0.216506, 0.684856, 0.965119, -0.125, 0.740562, 0.883883, 0, 0.883884, 0.8602, 0.125, 0.8602, 0.795495, 0.216506, 0.795495, 0.707107, 0.25, 0.707107, 0.618718, 0.216506, 0.618719, 0.554014, 0.125, 0.554014, 0.554014, 0.125, 0.554014, 0.53033, 0, 0.53033, 0.53033, 0, 0.53033, 0.554014, -0.125, 0.554014, 0.554014, -0.125, 0.554014, 0.618718, -0.216506, 0.618719, 0.707107, -0.25, 0.707107, 0.795495, -0.216506, 0.795495, 0.8602, -0.125, 0.8602, 0.760952, 0, 0.991691, 0.740562, 0.125, 0.965119, 0.684857, 0.216506, 0.892522, 0.608762, 0.25, 0.793353, 0.532666, 0.216506, 0.694184, 0.476961, 0.125, 0.621587, 0.554014, 0.125, 0.554014, 0.554014, 0.125, 0.554014, 0.456571, 0, 0.595015, 0.456571, 0, 0.595015, 0.476961, -0.125, 0.621587, 0.554014, -0.125, 0.554014, 0.554014, -0.125, 0.554014, 0.532666, -0.216506, 0.694184, 0.608762, -0.25, 0.793353, 0.684857, -0.216506, 0.892522, 0.740562, -0.125, 0.965119, 0.625, 0, 1.08253, 0.608253, 0.125, 1.05352, 0.5625, 0.216506, 0.974279, 0.5, 0.25, 0.866025, 0.4375, 0.216506, 0.757772, 0.391747, 0.125, 0.678525, 0.375, 0, 0.649519, 0.375, 0, 0.649519, 0.391747, -0.125, 0.678525, 0.4375, -0.216506, 0.757772, 0.5, -0.25, 0.866025, 0.5625, -0.216506, 0.974279, 0.608253, -0.125, 1.05352, 0.478355, 0, 1.15485, 0.465537, 0.125, 1.1239, 0.430519, 0.216506, 1.03936, 0.382684, 0.25, 0.923879, 0.334848, 0.216506, 0.808394, 0.29983, 0.125, 0.723854, 0.29983, 0.125, 0.723854, 0.287013, 0, 0.69291, 0.287013, 0, 0.69291, 0.29983, -0.125, 0.723854, 0.29983, -0.125, 0.723854, 0.334848, -0.216506, 0.808394, 0.382684, -0.25, 0.923879, 0.430519, -0.216506, 1.03936, 0.465537, -0.125, 1.1239, 0.323524, 0, 1.20741, 0.314855, 0.125, 1.17506, 0.314855, 0.125, 1.17506, 0.291171, 0.216506, 1.08667, 0.258819, 0.25, 0.965926, 0.226467, 0.216506, 0.845185, 0.202783, 0.125, 0.756797, 0.29983, 0.125, 0.723854, 0.29983, 0.125, 0.723854, 0.194114, 0, 0.724444, 0.194114, 0, 0.724444, 0.202783, -0.125, 0.756797, 0.29983, -0.125, 0.723854, 0.29983, -0.125, 0.723854, 0.226467, -0.216506, 0.845185, 0.258819, -0.25, 0.965926, 0.291171, -0.216506, 1.08667, 0.314855, -0.125, 1.17506, 0.314855, -0.125, 1.17506, 0.163158, 0, 1.23931, 0.158786, 0.125, 1.2061, 0.314855, 0.125, 1.17506, 0.314855, 0.125, 1.17506, 0.146842, 0.216506, 1.11538, 0.130526, 0.25, 0.991445, 0.11421, 0.216506, 0.867514, 0.102266, 0.125, 0.776791, 0.097895, 0, 0.743584, 0.097895, 0, 0.743584, 0.102266, -0.125, 0.776791, 0.11421, -0.216506, 0.867514, 0.130526, -0.25, 0.991445, 0.146842, -0.216506, 1.11538, 0.158786, -0.125, 1.2061, 0.314855, -0.125, 1.17506, 0.314855, -0.125, 1.17506, 0, 0, 1.25, 0, 0.125, 1.21651, 0, 0.125, 1.21651, 0, 0.216506, 1.125, 0, 0.25, 1, 0, 0.216506, 0.875, 0, 0.125, 0.783494, 0, 0, 0.75, 0, 0, 0.75, 0, -0.125, 0.783494, 0, -0.216506, 0.875, 0, -0.25, 1, 0, -0.216506, 1.125, 0, -0.125, 1.21651, 0, -0.125, 1.21651, -0.163158, 0, 1.23931, -0.158786, 0.125, 1.2061, 0, 0.125, 1.21651, 0, 0.125, 1.21651, -0.146842, 0.216506, 1.11538, -0.130526, 0.25, 0.991445, -0.114211, 0.216506, 0.867514, -0.102267, 0.125, 0.776791, -0.097895, 0, 0.743584, -0.097895, 0, 0.743584, -0.102267, -0.125, 0.776791, -0.114211, -0.216506, 0.867514, -0.130526, -0.25, 0.991445, -0.146842, -0.216506, 1.11538, -0.158786, -0.125, 1.2061, 0, -0.125, 1.21651, 0, -0.125, 1.21651, -0.323524, 0, 1.20741, -0.314855, 0.125, 1.17506, -0.314855, 0.125, 1.17506, -0.291171, 0.216506, 1.08667, -0.258819, 0.25, 0.965926, -0.226467, 0.216506, 0.845185, -0.202783, 0.125, 0.756797, -0.194114, 0, 0.724444, -0.194114, 0, 0.724444, -0.202783, -0.125, 0.756797, -0.226467, -0.216506, 0.845185, -0.258819, -0.25, 0.965926, -0.291171, -0.216506, 1.08667, -0.314855, -0.125, 1.17506, -0.314855, -0.125, 1.17506, -0.478354, 0, 1.15485, -0.465537, 0.125, 1.1239, -0.314855, 0.125, 1.17506, -0.314855, 0.125, 1.17506, -0.430519, 0.216506, 1.03936, -0.382684, 0.25, 0.92388, -0.334848, 0.216506, 0.808395, -0.29983, 0.125, 0.723854, -0.29983, 0.125, 0.723854, -0.287013, 0, 0.69291, -0.287013, 0, 0.69291, -0.29983, -0.125, 0.723854, -0.29983, -0.125, 0.723854, -0.334848, -0.216506, 0.808395, -0.382684, -0.25, 0.92388, -0.430519, -0.216506, 1.03936, -0.465537, -0.125, 1.1239, -0.314855, -0.125, 1.17506, -0.314855, -0.125, 1.17506, -0.625, 0, 1.08253, -0.608253, 0.125, 1.05353, -0.5625, 0.216506, 0.974279, -0.5, 0.25, 0.866026, -0.4375, 0.216506, 0.757772, -0.391747, 0.125, 0.678525, -0.29983, 0.125, 0.723854, -0.29983, 0.125, 0.723854, -0.375, 0, 0.649519, -0.375, 0, 0.649519, -0.391747, -0.125, 0.678525, -0.29983, -0.125, 0.723854, -0.29983, -0.125, 0.723854, -0.4375, -0.216506, 0.757772, -0.5, -0.25, 0.866026, -0.5625, -0.216506, 0.974279, -0.608253, -0.125, 1.05353, -0.760952, 0, 0.991692, -0.740562, 0.125, 0.965119, -0.684857, 0.216506, 0.892522, -0.608761, 0.25, 0.793353, -0.532666, 0.216506, 0.694184, -0.476961, 0.125, 0.621587, -0.456571, 0, 0.595015, -0.456571, 0, 0.595015, -0.476961, -0.125, 0.621587, -0.532666, -0.216506, 0.694184, -0.608761, -0.25, 0.793353, -0.684857, -0.216506, 0.892522, -0.740562, -0.125, 0.965119, -0.883884, 0, 0.883883, -0.8602, 0.125, 0.8602, -0.795495, 0.216506, 0.795495, -0.707107, 0.25, 0.707107, -0.618719, 0.216506, 0.618718, -0.554014, 0.125, 0.554013, -0.554014, 0.125, 0.554013, -0.53033, 0, 0.53033, -0.53033, 0, 0.53033, -0.554014, -0.125, 0.554013, -0.554014, -0.125, 0.554013, -0.618719, -0.216506, 0.618718, -0.707107, -0.25, 0.707107, -0.795495, -0.216506, 0.795495, -0.8602, -0.125, 0.8602, -0.991692, 0, 0.760952, -0.965119, 0.125, 0.740562, -0.892522, 0.216506, 0.684857, -0.793353, 0.25, 0.608761, -0.694184, 0.216506, 0.532666, -0.621587, 0.125, 0.476961, -0.554014, 0.125, 0.554013, -0.554014, 0.125, 0.554013, -0.595015, 0, 0.456571, -0.595015, 0, 0.456571, -0.621587, -0.125, 0.476961, -0.554014, -0.125, 0.554013, -0.554014, -0.125, 0.554013, -0.694184, -0.216506, 0.532666, -0.793353, -0.25, 0.608761, -0.892522, -0.216506, 0.684857, -0.965119, -0.125, 0.740562, -1.08253, 0, 0.625, -1.05352, 0.125, 0.608253, -0.974278, 0.216506, 0.5625, -0.866025, 0.25, 0.5, -0.757772, 0.216506, 0.4375, -0.678525, 0.125, 0.391747, -0.649519, 0, 0.375, -0.649519, 0, 0.375, -0.678525, -0.125, 0.391747, -0.757772, -0.216506, 0.4375, -0.866025, -0.25, 0.5, -0.974278, -0.216506, 0.5625, -1.05352, -0.125, 0.608253, -1.15485, 0, 0.478354, -1.1239, 0.125, 0.465537, -1.03936, 0.216506, 0.430519, -0.92388, 0.25, 0.382683, -0.808395, 0.216506, 0.334848, -0.723854, 0.125, 0.29983, -0.723854, 0.125, 0.29983, -0.69291, 0, 0.287013, -0.69291, 0, 0.287013, -0.723854, -0.125, 0.29983, -0.723854, -0.125, 0.29983, -0.808395, -0.216506, 0.334848, -0.92388, -0.25, 0.382683, -1.03936, -0.216506, 0.430519, -1.1239, -0.125, 0.465537, -1.20741, 0, 0.323524, -1.17506, 0.125, 0.314855, -1.17506, 0.125, 0.314855, -1.08667, 0.216506, 0.291171, -0.965926, 0.25, 0.258819, -0.845185, 0.216506, 0.226467, -0.756797, 0.125, 0.202783, -0.723854, 0.125, 0.29983, -0.723854, 0.125, 0.29983, -0.724444, 0, 0.194114, -0.724444, 0, 0.194114, -0.756797, -0.125, 0.202783, -0.723854, -0.125, 0.29983, -0.723854, -0.125, 0.29983, -0.845185, -0.216506, 0.226467, -0.965926, -0.25, 0.258819, -1.08667, -0.216506, 0.291171, -1.17506, -0.125, 0.314855, -1.17506, -0.125, 0.314855, -1.23931, 0, 0.163158, -1.2061, 0.125, 0.158786, -1.17506, 0.125, 0.314855, -1.17506, 0.125, 0.314855, -1.11538, 0.216506, 0.146842, -0.991445, 0.25, 0.130526, -0.867514, 0.216506, 0.114211, -0.776791, 0.125, 0.102267, -0.743584, 0, 0.097895, -0.743584, 0, 0.097895, -0.776791, -0.125, 0.102267, -0.867514, -0.216506, 0.114211, -0.991445, -0.25, 0.130526, -1.11538, -0.216506, 0.146842, -1.2061, -0.125, 0.158786, -1.17506, -0.125, 0.314855, -1.17506, -0.125, 0.314855, -1.25, 0, 0, -1.21651, 0.125, 0, -1.21651, 0.125, 0, -1.125, 0.216506, 0, -1, 0.25, 0, -0.875, 0.216506, 0, -0.783494, 0.125, 0, -0.75, 0, 0, -0.75, 0, 0, -0.783494, -0.125, 0, -0.875, -0.216506, 0, -1, -0.25, 0, -1.125, -0.216506, 0, -1.21651, -0.125, 0, -1.21651, -0.125, 0, -1.25, 0, 0, -1.23931, 0, -0.163158, -1.2061, 0.125, -0.158786, -1.21651, 0.125, 0, -1.21651, 0.125, 0, -1.11538, 0.216506, -0.146842, -1.125, 0.216506, 0, -0.991445, 0.25, -0.130526, -1, 0.25, 0, -0.867514, 0.216506, -0.114211, -0.875, 0.216506, 0, -0.776791, 0.125, -0.102267, -0.783494, 0.125, 0, -0.743584, 0, -0.097895, -0.75, 0, 0, -0.75, 0, 0, -0.743584, 0, -0.097895, -0.776791, -0.125, -0.102267, -0.783494, -0.125, 0, -0.867514, -0.216506, -0.114211, -0.875, -0.216506, 0, -0.991445, -0.25, -0.130526, -1, -0.25, 0, -1.11538, -0.216506, -0.146842, -1.125, -0.216506, 0, -1.2061, -0.125, -0.158786, -1.21651, -0.125, 0, -1.21651, -0.125, 0, -1.20741, 0, -0.323524, -1.17506, 0.125, -0.314855, -1.17506, 0.125, -0.314855, -1.08667, 0.216506, -0.291171, -0.965926, 0.25, -0.258819, -0.845185, 0.216506, -0.226467, -0.756797, 0.125, -0.202783, -0.724444, 0, -0.194114, -0.724444, 0, -0.194114, -0.756797, -0.125, -0.202783, -0.845185, -0.216506, -0.226467, -0.965926, -0.25, -0.258819, -1.08667, -0.216506, -0.291171, -1.17506, -0.125, -0.314855, -1.17506, -0.125, -0.314855, -1.15485, 0, -0.478354, -1.12391, 0.125, -0.465536, -1.17506, 0.125, -0.314855, -1.17506, 0.125, -0.314855, -1.03937, 0.216506, -0.430518, -0.92388, 0.25, -0.382683, -0.808395, 0.216506, -0.334848, -0.723854, 0.125, -0.29983, -0.723854, 0.125, -0.29983, -0.69291, 0, -0.287012, -0.69291, 0, -0.287012, -0.723854, -0.125, -0.29983, -0.723854, -0.125, -0.29983, -0.808395, -0.216506, -0.334848, -0.92388, -0.25, -0.382683, -1.03937, -0.216506, -0.430518, -1.12391, -0.125, -0.465536, -1.17506, -0.125, -0.314855, -1.17506, -0.125, -0.314855, -1.08253, 0, -0.625, -1.05353, 0.125, -0.608253, -0.974279, 0.216506, -0.5625, -0.866026, 0.25, -0.5, -0.757772, 0.216506, -0.4375, -0.678525, 0.125, -0.391747, -0.723854, 0.125, -0.29983, -0.723854, 0.125, -0.29983, -0.649519, 0, -0.375, -0.649519, 0, -0.375, -0.678525, -0.125, -0.391747, -0.723854, -0.125, -0.29983, -0.723854, -0.125, -0.29983, -0.757772, -0.216506, -0.4375, -0.866026, -0.25, -0.5, -0.974279, -0.216506, -0.5625, -1.05353, -0.125, -0.608253, -0.991692, 0, -0.760952, -0.965119, 0.125, -0.740562, -0.892522, 0.216506, -0.684857, -0.793353, 0.25, -0.608761, -0.694184, 0.216506, -0.532666, -0.621587, 0.125, -0.476961, -0.595015, 0, -0.456571, -0.595015, 0, -0.456571, -0.621587, -0.125, -0.476961, -0.694184, -0.216506, -0.532666, -0.793353, -0.25, -0.608761, -0.892522, -0.216506, -0.684857, -0.965119, -0.125, -0.740562, -0.883884, 0, -0.883883, -0.8602, 0.125, -0.8602, -0.795495, 0.216506, -0.795495, -0.707107, 0.25, -0.707107, -0.618719, 0.216506, -0.618718, -0.554014, 0.125, -0.554013, -0.554014, 0.125, -0.554013, -0.53033, 0, -0.53033, -0.53033, 0, -0.53033, -0.554014, -0.125, -0.554013, -0.554014, -0.125, -0.554013, -0.618719, -0.216506, -0.618718, -0.707107, -0.25, -0.707107, -0.795495, -0.216506, -0.795495, -0.8602, -0.125, -0.8602, -0.760952, 0, -0.991691, -0.740563, 0.125, -0.965119, -0.684857, 0.216506, -0.892522, -0.608762, 0.25, -0.793353, -0.532667, 0.216506, -0.694184, -0.476961, 0.125, -0.621587, -0.554014, 0.125, -0.554013, -0.554014, 0.125, -0.554013, -0.456571, 0, -0.595015, -0.456571, 0, -0.595015, -0.476961, -0.125, -0.621587, -0.554014, -0.125, -0.554013, -0.554014, -0.125, -0.554013, -0.532667, -0.216506, -0.694184, -0.608762, -0.25, -0.793353, -0.684857, -0.216506, -0.892522, -0.740563, -0.125, -0.965119, -0.625, 0, -1.08253, -0.608253, 0.125, -1.05353, -0.5625, 0.216506, -0.974279, -0.5, 0.25, -0.866026, -0.4375, 0.216506, -0.757772, -0.391747, 0.125, -0.678525, -0.375, 0, -0.649519, -0.375, 0, -0.649519, -0.391747, -0.125, -0.678525, -0.4375, -0.216506, -0.757772, -0.5, -0.25, -0.866026, -0.5625, -0.216506, -0.974279, -0.608253, -0.125, -1.05353, -0.478354, 0, -1.15485, -0.465537, 0.125, -1.1239, -0.430519, 0.216506, -1.03936, -0.382684, 0.25, -0.92388, -0.334848, 0.216506, -0.808395, -0.29983, 0.125, -0.723854, -0.29983, 0.125, -0.723854, -0.287013, 0, -0.69291, -0.287013, 0, -0.69291, -0.29983, -0.125, -0.723854, -0.29983, -0.125, -0.723854, -0.334848, -0.216506, -0.808395, -0.382684, -0.25, -0.92388, -0.430519, -0.216506, -1.03936, -0.465537, -0.125, -1.1239, -0.323524, 0, -1.20741, -0.314855, 0.125, -1.17506, -0.314855, 0.125, -1.17506, -0.291172, 0.216506, -1.08667, -0.258819, 0.25, -0.965926, -0.226467, 0.216506, -0.845185, -0.202783, 0.125, -0.756797, -0.29983, 0.125, -0.723854, -0.29983, 0.125, -0.723854, -0.194115, 0, -0.724444, -0.194115, 0, -0.724444, -0.202783, -0.125, -0.756797, -0.29983, -0.125, -0.723854, -0.29983, -0.125, -0.723854, -0.226467, -0.216506, -0.845185, -0.258819, -0.25, -0.965926, -0.291172, -0.216506, -1.08667, -0.314855, -0.125, -1.17506, -0.314855, -0.125, -1.17506, -0.163158, 0, -1.23931, -0.158787, 0.125, -1.2061, -0.314855, 0.125, -1.17506, -0.314855, 0.125, -1.17506, -0.146843, 0.216506, -1.11538, -0.130527, 0.25, -0.991445, -0.114211, 0.216506, -0.867514, -0.102267, 0.125, -0.776791, -0.097895, 0, -0.743584, -0.097895, 0, -0.743584, -0.102267, -0.125, -0.776791, -0.114211, -0.216506, -0.867514, -0.130527, -0.25, -0.991445, -0.146843, -0.216506, -1.11538, -0.158787, -0.125, -1.2061, -0.314855, -0.125, -1.17506, -0.314855, -0.125, -1.17506, 0, 0, -1.25, 0, 0.125, -1.21651, 0, 0.125, -1.21651, 0, 0.216506, -1.125, 0, 0.25, -1, 0, 0.216506, -0.875, 0, 0.125, -0.783494, 0, 0, -0.75, 0, 0, -0.75, 0, -0.125, -0.783494, 0, -0.216506, -0.875, 0, -0.25, -1, 0, -0.216506, -1.125, 0, -0.125, -1.21651, 0, -0.125, -1.21651, 0.163158, 0, -1.23931, 0.158786, 0.125, -1.2061, 0, 0.125, -1.21651, 0, 0.125, -1.21651, 0.146842, 0.216506, -1.11538, 0.130526, 0.25, -0.991445, 0.11421, 0.216506, -0.867514, 0.102266, 0.125, -0.776791, 0.097895, 0, -0.743584, 0.097895, 0, -0.743584, 0.102266, -0.125, -0.776791, 0.11421, -0.216506, -0.867514, 0.130526, -0.25, -0.991445, 0.146842, -0.216506, -1.11538, 0.158786, -0.125, -1.2061, 0, -0.125, -1.21651, 0, -0.125, -1.21651, 0.323523, 0, -1.20741, 0.314854, 0.125, -1.17506, 0.314854, 0.125, -1.17506, 0.291171, 0.216506, -1.08667, 0.258819, 0.25, -0.965926, 0.226466, 0.216506, -0.845185, 0.202783, 0.125, -0.756797, 0.194114, 0, -0.724444, 0.194114, 0, -0.724444, 0.202783, -0.125, -0.756797, 0.226466, -0.216506, -0.845185, 0.258819, -0.25, -0.965926, 0.291171, -0.216506, -1.08667, 0.314854, -0.125, -1.17506, 0.314854, -0.125, -1.17506, 0.478355, 0, -1.15485, 0.465537, 0.125, -1.1239, 0.314854, 0.125, -1.17506, 0.314854, 0.125, -1.17506, 0.430519, 0.216506, -1.03936, 0.382684, 0.25, -0.923879, 0.334848, 0.216506, -0.808394, 0.29983, 0.125, -0.723854, 0.29983, 0.125, -0.723854, 0.287013, 0, -0.69291, 0.287013, 0, -0.69291, 0.29983, -0.125, -0.723854, 0.29983, -0.125, -0.723854, 0.334848, -0.216506, -0.808394, 0.382684, -0.25, -0.923879, 0.430519, -0.216506, -1.03936, 0.465537, -0.125, -1.1239, 0.314854, -0.125, -1.17506, 0.314854, -0.125, -1.17506, 0.625, 0, -1.08253, 0.608253, 0.125, -1.05352, 0.5625, 0.216506, -0.974279, 0.5, 0.25, -0.866025, 0.4375, 0.216506, -0.757772, 0.391747, 0.125, -0.678525, 0.29983, 0.125, -0.723854, 0.29983, 0.125, -0.723854, 0.375, 0, -0.649519, 0.375, 0, -0.649519, 0.391747, -0.125, -0.678525, 0.29983, -0.125, -0.723854, 0.29983, -0.125, -0.723854, 0.4375, -0.216506, -0.757772, 0.5, -0.25, -0.866025, 0.5625, -0.216506, -0.974279, 0.608253, -0.125, -1.05352, 0.760952, 0, -0.991692, 0.740562, 0.125, -0.96512, 0.684856, 0.216506, -0.892523, 0.608761, 0.25, -0.793353, 0.532666, 0.216506, -0.694184, 0.476961, 0.125, -0.621587, 0.456571, 0, -0.595015, 0.456571, 0, -0.595015, 0.476961, -0.125, -0.621587, 0.532666, -0.216506, -0.694184, 0.608761, -0.25, -0.793353, 0.684856, -0.216506, -0.892523, 0.740562, -0.125, -0.96512, 0.883883, 0, -0.883884, 0.860199, 0.125, -0.8602, 0.795495, 0.216506, -0.795496, 0.707106, 0.25, -0.707107, 0.618718, 0.216506, -0.618719, 0.554013, 0.125, -0.554014, 0.554013, 0.125, -0.554014, 0.53033, 0, -0.53033, 0.53033, 0, -0.53033, 0.554013, -0.125, -0.554014, 0.554013, -0.125, -0.554014, 0.618718, -0.216506, -0.618719, 0.707106, -0.25, -0.707107, 0.795495, -0.216506, -0.795496, 0.860199, -0.125, -0.8602, 0.991692, 0, -0.760952, 0.965119, 0.125, -0.740562, 0.892523, 0.216506, -0.684856, 0.793353, 0.25, -0.608761, 0.694184, 0.216506, -0.532666, 0.621587, 0.125, -0.476961, 0.554013, 0.125, -0.554014, 0.554013, 0.125, -0.554014, 0.595015, 0, -0.456571, 0.595015, 0, -0.456571, 0.621587, -0.125, -0.476961, 0.554013, -0.125, -0.554014, 0.554013, -0.125, -0.554014, 0.694184, -0.216506, -0.532666, 0.793353, -0.25, -0.608761, 0.892523, -0.216506, -0.684856, 0.965119, -0.125, -0.740562, 1.08253, 0, -0.625, 1.05352, 0.125, -0.608253, 0.974279, 0.216506, -0.5625, 0.866025, 0.25, -0.5, 0.757772, 0.216506, -0.4375, 0.678525, 0.125, -0.391747, 0.649519, 0, -0.375, 0.649519, 0, -0.375, 0.678525, -0.125, -0.391747, 0.757772, -0.216506, -0.4375, 0.866025, -0.25, -0.5, 0.974279, -0.216506, -0.5625, 1.05352, -0.125, -0.608253, 1.15485, 0, -0.478355, 1.1239, 0.125, -0.465537, 1.03936, 0.216506, -0.430519, 0.923879, 0.25, -0.382684, 0.808394, 0.216506, -0.334848, 0.723854, 0.125, -0.29983, 0.723854, 0.125, -0.29983, 0.69291, 0, -0.287013, 0.69291, 0, -0.287013, 0.723854, -0.125, -0.29983, 0.723854, -0.125, -0.29983, 0.808394, -0.216506, -0.334848, 0.923879, -0.25, -0.382684, 1.03936, -0.216506, -0.430519, 1.1239, -0.125, -0.465537, 1.20741, 0, -0.323523, 1.17506, 0.125, -0.314855, 1.17506, 0.125, -0.314855, 1.08667, 0.216506, -0.291171, 0.965926, 0.25, -0.258819, 0.845185, 0.216506, -0.226466, 0.756797, 0.125, -0.202783, 0.723854, 0.125, -0.29983, 0.723854, 0.125, -0.29983, 0.724444, 0, -0.194114, 0.724444, 0, -0.194114, 0.756797, -0.125, -0.202783, 0.723854, -0.125, -0.29983, 0.723854, -0.125, -0.29983, 0.845185, -0.216506, -0.226466, 0.965926, -0.25, -0.258819, 1.08667, -0.216506, -0.291171, 1.17506, -0.125, -0.314855, 1.17506, -0.125, -0.314855, 1.23931, 0, -0.163158, 1.2061, 0.125, -0.158786, 1.17506, 0.125, -0.314855, 1.17506, 0.125, -0.314855, 1.11538, 0.216506, -0.146842, 0.991445, 0.25, -0.130526, 0.867514, 0.216506, -0.11421, 0.776791, 0.125, -0.102266, 0.743584, 0, -0.097895, 0.743584, 0, -0.097895, 0.776791, -0.125, -0.102266, 0.867514, -0.216506, -0.11421, 0.991445, -0.25, -0.130526, 1.11538, -0.216506, -0.146842, 1.2061, -0.125, -0.158786, 1.17506, -0.125, -0.314855, 1.17506, -0.125, -0.314855, 1.21651, 0.125, -0, 1.21651, 0.125, -0, 1.21651, -0.125, -0, 1.21651, -0.125, -0
-};
-
-float mUVs[] = {
-0.5, 0.5, 0.520833, 0.5, 0.520833, 0.416667, 0.5, 0.416667, 0.5, 0.416667, 0.520833, 0.333333, 0.5, 0.333333, 0.520833, 0.25, 0.5, 0.25, 0.520833, 0.166667, 0.5, 0.166667, 0.520833, 0.083333, 0.5, 0.083333, 0.520833, 0, 0.5, 0, 0.5, 1, 0.520833, 1, 0.520833, 0.916667, 0.5, 0.916667, 0.520833, 0.833333, 0.5, 0.833333, 0.520833, 0.75, 0.5, 0.75, 0.520833, 0.666667, 0.5, 0.666667, 0.520833, 0.583333, 0.5, 0.583333, 0.5, 0.583333, 0.541667, 0.5, 0.541667, 0.416667, 0.541667, 0.416667, 0.541667, 0.333333, 0.541667, 0.25, 0.541667, 0.166667, 0.541667, 0.083333, 0.541667, 0, 0.541667, 1, 0.541667, 0.916667, 0.541667, 0.833333, 0.541667, 0.75, 0.541667, 0.666667, 0.541667, 0.583333, 0.541667, 0.583333, 0.5625, 0.5, 0.5625, 0.416667, 0.541667, 0.416667, 0.541667, 0.416667, 0.5625, 0.333333, 0.5625, 0.25, 0.5625, 0.166667, 0.5625, 0.083333, 0.5625, 0.083333, 0.5625, 0, 0.5625, 1, 0.5625, 0.916667, 0.5625, 0.916667, 0.5625, 0.833333, 0.5625, 0.75, 0.5625, 0.666667, 0.5625, 0.583333, 0.541667, 0.583333, 0.541667, 0.583333, 0.583333, 0.5, 0.583333, 0.416667, 0.583333, 0.333333, 0.583333, 0.25, 0.583333, 0.166667, 0.583333, 0.083333, 0.5625, 0.083333, 0.5625, 0.083333, 0.583333, 0, 0.583333, 1, 0.583333, 0.916667, 0.5625, 0.916667, 0.5625, 0.916667, 0.583333, 0.833333, 0.583333, 0.75, 0.583333, 0.666667, 0.583333, 0.583333, 0.604167, 0.5, 0.604167, 0.416667, 0.604167, 0.333333, 0.604167, 0.25, 0.604167, 0.166667, 0.604167, 0.083333, 0.604167, 0, 0.604167, 1, 0.604167, 0.916667, 0.604167, 0.833333, 0.604167, 0.75, 0.604167, 0.666667, 0.604167, 0.583333, 0.625, 0.5, 0.625, 0.416667, 0.625, 0.333333, 0.625, 0.25, 0.625, 0.166667, 0.625, 0.083333, 0.625, 0.083333, 0.625, 0, 0.625, 1, 0.625, 0.916667, 0.625, 0.916667, 0.625, 0.833333, 0.625, 0.75, 0.625, 0.666667, 0.625, 0.583333, 0.645833, 0.5, 0.645833, 0.416667, 0.645833, 0.333333, 0.645833, 0.25, 0.645833, 0.166667, 0.645833, 0.083333, 0.625, 0.083333, 0.625, 0.083333, 0.645833, 0, 0.645833, 1, 0.645833, 0.916667, 0.625, 0.916667, 0.625, 0.916667, 0.645833, 0.833333, 0.645833, 0.75, 0.645833, 0.666667, 0.645833, 0.583333, 0.666667, 0.5, 0.666667, 0.416667, 0.666667, 0.333333, 0.666667, 0.25, 0.666667, 0.166667, 0.666667, 0.083333, 0.666667, 0, 0.666667, 1, 0.666667, 0.916667, 0.666667, 0.833333, 0.666667, 0.75, 0.666667, 0.666667, 0.666667, 0.583333, 0.6875, 0.5, 0.6875, 0.416667, 0.6875, 0.333333, 0.6875, 0.25, 0.6875, 0.166667, 0.6875, 0.083333, 0.6875, 0.083333, 0.6875, 0, 0.6875, 1, 0.6875, 0.916667, 0.6875, 0.916667, 0.6875, 0.833333, 0.6875, 0.75, 0.6875, 0.666667, 0.6875, 0.583333, 0.708333, 0.5, 0.708333, 0.416667, 0.708333, 0.416667, 0.708333, 0.333333, 0.708333, 0.25, 0.708333, 0.166667, 0.708333, 0.083333, 0.6875, 0.083333, 0.6875, 0.083333, 0.708333, 0, 0.708333, 1, 0.708333, 0.916667, 0.6875, 0.916667, 0.6875, 0.916667, 0.708333, 0.833333, 0.708333, 0.75, 0.708333, 0.666667, 0.708333, 0.583333, 0.708333, 0.583333, 0.729167, 0.5, 0.729167, 0.416667, 0.708333, 0.416667, 0.708333, 0.416667, 0.729167, 0.333333, 0.729167, 0.25, 0.729167, 0.166667, 0.729167, 0.083333, 0.729167, 0, 0.729167, 1, 0.729167, 0.916667, 0.729167, 0.833333, 0.729167, 0.75, 0.729167, 0.666667, 0.729167, 0.583333, 0.708333, 0.583333, 0.708333, 0.583333, 0.75, 0.5, 0.75, 0.416667, 0.75, 0.416667, 0.75, 0.333333, 0.75, 0.25, 0.75, 0.166667, 0.75, 0.083333, 0.75, 0, 0.75, 1, 0.75, 0.916667, 0.75, 0.833333, 0.75, 0.75, 0.75, 0.666667, 0.75, 0.583333, 0.75, 0.583333, 0.770833, 0.5, 0.770833, 0.416667, 0.75, 0.416667, 0.75, 0.416667, 0.770833, 0.333333, 0.770833, 0.25, 0.770833, 0.166667, 0.770833, 0.083333, 0.770833, 0, 0.770833, 1, 0.770833, 0.916667, 0.770833, 0.833333, 0.770833, 0.75, 0.770833, 0.666667, 0.770833, 0.583333, 0.75, 0.583333, 0.75, 0.583333, 0.791667, 0.5, 0.791667, 0.416667, 0.791667, 0.416667, 0.791667, 0.333333, 0.791667, 0.25, 0.791667, 0.166667, 0.791667, 0.083333, 0.791667, 0, 0.791667, 1, 0.791667, 0.916667, 0.791667, 0.833333, 0.791667, 0.75, 0.791667, 0.666667, 0.791667, 0.583333, 0.791667, 0.583333, 0.8125, 0.5, 0.8125, 0.416667, 0.791667, 0.416667, 0.791667, 0.416667, 0.8125, 0.333333, 0.8125, 0.25, 0.8125, 0.166667, 0.8125, 0.083333, 0.8125, 0.083333, 0.8125, 0, 0.8125, 1, 0.8125, 0.916667, 0.8125, 0.916667, 0.8125, 0.833333, 0.8125, 0.75, 0.8125, 0.666667, 0.8125, 0.583333, 0.791667, 0.583333, 0.791667, 0.583333, 0.833333, 0.5, 0.833333, 0.416667, 0.833333, 0.333333, 0.833333, 0.25, 0.833333, 0.166667, 0.833333, 0.083333, 0.8125, 0.083333, 0.8125, 0.083333, 0.833333, 0, 0.833333, 1, 0.833333, 0.916667, 0.8125, 0.916667, 0.8125, 0.916667, 0.833333, 0.833333, 0.833333, 0.75, 0.833333, 0.666667, 0.833333, 0.583333, 0.854167, 0.5, 0.854167, 0.416667, 0.854167, 0.333333, 0.854167, 0.25, 0.854167, 0.166667, 0.854167, 0.083333, 0.854167, 0, 0.854167, 1, 0.854167, 0.916667, 0.854167, 0.833333, 0.854167, 0.75, 0.854167, 0.666667, 0.854167, 0.583333, 0.875, 0.5, 0.875, 0.416667, 0.875, 0.333333, 0.875, 0.25, 0.875, 0.166667, 0.875, 0.083333, 0.875, 0.083333, 0.875, 0, 0.875, 1, 0.875, 0.916667, 0.875, 0.916667, 0.875, 0.833333, 0.875, 0.75, 0.875, 0.666667, 0.875, 0.583333, 0.895833, 0.5, 0.895833, 0.416667, 0.895833, 0.333333, 0.895833, 0.25, 0.895833, 0.166667, 0.895833, 0.083333, 0.875, 0.083333, 0.875, 0.083333, 0.895833, 0, 0.895833, 1, 0.895833, 0.916667, 0.875, 0.916667, 0.875, 0.916667, 0.895833, 0.833333, 0.895833, 0.75, 0.895833, 0.666667, 0.895833, 0.583333, 0.916667, 0.5, 0.916667, 0.416667, 0.916667, 0.333333, 0.916667, 0.25, 0.916667, 0.166667, 0.916667, 0.083333, 0.916667, 0, 0.916667, 1, 0.916667, 0.916667, 0.916667, 0.833333, 0.916667, 0.75, 0.916667, 0.666667, 0.916667, 0.583333, 0.9375, 0.5, 0.9375, 0.416667, 0.9375, 0.333333, 0.9375, 0.25, 0.9375, 0.166667, 0.9375, 0.083333, 0.9375, 0.083333, 0.9375, 0, 0.9375, 1, 0.9375, 0.916667, 0.9375, 0.916667, 0.9375, 0.833333, 0.9375, 0.75, 0.9375, 0.666667, 0.9375, 0.583333, 0.958333, 0.5, 0.958333, 0.416667, 0.958333, 0.416667, 0.958333, 0.333333, 0.958333, 0.25, 0.958333, 0.166667, 0.958333, 0.083333, 0.9375, 0.083333, 0.9375, 0.083333, 0.958333, 0, 0.958333, 1, 0.958333, 0.916667, 0.9375, 0.916667, 0.9375, 0.916667, 0.958333, 0.833333, 0.958333, 0.75, 0.958333, 0.666667, 0.958333, 0.583333, 0.958333, 0.583333, 0.979167, 0.5, 0.979167, 0.416667, 0.958333, 0.416667, 0.958333, 0.416667, 0.979167, 0.333333, 0.979167, 0.25, 0.979167, 0.166667, 0.979167, 0.083333, 0.979167, 0, 0.979167, 1, 0.979167, 0.916667, 0.979167, 0.833333, 0.979167, 0.75, 0.979167, 0.666667, 0.979167, 0.583333, 0.958333, 0.583333, 0.958333, 0.583333, 1, 0.5, 1, 0.416667, 1, 0.416667, 1, 0.333333, 1, 0.25, 1, 0.166667, 1, 0.083333, 1, 0, 1, 1, 1, 0.916667, 1, 0.833333, 1, 0.75, 1, 0.666667, 1, 0.583333, 1, 0.583333, 0, 0.5, 0.020833, 0.5, 0.020833, 0.416667, 0, 0.416667, 0, 0.416667, 0.020833, 0.333333, 0, 0.333333, 0.020833, 0.25, 0, 0.25, 0.020833, 0.166667, 0, 0.166667, 0.020833, 0.083333, 0, 0.083333, 0.020833, 0, 0, 0, 0, 1, 0.020833, 1, 0.020833, 0.916667, 0, 0.916667, 0.020833, 0.833333, 0, 0.833333, 0.020833, 0.75, 0, 0.75, 0.020833, 0.666667, 0, 0.666667, 0.020833, 0.583333, 0, 0.583333, 0, 0.583333, 0.041667, 0.5, 0.041667, 0.416667, 0.041667, 0.416667, 0.041667, 0.333333, 0.041667, 0.25, 0.041667, 0.166667, 0.041667, 0.083333, 0.041667, 0, 0.041667, 1, 0.041667, 0.916667, 0.041667, 0.833333, 0.041667, 0.75, 0.041667, 0.666667, 0.041667, 0.583333, 0.041667, 0.583333, 0.0625, 0.5, 0.0625, 0.416667, 0.041667, 0.416667, 0.041667, 0.416667, 0.0625, 0.333333, 0.0625, 0.25, 0.0625, 0.166667, 0.0625, 0.083333, 0.0625, 0.083333, 0.0625, 0, 0.0625, 1, 0.0625, 0.916667, 0.0625, 0.916667, 0.0625, 0.833333, 0.0625, 0.75, 0.0625, 0.666667, 0.0625, 0.583333, 0.041667, 0.583333, 0.041667, 0.583333, 0.083333, 0.5, 0.083333, 0.416667, 0.083333, 0.333333, 0.083333, 0.25, 0.083333, 0.166667, 0.083333, 0.083333, 0.0625, 0.083333, 0.0625, 0.083333, 0.083333, 0, 0.083333, 1, 0.083333, 0.916667, 0.0625, 0.916667, 0.0625, 0.916667, 0.083333, 0.833333, 0.083333, 0.75, 0.083333, 0.666667, 0.083333, 0.583333, 0.104167, 0.5, 0.104167, 0.416667, 0.104167, 0.333333, 0.104167, 0.25, 0.104167, 0.166667, 0.104167, 0.083333, 0.104167, 0, 0.104167, 1, 0.104167, 0.916667, 0.104167, 0.833333, 0.104167, 0.75, 0.104167, 0.666667, 0.104167, 0.583333, 0.125, 0.5, 0.125, 0.416667, 0.125, 0.333333, 0.125, 0.25, 0.125, 0.166667, 0.125, 0.083333, 0.125, 0.083333, 0.125, 0, 0.125, 1, 0.125, 0.916667, 0.125, 0.916667, 0.125, 0.833333, 0.125, 0.75, 0.125, 0.666667, 0.125, 0.583333, 0.145833, 0.5, 0.145833, 0.416667, 0.145833, 0.333333, 0.145833, 0.25, 0.145833, 0.166667, 0.145833, 0.083333, 0.125, 0.083333, 0.125, 0.083333, 0.145833, 0, 0.145833, 1, 0.145833, 0.916667, 0.125, 0.916667, 0.125, 0.916667, 0.145833, 0.833333, 0.145833, 0.75, 0.145833, 0.666667, 0.145833, 0.583333, 0.166667, 0.5, 0.166667, 0.416667, 0.166667, 0.333333, 0.166667, 0.25, 0.166667, 0.166667, 0.166667, 0.083333, 0.166667, 0, 0.166667, 1, 0.166667, 0.916667, 0.166667, 0.833333, 0.166667, 0.75, 0.166667, 0.666667, 0.166667, 0.583333, 0.1875, 0.5, 0.1875, 0.416667, 0.1875, 0.333333, 0.1875, 0.25, 0.1875, 0.166667, 0.1875, 0.083333, 0.1875, 0.083333, 0.1875, 0, 0.1875, 1, 0.1875, 0.916667, 0.1875, 0.916667, 0.1875, 0.833333, 0.1875, 0.75, 0.1875, 0.666667, 0.1875, 0.583333, 0.208333, 0.5, 0.208333, 0.416667, 0.208333, 0.416667, 0.208333, 0.333333, 0.208333, 0.25, 0.208333, 0.166667, 0.208333, 0.083333, 0.1875, 0.083333, 0.1875, 0.083333, 0.208333, 0, 0.208333, 1, 0.208333, 0.916667, 0.1875, 0.916667, 0.1875, 0.916667, 0.208333, 0.833333, 0.208333, 0.75, 0.208333, 0.666667, 0.208333, 0.583333, 0.208333, 0.583333, 0.229167, 0.5, 0.229167, 0.416667, 0.208333, 0.416667, 0.208333, 0.416667, 0.229167, 0.333333, 0.229167, 0.25, 0.229167, 0.166667, 0.229167, 0.083333, 0.229167, 0, 0.229167, 1, 0.229167, 0.916667, 0.229167, 0.833333, 0.229167, 0.75, 0.229167, 0.666667, 0.229167, 0.583333, 0.208333, 0.583333, 0.208333, 0.583333, 0.25, 0.5, 0.25, 0.416667, 0.25, 0.416667, 0.25, 0.333333, 0.25, 0.25, 0.25, 0.166667, 0.25, 0.083333, 0.25, 0, 0.25, 1, 0.25, 0.916667, 0.25, 0.833333, 0.25, 0.75, 0.25, 0.666667, 0.25, 0.583333, 0.25, 0.583333, 0.270833, 0.5, 0.270833, 0.416667, 0.25, 0.416667, 0.25, 0.416667, 0.270833, 0.333333, 0.270833, 0.25, 0.270833, 0.166667, 0.270833, 0.083333, 0.270833, 0, 0.270833, 1, 0.270833, 0.916667, 0.270833, 0.833333, 0.270833, 0.75, 0.270833, 0.666667, 0.270833, 0.583333, 0.25, 0.583333, 0.25, 0.583333, 0.291667, 0.5, 0.291667, 0.416667, 0.291667, 0.416667, 0.291667, 0.333333, 0.291667, 0.25, 0.291667, 0.166667, 0.291667, 0.083333, 0.291667, 0, 0.291667, 1, 0.291667, 0.916667, 0.291667, 0.833333, 0.291667, 0.75, 0.291667, 0.666667, 0.291667, 0.583333, 0.291667, 0.583333, 0.3125, 0.5, 0.3125, 0.416667, 0.291667, 0.416667, 0.291667, 0.416667, 0.3125, 0.333333, 0.3125, 0.25, 0.3125, 0.166667, 0.3125, 0.083333, 0.3125, 0.083333, 0.3125, 0, 0.3125, 1, 0.3125, 0.916667, 0.3125, 0.916667, 0.3125, 0.833333, 0.3125, 0.75, 0.3125, 0.666667, 0.3125, 0.583333, 0.291667, 0.583333, 0.291667, 0.583333, 0.333333, 0.5, 0.333333, 0.416667, 0.333333, 0.333333, 0.333333, 0.25, 0.333333, 0.166667, 0.333333, 0.083333, 0.3125, 0.083333, 0.3125, 0.083333, 0.333333, 0, 0.333333, 1, 0.333333, 0.916667, 0.3125, 0.916667, 0.3125, 0.916667, 0.333333, 0.833333, 0.333333, 0.75, 0.333333, 0.666667, 0.333333, 0.583333, 0.354167, 0.5, 0.354167, 0.416667, 0.354167, 0.333333, 0.354167, 0.25, 0.354167, 0.166667, 0.354167, 0.083333, 0.354167, 0, 0.354167, 1, 0.354167, 0.916667, 0.354167, 0.833333, 0.354167, 0.75, 0.354167, 0.666667, 0.354167, 0.583333, 0.375, 0.5, 0.375, 0.416667, 0.375, 0.333333, 0.375, 0.25, 0.375, 0.166667, 0.375, 0.083333, 0.375, 0.083333, 0.375, 0, 0.375, 1, 0.375, 0.916667, 0.375, 0.916667, 0.375, 0.833333, 0.375, 0.75, 0.375, 0.666667, 0.375, 0.583333, 0.395833, 0.5, 0.395833, 0.416667, 0.395833, 0.333333, 0.395833, 0.25, 0.395833, 0.166667, 0.395833, 0.083333, 0.375, 0.083333, 0.375, 0.083333, 0.395833, 0, 0.395833, 1, 0.395833, 0.916667, 0.375, 0.916667, 0.375, 0.916667, 0.395833, 0.833333, 0.395833, 0.75, 0.395833, 0.666667, 0.395833, 0.583333, 0.416667, 0.5, 0.416667, 0.416667, 0.416667, 0.333333, 0.416667, 0.25, 0.416667, 0.166667, 0.416667, 0.083333, 0.416667, 0, 0.416667, 1, 0.416667, 0.916667, 0.416667, 0.833333, 0.416667, 0.75, 0.416667, 0.666667, 0.416667, 0.583333, 0.4375, 0.5, 0.4375, 0.416667, 0.4375, 0.333333, 0.4375, 0.25, 0.4375, 0.166667, 0.4375, 0.083333, 0.4375, 0.083333, 0.4375, 0, 0.4375, 1, 0.4375, 0.916667, 0.4375, 0.916667, 0.4375, 0.833333, 0.4375, 0.75, 0.4375, 0.666667, 0.4375, 0.583333, 0.458333, 0.5, 0.458333, 0.416667, 0.458333, 0.416667, 0.458333, 0.333333, 0.458333, 0.25, 0.458333, 0.166667, 0.458333, 0.083333, 0.4375, 0.083333, 0.4375, 0.083333, 0.458333, 0, 0.458333, 1, 0.458333, 0.916667, 0.4375, 0.916667, 0.4375, 0.916667, 0.458333, 0.833333, 0.458333, 0.75, 0.458333, 0.666667, 0.458333, 0.583333, 0.458333, 0.583333, 0.479167, 0.5, 0.479167, 0.416667, 0.458333, 0.416667, 0.458333, 0.416667, 0.479167, 0.333333, 0.479167, 0.25, 0.479167, 0.166667, 0.479167, 0.083333, 0.479167, 0, 0.479167, 1, 0.479167, 0.916667, 0.479167, 0.833333, 0.479167, 0.75, 0.479167, 0.666667, 0.479167, 0.583333, 0.458333, 0.583333, 0.458333, 0.583333, 0.5, 0.416667, 0.5, 0.416667, 0.5, 0.583333, 0.5, 0.583333
-};
-
-float mNormals[] = {
-1, 0, -0, 0.9914, 0, 0.1305, 0.8612, 0.4954, 0.1134, 0.8686, 0.4954, -0, 0.8686, 0.4954, -0, 0.5036, 0.8614, 0.0663, 0.508, 0.8614, -0, 0.0107, 0.9999, 0.0014, 0.0108, 0.9999, -0, -0.4876, 0.8707, -0.0642, -0.4918, 0.8707, -0, -0.8559, 0.5047, -0.1127, -0.8633, 0.5047, -0, -0.9914, 0, -0.1305, -1, 0, -0, -1, 0, -0, -0.9914, 0, -0.1305, -0.8559, -0.5047, -0.1127, -0.8633, -0.5047, -0, -0.4876, -0.8707, -0.0642, -0.4918, -0.8707, -0, 0.0107, -0.9999, 0.0014, 0.0108, -0.9999, -0, 0.5036, -0.8614, 0.0663, 0.508, -0.8614, -0, 0.8612, -0.4954, 0.1134, 0.8686, -0.4954, -0, 0.8686, -0.4954, -0, 0.9659, 0, 0.2588, 0.839, 0.4954, 0.2248, 0.839, 0.4954, 0.2248, 0.4907, 0.8614, 0.1315, 0.0104, 0.9999, 0.0028, -0.4751, 0.8707, -0.1273, -0.8339, 0.5047, -0.2234, -0.9659, 0, -0.2588, -0.9659, 0, -0.2588, -0.8339, -0.5047, -0.2234, -0.4751, -0.8707, -0.1273, 0.0104, -0.9999, 0.0028, 0.4907, -0.8614, 0.1315, 0.839, -0.4954, 0.2248, 0.839, -0.4954, 0.2248, 0.9239, 0, 0.3827, 0.8025, 0.4954, 0.3324, 0.839, 0.4954, 0.2248, 0.839, 0.4954, 0.2248, 0.4693, 0.8614, 0.1944, 0.0099, 0.9999, 0.0041, -0.4544, 0.8707, -0.1882, -0.7975, 0.5047, -0.3304, -0.7975, 0.5047, -0.3304, -0.9239, 0, -0.3827, -0.9239, 0, -0.3827, -0.7975, -0.5047, -0.3304, -0.7975, -0.5047, -0.3304, -0.4544, -0.8707, -0.1882, 0.0099, -0.9999, 0.0041, 0.4693, -0.8614, 0.1944, 0.8025, -0.4954, 0.3324, 0.839, -0.4954, 0.2248, 0.839, -0.4954, 0.2248, 0.866, 0, 0.5, 0.7523, 0.4954, 0.4343, 0.4399, 0.8614, 0.254, 0.0093, 0.9999, 0.0054, -0.4259, 0.8707, -0.2459, -0.7476, 0.5047, -0.4316, -0.7975, 0.5047, -0.3304, -0.7975, 0.5047, -0.3304, -0.866, 0, -0.5, -0.866, 0, -0.5, -0.7476, -0.5047, -0.4316, -0.7975, -0.5047, -0.3304, -0.7975, -0.5047, -0.3304, -0.4259, -0.8707, -0.2459, 0.0093, -0.9999, 0.0054, 0.4399, -0.8614, 0.254, 0.7523, -0.4954, 0.4343, 0.7933, 0, 0.6088, 0.6891, 0.4954, 0.5288, 0.403, 0.8614, 0.3092, 0.0085, 0.9999, 0.0066, -0.3902, 0.8707, -0.2994, -0.6849, 0.5047, -0.5255, -0.7933, 0, -0.6088, -0.7933, 0, -0.6088, -0.6849, -0.5047, -0.5255, -0.3902, -0.8707, -0.2994, 0.0085, -0.9999, 0.0066, 0.403, -0.8614, 0.3092, 0.6891, -0.4954, 0.5288, 0.7071, 0, 0.7071, 0.6142, 0.4954, 0.6142, 0.3592, 0.8614, 0.3592, 0.0076, 0.9999, 0.0076, -0.3478, 0.8707, -0.3478, -0.6104, 0.5047, -0.6104, -0.6104, 0.5047, -0.6104, -0.7071, 0, -0.7071, -0.7071, 0, -0.7071, -0.6104, -0.5047, -0.6104, -0.6104, -0.5047, -0.6104, -0.3478, -0.8707, -0.3478, 0.0076, -0.9999, 0.0076, 0.3592, -0.8614, 0.3592, 0.6142, -0.4954, 0.6142, 0.6088, 0, 0.7933, 0.5288, 0.4954, 0.6891, 0.3092, 0.8614, 0.403, 0.0066, 0.9999, 0.0085, -0.2994, 0.8707, -0.3902, -0.5255, 0.5047, -0.6849, -0.6104, 0.5047, -0.6104, -0.6104, 0.5047, -0.6104, -0.6088, 0, -0.7933, -0.6088, 0, -0.7933, -0.5255, -0.5047, -0.6849, -0.6104, -0.5047, -0.6104, -0.6104, -0.5047, -0.6104, -0.2994, -0.8707, -0.3902, 0.0066, -0.9999, 0.0085, 0.3092, -0.8614, 0.403, 0.5288, -0.4954, 0.6891, 0.5, 0, 0.866, 0.4343, 0.4954, 0.7523, 0.254, 0.8614, 0.4399, 0.0054, 0.9999, 0.0093, -0.2459, 0.8707, -0.4259, -0.4316, 0.5047, -0.7476, -0.5, 0, -0.866, -0.5, 0, -0.866, -0.4316, -0.5047, -0.7476, -0.2459, -0.8707, -0.4259, 0.0054, -0.9999, 0.0093, 0.254, -0.8614, 0.4399, 0.4343, -0.4954, 0.7523, 0.3827, 0, 0.9239, 0.3324, 0.4954, 0.8025, 0.1944, 0.8614, 0.4693, 0.0041, 0.9999, 0.0099, -0.1882, 0.8707, -0.4544, -0.3304, 0.5047, -0.7975, -0.3304, 0.5047, -0.7975, -0.3827, 0, -0.9239, -0.3827, 0, -0.9239, -0.3304, -0.5047, -0.7975, -0.3304, -0.5047, -0.7975, -0.1882, -0.8707, -0.4544, 0.0041, -0.9999, 0.0099, 0.1944, -0.8614, 0.4693, 0.3324, -0.4954, 0.8025, 0.2588, 0, 0.9659, 0.2248, 0.4954, 0.839, 0.2248, 0.4954, 0.839, 0.1315, 0.8614, 0.4907, 0.0028, 0.9999, 0.0104, -0.1273, 0.8707, -0.4751, -0.2234, 0.5047, -0.8339, -0.3304, 0.5047, -0.7975, -0.3304, 0.5047, -0.7975, -0.2588, 0, -0.9659, -0.2588, 0, -0.9659, -0.2234, -0.5047, -0.8339, -0.3304, -0.5047, -0.7975, -0.3304, -0.5047, -0.7975, -0.1273, -0.8707, -0.4751, 0.0028, -0.9999, 0.0104, 0.1315, -0.8614, 0.4907, 0.2248, -0.4954, 0.839, 0.2248, -0.4954, 0.839, 0.1305, 0, 0.9914, 0.1134, 0.4954, 0.8612, 0.2248, 0.4954, 0.839, 0.2248, 0.4954, 0.839, 0.0663, 0.8614, 0.5036, 0.0014, 0.9999, 0.0107, -0.0642, 0.8707, -0.4876, -0.1127, 0.5047, -0.8559, -0.1305, 0, -0.9914, -0.1305, 0, -0.9914, -0.1127, -0.5047, -0.8559, -0.0642, -0.8707, -0.4876, 0.0014, -0.9999, 0.0107, 0.0663, -0.8614, 0.5036, 0.1134, -0.4954, 0.8612, 0.2248, -0.4954, 0.839, 0.2248, -0.4954, 0.839, 0, 0, 1, 0, 0.4954, 0.8686, 0, 0.4954, 0.8686, 0, 0.8614, 0.508, 0, 0.9999, 0.0108, 0, 0.8707, -0.4918, 0, 0.5047, -0.8633, 0, 0, -1, 0, 0, -1, 0, -0.5047, -0.8633, 0, -0.8707, -0.4918, 0, -0.9999, 0.0108, 0, -0.8614, 0.508, 0, -0.4954, 0.8686, 0, -0.4954, 0.8686, -0.1305, 0, 0.9914, -0.1134, 0.4954, 0.8612, 0, 0.4954, 0.8686, 0, 0.4954, 0.8686, -0.0663, 0.8614, 0.5036, -0.0014, 0.9999, 0.0107, 0.0642, 0.8707, -0.4876, 0.1127, 0.5047, -0.8559, 0.1305, 0, -0.9914, 0.1305, 0, -0.9914, 0.1127, -0.5047, -0.8559, 0.0642, -0.8707, -0.4876, -0.0014, -0.9999, 0.0107, -0.0663, -0.8614, 0.5036, -0.1134, -0.4954, 0.8612, 0, -0.4954, 0.8686, 0, -0.4954, 0.8686, -0.2588, 0, 0.9659, -0.2248, 0.4954, 0.839, -0.2248, 0.4954, 0.839, -0.1315, 0.8614, 0.4907, -0.0028, 0.9999, 0.0104, 0.1273, 0.8707, -0.4751, 0.2234, 0.5047, -0.8339, 0.2588, 0, -0.9659, 0.2588, 0, -0.9659, 0.2234, -0.5047, -0.8339, 0.1273, -0.8707, -0.4751, -0.0028, -0.9999, 0.0104, -0.1315, -0.8614, 0.4907, -0.2248, -0.4954, 0.839, -0.2248, -0.4954, 0.839, -0.3827, 0, 0.9239, -0.3324, 0.4954, 0.8025, -0.2248, 0.4954, 0.839, -0.2248, 0.4954, 0.839, -0.1944, 0.8614, 0.4693, -0.0041, 0.9999, 0.0099, 0.1882, 0.8707, -0.4544, 0.3304, 0.5047, -0.7975, 0.3304, 0.5047, -0.7975, 0.3827, 0, -0.9239, 0.3827, 0, -0.9239, 0.3304, -0.5047, -0.7975, 0.3304, -0.5047, -0.7975, 0.1882, -0.8707, -0.4544, -0.0041, -0.9999, 0.0099, -0.1944, -0.8614, 0.4693, -0.3324, -0.4954, 0.8025, -0.2248, -0.4954, 0.839, -0.2248, -0.4954, 0.839, -0.5, 0, 0.866, -0.4343, 0.4954, 0.7523, -0.254, 0.8614, 0.4399, -0.0054, 0.9999, 0.0093, 0.2459, 0.8707, -0.4259, 0.4316, 0.5047, -0.7476, 0.3304, 0.5047, -0.7975, 0.3304, 0.5047, -0.7975, 0.5, 0, -0.866, 0.5, 0, -0.866, 0.4316, -0.5047, -0.7476, 0.3304, -0.5047, -0.7975, 0.3304, -0.5047, -0.7975, 0.2459, -0.8707, -0.4259, -0.0054, -0.9999, 0.0093, -0.254, -0.8614, 0.4399, -0.4343, -0.4954, 0.7523, -0.6088, 0, 0.7933, -0.5288, 0.4954, 0.6891, -0.3092, 0.8614, 0.403, -0.0066, 0.9999, 0.0085, 0.2994, 0.8707, -0.3902, 0.5255, 0.5047, -0.6849, 0.6088, 0, -0.7933, 0.6088, 0, -0.7933, 0.5255, -0.5047, -0.6849, 0.2994, -0.8707, -0.3902, -0.0066, -0.9999, 0.0085, -0.3092, -0.8614, 0.403, -0.5288, -0.4954, 0.6891, -0.7071, 0, 0.7071, -0.6142, 0.4954, 0.6142, -0.3592, 0.8614, 0.3592, -0.0076, 0.9999, 0.0076, 0.3478, 0.8707, -0.3478, 0.6104, 0.5047, -0.6104, 0.6104, 0.5047, -0.6104, 0.7071, 0, -0.7071, 0.7071, 0, -0.7071, 0.6104, -0.5047, -0.6104, 0.6104, -0.5047, -0.6104, 0.3478, -0.8707, -0.3478, -0.0076, -0.9999, 0.0076, -0.3592, -0.8614, 0.3592, -0.6142, -0.4954, 0.6142, -0.7933, 0, 0.6088, -0.6891, 0.4954, 0.5288, -0.403, 0.8614, 0.3092, -0.0085, 0.9999, 0.0066, 0.3902, 0.8707, -0.2994, 0.6849, 0.5047, -0.5255, 0.6104, 0.5047, -0.6104, 0.6104, 0.5047, -0.6104, 0.7933, 0, -0.6088, 0.7933, 0, -0.6088, 0.6849, -0.5047, -0.5255, 0.6104, -0.5047, -0.6104, 0.6104, -0.5047, -0.6104, 0.3902, -0.8707, -0.2994, -0.0085, -0.9999, 0.0066, -0.403, -0.8614, 0.3092, -0.6891, -0.4954, 0.5288, -0.866, 0, 0.5, -0.7523, 0.4954, 0.4343, -0.4399, 0.8614, 0.254, -0.0093, 0.9999, 0.0054, 0.4259, 0.8707, -0.2459, 0.7476, 0.5047, -0.4316, 0.866, 0, -0.5, 0.866, 0, -0.5, 0.7476, -0.5047, -0.4316, 0.4259, -0.8707, -0.2459, -0.0093, -0.9999, 0.0054, -0.4399, -0.8614, 0.254, -0.7523, -0.4954, 0.4343, -0.9239, 0, 0.3827, -0.8025, 0.4954, 0.3324, -0.4693, 0.8614, 0.1944, -0.0099, 0.9999, 0.0041, 0.4544, 0.8707, -0.1882, 0.7975, 0.5047, -0.3304, 0.7975, 0.5047, -0.3304, 0.9239, 0, -0.3827, 0.9239, 0, -0.3827, 0.7975, -0.5047, -0.3304, 0.7975, -0.5047, -0.3304, 0.4544, -0.8707, -0.1882, -0.0099, -0.9999, 0.0041, -0.4693, -0.8614, 0.1944, -0.8025, -0.4954, 0.3324, -0.9659, 0, 0.2588, -0.839, 0.4954, 0.2248, -0.839, 0.4954, 0.2248, -0.4907, 0.8614, 0.1315, -0.0104, 0.9999, 0.0028, 0.4751, 0.8707, -0.1273, 0.8339, 0.5047, -0.2234, 0.7975, 0.5047, -0.3304, 0.7975, 0.5047, -0.3304, 0.9659, 0, -0.2588, 0.9659, 0, -0.2588, 0.8339, -0.5047, -0.2234, 0.7975, -0.5047, -0.3304, 0.7975, -0.5047, -0.3304, 0.4751, -0.8707, -0.1273, -0.0104, -0.9999, 0.0028, -0.4907, -0.8614, 0.1315, -0.839, -0.4954, 0.2248, -0.839, -0.4954, 0.2248, -0.9914, 0, 0.1305, -0.8612, 0.4954, 0.1134, -0.839, 0.4954, 0.2248, -0.839, 0.4954, 0.2248, -0.5036, 0.8614, 0.0663, -0.0107, 0.9999, 0.0014, 0.4876, 0.8707, -0.0642, 0.8559, 0.5047, -0.1127, 0.9914, 0, -0.1305, 0.9914, 0, -0.1305, 0.8559, -0.5047, -0.1127, 0.4876, -0.8707, -0.0642, -0.0107, -0.9999, 0.0014, -0.5036, -0.8614, 0.0663, -0.8612, -0.4954, 0.1134, -0.839, -0.4954, 0.2248, -0.839, -0.4954, 0.2248, -1, 0, -0, -0.8686, 0.4954, -0, -0.8686, 0.4954, -0, -0.508, 0.8614, -0, -0.0108, 0.9999, -0, 0.4918, 0.8707, -0, 0.8633, 0.5047, -0, 1, 0, -0, 1, 0, -0, 0.8633, -0.5047, -0, 0.4918, -0.8707, -0, -0.0108, -0.9999, -0, -0.508, -0.8614, -0, -0.8686, -0.4954, -0, -0.8686, -0.4954, -0, -1, 0, -0, -0.9914, 0, -0.1305, -0.8612, 0.4954, -0.1134, -0.8686, 0.4954, -0, -0.8686, 0.4954, -0, -0.5036, 0.8614, -0.0663, -0.508, 0.8614, -0, -0.0107, 0.9999, -0.0014, -0.0108, 0.9999, -0, 0.4876, 0.8707, 0.0642, 0.4918, 0.8707, -0, 0.8559, 0.5047, 0.1127, 0.8633, 0.5047, -0, 0.9914, 0, 0.1305, 1, 0, -0, 1, 0, -0, 0.9914, 0, 0.1305, 0.8559, -0.5047, 0.1127, 0.8633, -0.5047, -0, 0.4876, -0.8707, 0.0642, 0.4918, -0.8707, -0, -0.0107, -0.9999, -0.0014, -0.0108, -0.9999, -0, -0.5036, -0.8614, -0.0663, -0.508, -0.8614, -0, -0.8612, -0.4954, -0.1134, -0.8686, -0.4954, -0, -0.8686, -0.4954, -0, -0.9659, 0, -0.2588, -0.839, 0.4954, -0.2248, -0.839, 0.4954, -0.2248, -0.4907, 0.8614, -0.1315, -0.0104, 0.9999, -0.0028, 0.4751, 0.8707, 0.1273, 0.8339, 0.5047, 0.2234, 0.9659, 0, 0.2588, 0.9659, 0, 0.2588, 0.8339, -0.5047, 0.2234, 0.4751, -0.8707, 0.1273, -0.0104, -0.9999, -0.0028, -0.4907, -0.8614, -0.1315, -0.839, -0.4954, -0.2248, -0.839, -0.4954, -0.2248, -0.9239, 0, -0.3827, -0.8025, 0.4954, -0.3324, -0.839, 0.4954, -0.2248, -0.839, 0.4954, -0.2248, -0.4693, 0.8614, -0.1944, -0.0099, 0.9999, -0.0041, 0.4544, 0.8707, 0.1882, 0.7975, 0.5047, 0.3304, 0.7975, 0.5047, 0.3304, 0.9239, 0, 0.3827, 0.9239, 0, 0.3827, 0.7975, -0.5047, 0.3304, 0.7975, -0.5047, 0.3304, 0.4544, -0.8707, 0.1882, -0.0099, -0.9999, -0.0041, -0.4693, -0.8614, -0.1944, -0.8025, -0.4954, -0.3324, -0.839, -0.4954, -0.2248, -0.839, -0.4954, -0.2248, -0.866, 0, -0.5, -0.7523, 0.4954, -0.4343, -0.4399, 0.8614, -0.254, -0.0093, 0.9999, -0.0054, 0.4259, 0.8707, 0.2459, 0.7476, 0.5047, 0.4316, 0.7975, 0.5047, 0.3304, 0.7975, 0.5047, 0.3304, 0.866, 0, 0.5, 0.866, 0, 0.5, 0.7476, -0.5047, 0.4316, 0.7975, -0.5047, 0.3304, 0.7975, -0.5047, 0.3304, 0.4259, -0.8707, 0.2459, -0.0093, -0.9999, -0.0054, -0.4399, -0.8614, -0.254, -0.7523, -0.4954, -0.4343, -0.7933, 0, -0.6088, -0.6891, 0.4954, -0.5288, -0.403, 0.8614, -0.3092, -0.0085, 0.9999, -0.0066, 0.3902, 0.8707, 0.2994, 0.6849, 0.5047, 0.5255, 0.7933, 0, 0.6088, 0.7933, 0, 0.6088, 0.6849, -0.5047, 0.5255, 0.3902, -0.8707, 0.2994, -0.0085, -0.9999, -0.0066, -0.403, -0.8614, -0.3092, -0.6891, -0.4954, -0.5288, -0.7071, 0, -0.7071, -0.6142, 0.4954, -0.6142, -0.3592, 0.8614, -0.3592, -0.0076, 0.9999, -0.0076, 0.3478, 0.8707, 0.3478, 0.6104, 0.5047, 0.6104, 0.6104, 0.5047, 0.6104, 0.7071, 0, 0.7071, 0.7071, 0, 0.7071, 0.6104, -0.5047, 0.6104, 0.6104, -0.5047, 0.6104, 0.3478, -0.8707, 0.3478, -0.0076, -0.9999, -0.0076, -0.3592, -0.8614, -0.3592, -0.6142, -0.4954, -0.6142, -0.6088, 0, -0.7933, -0.5288, 0.4954, -0.6891, -0.3092, 0.8614, -0.403, -0.0066, 0.9999, -0.0085, 0.2994, 0.8707, 0.3902, 0.5255, 0.5047, 0.6849, 0.6104, 0.5047, 0.6104, 0.6104, 0.5047, 0.6104, 0.6088, 0, 0.7933, 0.6088, 0, 0.7933, 0.5255, -0.5047, 0.6849, 0.6104, -0.5047, 0.6104, 0.6104, -0.5047, 0.6104, 0.2994, -0.8707, 0.3902, -0.0066, -0.9999, -0.0085, -0.3092, -0.8614, -0.403, -0.5288, -0.4954, -0.6891, -0.5, 0, -0.866, -0.4343, 0.4954, -0.7523, -0.254, 0.8614, -0.4399, -0.0054, 0.9999, -0.0093, 0.2459, 0.8707, 0.4259, 0.4316, 0.5047, 0.7476, 0.5, 0, 0.866, 0.5, 0, 0.866, 0.4316, -0.5047, 0.7476, 0.2459, -0.8707, 0.4259, -0.0054, -0.9999, -0.0093, -0.254, -0.8614, -0.4399, -0.4343, -0.4954, -0.7523, -0.3827, 0, -0.9239, -0.3324, 0.4954, -0.8025, -0.1944, 0.8614, -0.4693, -0.0041, 0.9999, -0.0099, 0.1882, 0.8707, 0.4544, 0.3304, 0.5047, 0.7975, 0.3304, 0.5047, 0.7975, 0.3827, 0, 0.9239, 0.3827, 0, 0.9239, 0.3304, -0.5047, 0.7975, 0.3304, -0.5047, 0.7975, 0.1882, -0.8707, 0.4544, -0.0041, -0.9999, -0.0099, -0.1944, -0.8614, -0.4693, -0.3324, -0.4954, -0.8025, -0.2588, 0, -0.9659, -0.2248, 0.4954, -0.839, -0.2248, 0.4954, -0.839, -0.1315, 0.8614, -0.4907, -0.0028, 0.9999, -0.0104, 0.1273, 0.8707, 0.4751, 0.2234, 0.5047, 0.8339, 0.3304, 0.5047, 0.7975, 0.3304, 0.5047, 0.7975, 0.2588, 0, 0.9659, 0.2588, 0, 0.9659, 0.2234, -0.5047, 0.8339, 0.3304, -0.5047, 0.7975, 0.3304, -0.5047, 0.7975, 0.1273, -0.8707, 0.4751, -0.0028, -0.9999, -0.0104, -0.1315, -0.8614, -0.4907, -0.2248, -0.4954, -0.839, -0.2248, -0.4954, -0.839, -0.1305, 0, -0.9914, -0.1134, 0.4954, -0.8612, -0.2248, 0.4954, -0.839, -0.2248, 0.4954, -0.839, -0.0663, 0.8614, -0.5036, -0.0014, 0.9999, -0.0107, 0.0642, 0.8707, 0.4876, 0.1127, 0.5047, 0.8559, 0.1305, 0, 0.9914, 0.1305, 0, 0.9914, 0.1127, -0.5047, 0.8559, 0.0642, -0.8707, 0.4876, -0.0014, -0.9999, -0.0107, -0.0663, -0.8614, -0.5036, -0.1134, -0.4954, -0.8612, -0.2248, -0.4954, -0.839, -0.2248, -0.4954, -0.839, 0, 0, -1, 0, 0.4954, -0.8686, 0, 0.4954, -0.8686, 0, 0.8614, -0.508, 0, 0.9999, -0.0108, 0, 0.8707, 0.4918, 0, 0.5047, 0.8633, 0, 0, 1, 0, 0, 1, 0, -0.5047, 0.8633, 0, -0.8707, 0.4918, 0, -0.9999, -0.0108, 0, -0.8614, -0.508, 0, -0.4954, -0.8686, 0, -0.4954, -0.8686, 0.1305, 0, -0.9914, 0.1134, 0.4954, -0.8612, 0, 0.4954, -0.8686, 0, 0.4954, -0.8686, 0.0663, 0.8614, -0.5036, 0.0014, 0.9999, -0.0107, -0.0642, 0.8707, 0.4876, -0.1127, 0.5047, 0.8559, -0.1305, 0, 0.9914, -0.1305, 0, 0.9914, -0.1127, -0.5047, 0.8559, -0.0642, -0.8707, 0.4876, 0.0014, -0.9999, -0.0107, 0.0663, -0.8614, -0.5036, 0.1134, -0.4954, -0.8612, 0, -0.4954, -0.8686, 0, -0.4954, -0.8686, 0.2588, 0, -0.9659, 0.2248, 0.4954, -0.839, 0.2248, 0.4954, -0.839, 0.1315, 0.8614, -0.4907, 0.0028, 0.9999, -0.0104, -0.1273, 0.8707, 0.4751, -0.2234, 0.5047, 0.8339, -0.2588, 0, 0.9659, -0.2588, 0, 0.9659, -0.2234, -0.5047, 0.8339, -0.1273, -0.8707, 0.4751, 0.0028, -0.9999, -0.0104, 0.1315, -0.8614, -0.4907, 0.2248, -0.4954, -0.839, 0.2248, -0.4954, -0.839, 0.3827, 0, -0.9239, 0.3324, 0.4954, -0.8025, 0.2248, 0.4954, -0.839, 0.2248, 0.4954, -0.839, 0.1944, 0.8614, -0.4693, 0.0041, 0.9999, -0.0099, -0.1882, 0.8707, 0.4544, -0.3304, 0.5047, 0.7975, -0.3304, 0.5047, 0.7975, -0.3827, 0, 0.9239, -0.3827, 0, 0.9239, -0.3304, -0.5047, 0.7975, -0.3304, -0.5047, 0.7975, -0.1882, -0.8707, 0.4544, 0.0041, -0.9999, -0.0099, 0.1944, -0.8614, -0.4693, 0.3324, -0.4954, -0.8025, 0.2248, -0.4954, -0.839, 0.2248, -0.4954, -0.839, 0.5, 0, -0.866, 0.4343, 0.4954, -0.7523, 0.254, 0.8614, -0.4399, 0.0054, 0.9999, -0.0093, -0.2459, 0.8707, 0.4259, -0.4316, 0.5047, 0.7476, -0.3304, 0.5047, 0.7975, -0.3304, 0.5047, 0.7975, -0.5, 0, 0.866, -0.5, 0, 0.866, -0.4316, -0.5047, 0.7476, -0.3304, -0.5047, 0.7975, -0.3304, -0.5047, 0.7975, -0.2459, -0.8707, 0.4259, 0.0054, -0.9999, -0.0093, 0.254, -0.8614, -0.4399, 0.4343, -0.4954, -0.7523, 0.6088, 0, -0.7933, 0.5288, 0.4954, -0.6891, 0.3092, 0.8614, -0.403, 0.0066, 0.9999, -0.0085, -0.2994, 0.8707, 0.3902, -0.5255, 0.5047, 0.6849, -0.6088, 0, 0.7933, -0.6088, 0, 0.7933, -0.5255, -0.5047, 0.6849, -0.2994, -0.8707, 0.3902, 0.0066, -0.9999, -0.0085, 0.3092, -0.8614, -0.403, 0.5288, -0.4954, -0.6891, 0.7071, 0, -0.7071, 0.6142, 0.4954, -0.6142, 0.3592, 0.8614, -0.3592, 0.0076, 0.9999, -0.0076, -0.3478, 0.8707, 0.3478, -0.6104, 0.5047, 0.6104, -0.6104, 0.5047, 0.6104, -0.7071, 0, 0.7071, -0.7071, 0, 0.7071, -0.6104, -0.5047, 0.6104, -0.6104, -0.5047, 0.6104, -0.3478, -0.8707, 0.3478, 0.0076, -0.9999, -0.0076, 0.3592, -0.8614, -0.3592, 0.6142, -0.4954, -0.6142, 0.7933, 0, -0.6088, 0.6891, 0.4954, -0.5288, 0.403, 0.8614, -0.3092, 0.0085, 0.9999, -0.0066, -0.3902, 0.8707, 0.2994, -0.6849, 0.5047, 0.5255, -0.6104, 0.5047, 0.6104, -0.6104, 0.5047, 0.6104, -0.7933, 0, 0.6088, -0.7933, 0, 0.6088, -0.6849, -0.5047, 0.5255, -0.6104, -0.5047, 0.6104, -0.6104, -0.5047, 0.6104, -0.3902, -0.8707, 0.2994, 0.0085, -0.9999, -0.0066, 0.403, -0.8614, -0.3092, 0.6891, -0.4954, -0.5288, 0.866, 0, -0.5, 0.7523, 0.4954, -0.4343, 0.4399, 0.8614, -0.254, 0.0093, 0.9999, -0.0054, -0.4259, 0.8707, 0.2459, -0.7476, 0.5047, 0.4316, -0.866, 0, 0.5, -0.866, 0, 0.5, -0.7476, -0.5047, 0.4316, -0.4259, -0.8707, 0.2459, 0.0093, -0.9999, -0.0054, 0.4399, -0.8614, -0.254, 0.7523, -0.4954, -0.4343, 0.9239, 0, -0.3827, 0.8025, 0.4954, -0.3324, 0.4693, 0.8614, -0.1944, 0.0099, 0.9999, -0.0041, -0.4544, 0.8707, 0.1882, -0.7975, 0.5047, 0.3304, -0.7975, 0.5047, 0.3304, -0.9239, 0, 0.3827, -0.9239, 0, 0.3827, -0.7975, -0.5047, 0.3304, -0.7975, -0.5047, 0.3304, -0.4544, -0.8707, 0.1882, 0.0099, -0.9999, -0.0041, 0.4693, -0.8614, -0.1944, 0.8025, -0.4954, -0.3324, 0.9659, 0, -0.2588, 0.839, 0.4954, -0.2248, 0.839, 0.4954, -0.2248, 0.4907, 0.8614, -0.1315, 0.0104, 0.9999, -0.0028, -0.4751, 0.8707, 0.1273, -0.8339, 0.5047, 0.2234, -0.7975, 0.5047, 0.3304, -0.7975, 0.5047, 0.3304, -0.9659, 0, 0.2588, -0.9659, 0, 0.2588, -0.8339, -0.5047, 0.2234, -0.7975, -0.5047, 0.3304, -0.7975, -0.5047, 0.3304, -0.4751, -0.8707, 0.1273, 0.0104, -0.9999, -0.0028, 0.4907, -0.8614, -0.1315, 0.839, -0.4954, -0.2248, 0.839, -0.4954, -0.2248, 0.9914, 0, -0.1305, 0.8612, 0.4954, -0.1134, 0.839, 0.4954, -0.2248, 0.839, 0.4954, -0.2248, 0.5036, 0.8614, -0.0663, 0.0107, 0.9999, -0.0014, -0.4876, 0.8707, 0.0642, -0.8559, 0.5047, 0.1127, -0.9914, 0, 0.1305, -0.9914, 0, 0.1305, -0.8559, -0.5047, 0.1127, -0.4876, -0.8707, 0.0642, 0.0107, -0.9999, -0.0014, 0.5036, -0.8614, -0.0663, 0.8612, -0.4954, -0.1134, 0.839, -0.4954, -0.2248, 0.839, -0.4954, -0.2248, 0.8686, 0.4954, -0, 0.8686, 0.4954, -0, 0.8686, -0.4954, -0, 0.8686, -0.4954, -0
-};
-
-float mTangents[] = {
-0, 0, 1, -0.130505, 0, 0.991448, -0.127351, -0.00565171, 0.991842, -0.0160848, 0.028189, 0.999473, -0.016084, 0.0281877, 0.999473, -0.120874, -0.005736, 0.992651, -0.00972495, 0.00573574, 0.999936, -0.11752, -0.000132832, 0.99307, -0.0131048, 0.000141534, 0.999914, -0.120669, 0.00561803, 0.992677, -0.00993681, -0.00561253, 0.999935, -0.127229, 0.00572061, 0.991857, -0.00333904, -0.0057117, 0.999978, -0.130505, 0, 0.991448, 0, 0, 1, 0, 0, 1, -0.130505, 0, 0.991448, -0.127229, -0.00571966, 0.991857, -0.00333844, 0.00571068, 0.999978, -0.120669, -0.0056181, 0.992677, -0.00993759, 0.00561297, 0.999935, -0.11752, 0.000132839, 0.993071, -0.0131072, -0.00014156, 0.999914, -0.120874, 0.00573601, 0.992651, -0.00972542, -0.00573602, 0.999936, -0.127351, 0.00565175, 0.991842, -0.0160838, -0.0281872, 0.999473, -0.016084, -0.0281877, 0.999473, -0.258807, 0, 0.965929, -0.243138, -0.0281842, 0.969582, -0.243138, -0.0281842, 0.969582, -0.249419, -0.00574961, 0.968379, -0.246138, -0.000154024, 0.969235, -0.249201, 0.00561234, 0.968435, -0.255554, 0.00569113, 0.966778, -0.258807, 0, 0.965929, -0.258807, 0, 0.965929, -0.255553, -0.00569166, 0.966778, -0.249201, -0.00561225, 0.968435, -0.246136, 0.000154043, 0.969235, -0.249418, 0.00574993, 0.968379, -0.243138, 0.0281842, 0.969582, -0.243138, 0.0281842, 0.969582, -0.382691, 0, 0.923876, -0.379698, -0.00563738, 0.925094, -0.274213, 0.0281937, 0.961256, -0.274213, 0.0281942, 0.961256, -0.37368, -0.00574212, 0.92754, -0.370541, -0.000139787, 0.928816, -0.37347, 0.00559838, 0.927625, -0.367099, 0.0285702, 0.929743, -0.367099, 0.0285702, 0.929743, -0.382691, 0, 0.923876, -0.382691, 0, 0.923876, -0.367099, -0.0285702, 0.929743, -0.367099, -0.0285702, 0.929743, -0.37347, -0.00559832, 0.927625, -0.370543, 0.000139766, 0.928815, -0.37368, 0.00574184, 0.92754, -0.379698, 0.00563743, 0.925094, -0.274214, -0.0281953, 0.961255, -0.274213, -0.0281942, 0.961256, -0.50001, 0, 0.866019, -0.497177, -0.0056233, 0.867631, -0.491553, -0.00575433, 0.870829, -0.48861, -0.000167442, 0.872502, -0.491366, 0.0056163, 0.870935, -0.497079, 0.00569789, 0.867686, -0.397945, -0.0285119, 0.916966, -0.397946, -0.0285119, 0.916966, -0.500011, 0, 0.866019, -0.500011, 0, 0.866019, -0.497079, -0.00569794, 0.867686, -0.397946, 0.0285121, 0.916966, -0.397946, 0.028512, 0.916966, -0.491365, -0.0056165, 0.870935, -0.48861, 0.000167443, 0.872502, -0.491553, 0.00575419, 0.870829, -0.497177, 0.00562307, 0.867631, -0.608811, 0, 0.793315, -0.606214, -0.00565468, 0.795281, -0.600997, -0.00571257, 0.799231, -0.598312, -0.000202693, 0.801264, -0.600834, 0.00560623, 0.799354, -0.606075, 0.00569539, 0.795387, -0.608811, 0, 0.793315, -0.608811, 0, 0.793315, -0.606075, -0.00569507, 0.795387, -0.600834, -0.00560616, 0.799354, -0.598311, 0.000202702, 0.801264, -0.600996, 0.00571286, 0.799231, -0.606214, 0.00565477, 0.795281, -0.707107, 0, 0.707107, -0.704816, -0.00564096, 0.709368, -0.700186, -0.00573518, 0.713938, -0.697776, -0.000140906, 0.716316, -0.700034, 0.00561395, 0.714087, -0.694915, 0.0285425, 0.718525, -0.694915, 0.0285425, 0.718525, -0.707107, 0, 0.707107, -0.707107, 0, 0.707107, -0.694916, -0.0285424, 0.718525, -0.694915, -0.0285425, 0.718525, -0.700034, -0.00561358, 0.714087, -0.697777, 0.000140897, 0.716315, -0.700185, 0.00573534, 0.713938, -0.704816, 0.00564127, 0.709368, -0.793315, 0, 0.608812, -0.791363, -0.00562643, 0.611321, -0.78739, -0.0057582, 0.616429, -0.785307, -7.93857e-05, 0.619107, -0.787256, 0.0056197, 0.6166, -0.791321, 0.00572672, 0.611374, -0.718524, -0.0285416, 0.694916, -0.718525, -0.0285424, 0.694916, -0.793315, 0, 0.608812, -0.793315, 0, 0.608812, -0.791321, -0.00572667, 0.611374, -0.718524, 0.0285398, 0.694917, -0.718525, 0.0285425, 0.694915, -0.787256, -0.00561985, 0.616601, -0.785307, 7.9379e-05, 0.619106, -0.78739, 0.00575794, 0.616429, -0.791363, 0.00562638, 0.611321, -0.866019, 0, 0.500012, -0.864414, -0.00565832, 0.502749, -0.861102, -0.00571851, 0.508401, -0.859399, -0.000114384, 0.511305, -0.860999, 0.00560797, 0.508576, -0.864346, 0.00572272, 0.502864, -0.866019, 0, 0.500012, -0.866019, 0, 0.500012, -0.864346, -0.00572345, 0.502865, -0.860998, -0.00560828, 0.508577, -0.859399, 0.000114388, 0.511306, -0.861102, 0.00571851, 0.508401, -0.864414, 0.00565804, 0.502749, -0.923877, 0, 0.38269, -0.92263, -0.00564418, 0.385644, -0.920098, -0.00572729, 0.391647, -0.918784, -0.000141126, 0.394761, -0.92002, 0.00562822, 0.391831, -0.916966, 0.0285119, 0.397946, -0.916966, 0.0285119, 0.397946, -0.923877, 0, 0.38269, -0.923877, 0, 0.38269, -0.916966, -0.0285119, 0.397946, -0.916966, -0.0285119, 0.397946, -0.92002, -0.00562792, 0.391831, -0.918784, 0.000141125, 0.394761, -0.920098, 0.00572736, 0.391648, -0.92263, 0.00564467, 0.385644, -0.965929, 0, 0.258808, -0.961256, -0.0281942, 0.274213, -0.961256, -0.0281942, 0.274213, -0.963344, -0.00572302, 0.268207, -0.96245, -0.00012831, 0.271458, -0.963291, 0.00561683, 0.268401, -0.96505, 0.00573211, 0.262004, -0.929743, -0.0285681, 0.3671, -0.929743, -0.0285702, 0.367099, -0.965929, 0, 0.258808, -0.965929, 0, 0.258808, -0.96505, -0.00573305, 0.262004, -0.929744, 0.0285744, 0.367097, -0.929743, 0.0285702, 0.367099, -0.963291, -0.00561677, 0.268401, -0.96245, 0.000128303, 0.271458, -0.963344, 0.00572301, 0.268207, -0.961256, 0.0281942, 0.274213, -0.961256, 0.0281942, 0.274213, -0.991447, 0, 0.130508, -0.991002, -0.00563029, 0.133731, -0.969582, 0.0281836, 0.243138, -0.969582, 0.0281842, 0.243138, -0.990112, -0.00573509, 0.14016, -0.989649, -0.000150026, 0.143508, -0.990083, 0.00560713, 0.140372, -0.990985, 0.00570205, 0.13385, -0.991447, 0, 0.130508, -0.991447, 0, 0.130508, -0.990985, -0.00570153, 0.133849, -0.990083, -0.00560733, 0.140373, -0.989649, 0.000150038, 0.143509, -0.990112, 0.00573523, 0.14016, -0.991002, 0.00562993, 0.133731, -0.969582, -0.0281838, 0.243138, -0.969582, -0.0281842, 0.243138, -1, 0, 0, -0.999473, -0.0281877, 0.016084, -0.999473, -0.0281877, 0.016084, -0.999936, -0.00573492, 0.00972355, -0.999914, -0.000141537, 0.0131051, -0.999935, 0.00561345, 0.00993844, -0.999978, 0.00571159, 0.00333898, -1, 0, 0, -1, 0, 0, -0.999978, -0.00571205, 0.00333925, -0.999935, -0.00561328, 0.00993814, -0.999914, 0.000141539, 0.0131053, -0.999936, 0.00573478, 0.00972332, -0.999473, 0.0281877, 0.016084, -0.999473, 0.0281877, 0.016084, -0.991448, 0, -0.130505, -0.991842, -0.00565171, -0.127351, -0.999473, 0.028189, -0.0160848, -0.999473, 0.0281877, -0.016084, -0.992651, -0.00573486, -0.120875, -0.993071, -0.000132846, -0.117519, -0.992677, 0.00561804, -0.120669, -0.991857, 0.00572047, -0.127229, -0.991448, 0, -0.130505, -0.991448, 0, -0.130505, -0.991857, -0.00571966, -0.127229, -0.992677, -0.00561793, -0.120669, -0.99307, 0.000132835, -0.11752, -0.992651, 0.00573487, -0.120875, -0.991842, 0.00565229, -0.12735, -0.999473, -0.02819, -0.0160854, -0.999473, -0.0281877, -0.016084, -0.965929, 0, -0.258807, -0.969582, -0.0281842, -0.243138, -0.969582, -0.0281842, -0.243138, -0.968379, -0.00575128, -0.249416, -0.969235, -0.000154029, -0.246138, -0.968435, 0.00561211, -0.249201, -0.966778, 0.00569064, -0.255554, -0.965929, 0, -0.258807, -0.965929, 0, -0.258807, -0.966778, -0.00569116, -0.255554, -0.968435, -0.00561181, -0.249202, -0.969235, 0.000154048, -0.246136, -0.96838, 0.00575181, -0.249415, -0.969582, 0.0281842, -0.243138, -0.969582, 0.0281842, -0.243138, -0.923876, 0, -0.382691, -0.925094, -0.0056379, -0.379697, -0.961256, 0.0281937, -0.274213, -0.961256, 0.0281942, -0.274213, -0.92754, -0.00574265, -0.373679, -0.928817, -0.000139811, -0.370539, -0.927626, 0.00559868, -0.373469, -0.929743, 0.0285702, -0.367099, -0.929743, 0.0285702, -0.367099, -0.923876, 0, -0.382691, -0.923876, 0, -0.382691, -0.929743, -0.0285702, -0.367099, -0.929743, -0.0285702, -0.367099, -0.927625, -0.00559832, -0.37347, -0.928816, 0.000139789, -0.370541, -0.92754, 0.00574215, -0.373679, -0.925094, 0.00563796, -0.379697, -0.961255, -0.0281953, -0.274214, -0.961256, -0.0281942, -0.274213, -0.866019, 0, -0.50001, -0.867631, -0.00562438, -0.497176, -0.870828, -0.00575367, -0.491554, -0.872503, -0.000167447, -0.48861, -0.870935, 0.00561574, -0.491367, -0.867686, 0.00569789, -0.497079, -0.916966, -0.0285119, -0.397945, -0.916966, -0.0285119, -0.397946, -0.866019, 0, -0.500011, -0.866019, 0, -0.500011, -0.867686, -0.00569794, -0.497079, -0.916966, 0.0285121, -0.397946, -0.916966, 0.028512, -0.397946, -0.870935, -0.00561651, -0.491365, -0.872503, 0.000167453, -0.488609, -0.870828, 0.00575347, -0.491554, -0.867631, 0.00562398, -0.497177, -0.793315, 0, -0.608811, -0.795281, -0.00565322, -0.606215, -0.799231, -0.00571214, -0.600997, -0.801261, -0.000202653, -0.598315, -0.799354, 0.00560623, -0.600834, -0.795387, 0.00569474, -0.606076, -0.793315, 0, -0.608811, -0.793315, 0, -0.608811, -0.795387, -0.00569442, -0.606076, -0.799353, -0.00560552, -0.600835, -0.801262, 0.000202661, -0.598314, -0.799231, 0.00571242, -0.600997, -0.795281, 0.00565337, -0.606215, -0.707107, 0, -0.707107, -0.709368, -0.00564137, -0.704816, -0.713938, -0.00573534, -0.700185, -0.716315, -0.000140895, -0.697777, -0.714087, 0.00561352, -0.700035, -0.718524, 0.0285392, -0.694917, -0.718524, 0.0285392, -0.694917, -0.707107, 0, -0.707107, -0.707107, 0, -0.707107, -0.718524, -0.0285392, -0.694917, -0.718524, -0.0285392, -0.694917, -0.714088, -0.00561414, -0.700034, -0.716315, 0.000140886, -0.697777, -0.713938, 0.00573506, -0.700186, -0.709368, 0.00564127, -0.704816, -0.608812, 0, -0.793315, -0.61132, -0.00562598, -0.791363, -0.616428, -0.00575769, -0.78739, -0.619104, -7.93495e-05, -0.785309, -0.616601, 0.00562006, -0.787256, -0.611375, 0.00572843, -0.791321, -0.694916, -0.0285416, -0.718525, -0.694917, -0.0285396, -0.718524, -0.608812, 0, -0.793315, -0.608812, 0, -0.793315, -0.611375, -0.00572838, -0.791321, -0.694917, 0.0285397, -0.718524, -0.694917, 0.0285396, -0.718524, -0.616601, -0.00561985, -0.787256, -0.619105, 7.93551e-05, -0.785309, -0.616428, 0.00575781, -0.78739, -0.61132, 0.00562588, -0.791363, -0.500012, 0, -0.866019, -0.502749, -0.0056581, -0.864414, -0.508399, -0.00571754, -0.861102, -0.511309, -0.000114432, -0.859397, -0.508578, 0.00560893, -0.860998, -0.502865, 0.00572341, -0.864346, -0.500012, 0, -0.866019, -0.500012, 0, -0.866019, -0.502865, -0.00572345, -0.864346, -0.508578, -0.00560895, -0.860998, -0.51131, 0.00011444, -0.859397, -0.5084, 0.00571784, -0.861102, -0.502749, 0.00565857, -0.864414, -0.38269, 0, -0.923877, -0.385644, -0.00564434, -0.92263, -0.39165, -0.00572891, -0.920096, -0.394762, -0.000141137, -0.918783, -0.391833, 0.00562916, -0.920019, -0.397946, 0.0285119, -0.916966, -0.397946, 0.0285119, -0.916966, -0.38269, 0, -0.923877, -0.38269, 0, -0.923877, -0.397946, -0.0285119, -0.916966, -0.397946, -0.0285119, -0.916966, -0.391833, -0.00562924, -0.920019, -0.394761, 0.000141118, -0.918784, -0.39165, 0.00572858, -0.920097, -0.385644, 0.00564467, -0.92263, -0.258808, 0, -0.965929, -0.274213, -0.0281942, -0.961256, -0.274213, -0.0281942, -0.961256, -0.268206, -0.00572247, -0.963345, -0.271455, -0.000128267, -0.962451, -0.268397, 0.00561481, -0.963292, -0.262004, 0.00573243, -0.96505, -0.367098, -0.0285717, -0.929743, -0.367099, -0.0285702, -0.929743, -0.258808, 0, -0.965929, -0.258808, 0, -0.965929, -0.262004, -0.00573322, -0.96505, -0.367097, 0.0285744, -0.929744, -0.367099, 0.0285702, -0.929743, -0.268398, -0.00561491, -0.963292, -0.271456, 0.000128278, -0.962451, -0.268206, 0.00572245, -0.963345, -0.274213, 0.0281942, -0.961256, -0.274213, 0.0281942, -0.961256, -0.130508, 0, -0.991447, -0.133731, -0.00563029, -0.991002, -0.243138, 0.0281836, -0.969582, -0.243138, 0.0281842, -0.969582, -0.140158, -0.00573398, -0.990113, -0.143509, -0.00015004, -0.989649, -0.140373, 0.00560752, -0.990083, -0.13385, 0.00570244, -0.990985, -0.130508, 0, -0.991447, -0.130508, 0, -0.991447, -0.13385, -0.00570197, -0.990985, -0.140373, -0.00560767, -0.990083, -0.143509, 0.000150037, -0.989649, -0.140158, 0.00573412, -0.990112, -0.133731, 0.00563049, -0.991002, -0.243137, -0.0281865, -0.969582, -0.243138, -0.0281842, -0.969582, 0, 0, -1, -0.016084, -0.0281877, -0.999473, -0.016084, -0.0281877, -0.999473, -0.00972643, -0.00573662, -0.999936, -0.0131051, -0.000141537, -0.999914, -0.00993818, 0.0056133, -0.999935, -0.00333888, 0.00571143, -0.999978, 0, 0, -1, 0, 0, -1, -0.00333915, -0.00571189, -0.999978, -0.00993788, -0.00561314, -0.999935, -0.0131053, 0.000141539, -0.999914, -0.0097262, 0.00573648, -0.999936, -0.016084, 0.0281877, -0.999473, -0.016084, 0.0281877, -0.999473, 0, 0, -1, 0.130505, 0, -0.991448, 0.127351, -0.00565171, -0.991842, 0.0160848, 0.028189, -0.999473, 0.016084, 0.0281877, -0.999473, 0.120875, -0.00573486, -0.992651, -0.00972643, -0.00573662, -0.999936, 0.117519, -0.000132846, -0.993071, -0.0131051, -0.000141537, -0.999914, 0.120669, 0.00561804, -0.992677, -0.00993818, 0.0056133, -0.999935, 0.127229, 0.00572047, -0.991857, -0.00333888, 0.00571143, -0.999978, 0.130505, 0, -0.991448, 0, 0, -1, 0, 0, -1, 0.130505, 0, -0.991448, 0.127229, -0.00571966, -0.991857, -0.00333915, -0.00571189, -0.999978, 0.120669, -0.00561793, -0.992677, -0.00993788, -0.00561314, -0.999935, 0.11752, 0.000132835, -0.99307, -0.0131053, 0.000141539, -0.999914, 0.120875, 0.00573487, -0.992651, -0.0097262, 0.00573648, -0.999936, 0.12735, 0.00565229, -0.991842, 0.0160854, -0.02819, -0.999473, 0.016084, -0.0281877, -0.999473, 0.258807, 0, -0.965929, 0.243138, -0.0281842, -0.969582, 0.243138, -0.0281842, -0.969582, 0.249415, -0.00575207, -0.96838, 0.246137, -0.000154034, -0.969235, 0.249202, 0.00561191, -0.968435, 0.255554, 0.00569064, -0.966778, 0.258807, 0, -0.965929, 0.258807, 0, -0.965929, 0.255554, -0.00569088, -0.966778, 0.249202, -0.00561181, -0.968435, 0.246136, 0.000154043, -0.969235, 0.249415, 0.00575201, -0.96838, 0.243138, 0.0281842, -0.969582, 0.243138, 0.0281842, -0.969582, 0.382691, 0, -0.923876, 0.379697, -0.00563829, -0.925094, 0.274211, 0.0281913, -0.961256, 0.274212, 0.0281923, -0.961256, 0.373678, -0.0057433, -0.927541, 0.370541, -0.000139795, -0.928816, 0.373469, 0.00559897, -0.927626, 0.367099, 0.0285702, -0.929743, 0.367099, 0.0285702, -0.929743, 0.382691, 0, -0.923876, 0.382691, 0, -0.923876, 0.367099, -0.0285702, -0.929743, 0.367099, -0.0285702, -0.929743, 0.37347, -0.00559832, -0.927625, 0.370542, 0.000139781, -0.928816, 0.373678, 0.00574338, -0.927541, 0.379697, 0.0056385, -0.925094, 0.274213, -0.0281933, -0.961256, 0.274212, -0.0281924, -0.961256, 0.50001, 0, -0.866019, 0.497177, -0.00562355, -0.867631, 0.491555, -0.00575275, -0.870828, 0.488608, -0.000167468, -0.872503, 0.491367, 0.00561575, -0.870935, 0.497079, 0.0056979, -0.867686, 0.397945, -0.0285119, -0.916966, 0.397946, -0.0285119, -0.916966, 0.500011, 0, -0.866019, 0.500011, 0, -0.866019, 0.497079, -0.00569794, -0.867686, 0.397945, 0.0285102, -0.916966, 0.397946, 0.028512, -0.916966, 0.491365, -0.00561651, -0.870935, 0.488607, 0.000167475, -0.872504, 0.491555, 0.00575254, -0.870827, 0.497177, 0.00562315, -0.867631, 0.608811, 0, -0.793315, 0.606215, -0.00565326, -0.795281, 0.600997, -0.00571214, -0.799231, 0.598315, -0.000202653, -0.801261, 0.600834, 0.0056063, -0.799354, 0.606075, 0.00569489, -0.795387, 0.608811, 0, -0.793315, 0.608811, 0, -0.793315, 0.606076, -0.0056945, -0.795387, 0.600835, -0.00560566, -0.799354, 0.598314, 0.000202662, -0.801262, 0.600997, 0.00571242, -0.799231, 0.606215, 0.00565337, -0.795281, 0.707107, 0, -0.707107, 0.704816, -0.00564136, -0.709368, 0.700185, -0.00573569, -0.713938, 0.697776, -0.000140906, -0.716316, 0.700033, 0.0056147, -0.714088, 0.694917, 0.0285396, -0.718524, 0.694917, 0.0285396, -0.718524, 0.707107, 0, -0.707107, 0.707107, 0, -0.707107, 0.694917, -0.0285396, -0.718524, 0.694917, -0.0285396, -0.718524, 0.700033, -0.00561497, -0.714089, 0.697776, 0.00014091, -0.716316, 0.700185, 0.0057355, -0.713938, 0.704816, 0.00564161, -0.709368, 0.793315, 0, -0.608812, 0.791363, -0.00562764, -0.611321, 0.787389, -0.0057584, -0.616429, 0.785306, -7.93995e-05, -0.619108, 0.787254, 0.00562146, -0.616603, 0.791321, 0.00572826, -0.611375, 0.718523, -0.0285389, -0.694917, 0.718524, -0.0285392, -0.694917, 0.793315, 0, -0.608812, 0.793315, 0, -0.608812, 0.791321, -0.00572862, -0.611375, 0.718524, 0.0285397, -0.694917, 0.718524, 0.0285392, -0.694917, 0.787255, -0.00562107, -0.616602, 0.785307, 7.93831e-05, -0.619107, 0.787389, 0.00575851, -0.616429, 0.791363, 0.0056276, -0.611321, 0.866019, 0, -0.500012, 0.864414, -0.00565817, -0.502749, 0.861102, -0.00571797, -0.5084, 0.859397, -0.000114425, -0.511308, 0.860999, 0.00560742, -0.508575, 0.864346, 0.00572341, -0.502865, 0.866019, 0, -0.500012, 0.866019, 0, -0.500012, 0.864346, -0.00572346, -0.502865, 0.860999, -0.00560778, -0.508576, 0.859396, 0.000114446, -0.51131, 0.861102, 0.00571848, -0.508401, 0.864414, 0.00565812, -0.502749, 0.923877, 0, -0.38269, 0.922631, -0.00564277, -0.385643, 0.920098, -0.00572686, -0.391647, 0.918785, -0.000141099, -0.394759, 0.920019, 0.00562895, -0.391832, 0.916966, 0.0285119, -0.397946, 0.916966, 0.0285119, -0.397946, 0.923877, 0, -0.38269, 0.923877, 0, -0.38269, 0.916966, -0.0285119, -0.397946, 0.916966, -0.0285119, -0.397946, 0.920019, -0.00562925, -0.391833, 0.918785, 0.00014109, -0.394758, 0.920098, 0.00572634, -0.391646, 0.922631, 0.0056427, -0.385643, 0.965929, 0, -0.258808, 0.961256, -0.0281942, -0.274213, 0.961256, -0.0281942, -0.274213, 0.963345, -0.00572195, -0.268205, 0.962451, -0.00012827, -0.271455, 0.963292, 0.00561494, -0.268398, 0.96505, 0.00573243, -0.262004, 0.929743, -0.0285717, -0.367098, 0.929743, -0.0285702, -0.367099, 0.965929, 0, -0.258809, 0.965929, 0, -0.258809, 0.96505, -0.00573305, -0.262004, 0.929744, 0.028573, -0.367098, 0.929743, 0.0285702, -0.367099, 0.963292, -0.00561491, -0.268398, 0.962451, 0.000128265, -0.271454, 0.963345, 0.00572196, -0.268205, 0.961256, 0.0281942, -0.274213, 0.961256, 0.0281942, -0.274213, 0.991447, 0, -0.130508, 0.991002, -0.00563057, -0.133732, 0.969582, 0.0281836, -0.243138, 0.969582, 0.0281837, -0.243138, 0.990112, -0.00573579, -0.140161, 0.989649, -0.000150047, -0.14351, 0.990083, 0.00560748, -0.140373, 0.990985, 0.00570244, -0.13385, 0.991447, 0, -0.130508, 0.991447, 0, -0.130508, 0.990985, -0.00570197, -0.13385, 0.990083, -0.00560767, -0.140373, 0.989649, 0.000150046, -0.143509, 0.990112, 0.00573593, -0.140161, 0.991002, 0.00563073, -0.133732, 0.969582, -0.0281835, -0.243138, 0.969582, -0.0281837, -0.243138, 1, 0, 0, 0.999473, -0.0281875, -0.0160839, 0.999473, -0.0281875, -0.0160839, 0.999936, -0.00573706, -0.00972719, 0.999914, -0.000141548, -0.0131061, 0.999935, 0.00561325, -0.00993809, 0.999978, 0.00571132, -0.00333882, 1, 0, 0, 1, 0, 0, 0.999978, -0.00571183, -0.00333912, 0.999935, -0.00561303, -0.0099377, 0.999914, 0.000141535, -0.0131049, 0.999936, 0.00573693, -0.00972697, 0.999473, 0.0281875, -0.0160839, 0.999473, 0.0281875, -0.0160839, 0.991448, 0, 0.130505, 0.991842, -0.0056515, 0.127351, 0.999473, 0.028189, 0.0160848, 0.999473, 0.0281877, 0.016084, 0.992651, -0.0057359, 0.120874, 0.99307, -0.000132832, 0.11752, 0.992677, 0.00561789, 0.120669, 0.991857, 0.00572046, 0.127229, 0.991448, 0, 0.130505, 0.991448, 0, 0.130505, 0.991857, -0.00571966, 0.127229, 0.992677, -0.00561795, 0.120669, 0.99307, 0.000132835, 0.11752, 0.992651, 0.00573601, 0.120874, 0.991842, 0.00565164, 0.127351, 0.999473, -0.0281872, 0.0160838, 0.999473, -0.0281877, 0.016084, 0.965929, 0, 0.258807, 0.969582, -0.0281837, 0.243138, 0.969582, -0.0281837, 0.243138, 0.968379, -0.00574978, 0.249418, 0.969235, -0.000154014, 0.246139, 0.968435, 0.00561104, 0.249203, 0.966778, 0.00569064, 0.255554, 0.965929, 0, 0.258807, 0.965929, 0, 0.258807, 0.966778, -0.00569166, 0.255553, 0.968435, -0.00561133, 0.249203, 0.969235, 0.000154021, 0.246138, 0.968379, 0.00574954, 0.249419, 0.969582, 0.0281837, 0.243138, 0.969582, 0.0281837, 0.243138, 0.923876, 0, 0.382691, 0.925094, -0.00563768, 0.379698, 0.961256, 0.028192, 0.274212, 0.961256, 0.0281933, 0.274213, 0.92754, -0.00574212, 0.37368, 0.928815, -0.000139765, 0.370543, 0.927625, 0.00559789, 0.373471, 0.929743, 0.0285702, 0.367099, 0.929743, 0.0285702, 0.367099, 0.923876, 0, 0.382691, 0.923876, 0, 0.382691, 0.929743, -0.0285702, 0.367099, 0.929743, -0.0285702, 0.367099, 0.927625, -0.00559757, 0.373471, 0.928815, 0.000139761, 0.370544, 0.92754, 0.00574212, 0.37368, 0.925094, 0.00563797, 0.379697, 0.961255, -0.0281953, 0.274214, 0.961256, -0.0281933, 0.274212, 0.866019, 0, 0.50001, 0.867631, -0.00562376, 0.497177, 0.870829, -0.00575479, 0.491552, 0.872503, -0.000167462, 0.488608, 0.870937, 0.00561834, 0.491363, 0.867686, 0.0056979, 0.497079, 0.916967, -0.0285084, 0.397944, 0.916966, -0.0285119, 0.397946, 0.866019, 0, 0.500011, 0.866019, 0, 0.500011, 0.867686, -0.00569794, 0.49708, 0.916966, 0.0285121, 0.397946, 0.916966, 0.028512, 0.397946, 0.870937, -0.00561855, 0.491362, 0.872503, 0.000167464, 0.488608, 0.870829, 0.00575419, 0.491553, 0.867631, 0.00562352, 0.497177, 0.793315, 0, 0.608811, 0.795281, -0.00565533, 0.606214, 0.799231, -0.00571224, 0.600997, 0.801264, -0.000202694, 0.598312, 0.799354, 0.00560586, 0.600834, 0.795387, 0.00569489, 0.606075, 0.793315, 0, 0.608811, 0.793315, 0, 0.608811, 0.795387, -0.0056945, 0.606076, 0.799354, -0.00560566, 0.600835, 0.801263, 0.000202693, 0.598312, 0.799231, 0.00571286, 0.600996, 0.795282, 0.00565581, 0.606214, 0.707107, 0, 0.707107, 0.709367, -0.0056395, 0.704817, 0.71394, -0.00573661, 0.700184, 0.716313, -0.000140866, 0.697779, 0.714088, 0.00561428, 0.700034, 0.718524, 0.0285396, 0.694917, 0.718524, 0.0285396, 0.694917, 0.707107, 0, 0.707107, 0.707107, 0, 0.707107, 0.718524, -0.0285396, 0.694917, 0.718524, -0.0285396, 0.694917, 0.714088, -0.00561449, 0.700033, 0.716313, 0.000140867, 0.697779, 0.713939, 0.00573642, 0.700184, 0.709367, 0.00563901, 0.704817, 0.608812, 0, 0.793315, 0.611321, -0.00562722, 0.791363, 0.616427, -0.005757, 0.787391, 0.619108, -7.93953e-05, 0.785306, 0.616601, 0.00562025, 0.787256, 0.611375, 0.00572867, 0.79132, 0.694916, -0.0285413, 0.718524, 0.694917, -0.0285392, 0.718524, 0.608812, 0, 0.793315, 0.608812, 0, 0.793315, 0.611375, -0.00572862, 0.791321, 0.694917, 0.0285397, 0.718524, 0.694917, 0.0285392, 0.718524, 0.616601, -0.00562005, 0.787256, 0.619107, 7.93929e-05, 0.785306, 0.616427, 0.00575713, 0.787391, 0.611321, 0.00562744, 0.791363, 0.500012, 0, 0.866019, 0.502749, -0.00565832, 0.864414, 0.5084, -0.00571801, 0.861102, 0.511307, -0.000114412, 0.859398, 0.508576, 0.00560797, 0.860999, 0.502864, 0.00572272, 0.864347, 0.500012, 0, 0.866019, 0.500012, 0, 0.866019, 0.502865, -0.00572345, 0.864346, 0.508577, -0.00560828, 0.860998, 0.511308, 0.000114416, 0.859398, 0.5084, 0.00571802, 0.861102, 0.502749, 0.00565804, 0.864414, 0.38269, 0, 0.923877, 0.385644, -0.00564401, 0.92263, 0.391647, -0.00572729, 0.920098, 0.394761, -0.000141126, 0.918784, 0.391831, 0.00562798, 0.92002, 0.397946, 0.0285119, 0.916966, 0.397946, 0.0285119, 0.916966, 0.38269, 0, 0.923877, 0.38269, 0, 0.923877, 0.397946, -0.0285119, 0.916966, 0.397946, -0.0285119, 0.916966, 0.39183, -0.00562768, 0.92002, 0.394761, 0.000141119, 0.918784, 0.391648, 0.00572736, 0.920098, 0.385644, 0.00564467, 0.92263, 0.258808, 0, 0.965929, 0.274213, -0.0281942, 0.961256, 0.274213, -0.0281942, 0.961256, 0.268207, -0.00572302, 0.963344, 0.271458, -0.00012831, 0.96245, 0.2684, 0.00561626, 0.963291, 0.262004, 0.00573226, 0.96505, 0.3671, -0.0285693, 0.929743, 0.367099, -0.0285702, 0.929743, 0.258808, 0, 0.965929, 0.258808, 0, 0.965929, 0.262004, -0.00573306, 0.96505, 0.367097, 0.0285744, 0.929744, 0.367099, 0.0285702, 0.929743, 0.2684, -0.0056162, 0.963291, 0.271458, 0.000128307, 0.96245, 0.268207, 0.00572301, 0.963344, 0.274213, 0.0281942, 0.961256, 0.274213, 0.0281942, 0.961256, 0.130508, 0, 0.991447, 0.133731, -0.00563029, 0.991002, 0.243138, 0.0281831, 0.969582, 0.243138, 0.0281842, 0.969582, 0.14016, -0.00573509, 0.990112, 0.143508, -0.000150026, 0.989649, 0.140373, 0.00560757, 0.990083, 0.13385, 0.00570205, 0.990985, 0.130507, 0, 0.991447, 0.130507, 0, 0.991447, 0.133849, -0.00570153, 0.990985, 0.140373, -0.00560777, 0.990083, 0.143509, 0.000150038, 0.989649, 0.14016, 0.00573523, 0.990112, 0.133731, 0.00562993, 0.991002, 0.243138, -0.0281838, 0.969582, 0.243138, -0.0281842, 0.969582, 0.016084, -0.0281877, 0.999473, 0.016084, -0.0281877, 0.999473, 0.016084, 0.0281877, 0.999473, 0.016084, 0.0281877, 0.999473
-};
-
-float mBitangents[] = {
-0, 0.999976, 0.00699161, -0.00182983, 0.999902, 0.0138625, -0.493579, 0.8685, -0.0456946, -0.495402, 0.868664, 0, -0.495455, 0.868634, 0, -0.857147, 0.507766, -0.086445, -0.861075, 0.507804, 0.026176, -0.994468, 0.0107917, -0.104481, -0.999598, 0.0108003, 0.0262183, -0.8656, -0.491719, -0.0946032, -0.870546, -0.491712, 0.0191905, -0.501289, -0.863271, -0.0589239, -0.504685, -0.863275, 0.00700841, 0.000907098, -0.999976, -0.00693087, 0, -0.999976, -0.00699002, 0, -0.999976, -0.00699002, 0.000907098, -0.999976, -0.00693087, 0.502783, -0.863136, 0.0469556, 0.504606, -0.863139, -0.0190702, 0.86636, -0.491643, 0.0877868, 0.87041, -0.491637, -0.0260483, 0.994453, 0.0107828, 0.104631, 0.999602, 0.0107913, -0.0260678, 0.856358, 0.507849, 0.0934841, 0.861209, 0.507893, -0.0190938, 0.492078, 0.868634, 0.057733, 0.495455, 0.868634, 0, 0.495402, 0.868664, 0, -0.00362178, 0.999902, 0.0135051, -0.478522, 0.868664, -0.12822, -0.501115, 0.864658, -0.0353588, -0.838503, 0.507814, -0.19758, -0.972324, 0.0107703, -0.233389, -0.845824, -0.491759, -0.20677, -0.489299, -0.863277, -0.123853, 0.00180677, -0.999976, -0.00675578, 0.00180677, -0.999976, -0.00675578, 0.492346, -0.86314, 0.112179, 0.847471, -0.491679, 0.200114, 0.972289, 0.0107613, 0.233533, 0.8368, 0.507904, 0.20445, 0.478576, 0.868631, 0.128241, 0.487274, 0.868133, 0.0943875, -0.00534827, 0.999902, 0.0129185, -0.464941, 0.868496, -0.171884, -0.478522, 0.868664, -0.12822, -0.478576, 0.868631, -0.128241, -0.805557, 0.507783, -0.305342, -0.933541, 0.0107158, -0.358311, -0.81161, -0.491738, -0.315408, -0.466336, -0.863265, -0.193145, -0.479404, -0.862763, -0.16066, 0.00267743, -0.999976, -0.00645659, 0.00267743, -0.999976, -0.00645659, 0.466279, -0.863294, 0.193153, 0.500678, -0.859334, 0.104245, 0.814111, -0.49166, 0.309019, 0.933489, 0.0107067, 0.358447, 0.802971, 0.507869, 0.31194, 0.460376, 0.86863, 0.183129, 0.478576, 0.868631, 0.128241, 0.478522, 0.868664, 0.12822, -0.00699461, 0.999902, 0.01211, -0.438514, 0.868506, -0.231091, -0.758812, 0.507779, -0.407879, -0.878787, 0.0107537, -0.477093, -0.763514, -0.491705, -0.418656, -0.440601, -0.863258, -0.246287, -0.466336, -0.863265, -0.193145, -0.466279, -0.863294, -0.193153, 0.00349415, -0.999976, -0.00605664, 0.00349415, -0.999976, -0.00605664, 0.446555, -0.863127, 0.235798, 0.466279, -0.863294, 0.193153, 0.466336, -0.863265, 0.193145, 0.766825, -0.49163, 0.412648, 0.878715, 0.0107446, 0.477225, 0.755392, 0.507864, 0.414075, 0.432514, 0.868643, 0.241644, -0.00851719, 0.999902, 0.0110951, -0.404611, 0.868495, -0.286367, -0.699086, 0.50777, -0.503436, -0.808995, 0.01076, -0.587717, -0.702323, -0.491736, -0.514721, -0.404672, -0.863267, -0.301681, 0.00425318, -0.999976, -0.00554548, 0.00425318, -0.999976, -0.00554548, 0.411948, -0.863133, 0.29206, 0.706392, -0.491658, 0.509197, 0.80891, 0.010751, 0.587834, 0.694884, 0.507854, 0.509137, 0.397293, 0.868628, 0.296046, -0.00988978, 0.999902, 0.00988835, -0.363769, 0.868495, -0.336732, -0.627386, 0.507794, -0.590366, -0.725362, 0.0107483, -0.688283, -0.62912, -0.491763, -0.601977, -0.356907, -0.863266, -0.356915, -0.381437, -0.862764, -0.33188, 0.00494233, -0.999976, -0.0049438, 0.00494233, -0.999976, -0.0049438, 0.356878, -0.863294, 0.356878, 0.422663, -0.859339, 0.287911, 0.633873, -0.491682, 0.597038, 0.725261, 0.0107393, 0.68839, 0.622472, 0.507881, 0.595471, 0.355254, 0.868627, 0.345371, -0.0110893, 0.999902, 0.00850773, -0.31671, 0.868496, -0.381326, -0.544965, 0.507769, -0.667221, -0.629321, 0.0107632, -0.777071, -0.545173, -0.491736, -0.678957, -0.312803, -0.863267, -0.396138, -0.356907, -0.863266, -0.356915, -0.356878, -0.863294, -0.356878, 0.00554672, -0.999976, -0.00425927, 0.00554672, -0.999976, -0.00425927, 0.322319, -0.863133, 0.388731, 0.356878, -0.863294, 0.356878, 0.356907, -0.863266, 0.356915, 0.55053, -0.491658, 0.674677, 0.6292, 0.0107542, 0.777169, 0.539434, 0.507853, 0.671637, 0.307131, 0.868628, 0.388787, -0.0121119, 0.999902, 0.00699031, -0.264215, 0.868505, -0.419392, -0.453214, 0.50778, -0.732637, -0.522505, 0.010755, -0.852569, -0.451894, -0.491705, -0.744324, -0.258429, -0.863257, -0.433591, 0.00605362, -0.999976, -0.0034979, 0.00605362, -0.999976, -0.0034979, 0.268828, -0.863127, 0.427486, 0.457766, -0.491631, 0.740777, 0.522375, 0.010746, 0.852648, 0.447145, 0.507865, 0.736298, 0.253751, 0.868642, 0.425524, -0.0129164, 0.999902, 0.00535314, -0.207223, 0.868496, -0.450303, -0.353706, 0.507784, -0.785524, -0.406751, 0.0107158, -0.913476, -0.350871, -0.491737, -0.796922, -0.193148, -0.863265, -0.466334, -0.225417, -0.862764, -0.452576, 0.00646213, -0.999976, -0.0026738, 0.00646213, -0.999976, -0.0026738, 0.193153, -0.863294, 0.466279, 0.280291, -0.859342, 0.427748, 0.357154, -0.491659, 0.794174, 0.406616, 0.0107067, 0.913536, 0.347214, 0.507869, 0.78836, 0.196044, 0.86863, 0.455027, -0.0135093, 0.999902, 0.00361638, -0.12822, 0.868664, -0.478522, -0.219942, 0.864657, -0.451658, -0.248147, 0.507815, -0.824953, -0.284038, 0.010771, -0.958753, -0.243843, -0.491759, -0.835891, -0.137396, -0.863277, -0.48567, -0.193148, -0.863265, -0.466334, -0.193153, -0.863294, -0.466279, 0.00675089, -0.999976, -0.00181216, 0.00675089, -0.999976, -0.00181216, 0.149021, -0.86314, 0.482476, 0.193153, -0.863294, 0.466279, 0.193148, -0.863265, 0.466334, 0.250436, -0.491679, 0.833987, 0.283891, 0.010762, 0.958796, 0.241336, 0.507904, 0.826916, 0.128241, 0.868631, 0.478576, 0.161896, 0.868133, 0.469185, -0.0138658, 0.999902, 0.0018201, -0.0836152, 0.8685, -0.488586, -0.12822, 0.868664, -0.478522, -0.128241, 0.868631, -0.478576, -0.138347, 0.507766, -0.850314, -0.156467, 0.0107912, -0.987624, -0.132656, -0.491719, -0.86059, -0.0728236, -0.863272, -0.499458, 0.00693241, -0.999976, -0.000917748, 0.00693241, -0.999976, -0.000917748, 0.0847701, -0.863137, 0.497804, 0.139437, -0.491643, 0.85956, 0.15632, 0.0107823, 0.987648, 0.131346, 0.507849, 0.851374, 0.0715927, 0.868635, 0.490253, 0.128241, 0.868631, 0.478576, 0.12822, 0.868664, 0.478522, -0.0139839, 0.999902, 0, 0, 0.868664, -0.495402, -0.095548, 0.86466, -0.493188, -0.026176, 0.507804, -0.861075, -0.0262183, 0.0108002, -0.999598, -0.0191905, -0.491712, -0.870546, -0.00700841, -0.863275, -0.504685, 0.00699002, -0.999976, 0, 0.00699002, -0.999976, 0, 0.0190702, -0.863139, 0.504606, 0.0260483, -0.491637, 0.87041, 0.0260678, 0.0107913, 0.999602, 0.0190938, 0.507893, 0.861209, 0, 0.868634, 0.495455, 0.0349455, 0.868133, 0.4951, -0.0138625, 0.999902, -0.00182983, 0.0456944, 0.8685, -0.493579, 0, 0.868664, -0.495402, 0, 0.868634, -0.495455, 0.0864446, 0.507766, -0.857147, 0.10448, 0.0107917, -0.994469, 0.0945984, -0.491719, -0.8656, 0.0589255, -0.863271, -0.501288, 0.006934, -0.999976, 0.000907501, 0.006934, -0.999976, 0.000907501, -0.0469603, -0.863136, 0.502783, -0.0877852, -0.491643, 0.866361, -0.104627, 0.0107828, 0.994453, -0.0934845, 0.507849, 0.856358, -0.0577325, 0.868634, 0.492078, 0, 0.868634, 0.495455, 0, 0.868664, 0.495402, -0.0135051, 0.999902, -0.00362178, 0.12822, 0.868664, -0.478522, 0.0353572, 0.864658, -0.501116, 0.19758, 0.507814, -0.838503, 0.233387, 0.0107703, -0.972324, 0.20677, -0.491759, -0.845824, 0.123855, -0.863277, -0.489298, 0.00675429, -0.999976, 0.00180637, 0.00675429, -0.999976, 0.00180637, -0.112179, -0.86314, 0.492346, -0.200112, -0.491679, 0.847471, -0.233533, 0.0107613, 0.972289, -0.20445, 0.507904, 0.8368, -0.128241, 0.868631, 0.478576, -0.0943875, 0.868133, 0.487274, -0.0129185, 0.999902, -0.00534827, 0.171884, 0.868496, -0.464941, 0.12822, 0.868664, -0.478522, 0.128241, 0.868631, -0.478576, 0.30534, 0.507783, -0.805558, 0.358308, 0.0107158, -0.933542, 0.315412, -0.491738, -0.811609, 0.193145, -0.863265, -0.466336, 0.16066, -0.862763, -0.479404, 0.00645659, -0.999976, 0.00267743, 0.00645659, -0.999976, 0.00267743, -0.193153, -0.863294, 0.466279, -0.104245, -0.859334, 0.500678, -0.30902, -0.49166, 0.814111, -0.358449, 0.0107067, 0.933488, -0.311935, 0.507869, 0.802973, -0.183129, 0.86863, 0.460376, -0.128241, 0.868631, 0.478576, -0.12822, 0.868664, 0.478522, -0.0121108, 0.999902, -0.00699504, 0.231093, 0.868506, -0.438513, 0.407876, 0.507779, -0.758813, 0.477096, 0.0107537, -0.878786, 0.418654, -0.491705, -0.763515, 0.246287, -0.863258, -0.440601, 0.193145, -0.863265, -0.466336, 0.193153, -0.863294, -0.466279, 0.00605664, -0.999976, 0.00349415, 0.00605664, -0.999976, 0.00349415, -0.235798, -0.863127, 0.446555, -0.193153, -0.863294, 0.466279, -0.193145, -0.863265, 0.466336, -0.412648, -0.49163, 0.766825, -0.477223, 0.0107446, 0.878717, -0.414076, 0.507864, 0.755391, -0.241642, 0.868643, 0.432515, -0.0110935, 0.999902, -0.00851593, 0.286365, 0.868495, -0.404613, 0.503433, 0.50777, -0.699088, 0.587722, 0.01076, -0.808992, 0.514721, -0.491736, -0.702323, 0.301681, -0.863267, -0.404672, 0.00554548, -0.999976, 0.00425318, 0.00554548, -0.999976, 0.00425318, -0.29206, -0.863133, 0.411948, -0.509197, -0.491658, 0.706393, -0.587836, 0.010751, 0.808909, -0.50914, 0.507854, 0.694882, -0.296041, 0.868628, 0.397296, -0.00988835, 0.999902, -0.00988978, 0.33673, 0.868495, -0.363771, 0.590368, 0.507794, -0.627384, 0.688283, 0.0107483, -0.725362, 0.601977, -0.491763, -0.629121, 0.356911, -0.863266, -0.356911, 0.33188, -0.862764, -0.381437, 0.00494542, -0.999976, 0.00494395, 0.00494542, -0.999976, 0.00494395, -0.356882, -0.863294, 0.356874, -0.287911, -0.859339, 0.422663, -0.597035, -0.491682, 0.633875, -0.688391, 0.0107393, 0.72526, -0.59547, 0.507881, 0.622473, -0.345371, 0.868627, 0.355254, -0.00850833, 0.999902, -0.0110901, 0.381328, 0.868496, -0.316708, 0.66722, 0.507769, -0.544966, 0.77707, 0.0107632, -0.629322, 0.678958, -0.491736, -0.545171, 0.396138, -0.863267, -0.312802, 0.356911, -0.863266, -0.356911, 0.356882, -0.863294, -0.356874, 0.00425849, -0.999976, 0.0055457, 0.00425849, -0.999976, 0.0055457, -0.388731, -0.863133, 0.32232, -0.356882, -0.863294, 0.356874, -0.356911, -0.863266, 0.356911, -0.674678, -0.491658, 0.550529, -0.777171, 0.0107542, 0.629198, -0.671635, 0.507853, 0.539437, -0.388787, 0.868628, 0.30713, -0.00698951, 0.999902, -0.0121105, 0.419392, 0.868505, -0.264214, 0.732637, 0.50778, -0.453214, 0.852568, 0.010755, -0.522506, 0.744324, -0.491705, -0.451894, 0.433591, -0.863257, -0.258429, 0.0034979, -0.999976, 0.00605362, 0.0034979, -0.999976, 0.00605362, -0.427486, -0.863127, 0.268828, -0.740777, -0.491631, 0.457764, -0.852647, 0.010746, 0.522377, -0.736297, 0.507865, 0.447147, -0.425526, 0.868642, 0.253748, -0.00535369, 0.999902, -0.0129177, 0.450305, 0.868496, -0.207219, 0.785523, 0.507784, -0.353708, 0.913474, 0.0107158, -0.406755, 0.796924, -0.491738, -0.350866, 0.466336, -0.863265, -0.193145, 0.452576, -0.862764, -0.225417, 0.0026738, -0.999976, 0.00646213, 0.0026738, -0.999976, 0.00646213, -0.466279, -0.863294, 0.193153, -0.427748, -0.859342, 0.280291, -0.794175, -0.491659, 0.357151, -0.913537, 0.0107066, 0.406615, -0.788358, 0.507869, 0.347219, -0.455027, 0.86863, 0.196043, -0.0036156, 0.999902, -0.0135064, 0.478522, 0.868664, -0.12822, 0.451658, 0.864657, -0.219942, 0.824952, 0.507815, -0.248148, 0.958753, 0.010771, -0.284037, 0.835891, -0.491759, -0.243842, 0.485671, -0.863277, -0.137396, 0.466336, -0.863265, -0.193145, 0.466279, -0.863294, -0.193153, 0.00181216, -0.999976, 0.00675089, 0.00181216, -0.999976, 0.00675089, -0.482476, -0.86314, 0.14902, -0.466279, -0.863294, 0.193153, -0.466336, -0.863265, 0.193145, -0.833987, -0.491679, 0.250434, -0.958795, 0.010762, 0.283893, -0.826916, 0.507904, 0.241336, -0.478576, 0.868631, 0.128241, -0.469187, 0.868133, 0.161889, -0.0018201, 0.999902, -0.0138658, 0.488586, 0.8685, -0.083615, 0.478522, 0.868664, -0.12822, 0.478576, 0.868631, -0.128241, 0.850314, 0.507766, -0.138347, 0.987624, 0.0107912, -0.156466, 0.86059, -0.491719, -0.132652, 0.499458, -0.863272, -0.0728252, 0.000917336, -0.999976, 0.00692926, 0.000917336, -0.999976, 0.00692926, -0.497804, -0.863137, 0.0847748, -0.859561, -0.491643, 0.139435, -0.987648, 0.0107823, 0.156315, -0.851374, 0.507849, 0.131346, -0.490253, 0.868635, 0.0715921, -0.478576, 0.868631, 0.128241, -0.478522, 0.868664, 0.12822, 0, 0.999902, -0.0139839, 0.495402, 0.868664, 0, 0.493188, 0.86466, -0.0955476, 0.861075, 0.507804, -0.0261761, 0.999598, 0.0108002, -0.0262167, 0.870546, -0.491712, -0.0191905, 0.504685, -0.863275, -0.00701001, 0, -0.999976, 0.00699161, 0, -0.999976, 0.00699161, -0.504606, -0.863139, 0.0190702, -0.87041, -0.491637, 0.0260467, -0.999602, 0.0107913, 0.026068, -0.861209, 0.507893, 0.0190936, -0.495455, 0.868634, 0, -0.4951, 0.868133, 0.0349455, 0, 0.999902, -0.0139839, 0.00182983, 0.999902, -0.0138624, 0.493579, 0.8685, 0.0456944, 0.495402, 0.868664, 0, 0.495455, 0.868634, 0, 0.857147, 0.507766, 0.0864446, 0.861075, 0.507804, -0.0261761, 0.994469, 0.0107917, 0.10448, 0.999598, 0.0108002, -0.0262167, 0.8656, -0.491719, 0.0945984, 0.870546, -0.491712, -0.0191905, 0.501288, -0.863271, 0.0589255, 0.504685, -0.863275, -0.00701001, -0.000907511, -0.999976, 0.00693401, 0, -0.999976, 0.00699161, 0, -0.999976, 0.00699161, -0.000907511, -0.999976, 0.00693401, -0.502783, -0.863136, -0.0469603, -0.504606, -0.863139, 0.0190702, -0.866361, -0.491643, -0.0877852, -0.87041, -0.491637, 0.0260467, -0.994453, 0.0107827, -0.104627, -0.999602, 0.0107913, 0.026068, -0.856358, 0.507849, -0.0934845, -0.861209, 0.507893, 0.0190936, -0.492078, 0.868634, -0.0577325, -0.495455, 0.868634, 0, -0.495402, 0.868664, 0, 0.00362177, 0.999902, -0.0135051, 0.478522, 0.868664, 0.12822, 0.501116, 0.864658, 0.0353572, 0.838503, 0.507814, 0.19758, 0.972324, 0.0107703, 0.233387, 0.845824, -0.491759, 0.20677, 0.489298, -0.863277, 0.123855, -0.00180637, -0.999976, 0.00675428, -0.00180637, -0.999976, 0.00675428, -0.492346, -0.86314, -0.112179, -0.847471, -0.491679, -0.200112, -0.972289, 0.0107613, -0.233534, -0.8368, 0.507904, -0.20445, -0.478576, 0.868631, -0.128241, -0.487274, 0.868133, -0.0943875, 0.00534887, 0.999902, -0.01292, 0.464939, 0.868497, 0.171888, 0.478522, 0.868664, 0.12822, 0.478576, 0.868631, 0.128241, 0.805558, 0.507783, 0.30534, 0.933543, 0.0107158, 0.358305, 0.81161, -0.491738, 0.315408, 0.466336, -0.863265, 0.193145, 0.479404, -0.862763, 0.16066, -0.00267854, -0.999976, 0.0064593, -0.00267854, -0.999976, 0.0064593, -0.466276, -0.863294, -0.19316, -0.500678, -0.859334, -0.104245, -0.814111, -0.49166, -0.309019, -0.93349, 0.0107067, -0.358445, -0.802974, 0.507869, -0.311933, -0.460376, 0.86863, -0.18313, -0.478576, 0.868631, -0.128241, -0.478522, 0.868664, -0.12822, 0.00699355, 0.999902, -0.0121082, 0.438513, 0.868506, 0.231093, 0.758814, 0.507779, 0.407875, 0.878786, 0.0107537, 0.477094, 0.763515, -0.491704, 0.418654, 0.4406, -0.863258, 0.246288, 0.466336, -0.863265, 0.193145, 0.466276, -0.863294, 0.19316, -0.00349349, -0.999976, 0.00605547, -0.00349349, -0.999976, 0.00605547, -0.446554, -0.863127, -0.235798, -0.466276, -0.863294, -0.19316, -0.466336, -0.863265, -0.193145, -0.766826, -0.49163, -0.412647, -0.878717, 0.0107446, -0.477222, -0.755391, 0.507864, -0.414076, -0.432514, 0.868643, -0.241644, 0.00851592, 0.999902, -0.0110934, 0.404613, 0.868495, 0.286365, 0.699088, 0.50777, 0.503433, 0.808992, 0.01076, 0.587722, 0.702323, -0.491736, 0.514721, 0.404672, -0.863267, 0.301681, -0.00425317, -0.999976, 0.00554549, -0.00425317, -0.999976, 0.00554549, -0.411948, -0.863133, -0.29206, -0.706393, -0.491658, -0.509197, -0.808909, 0.010751, -0.587836, -0.694882, 0.507854, -0.50914, -0.397296, 0.868628, -0.296042, 0.00988815, 0.999902, -0.00988672, 0.363776, 0.868495, 0.336725, 0.627384, 0.507794, 0.590368, 0.725361, 0.0107483, 0.688285, 0.629117, -0.491763, 0.601981, 0.356911, -0.863266, 0.356911, 0.381437, -0.862764, 0.33188, -0.00494072, -0.999976, 0.00494219, -0.00494072, -0.999976, 0.00494219, -0.356882, -0.863294, -0.356874, -0.422663, -0.859339, -0.287911, -0.633873, -0.491682, -0.597037, -0.725255, 0.0107393, -0.688396, -0.622473, 0.507881, -0.595469, -0.355256, 0.868627, -0.345369, 0.0110939, 0.999902, -0.00851124, 0.316708, 0.868496, 0.381328, 0.544968, 0.507769, 0.667219, 0.629318, 0.0107633, 0.777073, 0.545172, -0.491736, 0.678958, 0.312806, -0.863267, 0.396135, 0.356911, -0.863266, 0.356911, 0.356882, -0.863294, 0.356874, -0.0055475, -0.999976, 0.00425988, -0.0055475, -0.999976, 0.00425988, -0.322321, -0.863133, -0.38873, -0.356882, -0.863294, -0.356874, -0.356911, -0.863266, -0.356911, -0.55053, -0.491658, -0.674677, -0.629197, 0.0107542, -0.777171, -0.539435, 0.507853, -0.671637, -0.307135, 0.868628, -0.388784, 0.0121088, 0.999902, -0.00698857, 0.264217, 0.868505, 0.419391, 0.453213, 0.50778, 0.732637, 0.522505, 0.010755, 0.852568, 0.451893, -0.491705, 0.744325, 0.258429, -0.863257, 0.433591, -0.00605363, -0.999976, 0.00349791, -0.00605363, -0.999976, 0.00349791, -0.268829, -0.863127, -0.427485, -0.457764, -0.491631, -0.740778, -0.522374, 0.010746, -0.852649, -0.447148, 0.507865, -0.736296, -0.253749, 0.868643, -0.425525, 0.0129189, 0.999902, -0.00535419, 0.207218, 0.868496, 0.450305, 0.353707, 0.507784, 0.785523, 0.406752, 0.0107158, 0.913476, 0.35087, -0.491737, 0.796922, 0.193145, -0.863265, 0.466336, 0.225417, -0.862764, 0.452576, -0.00646213, -0.999976, 0.00267381, -0.00646213, -0.999976, 0.00267381, -0.193153, -0.863294, -0.466279, -0.280291, -0.859342, -0.427748, -0.357151, -0.491659, -0.794175, -0.406618, 0.0107067, -0.913536, -0.347215, 0.507869, -0.788359, -0.196044, 0.86863, -0.455027, 0.0135064, 0.999902, -0.00361558, 0.12822, 0.868664, 0.478522, 0.219942, 0.864657, 0.451658, 0.248143, 0.507815, 0.824954, 0.284044, 0.0107709, 0.958751, 0.243842, -0.491759, 0.835891, 0.137394, -0.863277, 0.485671, 0.193145, -0.863265, 0.466336, 0.193153, -0.863294, 0.466279, -0.00675387, -0.999976, 0.00181295, -0.00675387, -0.999976, 0.00181295, -0.149016, -0.86314, -0.482477, -0.193153, -0.863294, -0.466279, -0.193145, -0.863265, -0.466336, -0.250436, -0.491679, -0.833987, -0.283894, 0.010762, -0.958795, -0.24134, 0.507904, -0.826915, -0.128231, 0.868631, -0.478578, -0.161889, 0.868133, -0.469187, 0.0138674, 0.999902, -0.00182031, 0.0836085, 0.8685, 0.488587, 0.12822, 0.868664, 0.478522, 0.128231, 0.868631, 0.478578, 0.138349, 0.507766, 0.850314, 0.156468, 0.0107912, 0.987624, 0.132656, -0.491719, 0.86059, 0.0728236, -0.863272, 0.499459, -0.00692768, -0.999976, 0.00091713, -0.00692768, -0.999976, 0.00091713, -0.0847748, -0.863137, -0.497804, -0.139437, -0.491643, -0.85956, -0.156322, 0.0107823, -0.987647, -0.131344, 0.507849, -0.851374, -0.0715906, 0.868635, -0.490254, -0.128231, 0.868631, -0.478578, -0.12822, 0.868664, -0.478522, 0.0139807, 0.999902, 0, 0, 0.868664, 0.495402, 0.0955476, 0.86466, 0.493188, 0.0261761, 0.507804, 0.861075, 0.0262183, 0.0108003, 0.999598, 0.0191905, -0.491712, 0.870546, 0.00701001, -0.863275, 0.504685, -0.00699161, -0.999976, 0, -0.00699161, -0.999976, 0, -0.0190702, -0.863139, -0.504606, -0.0260483, -0.491637, -0.87041, -0.026068, 0.0107913, -0.999602, -0.0190936, 0.507893, -0.861209, 0, 0.868634, -0.495455, -0.0349375, 0.868134, -0.4951, 0.0138624, 0.999902, 0.00182983, -0.0456946, 0.8685, 0.493579, 0, 0.868664, 0.495402, 0, 0.868634, 0.495455, -0.086445, 0.507766, 0.857147, -0.104481, 0.0107917, 0.994468, -0.0946032, -0.491719, 0.8656, -0.0589239, -0.863271, 0.501289, -0.00693086, -0.999976, -0.0009071, -0.00693086, -0.999976, -0.0009071, 0.0469556, -0.863136, -0.502783, 0.0877868, -0.491643, -0.86636, 0.104631, 0.0107828, -0.994453, 0.0934841, 0.507849, -0.856358, 0.0577331, 0.868634, -0.492078, 0, 0.868634, -0.495455, 0, 0.868664, -0.495402, 0.0135052, 0.999902, 0.00362179, -0.12822, 0.868664, 0.478522, -0.0353588, 0.864658, 0.501115, -0.197575, 0.507814, 0.838504, -0.23339, 0.0107703, 0.972324, -0.206773, -0.491759, 0.845824, -0.123849, -0.863277, 0.4893, -0.00675577, -0.999976, -0.00180677, -0.00675577, -0.999976, -0.00180677, 0.112178, -0.86314, -0.492346, 0.200111, -0.491679, -0.847471, 0.233538, 0.0107613, -0.972288, 0.204449, 0.507904, -0.8368, 0.128233, 0.868631, -0.478578, 0.0943875, 0.868133, -0.487274, 0.0129198, 0.999902, 0.00534879, -0.171886, 0.868496, 0.46494, -0.12822, 0.868664, 0.478522, -0.128233, 0.868631, 0.478578, -0.30534, 0.507783, 0.805558, -0.358308, 0.0107158, 0.933542, -0.315411, -0.491738, 0.811609, -0.193148, -0.863265, 0.466335, -0.16066, -0.862763, 0.479404, -0.00645661, -0.999976, -0.00267743, -0.00645661, -0.999976, -0.00267743, 0.193153, -0.863294, -0.466279, 0.104238, -0.859333, -0.500681, 0.309023, -0.49166, -0.81411, 0.358449, 0.0107067, -0.933488, 0.311932, 0.507869, -0.802974, 0.18313, 0.86863, -0.460376, 0.128233, 0.868631, -0.478578, 0.12822, 0.868664, -0.478522, 0.0121077, 0.999902, 0.00699325, -0.231091, 0.868506, 0.438514, -0.407877, 0.507779, 0.758813, -0.477094, 0.0107537, 0.878786, -0.418656, -0.491705, 0.763514, -0.246287, -0.863258, 0.440601, -0.193148, -0.863265, 0.466335, -0.193153, -0.863294, 0.466279, -0.00605666, -0.999976, -0.00349416, -0.00605666, -0.999976, -0.00349416, 0.235799, -0.863127, -0.446554, 0.193153, -0.863294, -0.466279, 0.193148, -0.863265, -0.466335, 0.412649, -0.49163, -0.766825, 0.477224, 0.0107446, -0.878716, 0.414075, 0.507864, -0.755392, 0.241645, 0.868643, -0.432513, 0.0110959, 0.999902, 0.0085178, -0.286369, 0.868495, 0.404609, -0.503434, 0.50777, 0.699088, -0.587717, 0.01076, 0.808995, -0.514721, -0.491736, 0.702323, -0.301681, -0.863267, 0.404671, -0.00554548, -0.999976, -0.00425318, -0.00554548, -0.999976, -0.00425318, 0.29206, -0.863133, -0.411948, 0.509197, -0.491658, -0.706392, 0.587834, 0.010751, -0.808911, 0.509136, 0.507854, -0.694885, 0.296045, 0.868628, -0.397294, 0.00988592, 0.999902, 0.00988735, -0.336728, 0.868495, 0.363773, -0.590366, 0.507794, 0.627386, -0.688284, 0.0107483, 0.725362, -0.601979, -0.491763, 0.629119, -0.356911, -0.863266, 0.356911, -0.33188, -0.862764, 0.381437, -0.00494218, -0.999976, -0.00494072, -0.00494218, -0.999976, -0.00494072, 0.356874, -0.863294, -0.356882, 0.287911, -0.859339, -0.422663, 0.597036, -0.491682, -0.633874, 0.688392, 0.0107393, -0.725259, 0.59547, 0.507881, -0.622472, 0.345371, 0.868628, -0.355254, 0.00850989, 0.999902, 0.0110921, -0.381327, 0.868496, 0.31671, -0.667217, 0.507769, 0.54497, -0.777075, 0.0107633, 0.629317, -0.678958, -0.491736, 0.545171, -0.396137, -0.863267, 0.312804, -0.356911, -0.863266, 0.356911, -0.356874, -0.863294, 0.356882, -0.00425986, -0.999976, -0.0055475, -0.00425986, -0.999976, -0.0055475, 0.388731, -0.863133, -0.32232, 0.356874, -0.863294, -0.356882, 0.356911, -0.863266, -0.356911, 0.674678, -0.491658, -0.550528, 0.777172, 0.0107543, -0.629196, 0.671638, 0.507853, -0.539433, 0.388783, 0.868628, -0.307137, 0.00698952, 0.999902, 0.0121105, -0.419391, 0.868505, 0.264216, -0.732637, 0.50778, 0.453214, -0.852569, 0.010755, 0.522504, -0.744324, -0.491705, 0.451894, -0.433591, -0.863257, 0.258429, -0.00349792, -0.999976, -0.00605363, -0.00349792, -0.999976, -0.00605363, 0.427486, -0.863127, -0.268828, 0.740777, -0.491631, -0.457764, 0.852649, 0.010746, -0.522374, 0.736297, 0.507865, -0.447147, 0.425524, 0.868642, -0.253751, 0.00535313, 0.999902, 0.0129164, -0.450303, 0.868496, 0.207223, -0.785524, 0.507784, 0.353706, -0.913476, 0.0107158, 0.406751, -0.796922, -0.491737, 0.350871, -0.466334, -0.863265, 0.193148, -0.452576, -0.862764, 0.225417, -0.00267381, -0.999976, -0.00646214, -0.00267381, -0.999976, -0.00646214, 0.466279, -0.863294, -0.193153, 0.427748, -0.859342, -0.280291, 0.794174, -0.491659, -0.357154, 0.913536, 0.0107067, -0.406616, 0.78836, 0.507869, -0.347214, 0.455027, 0.86863, -0.196044, 0.00361678, 0.999902, 0.0135108, -0.478524, 0.868664, 0.128212, -0.451658, 0.864657, 0.219942, -0.824953, 0.507815, 0.248146, -0.958752, 0.010771, 0.28404, -0.83589, -0.491759, 0.243846, -0.485672, -0.863277, 0.137391, -0.466335, -0.863265, 0.193148, -0.466279, -0.863294, 0.193153, -0.00181216, -0.999976, -0.00675088, -0.00181216, -0.999976, -0.00675088, 0.482476, -0.86314, -0.149019, 0.466279, -0.863294, -0.193153, 0.466335, -0.863265, -0.193148, 0.833988, -0.491679, -0.250433, 0.958795, 0.010762, -0.283896, 0.826916, 0.507904, -0.241336, 0.478576, 0.868631, -0.128241, 0.469185, 0.868133, -0.161896, 0.00181969, 0.999902, 0.0138627, -0.488586, 0.8685, 0.0836152, -0.478524, 0.868664, 0.128212, -0.478576, 0.868631, 0.128241, -0.850314, 0.507766, 0.138347, -0.987624, 0.0107912, 0.156469, -0.86059, -0.491719, 0.132655, -0.499459, -0.863272, 0.0728236, -0.000917745, -0.999976, -0.0069324, -0.000917745, -0.999976, -0.0069324, 0.497805, -0.863137, -0.0847685, 0.85956, -0.491643, -0.139438, 0.987648, 0.0107823, -0.15632, 0.851374, 0.507849, -0.131346, 0.490254, 0.868635, -0.0715912, 0.478576, 0.868631, -0.128241, 0.478524, 0.868664, -0.128212, -0.495402, 0.868664, 0, -0.493188, 0.86466, 0.095548, 0.495455, 0.868634, 0, 0.495099, 0.868133, -0.0349455
-};
-
-uint32_t mIndices[] = {
-3, 1, 0, 0, 1, 25, 0, 25, 27, 759, 775, 0, 759, 0, 758, 758, 0, 778, 3, 2, 1, 6, 5, 2, 6, 2, 4, 2, 29, 28, 2, 28, 1, 5, 30, 2, 1, 28, 42, 45, 43, 28, 28, 43, 59, 28, 59, 61, 1, 42, 25, 26, 25, 23, 25, 41, 40, 25, 40, 23, 26, 23, 24, 24, 23, 21, 23, 40, 39, 23, 39, 21, 40, 58, 57, 40, 57, 39, 60, 58, 40, 21, 39, 38, 39, 57, 56, 39, 56, 38, 57, 76, 75, 57, 75, 56, 58, 76, 57, 38, 56, 55, 56, 75, 72, 56, 72, 74, 75, 88, 87, 75, 87, 72, 76, 88, 75, 73, 72, 71, 72, 87, 86, 72, 86, 71, 87, 101, 100, 87, 100, 86, 88, 102, 87, 118, 116, 100, 118, 117, 116, 117, 131, 116, 103, 120, 117, 103, 117, 119, 117, 132, 131, 120, 132, 117, 132, 145, 131, 120, 133, 132, 132, 146, 145, 133, 147, 132, 164, 162, 145, 164, 163, 162, 163, 180, 162, 148, 166, 163, 148, 163, 165, 163, 181, 180, 166, 181, 163, 181, 196, 180, 166, 182, 181, 181, 197, 196, 182, 197, 181, 149, 167, 166, 149, 166, 148, 167, 182, 166, 167, 183, 182, 182, 198, 197, 183, 198, 182, 197, 213, 212, 197, 212, 196, 198, 213, 197, 183, 199, 198, 198, 214, 213, 199, 214, 198, 168, 184, 183, 168, 183, 167, 184, 199, 183, 184, 200, 199, 199, 215, 214, 200, 215, 199, 214, 230, 229, 214, 229, 213, 215, 230, 214, 200, 216, 215, 215, 231, 230, 216, 231, 215, 185, 201, 200, 185, 200, 184, 218, 216, 200, 218, 217, 216, 216, 232, 231, 217, 232, 216, 231, 249, 248, 231, 248, 230, 232, 249, 231, 217, 233, 232, 232, 250, 249, 252, 250, 232, 249, 268, 267, 249, 267, 248, 250, 268, 249, 230, 248, 247, 248, 267, 264, 248, 264, 266, 267, 280, 279, 267, 279, 264, 268, 280, 267, 265, 264, 263, 264, 279, 278, 264, 278, 263, 279, 293, 292, 279, 292, 278, 280, 294, 279, 310, 308, 292, 310, 309, 308, 309, 323, 308, 295, 312, 309, 295, 309, 311, 309, 324, 323, 312, 324, 309, 324, 337, 323, 312, 325, 324, 324, 338, 337, 325, 339, 324, 356, 354, 337, 356, 355, 354, 355, 372, 354, 340, 358, 355, 340, 355, 357, 355, 373, 372, 358, 373, 355, 373, 388, 372, 358, 374, 373, 373, 389, 388, 374, 389, 373, 341, 359, 358, 341, 358, 340, 359, 374, 358, 359, 375, 374, 374, 390, 389, 375, 390, 374, 342, 360, 359, 342, 359, 341, 360, 375, 359, 326, 341, 340, 327, 342, 341, 327, 341, 326, 328, 343, 342, 328, 342, 327, 343, 360, 342, 343, 361, 360, 360, 376, 375, 378, 376, 360, 316, 329, 343, 316, 343, 328, 329, 362, 343, 300, 317, 316, 300, 316, 299, 299, 316, 328, 317, 329, 316, 317, 330, 329, 330, 344, 329, 329, 344, 362, 301, 318, 317, 301, 317, 300, 318, 330, 317, 318, 331, 330, 330, 345, 344, 331, 346, 330, 365, 363, 344, 344, 363, 377, 344, 377, 379, 365, 364, 363, 364, 380, 363, 363, 380, 394, 363, 394, 377, 378, 377, 376, 377, 393, 392, 377, 392, 376, 376, 392, 391, 376, 391, 375, 375, 391, 390, 364, 381, 380, 347, 367, 364, 347, 364, 366, 367, 382, 364, 348, 368, 367, 348, 367, 347, 367, 383, 382, 368, 383, 367, 332, 348, 347, 333, 349, 348, 333, 348, 332, 349, 368, 348, 349, 369, 368, 368, 384, 383, 369, 384, 368, 351, 350, 349, 351, 349, 333, 350, 369, 349, 320, 333, 332, 321, 334, 333, 321, 333, 320, 303, 320, 319, 304, 321, 320, 304, 320, 303, 320, 332, 319, 307, 322, 321, 307, 321, 304, 322, 335, 321, 305, 304, 303, 291, 307, 304, 291, 304, 306, 305, 303, 288, 275, 288, 287, 276, 289, 288, 276, 288, 275, 288, 303, 302, 288, 302, 287, 259, 276, 275, 262, 277, 276, 262, 276, 259, 277, 290, 276, 260, 259, 258, 244, 262, 259, 244, 259, 261, 259, 275, 258, 260, 258, 241, 241, 258, 257, 258, 275, 274, 258, 274, 257, 275, 287, 274, 257, 274, 273, 274, 287, 286, 274, 286, 273, 240, 257, 256, 241, 257, 240, 257, 273, 256, 256, 273, 272, 273, 286, 285, 273, 285, 272, 286, 301, 300, 286, 300, 285, 287, 301, 286, 287, 302, 301, 302, 318, 301, 302, 319, 318, 303, 319, 302, 319, 331, 318, 319, 332, 331, 331, 347, 346, 332, 347, 331, 272, 285, 284, 285, 300, 299, 285, 299, 284, 272, 284, 271, 271, 284, 298, 284, 299, 315, 284, 315, 298, 299, 328, 315, 298, 315, 314, 315, 328, 327, 315, 327, 314, 283, 298, 297, 271, 298, 283, 298, 314, 297, 297, 314, 313, 314, 327, 326, 314, 326, 313, 282, 297, 296, 283, 297, 282, 297, 313, 296, 270, 283, 282, 254, 271, 283, 254, 283, 270, 269, 282, 281, 270, 282, 269, 282, 296, 281, 281, 296, 295, 296, 313, 312, 296, 312, 295, 268, 281, 280, 269, 281, 268, 281, 295, 280, 250, 269, 268, 251, 270, 269, 251, 269, 250, 252, 251, 250, 220, 235, 251, 220, 251, 253, 235, 270, 251, 204, 221, 220, 204, 220, 203, 203, 220, 234, 237, 235, 220, 205, 204, 203, 205, 203, 188, 188, 203, 217, 203, 234, 217, 172, 189, 188, 172, 188, 171, 171, 188, 202, 188, 217, 219, 173, 172, 171, 173, 171, 152, 152, 171, 185, 171, 202, 185, 138, 153, 152, 138, 152, 137, 137, 152, 170, 152, 185, 187, 186, 185, 184, 186, 184, 168, 150, 168, 167, 151, 169, 168, 151, 168, 150, 135, 150, 149, 136, 151, 150, 136, 150, 135, 150, 167, 149, 124, 137, 151, 124, 151, 136, 137, 170, 151, 123, 136, 135, 107, 124, 136, 107, 136, 123, 108, 125, 124, 108, 124, 107, 125, 137, 124, 125, 138, 137, 109, 126, 125, 109, 125, 108, 126, 138, 125, 93, 108, 107, 94, 109, 108, 94, 108, 93, 93, 107, 92, 92, 107, 123, 80, 93, 92, 81, 94, 93, 81, 93, 80, 82, 95, 94, 82, 94, 81, 95, 109, 94, 64, 81, 80, 65, 82, 81, 65, 81, 64, 63, 80, 79, 64, 80, 63, 80, 92, 79, 47, 64, 63, 48, 65, 64, 48, 64, 47, 49, 66, 65, 49, 65, 48, 66, 82, 65, 32, 48, 47, 33, 49, 48, 33, 48, 32, 31, 47, 44, 32, 47, 31, 47, 63, 44, 7, 32, 31, 9, 33, 32, 9, 32, 7, 11, 34, 33, 11, 33, 9, 34, 49, 33, 10, 9, 7, 12, 11, 9, 12, 9, 10, 8, 7, 5, 10, 7, 8, 7, 31, 5, 764, 10, 8, 765, 12, 10, 765, 10, 764, 14, 11, 12, 766, 14, 12, 766, 12, 765, 745, 765, 764, 748, 766, 765, 748, 765, 745, 744, 764, 763, 745, 764, 744, 764, 8, 763, 746, 745, 744, 731, 748, 745, 731, 745, 747, 728, 744, 743, 746, 744, 728, 744, 763, 743, 743, 763, 762, 763, 8, 6, 763, 6, 762, 727, 743, 742, 728, 743, 727, 743, 762, 742, 742, 762, 759, 762, 6, 776, 762, 776, 759, 8, 5, 6, 5, 31, 30, 31, 44, 46, 45, 44, 43, 44, 63, 62, 44, 62, 43, 43, 62, 78, 43, 78, 59, 63, 79, 62, 62, 79, 91, 62, 91, 78, 59, 78, 77, 78, 91, 90, 78, 90, 77, 60, 59, 58, 59, 77, 58, 58, 77, 76, 77, 90, 89, 77, 89, 76, 90, 105, 104, 90, 104, 89, 91, 105, 90, 76, 89, 88, 89, 104, 103, 89, 103, 88, 104, 121, 120, 104, 120, 103, 105, 121, 104, 91, 106, 105, 105, 122, 121, 106, 122, 105, 121, 134, 133, 121, 133, 120, 122, 134, 121, 106, 123, 122, 122, 135, 134, 123, 135, 122, 79, 92, 106, 79, 106, 91, 92, 123, 106, 135, 149, 134, 134, 149, 148, 134, 148, 133, 133, 148, 147, 88, 103, 102, 760, 759, 758, 742, 759, 761, 760, 758, 739, 739, 758, 772, 758, 778, 772, 725, 740, 739, 725, 739, 724, 724, 739, 757, 739, 772, 774, 712, 725, 724, 712, 724, 711, 711, 724, 738, 724, 757, 738, 695, 712, 711, 696, 713, 712, 696, 712, 695, 713, 725, 712, 695, 711, 694, 694, 711, 723, 711, 738, 723, 723, 738, 737, 738, 756, 755, 738, 755, 737, 710, 723, 722, 694, 723, 710, 723, 737, 722, 722, 737, 736, 737, 755, 754, 737, 754, 736, 755, 771, 770, 755, 770, 754, 773, 771, 755, 736, 754, 753, 754, 770, 769, 754, 769, 753, 770, 22, 20, 770, 20, 769, 771, 22, 770, 753, 769, 768, 769, 20, 18, 769, 18, 768, 735, 753, 750, 736, 753, 735, 753, 768, 750, 750, 768, 767, 768, 18, 15, 768, 15, 767, 18, 17, 16, 18, 16, 15, 20, 17, 18, 20, 19, 17, 17, 37, 36, 17, 36, 16, 19, 37, 17, 22, 21, 19, 22, 19, 20, 19, 38, 37, 21, 38, 19, 37, 54, 53, 37, 53, 36, 38, 55, 37, 73, 71, 53, 24, 21, 22, 771, 24, 22, 772, 777, 24, 772, 24, 771, 773, 772, 771, 750, 767, 749, 751, 750, 749, 735, 750, 752, 751, 749, 732, 719, 733, 732, 719, 732, 718, 704, 719, 718, 707, 720, 719, 707, 719, 704, 720, 734, 719, 704, 718, 703, 705, 704, 703, 690, 707, 704, 690, 704, 706, 705, 703, 687, 674, 688, 687, 674, 687, 673, 659, 674, 673, 662, 675, 674, 662, 674, 659, 675, 689, 674, 659, 673, 658, 660, 659, 658, 643, 662, 659, 643, 659, 661, 660, 658, 640, 624, 641, 640, 624, 640, 623, 608, 624, 623, 609, 625, 624, 609, 624, 608, 625, 642, 624, 608, 623, 607, 592, 608, 607, 593, 609, 608, 593, 608, 592, 594, 610, 609, 594, 609, 593, 610, 625, 609, 577, 593, 592, 578, 594, 593, 578, 593, 577, 576, 592, 591, 577, 592, 576, 592, 607, 591, 561, 577, 576, 562, 578, 577, 562, 577, 561, 563, 579, 578, 563, 578, 562, 579, 594, 578, 544, 562, 561, 545, 563, 562, 545, 562, 544, 543, 561, 558, 544, 561, 543, 561, 576, 558, 529, 544, 543, 530, 545, 544, 530, 544, 529, 531, 546, 545, 531, 545, 530, 546, 563, 545, 517, 530, 529, 518, 531, 530, 518, 530, 517, 516, 529, 528, 517, 529, 516, 529, 543, 528, 500, 517, 516, 501, 518, 517, 501, 517, 500, 487, 502, 518, 487, 518, 501, 502, 531, 518, 486, 501, 500, 474, 487, 501, 474, 501, 486, 485, 500, 499, 486, 500, 485, 500, 516, 499, 473, 486, 485, 457, 474, 486, 457, 486, 473, 458, 475, 474, 458, 474, 457, 475, 487, 474, 439, 458, 457, 439, 457, 438, 438, 457, 473, 454, 473, 472, 438, 473, 454, 473, 485, 472, 440, 439, 438, 440, 438, 423, 423, 438, 454, 426, 442, 439, 426, 439, 441, 442, 458, 439, 400, 426, 425, 402, 427, 426, 402, 426, 400, 427, 442, 426, 427, 443, 442, 442, 459, 458, 443, 459, 442, 404, 428, 427, 404, 427, 402, 428, 443, 427, 428, 444, 443, 443, 460, 459, 444, 460, 443, 459, 476, 475, 459, 475, 458, 460, 476, 459, 444, 461, 460, 460, 477, 476, 461, 477, 460, 429, 445, 444, 429, 444, 428, 463, 461, 444, 463, 462, 461, 461, 478, 477, 462, 478, 461, 477, 490, 489, 477, 489, 476, 478, 490, 477, 462, 479, 478, 478, 491, 490, 479, 491, 478, 447, 465, 462, 447, 462, 464, 465, 479, 462, 465, 480, 479, 479, 492, 491, 480, 493, 479, 480, 494, 493, 494, 510, 507, 494, 507, 509, 510, 525, 524, 510, 524, 507, 508, 507, 506, 507, 524, 523, 507, 523, 506, 524, 537, 536, 524, 536, 523, 525, 538, 524, 525, 539, 538, 539, 556, 553, 539, 553, 555, 556, 574, 573, 556, 573, 553, 554, 553, 552, 553, 573, 572, 553, 572, 552, 573, 589, 588, 573, 588, 572, 574, 589, 573, 574, 590, 589, 589, 605, 604, 589, 604, 588, 590, 605, 589, 572, 588, 587, 588, 604, 603, 588, 603, 587, 552, 572, 571, 572, 587, 571, 571, 587, 586, 587, 603, 602, 587, 602, 586, 603, 619, 618, 603, 618, 602, 604, 619, 603, 604, 620, 619, 605, 620, 604, 619, 635, 634, 619, 634, 618, 620, 635, 619, 602, 618, 617, 618, 634, 631, 618, 631, 633, 634, 651, 650, 634, 650, 631, 635, 651, 634, 632, 631, 630, 631, 650, 649, 631, 649, 630, 650, 667, 666, 650, 666, 649, 651, 667, 650, 630, 649, 665, 649, 666, 678, 649, 678, 665, 632, 630, 615, 615, 630, 646, 630, 665, 646, 646, 665, 664, 665, 678, 677, 665, 677, 664, 678, 693, 692, 678, 692, 677, 666, 693, 678, 664, 677, 676, 677, 692, 691, 677, 691, 676, 645, 664, 663, 646, 664, 645, 664, 676, 663, 663, 676, 675, 676, 691, 690, 676, 690, 675, 691, 708, 707, 691, 707, 690, 692, 708, 691, 675, 690, 689, 663, 675, 662, 644, 663, 662, 645, 663, 644, 644, 662, 643, 626, 644, 643, 627, 645, 644, 627, 644, 626, 625, 643, 642, 626, 643, 625, 610, 626, 625, 611, 627, 626, 611, 626, 610, 612, 628, 627, 612, 627, 611, 647, 645, 627, 595, 611, 610, 613, 612, 611, 613, 611, 595, 595, 610, 594, 579, 595, 594, 580, 596, 595, 580, 595, 579, 581, 580, 579, 581, 579, 563, 547, 566, 580, 547, 580, 582, 566, 597, 580, 533, 548, 547, 533, 547, 532, 532, 547, 565, 568, 566, 547, 520, 533, 532, 520, 532, 519, 519, 532, 546, 532, 565, 546, 503, 520, 519, 504, 521, 520, 504, 520, 503, 521, 533, 520, 503, 519, 502, 502, 519, 531, 519, 546, 531, 546, 564, 563, 488, 503, 502, 488, 502, 487, 475, 488, 487, 476, 489, 488, 476, 488, 475, 489, 503, 488, 489, 504, 503, 490, 504, 489, 490, 505, 504, 491, 505, 490, 491, 506, 505, 505, 522, 521, 505, 521, 504, 506, 522, 505, 508, 506, 491, 506, 523, 522, 522, 535, 534, 522, 534, 521, 523, 535, 522, 521, 534, 533, 534, 550, 549, 534, 549, 533, 535, 550, 534, 523, 536, 535, 535, 551, 550, 536, 551, 535, 550, 570, 567, 550, 567, 569, 551, 570, 550, 536, 552, 551, 551, 571, 570, 552, 571, 551, 554, 552, 536, 571, 586, 570, 570, 586, 585, 570, 585, 567, 586, 602, 599, 586, 599, 601, 602, 617, 599, 600, 599, 598, 599, 616, 615, 599, 615, 598, 600, 598, 583, 583, 598, 612, 598, 615, 629, 598, 629, 612, 615, 646, 648, 647, 646, 645, 583, 612, 614, 567, 584, 583, 567, 583, 566, 566, 583, 597, 568, 567, 566, 692, 709, 708, 708, 721, 720, 708, 720, 707, 709, 721, 708, 693, 709, 692, 693, 710, 709, 709, 722, 721, 710, 722, 709, 721, 736, 735, 721, 735, 720, 722, 736, 721, 720, 735, 734, 679, 694, 710, 679, 710, 693, 666, 679, 693, 667, 680, 679, 667, 679, 666, 680, 694, 679, 680, 695, 694, 668, 681, 680, 668, 680, 667, 681, 695, 680, 651, 668, 667, 652, 669, 668, 652, 668, 651, 669, 681, 668, 669, 682, 681, 681, 696, 695, 682, 696, 681, 653, 670, 669, 653, 669, 652, 670, 682, 669, 635, 652, 651, 636, 653, 652, 636, 652, 635, 655, 654, 653, 655, 653, 636, 654, 670, 653, 654, 671, 670, 670, 683, 682, 671, 683, 670, 639, 657, 654, 639, 654, 656, 657, 671, 654, 657, 672, 671, 671, 684, 683, 672, 685, 671, 672, 686, 685, 686, 702, 699, 686, 699, 701, 702, 717, 716, 702, 716, 699, 700, 699, 698, 699, 716, 715, 699, 715, 698, 716, 729, 728, 716, 728, 715, 717, 730, 716, 717, 731, 730, 698, 715, 714, 715, 728, 727, 715, 727, 714, 697, 714, 713, 698, 714, 697, 714, 727, 726, 714, 726, 713, 727, 742, 726, 713, 726, 725, 726, 742, 741, 726, 741, 725, 697, 713, 696, 682, 697, 696, 683, 698, 697, 683, 697, 682, 700, 698, 683, 622, 639, 638, 606, 622, 621, 622, 638, 621, 590, 606, 605, 606, 621, 605, 605, 621, 620, 621, 637, 636, 621, 636, 620, 620, 636, 635, 430, 447, 446, 408, 430, 429, 430, 446, 429, 409, 408, 406, 408, 429, 406, 406, 429, 428, 407, 406, 404, 409, 406, 407, 406, 428, 404, 407, 404, 405, 405, 404, 402, 405, 402, 403, 403, 402, 400, 403, 400, 401, 401, 400, 397, 400, 425, 397, 401, 397, 399, 398, 397, 396, 397, 424, 423, 397, 423, 396, 398, 396, 395, 395, 396, 420, 396, 423, 437, 396, 437, 420, 423, 454, 456, 455, 454, 453, 454, 472, 453, 455, 453, 435, 435, 453, 452, 453, 472, 471, 453, 471, 452, 472, 485, 484, 472, 484, 471, 452, 471, 470, 471, 484, 483, 471, 483, 470, 434, 452, 451, 435, 452, 434, 452, 470, 451, 451, 470, 467, 470, 483, 482, 470, 482, 467, 483, 498, 497, 483, 497, 482, 484, 498, 483, 467, 482, 481, 482, 496, 495, 482, 495, 481, 467, 481, 466, 468, 467, 466, 451, 467, 469, 468, 466, 448, 432, 449, 448, 432, 448, 431, 412, 432, 431, 414, 433, 432, 414, 432, 412, 433, 450, 432, 412, 431, 411, 413, 412, 411, 415, 414, 412, 415, 412, 413, 417, 416, 414, 417, 414, 415, 416, 433, 414, 419, 416, 417, 419, 418, 416, 416, 434, 433, 418, 434, 416, 421, 418, 419, 421, 420, 418, 418, 435, 434, 420, 435, 418, 434, 451, 433, 433, 451, 450, 420, 436, 435, 395, 420, 422, 413, 411, 410, 513, 511, 495, 513, 512, 511, 512, 526, 511, 498, 515, 512, 498, 512, 514, 512, 527, 526, 515, 527, 512, 527, 540, 526, 515, 528, 527, 527, 541, 540, 528, 542, 527, 559, 557, 540, 559, 558, 557, 558, 575, 557, 543, 558, 560, 558, 576, 575, 576, 591, 575, 528, 543, 542, 516, 528, 515, 499, 516, 515, 499, 515, 498, 484, 499, 498, 485, 499, 484, 14, 13, 11, 13, 35, 34, 13, 34, 11, 35, 52, 51, 35, 51, 34, 34, 50, 49, 68, 66, 49, 68, 67, 66, 66, 83, 82, 67, 83, 66, 52, 70, 67, 52, 67, 69, 67, 84, 83, 70, 84, 67, 83, 96, 95, 83, 95, 82, 84, 96, 83, 70, 85, 84, 84, 97, 96, 85, 98, 84, 96, 111, 110, 96, 110, 95, 113, 111, 96, 95, 110, 109, 110, 127, 126, 110, 126, 109, 111, 127, 110, 113, 112, 111, 111, 128, 127, 112, 128, 111, 127, 140, 139, 127, 139, 126, 128, 140, 127, 126, 139, 138, 139, 155, 154, 139, 154, 138, 140, 155, 139, 128, 141, 140, 140, 156, 155, 141, 156, 140, 112, 129, 128, 129, 141, 128, 129, 142, 141, 141, 157, 156, 159, 157, 141, 156, 176, 175, 156, 175, 155, 157, 176, 156, 159, 158, 157, 157, 177, 176, 158, 177, 157, 176, 192, 191, 176, 191, 175, 177, 192, 176, 155, 175, 172, 175, 191, 190, 175, 190, 172, 191, 207, 204, 191, 204, 206, 192, 207, 191, 192, 208, 207, 207, 223, 222, 207, 222, 204, 208, 223, 207, 193, 209, 208, 193, 208, 192, 208, 224, 223, 209, 224, 208, 223, 239, 236, 223, 236, 238, 224, 239, 223, 209, 225, 224, 224, 240, 239, 225, 240, 224, 239, 256, 255, 239, 255, 236, 240, 256, 239, 237, 236, 235, 236, 255, 254, 236, 254, 235, 255, 272, 271, 255, 271, 254, 256, 272, 255, 235, 254, 270, 225, 241, 240, 226, 242, 241, 226, 241, 225, 210, 226, 225, 211, 227, 226, 211, 226, 210, 227, 243, 226, 210, 225, 209, 194, 210, 209, 195, 211, 210, 195, 210, 194, 194, 209, 193, 178, 194, 193, 179, 195, 194, 179, 194, 178, 177, 193, 192, 178, 193, 177, 158, 178, 177, 161, 179, 178, 161, 178, 158, 144, 161, 158, 144, 158, 160, 130, 144, 143, 115, 130, 129, 130, 143, 129, 99, 115, 112, 115, 129, 112, 85, 99, 98, 99, 112, 114, 227, 244, 243, 155, 172, 174, 280, 295, 294, 313, 325, 312, 313, 326, 325, 325, 340, 339, 326, 340, 325, 277, 291, 290, 322, 336, 335, 336, 353, 350, 336, 350, 352, 353, 371, 370, 353, 370, 350, 350, 370, 369, 370, 386, 385, 370, 385, 369, 371, 386, 370, 371, 387, 386, 369, 385, 384, 265, 263, 245, 229, 246, 245, 229, 245, 228, 213, 229, 228, 230, 247, 229, 213, 228, 212
-};
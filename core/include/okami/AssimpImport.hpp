@@ -0,0 +1,42 @@
+#pragma once
+
+#include <okami/Geometry.hpp>
+#include <okami/VirtualFileSystem.hpp>
+
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <filesystem>
+#include <memory>
+
+namespace okami::core {
+
+    // Post processing every model file is imported with
+    constexpr unsigned int ASSIMP_IMPORT_FLAGS = aiProcess_Triangulate | 
+        aiProcess_GenSmoothNormals | aiProcess_FlipUVs | 
+        aiProcess_JoinIdenticalVertices | aiProcess_GenUVCoords | 
+        aiProcess_CalcTangentSpace | aiProcess_ConvertToLeftHanded | 
+        aiProcessPreset_TargetRealtime_Quality;
+
+    // Whether ToRawData can pack a mesh. Lines and points are split
+    // into meshes of their own by the import flags.
+    inline bool IsTriangleMesh(const aiMesh* mesh) {
+        return mesh->mPrimitiveTypes == aiPrimitiveType_TRIANGLE &&
+            mesh->mNumFaces > 0;
+    }
+
+    // Imports a model file whose contents were already read. Files it
+    // references, like .mtl libraries, are read through fileSystem.
+    // Throws if the file can't be imported.
+    std::unique_ptr<aiScene> ReadAssimpScene(const std::filesystem::path& path,
+        const ByteView& bytes,
+        VirtualFileSystem& fileSystem = VirtualFileSystem::Default());
+
+    // Packs one mesh of an imported scene straight into layout, in a
+    // single pass per attribute. Throws if it isn't a triangle mesh. The
+    // source arrays take several times the space of the result, so free
+    // the mesh before running OptimizeMesh on it.
+    Geometry::RawData ToRawData(const aiMesh* mesh,
+        const VertexFormat& layout);
+}
@@ -1,60 +1,173 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <queue>
+#include <vector>
+#include <functional>
+#include <type_traits>
+#include <stdexcept>
 
 #include <marl/event.h>
+#include <marl/mutex.h>
+#include <marl/scheduler.h>
 #include <okami/Resource.hpp>
 #include <okami/PlatformDefs.hpp>
 
 namespace okami::core {
+    template <typename T>
+    class Promise;
+
+    template <typename T>
+    class Future;
+
+    // Shared state between a Promise and its Futures. States are
+    // recycled through PromiseStatePool<T>, so creating a promise does
+    // not touch the heap once the pool has warmed up.
     template <typename T>
     struct PromiseUnderlying {
-        marl::Event mEvent;
+        std::atomic<uint32_t> mRefCount = 0;
+        marl::Event mEvent = marl::Event(marl::Event::Mode::Manual);
+        marl::mutex mMutex;
+        std::atomic<bool> bReady = false;
         T mData;
+        std::vector<std::function<void(const T&)>> mContinuations;
     };
-    
+
     template <typename T>
-    class Future;
+    class PromiseStatePool {
+    private:
+        static constexpr size_t BlockSize = 64;
+
+        marl::mutex mMutex;
+        std::vector<std::unique_ptr<PromiseUnderlying<T>[]>> mBlocks;
+        std::vector<PromiseUnderlying<T>*> mFree;
+
+    public:
+        static PromiseStatePool<T>& Instance() {
+            static PromiseStatePool<T> pool;
+            return pool;
+        }
+
+        PromiseUnderlying<T>* Acquire() {
+            marl::lock lock(mMutex);
+
+            if (mFree.empty()) {
+                mBlocks.emplace_back(
+                    std::make_unique<PromiseUnderlying<T>[]>(BlockSize));
+                auto block = mBlocks.back().get();
+                for (size_t i = BlockSize; i > 0; --i) {
+                    mFree.emplace_back(&block[i - 1]);
+                }
+            }
+
+            auto state = mFree.back();
+            mFree.pop_back();
+            state->mRefCount = 1;
+            return state;
+        }
+
+        void Release(PromiseUnderlying<T>* state) {
+            if (state->mRefCount.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+
+            // Reset while nobody else can see the state anymore
+            state->mData = T();
+            state->mContinuations.clear();
+            state->mEvent.clear();
+            state->bReady = false;
+
+            marl::lock lock(mMutex);
+            mFree.emplace_back(state);
+        }
+    };
 
     template <typename T>
     class Promise {
     private:
-        std::shared_ptr<PromiseUnderlying<T>> mPtr;
+        PromiseUnderlying<T>* mPtr;
+
+        template <typename U>
+        inline void SetImpl(U&& obj) {
+            std::vector<std::function<void(const T&)>> continuations;
+            {
+                marl::lock lock(mPtr->mMutex);
+                if (mPtr->bReady) {
+                    throw std::runtime_error("Promise has already been set!");
+                }
+                mPtr->mData = std::forward<U>(obj);
+                mPtr->bReady = true;
+                std::swap(continuations, mPtr->mContinuations);
+            }
+
+            mPtr->mEvent.signal();
+
+            for (auto& continuation : continuations) {
+                continuation(mPtr->mData);
+            }
+
+            // Hand the storage back so the pooled state keeps its capacity
+            continuations.clear();
+            marl::lock lock(mPtr->mMutex);
+            if (mPtr->mContinuations.empty()) {
+                std::swap(continuations, mPtr->mContinuations);
+            }
+        }
 
     public:
-        inline Promise() : mPtr(std::make_shared<PromiseUnderlying<T>>()) {
+        inline Promise() : 
+            mPtr(PromiseStatePool<T>::Instance().Acquire()) {
         }
 
         inline Promise(T&& t) : Promise() {
             Set(std::move(t));       
         }
 
+        inline Promise(const Promise<T>& other) : mPtr(other.mPtr) {
+            ++mPtr->mRefCount;
+        }
+
+        inline Promise<T>& operator=(const Promise<T>& other) {
+            if (mPtr != other.mPtr) {
+                ++other.mPtr->mRefCount;
+                PromiseStatePool<T>::Instance().Release(mPtr);
+                mPtr = other.mPtr;
+            }
+            return *this;
+        }
+
+        inline ~Promise() {
+            PromiseStatePool<T>::Instance().Release(mPtr);
+        }
+
         inline const T& Get() const {
             mPtr->mEvent.wait();
             return mPtr->mData;
         }
 
         inline void Set(T&& obj) {
-            mPtr->mData = std::move(obj);
-            mPtr->mEvent.signal();
+            SetImpl(std::move(obj));
         }
 
         inline void Set(const T& obj) {
-            mPtr->mData = obj;
-            mPtr->mEvent.signal();
+            SetImpl(obj);
         }
 
         friend class Future<T>;
     };
     
-    template <typename T>
-    class WeakFuture;
-    
     template <typename T>
     class Future {
     private:
-        std::shared_ptr<PromiseUnderlying<T>> mPtr;
+        PromiseUnderlying<T>* mPtr = nullptr;
+
+        inline void Reset() {
+            if (mPtr) {
+                PromiseStatePool<T>::Instance().Release(mPtr);
+                mPtr = nullptr;
+            }
+        }
 
     public:
         inline Future() {
@@ -62,18 +175,168 @@ namespace okami::core {
 
         inline Future(const Promise<T>& promise) : 
             mPtr(promise.mPtr) {
+            ++mPtr->mRefCount;
+        }
+
+        inline Future(const Future<T>& other) : mPtr(other.mPtr) {
+            if (mPtr) {
+                ++mPtr->mRefCount;
+            }
+        }
+
+        inline Future(Future<T>&& other) : mPtr(other.mPtr) {
+            other.mPtr = nullptr;
+        }
+
+        inline Future<T>& operator=(const Future<T>& other) {
+            if (mPtr != other.mPtr) {
+                if (other.mPtr) {
+                    ++other.mPtr->mRefCount;
+                }
+                Reset();
+                mPtr = other.mPtr;
+            }
+            return *this;
+        }
+
+        inline Future<T>& operator=(Future<T>&& other) {
+            if (this != &other) {
+                Reset();
+                mPtr = other.mPtr;
+                other.mPtr = nullptr;
+            }
+            return *this;
         }
 
+        inline ~Future() {
+            Reset();
+        }
+
+        // Blocks the calling fiber until the value is available.
         inline const T& Get() const {
             mPtr->mEvent.wait();
             return mPtr->mData;
         }
 
+        // Returns nullptr if the value has not been set yet.
+        inline const T* TryGet() const {
+            if (mPtr && mPtr->bReady) {
+                return &mPtr->mData;
+            } else {
+                return nullptr;
+            }
+        }
+
+        inline bool IsReady() const {
+            return mPtr && mPtr->bReady;
+        }
+
         inline operator bool() const {
-            return mPtr.get() != nullptr;
+            return mPtr != nullptr;
+        }
+
+        // Runs func inline on whichever thread sets the value, or right
+        // away if it is already set. Keep func short, prefer Then().
+        void OnReady(std::function<void(const T&)> func) const {
+            {
+                marl::lock lock(mPtr->mMutex);
+                if (!mPtr->bReady) {
+                    mPtr->mContinuations.emplace_back(std::move(func));
+                    return;
+                }
+            }
+            func(mPtr->mData);
+        }
+
+        // Schedules func on marl once the value is set and returns a
+        // future for its result. Nothing waits in between.
+        template <typename FuncT,
+            typename U = std::decay_t<std::invoke_result_t<FuncT, const T&>>,
+            std::enable_if_t<!std::is_void_v<U>, int> = 0>
+        Future<U> Then(FuncT&& func) const {
+            Promise<U> promise;
+
+            OnReady([promise, func = std::forward<FuncT>(func)](const T& value) {
+                marl::schedule([promise, func, value]() mutable {
+                    promise.Set(func(value));
+                });
+            });
+
+            return Future<U>(promise);
+        }
+
+        // There is no Promise<void>, so a function without a result has
+        // nothing to hand on. Caught here so the error says why.
+        template <typename FuncT,
+            typename U = std::invoke_result_t<FuncT, const T&>,
+            std::enable_if_t<std::is_void_v<U>, int> = 0>
+        void Then(FuncT&&) const {
+            static_assert(!std::is_void_v<U>, "Future::Then needs a function "
+                "that returns a value, use OnReady to run one that doesn't!");
         }
     };
 
+    // Completes once every future has a value. Results keep the input order.
+    template <typename T>
+    Future<std::vector<T>> WhenAll(const std::vector<Future<T>>& futures) {
+        Promise<std::vector<T>> promise;
+
+        if (futures.empty()) {
+            promise.Set(std::vector<T>());
+            return Future<std::vector<T>>(promise);
+        }
+
+        struct Shared {
+            marl::mutex mMutex;
+            size_t mRemaining;
+            std::vector<T> mResults;
+            Promise<std::vector<T>> mPromise;
+        };
+
+        // Only the continuations hold on to this, so abandoning the
+        // inputs releases it along with them.
+        auto shared = std::make_shared<Shared>();
+        shared->mRemaining = futures.size();
+        shared->mResults.resize(futures.size());
+        shared->mPromise = promise;
+
+        for (size_t i = 0; i < futures.size(); ++i) {
+            futures[i].OnReady([shared, i](const T& value) {
+                {
+                    marl::lock lock(shared->mMutex);
+                    shared->mResults[i] = value;
+                    if (--shared->mRemaining != 0) {
+                        return;
+                    }
+                }
+                shared->mPromise.Set(std::move(shared->mResults));
+            });
+        }
+
+        return Future<std::vector<T>>(promise);
+    }
+
+    // Completes with the index and value of the first future to finish.
+    template <typename T>
+    Future<std::pair<size_t, T>> WhenAny(const std::vector<Future<T>>& futures) {
+        if (futures.empty()) {
+            throw std::runtime_error("WhenAny needs at least one future!");
+        }
+
+        Promise<std::pair<size_t, T>> promise;
+        auto bDone = std::make_shared<std::atomic<bool>>(false);
+
+        for (size_t i = 0; i < futures.size(); ++i) {
+            futures[i].OnReady([bDone, promise, i](const T& value) mutable {
+                if (!bDone->exchange(true)) {
+                    promise.Set(std::make_pair(i, value));
+                }
+            });
+        }
+
+        return Future<std::pair<size_t, T>>(promise);
+    }
+
     template <typename T>
     class MessagePipe {
     private:
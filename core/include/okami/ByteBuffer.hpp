@@ -0,0 +1,190 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+
+#include <marl/mutex.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace okami::core {
+
+    // Wide enough for any SIMD load and a whole cache line
+    constexpr size_t BYTE_BUFFER_ALIGNMENT = 64;
+
+    struct ByteBufferPoolStats {
+        // Allocations that had to go to the system allocator
+        uint64_t mSystemAllocations = 0;
+        // Allocations served from memory released earlier
+        uint64_t mPooledAllocations = 0;
+        // Memory sitting in the pool, waiting to be reused
+        uint64_t mCachedBytes = 0;
+    };
+
+    // Keeps freed asset buffers around by size class, so that loading the
+    // same level again reuses the memory of the last time instead of
+    // going back to the system allocator. Thread safe.
+    class ByteBufferPool {
+    private:
+        mutable marl::mutex mMutex;
+        std::unordered_map<size_t, std::vector<uint8_t*>> mFree;
+        uint64_t mMaxCachedBytes;
+        ByteBufferPoolStats mStats;
+
+    public:
+        ByteBufferPool(uint64_t maxCachedBytes = 256u * 1024u * 1024u);
+        ~ByteBufferPool();
+
+        ByteBufferPool(const ByteBufferPool&) = delete;
+        ByteBufferPool& operator=(const ByteBufferPool&) = delete;
+
+        // Capacity actually allocated for size bytes. There are four
+        // classes per power of two, so at most a quarter is wasted.
+        static size_t GetSizeClass(size_t size);
+
+        // Returns uninitialized memory for at least size bytes, its real
+        // capacity is written to capacity.
+        uint8_t* Acquire(size_t size, size_t& capacity);
+        // Memory beyond the cache limit goes back to the system
+        void Release(uint8_t* ptr, size_t capacity);
+
+        // Frees everything cached
+        void Trim();
+        void SetMaxCachedBytes(uint64_t bytes);
+        ByteBufferPoolStats GetStats() const;
+
+        // Used by buffers unless told otherwise. Never destroyed, so
+        // buffers in static objects can still return their memory.
+        static ByteBufferPool& Default();
+    };
+
+    // Storage for texture and geometry data. Unlike std::vector<uint8_t>
+    // it does not zero memory that is about to be overwritten by a
+    // decoder, is aligned to BYTE_BUFFER_ALIGNMENT and recycles its
+    // memory through a ByteBufferPool. The interface mirrors the parts of
+    // std::vector that asset code uses.
+    class ByteBuffer {
+    private:
+        uint8_t* mData = nullptr;
+        size_t mSize = 0;
+        size_t mCapacity = 0;
+        ByteBufferPool* mPool = nullptr;
+
+        void Free();
+
+    public:
+        ByteBuffer() = default;
+        // Contents are uninitialized
+        explicit ByteBuffer(size_t size,
+            ByteBufferPool* pool = &ByteBufferPool::Default());
+        ByteBuffer(const uint8_t* data, size_t size,
+            ByteBufferPool* pool = &ByteBufferPool::Default());
+
+        ByteBuffer(const ByteBuffer& other);
+        ByteBuffer& operator=(const ByteBuffer& other);
+        ByteBuffer(ByteBuffer&& other) noexcept;
+        ByteBuffer& operator=(ByteBuffer&& other) noexcept;
+
+        inline ~ByteBuffer() {
+            Free();
+        }
+
+        inline uint8_t* data() {
+            return mData;
+        }
+        inline const uint8_t* data() const {
+            return mData;
+        }
+        inline size_t size() const {
+            return mSize;
+        }
+        inline size_t capacity() const {
+            return mCapacity;
+        }
+        inline bool empty() const {
+            return mSize == 0;
+        }
+
+        inline uint8_t* begin() {
+            return mData;
+        }
+        inline uint8_t* end() {
+            return mData + mSize;
+        }
+        inline const uint8_t* begin() const {
+            return mData;
+        }
+        inline const uint8_t* end() const {
+            return mData + mSize;
+        }
+
+        inline uint8_t& operator[](size_t i) {
+            return mData[i];
+        }
+        inline const uint8_t& operator[](size_t i) const {
+            return mData[i];
+        }
+
+        // Keeps the existing contents, added bytes are uninitialized
+        void resize(size_t size);
+        // Unlike std::vector, this gives the memory back to the pool
+        void clear();
+
+        bool operator==(const ByteBuffer& other) const;
+        inline bool operator!=(const ByteBuffer& other) const {
+            return !(*this == other);
+        }
+    };
+
+    // A read-only window into bytes owned by someone else. Views of file
+    // reads share ownership of their buffer, so they can be passed
+    // around and sliced without copying. Views of vectors, buffers and
+    // embedded data don't own anything and must not outlive them.
+    class ByteView {
+    private:
+        const uint8_t* mData = nullptr;
+        size_t mSize = 0;
+        std::shared_ptr<const void> mOwner;
+
+    public:
+        ByteView() = default;
+        inline ByteView(const uint8_t* data, size_t size,
+            std::shared_ptr<const void> owner = nullptr) :
+            mData(data), mSize(size), mOwner(std::move(owner)) {
+        }
+        inline ByteView(const std::vector<uint8_t>& bytes) :
+            mData(bytes.data()), mSize(bytes.size()) {
+        }
+        inline ByteView(const ByteBuffer& bytes) :
+            mData(bytes.data()), mSize(bytes.size()) {
+        }
+
+        // Takes ownership of the buffer
+        static ByteView From(ByteBuffer&& bytes);
+
+        inline const uint8_t* data() const {
+            return mData;
+        }
+        inline size_t size() const {
+            return mSize;
+        }
+        inline bool empty() const {
+            return mSize == 0;
+        }
+        inline const uint8_t* begin() const {
+            return mData;
+        }
+        inline const uint8_t* end() const {
+            return mData + mSize;
+        }
+        inline const uint8_t& operator[](size_t i) const {
+            return mData[i];
+        }
+
+        // Shares ownership with this view. Clamped to the view's size.
+        ByteView Slice(size_t offset, size_t size = SIZE_MAX) const;
+    };
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace okami::core {
+
+    // Worst case size of an LZ4 block for size bytes of input
+    size_t LZ4CompressBound(size_t size);
+
+    // Compresses into the LZ4 block format, so data can be inspected
+    // with the reference tools. Returns the compressed size, or 0 if
+    // the result would not fit into dstCapacity bytes.
+    size_t LZ4Compress(const uint8_t* src, size_t srcSize,
+        uint8_t* dst, size_t dstCapacity);
+
+    // Returns false if the block is malformed or does not decompress to
+    // exactly dstSize bytes. Never reads or writes out of bounds.
+    bool LZ4Decompress(const uint8_t* src, size_t srcSize,
+        uint8_t* dst, size_t dstSize);
+
+    struct ChunkedPayloadParams {
+        // Chunks are compressed independently, so they can be
+        // decompressed in parallel. Offsets are 16 bit, so chunks much
+        // smaller than 64KB lose ratio.
+        uint32_t mChunkSize = 256u * 1024u;
+        // Off stores the chunks as they are, which gives the
+        // uncompressed load path the same layout.
+        bool bCompress = true;
+    };
+
+    // Appends size bytes of data to out as a chunked payload. Chunks
+    // that don't shrink are stored uncompressed. Compression runs in
+    // parallel if called from a marl task.
+    void WriteChunkedPayload(std::vector<uint8_t>& out,
+        const uint8_t* data, size_t size,
+        const ChunkedPayloadParams& params = ChunkedPayloadParams());
+
+    // Appends a length prefixed block, used for the headers of files
+    // that carry chunked payloads.
+    void WriteBlock(std::vector<uint8_t>& out, const std::string& block);
+
+    // Decodes chunked payloads straight into their destination buffers.
+    // Payloads are queued first so that the chunks of all of them are
+    // spread over the marl workers together.
+    class ChunkedPayloadReader {
+    private:
+        struct Chunk {
+            const uint8_t* mSrc;
+            uint8_t* mDst;
+            uint32_t mSrcSize;
+            uint32_t mDstSize;
+            bool bStored;
+        };
+
+        const uint8_t* mBegin;
+        const uint8_t* mEnd;
+        const uint8_t* mCursor;
+        std::vector<Chunk> mChunks;
+
+    public:
+        inline ChunkedPayloadReader(const uint8_t* data, size_t size) :
+            mBegin(data), mEnd(data + size), mCursor(data) {
+        }
+
+        // Uncompressed size of the payload at the cursor
+        uint64_t PeekSize() const;
+
+        // Queues the payload at the cursor to be decoded into dst, which
+        // must hold exactly PeekSize() bytes, and moves past it.
+        void Read(uint8_t* dst, size_t dstSize);
+
+        // Reads a block written by WriteBlock and moves past it
+        std::string ReadBlock();
+
+        // Skips over bytes that are not part of a payload
+        void Skip(size_t size);
+
+        inline const uint8_t* GetCursor() const {
+            return mCursor;
+        }
+
+        // Decodes everything queued. Runs in parallel if called from a
+        // marl task. Throws if any chunk is corrupt.
+        void Flush();
+    };
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+
+#include <cstdint>
+#include <ostream>
+
+namespace okami::core {
+
+    constexpr uint32_t EMBEDDED_MESH_MAGIC = 0x48534D4F; // "OMSH"
+    constexpr uint32_t EMBEDDED_MESH_VERSION = 1;
+
+    struct EmbeddedMeshHeader {
+        uint32_t mMagic = EMBEDDED_MESH_MAGIC;
+        uint32_t mVersion = EMBEDDED_MESH_VERSION;
+        uint32_t mVertexCount = 0;
+        uint32_t mIndexCount = 0;
+    };
+
+    // The blobs mesh2cpp writes for Geometry::Prefabs. The header is
+    // followed by little endian arrays of positions, UVs, normals,
+    // tangents and bitangents for every vertex, then the indices. All of
+    // them are 4 byte values, so a blob that is 4 byte aligned can be
+    // read in place.
+    struct EmbeddedMesh {
+        EmbeddedMeshHeader mHeader;
+        const float* mPositions = nullptr;
+        const float* mUVs = nullptr;
+        const float* mNormals = nullptr;
+        const float* mTangents = nullptr;
+        const float* mBitangents = nullptr;
+        const uint32_t* mIndices = nullptr;
+
+        // Points into the blob without copying it, throws if it is
+        // malformed or misaligned
+        static EmbeddedMesh From(const uint8_t* begin, const uint8_t* end);
+
+        void Write(std::ostream& out) const;
+    };
+}
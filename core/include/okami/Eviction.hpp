@@ -0,0 +1,90 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+#include <okami/Resource.hpp>
+#include <okami/Pool.hpp>
+
+#include <marl/mutex.h>
+
+#include <vector>
+
+namespace okami::core {
+
+    // Implemented by whatever owns the GPU copies of resources. Tests
+    // implement it with fake memory.
+    class IEvictionBackend {
+    public:
+        // Release the GPU copy. The resource itself stays alive.
+        virtual void Evict(resource_id_t id) = 0;
+        // Bring an evicted resource back. This may take a few frames,
+        // call EvictionManager::Add once it is resident again.
+        virtual void Reload(resource_id_t id) = 0;
+    };
+
+    struct EvictionParams {
+        uint64_t mBudget = 1024u * 1024u * 1024u;
+        // Resources used this recently are never evicted, so whatever
+        // is on screen right now stays resident even when over budget.
+        uint32_t mMinIdleFrames = 2;
+        uint32_t mMaxEvictionsPerUpdate = 64;
+    };
+
+    // Keeps GPU memory under a budget. Renderers touch every resource
+    // they draw with, and once the budget is exceeded the least recently
+    // used unpinned resources are evicted. Touching an evicted resource
+    // reloads it on the next update.
+    class EvictionManager {
+    private:
+        struct Entry {
+            IEvictionBackend* mBackend = nullptr;
+            uint64_t mBytes = 0;
+            uint64_t mLastUse = 0;
+            bool bPinned = false;
+            bool bResident = true;
+            bool bReloadRequested = false;
+        };
+
+        EvictionParams mParams;
+
+        mutable marl::mutex mMutex;
+        Pool<resource_id_t, Entry> mEntries;
+        std::vector<resource_id_t> mPendingReloads;
+        uint64_t mResidentBytes = 0;
+        uint64_t mFrame = 0;
+        uint64_t mEvictionCount = 0;
+        uint64_t mReloadCount = 0;
+
+    public:
+        inline EvictionManager(
+            const EvictionParams& params = EvictionParams()) :
+            mParams(params) {
+        }
+
+        // Starts tracking a resident resource. Also called once an
+        // evicted resource has been reloaded.
+        void Add(resource_id_t id, IEvictionBackend* backend, uint64_t bytes);
+        // For resources whose GPU copy changes size in place, e.g. when
+        // streamed mips come and go. Does not count as a use.
+        void Resize(resource_id_t id, uint64_t bytes);
+        void Remove(resource_id_t id);
+        bool Contains(resource_id_t id) const;
+
+        // Pinned resources are never evicted
+        void SetPinned(resource_id_t id, bool pinned);
+
+        // Marks a resource as used this frame. Can be called from render
+        // threads.
+        void Touch(resource_id_t id);
+
+        // Issues pending reloads and evictions through the backends.
+        // Main thread, once per frame.
+        void Update();
+
+        void SetBudget(uint64_t bytes);
+        uint64_t GetBudget() const;
+        uint64_t GetResidentBytes() const;
+        bool IsResident(resource_id_t id) const;
+        uint64_t GetEvictionCount() const;
+        uint64_t GetReloadCount() const;
+    };
+}
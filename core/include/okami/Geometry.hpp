@@ -3,6 +3,12 @@
 #include <okami/PlatformDefs.hpp>
 #include <okami/BoundingBox.hpp>
 #include <okami/VertexFormat.hpp>
+#include <okami/Compression.hpp>
+#include <okami/ByteBuffer.hpp>
+#include <okami/VertexKernels.hpp>
+#include <okami/VertexEncoding.hpp>
+#include <okami/Meshlets.hpp>
+#include <okami/MeshSimplifier.hpp>
 #include <okami/Resource.hpp>
 #include <okami/ResourceManager.hpp>
 #include <okami/System.hpp>
@@ -17,9 +23,39 @@
 namespace okami::core {
 	class Geometry;
 
+    // Passes OptimizeMesh runs over packed geometry, see MeshOptimizer.hpp
+    struct MeshOptimizeParams {
+        // Merges vertices whose packed bytes are identical in every
+        // vertex buffer
+        bool bRemoveDuplicateVertices = true;
+        bool bOptimizeVertexCache = true;
+        bool bOptimizeVertexFetch = true;
+        // Uses UINT16 indices when there are few enough vertices
+        bool bAllow16BitIndices = true;
+        // Splits the mesh into meshlets for cluster culling, and keeps
+        // the cache order within each of them
+        bool bBuildMeshlets = true;
+        MeshletParams mMeshletParams;
+        // Appends a chain of simplified levels to the index buffer
+        bool bBuildLodChain = false;
+        LodChainParams mLodChainParams;
+
+        // What imported meshes get unless told otherwise. Importers emit
+        // triangles in authoring order and don't come with levels of
+        // detail, so every pass runs.
+        static MeshOptimizeParams Import() {
+            MeshOptimizeParams params;
+            params.bBuildLodChain = true;
+            return params;
+        }
+    };
+
 	template <>
 	struct LoadParams<Geometry> {
 		entt::meta_type mComponentType;
+		// Only applies to meshes that go through the importer, cooked
+		// .okgeo files were optimized when they were written
+		MeshOptimizeParams mOptimizeParams = MeshOptimizeParams::Import();
 	};
 
     struct BufferDesc {
@@ -28,18 +64,29 @@ namespace okami::core {
 
     struct BufferData {
         BufferDesc mDesc;
-        std::vector<uint8_t> mBytes;
+        ByteBuffer mBytes;
     };
 
     class Geometry final : public Resource {
 	public:
 		struct Attribs {
 			uint32_t mNumVertices = 0;
+
+			template <typename Archive>
+			void serialize(Archive& arr) {
+				arr(mNumVertices);
+			}
 		};
 
 		struct IndexedAttribs {
 			ValueType mIndexType = ValueType::UNDEFINED;
 			uint32_t mNumIndices = 0;
+
+			template <typename Archive>
+			void serialize(Archive& arr) {
+				arr(mIndexType);
+				arr(mNumIndices);
+			}
 		};
 		
 		struct Desc {
@@ -47,6 +94,14 @@ namespace okami::core {
 			Attribs mAttribs;
 			IndexedAttribs mIndexedAttribs;
 			bool bIsIndexed;
+
+			template <typename Archive>
+			void serialize(Archive& arr) {
+				arr(mLayout);
+				arr(mAttribs);
+				arr(mIndexedAttribs);
+				arr(bIsIndexed);
+			}
 		};
 
 		template <typename IndexType = uint32_t,
@@ -218,6 +273,13 @@ namespace okami::core {
 			std::vector<BufferData> mVertexBuffers;
 			BufferData mIndexBuffer;
 			BoundingBox mBoundingBox;
+			// Clusters of the index buffer for culling, see OptimizeMesh.
+			// Empty if the geometry wasn't split.
+			std::vector<Meshlet> mMeshlets;
+			// Coarser levels of detail, finest first. Their indices follow
+			// the mIndexedAttribs.mNumIndices of the full detail mesh in
+			// mIndexBuffer and use the same vertices.
+			std::vector<MeshLod> mLods;
 
 			template <typename I3T, typename V2T, typename V3T, typename V4T>
 			void Pack(const VertexFormat& layout,
@@ -227,7 +289,26 @@ namespace okami::core {
 				Data<I3T, V2T, V3T, V4T> Unpack() const;
 
 			static RawData Load(const std::filesystem::path& path,
-				const VertexFormat& layout);
+				const VertexFormat& layout,
+				const MeshOptimizeParams& optimizeParams =
+					MeshOptimizeParams::Import());
+			// Decodes file contents that were already read. Other files
+			// the format references are read through
+			// VirtualFileSystem::Default().
+			static RawData Load(const std::filesystem::path& path,
+				const ByteView& bytes,
+				const VertexFormat& layout,
+				const MeshOptimizeParams& optimizeParams =
+					MeshOptimizeParams::Import());
+
+			// Writes the packed buffers in the engine's own format
+			// (.okgeo). Loading one skips the importer entirely, the
+			// buffers are decompressed straight into place. The layout
+			// it is loaded with has to match the one it was packed with.
+			void Save(std::vector<uint8_t>& out,
+				const ChunkedPayloadParams& params = ChunkedPayloadParams()) const;
+			void Save(const std::filesystem::path& path,
+				const ChunkedPayloadParams& params = ChunkedPayloadParams()) const;
 
 			inline void Dealloc() {
 				mVertexBuffers.clear();
@@ -325,6 +406,8 @@ namespace okami::core {
 			return mData.mBoundingBox;
 		}
 
+		// Bounds relative positions are decoded with this box, changing
+		// it moves them.
 		inline void SetBoundingBox(const BoundingBox& box) { 
 			mData.mBoundingBox = box;
 		}
@@ -332,8 +415,12 @@ namespace okami::core {
 		entt::meta_type GetType() const override;
 		bool HasLoadParams() const override;
 		std::filesystem::path GetPath() const override;
+		size_t GetCPUByteSize() const override;
+		std::string EncodeLoadParams() const override;
 		const LoadParams<Geometry>& GetLoadParams() const;
 
+		static LoadParams<Geometry> DecodeLoadParams(const std::string& str);
+
 		static void Register();
 
 		struct Prefabs {
@@ -345,12 +432,49 @@ namespace okami::core {
 			static Geometry Plane(const VertexFormat& layout);
 			static Geometry StanfordBunny(const VertexFormat& layout);
 			static Geometry UtahTeapot(const VertexFormat& layout);
+
+			// One resource per prefab and vertex format, shared by
+			// everyone who asks the same manager for it, see
+			// ResourceManager::GetOrAdd. Prefer these for anything that
+			// is spawned more than once.
+			static Handle<Geometry> MaterialBall(ResourceManager& resources,
+				const VertexFormat& layout);
+			static Handle<Geometry> Box(ResourceManager& resources,
+				const VertexFormat& layout);
+			static Handle<Geometry> Sphere(ResourceManager& resources,
+				const VertexFormat& layout);
+			static Handle<Geometry> BlenderMonkey(ResourceManager& resources,
+				const VertexFormat& layout);
+			static Handle<Geometry> Torus(ResourceManager& resources,
+				const VertexFormat& layout);
+			static Handle<Geometry> Plane(ResourceManager& resources,
+				const VertexFormat& layout);
+			static Handle<Geometry> StanfordBunny(ResourceManager& resources,
+				const VertexFormat& layout);
+			static Handle<Geometry> UtahTeapot(ResourceManager& resources,
+				const VertexFormat& layout);
+
+			// Each prefab is packed once per vertex format and kept. The
+			// overloads above without a manager copy the packed buffers
+			// on every call. This frees what was kept.
+			static void ClearCache();
 		};
 
 		static Geometry Load(const std::filesystem::path& path, 
-			const VertexFormat& layout);
+			const VertexFormat& layout,
+			const MeshOptimizeParams& optimizeParams =
+				MeshOptimizeParams::Import());
+		static Geometry Load(const std::filesystem::path& path, 
+			const ByteView& bytes,
+			const VertexFormat& layout,
+			const MeshOptimizeParams& optimizeParams =
+				MeshOptimizeParams::Import());
     };
 
+	// Packers convert between the attribute types of Geometry::Data and
+	// the floats in vertex buffers. IsFlat means the type is nothing but
+	// its components back to back, so the bulk kernels in
+	// VertexKernels.hpp can copy it without going through Pack.
 	template <typename T>
 	struct V4Packer;
 
@@ -366,6 +490,7 @@ namespace okami::core {
 	template <>
 	struct V4Packer<glm::vec4> {
 		static constexpr size_t Stride = 1;
+		static constexpr bool IsFlat = true;
 
 		inline static void Pack(float* dest, const glm::vec4* src) {
 			dest[0] = src->x;
@@ -385,6 +510,7 @@ namespace okami::core {
 	template <>
 	struct V4Packer<float> {
 		static constexpr size_t Stride = 4;
+		static constexpr bool IsFlat = true;
 
 		inline static void Pack(float* dest, const float* src) {
 			dest[0] = src[0];
@@ -401,6 +527,7 @@ namespace okami::core {
 	template <>
 	struct V3Packer<glm::vec3> {
 		static constexpr size_t Stride = 1;
+		static constexpr bool IsFlat = true;
 
 		inline static void Pack(float* dest, const glm::vec3* src) {
 			dest[0] = src->x;
@@ -418,6 +545,7 @@ namespace okami::core {
 	template <>
 	struct V3Packer<float> {
 		static constexpr size_t Stride = 3;
+		static constexpr bool IsFlat = true;
 
 		inline static void Pack(float* dest, const float* src) {
 			dest[0] = src[0];
@@ -433,6 +561,7 @@ namespace okami::core {
 	template <>
 	struct V2Packer<glm::vec2> {
 		static constexpr size_t Stride = 1;
+		static constexpr bool IsFlat = true;
 
 		inline static void Pack(float* dest, const glm::vec2* src) {
 			dest[0] = src->x;
@@ -448,6 +577,7 @@ namespace okami::core {
 	template <>
 	struct V2Packer<float> {
 		static constexpr size_t Stride = 2;
+		static constexpr bool IsFlat = true;
 
 		inline static void Pack(float* dest, const float* src) {
 			dest[0] = src[0];
@@ -462,6 +592,7 @@ namespace okami::core {
 	template <>
 	struct I3Packer<uint32_t> {
 		static constexpr size_t Stride = 3;
+		static constexpr bool IsFlat = true;
 
 		inline static void Pack(uint32_t* dest, const uint32_t* src) {
 			dest[0] = src[0];
@@ -588,30 +719,143 @@ namespace okami::core {
 		return result;
 	}
 
-	template <typename destT, size_t componentCount>
-	void ArraySliceFill(destT* dest,
-		const destT& value,
-		size_t stride,
-		size_t vertex_count) {
+	// Copies an attribute of every vertex into a vertex buffer with one
+	// kernel call. Types that aren't flat go element by element.
+	template <typename destT, size_t components, typename PackerT, typename srcT>
+	void PackAttribute(const VertexKernels& kernels, uint8_t* dest,
+		size_t destStrideBytes, const srcT* source, size_t count) {
+		if constexpr (PackerT::IsFlat) {
+			kernels.mCopy[components](dest, destStrideBytes,
+				reinterpret_cast<const uint8_t*>(source),
+				sizeof(srcT) * PackerT::Stride, count);
+		} else {
+			ArraySliceCopyToBytes<destT, srcT, &PackerT::Pack>(
+				dest, source, destStrideBytes, PackerT::Stride, count);
+		}
+	}
 
-		for (size_t i = 0; i < vertex_count; i += stride) {
-			for (size_t component = 0; component < componentCount; ++component) {
-				dest[i + component] = value;
-			}
+	// Like PackAttribute, also returns the bounds of the positions
+	template <typename PackerT, typename srcT>
+	BoundingBox PackPositions(const VertexKernels& kernels, uint8_t* dest,
+		size_t destStrideBytes, const srcT* source, size_t count) {
+		if constexpr (PackerT::IsFlat) {
+			BoundingBox result;
+			kernels.mCopyBounds(dest, destStrideBytes,
+				reinterpret_cast<const uint8_t*>(source),
+				sizeof(srcT) * PackerT::Stride, count, result);
+			return result;
+		} else {
+			ArraySliceCopyToBytes<float, srcT, &PackerT::Pack>(
+				dest, source, destStrideBytes, PackerT::Stride, count);
+			return ArraySliceBoundingBoxBytes(dest, destStrideBytes, count);
 		}
 	}
 
-	template <typename destT, size_t componentCount>
-	void ArraySliceFillBytes(uint8_t* dest,
-		const destT& value,
-		size_t stride,
-		size_t vertex_count) {
+	// The reverse of PackAttribute
+	template <typename srcT, size_t components, typename PackerT, typename destT>
+	void UnpackAttribute(const VertexKernels& kernels, destT* dest,
+		const uint8_t* source, size_t srcStrideBytes, size_t count) {
+		if constexpr (PackerT::IsFlat) {
+			kernels.mCopy[components](reinterpret_cast<uint8_t*>(dest),
+				sizeof(destT) * PackerT::Stride, source, srcStrideBytes, count);
+		} else {
+			ArraySliceCopyFromBytes<destT, srcT, &PackerT::Unpack>(
+				dest, source, PackerT::Stride, srcStrideBytes, count);
+		}
+	}
 
-		for (size_t i = 0; i < vertex_count; i += stride) {
-			auto dest_cast = reinterpret_cast<destT*>(&dest[i]);
-			for (size_t component = 0; component < componentCount; ++component) {
-				dest_cast[component] = value;
-			}
+	// Packs an attribute into the format of its layout element. Plain
+	// floats go through PackAttribute, anything else is converted by
+	// EncodeAttribute, with types that aren't flat staged as floats first.
+	template <size_t components, typename PackerT, typename srcT>
+	void PackVertexAttribute(const VertexKernels& kernels,
+		const LayoutElement& element, uint8_t* dest,
+		size_t destStrideBytes, const srcT* source, size_t count,
+		const BoundingBox& bounds = BoundingBox()) {
+		if (IsPlainFloat(element, components)) {
+			PackAttribute<float, components, PackerT>(kernels,
+				dest, destStrideBytes, source, count);
+		} else if constexpr (PackerT::IsFlat) {
+			EncodeAttribute(element, dest, destStrideBytes,
+				reinterpret_cast<const uint8_t*>(source),
+				sizeof(srcT) * PackerT::Stride, components, count, bounds);
+		} else {
+			std::vector<float> staging(components * count);
+			ArraySliceCopyToBytes<float, srcT, &PackerT::Pack>(
+				reinterpret_cast<uint8_t*>(staging.data()), source,
+				components * sizeof(float), PackerT::Stride, count);
+			EncodeAttribute(element, dest, destStrideBytes,
+				reinterpret_cast<const uint8_t*>(staging.data()),
+				components * sizeof(float), components, count, bounds);
+		}
+	}
+
+	// Like PackVertexAttribute, also returns the bounds of the positions.
+	// Quantized positions are relative to these, so they are computed
+	// before anything is encoded.
+	template <typename PackerT, typename srcT>
+	BoundingBox PackVertexPositions(const VertexKernels& kernels,
+		const LayoutElement& element, uint8_t* dest,
+		size_t destStrideBytes, const srcT* source, size_t count) {
+		if (IsPlainFloat(element, 3)) {
+			return PackPositions<PackerT>(kernels,
+				dest, destStrideBytes, source, count);
+		} else if constexpr (PackerT::IsFlat) {
+			auto src = reinterpret_cast<const uint8_t*>(source);
+			size_t srcStride = sizeof(srcT) * PackerT::Stride;
+			auto bounds = ComputeBounds(src, srcStride, count);
+			EncodeAttribute(element, dest, destStrideBytes,
+				src, srcStride, 3, count, bounds);
+			return bounds;
+		} else {
+			std::vector<float> staging(3 * count);
+			ArraySliceCopyToBytes<float, srcT, &PackerT::Pack>(
+				reinterpret_cast<uint8_t*>(staging.data()), source,
+				3 * sizeof(float), PackerT::Stride, count);
+			auto src = reinterpret_cast<const uint8_t*>(staging.data());
+			auto bounds = ComputeBounds(src, 3 * sizeof(float), count);
+			EncodeAttribute(element, dest, destStrideBytes,
+				src, 3 * sizeof(float), 3, count, bounds);
+			return bounds;
+		}
+	}
+
+	// Writes the same value to an attribute of every vertex
+	template <size_t components>
+	void FillVertexAttribute(const VertexKernels& kernels,
+		const LayoutElement& element, uint8_t* dest,
+		size_t destStrideBytes, size_t count, const float* value,
+		const BoundingBox& bounds = BoundingBox()) {
+		if (IsPlainFloat(element, components)) {
+			kernels.mFill[components](dest, destStrideBytes, count, value);
+		} else {
+			EncodeAttribute(element, dest, destStrideBytes,
+				reinterpret_cast<const uint8_t*>(value), 0,
+				components, count, bounds);
+		}
+	}
+
+	// The reverse of PackVertexAttribute
+	template <size_t components, typename PackerT, typename destT>
+	void UnpackVertexAttribute(const VertexKernels& kernels,
+		const LayoutElement& element, destT* dest,
+		const uint8_t* source, size_t srcStrideBytes, size_t count,
+		const BoundingBox& bounds = BoundingBox()) {
+		if (IsPlainFloat(element, components)) {
+			UnpackAttribute<float, components, PackerT>(kernels,
+				dest, source, srcStrideBytes, count);
+		} else if constexpr (PackerT::IsFlat) {
+			DecodeAttribute(element, reinterpret_cast<uint8_t*>(dest),
+				sizeof(destT) * PackerT::Stride, components,
+				source, srcStrideBytes, count, bounds);
+		} else {
+			std::vector<float> staging(components * count);
+			DecodeAttribute(element, reinterpret_cast<uint8_t*>(staging.data()),
+				components * sizeof(float), components,
+				source, srcStrideBytes, count, bounds);
+			ArraySliceCopyFromBytes<destT, float, &PackerT::Unpack>(
+				dest, reinterpret_cast<const uint8_t*>(staging.data()),
+				PackerT::Stride, components * sizeof(float), count);
 		}
 	}
 
@@ -652,6 +896,9 @@ namespace okami::core {
 		std::vector<int> mColorStrides = {};
 
 		std::vector<size_t> mChannelSizes;
+		// Channels with padding or attributes Pack doesn't know about,
+		// these have to be cleared before packing.
+		std::vector<bool> mChannelHasGaps;
 
 		static PackIndexing From(const VertexFormat& layout,
 			size_t vertex_count);
@@ -669,15 +916,24 @@ namespace okami::core {
 		auto& channel_sizes = indexing.mChannelSizes;
 		uint channelCount = (uint)channel_sizes.size();
 	
-		std::vector<std::vector<uint8_t>> vert_buffers(channelCount);
-		for (uint i = 0; i < channelCount; ++i)
-			vert_buffers[i] = std::vector<uint8_t>(channel_sizes[i]);
+		// Every attribute below is either copied or filled, so the
+		// buffers only need clearing where there are gaps.
+		std::vector<ByteBuffer> vert_buffers(channelCount);
+		for (uint i = 0; i < channelCount; ++i) {
+			vert_buffers[i] = ByteBuffer(channel_sizes[i]);
+			if (indexing.mChannelHasGaps[i])
+				std::memset(vert_buffers[i].data(), 0, channel_sizes[i]);
+		}
 
-		std::vector<uint8_t> indx_buffer_raw(index_count * sizeof(uint32_t));
-		uint32_t* indx_buffer = (uint32_t*)(&indx_buffer_raw[0]);
+		ByteBuffer indx_buffer_raw(index_count * sizeof(uint32_t));
 
 		BoundingBox aabb;
 
+		// Each attribute is a single call into a bulk kernel
+		auto& kernels = GetVertexKernels();
+		const float zero[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		const float one[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
 		bool bHasNormals = data.mNormals != nullptr;
 		bool bHasPositions = data.mPositions != nullptr;
 		bool bHasBitangents = data.mBitangents != nullptr;
@@ -686,85 +942,93 @@ namespace okami::core {
 		if (indexing.mPositionOffset >= 0) {
 			auto& channel = vert_buffers[indexing.mPositionChannel];
 			auto arr = &channel[indexing.mPositionOffset];
+			auto& element = layout.mElements[layout.mPosition];
 			if (bHasPositions) {
-				ArraySliceCopyToBytes<float, V3T, &V3Packer<V3T>::Pack>(
-					arr, &data.mPositions[0], indexing.mPositionStride, V3Packer<V3T>::Stride, vertex_count);
-				aabb = ArraySliceBoundingBoxBytes(arr, (size_t)indexing.mPositionStride, vertex_count);
+				aabb = PackVertexPositions<V3Packer<V3T>>(kernels, element,
+					arr, indexing.mPositionStride, &data.mPositions[0], vertex_count);
 			} else {
 				PrintWarning("Pipeline expects positions, but model has none!");
-				ArraySliceFillBytes<float, 3>(arr, 0.0f, indexing.mPositionStride, vertex_count);
 				aabb.mLower = glm::vec3(0.0f, 0.0f, 0.0f);
 				aabb.mUpper = glm::vec3(0.0f, 0.0f, 0.0f);
+				FillVertexAttribute<3>(kernels, element,
+					arr, indexing.mPositionStride, vertex_count, zero, aabb);
 			}
 		}
 
 		for (uint iuv = 0; iuv < indexing.mUVChannels.size(); ++iuv) {
 			auto& vertexChannel = vert_buffers[indexing.mUVChannels[iuv]];
 			auto arr = &vertexChannel[indexing.mUVOffsets[iuv]];
+			auto& element = layout.mElements[layout.mUVs[iuv]];
 			if (iuv < data.mUVs.size()) {
-				ArraySliceCopyToBytes<float, V2T, &V2Packer<V2T>::Pack>(
-					arr, &data.mUVs[iuv][0], indexing.mUVStrides[iuv], V2Packer<V2T>::Stride, vertex_count);
+				PackVertexAttribute<2, V2Packer<V2T>>(kernels, element,
+					arr, indexing.mUVStrides[iuv], &data.mUVs[iuv][0], vertex_count);
 			} else {
 				PrintWarning("Pipeline expects UVs, but model has none!");
-				ArraySliceFillBytes<float, 2>(arr, 0.0f, indexing.mUVStrides[iuv], vertex_count);
+				FillVertexAttribute<2>(kernels, element,
+					arr, indexing.mUVStrides[iuv], vertex_count, zero);
 			}
 		}
 
 		if (indexing.mNormalOffset >= 0) {
 			auto& channel = vert_buffers[indexing.mNormalChannel];
 			auto arr = &channel[indexing.mNormalOffset];
+			auto& element = layout.mElements[layout.mNormal];
 			if (bHasNormals) {
-				ArraySliceCopyToBytes<float, V3T, &V3Packer<V3T>::Pack>(
-					arr, &data.mNormals[0], indexing.mNormalStride, V3Packer<V3T>::Stride, vertex_count);
+				PackVertexAttribute<3, V3Packer<V3T>>(kernels, element,
+					arr, indexing.mNormalStride, &data.mNormals[0], vertex_count);
 			} else {
 				PrintWarning("Warning: Pipeline expects normals, but model has none!");
-				ArraySliceFillBytes<float, 3>(arr, 0.0f, indexing.mNormalStride, vertex_count);
+				FillVertexAttribute<3>(kernels, element,
+					arr, indexing.mNormalStride, vertex_count, zero);
 			}
 		}
 
 		if (indexing.mTangentOffset >= 0) {
 			auto& channel = vert_buffers[indexing.mTangentChannel];
 			auto arr = &channel[indexing.mTangentOffset];
+			auto& element = layout.mElements[layout.mTangent];
 			if (bHasTangents) {
-				ArraySliceCopyToBytes<float, V3T, &V3Packer<V3T>::Pack>(
-					arr, &data.mTangents[0], indexing.mTangentStride, 
-						V3Packer<V3T>::Stride, vertex_count);
+				PackVertexAttribute<3, V3Packer<V3T>>(kernels, element,
+					arr, indexing.mTangentStride, &data.mTangents[0], vertex_count);
 			} else {
 				PrintWarning("Warning: Pipeline expects tangents, but model has none!");
-				ArraySliceFillBytes<float, 3>(arr, 0.0f, indexing.mTangentStride, vertex_count);
+				FillVertexAttribute<3>(kernels, element,
+					arr, indexing.mTangentStride, vertex_count, zero);
 			}
 		}
 
 		if (indexing.mBitangentOffset >= 0) {
 			auto& channel = vert_buffers[indexing.mBitangentChannel];
 			auto arr = &channel[indexing.mBitangentOffset];
+			auto& element = layout.mElements[layout.mBitangent];
 			if (bHasBitangents) {
-				ArraySliceCopyToBytes<float, V3T, &V3Packer<V3T>::Pack>(
-					arr, &data.mBitangents[0], indexing.mBitangentStride, 
-						V3Packer<V3T>::Stride, vertex_count);
+				PackVertexAttribute<3, V3Packer<V3T>>(kernels, element,
+					arr, indexing.mBitangentStride, &data.mBitangents[0], vertex_count);
 			} else {
 				PrintWarning("Warning: Pipeline expects bitangents, but model has none!");
-				ArraySliceFillBytes<float, 3>(arr, 0.0f, indexing.mBitangentStride, vertex_count);
+				FillVertexAttribute<3>(kernels, element,
+					arr, indexing.mBitangentStride, vertex_count, zero);
 			}
 		}
 
 		for (uint icolor = 0; icolor < indexing.mColorChannels.size(); ++icolor) {
 			auto& vertexChannel = vert_buffers[indexing.mColorChannels[icolor]];
 			auto arr = &vertexChannel[indexing.mColorOffsets[icolor]];
+			auto& element = layout.mElements[layout.mColors[icolor]];
 			if (icolor < data.mColors.size()) {
-				ArraySliceCopyToBytes<float, V4T, &V4Packer<V4T>::Pack>(
-					arr, &data.mColors[icolor][0], indexing.mColorStrides[icolor], 
-						V4Packer<V4T>::Stride, vertex_count);
+				PackVertexAttribute<4, V4Packer<V4T>>(kernels, element,
+					arr, indexing.mColorStrides[icolor], &data.mColors[icolor][0], vertex_count);
 			} else {
 				PrintWarning("Warning: Pipeline expects colors, but model has none!");
-				ArraySliceFillBytes<float, 4>(arr, 1.0f, indexing.mColorStrides[icolor], vertex_count);
+				FillVertexAttribute<4>(kernels, element,
+					arr, indexing.mColorStrides[icolor], vertex_count, one);
 			}
 		}
 
 		if (data.mIndices != nullptr && data.mIndexCount > 0) {
-			ArraySliceCopy<uint32_t, I3T, &I3Packer<I3T>::Pack>(
-				&indx_buffer[0], &data.mIndices[0], 3, 
-				I3Packer<I3T>::Stride, index_count / 3);
+			PackAttribute<uint32_t, 3, I3Packer<I3T>>(kernels,
+				indx_buffer_raw.data(), 3 * sizeof(uint32_t),
+				&data.mIndices[0], index_count / 3);
 		}
 
 		std::vector<BufferDesc> bufferDescs;
@@ -806,6 +1070,8 @@ namespace okami::core {
 		mIndexBuffer = std::move(indxBufferData);
 
 		mBoundingBox = aabb;
+		mMeshlets.clear();
+		mLods.clear();
 	}
 
 	template <typename I3T, typename V2T, typename V3T, typename V4T>
@@ -814,26 +1080,38 @@ namespace okami::core {
 
 		size_t vertex_count = 0;
 		if (mDesc.bIsIndexed) {
-			if (mDesc.mIndexedAttribs.mIndexType != ValueType::UINT32) {
-				throw std::runtime_error("Index type must be VT_UINT32!");
+			auto indexCount = mDesc.mIndexedAttribs.mNumIndices;
+			result.mIndices.resize(indexCount);
+
+			if (mDesc.mIndexedAttribs.mIndexType == ValueType::UINT32) {
+				std::memcpy(&result.mIndices[0], &mIndexBuffer.mBytes[0],
+					sizeof(uint32_t) * indexCount);
+			} else if (mDesc.mIndexedAttribs.mIndexType == ValueType::UINT16) {
+				// See OptimizeMesh
+				for (size_t i = 0; i < indexCount; ++i) {
+					uint16_t index;
+					std::memcpy(&index, &mIndexBuffer.mBytes[i * sizeof(uint16_t)],
+						sizeof(index));
+					result.mIndices[i] = index;
+				}
+			} else {
+				throw std::runtime_error("Index type must be VT_UINT16 or VT_UINT32!");
 			}
-
-			result.mIndices.resize(mDesc.mIndexedAttribs.mNumIndices);
-			std::memcpy(&result.mIndices[0], &mIndexBuffer.mBytes[0],
-				sizeof(uint32_t) * mDesc.mIndexedAttribs.mNumIndices);
 		}
 		
 		vertex_count = mDesc.mAttribs.mNumVertices;
 		auto& layout = mDesc.mLayout;
 		auto indexing = PackIndexing::From(layout, vertex_count);
+		auto& kernels = GetVertexKernels();
 
 		if (layout.mPosition >= 0) {
 			result.mPositions.resize(V3Packer<V3T>::Stride * vertex_count);
 			auto arr = 
 				&mVertexBuffers[indexing.mPositionChannel].mBytes[indexing.mPositionOffset];
-			ArraySliceCopyFromBytes<V3T, float, &V3Packer<V3T>::Unpack>(
-				&result.mPositions[0], arr, V3Packer<V3T>::Stride, 
-				indexing.mPositionStride, vertex_count);
+			UnpackVertexAttribute<3, V3Packer<V3T>>(kernels,
+				layout.mElements[layout.mPosition],
+				&result.mPositions[0], arr, indexing.mPositionStride, vertex_count,
+				mBoundingBox);
 		}
 
 		result.mUVs.resize(indexing.mUVChannels.size());
@@ -841,36 +1119,36 @@ namespace okami::core {
 			result.mUVs[iuv].resize(V2Packer<V2T>::Stride * vertex_count);
 			auto arr = 
 				&mVertexBuffers[indexing.mUVChannels[iuv]].mBytes[indexing.mUVOffsets[iuv]];
-			ArraySliceCopyFromBytes<V2T, float, &V2Packer<V2T>::Unpack>(
-				&result.mUVs[iuv][0], arr, V2Packer<V2T>::Stride,
-				indexing.mUVStrides[iuv], vertex_count);
+			UnpackVertexAttribute<2, V2Packer<V2T>>(kernels,
+				layout.mElements[layout.mUVs[iuv]],
+				&result.mUVs[iuv][0], arr, indexing.mUVStrides[iuv], vertex_count);
 		}
 
 		if (layout.mNormal >= 0) {
 			result.mNormals.resize(V3Packer<V3T>::Stride * vertex_count);
 			auto arr = 
 				&mVertexBuffers[indexing.mNormalChannel].mBytes[indexing.mNormalOffset];
-			ArraySliceCopyFromBytes<V3T, float, &V3Packer<V3T>::Unpack>(
-				&result.mNormals[0], arr, V3Packer<V3T>::Stride,
-				 indexing.mNormalStride, vertex_count);
+			UnpackVertexAttribute<3, V3Packer<V3T>>(kernels,
+				layout.mElements[layout.mNormal],
+				&result.mNormals[0], arr, indexing.mNormalStride, vertex_count);
 		}
 
 		if (layout.mTangent >= 0) {
 			result.mTangents.resize(V3Packer<V3T>::Stride * vertex_count);
 			auto arr = 
 				&mVertexBuffers[indexing.mTangentChannel].mBytes[indexing.mTangentOffset];
-			ArraySliceCopyFromBytes<V3T, float, &V3Packer<V3T>::Unpack>(
-				&result.mTangents[0], arr, V3Packer<V3T>::Stride, 
-				indexing.mTangentStride, vertex_count);
+			UnpackVertexAttribute<3, V3Packer<V3T>>(kernels,
+				layout.mElements[layout.mTangent],
+				&result.mTangents[0], arr, indexing.mTangentStride, vertex_count);
 		}
 
 		if (layout.mBitangent >= 0) {
 			result.mBitangents.resize(V3Packer<V3T>::Stride * vertex_count);
 			auto arr = 
 				&mVertexBuffers[indexing.mBitangentChannel].mBytes[indexing.mBitangentOffset];
-			ArraySliceCopyFromBytes<V3T, float, &V3Packer<V3T>::Unpack>(
-				&result.mBitangents[0], arr, V3Packer<V3T>::Stride, 
-				indexing.mBitangentStride, vertex_count);
+			UnpackVertexAttribute<3, V3Packer<V3T>>(kernels,
+				layout.mElements[layout.mBitangent],
+				&result.mBitangents[0], arr, indexing.mBitangentStride, vertex_count);
 		}
 
 		result.mColors.resize(indexing.mColorChannels.size());
@@ -878,9 +1156,9 @@ namespace okami::core {
 			result.mColors[icolor].resize(V4Packer<V4T>::Stride * vertex_count);
 			auto arr = 
 				&mVertexBuffers[indexing.mColorChannels[icolor]].mBytes[indexing.mColorOffsets[icolor]];
-			ArraySliceCopyFromBytes<V4T, float, &V4Packer<V4T>::Unpack>(
-				&result.mColors[icolor][0], arr, V4Packer<V4T>::Stride,
-				indexing.mColorStrides[icolor], vertex_count);
+			UnpackVertexAttribute<4, V4Packer<V4T>>(kernels,
+				layout.mElements[layout.mColors[icolor]],
+				&result.mColors[icolor][0], arr, indexing.mColorStrides[icolor], vertex_count);
 		}
 
 		return result;
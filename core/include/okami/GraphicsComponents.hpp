@@ -8,8 +8,8 @@
 
 namespace okami::core {
     struct StaticMesh {
-        resource_id_t mGeometry = INVALID_RESOURCE;
-        resource_id_t mMaterial = INVALID_RESOURCE;
+        Handle<Geometry> mGeometry;
+        Handle<Material<StaticMesh>> mMaterial;
     };
 
     struct PointLight {
@@ -24,7 +24,7 @@ namespace okami::core {
     };
 
     struct Sprite {
-        resource_id_t mTexture;
+        Handle<Texture> mTexture;
         glm::vec4 mColor = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
         glm::vec2 mOrigin = glm::vec2(0.0f, 0.0f);
         int mLayer = 0;
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+#include <okami/ByteBuffer.hpp>
+
+#include <marl/conditionvariable.h>
+#include <marl/mutex.h>
+
+#include <cstdint>
+#include <filesystem>
+
+namespace okami::core {
+
+    class LoadToken;
+    class IOThreadPool;
+    class VirtualFileSystem;
+
+    struct IOThreadPoolParams {
+        // Reads in flight at once. Callers wait once this many are
+        // outstanding.
+        uint mQueueDepth = 16;
+        // Bytes read but not yet released by the decode stage. New reads
+        // wait once this is exceeded.
+        uint64_t mMaxBufferedBytes = 128u * 1024u * 1024u;
+    };
+
+    // File contents handed from the I/O stage to the decode stage. The
+    // bytes count against the pool's buffered budget until the buffer is
+    // destroyed or released.
+    class IOBuffer {
+    private:
+        ByteView mBytes;
+        IOThreadPool* mPool = nullptr;
+
+    public:
+        IOBuffer() = default;
+        inline IOBuffer(ByteView&& bytes, IOThreadPool* pool) :
+            mBytes(std::move(bytes)), mPool(pool) {
+        }
+
+        IOBuffer(const IOBuffer&) = delete;
+        IOBuffer& operator=(const IOBuffer&) = delete;
+
+        inline IOBuffer(IOBuffer&& other) :
+            mBytes(std::move(other.mBytes)), mPool(other.mPool) {
+            other.mPool = nullptr;
+        }
+
+        inline IOBuffer& operator=(IOBuffer&& other) {
+            Release();
+            mBytes = std::move(other.mBytes);
+            mPool = other.mPool;
+            other.mPool = nullptr;
+            return *this;
+        }
+
+        inline ~IOBuffer() {
+            Release();
+        }
+
+        inline const ByteView& Bytes() const {
+            return mBytes;
+        }
+
+        void Release();
+    };
+
+    // Throttles the file reads of resource loads. The reads themselves
+    // are done by a VirtualFileSystem's read backend, so waiting on the
+    // disk never occupies the marl workers that run simulation and
+    // decode work. Both the reads in flight and the amount of data
+    // waiting to be decoded are bounded, so a burst of loads slows the
+    // readers down instead of growing memory.
+    class IOThreadPool {
+    private:
+        IOThreadPoolParams mParams;
+        VirtualFileSystem* mFileSystem;
+
+        marl::mutex mMutex;
+        marl::ConditionVariable mSpaceCondition;
+
+        uint mInFlight = 0;
+        uint64_t mBufferedBytes = 0;
+        bool bShutdown = false;
+
+        void ReleaseBytes(uint64_t bytes);
+
+        friend class IOBuffer;
+
+    public:
+        // Reads through VirtualFileSystem::Default() unless given a file
+        // system
+        IOThreadPool(const IOThreadPoolParams& params = IOThreadPoolParams(),
+            VirtualFileSystem* fileSystem = nullptr);
+        ~IOThreadPool();
+
+        IOThreadPool(const IOThreadPool&) = delete;
+        IOThreadPool& operator=(const IOThreadPool&) = delete;
+
+        // Meant to be called from marl tasks, the waiting fiber yields
+        // its worker thread. Returns an empty buffer if the token was
+        // cancelled first.
+        IOBuffer Read(const std::filesystem::path& path,
+            const LoadToken* token = nullptr);
+
+        void SetFileSystem(VirtualFileSystem* fileSystem);
+        VirtualFileSystem& GetFileSystem();
+
+        // Stops throttling, reads after this go straight to the file
+        // system.
+        void Shutdown();
+
+        // Reads in flight
+        size_t GetQueuedCount();
+        uint64_t GetBufferedBytes();
+    };
+}
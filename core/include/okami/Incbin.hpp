@@ -0,0 +1,42 @@
+#pragma once
+
+// Links a file into the binary as it is, instead of passing it through
+// the compiler as an array literal. OKAMI_INCBIN(name, path) defines
+// g_name_data and g_name_end around the contents, aligned to 16 bytes.
+// The path goes to the assembler, which doesn't know where the source
+// file is, so it should be absolute.
+//
+// Only GCC and Clang targeting ELF or Mach-O can do this. Elsewhere
+// OKAMI_HAS_INCBIN is 0 and the build has to generate a source that
+// defines the same symbols, see core/CMakeLists.txt.
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__ELF__) || defined(__APPLE__))
+
+#define OKAMI_HAS_INCBIN 1
+
+#if defined(__APPLE__)
+#define OKAMI_INCBIN_SECTION ".const_data\n"
+#define OKAMI_INCBIN_PREFIX "_"
+#else
+#define OKAMI_INCBIN_SECTION ".section .rodata\n"
+#define OKAMI_INCBIN_PREFIX ""
+#endif
+
+#define OKAMI_INCBIN(name, path) \
+    __asm__(OKAMI_INCBIN_SECTION \
+        ".global " OKAMI_INCBIN_PREFIX "g_" #name "_data\n" \
+        ".balign 16\n" \
+        OKAMI_INCBIN_PREFIX "g_" #name "_data:\n" \
+        ".incbin \"" path "\"\n" \
+        ".global " OKAMI_INCBIN_PREFIX "g_" #name "_end\n" \
+        OKAMI_INCBIN_PREFIX "g_" #name "_end:\n" \
+        ".byte 0\n" \
+        ".text\n"); \
+    extern "C" const unsigned char g_##name##_data[]; \
+    extern "C" const unsigned char g_##name##_end[]
+
+#else
+
+#define OKAMI_HAS_INCBIN 0
+
+#endif
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+#include <okami/MeshSimplifier.hpp>
+#include <okami/Camera.hpp>
+#include <okami/Transform.hpp>
+#include <okami/BoundingBox.hpp>
+
+#include <entt/entt.hpp>
+#include <marl/mutex.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace okami::core {
+
+    // How many pixels one unit of the mesh covers at the point of its
+    // bounds closest to the camera
+    float EstimatePixelsPerUnit(const Camera& camera,
+        const glm::vec3& viewOrigin,
+        float viewportHeight,
+        const Transform& transform,
+        const BoundingBox& bounds);
+
+    struct LodSelectionParams {
+        // Largest error a level may show on screen, in pixels
+        float mMaxScreenError = 1.0f;
+        // A coarser level is only switched to once its error is this
+        // much below the limit, so that meshes near a threshold don't
+        // flip back and forth between levels
+        float mHysteresis = 0.25f;
+        // Meshes nobody asked about in this many updates are forgotten
+        uint32_t mUnusedUpdates = 60;
+    };
+
+    // The coarsest level whose error stays within params. Level 0 is the
+    // full detail mesh, level i > 0 is lods[i - 1]. Only moves to a
+    // coarser level than currentLevel if it is within the limit with
+    // the hysteresis margin.
+    uint32_t SelectLod(const std::vector<MeshLod>& lods,
+        float pixelsPerUnit,
+        uint32_t currentLevel,
+        const LodSelectionParams& params = LodSelectionParams());
+
+    // Remembers the level every mesh was drawn with, so that selection
+    // has hysteresis across frames. Meshes are told apart by entity and
+    // by the view they are drawn in, since the same mesh can be near in
+    // one view and far in another. Views are any key the caller keeps
+    // stable across frames.
+    class LodSelector {
+    private:
+        struct Key {
+            uint64_t mView;
+            entt::entity mEntity;
+
+            inline bool operator==(const Key& other) const {
+                return mView == other.mView && mEntity == other.mEntity;
+            }
+        };
+
+        struct KeyHash {
+            inline size_t operator()(const Key& key) const {
+                return std::hash<uint64_t>()(key.mView * 31 +
+                    (uint64_t)key.mEntity);
+            }
+        };
+
+        struct Entry {
+            uint32_t mLevel = 0;
+            uint64_t mLastRequest = 0;
+        };
+
+        LodSelectionParams mParams;
+
+        mutable marl::mutex mMutex;
+        std::unordered_map<Key, Entry, KeyHash> mEntries;
+        uint64_t mUpdateCount = 0;
+
+    public:
+        inline LodSelector(
+            const LodSelectionParams& params = LodSelectionParams()) :
+            mParams(params) {
+        }
+
+        // Picks the level to draw a mesh with this frame. Can be called
+        // from render threads.
+        uint32_t Select(uint64_t view,
+            entt::entity entity,
+            const std::vector<MeshLod>& lods,
+            float pixelsPerUnit);
+
+        // Forgets meshes that weren't drawn recently. Main thread, once
+        // per frame.
+        void Update();
+
+        uint32_t GetLevel(uint64_t view, entt::entity entity) const;
+    };
+}
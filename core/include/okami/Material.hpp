@@ -21,10 +21,10 @@ namespace okami::core {
     };
 
     struct MetaSurfaceDesc {
-        resource_id_t mAlbedo = INVALID_RESOURCE;
-        resource_id_t mRoughness = INVALID_RESOURCE;
-        resource_id_t mMetallic = INVALID_RESOURCE;
-        resource_id_t mNormal = INVALID_RESOURCE;
+        Handle<Texture> mAlbedo;
+        Handle<Texture> mRoughness;
+        Handle<Texture> mMetallic;
+        Handle<Texture> mNormal;
 
         glm::vec3 mAlbedoFactor = glm::vec3(1.0f, 1.0f, 1.0f);
         float mRoughnessFactor = 1.0f;
@@ -35,7 +35,7 @@ namespace okami::core {
     };
 
     struct FlatSurface {
-        resource_id_t mTexture = INVALID_RESOURCE;
+        Handle<Texture> mTexture;
         glm::vec3 mTextureColor = glm::vec3(1.0f, 1.0f, 1.0f);
 
         MetaSurfaceDesc ToMeta() const {
@@ -48,8 +48,8 @@ namespace okami::core {
     };
     
     struct LambertSurface {
-        resource_id_t mAlbedo = INVALID_RESOURCE;
-        resource_id_t mNormal = INVALID_RESOURCE;
+        Handle<Texture> mAlbedo;
+        Handle<Texture> mNormal;
         glm::vec3 mAlbedoFactor = glm::vec3(1.0f, 1.0f, 1.0f);
 
         MetaSurfaceDesc ToMeta() const {
@@ -63,9 +63,9 @@ namespace okami::core {
     };
 
     struct PhongSurface {
-        resource_id_t mAlbedo = INVALID_RESOURCE;
-        resource_id_t mNormal = INVALID_RESOURCE;
-        resource_id_t mSpecular = INVALID_RESOURCE;
+        Handle<Texture> mAlbedo;
+        Handle<Texture> mNormal;
+        Handle<Texture> mSpecular;
 
         glm::vec3 mAlbedoFactor = glm::vec3(1.0f, 1.0f, 1.0f);
         float mSpecularPower = 1.0f;
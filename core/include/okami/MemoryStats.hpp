@@ -0,0 +1,139 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+#include <okami/Hashers.hpp>
+
+#include <entt/entt.hpp>
+#include <marl/mutex.h>
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+namespace okami::core {
+
+    enum class MemoryCategory {
+        // Frontend data kept in system memory
+        CPU,
+        // Vertex, index and other GPU buffers
+        GPU_BUFFER,
+        // GPU textures, including their full mip chain
+        GPU_TEXTURE,
+        // Loaded data waiting to be finalized
+        IN_FLIGHT,
+        COUNT
+    };
+
+    struct MemoryFootprint {
+        std::array<int64_t, (size_t)MemoryCategory::COUNT> mBytes{};
+
+        inline int64_t& operator[](MemoryCategory category) {
+            return mBytes[(size_t)category];
+        }
+
+        inline int64_t operator[](MemoryCategory category) const {
+            return mBytes[(size_t)category];
+        }
+
+        inline MemoryFootprint& operator+=(const MemoryFootprint& other) {
+            for (size_t i = 0; i < mBytes.size(); ++i) {
+                mBytes[i] += other.mBytes[i];
+            }
+            return *this;
+        }
+
+        inline MemoryFootprint& operator-=(const MemoryFootprint& other) {
+            for (size_t i = 0; i < mBytes.size(); ++i) {
+                mBytes[i] -= other.mBytes[i];
+            }
+            return *this;
+        }
+    };
+
+    struct MemoryUsage {
+        MemoryFootprint mFootprint;
+        int64_t mCount = 0;
+    };
+
+    struct MemoryBudgetViolation {
+        // Null if the budget applies to all resource types
+        entt::meta_type mType;
+        MemoryCategory mCategory;
+        int64_t mBudget;
+        int64_t mUsage;
+    };
+
+    // Queryable view of resource memory usage. Exposed as an interface
+    // so automated runs can assert that budgets were never exceeded.
+    class IMemoryStats {
+    public:
+        virtual ~IMemoryStats() = default;
+
+        virtual MemoryUsage GetUsage(entt::meta_type type) const = 0;
+        virtual MemoryUsage GetTotalUsage() const = 0;
+
+        // A negative budget removes it.
+        virtual void SetBudget(entt::meta_type type,
+            MemoryCategory category, int64_t bytes) = 0;
+        virtual void SetTotalBudget(
+            MemoryCategory category, int64_t bytes) = 0;
+
+        // Budgets that are exceeded right now
+        virtual std::vector<MemoryBudgetViolation> GetViolations() const = 0;
+        // Number of times any budget went from within limits to exceeded
+        virtual uint GetViolationCount() const = 0;
+
+        template <typename T>
+        inline MemoryUsage GetUsage() const {
+            return GetUsage(entt::resolve<T>());
+        }
+
+        template <typename T>
+        inline void SetBudget(MemoryCategory category, int64_t bytes) {
+            SetBudget(entt::resolve<T>(), category, bytes);
+        }
+    };
+
+    // Thread safe, backends report into it from loader threads.
+    class MemoryTracker final : public IMemoryStats {
+    private:
+        struct Budget {
+            int64_t mBytes = -1;
+            bool bExceeded = false;
+        };
+
+        typedef std::array<Budget, (size_t)MemoryCategory::COUNT> budgets_t;
+
+        struct Entry {
+            MemoryUsage mUsage;
+            budgets_t mBudgets;
+        };
+
+        mutable marl::mutex mMutex;
+        std::unordered_map<entt::meta_type, Entry, TypeHash> mEntries;
+        Entry mTotal;
+        uint mViolationCount = 0;
+
+        void CheckBudgets(entt::meta_type type, Entry& entry);
+
+    public:
+        using IMemoryStats::GetUsage;
+        using IMemoryStats::SetBudget;
+
+        void Add(entt::meta_type type,
+            const MemoryFootprint& footprint,
+            int64_t count = 0);
+        void Remove(entt::meta_type type,
+            const MemoryFootprint& footprint,
+            int64_t count = 0);
+
+        MemoryUsage GetUsage(entt::meta_type type) const override;
+        MemoryUsage GetTotalUsage() const override;
+        void SetBudget(entt::meta_type type,
+            MemoryCategory category, int64_t bytes) override;
+        void SetTotalBudget(
+            MemoryCategory category, int64_t bytes) override;
+        std::vector<MemoryBudgetViolation> GetViolations() const override;
+        uint GetViolationCount() const override;
+    };
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <okami/Geometry.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace okami::core {
+
+    // Size of the FIFO post-transform cache the metrics simulate. Real
+    // GPUs differ, this is a common middle ground.
+    constexpr uint VERTEX_CACHE_SIZE = 16;
+
+    struct VertexCacheStats {
+        // Vertex shader invocations per triangle. 3 is the worst case,
+        // about 0.5 the best case for large regular meshes.
+        float mACMR = 0.0f;
+        // Vertex shader invocations per vertex. 1 is the best case.
+        float mATVR = 0.0f;
+    };
+
+    // Replays a triangle list through a FIFO cache of cacheSize entries
+    VertexCacheStats AnalyzeVertexCache(const uint32_t* indices,
+        size_t indexCount, size_t vertexCount,
+        uint cacheSize = VERTEX_CACHE_SIZE);
+
+    // Reorders triangles so that vertices are reused while they are
+    // still in the post-transform cache, following Forsyth's "Linear
+    // Speed Vertex Cache Optimisation". Works for any cache size, so
+    // the order is not tuned to one GPU. destination may be indices.
+    void OptimizeVertexCache(uint32_t* destination, const uint32_t* indices,
+        size_t indexCount, size_t vertexCount);
+
+    // Vertex order in which a triangle list first references them, so
+    // that the vertex fetch reads memory front to back. Writes the new
+    // index of every vertex to remap, UINT32_MAX for unused ones, and
+    // returns how many are used.
+    size_t OptimizeVertexFetchRemap(uint32_t* remap, const uint32_t* indices,
+        size_t indexCount, size_t vertexCount);
+
+    struct MeshOptimizeStats {
+        size_t mVertexCountBefore = 0;
+        size_t mVertexCountAfter = 0;
+        VertexCacheStats mBefore;
+        VertexCacheStats mAfter;
+        ValueType mIndexType = ValueType::UNDEFINED;
+        size_t mMeshletCount = 0;
+        size_t mLodCount = 0;
+    };
+
+    // Runs the passes of params over packed geometry. Only indexed
+    // triangle lists are changed. The bounding box is left alone, since
+    // bounds relative positions were encoded with it. Meshlets and levels
+    // of detail need the layout to have positions.
+    MeshOptimizeStats OptimizeMesh(Geometry::RawData& data,
+        const MeshOptimizeParams& params = MeshOptimizeParams());
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+
+#include <glm/vec3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace okami::core {
+
+    // Collapses edges of a triangle list in the order of least quadric
+    // error (Garland and Heckbert) until at most targetIndexCount indices
+    // are left or the next collapse would move the surface further than
+    // targetError. Vertices are only ever merged into one another, so
+    // the result indexes the same vertex buffer as the input. Open
+    // borders and vertices split by attribute seams are never moved.
+    // destination may be indices. Returns the new index count, and the
+    // largest distance the surface moved in resultError if given.
+    size_t SimplifyMesh(uint32_t* destination, const uint32_t* indices,
+        size_t indexCount, const glm::vec3* positions, size_t vertexCount,
+        size_t targetIndexCount, float targetError,
+        float* resultError = nullptr);
+
+    // A coarser version of a mesh, stored after the full detail indices
+    // in the same index buffer
+    struct MeshLod {
+        uint32_t mFirstIndex = 0;
+        uint32_t mIndexCount = 0;
+        // How far the surface may be from the full detail mesh, in the
+        // mesh's own units
+        float mError = 0.0f;
+
+        template <typename Archive>
+        void serialize(Archive& arr) {
+            arr(mFirstIndex, mIndexCount, mError);
+        }
+    };
+
+    struct LodChainParams {
+        // Levels generated in addition to the full detail mesh
+        uint mLevelCount = 3;
+        // Triangles every level keeps of the one before it
+        float mReduction = 0.5f;
+        // Largest error of any level, relative to the size of the mesh
+        float mMaxError = 0.05f;
+    };
+
+    // Simplifies the first indexCount indices again and again, each level
+    // from the one before, and appends the levels to indices. Stops early
+    // when a level can't be reduced much further within the error.
+    std::vector<MeshLod> BuildLodChain(std::vector<uint32_t>& indices,
+        size_t indexCount, const glm::vec3* positions, size_t vertexCount,
+        const LodChainParams& params = LodChainParams());
+}
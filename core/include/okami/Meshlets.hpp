@@ -0,0 +1,99 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/mat4x4.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace okami::core {
+
+    // A small cluster of neighbouring triangles that is culled as a
+    // whole. Its triangles are a contiguous range of the index buffer,
+    // so visible meshlets are drawn with plain indexed draws.
+    struct Meshlet {
+        uint32_t mFirstIndex = 0;
+        uint32_t mIndexCount = 0;
+        uint32_t mVertexCount = 0;
+
+        // Bounding sphere
+        glm::vec3 mCenter = glm::vec3(0.0f, 0.0f, 0.0f);
+        float mRadius = 0.0f;
+
+        // Normals are within a cone around mConeAxis. Every triangle
+        // faces away from viewers in the cone that opens from mConeApex
+        // against the axis, whose half angle has cosine mConeCutoff. A
+        // cutoff of 1 means the normals spread too much to ever cull.
+        glm::vec3 mConeApex = glm::vec3(0.0f, 0.0f, 0.0f);
+        glm::vec3 mConeAxis = glm::vec3(0.0f, 0.0f, 0.0f);
+        float mConeCutoff = 1.0f;
+
+        template <typename Archive>
+        void serialize(Archive& arr) {
+            arr(mFirstIndex, mIndexCount, mVertexCount);
+            arr(mCenter.x, mCenter.y, mCenter.z, mRadius);
+            arr(mConeApex.x, mConeApex.y, mConeApex.z);
+            arr(mConeAxis.x, mConeAxis.y, mConeAxis.z, mConeCutoff);
+        }
+    };
+
+    struct MeshletParams {
+        // 64 and 124 keep a meshlet's vertices and triangles within
+        // what mesh shaders like, should the renderer ever use them
+        uint mMaxVertices = 64;
+        uint mMaxTriangles = 124;
+        // Favours triangles facing the same way as the meshlet over
+        // ones that add fewer vertices. Tighter cones are culled more.
+        float mConeWeight = 0.5f;
+    };
+
+    // Groups a triangle list into meshlets of neighbouring triangles and
+    // reorders indices in place so that each meshlet is a contiguous
+    // range. Triangles that are already in a cache friendly order stay
+    // close to it.
+    std::vector<Meshlet> BuildMeshlets(uint32_t* indices, size_t indexCount,
+        const glm::vec3* positions, size_t vertexCount,
+        const MeshletParams& params = MeshletParams());
+
+    // Fills in the bounding sphere and normal cone of a meshlet whose
+    // index range is already set
+    void ComputeMeshletBounds(Meshlet& meshlet, const uint32_t* indices,
+        const glm::vec3* positions);
+
+    // Everything culling needs to know about the view, in the space of
+    // the mesh
+    struct MeshletCullView {
+        // Normalized, pointing into the frustum
+        glm::vec4 mPlanes[6];
+        glm::vec3 mViewOrigin;
+        glm::vec3 mViewDirection;
+        bool bOrthographic = false;
+        // Off for mirroring transforms, which flip the winding
+        bool bCullBackfaces = true;
+
+        // world and viewProj in glm's column vector convention. Front
+        // faces wind so that cross(p1 - p0, p2 - p0) points at the
+        // viewer, like the clockwise front faces of the renderer.
+        static MeshletCullView From(const glm::mat4& world,
+            const glm::mat4& viewProj,
+            const glm::vec3& viewOrigin,
+            const glm::vec3& viewDirection,
+            bool bOrthographic);
+    };
+
+    bool IsMeshletVisible(const Meshlet& meshlet, const MeshletCullView& view);
+
+    struct IndexRange {
+        uint32_t mFirstIndex = 0;
+        uint32_t mIndexCount = 0;
+    };
+
+    // Appends the index ranges of meshlets that may be visible, merging
+    // neighbours into one range. Returns how many meshlets survived.
+    size_t CullMeshlets(const std::vector<Meshlet>& meshlets,
+        const MeshletCullView& view, std::vector<IndexRange>& ranges);
+}
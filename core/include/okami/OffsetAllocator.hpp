@@ -0,0 +1,132 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace okami::core {
+
+    struct OffsetAllocation {
+        static constexpr uint32_t NO_SPACE = 0xFFFFFFFF;
+
+        uint32_t mOffset = NO_SPACE;
+        // Node of the allocator that tracks the range
+        uint32_t mNode = NO_SPACE;
+
+        inline bool IsValid() const {
+            return mNode != NO_SPACE;
+        }
+    };
+
+    struct OffsetAllocatorReport {
+        uint32_t mTotalFree = 0;
+        uint32_t mLargestFree = 0;
+        uint32_t mAllocationCount = 0;
+    };
+
+    // Where a live allocation went during defragmentation
+    struct OffsetAllocatorMove {
+        uint32_t mNode;
+        uint32_t mFrom;
+        uint32_t mTo;
+        uint32_t mSize;
+    };
+
+    // Hands out ranges of [0, size) without touching the memory they
+    // stand for, so that it can sub-allocate GPU buffers. Free ranges are
+    // kept in two level segregated fit bins: sizes are rounded to a float
+    // with a 3 bit mantissa, 32 exponents pick a bitmask of 8 bins each.
+    // Allocating and freeing are constant time. Requests only look at
+    // bins whose ranges are all large enough, so a free range whose size
+    // falls between two bins can be passed over by a request of that
+    // very size, the worst case waste is 1/8th. Neighbouring free ranges
+    // are merged on free.
+    //
+    // Allocations are identified by their node, which stays the same
+    // when Grow or Defragment move things around, so GetOffset always
+    // returns where an allocation currently is.
+    class OffsetAllocator {
+    private:
+        static constexpr uint32_t NUM_TOP_BINS = 32;
+        static constexpr uint32_t BINS_PER_LEAF = 8;
+        static constexpr uint32_t TOP_BINS_INDEX_SHIFT = 3;
+        static constexpr uint32_t LEAF_BINS_INDEX_MASK = 0x7;
+        static constexpr uint32_t NUM_LEAF_BINS = NUM_TOP_BINS * BINS_PER_LEAF;
+        static constexpr uint32_t UNUSED = 0xFFFFFFFF;
+
+        struct Node {
+            uint32_t mOffset = 0;
+            uint32_t mSize = 0;
+            // Free nodes of the same bin
+            uint32_t mBinPrev = UNUSED;
+            uint32_t mBinNext = UNUSED;
+            // Nodes on either side of the range, free or not
+            uint32_t mNeighborPrev = UNUSED;
+            uint32_t mNeighborNext = UNUSED;
+            bool bUsed = false;
+            bool bLive = false;
+        };
+
+        uint32_t mSize = 0;
+        uint32_t mMaxAllocations = 0;
+        uint32_t mFreeStorage = 0;
+        uint32_t mAllocationCount = 0;
+
+        uint32_t mUsedBinsTop = 0;
+        uint8_t mUsedBins[NUM_TOP_BINS] = {};
+        uint32_t mBinIndices[NUM_LEAF_BINS];
+
+        std::vector<Node> mNodes;
+        std::vector<uint32_t> mFreeNodes;
+
+        uint32_t InsertNodeIntoBin(uint32_t size, uint32_t offset);
+        void RemoveNodeFromBin(uint32_t node);
+        uint32_t TakeNode();
+        void ReleaseNode(uint32_t node);
+
+    public:
+        // maxAllocations bounds the number of ranges, free or not, that
+        // can exist at once. Every allocation may split a free range in
+        // two, so it should be a bit above the expected allocation count.
+        OffsetAllocator(uint32_t size = 0, uint32_t maxAllocations = 128 * 1024);
+
+        // Forgets every allocation
+        void Reset();
+
+        // Returns an invalid allocation if there is no free range of at
+        // least size
+        OffsetAllocation Allocate(uint32_t size);
+        void Free(const OffsetAllocation& allocation);
+
+        // Adds [GetSize(), size) to the free space
+        void Grow(uint32_t size);
+
+        // Packs the live allocations to the front in the order of their
+        // offsets, so that all free space becomes one range at the end.
+        // Returns what moved, in increasing order of offsets. Ranges can
+        // overlap their old place, so moving data in place has to go
+        // front to back, with memmove semantics.
+        std::vector<OffsetAllocatorMove> Defragment();
+
+        uint32_t GetOffset(const OffsetAllocation& allocation) const;
+        uint32_t GetAllocationSize(const OffsetAllocation& allocation) const;
+
+        // How much of the free space can't be handed out as a single
+        // range, between 0 and 1
+        float GetFragmentation() const;
+
+        OffsetAllocatorReport GetReport() const;
+
+        inline uint32_t GetSize() const {
+            return mSize;
+        }
+    };
+
+    // Sizes rounded to the floats the bins of OffsetAllocator are made of
+    namespace small_float {
+        uint32_t UintToFloatRoundUp(uint32_t size);
+        uint32_t UintToFloatRoundDown(uint32_t size);
+        uint32_t FloatToUint(uint32_t floatValue);
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <marl/scheduler.h>
+#include <marl/waitgroup.h>
+
+#include <cstddef>
+
+namespace okami::core {
+
+    // Runs func(i) for every i < count, spread over the marl workers if
+    // there are any.
+    template <typename FuncT>
+    inline void ParallelFor(size_t count, FuncT&& func) {
+        if (count > 1 && marl::Scheduler::get()) {
+            marl::WaitGroup group(count);
+            for (size_t i = 0; i < count; ++i) {
+                marl::schedule([&func, group, i]() {
+                    func(i);
+                    group.done();
+                });
+            }
+            group.wait();
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                func(i);
+            }
+        }
+    }
+}
@@ -1,14 +1,98 @@
 #pragma once
 
 #include <vector>
-#include <unordered_map>
-#include <stack>
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include <cstdint>
 
 namespace okami::core {
 
+    // Ids used by the pools below pack a slot index into the low 32 bits
+    // and a generation counter into the high bits. Looking an id up is a
+    // plain array access followed by a generation check, no hashing.
+    template <typename IdType>
+    struct SlotId {
+        static constexpr uint32_t GenerationMask = 0x7FFFFFFFu;
+
+        inline static uint32_t Index(IdType id) {
+            return (uint32_t)((uint64_t)id & 0xFFFFFFFFu);
+        }
+
+        inline static uint32_t Generation(IdType id) {
+            return (uint32_t)((uint64_t)id >> 32) & GenerationMask;
+        }
+
+        inline static IdType Make(uint32_t index, uint32_t generation) {
+            return (IdType)(((uint64_t)(generation & GenerationMask) << 32) |
+                (uint64_t)index);
+        }
+    };
+
+    constexpr uint32_t INVALID_SLOT = 0xFFFFFFFFu;
+
+    // Hands out generational ids. Freed slot indices are recycled and
+    // their generation is bumped so that stale ids never alias new ones.
+    template <typename IdType>
+    class SlotAllocator {
+    private:
+        std::vector<uint32_t> mGenerations;
+        std::vector<bool> mAlive;
+        std::vector<uint32_t> mFreeIndices;
+        size_t mLiveCount = 0;
+
+    public:
+        inline IdType Alloc() {
+            uint32_t index;
+
+            if (!mFreeIndices.empty()) {
+                index = mFreeIndices.back();
+                mFreeIndices.pop_back();
+            } else {
+                index = (uint32_t)mGenerations.size();
+                mGenerations.emplace_back(0u);
+                mAlive.emplace_back(false);
+            }
+
+            mAlive[index] = true;
+            ++mLiveCount;
+            return SlotId<IdType>::Make(index, mGenerations[index]);
+        }
+
+        inline bool IsAlive(IdType id) const {
+            auto index = SlotId<IdType>::Index(id);
+            return index < mGenerations.size() &&
+                mAlive[index] &&
+                mGenerations[index] == SlotId<IdType>::Generation(id);
+        }
+
+        inline void Free(IdType id) {
+            if (!IsAlive(id)) {
+                throw std::runtime_error("Id is not alive!");
+            }
+
+            auto index = SlotId<IdType>::Index(id);
+            mGenerations[index] = (mGenerations[index] + 1) &
+                SlotId<IdType>::GenerationMask;
+            mAlive[index] = false;
+            mFreeIndices.emplace_back(index);
+            --mLiveCount;
+        }
+
+        inline void Reserve(size_t count) {
+            mGenerations.reserve(count);
+            mAlive.reserve(count);
+        }
+
+        inline size_t Size() const {
+            return mLiveCount;
+        }
+    };
+
     // A pool that produces items that can be indexed by an id
     // Pointers to items in the pool are not stable and may change
     // whenever an item is added/removed from the pool.
+    // Items are stored densely, so iteration is contiguous.
     template <typename IdType, typename ObjectType>
     class Pool {
     private:
@@ -18,48 +102,80 @@ namespace okami::core {
         };
 
         std::vector<Entry> mItems;
-        std::unordered_map<IdType, size_t> mIdToIndex;
+        std::vector<uint32_t> mSparse;
+
+        inline uint32_t FindDense(IdType id) const {
+            auto index = SlotId<IdType>::Index(id);
+
+            if (index >= mSparse.size()) {
+                return INVALID_SLOT;
+            }
+
+            auto dense = mSparse[index];
+            if (dense == INVALID_SLOT || mItems[dense].mId != id) {
+                return INVALID_SLOT;
+            }
+
+            return dense;
+        }
 
     public:
         inline Pool(uint32_t reserveSize = 64) {
             mItems.reserve(reserveSize);
         }
 
+        inline void Reserve(size_t count) {
+            mItems.reserve(count);
+            mSparse.reserve(count);
+        }
+
+        inline size_t Size() const {
+            return mItems.size();
+        }
+
         inline ObjectType& Alloc(IdType id) {
+            auto index = SlotId<IdType>::Index(id);
+
+            if (index >= mSparse.size()) {
+                mSparse.resize(index + 1, INVALID_SLOT);
+            } else if (mSparse[index] != INVALID_SLOT) {
+                throw std::runtime_error("Slot is already occupied!");
+            }
+
+            mSparse[index] = (uint32_t)mItems.size();
             mItems.resize(mItems.size() + 1);
-            auto& item = mItems[mItems.size() - 1];
+            auto& item = mItems.back();
             item.mId = id;
-            mIdToIndex.emplace(id, mItems.size() - 1);
             return item.mObject;
         }
 
         inline void ForEach(const std::function<void(IdType, ObjectType&)>& func) {
-            for (auto& [id, idx] : mIdToIndex) {
-                func(id, mItems[idx].mObject);
+            for (auto& item : mItems) {
+                func(item.mId, item.mObject);
             }
         }
 
         inline void ForEach(const std::function<void(ObjectType&)>& func) {
             for (auto& item : mItems) {
-                func(item);
+                func(item.mObject);
             }
         }
 
         ObjectType Remove(IdType id) {
-            auto it = mIdToIndex.find(id);
-
-            if (it != mIdToIndex.end()) {
-                auto idx = it->second;
+            auto dense = FindDense(id);
 
-                auto& toRemove = mItems[idx];
-                auto& toSwap = mItems[mItems.size() - 1];
+            if (dense != INVALID_SLOT) {
+                auto& toRemove = mItems[dense];
+                auto& toSwap = mItems.back();
 
                 ObjectType result = std::move(toRemove.mObject);
 
-                mIdToIndex.erase(it);
-                mIdToIndex[toSwap.mId] = idx;
+                mSparse[SlotId<IdType>::Index(toSwap.mId)] = dense;
+                mSparse[SlotId<IdType>::Index(id)] = INVALID_SLOT;
 
-                std::swap(toRemove, toSwap);
+                if (&toRemove != &toSwap) {
+                    toRemove = std::move(toSwap);
+                }
 
                 mItems.pop_back();
 
@@ -80,34 +196,95 @@ namespace okami::core {
         }
 
         inline ObjectType& Get(IdType id) {
-            return mItems[mIdToIndex[id]].mObject;
+            auto dense = FindDense(id);
+
+            if (dense == INVALID_SLOT) {
+                throw std::runtime_error("Id not in pool!");
+            }
+
+            return mItems[dense].mObject;
         }
 
         inline ObjectType* TryGet(IdType id) {
-            auto it = mIdToIndex.find(id);
+            auto dense = FindDense(id);
+
+            if (dense == INVALID_SLOT) {
+                return nullptr;
+            } else {
+                return &mItems[dense].mObject;
+            }
+        }
 
-            if (it == mIdToIndex.end()) {
+        inline const ObjectType* TryGet(IdType id) const {
+            auto dense = FindDense(id);
+
+            if (dense == INVALID_SLOT) {
                 return nullptr;
             } else {
-                return &mItems[it->second].mObject;
+                return &mItems[dense].mObject;
             }
         }
+
+        inline bool Contains(IdType id) const {
+            return FindDense(id) != INVALID_SLOT;
+        }
     };
 
     // A pool that produces items that can be indexed by an id
     // Pointers to items in this pool are stable.
+    // Objects live in fixed size blocks that are never reallocated,
+    // while a dense list of (id, object) pairs is kept for iteration.
     template <typename IdType, typename ObjectType>
     class StablePool {
     private:
-        std::unordered_map<IdType, 
-            std::pair<uint32_t, uint32_t>> mIndices;
-        std::stack<
-            std::pair<uint32_t, uint32_t>> mFreeIndices;
+        struct Slot {
+            uint32_t mDense = INVALID_SLOT;
+            ObjectType* mObject = nullptr;
+        };
+
+        struct DenseEntry {
+            IdType mId;
+            ObjectType* mObject;
+        };
 
-        uint32_t mLastBlockOccupancy = 0;
         uint32_t mBlockSize;
+        uint32_t mLastBlockOccupancy;
+
+        std::vector<std::unique_ptr<ObjectType[]>> mPoolBlocks;
+        std::vector<ObjectType*> mFreeObjects;
+        std::vector<Slot> mSparse;
+        std::vector<DenseEntry> mDense;
+
+        inline uint32_t FindDense(IdType id) const {
+            auto index = SlotId<IdType>::Index(id);
 
-        std::vector<std::vector<ObjectType>> mPoolBlocks;
+            if (index >= mSparse.size()) {
+                return INVALID_SLOT;
+            }
+
+            auto dense = mSparse[index].mDense;
+            if (dense == INVALID_SLOT || mDense[dense].mId != id) {
+                return INVALID_SLOT;
+            }
+
+            return dense;
+        }
+
+        inline ObjectType* AllocObject() {
+            if (!mFreeObjects.empty()) {
+                auto obj = mFreeObjects.back();
+                mFreeObjects.pop_back();
+                return obj;
+            }
+
+            if (mLastBlockOccupancy == mBlockSize) {
+                mLastBlockOccupancy = 0;
+                mPoolBlocks.emplace_back(
+                    std::make_unique<ObjectType[]>(mBlockSize));
+            }
+
+            return &mPoolBlocks.back()[mLastBlockOccupancy++];
+        }
 
     public:
         inline StablePool(uint32_t blockSize = 64) :
@@ -115,32 +292,44 @@ namespace okami::core {
             mLastBlockOccupancy(blockSize) {
         }
 
+        inline void Reserve(size_t count) {
+            mSparse.reserve(count);
+            mDense.reserve(count);
+        }
+
+        inline size_t Size() const {
+            return mDense.size();
+        }
+
         void ForEach(const std::function<void(IdType, ObjectType&)>& func) {
-            for (auto& [id, idx] : mIndices) {
-                func(id, mPoolBlocks[idx.first][idx.second]);
+            for (auto& entry : mDense) {
+                func(entry.mId, *entry.mObject);
             }
         }
 
-        ObjectType& Alloc(IdType id) {
-            std::pair<uint32_t, uint32_t> indx;
+        void ForEach(const std::function<void(ObjectType&)>& func) {
+            for (auto& entry : mDense) {
+                func(*entry.mObject);
+            }
+        }
 
-            if (!mFreeIndices.empty()) {
-                indx = mFreeIndices.top();
-                mFreeIndices.pop();
-            } else {
-                if (mLastBlockOccupancy == mBlockSize) {
-                    mLastBlockOccupancy = 0;
-                    mPoolBlocks.emplace_back(std::vector<ObjectType>(mBlockSize));
-                }
+        ObjectType& Alloc(IdType id) {
+            auto index = SlotId<IdType>::Index(id);
 
-                indx = std::make_pair(
-                    (uint32_t)(mPoolBlocks.size() - 1),
-                    mLastBlockOccupancy++);
+            if (index >= mSparse.size()) {
+                mSparse.resize(index + 1);
+            } else if (mSparse[index].mDense != INVALID_SLOT) {
+                throw std::runtime_error("Slot is already occupied!");
             }
 
-            mIndices.emplace(id, indx);
+            auto obj = AllocObject();
+
+            auto& slot = mSparse[index];
+            slot.mDense = (uint32_t)mDense.size();
+            slot.mObject = obj;
+            mDense.emplace_back(DenseEntry{id, obj});
 
-            return mPoolBlocks[indx.first][indx.second];
+            return *obj;
         }
 
         inline ObjectType& Add(IdType id, ObjectType&& item) {
@@ -150,12 +339,20 @@ namespace okami::core {
         }
 
         ObjectType Remove(IdType id) {
-            auto it = mIndices.find(id);
-            if (it != mIndices.end()) {
-                auto& obj = mPoolBlocks[it->second.first][it->second.second];
-                mFreeIndices.emplace(it->second);
-                mIndices.erase(it);
-                return std::move(obj);
+            auto dense = FindDense(id);
+
+            if (dense != INVALID_SLOT) {
+                auto obj = mDense[dense].mObject;
+                ObjectType result = std::move(*obj);
+
+                auto& last = mDense.back();
+                mSparse[SlotId<IdType>::Index(last.mId)].mDense = dense;
+                mSparse[SlotId<IdType>::Index(id)] = Slot();
+                mDense[dense] = last;
+                mDense.pop_back();
+
+                mFreeObjects.emplace_back(obj);
+                return result;
             } else {
                 throw std::runtime_error("Id not in pool!");
             }
@@ -166,17 +363,35 @@ namespace okami::core {
         }
 
         inline ObjectType& Get(IdType id) {
-            auto idx = mIndices[id];
-            return mPoolBlocks[idx.first][idx.second];
+            auto obj = TryGet(id);
+
+            if (!obj) {
+                throw std::runtime_error("Id not in pool!");
+            }
+
+            return *obj;
         }
 
-        inline ObjectType* TryGet(resource_id_t id) {
-            auto idx = mIndices.find(id);
-            if (idx != mIndices.end()) {
-                return mPoolBlocks[idx.first][idx.second];
+        inline ObjectType* TryGet(IdType id) {
+            auto dense = FindDense(id);
+            if (dense != INVALID_SLOT) {
+                return mDense[dense].mObject;
             } else {
                 return nullptr;
             }
         }
+
+        inline const ObjectType* TryGet(IdType id) const {
+            auto dense = FindDense(id);
+            if (dense != INVALID_SLOT) {
+                return mDense[dense].mObject;
+            } else {
+                return nullptr;
+            }
+        }
+
+        inline bool Contains(IdType id) const {
+            return FindDense(id) != INVALID_SLOT;
+        }
     };
-}
\ No newline at end of file
+}
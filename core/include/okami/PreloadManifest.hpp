@@ -0,0 +1,65 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+#include <okami/Hashers.hpp>
+
+#include <entt/entt.hpp>
+#include <marl/mutex.h>
+
+#include <filesystem>
+#include <iosfwd>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace okami::core {
+
+    struct ManifestEntry {
+        std::filesystem::path mPath;
+        // Id of the resource's meta type
+        entt::id_type mType = 0;
+        // Load parameters as produced by Resource::EncodeLoadParams
+        std::string mParams;
+        uint64_t mFirstUseFrame = 0;
+    };
+
+    // The resources a session loaded, in the order they were first
+    // requested. Stored as text, one entry per line.
+    class PreloadManifest {
+    public:
+        std::vector<ManifestEntry> mEntries;
+
+        // Orders entries by first use, keeping the recorded order for
+        // entries first used in the same frame.
+        void SortByFirstUse();
+
+        void Save(std::ostream& stream) const;
+        void Save(const std::filesystem::path& path) const;
+        static PreloadManifest Load(std::istream& stream);
+        static PreloadManifest Load(const std::filesystem::path& path);
+    };
+
+    // Attach to a ResourceManager to log every resource with a path that
+    // is added while a scene runs. Only the first request for each path
+    // is kept. Thread safe.
+    class ManifestRecorder {
+    private:
+        mutable marl::mutex mMutex;
+        uint64_t mFrame = 0;
+        PreloadManifest mManifest;
+        std::unordered_set<std::filesystem::path, PathHash> mSeen;
+
+    public:
+        // Call once per frame so entries know when they were first used
+        void NextFrame();
+        void SetFrame(uint64_t frame);
+        uint64_t GetFrame() const;
+
+        void Record(entt::id_type type,
+            const std::filesystem::path& path,
+            std::string&& params);
+
+        PreloadManifest GetManifest() const;
+        void Clear();
+    };
+}
@@ -6,8 +6,10 @@
 #include <marl/event.h>
 
 #include <okami/PlatformDefs.hpp>
+#include <okami/Pool.hpp>
 
 #include <filesystem>
+#include <string>
 
 namespace okami {
 
@@ -20,6 +22,35 @@ namespace okami {
 	typedef int64_t resource_id_t;
 	constexpr resource_id_t INVALID_RESOURCE = -1;
 
+	// A typed reference to a resource. The underlying id carries a slot
+	// index and a generation, so resolving a handle through the
+	// ResourceManager or a ResourceBackend is an array access followed by
+	// a generation check. Handles to freed resources resolve to nullptr.
+	template <typename T>
+	struct Handle {
+		resource_id_t mId = INVALID_RESOURCE;
+
+		Handle() = default;
+		inline Handle(resource_id_t id) : mId(id) {
+		}
+
+		inline operator resource_id_t() const {
+			return mId;
+		}
+
+		inline bool IsValid() const {
+			return mId != INVALID_RESOURCE;
+		}
+
+		inline uint32_t GetSlotIndex() const {
+			return core::SlotId<resource_id_t>::Index(mId);
+		}
+
+		inline uint32_t GetGeneration() const {
+			return core::SlotId<resource_id_t>::Generation(mId);
+		}
+	};
+
 	namespace core {
 		class ResourceManager;
 	}
@@ -44,6 +75,18 @@ namespace okami {
 		virtual bool HasLoadParams() const = 0;
 		virtual std::filesystem::path GetPath() const = 0;
 
+		// Bytes of frontend data currently held in system memory.
+		virtual size_t GetCPUByteSize() const {
+			return 0;
+		}
+
+		// Load parameters as a single line of text, for preload
+		// manifests. Types that support preloading provide a matching
+		// static DecodeLoadParams.
+		virtual std::string EncodeLoadParams() const {
+			return std::string();
+		}
+
 		friend class core::ResourceManager;
     };
 }
\ No newline at end of file
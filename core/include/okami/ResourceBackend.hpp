@@ -3,9 +3,17 @@
 #include <okami/PlatformDefs.hpp>
 #include <okami/ResourceManager.hpp>
 #include <okami/Hashers.hpp>
+#include <okami/IOThreadPool.hpp>
+#include <okami/VirtualFileSystem.hpp>
 
 #include <marl/waitgroup.h>
 #include <marl/defer.h>
+#include <marl/mutex.h>
+#include <marl/scheduler.h>
+
+#include <algorithm>
+#include <deque>
+#include <vector>
 
 namespace okami::core {
 
@@ -27,14 +35,22 @@ namespace okami::core {
         };
     };
 
+    // Decodes a resource from the contents of its file. The file itself
+    // is read beforehand through the virtual file system, so loaders
+    // should do CPU work only and never touch the disk.
     template <typename frontendT>
     using resource_load_delegate_t = std::function<frontendT(
         const std::filesystem::path& path,
-        const LoadParams<frontendT>& params)>;
+        const LoadParams<frontendT>& params,
+        const ByteView& bytes,
+        const LoadToken& token)>;
 
+    // frontendIn is the proxy the loader produced, or frontendOut itself
+    // if there is none. A proxy is discarded afterwards, so finalizers
+    // may move data out of it.
     template <typename frontendT, typename backendT>
     using resource_finalize_delegate_t = std::function<
-        void(const frontendT& frontendIn, 
+        void(frontendT& frontendIn, 
             frontendT& frontendOut, 
             backendT& backend)>;
 
@@ -46,12 +62,25 @@ namespace okami::core {
     using resource_construct_backend_delegate_t = std::function<
         backendT(const frontendT&)>;
 
+    // Reports the device memory held by a backend object.
+    template <typename backendT>
+    using resource_measure_delegate_t = std::function<
+        MemoryFootprint(const backendT& resource)>;
+
+    // Releases the device memory of a backend object in place. The
+    // object itself stays in the pool so the resource can be reloaded.
+    template <typename backendT>
+    using resource_evict_delegate_t = std::function<
+        void(backendT& resource)>;
+
     template <typename frontendT>
     struct ResourceLoadRequest {
         std::filesystem::path mPath;
         LoadParams<frontendT> mParams;
         frontendT* mFrontend;
         resource_id_t mId;
+        LoadPriority mPriority = LoadPriority::PREFETCH;
+        std::shared_ptr<LoadToken> mToken;
     };
 
     template <typename frontendT>
@@ -59,6 +88,7 @@ namespace okami::core {
         std::unique_ptr<frontendT> mFrontendProxy;
         frontendT* mFrontend;
         resource_id_t mId;
+        int64_t mInFlightBytes = 0;
     };
 
     /*
@@ -73,11 +103,28 @@ namespace okami::core {
         std::atomic<uint> mPendingFinalizes = 0;
         marl::WaitGroup mTaskCounter;
 
-        // A queue of items set to be deleted.
-        std::set<resource_id_t> mDeletionQueue;
-
-        // Used to queue up resources for loading
-        std::queue<ResourceLoadRequest<frontendT>> mLoadRequests;
+        // Load workers pull requests from the priority queues below until
+        // they run dry, so at most mMaxLoadWorkers loads run at once and
+        // the most important queued request is always served next. Each
+        // load first waits on the I/O pool, which yields the worker
+        // thread, and then decodes on the marl scheduler.
+        marl::mutex mLoadMutex;
+        uint mActiveLoadWorkers = 0;
+        uint mMaxLoadWorkers = 0;
+        uint mLoadBatchSize = 4;
+
+        // A queue of items set to be deleted. Items are moved out of the
+        // pool immediately so that their slot can be recycled.
+        std::vector<backendT> mDeletionQueue;
+
+        // Queued load requests by id. The per priority queues may hold
+        // stale ids for requests that were cancelled or re-prioritized,
+        // those are skipped when popped.
+        Pool<resource_id_t, ResourceLoadRequest<frontendT>> mLoadRequests;
+        std::deque<resource_id_t> mLoadQueues[(size_t)LoadPriority::COUNT];
+
+        // Tokens of loads that are currently running
+        Pool<resource_id_t, std::shared_ptr<LoadToken>> mInFlightLoads;
 
         // Used to queue up resources for finalization (move to GPU)
         MessagePipe<ResourceFinalizeRequest<frontendT>> mFinalizeRequests;
@@ -86,93 +133,371 @@ namespace okami::core {
         resource_load_delegate_t<frontendT> mLoader;
         resource_finalize_delegate_t<frontendT, backendT> mFinalizer;
         resource_destroy_delegate_t<backendT> mDestroyer;
+        resource_measure_delegate_t<backendT> mMeasure;
+        resource_evict_delegate_t<backendT> mEvictor;
+
+        // Backend objects never move, so pointers handed out by TryGet
+        // stay valid until the resource is destroyed. The pool itself, 
+        // the footprints and the deletion queue are guarded by
+        // mPoolMutex since resources can be added from any thread.
+        StablePool<resource_id_t, backendT> mPool;
+        marl::mutex mPoolMutex;
+
+        IOThreadPool* mIO = nullptr;
+
+        // What each resource is currently charged with
+        MemoryTracker* mMemory = nullptr;
+        Pool<resource_id_t, MemoryFootprint> mFootprints;
+
+        void UpdateFootprint(resource_id_t id, 
+            const frontendT& frontend, 
+            const backendT& backend) {
+            if (!mMemory) {
+                return;
+            }
+
+            MemoryFootprint footprint;
+            if (mMeasure) {
+                footprint = mMeasure(backend);
+            }
+            footprint[MemoryCategory::CPU] = frontend.GetCPUByteSize();
+
+            auto& current = mFootprints.Get(id);
+            mMemory->Remove(entt::resolve<frontendT>(), current);
+            mMemory->Add(entt::resolve<frontendT>(), footprint);
+            current = footprint;
+        }
+
+        void ChargeInFlight(int64_t bytes) {
+            if (mMemory && bytes != 0) {
+                MemoryFootprint footprint;
+                footprint[MemoryCategory::IN_FLIGHT] = bytes;
+                mMemory->Add(entt::resolve<frontendT>(), footprint);
+            }
+        }
+
+        // Called with mLoadMutex held.
+        bool PopLoadRequest(ResourceLoadRequest<frontendT>& out) {
+            for (auto& queue : mLoadQueues) {
+                auto priority = (LoadPriority)(&queue - mLoadQueues);
+
+                while (!queue.empty()) {
+                    auto id = queue.front();
+                    queue.pop_front();
+
+                    auto request = mLoadRequests.TryGet(id);
+                    if (request && request->mPriority == priority) {
+                        out = mLoadRequests.Remove(id);
+                        mInFlightLoads.Add(id, 
+                            std::shared_ptr<LoadToken>(out.mToken));
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        // Called with mLoadMutex held.
+        void QueueLoadRequest(resource_id_t id, frontendT& frontend) {
+            ResourceLoadRequest<frontendT> msg;
+            msg.mId = id;
+            msg.mParams = frontend.GetLoadParams();
+            msg.mPath = frontend.GetPath();
+            msg.mFrontend = &frontend;
+            msg.mToken = std::make_shared<LoadToken>();
+
+            mLoadQueues[(size_t)msg.mPriority].emplace_back(id);
+            mLoadRequests.Add(id, std::move(msg));
+            ++mPendingLoads;
+        }
+
+        // Reads and decodes a single request. Returns false if it was
+        // cancelled along the way.
+        bool Load(ResourceLoadRequest<frontendT>& request,
+            ResourceFinalizeRequest<frontendT>& msg) {
+            // I/O stage, blocks until there is room in the I/O queue
+            // and the decode stage has caught up.
+            IOBuffer buffer;
+            if (!request.mToken->IsCancelled()) {
+                if (mIO) {
+                    buffer = mIO->Read(request.mPath, request.mToken.get());
+                } else {
+                    buffer = IOBuffer(VirtualFileSystem::Default().Read(
+                        request.mPath), nullptr);
+                }
+            }
+
+            // Decode stage
+            if (request.mToken->IsCancelled()) {
+                return false;
+            }
+
+            msg.mFrontend = request.mFrontend;
+            msg.mFrontendProxy = std::make_unique<frontendT>(
+                mLoader(request.mPath, request.mParams, 
+                    buffer.Bytes(), *request.mToken));
+            msg.mId = request.mId;
+            msg.mInFlightBytes = msg.mFrontendProxy->GetCPUByteSize();
+
+            // The resource may have been freed while we were
+            // decoding, in which case its frontend is gone.
+            return !request.mToken->IsCancelled();
+        }
+
+        void LoadWorker() {
+            std::vector<ResourceLoadRequest<frontendT>> batch;
+            std::vector<ResourceFinalizeRequest<frontendT>> finalizes;
+
+            while (true) {
+                // Take a few requests at a time so that many small loads
+                // don't contend on the queue lock for every single one.
+                {
+                    marl::lock lock(mLoadMutex);
+
+                    if (!bShutdownCalled) {
+                        ResourceLoadRequest<frontendT> request;
+                        while (batch.size() < mLoadBatchSize &&
+                            PopLoadRequest(request)) {
+                            batch.emplace_back(std::move(request));
+                        }
+                    }
+
+                    if (batch.empty()) {
+                        --mActiveLoadWorkers;
+                        return;
+                    }
+                }
+
+                for (auto& request : batch) {
+                    ResourceFinalizeRequest<frontendT> msg;
+                    if (Load(request, msg)) {
+                        ChargeInFlight(msg.mInFlightBytes);
+                        finalizes.emplace_back(std::move(msg));
+                    }
+                }
 
-        Pool<resource_id_t, backendT> mPool;
-        std::unordered_map<resource_id_t, backendT&> mIdToResource;
+                mPendingFinalizes += (uint)finalizes.size();
+                mFinalizeRequests.ProducerEnqueue(
+                    finalizes.begin(), finalizes.end());
+
+                {
+                    marl::lock lock(mLoadMutex);
+                    for (auto& request : batch) {
+                        mInFlightLoads.Remove(request.mId);
+                    }
+                }
+                mPendingLoads -= (uint)batch.size();
+
+                batch.clear();
+                finalizes.clear();
+            }
+        }
 
     public:
         ResourceBackend(
             resource_construct_backend_delegate_t<frontendT, backendT> constructor,
             resource_load_delegate_t<frontendT> loader,
             resource_finalize_delegate_t<frontendT, backendT> finalizer,
-            resource_destroy_delegate_t<backendT> destroyer) :
+            resource_destroy_delegate_t<backendT> destroyer,
+            resource_measure_delegate_t<backendT> measure = nullptr,
+            resource_evict_delegate_t<backendT> evictor = nullptr) :
             mConstructor(constructor),
             mLoader(loader),
             mFinalizer(finalizer),
-            mDestroyer(destroyer) {
+            mDestroyer(destroyer),
+            mMeasure(measure),
+            mEvictor(evictor) {
         }
 
+        // Callbacks run without mPoolMutex held, so that they may look
+        // up frontends in the ResourceManager, which locks the other way
+        // around when it destroys resources. The ids are taken up front,
+        // resources added meanwhile are skipped and ones removed
+        // meanwhile are not visited.
         inline void ForEach(const std::function<void(backendT&)>& func) {
-            mPool.ForEach(func);
+            ForEach([&func](resource_id_t, backendT& backend) {
+                func(backend);
+            });
         }
 
         inline void ForEach(const std::function<void(resource_id_t, backendT&)>& func) {
-            mPool.ForEach(func);
+            std::vector<resource_id_t> ids;
+            {
+                marl::lock lock(mPoolMutex);
+                ids.reserve(mPool.Size());
+                mPool.ForEach([&ids](resource_id_t id, backendT&) {
+                    ids.emplace_back(id);
+                });
+            }
+
+            for (auto id : ids) {
+                auto backend = TryGet(id);
+                if (backend) {
+                    func(id, *backend);
+                }
+            }
         }
 
         void Run() {
             // Run deletion
-            for (auto id : mDeletionQueue) {
-                auto& resource = mPool.Get(id);
+            std::vector<backendT> deletionQueue;
+            {
+                marl::lock lock(mPoolMutex);
+                std::swap(deletionQueue, mDeletionQueue);
+            }
+
+            for (auto& resource : deletionQueue) {
                 mDestroyer(resource);
-                mPool.Dealloc(id);
             }
 
-            mDeletionQueue.clear();
             mFinalizeRequests.ConsumerCollect();
 
             while (!mFinalizeRequests.ConsumerIsEmpty()) {
                 ResourceFinalizeRequest<frontendT>& msg = 
                     mFinalizeRequests.ConsumerFront();
 
+                // Held through finalization so that the resource can't be
+                // destroyed from another thread halfway through.
+                marl::lock lock(mPoolMutex);
                 auto target = mPool.TryGet(msg.mId);
 
-                // Target hasn't been disposed of yet.
+                // Target hasn't been disposed of yet (stale ids fail the
+                // generation check even if their slot has been reused).
                 if (target) {
                     if (msg.mFrontendProxy)
                         mFinalizer(*msg.mFrontendProxy, *msg.mFrontend, *target);
                     else 
                         mFinalizer(*msg.mFrontend, *msg.mFrontend, *target);
+
+                    UpdateFootprint(msg.mId, *msg.mFrontend, *target);
                 }
+                lock.unlock();
 
+                ChargeInFlight(-msg.mInFlightBytes);
                 mFinalizeRequests.ConsumerPop();
                 --mPendingFinalizes;
             }
 
-            while (!mLoadRequests.empty()) {
-                ResourceLoadRequest<frontendT>& loadRequest = 
-                    mLoadRequests.front();
+            if (bShutdownCalled) {
+                return;
+            }
+
+            // Top up the load workers
+            marl::lock lock(mLoadMutex);
 
-                mPendingLoads++;
+            // Leave half of the workers to the simulation by default,
+            // decoding is the only thing load workers do on them.
+            if (mMaxLoadWorkers == 0) {
+                mMaxLoadWorkers = std::max<uint>(1u, (uint)marl::Scheduler::get()
+                    ->config().workerThread.count / 2);
+            }
+
+            while (mActiveLoadWorkers < mMaxLoadWorkers &&
+                mActiveLoadWorkers < mLoadRequests.Size()) {
+                ++mActiveLoadWorkers;
                 mTaskCounter.add();
-                marl::schedule([
-                    &pendingTasks = mPendingLoads,
-                    &pendingFinalizes = mPendingFinalizes,
-                    taskCounter = mTaskCounter,
-                    request = loadRequest,
-                    &finalizePipe = mFinalizeRequests,
-                    loader = mLoader]() {
+                marl::schedule([this, taskCounter = mTaskCounter]() {
                     defer(taskCounter.done());
-                    defer(pendingTasks--);
+                    LoadWorker();
+                });
+            }
+        }
 
-                    ResourceFinalizeRequest<frontendT> msg;
+        inline void SetMaxConcurrentLoads(uint count) {
+            marl::lock lock(mLoadMutex);
+            mMaxLoadWorkers = count;
+        }
 
-                    msg.mFrontend = request.mFrontend;
-                    msg.mFrontendProxy = std::make_unique<frontendT>
-                        (loader(request.mPath, request.mParams));
-                    msg.mId = request.mId;
+        // Number of requests a load worker takes per trip to the queue.
+        // Larger batches suit many small files, but hold on to requests
+        // longer before a re-prioritization can reach them.
+        inline void SetLoadBatchSize(uint count) {
+            marl::lock lock(mLoadMutex);
+            mLoadBatchSize = std::max(1u, count);
+        }
 
-                    ++pendingFinalizes;
-                    finalizePipe.ProducerEnqueue(std::move(msg));
-                });
+        void SetLoadPriority(resource_id_t id, LoadPriority priority) override {
+            marl::lock lock(mLoadMutex);
+
+            auto request = mLoadRequests.TryGet(id);
+            if (request && request->mPriority != priority) {
+                request->mPriority = priority;
+                mLoadQueues[(size_t)priority].emplace_back(id);
+            }
+        }
+
+        // Drops a queued load, or asks a running one to stop early.
+        void CancelLoad(resource_id_t id) override {
+            marl::lock lock(mLoadMutex);
+
+            auto request = mLoadRequests.TryGet(id);
+            if (request) {
+                request->mToken->Cancel();
+                mLoadRequests.Remove(id);
+                --mPendingLoads;
+                return;
+            }
+
+            auto token = mInFlightLoads.TryGet(id);
+            if (token) {
+                (*token)->Cancel();
+            }
+        }
+
+        // Call after the backend object of a finalized resource was
+        // changed in place, so memory stats stay accurate.
+        inline void Remeasure(resource_id_t id, const frontendT& frontend) {
+            marl::lock lock(mPoolMutex);
+            auto backend = mPool.TryGet(id);
+            if (backend) {
+                UpdateFootprint(id, frontend, *backend);
+            }
+        }
+
+        // Drops the device copy of a finalized resource. Returns false if
+        // the resource is gone or this backend can't evict.
+        bool Evict(resource_id_t id, const frontendT& frontend) {
+            marl::lock lock(mPoolMutex);
+            auto backend = mPool.TryGet(id);
+            if (!backend || !mEvictor) {
+                return false;
+            }
+
+            mEvictor(*backend);
+            UpdateFootprint(id, frontend, *backend);
+            return true;
+        }
+
+        // Loads an evicted resource again from its path. The finalizer
+        // runs on the result just like it did for the first load. Only
+        // resources with load params can be reloaded.
+        bool Reload(resource_id_t id, frontendT& frontend,
+            LoadPriority priority = LoadPriority::PREFETCH) {
+            if (!frontend.HasLoadParams()) {
+                return false;
+            }
+
+            marl::lock lock(mLoadMutex);
+
+            if (bShutdownCalled || mInFlightLoads.Contains(id)) {
+                return true;
+            }
 
-                mLoadRequests.pop();
+            if (!mLoadRequests.Contains(id)) {
+                QueueLoadRequest(id, frontend);
             }
+
+            auto& request = mLoadRequests.Get(id);
+            if (request.mPriority != priority) {
+                request.mPriority = priority;
+                mLoadQueues[(size_t)priority].emplace_back(id);
+            }
+            return true;
         }
 
         inline bool IsIdle() {
-            return mLoadRequests.size() + 
-                mPendingLoads +
+            marl::lock lock(mPoolMutex);
+            return mPendingLoads +
                 mPendingFinalizes +
                 mDeletionQueue.size() == 0;
         }
@@ -182,33 +507,74 @@ namespace okami::core {
         }
 
         inline backendT* TryGet(resource_id_t id) {
+            marl::lock lock(mPoolMutex);
             return mPool.TryGet(id);
         }
 
         inline backendT& Get(resource_id_t id) {
+            marl::lock lock(mPoolMutex);
             return mPool.Get(id);
         }
 
+        inline backendT* TryGet(Handle<frontendT> handle) {
+            return TryGet(handle.mId);
+        }
+
+        inline backendT& Get(Handle<frontendT> handle) {
+            return Get(handle.mId);
+        }
+
+        // Handles to other resource types would otherwise silently
+        // convert to a raw id and look up the wrong pool.
+        template <typename U>
+        backendT* TryGet(Handle<U> handle) = delete;
+        template <typename U>
+        backendT& Get(Handle<U> handle) = delete;
+
         // Delete everything that should be destroyed.
         void Shutdown() {
             bShutdownCalled = true;
+
+            // Workers stop popping once the flag is set, so whatever is
+            // still queued will never load. Drop it so that IsIdle can
+            // report the backend as drained.
+            {
+                marl::lock lock(mLoadMutex);
+                std::vector<resource_id_t> queued;
+                mLoadRequests.ForEach([&queued](resource_id_t id,
+                    ResourceLoadRequest<frontendT>& request) {
+                    request.mToken->Cancel();
+                    queued.emplace_back(id);
+                });
+                for (auto id : queued) {
+                    mLoadRequests.Remove(id);
+                }
+                for (auto& queue : mLoadQueues) {
+                    queue.clear();
+                }
+                mPendingLoads -= (uint)queued.size();
+            }
+
             mTaskCounter.wait();
             Run();
         }
 
-        // Implementation should be thread safe!
         void NotifyAdd(resource_id_t id, frontendT& frontend) override {
-            auto& backend = mPool.Alloc(id);
-            backend = mConstructor(frontend);
+            auto backend = mConstructor(frontend);
 
-            if (frontend.HasLoadParams()) {
-                ResourceLoadRequest<frontendT> msg;
-                msg.mId = id;
-                msg.mParams = frontend.GetLoadParams();
-                msg.mPath = frontend.GetPath();
-                msg.mFrontend = &frontend;
+            {
+                marl::lock lock(mPoolMutex);
+                mPool.Add(id, std::move(backend));
+                mFootprints.Alloc(id) = MemoryFootprint();
+            }
+
+            if (mMemory) {
+                mMemory->Add(entt::resolve<frontendT>(), MemoryFootprint(), 1);
+            }
 
-                mLoadRequests.emplace(std::move(msg));
+            if (frontend.HasLoadParams()) {
+                marl::lock lock(mLoadMutex);
+                QueueLoadRequest(id, frontend);
             } else {
                 ResourceFinalizeRequest<frontendT> msg;
                 msg.mFrontend = &frontend;
@@ -220,8 +586,76 @@ namespace okami::core {
             }
         }
 
+        void NotifyAddBatch(
+            const std::vector<resource_id_t>& ids,
+            const std::vector<frontendT*>& frontends) override {
+            std::vector<backendT> backends;
+            backends.reserve(ids.size());
+            for (auto frontend : frontends) {
+                backends.emplace_back(mConstructor(*frontend));
+            }
+
+            {
+                marl::lock lock(mPoolMutex);
+                mPool.Reserve(mPool.Size() + ids.size());
+                mFootprints.Reserve(mFootprints.Size() + ids.size());
+
+                for (size_t i = 0; i < ids.size(); ++i) {
+                    mPool.Add(ids[i], std::move(backends[i]));
+                    mFootprints.Alloc(ids[i]) = MemoryFootprint();
+                }
+            }
+
+            if (mMemory) {
+                mMemory->Add(entt::resolve<frontendT>(), 
+                    MemoryFootprint(), (int64_t)ids.size());
+            }
+
+            std::vector<ResourceFinalizeRequest<frontendT>> finalizes;
+
+            {
+                marl::lock lock(mLoadMutex);
+                mLoadRequests.Reserve(mLoadRequests.Size() + ids.size());
+
+                for (size_t i = 0; i < ids.size(); ++i) {
+                    if (frontends[i]->HasLoadParams()) {
+                        QueueLoadRequest(ids[i], *frontends[i]);
+                    } else {
+                        ResourceFinalizeRequest<frontendT> msg;
+                        msg.mFrontend = frontends[i];
+                        msg.mFrontendProxy = nullptr;
+                        msg.mId = ids[i];
+                        finalizes.emplace_back(std::move(msg));
+                    }
+                }
+            }
+
+            mPendingFinalizes += (uint)finalizes.size();
+            mFinalizeRequests.ProducerEnqueue(
+                finalizes.begin(), finalizes.end());
+        }
+
         void NotifyDestroy(resource_id_t id, frontendT& frontend) override {
-            mDeletionQueue.emplace(id);
+            CancelLoad(id);
+
+            MemoryFootprint footprint;
+            {
+                marl::lock lock(mPoolMutex);
+                mDeletionQueue.emplace_back(mPool.Remove(id));
+                footprint = mFootprints.Remove(id);
+            }
+
+            if (mMemory) {
+                mMemory->Remove(entt::resolve<frontendT>(), footprint, 1);
+            }
+        }
+
+        void AttachMemoryTracker(MemoryTracker* tracker) override {
+            mMemory = tracker;
+        }
+
+        void AttachIOThreadPool(IOThreadPool* pool) override {
+            mIO = pool;
         }
     };
 }
\ No newline at end of file
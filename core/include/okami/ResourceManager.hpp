@@ -2,7 +2,11 @@
 
 #include <filesystem>
 #include <unordered_map>
+#include <unordered_set>
 #include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
 
 #include <entt/entt.hpp>
 
@@ -12,6 +16,9 @@
 #include <okami/Hashers.hpp>
 #include <okami/Frame.hpp>
 #include <okami/Pool.hpp>
+#include <okami/MemoryStats.hpp>
+#include <okami/IOThreadPool.hpp>
+#include <okami/PreloadManifest.hpp>
 
 namespace okami::core {
 
@@ -80,6 +87,11 @@ namespace okami::core {
             return pool->Remove(id);
         }
 
+        template <typename T>
+        inline void Reserve(size_t count) {
+            GetPool<T>()->Reserve(count);
+        }
+
         inline void Remove(resource_id_t id, const entt::meta_type& type) {
             auto poolIt = mPools.find(type);
 
@@ -91,20 +103,72 @@ namespace okami::core {
         }
     };
 
+    // Loads are served highest priority first. Requests keep their
+    // queue position within a class until they are re-prioritized.
+    enum class LoadPriority {
+        VISIBLE_NOW,
+        PREFETCH,
+        BACKGROUND,
+        COUNT
+    };
+
+    // Shared between a load request and the task serving it. Loaders
+    // should poll IsCancelled() between expensive stages and bail out.
+    class LoadToken {
+    private:
+        std::atomic<bool> bCancelled = false;
+
+    public:
+        inline void Cancel() {
+            bCancelled = true;
+        }
+
+        inline bool IsCancelled() const {
+            return bCancelled;
+        }
+    };
+
     template <typename T>
     class IResourceBackend {
     public:
         // Implementation should be thread safe!
         virtual void NotifyAdd(resource_id_t id, T& frontend) = 0;
         virtual void NotifyDestroy(resource_id_t id, T& frontend) = 0;
+
+        // Backends that can take many resources at once cheaper than
+        // one by one should override this.
+        virtual void NotifyAddBatch(
+            const std::vector<resource_id_t>& ids,
+            const std::vector<T*>& frontends) {
+            for (size_t i = 0; i < ids.size(); ++i) {
+                NotifyAdd(ids[i], *frontends[i]);
+            }
+        }
+
+        // Backends without a load queue can ignore these.
+        virtual void SetLoadPriority(resource_id_t id, LoadPriority priority) {
+        }
+        virtual void CancelLoad(resource_id_t id) {
+        }
+
+        // Backends report the memory held by their resources here.
+        virtual void AttachMemoryTracker(MemoryTracker* tracker) {
+        }
+
+        // Blocking file reads for loads should go through this pool.
+        virtual void AttachIOThreadPool(IOThreadPool* pool) {
+        }
     };
 
     struct ResourceDesc {
         bool bHasLoadParams;
         bool bIsManaged;
         std::filesystem::path mPath;
+        // Set for resources added with GetOrAdd
+        std::string mKey;
         entt::meta_type mType;
         entt::meta_any mPointer;
+        Resource* mResource = nullptr;
     };
 
     typedef std::function<void(entt::meta_any)> resource_updater_any_t;
@@ -112,9 +176,15 @@ namespace okami::core {
     template <typename T>
     using resource_updater_t = std::function<void(T&)>;
 
-    // This object can only be called from main thread!
+    // Safe to use from any thread or marl task. Lookups take a shared
+    // lock and run concurrently, everything that changes the set of
+    // resources takes it exclusively. A resource is visible to TryGet
+    // as soon as Add returns, and its backend has been notified by then.
+    // Pointers stay valid until the resource is collected.
     class ResourceManager {
     private:
+        mutable std::shared_mutex mMutex;
+
         PoolCollection mPools;
 
         std::unordered_map<entt::meta_type, 
@@ -125,20 +195,82 @@ namespace okami::core {
             resource_id_t,
             PathHash> mPathToResource;
 
+        std::unordered_map<std::string, resource_id_t> mKeyToResource;
+
         std::unordered_map<entt::meta_type,
             std::function<void(resource_id_t, entt::meta_any)>,
             TypeHash> mDestroyNotifiers;
 
-        std::unordered_map<resource_id_t, 
-            ResourceDesc> mResourceDescs;
+        Pool<resource_id_t, ResourceDesc> mResourceDescs;
         
-        resource_id_t mCurrentId = 0;
+        SlotAllocator<resource_id_t> mIds;
+
+        MemoryTracker mMemory;
+        IOThreadPool mIO;
+        ManifestRecorder* mRecorder = nullptr;
 
         std::unique_ptr<ResourceDigraph> mDependencies;
-        std::set<resource_id_t> mGarbage;
+        std::vector<resource_id_t> mGarbage;
+        size_t mGarbageHead = 0;
        
         resource_id_t MakeNode();
+        void ReserveNodes(size_t count);
+
+        // A collected resource whose backend hasn't been told yet. Its
+        // id and pooled object are only freed after that.
+        struct DestroyedResource {
+            resource_id_t mId;
+            entt::meta_type mType;
+            entt::meta_any mPointer;
+            bool bIsManaged;
+            std::function<void(resource_id_t, entt::meta_any)> mNotifier;
+        };
+
+        // These expect mMutex to be held exclusively
+        void AddDependencyLocked(
+            resource_id_t child, 
+            resource_id_t parent);
+        void SendToGarbageLocked(resource_id_t item);
+        size_t CollectGarbageLocked(size_t budget,
+            std::vector<DestroyedResource>& destroyed);
 
+        // Notifies backends of destroyed resources with mMutex released,
+        // since they take their own locks there and may be calling into
+        // the manager while holding them. Then frees what is left.
+        void FinishDestroy(std::vector<DestroyedResource>& destroyed);
+
+        template <typename T>
+        IResourceBackend<T>* GetLoader() {
+            auto it = mLoaderInterfaces.find(entt::resolve<T>());
+
+            if (it == mLoaderInterfaces.end()) {
+                return nullptr;
+            }
+
+            return it->second.template cast<IResourceBackend<T>*>();
+        }
+
+        // Throws if obj wants a path that is already taken. Called
+        // before anything is allocated for obj, so that a rejected add
+        // doesn't leave an id or pool slot behind.
+        template <typename T>
+        void CheckPathLocked(const T& obj) const {
+            // This resource has already been added!
+            if (obj.HasLoadParams() &&
+                mPathToResource.find(obj.GetPath()) != mPathToResource.end()) {
+                throw std::runtime_error(
+                    "ResourceManager already has a resource at the specified path!");
+            }
+        }
+
+        // Same for the parent a new resource is to depend on
+        inline void CheckParentLocked(resource_id_t parent) const {
+            if (parent != INVALID_RESOURCE && !mResourceDescs.Contains(parent)) {
+                throw std::runtime_error("Dependency on a dead resource!");
+            }
+        }
+
+        // Expects CheckPathLocked to have passed for obj.
         template <typename T>
         void InitResource(T* obj, resource_id_t id, bool isManaged) {
             bool bHasLoadParams = obj->HasLoadParams();
@@ -146,15 +278,12 @@ namespace okami::core {
 
             if (bHasLoadParams) {
                 path = obj->GetPath();
-                auto pathIt = mPathToResource.find(path);
-
-                // This resource has already been added!
-                if (pathIt != mPathToResource.end()) {
-                    throw std::runtime_error(
-                        "ResourceManager already has a resource at the specified path!");
-                } 
-
                 mPathToResource.emplace(path, id);
+
+                if (mRecorder) {
+                    mRecorder->Record(entt::resolve<T>().id(), 
+                        path, obj->EncodeLoadParams());
+                }
             }
 
             obj->SetResourceId(id);
@@ -164,9 +293,10 @@ namespace okami::core {
             desc.mPath = path;
             desc.mType = entt::resolve<T>();
             desc.mPointer = obj;
+            desc.mResource = obj;
             desc.bIsManaged = isManaged;
 
-            mResourceDescs.emplace(id, desc);
+            mResourceDescs.Add(id, std::move(desc));
         }
 
     public:
@@ -175,10 +305,11 @@ namespace okami::core {
 
         template <typename T>
         inline T* TryGet(resource_id_t res) {
-            auto it = mResourceDescs.find(res);
+            std::shared_lock<std::shared_mutex> lock(mMutex);
+            auto desc = mResourceDescs.TryGet(res);
         
-            if (it != mResourceDescs.end()) {
-                return it->second.mPointer.cast<T*>();
+            if (desc && desc->mType == entt::resolve<T>()) {
+                return static_cast<T*>(desc->mResource);
             } else {
                 return nullptr;
             }
@@ -186,19 +317,99 @@ namespace okami::core {
 
         template <typename T>
         inline T& Get(resource_id_t res) {
-            auto it = mResourceDescs.find(res);
+            auto ptr = TryGet<T>(res);
+
+            if (ptr) {
+                return *ptr;
+            } else {
+                throw std::runtime_error("Failed to find resource!");
+            }
+        }
+
+        // Handles are made from raw ids implicitly, so the type is
+        // checked here as well. A mistyped id gives nullptr.
+        template <typename T>
+        inline T* TryGet(Handle<T> handle) {
+            std::shared_lock<std::shared_mutex> lock(mMutex);
+            auto desc = mResourceDescs.TryGet(handle.mId);
+        
+            if (desc && desc->mType == entt::resolve<T>()) {
+                return static_cast<T*>(desc->mResource);
+            } else {
+                return nullptr;
+            }
+        }
+
+        template <typename T>
+        inline T& Get(Handle<T> handle) {
+            auto ptr = TryGet<T>(handle);
 
-            if (it != mResourceDescs.end()) {
-                return *(it->second.mPointer.cast<T*>());
+            if (ptr) {
+                return *ptr;
             } else {
                 throw std::runtime_error("Failed to find resource!");
             }
         }
 
+        inline IMemoryStats& GetMemoryStats() {
+            return mMemory;
+        }
+
+        inline MemoryTracker& GetMemoryTracker() {
+            return mMemory;
+        }
+
+        inline IOThreadPool& GetIOThreadPool() {
+            return mIO;
+        }
+
+        // Where resources added by path are read from. Defaults to
+        // VirtualFileSystem::Default().
+        inline VirtualFileSystem& GetFileSystem() {
+            return mIO.GetFileSystem();
+        }
+
+        inline void SetFileSystem(VirtualFileSystem* fileSystem) {
+            mIO.SetFileSystem(fileSystem);
+        }
+
+        // Every resource added with a path from now on is logged to the
+        // recorder. Pass nullptr to stop recording.
+        inline void SetManifestRecorder(ManifestRecorder* recorder) {
+            std::unique_lock<std::shared_mutex> lock(mMutex);
+            mRecorder = recorder;
+        }
+
+        // Finds the resource that was added with the given path
+        template <typename T>
+        inline Handle<T> TryFind(const std::filesystem::path& path) const {
+            std::shared_lock<std::shared_mutex> lock(mMutex);
+            auto it = mPathToResource.find(path);
+
+            if (it == mPathToResource.end()) {
+                return Handle<T>();
+            }
+
+            auto desc = mResourceDescs.TryGet(it->second);
+            if (desc && desc->mType == entt::resolve<T>()) {
+                return it->second;
+            } else {
+                return Handle<T>();
+            }
+        }
+
+        inline bool IsAlive(resource_id_t res) const {
+            std::shared_lock<std::shared_mutex> lock(mMutex);
+            return mResourceDescs.Contains(res);
+        }
+
         template <typename T>
         inline void Register(IResourceBackend<T>* loader) {
+            std::unique_lock<std::shared_mutex> lock(mMutex);
             mLoaderInterfaces.emplace(entt::resolve<T>(), loader);
             mPools.MakePool<T>();
+            loader->AttachMemoryTracker(&mMemory);
+            loader->AttachIOThreadPool(&mIO);
             mDestroyNotifiers.emplace(entt::resolve<T>(),
                 [loader, this](resource_id_t id, entt::meta_any res) {
                     loader->NotifyDestroy(id, *(res.cast<T*>()));
@@ -207,6 +418,7 @@ namespace okami::core {
 
         template <typename T>
         inline void Unregister() {
+            std::unique_lock<std::shared_mutex> lock(mMutex);
             mLoaderInterfaces.erase(entt::resolve<T>());
             mPools.DestroyPool<T>();
             mDestroyNotifiers.erase(entt::resolve<T>());
@@ -216,61 +428,219 @@ namespace okami::core {
             resource_id_t child, 
             resource_id_t parent);
 
+        // Moves a pending load to a different priority class. Loads are
+        // only dispatched when the backend runs, so calling this right
+        // after Add decides where the request starts out.
         template <typename T>
-        resource_id_t Add(T* obj) {
-            auto resourceId = MakeNode();
-            InitResource<T>(obj, resourceId, false);
+        void SetLoadPriority(Handle<T> handle, LoadPriority priority) {
+            IResourceBackend<T>* loader;
+            {
+                std::shared_lock<std::shared_mutex> lock(mMutex);
+                loader = GetLoader<T>();
+            }
 
-            auto type = entt::resolve<T>();
-            auto it = mLoaderInterfaces.find(type);
+            if (loader) {
+                loader->SetLoadPriority(handle.mId, priority);
+            }
+        }
+
+        // Backends are notified after mMutex is released. They take
+        // their own locks in NotifyAdd and may call back into the
+        // manager while holding them, so calling them with mMutex held
+        // would lock the two in opposite orders. Pools never move their
+        // items, so the pointers stay good after unlocking.
+        template <typename T>
+        Handle<T> Add(T* obj) {
+            IResourceBackend<T>* loader;
+            resource_id_t resourceId;
+            {
+                std::unique_lock<std::shared_mutex> lock(mMutex);
+
+                CheckPathLocked(*obj);
+                resourceId = MakeNode();
+                InitResource<T>(obj, resourceId, false);
+                loader = GetLoader<T>();
+            }
 
-            if (it != mLoaderInterfaces.end()) {
-                auto loader = it->second.template cast<IResourceBackend<T>*>();
+            if (loader) {
                 loader->NotifyAdd(resourceId, *obj);
             }
 
             return resourceId;
         };
 
-        // Must be called from thread 1!
         template <typename T>
-        resource_id_t Add(T&& obj, resource_id_t parent) {
-            auto type = entt::resolve<T>();
-            auto it = mLoaderInterfaces.find(type);
-
-            if (it == mLoaderInterfaces.end()) {
-                throw std::runtime_error("Loader for type unregistered!");
+        Handle<T> Add(T&& obj, resource_id_t parent) {
+            IResourceBackend<T>* loader;
+            resource_id_t resourceId;
+            T* objInPool;
+            {
+                std::unique_lock<std::shared_mutex> lock(mMutex);
+
+                loader = GetLoader<T>();
+                if (!loader) {
+                    throw std::runtime_error("Loader for type unregistered!");
+                }
+
+                CheckPathLocked(obj);
+                CheckParentLocked(parent);
+
+                // Transfer ownership to the relevant pool
+                resourceId = MakeNode();
+                objInPool = &mPools.Add<T>(resourceId, std::move(obj));
+                InitResource<T>(objInPool, resourceId, true);
+
+                if (parent != INVALID_RESOURCE) {
+                    AddDependencyLocked(resourceId, parent);
+                }
             }
 
-            auto loader = it->second.template cast<IResourceBackend<T>*>();
+            // Let the loader know it should do its thing
+            loader->NotifyAdd(resourceId, *objInPool);
+            return resourceId;
+        }
 
-            // Transfer ownership to the relevant pool
-            auto resourceId = MakeNode();
-            auto& objInPool = mPools.Add<T>(resourceId, std::move(obj));
-            InitResource<T>(&objInPool, resourceId, true);
+        template <typename T>
+        inline Handle<T> Add(T&& obj) {
+            return Add<T>(std::move(obj), INVALID_RESOURCE);
+        }
 
-            if (parent != INVALID_RESOURCE) {
-                AddDependency(resourceId, parent);
+        // Adds many resources of one type. Containers are sized once up
+        // front and the backend is notified with the whole batch, which
+        // lets it queue all loads under a single lock.
+        template <typename T>
+        std::vector<Handle<T>> AddBatch(std::vector<T>&& objs, 
+            resource_id_t parent = INVALID_RESOURCE) {
+            IResourceBackend<T>* loader;
+            std::vector<resource_id_t> ids;
+            std::vector<T*> frontends;
+            {
+                std::unique_lock<std::shared_mutex> lock(mMutex);
+
+                loader = GetLoader<T>();
+                if (!loader) {
+                    throw std::runtime_error("Loader for type unregistered!");
+                }
+
+                // Checked up front so that a duplicate path, also one
+                // within the batch, rejects the batch as a whole
+                CheckParentLocked(parent);
+                std::unordered_set<std::filesystem::path, PathHash> paths;
+                for (auto& obj : objs) {
+                    CheckPathLocked(obj);
+                    if (obj.HasLoadParams() && !paths.emplace(obj.GetPath()).second) {
+                        throw std::runtime_error(
+                            "Batch has more than one resource at the same path!");
+                    }
+                }
+
+                auto count = objs.size();
+                auto total = mResourceDescs.Size() + count;
+                mIds.Reserve(total);
+                mResourceDescs.Reserve(total);
+                mPathToResource.reserve(mPathToResource.size() + count);
+                mPools.Reserve<T>(mPools.GetPool<T>()->Size() + count);
+                ReserveNodes(total);
+
+                ids.reserve(count);
+                frontends.reserve(count);
+
+                for (auto& obj : objs) {
+                    auto resourceId = MakeNode();
+                    auto& objInPool = mPools.Add<T>(resourceId, std::move(obj));
+                    InitResource<T>(&objInPool, resourceId, true);
+
+                    if (parent != INVALID_RESOURCE) {
+                        AddDependencyLocked(resourceId, parent);
+                    }
+
+                    ids.emplace_back(resourceId);
+                    frontends.emplace_back(&objInPool);
+                }
             }
 
-            // Let the loader know it should do its thing
-            loader->NotifyAdd(resourceId, objInPool);
-            return resourceId;
+            objs.clear();
+
+            loader->NotifyAddBatch(ids, frontends);
+            return std::vector<Handle<T>>(ids.begin(), ids.end());
         }
 
         template <typename T>
-        inline resource_id_t Add(T&& obj) {
-            return Add<T>(std::move(obj), INVALID_RESOURCE);
+        inline std::vector<Handle<T>> AddBatch(std::vector<T>&& objs, 
+            const Frame& parentFrame) {
+            return AddBatch<T>(std::move(objs), parentFrame.GetResourceId());
         }
 
         template <typename T>
-        inline resource_id_t Add(T&& obj, const Frame& parentFrame) {
+        inline Handle<T> Add(T&& obj, const Frame& parentFrame) {
             return Add<T>(std::move(obj), parentFrame.GetResourceId());
         }
 
+        // Shares one resource between everyone who asks for it with the
+        // same key, for resources that are made rather than loaded, like
+        // prefabs. factory is only called when there is no live resource
+        // with the key, outside of the lock. The resource stays until it
+        // is sent to the garbage, after which the key makes a new one
+        // even if the old one hasn't been collected yet.
+        template <typename T, typename FactoryT>
+        Handle<T> GetOrAdd(const std::string& key, FactoryT&& factory) {
+            {
+                std::shared_lock<std::shared_mutex> lock(mMutex);
+                auto it = mKeyToResource.find(key);
+                if (it != mKeyToResource.end()) {
+                    return it->second;
+                }
+            }
+
+            T obj = factory();
+
+            IResourceBackend<T>* loader;
+            resource_id_t resourceId;
+            T* objInPool;
+            {
+                std::unique_lock<std::shared_mutex> lock(mMutex);
+
+                // Another thread made it first, ours is dropped
+                auto it = mKeyToResource.find(key);
+                if (it != mKeyToResource.end()) {
+                    return it->second;
+                }
+
+                loader = GetLoader<T>();
+                if (!loader) {
+                    throw std::runtime_error("Loader for type unregistered!");
+                }
+
+                CheckPathLocked(obj);
+                resourceId = MakeNode();
+                objInPool = &mPools.Add<T>(resourceId, std::move(obj));
+                InitResource<T>(objInPool, resourceId, true);
+
+                mResourceDescs.Get(resourceId).mKey = key;
+                mKeyToResource.emplace(key, resourceId);
+            }
+
+            loader->NotifyAdd(resourceId, *objInPool);
+            return resourceId;
+        }
+
+        // Queues a resource for destruction. Resources that only survive
+        // through it are queued as well once it is collected.
         void SendToGarbage(resource_id_t item);
+
+        // Destroys at most budget queued resources and returns how many
+        // are still waiting. Call once per frame to spread large unloads.
+        size_t CollectGarbage(size_t budget);
+
+        // Destroys everything that is queued, including resources that
+        // become unreferenced along the way.
         void CollectGarbage();
 
+        inline bool HasGarbage() const {
+            std::shared_lock<std::shared_mutex> lock(mMutex);
+            return mGarbageHead < mGarbage.size();
+        }
+
         inline void Free(resource_id_t item) {
             SendToGarbage(item);
             CollectGarbage();
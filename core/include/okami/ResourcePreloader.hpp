@@ -0,0 +1,88 @@
+#pragma once
+
+#include <okami/ResourceManager.hpp>
+#include <okami/PreloadManifest.hpp>
+
+#include <functional>
+#include <unordered_map>
+
+namespace okami::core {
+
+    // Replays a recorded manifest before gameplay starts. Loads are
+    // issued in first-use order, so the backends' queues start out in
+    // the order the session needed them.
+    class ResourcePreloader {
+    private:
+        typedef std::function<resource_id_t(
+            const ManifestEntry&,
+            LoadPriority,
+            resource_id_t)> loader_t;
+
+        ResourceManager* mManager;
+        std::unordered_map<entt::id_type, loader_t> mLoaders;
+
+    public:
+        inline ResourcePreloader(ResourceManager* manager) :
+            mManager(manager) {
+        }
+
+        // T must be constructible from a path and its load parameters
+        // and provide a static DecodeLoadParams.
+        template <typename T>
+        void Register() {
+            auto manager = mManager;
+            mLoaders[entt::resolve<T>().id()] =
+                [manager](const ManifestEntry& entry,
+                    LoadPriority priority,
+                    resource_id_t parent) -> resource_id_t {
+                // Already requested by someone else
+                auto existing = manager->TryFind<T>(entry.mPath);
+                if (existing.IsValid()) {
+                    return existing;
+                }
+
+                auto handle = manager->Add<T>(
+                    T(entry.mPath, T::DecodeLoadParams(entry.mParams)),
+                    parent);
+                manager->SetLoadPriority<T>(handle, priority);
+                return handle;
+            };
+        }
+
+        // Resources first used on the earliest frame of the manifest are
+        // needed right away and load as VISIBLE_NOW, the rest use the
+        // given priority. Entries of unregistered types are skipped.
+        // Returns the ids of the preloaded resources in issue order.
+        std::vector<resource_id_t> Preload(
+            const PreloadManifest& manifest,
+            LoadPriority priority = LoadPriority::PREFETCH,
+            resource_id_t parent = INVALID_RESOURCE) {
+            PreloadManifest sorted = manifest;
+            sorted.SortByFirstUse();
+
+            std::vector<resource_id_t> result;
+            result.reserve(sorted.mEntries.size());
+
+            if (sorted.mEntries.empty()) {
+                return result;
+            }
+
+            auto firstFrame = sorted.mEntries.front().mFirstUseFrame;
+
+            for (auto& entry : sorted.mEntries) {
+                auto it = mLoaders.find(entry.mType);
+                if (it == mLoaders.end()) {
+                    continue;
+                }
+
+                auto entryPriority =
+                    entry.mFirstUseFrame == firstFrame ?
+                    LoadPriority::VISIBLE_NOW : priority;
+
+                result.emplace_back(it->second(entry, entryPriority, parent));
+            }
+
+            return result;
+        }
+    };
+}
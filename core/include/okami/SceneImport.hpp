@@ -0,0 +1,68 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+#include <okami/Frame.hpp>
+#include <okami/GraphicsComponents.hpp>
+#include <okami/MeshOptimizer.hpp>
+#include <okami/ResourceManager.hpp>
+#include <okami/Transform.hpp>
+#include <okami/VirtualFileSystem.hpp>
+
+#include <filesystem>
+#include <vector>
+
+namespace okami::core {
+
+    struct SceneImportParams {
+        // Layout the geometry of StaticMesh is packed with, see
+        // IVertexLayoutProvider
+        VertexFormat mLayout;
+        MeshOptimizeParams mOptimizeParams = MeshOptimizeParams::Import();
+        // Placement of the whole scene
+        Transform mTransform;
+    };
+
+    struct ImportedScene {
+        // Entity of the scene's root node
+        entt::entity mRoot = entt::null;
+        // By assimp mesh index. Meshes that no node uses, or that aren't
+        // made of triangles, have invalid handles.
+        std::vector<Handle<Geometry>> mGeometries;
+        // By assimp material index, invalid for unused materials
+        std::vector<Handle<Material<StaticMesh>>> mMaterials;
+        // Every texture the materials use, including ones that were
+        // already loaded
+        std::vector<Handle<Texture>> mTextures;
+
+        size_t mNodeCount = 0;
+        size_t mMeshInstanceCount = 0;
+    };
+
+    // Turns every node of a model file into an entity under parent, with
+    // the node's world Transform. Meshes become StaticMesh components,
+    // on the node's entity if it has one mesh and on child entities if
+    // it has more. Each mesh is packed once however many nodes use it,
+    // and meshes are packed in parallel on the marl workers. Textures
+    // are looked up relative to the model and shared with resources
+    // that already have the same path. All resources are owned by
+    // frame. Must not be called while frame is updating.
+    //
+    // Materials become LambertSurfaces. Only the diffuse color and the
+    // first diffuse and normal map of each are imported. Other texture
+    // types (specular, roughness, metalness, emissive, occlusion and so
+    // on) are skipped, the static mesh pipeline has nothing to sample
+    // them with. Textures embedded in the model are skipped with a
+    // warning.
+    ImportedScene ImportScene(const std::filesystem::path& path,
+        const ByteView& bytes,
+        ResourceManager& resources,
+        Frame& frame,
+        entt::entity parent,
+        const SceneImportParams& params);
+
+    ImportedScene ImportScene(const std::filesystem::path& path,
+        ResourceManager& resources,
+        Frame& frame,
+        entt::entity parent,
+        const SceneImportParams& params);
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+#include <okami/Geometry.hpp>
+#include <okami/GraphicsComponents.hpp>
+#include <okami/MeshOptimizer.hpp>
+#include <okami/Observer.hpp>
+#include <okami/ResourceManager.hpp>
+#include <okami/Transform.hpp>
+
+#include <entt/entt.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+namespace okami::core {
+
+    // Marks an entity whose StaticMesh and Transform don't change, so
+    // that StaticBatcher may merge it with its neighbours. Removing the
+    // tag makes the entity draw on its own again.
+    struct StaticTag {
+    };
+
+    // On an entity that is drawn as part of a batch instead of on its own
+    struct StaticBatchMember {
+        entt::entity mBatch = entt::null;
+    };
+
+    // On the entity that draws a batch. Its StaticMesh is already in
+    // world space.
+    struct StaticBatch {
+        std::vector<entt::entity> mMembers;
+        BoundingBox mBounds;
+    };
+
+    struct StaticBatchParams {
+        // Meshes are grouped by the cell of a grid of this size their
+        // center falls into, so that every batch can be culled on its own
+        float mChunkSize = 32.0f;
+        // A chunk is split into several batches beyond this
+        size_t mMaxVertices = 1u << 20;
+        // Batches are large, meshlets let the renderer skip the parts
+        // that are out of view
+        MeshOptimizeParams mOptimizeParams;
+    };
+
+    struct StaticBatchSource {
+        const Geometry::RawData* mData = nullptr;
+        Transform mTransform;
+        resource_id_t mMaterial = INVALID_RESOURCE;
+    };
+
+    struct MergedStaticBatch {
+        // In world space
+        Geometry::RawData mData;
+        BoundingBox mBounds;
+        resource_id_t mMaterial = INVALID_RESOURCE;
+        // Indices of the sources it is made of
+        std::vector<size_t> mSources;
+    };
+
+    // Groups sources by material and chunk, bakes their transforms into
+    // their vertices and packs each group into one geometry of layout.
+    // Mirroring transforms have their triangles flipped, so that they
+    // keep facing outwards. Groups are merged in parallel on the marl
+    // workers, batches come out in a deterministic order.
+    std::vector<MergedStaticBatch> MergeStaticMeshes(
+        const std::vector<StaticBatchSource>& sources,
+        const VertexFormat& layout,
+        const StaticBatchParams& params = StaticBatchParams());
+
+    // Merges static meshes of a frame into batches at load time, and
+    // takes batches apart again once one of their members changes.
+    class StaticBatcher {
+    private:
+        ResourceManager* mResources;
+        StaticBatchParams mParams;
+
+        Observer<StaticTag, ObserverType::ON_DESTROY> mUnmarked;
+        Observer<Transform, ObserverType::ON_UPDATE> mMoved;
+        Observer<StaticMesh, ObserverType::ON_UPDATE> mMeshChanged;
+        Observer<StaticMesh, ObserverType::ON_DESTROY> mMeshRemoved;
+        entt::registry* mRegistry = nullptr;
+
+        std::unordered_map<entt::entity, entt::entity> mMemberToBatch;
+
+        void Attach(Frame& frame);
+        void DissolveMemberBatch(Frame& frame, entt::entity member);
+
+    public:
+        StaticBatcher(ResourceManager& resources,
+            const StaticBatchParams& params = StaticBatchParams());
+        ~StaticBatcher();
+
+        StaticBatcher(const StaticBatcher&) = delete;
+        StaticBatcher& operator=(const StaticBatcher&) = delete;
+
+        // Batches every entity with a StaticTag, a StaticMesh and a
+        // Transform that isn't batched yet. Geometry is read from its
+        // CPU copy, which the renderer drops once it is uploaded, so
+        // this has to run between adding the geometry and loading
+        // resources. Meshes without CPU data stay on their own. Returns
+        // the number of batches created. Must not be called while frame
+        // is updating.
+        size_t Build(Frame& frame, const VertexFormat& layout);
+
+        // Takes apart the batches of members that lost their StaticTag,
+        // were moved through Frame::Replace or had their StaticMesh
+        // changed or removed since the last call. Their members are drawn
+        // on their own again. Once per frame, outside of updates.
+        void Update(Frame& frame);
+
+        // Removes a batch and draws its members on their own again
+        void Dissolve(Frame& frame, entt::entity batch);
+
+        inline bool IsBatched(entt::entity entity) const {
+            return mMemberToBatch.find(entity) != mMemberToBatch.end();
+        }
+    };
+}
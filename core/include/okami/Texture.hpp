@@ -4,6 +4,8 @@
 #include <okami/Resource.hpp>
 #include <okami/ResourceManager.hpp>
 #include <okami/VertexFormat.hpp>
+#include <okami/Compression.hpp>
+#include <okami/ByteBuffer.hpp>
 
 #include <glm/vec4.hpp>
 
@@ -82,6 +84,14 @@ namespace okami::core {
         inline uint32_t GetPixelByteSize() const {
             return GetSize(mValueType) * mChannels;
         }
+
+        template <class Archive>
+        void serialize(Archive& archive) {
+            archive(mChannels);
+            archive(mValueType);
+            archive(bNormalized);
+            archive(bLinear);
+        }
     };
 
     class Texture;
@@ -172,17 +182,42 @@ namespace okami::core {
                     return 1u;
                 }
             }
+
+            template <class Archive>
+            void serialize(Archive& archive) {
+                archive(mType);
+                archive(mWidth);
+                archive(mHeight);
+                archive(mArraySizeOrDepth);
+                archive(mFormat);
+                archive(mMipLevels);
+                archive(mSampleCount);
+            }
         };
 
         struct Data {
             Desc mDesc;
-            std::vector<uint8_t> mData;
+            ByteBuffer mData;
 
             void GenerateMips();
             static Data Alloc(const Desc& desc);
             static Data Load(
                 const std::filesystem::path& path,
                 const LoadParams<Texture>& params);
+            // Decodes file contents that were already read, the path
+            // only determines the format.
+            static Data Load(
+                const std::filesystem::path& path,
+                const ByteView& bytes,
+                const LoadParams<Texture>& params);
+
+            // Writes the texture with its mip chain already generated in
+            // the engine's own format (.oktex), so loading it is only a
+            // decompression straight into the pixel buffer.
+            void Save(std::vector<uint8_t>& out,
+                const ChunkedPayloadParams& params = ChunkedPayloadParams()) const;
+            void Save(const std::filesystem::path& path,
+                const ChunkedPayloadParams& params = ChunkedPayloadParams()) const;
 
             inline void DeallocCPU() {
                 mData.clear();
@@ -248,13 +283,21 @@ namespace okami::core {
         entt::meta_type GetType() const override;
         bool HasLoadParams() const override;
 		std::filesystem::path GetPath() const override;
+        size_t GetCPUByteSize() const override;
+        std::string EncodeLoadParams() const override;
         const LoadParams<Texture>& GetLoadParams() const;
 
+        static LoadParams<Texture> DecodeLoadParams(const std::string& str);
+
         static void Register();
 
         static Texture Load(
             const std::filesystem::path& path,
             const LoadParams<Texture>& params);
+        static Texture Load(
+            const std::filesystem::path& path,
+            const ByteView& bytes,
+            const LoadParams<Texture>& params);
 
         struct Prefabs {
             static Texture SolidColor(
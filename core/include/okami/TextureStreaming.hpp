@@ -0,0 +1,132 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+#include <okami/Resource.hpp>
+#include <okami/Pool.hpp>
+#include <okami/Texture.hpp>
+#include <okami/Camera.hpp>
+#include <okami/Transform.hpp>
+#include <okami/BoundingBox.hpp>
+
+#include <marl/mutex.h>
+
+#include <utility>
+#include <vector>
+
+namespace okami::core {
+
+    // Size information about a texture's mip chain. Kept separate from
+    // Texture::Desc so that residency decisions can be made (and tested)
+    // without any texture data around.
+    struct MipChain {
+        uint32_t mWidth = 1;
+        uint32_t mHeight = 1;
+        uint32_t mDepth = 1;
+        uint32_t mArraySize = 1;
+        uint32_t mMipCount = 1;
+        uint32_t mPixelByteSize = 4;
+
+        static MipChain From(const Texture::Desc& desc);
+
+        uint64_t GetMipByteSize(uint32_t mip) const;
+
+        // Bytes used by mips [firstMip, mMipCount)
+        uint64_t GetByteSize(uint32_t firstMip) const;
+
+        // The most detailed mip that is no larger than tailDimension
+        // in any direction. Mips from here on are always resident.
+        uint32_t GetTailMip(uint32_t tailDimension) const;
+
+        // The mip whose resolution best matches an on-screen footprint
+        // of screenSize pixels.
+        uint32_t GetDesiredMip(float screenSize) const;
+    };
+
+    // Projected diameter in pixels of a bounding box seen through the
+    // camera. Assumes textures are mapped once across the object.
+    float EstimateScreenSize(const Camera& camera,
+        const glm::vec3& viewOrigin,
+        float viewportHeight,
+        const Transform& transform,
+        const BoundingBox& bounds);
+
+    // Implemented by the renderer. Tests implement it with fake memory.
+    class ITextureResidencyBackend {
+    public:
+        // Make mips [mostDetailedMip, mipCount) of the texture resident.
+        virtual void SetResidentMip(resource_id_t id,
+            uint32_t mostDetailedMip) = 0;
+    };
+
+    struct MipStreamingParams {
+        uint64_t mBudget = 256u * 1024u * 1024u;
+        uint32_t mTailDimension = 64;
+        uint32_t mMaxUploadsPerUpdate = 8;
+        // Textures nobody asked for in this many updates fall back to
+        // their tail and become eviction candidates.
+        uint32_t mUnusedUpdates = 60;
+    };
+
+    // Decides which mips of each streamed texture should be resident.
+    // Textures start out with only their coarse tail. Every update,
+    // finer mips are added one level at a time, most needed first, as
+    // long as they fit in the budget. Fine mips that are no longer
+    // wanted are dropped, and when over budget the least recently
+    // requested textures lose their finest mips first.
+    class MipStreamer {
+    private:
+        struct Entry {
+            MipChain mChain;
+            uint32_t mTailMip = 0;
+            uint32_t mResidentMip = 0;
+            uint32_t mDesiredMip = 0;
+            float mPendingScreenSize = 0.0f;
+            float mScreenSize = 0.0f;
+            uint64_t mLastRequest = 0;
+        };
+
+        ITextureResidencyBackend* mBackend;
+        MipStreamingParams mParams;
+
+        mutable marl::mutex mMutex;
+        Pool<resource_id_t, Entry> mEntries;
+        uint64_t mResidentBytes = 0;
+        uint64_t mUpdateCount = 0;
+
+        // Called with mMutex held, the changes are applied through the
+        // backend once it is released
+        void SetResident(resource_id_t id, Entry& entry, uint32_t mip,
+            std::vector<std::pair<resource_id_t, uint32_t>>& changes);
+        void PlanUpdate(std::vector<std::pair<resource_id_t, uint32_t>>& changes);
+
+    public:
+        inline MipStreamer(ITextureResidencyBackend* backend,
+            const MipStreamingParams& params = MipStreamingParams()) :
+            mBackend(backend),
+            mParams(params) {
+        }
+
+        // Starts tracking a texture and returns the mip it should be
+        // uploaded from initially.
+        uint32_t Add(resource_id_t id, const MipChain& chain);
+        void Remove(resource_id_t id);
+        bool Contains(resource_id_t id) const;
+
+        // Reports how large the texture appears on screen. Can be called
+        // from render threads, the largest request per update wins.
+        void RequestScreenSize(resource_id_t id, float screenSize);
+
+        // Applies residency changes through the backend. Main thread.
+        void Update();
+
+        inline uint32_t GetTailDimension() const {
+            return mParams.mTailDimension;
+        }
+
+        void SetBudget(uint64_t bytes);
+        uint64_t GetBudget() const;
+        uint64_t GetResidentBytes() const;
+        uint32_t GetResidentMip(resource_id_t id) const;
+        uint32_t GetDesiredMip(resource_id_t id) const;
+    };
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+#include <okami/BoundingBox.hpp>
+#include <okami/VertexFormat.hpp>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace okami::core {
+
+    // IEEE 754 half precision, rounded to nearest even. Values too
+    // large for a half become infinity.
+    uint16_t FloatToHalf(float value);
+    float HalfToFloat(uint16_t value);
+
+    // Maps a unit vector onto the [-1, 1] square by projecting it onto
+    // an octahedron and folding the lower half over the upper one.
+    glm::vec2 OctahedralEncode(const glm::vec3& v);
+    // Always returns a unit vector
+    glm::vec3 OctahedralDecode(const glm::vec2& e);
+
+    // Bounds of count float3s in a strided array
+    BoundingBox ComputeBounds(const uint8_t* src, size_t srcStride,
+        size_t count);
+
+    // Whether element stores components floats as they are, so that
+    // the copy kernels in VertexKernels.hpp can be used instead of the
+    // encoders below.
+    bool IsPlainFloat(const LayoutElement& element, uint components);
+
+    // Throws if element can't store an attribute with components floats,
+    // e.g. an octahedral position or a quantized normal.
+    void ValidateEncoding(const LayoutElement& element, uint components,
+        bool bIsPosition);
+
+    // Converts count attributes of srcComponents floats each into the
+    // value type and encoding of element. Components the source doesn't
+    // have are written as zero. A srcStride of 0 repeats one value for
+    // every vertex. bounds is only used by BOUNDS_RELATIVE.
+    void EncodeAttribute(const LayoutElement& element,
+        uint8_t* dest, size_t destStride,
+        const uint8_t* src, size_t srcStride, uint srcComponents,
+        size_t count, const BoundingBox& bounds);
+
+    // The reverse of EncodeAttribute, writes destComponents floats per
+    // attribute.
+    void DecodeAttribute(const LayoutElement& element,
+        uint8_t* dest, size_t destStride, uint destComponents,
+        const uint8_t* src, size_t srcStride,
+        size_t count, const BoundingBox& bounds);
+}
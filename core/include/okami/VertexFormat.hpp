@@ -28,6 +28,20 @@ namespace okami::core {
         NUM_FREQUENCIES
     };
 
+    // How Geometry::RawData::Pack turns float attributes into the value
+    // type of their layout element, and what shaders have to undo.
+    enum class AttributeEncoding : uint8_t {
+        // Component by component. Integer types are SNORM or UNORM if
+        // the element is normalized.
+        DIRECT,
+        // Unit vectors folded onto two components, see
+        // OctahedralEncode. Normals and tangents only.
+        OCTAHEDRAL,
+        // Positions as fractions of the mesh's bounding box, stored as
+        // UNORM. Shaders scale them back with the box of the geometry.
+        BOUNDS_RELATIVE
+    };
+
     static const uint32_t LAYOUT_ELEMENT_AUTO_OFFSET = 0xFFFFFFFF;
     static const uint32_t LAYOUT_ELEMENT_AUTO_STRIDE = 0xFFFFFFFF;
 
@@ -41,6 +55,7 @@ namespace okami::core {
         uint32_t mStride = LAYOUT_ELEMENT_AUTO_STRIDE;
         InputElementFrequency mFrequency = InputElementFrequency::PER_VERTEX;
         uint32_t mInstanceDataStepRate = 1;
+        AttributeEncoding mEncoding = AttributeEncoding::DIRECT;
 
         LayoutElement() = default;
         LayoutElement(
@@ -101,6 +116,7 @@ namespace okami::core {
             archive(mStride);
             archive(mFrequency);
             archive(mInstanceDataStepRate);
+            archive(mEncoding);
         }
     };
 
@@ -132,6 +148,12 @@ namespace okami::core {
         static VertexFormat PositionUV();
         static VertexFormat Position();
 
+        // Half the size of their float counterparts: positions relative
+        // to the bounding box in UNORM16, UVs in FLOAT16 and octahedral
+        // normals and tangents in SNORM16.
+        static VertexFormat PositionUVNormalCompressed();
+        static VertexFormat PositionUVNormalTangentCompressed();
+
 		template <class Archive>
 		void serialize(Archive& archive) {
 			archive(mElements);
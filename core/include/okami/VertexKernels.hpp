@@ -0,0 +1,62 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+#include <okami/BoundingBox.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace okami::core {
+
+    enum class SimdLevel {
+        SCALAR,
+        SSE2,
+        AVX2
+    };
+
+    const char* GetName(SimdLevel level);
+
+    // Copies count elements of a few 32 bit components between two
+    // strided arrays. Strides are in bytes and may be anything, so the
+    // same kernel interleaves into and deinterleaves out of vertex
+    // buffers.
+    typedef void (*strided_copy_t)(
+        uint8_t* dest, size_t destStride,
+        const uint8_t* src, size_t srcStride,
+        size_t count);
+
+    // Copies count float3s like strided_copy_t and computes their
+    // bounding box in the same pass.
+    typedef void (*strided_copy_bounds_t)(
+        uint8_t* dest, size_t destStride,
+        const uint8_t* src, size_t srcStride,
+        size_t count, BoundingBox& bounds);
+
+    // Writes value to count elements of a strided array
+    typedef void (*strided_fill_t)(
+        uint8_t* dest, size_t destStride,
+        size_t count, const float* value);
+
+    // Bulk kernels for packing vertex attributes. Each is called once
+    // per attribute rather than once per vertex.
+    struct VertexKernels {
+        SimdLevel mLevel;
+        // Indexed by component count, 1 to 4
+        strided_copy_t mCopy[5];
+        strided_fill_t mFill[5];
+        strided_copy_bounds_t mCopyBounds;
+    };
+
+    // Best level the CPU supports, detected once
+    SimdLevel GetSupportedSimdLevel();
+
+    // Kernels for a specific level. Levels the CPU does not support fall
+    // back to the best one it does.
+    const VertexKernels& GetVertexKernels(SimdLevel level);
+    // Kernels used by Geometry::RawData::Pack and Unpack
+    const VertexKernels& GetVertexKernels();
+
+    // Overrides the level GetVertexKernels() uses, for tests and
+    // benchmarks. Clamped to what the CPU supports.
+    void SetSimdLevel(SimdLevel level);
+}
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <okami/PlatformDefs.hpp>
+#include <okami/ByteBuffer.hpp>
+#include <okami/Embed.hpp>
+#include <okami/Async.hpp>
+
+#include <marl/mutex.h>
+
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace okami::core {
+
+    constexpr uint64_t WHOLE_FILE = UINT64_MAX;
+
+    struct FileRange {
+        uint64_t mOffset = 0;
+        // Clamped to the end of the file
+        uint64_t mSize = WHOLE_FILE;
+    };
+
+    // Where a mount found a file. Either it is in memory already, or it
+    // is a span of a file on disk that still has to be read.
+    struct ResolvedFile {
+        bool bInMemory = false;
+        ByteView mMemory;
+
+        std::filesystem::path mFile;
+        uint64_t mOffset = 0;
+        uint64_t mSize = 0;
+    };
+
+    // Maps paths relative to its mount point to files
+    class IMount {
+    public:
+        virtual ~IMount() = default;
+
+        virtual bool Resolve(const std::filesystem::path& path,
+            ResolvedFile& out) const = 0;
+    };
+
+    // Files in a directory on disk. An empty root passes paths through
+    // unchanged, so both relative and absolute paths work.
+    class DirectoryMount : public IMount {
+    private:
+        std::filesystem::path mRoot;
+
+    public:
+        inline DirectoryMount(const std::filesystem::path& root = "") :
+            mRoot(root) {
+        }
+
+        bool Resolve(const std::filesystem::path& path,
+            ResolvedFile& out) const override;
+    };
+
+    // Files compiled into the executable. These are never copied, reads
+    // return views of the embedded data. The sizes are kept alongside.
+    class EmbeddedMount : public IMount {
+    private:
+        std::unordered_map<std::filesystem::path, ByteView, PathHash> mFiles;
+
+    public:
+        EmbeddedMount() = default;
+        // The maps of Embed.hpp only hold pointers, so their files have
+        // to be NUL terminated text, like the embedded shaders. The
+        // terminator isn't part of the file.
+        EmbeddedMount(const embedded_file_loader_t& factory);
+
+        // Any data, which may contain zeros. It has to outlive the
+        // mount. Not thread safe, add everything before mounting.
+        void Add(const std::filesystem::path& path,
+            const uint8_t* data, size_t size);
+
+        bool Resolve(const std::filesystem::path& path,
+            ResolvedFile& out) const override;
+    };
+
+    // Many files stored back to back in one pack file (.okpak), so a
+    // level's worth of small assets is a single open file. Only the
+    // table of contents is read when mounting.
+    class PackMount : public IMount {
+    private:
+        struct Entry {
+            uint64_t mOffset;
+            uint64_t mSize;
+        };
+
+        std::filesystem::path mPackPath;
+        std::unordered_map<std::filesystem::path, Entry, PathHash> mEntries;
+
+    public:
+        PackMount(const std::filesystem::path& packPath);
+
+        bool Resolve(const std::filesystem::path& path,
+            ResolvedFile& out) const override;
+
+        // Writes a pack holding each file on disk (second) under its
+        // path inside the pack (first).
+        static void Write(const std::filesystem::path& packPath,
+            const std::vector<std::pair<
+                std::filesystem::path, std::filesystem::path>>& files);
+    };
+
+    struct FileReadRequest {
+        std::filesystem::path mFile;
+        uint64_t mOffset = 0;
+        uint64_t mSize = 0;
+        uint8_t* mDst = nullptr;
+        // Called on a backend thread, error is empty on success
+        std::function<void(const std::string& error)> mOnDone;
+    };
+
+    // Does the actual disk reads for a VirtualFileSystem
+    class IFileReadBackend {
+    public:
+        virtual ~IFileReadBackend() = default;
+
+        virtual void Submit(FileReadRequest&& request) = 0;
+        virtual const char* GetName() const = 0;
+    };
+
+    struct FileSystemParams {
+        // Use io_uring where the kernel allows it
+        bool bAllowIOUring = true;
+        // Threads of the fallback backend
+        uint mThreadCount = 2;
+        // Reads the io_uring backend keeps in the kernel at once
+        uint mQueueDepth = 64;
+    };
+
+    // Blocking reads on a few dedicated threads. Works everywhere.
+    std::unique_ptr<IFileReadBackend> CreateThreadPoolReadBackend(
+        uint threadCount);
+    // Returns nullptr where io_uring is not available, e.g. on other
+    // platforms or kernels, or when a sandbox blocks it.
+    std::unique_ptr<IFileReadBackend> CreateIOUringReadBackend(
+        uint queueDepth);
+
+    struct FileReadResult {
+        ByteView mBytes;
+        // Empty on success
+        std::string mError;
+
+        inline bool IsOk() const {
+            return mError.empty();
+        }
+    };
+
+    // All file access of the engine goes through here. Paths are looked
+    // up in the mounts from the most recently mounted one down, files in
+    // memory are returned as views and everything else is read
+    // asynchronously by the read backend. Thread safe.
+    class VirtualFileSystem : public IVirtualFileSystem {
+    private:
+        struct MountPoint {
+            std::filesystem::path mPrefix;
+            std::unique_ptr<IMount> mMount;
+        };
+
+        FileSystemParams mParams;
+
+        mutable marl::mutex mMutex;
+        std::vector<MountPoint> mMounts;
+        std::unique_ptr<IFileReadBackend> mBackend;
+
+        bool Resolve(const std::filesystem::path& path,
+            ResolvedFile& out) const;
+        IFileReadBackend* GetBackend();
+
+    public:
+        VirtualFileSystem(const FileSystemParams& params = FileSystemParams());
+
+        VirtualFileSystem(const VirtualFileSystem&) = delete;
+        VirtualFileSystem& operator=(const VirtualFileSystem&) = delete;
+
+        // Makes the files of mount visible under prefix. An empty
+        // prefix mounts at the root.
+        void Mount(const std::filesystem::path& prefix,
+            std::unique_ptr<IMount>&& mount);
+
+        // Replaces the read backend, mostly for tests
+        void SetReadBackend(std::unique_ptr<IFileReadBackend>&& backend);
+        const char* GetReadBackendName();
+
+        bool Exists(const std::filesystem::path& path) const override;
+        // Copies the file into a string, for text like shader sources
+        bool TryFind(const std::filesystem::path& path,
+            std::string* contents) const override;
+
+        // Never blocks. Files in memory are ready right away.
+        Future<FileReadResult> ReadAsync(const std::filesystem::path& path,
+            const FileRange& range = FileRange());
+        // Waits for the read and throws on errors
+        ByteView Read(const std::filesystem::path& path,
+            const FileRange& range = FileRange());
+
+        // Everything on disk relative to the working directory, used by
+        // loaders that aren't given a file system explicitly. Never
+        // destroyed.
+        static VirtualFileSystem& Default();
+    };
+}
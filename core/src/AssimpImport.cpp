@@ -0,0 +1,195 @@
+#include <okami/AssimpImport.hpp>
+
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace okami::core {
+
+    template <>
+	struct V3Packer<aiVector3D> {
+		static constexpr size_t Stride = 1;
+		static constexpr bool IsFlat = sizeof(ai_real) == sizeof(float);
+
+		inline static void Pack(float* dest, const aiVector3D* src) {
+			dest[0] = src->x;
+			dest[1] = src->y;
+			dest[2] = src->z;
+		}
+	};
+
+	template <>
+	struct V2Packer<aiVector3D> {
+		static constexpr size_t Stride = 1;
+		// The first two components of each vector
+		static constexpr bool IsFlat = sizeof(ai_real) == sizeof(float);
+
+		inline static void Pack(float* dest, const aiVector3D* src) {
+			dest[0] = src->x;
+			dest[1] = src->y;
+		}
+	};
+
+	template <>
+	struct I3Packer<aiFace> {
+		static constexpr size_t Stride = 1;
+		// Faces point to their indices
+		static constexpr bool IsFlat = false;
+
+		inline static void Pack(uint32_t* dest, const aiFace* src) {
+			dest[0] = src->mIndices[0];
+			dest[1] = src->mIndices[1];
+			dest[2] = src->mIndices[2];
+		}
+	};
+
+    // Serves an already read file to assimp
+    class ByteViewIOStream : public Assimp::IOStream {
+    private:
+        ByteView mBytes;
+        size_t mPosition = 0;
+
+    public:
+        inline ByteViewIOStream(ByteView&& bytes) :
+            mBytes(std::move(bytes)) {
+        }
+
+        size_t Read(void* buffer, size_t size, size_t count) override {
+            if (size == 0) {
+                return 0;
+            }
+
+            count = std::min(count, (mBytes.size() - mPosition) / size);
+            std::memcpy(buffer, mBytes.data() + mPosition, size * count);
+            mPosition += size * count;
+            return count;
+        }
+
+        size_t Write(const void* buffer, size_t size, size_t count) override {
+            return 0;
+        }
+
+        aiReturn Seek(size_t offset, aiOrigin origin) override {
+            size_t base = 0;
+            if (origin == aiOrigin_CUR) {
+                base = mPosition;
+            } else if (origin == aiOrigin_END) {
+                base = mBytes.size();
+            }
+
+            if (base + offset > mBytes.size()) {
+                return aiReturn_FAILURE;
+            }
+
+            mPosition = base + offset;
+            return aiReturn_SUCCESS;
+        }
+
+        size_t Tell() const override {
+            return mPosition;
+        }
+
+        size_t FileSize() const override {
+            return mBytes.size();
+        }
+
+        void Flush() override {
+        }
+    };
+
+    // Makes assimp read through the virtual file system. The file being
+    // imported was already read by the caller, files it references, like
+    // .mtl libraries, are read on demand.
+    class VirtualIOSystem : public Assimp::IOSystem {
+    private:
+        VirtualFileSystem* mFileSystem;
+        std::filesystem::path mPath;
+        ByteView mBytes;
+
+    public:
+        inline VirtualIOSystem(VirtualFileSystem* fileSystem,
+            const std::filesystem::path& path,
+            const ByteView& bytes) :
+            mFileSystem(fileSystem),
+            mPath(path.lexically_normal()),
+            mBytes(bytes) {
+        }
+
+        bool Exists(const char* file) const override {
+            auto path = std::filesystem::path(file).lexically_normal();
+            return path == mPath || mFileSystem->Exists(path);
+        }
+
+        char getOsSeparator() const override {
+            return '/';
+        }
+
+        Assimp::IOStream* Open(const char* file, const char* mode) override {
+            if (std::strchr(mode, 'w')) {
+                return nullptr;
+            }
+
+            auto path = std::filesystem::path(file).lexically_normal();
+            if (path == mPath) {
+                return new ByteViewIOStream(ByteView(mBytes));
+            }
+
+            auto result = mFileSystem->ReadAsync(path).Get();
+            if (!result.IsOk()) {
+                return nullptr;
+            }
+            return new ByteViewIOStream(std::move(result.mBytes));
+        }
+
+        void Close(Assimp::IOStream* stream) override {
+            delete stream;
+        }
+    };
+
+    std::unique_ptr<aiScene> ReadAssimpScene(const std::filesystem::path& path,
+        const ByteView& bytes,
+        VirtualFileSystem& fileSystem) {
+
+        Assimp::Importer importer;
+        importer.SetIOHandler(new VirtualIOSystem(&fileSystem, path, bytes));
+
+        const aiScene* scene = importer.ReadFile(path.string().c_str(), 
+            ASSIMP_IMPORT_FLAGS);
+        
+        if (!scene) {
+            std::cout << importer.GetErrorString() << std::endl;
+            throw std::runtime_error("Failed to import " + path.string() + "!");
+        }
+
+        // Taken from the importer, so that callers can free parts of it
+        // as soon as they are done with them
+        return std::unique_ptr<aiScene>(importer.GetOrphanedScene());
+    }
+
+    Geometry::RawData ToRawData(const aiMesh* mesh,
+        const VertexFormat& layout) {
+
+        if (!IsTriangleMesh(mesh)) {
+            throw std::runtime_error("Mesh is not made of triangles!");
+        }
+
+        size_t nVerts = mesh->mNumVertices;
+        size_t nIndices = mesh->mNumFaces * 3;
+
+        Geometry::DataSource<aiFace, aiVector3D, aiVector3D> data(
+            nVerts, nIndices,
+            mesh->mFaces,
+            mesh->mVertices,
+            mesh->mTextureCoords[0],
+            mesh->mNormals,
+            mesh->mTangents,
+            mesh->mBitangents);
+
+        Geometry::RawData result;
+        result.Pack<aiFace, aiVector3D, aiVector3D>(layout, data);
+        return result;
+    }
+}
@@ -0,0 +1,213 @@
+#include <okami/ByteBuffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace okami::core {
+
+    constexpr size_t MIN_SIZE_CLASS = 256;
+
+    static uint8_t* AllocAligned(size_t capacity) {
+        return static_cast<uint8_t*>(::operator new(capacity,
+            std::align_val_t(BYTE_BUFFER_ALIGNMENT)));
+    }
+
+    static void FreeAligned(uint8_t* ptr) {
+        ::operator delete(ptr, std::align_val_t(BYTE_BUFFER_ALIGNMENT));
+    }
+
+    ByteBufferPool::ByteBufferPool(uint64_t maxCachedBytes) :
+        mMaxCachedBytes(maxCachedBytes) {
+    }
+
+    ByteBufferPool::~ByteBufferPool() {
+        Trim();
+    }
+
+    size_t ByteBufferPool::GetSizeClass(size_t size) {
+        if (size <= MIN_SIZE_CLASS) {
+            return MIN_SIZE_CLASS;
+        }
+
+        uint bits = 0;
+        for (auto v = size - 1; v > 1; v >>= 1) {
+            ++bits;
+        }
+
+        size_t step = (size_t)1 << (bits - 2);
+        return (size + step - 1) & ~(step - 1);
+    }
+
+    uint8_t* ByteBufferPool::Acquire(size_t size, size_t& capacity) {
+        capacity = GetSizeClass(size);
+
+        {
+            marl::lock lock(mMutex);
+
+            auto it = mFree.find(capacity);
+            if (it != mFree.end() && !it->second.empty()) {
+                auto ptr = it->second.back();
+                it->second.pop_back();
+                mStats.mCachedBytes -= capacity;
+                ++mStats.mPooledAllocations;
+                return ptr;
+            }
+
+            ++mStats.mSystemAllocations;
+        }
+
+        return AllocAligned(capacity);
+    }
+
+    void ByteBufferPool::Release(uint8_t* ptr, size_t capacity) {
+        {
+            marl::lock lock(mMutex);
+
+            if (mStats.mCachedBytes + capacity <= mMaxCachedBytes) {
+                mFree[capacity].emplace_back(ptr);
+                mStats.mCachedBytes += capacity;
+                return;
+            }
+        }
+
+        FreeAligned(ptr);
+    }
+
+    void ByteBufferPool::Trim() {
+        std::unordered_map<size_t, std::vector<uint8_t*>> free;
+
+        {
+            marl::lock lock(mMutex);
+            std::swap(free, mFree);
+            mStats.mCachedBytes = 0;
+        }
+
+        for (auto& [capacity, ptrs] : free) {
+            for (auto ptr : ptrs) {
+                FreeAligned(ptr);
+            }
+        }
+    }
+
+    void ByteBufferPool::SetMaxCachedBytes(uint64_t bytes) {
+        {
+            marl::lock lock(mMutex);
+            mMaxCachedBytes = bytes;
+
+            if (mStats.mCachedBytes <= mMaxCachedBytes) {
+                return;
+            }
+        }
+
+        Trim();
+    }
+
+    ByteBufferPoolStats ByteBufferPool::GetStats() const {
+        marl::lock lock(mMutex);
+        return mStats;
+    }
+
+    ByteBufferPool& ByteBufferPool::Default() {
+        static ByteBufferPool* pool = new ByteBufferPool();
+        return *pool;
+    }
+
+    ByteBuffer::ByteBuffer(size_t size, ByteBufferPool* pool) :
+        mSize(size), mPool(pool) {
+        if (size > 0) {
+            mData = mPool->Acquire(size, mCapacity);
+        }
+    }
+
+    ByteBuffer::ByteBuffer(const uint8_t* data, size_t size,
+        ByteBufferPool* pool) : ByteBuffer(size, pool) {
+        if (size > 0) {
+            std::memcpy(mData, data, size);
+        }
+    }
+
+    ByteBuffer::ByteBuffer(const ByteBuffer& other) :
+        ByteBuffer(other.mData, other.mSize,
+            other.mPool ? other.mPool : &ByteBufferPool::Default()) {
+    }
+
+    ByteBuffer& ByteBuffer::operator=(const ByteBuffer& other) {
+        if (this != &other) {
+            *this = ByteBuffer(other);
+        }
+        return *this;
+    }
+
+    ByteBuffer::ByteBuffer(ByteBuffer&& other) noexcept :
+        mData(other.mData),
+        mSize(other.mSize),
+        mCapacity(other.mCapacity),
+        mPool(other.mPool) {
+        other.mData = nullptr;
+        other.mSize = 0;
+        other.mCapacity = 0;
+    }
+
+    ByteBuffer& ByteBuffer::operator=(ByteBuffer&& other) noexcept {
+        if (this != &other) {
+            Free();
+            std::swap(mData, other.mData);
+            std::swap(mSize, other.mSize);
+            std::swap(mCapacity, other.mCapacity);
+            mPool = other.mPool;
+        }
+        return *this;
+    }
+
+    void ByteBuffer::Free() {
+        if (mData) {
+            mPool->Release(mData, mCapacity);
+            mData = nullptr;
+        }
+        mSize = 0;
+        mCapacity = 0;
+    }
+
+    void ByteBuffer::resize(size_t size) {
+        if (size <= mCapacity) {
+            mSize = size;
+            return;
+        }
+
+        if (!mPool) {
+            mPool = &ByteBufferPool::Default();
+        }
+
+        size_t capacity = 0;
+        auto data = mPool->Acquire(size, capacity);
+        if (mSize > 0) {
+            std::memcpy(data, mData, mSize);
+        }
+
+        Free();
+        mData = data;
+        mSize = size;
+        mCapacity = capacity;
+    }
+
+    void ByteBuffer::clear() {
+        Free();
+    }
+
+    bool ByteBuffer::operator==(const ByteBuffer& other) const {
+        return mSize == other.mSize &&
+            (mSize == 0 || std::memcmp(mData, other.mData, mSize) == 0);
+    }
+
+    ByteView ByteView::From(ByteBuffer&& bytes) {
+        auto owner = std::make_shared<ByteBuffer>(std::move(bytes));
+        return ByteView(owner->data(), owner->size(), owner);
+    }
+
+    ByteView ByteView::Slice(size_t offset, size_t size) const {
+        offset = std::min(offset, mSize);
+        size = std::min(size, mSize - offset);
+        return ByteView(mData + offset, size, mOwner);
+    }
+}
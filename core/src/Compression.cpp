@@ -0,0 +1,399 @@
+#include <okami/Compression.hpp>
+#include <okami/Parallel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+
+namespace okami::core {
+
+    constexpr size_t LZ4_MIN_MATCH = 4;
+    // The last 5 bytes of a block are always literals and the last
+    // match has to start at least 12 bytes before the end.
+    constexpr size_t LZ4_LAST_LITERALS = 5;
+    constexpr size_t LZ4_MATCH_LIMIT = 12;
+    constexpr size_t LZ4_MAX_OFFSET = 65535;
+    constexpr uint32_t LZ4_HASH_BITS = 12;
+
+    // Chunk sizes in a payload's table have this bit set if the chunk
+    // is stored uncompressed.
+    constexpr uint32_t CHUNK_STORED_BIT = 0x80000000u;
+    constexpr size_t PAYLOAD_HEADER_SIZE = 16;
+
+    inline uint32_t Read32(const uint8_t* ptr) {
+        uint32_t result;
+        std::memcpy(&result, ptr, sizeof(result));
+        return result;
+    }
+
+    inline uint32_t HashSequence(uint32_t sequence) {
+        return (sequence * 2654435761u) >> (32 - LZ4_HASH_BITS);
+    }
+
+    inline size_t LengthBytes(size_t length) {
+        return length >= 15 ? (length - 15) / 255 + 1 : 0;
+    }
+
+    inline uint8_t* WriteLength(uint8_t* op, size_t length) {
+        if (length >= 15) {
+            length -= 15;
+            while (length >= 255) {
+                *op++ = 255;
+                length -= 255;
+            }
+            *op++ = (uint8_t)length;
+        }
+        return op;
+    }
+
+    size_t LZ4CompressBound(size_t size) {
+        return size + size / 255 + 16;
+    }
+
+    size_t LZ4Compress(const uint8_t* src, size_t srcSize,
+        uint8_t* dst, size_t dstCapacity) {
+
+        uint8_t* op = dst;
+        uint8_t* const opEnd = dst + dstCapacity;
+        size_t anchor = 0;
+
+        if (srcSize > LZ4_MATCH_LIMIT) {
+            uint32_t table[1u << LZ4_HASH_BITS] = {};
+            size_t ip = 0;
+            size_t limit = srcSize - LZ4_MATCH_LIMIT;
+            size_t matchEnd = srcSize - LZ4_LAST_LITERALS;
+
+            while (ip < limit) {
+                auto sequence = Read32(&src[ip]);
+                auto hash = HashSequence(sequence);
+                size_t ref = table[hash];
+                table[hash] = (uint32_t)ip;
+
+                if (ref >= ip || ip - ref > LZ4_MAX_OFFSET ||
+                    Read32(&src[ref]) != sequence) {
+                    // Skip ahead faster through data that doesn't match
+                    ip += 1 + ((ip - anchor) >> 6);
+                    continue;
+                }
+
+                // Extend backwards into pending literals
+                while (ip > anchor && ref > 0 && src[ip - 1] == src[ref - 1]) {
+                    --ip;
+                    --ref;
+                }
+
+                size_t length = LZ4_MIN_MATCH;
+                while (ip + length < matchEnd &&
+                    src[ip + length] == src[ref + length]) {
+                    ++length;
+                }
+
+                size_t literals = ip - anchor;
+                size_t matchLength = length - LZ4_MIN_MATCH;
+                size_t needed = 1 + LengthBytes(literals) + literals +
+                    2 + LengthBytes(matchLength);
+
+                if ((size_t)(opEnd - op) < needed) {
+                    return 0;
+                }
+
+                uint8_t* token = op++;
+                *token = (uint8_t)(std::min<size_t>(literals, 15) << 4);
+                op = WriteLength(op, literals);
+                std::memcpy(op, &src[anchor], literals);
+                op += literals;
+
+                size_t offset = ip - ref;
+                *op++ = (uint8_t)(offset & 0xFF);
+                *op++ = (uint8_t)(offset >> 8);
+
+                *token |= (uint8_t)std::min<size_t>(matchLength, 15);
+                op = WriteLength(op, matchLength);
+
+                ip += length;
+                anchor = ip;
+
+                // Helps the next match find data that was just skipped
+                if (ip < limit) {
+                    table[HashSequence(Read32(&src[ip - 2]))] = (uint32_t)(ip - 2);
+                }
+            }
+        }
+
+        size_t literals = srcSize - anchor;
+        size_t needed = 1 + LengthBytes(literals) + literals;
+
+        if ((size_t)(opEnd - op) < needed) {
+            return 0;
+        }
+
+        *op++ = (uint8_t)(std::min<size_t>(literals, 15) << 4);
+        op = WriteLength(op, literals);
+        // Empty input may come with a null source
+        if (literals > 0) {
+            std::memcpy(op, &src[anchor], literals);
+        }
+        op += literals;
+
+        return op - dst;
+    }
+
+    bool LZ4Decompress(const uint8_t* src, size_t srcSize,
+        uint8_t* dst, size_t dstSize) {
+
+        size_t ip = 0;
+        size_t op = 0;
+
+        auto readLength = [&](size_t& length) {
+            if (length != 15) {
+                return true;
+            }
+
+            uint8_t byte;
+            do {
+                if (ip >= srcSize) {
+                    return false;
+                }
+                byte = src[ip++];
+                length += byte;
+            } while (byte == 255);
+
+            return true;
+        };
+
+        while (ip < srcSize) {
+            uint8_t token = src[ip++];
+
+            size_t literals = token >> 4;
+            if (!readLength(literals) ||
+                literals > srcSize - ip ||
+                literals > dstSize - op) {
+                return false;
+            }
+
+            if (literals > 0) {
+                std::memcpy(&dst[op], &src[ip], literals);
+            }
+            ip += literals;
+            op += literals;
+
+            // The last sequence has no match
+            if (ip == srcSize) {
+                break;
+            }
+
+            if (srcSize - ip < 2) {
+                return false;
+            }
+
+            size_t offset = src[ip] | ((size_t)src[ip + 1] << 8);
+            ip += 2;
+
+            if (offset == 0 || offset > op) {
+                return false;
+            }
+
+            size_t length = token & 15;
+            if (!readLength(length)) {
+                return false;
+            }
+            length += LZ4_MIN_MATCH;
+
+            if (length > dstSize - op) {
+                return false;
+            }
+
+            uint8_t* out = &dst[op];
+            const uint8_t* ref = out - offset;
+            if (offset >= length) {
+                std::memcpy(out, ref, length);
+            } else {
+                // Overlapping copies repeat the last offset bytes
+                for (size_t i = 0; i < length; ++i) {
+                    out[i] = ref[i];
+                }
+            }
+            op += length;
+        }
+
+        return op == dstSize;
+    }
+
+    // Payload layout, little endian:
+    //   uint64 uncompressed size
+    //   uint32 chunk size
+    //   uint32 chunk count
+    //   uint32 stored size of each chunk, CHUNK_STORED_BIT if raw
+    //   chunk data
+    void WriteChunkedPayload(std::vector<uint8_t>& out,
+        const uint8_t* data, size_t size,
+        const ChunkedPayloadParams& params) {
+
+        if (params.mChunkSize == 0 || params.mChunkSize >= CHUNK_STORED_BIT) {
+            throw std::runtime_error("Invalid payload chunk size!");
+        }
+
+        uint64_t rawSize = size;
+        uint32_t chunkSize = params.mChunkSize;
+        uint32_t chunkCount = (uint32_t)((size + chunkSize - 1) / chunkSize);
+
+        std::vector<std::vector<uint8_t>> compressed(chunkCount);
+        std::vector<uint32_t> sizes(chunkCount);
+
+        ParallelFor(chunkCount, [&](size_t i) {
+            size_t offset = i * chunkSize;
+            size_t length = std::min<size_t>(chunkSize, size - offset);
+
+            if (params.bCompress) {
+                auto& buffer = compressed[i];
+                buffer.resize(LZ4CompressBound(length));
+
+                // Only keep the compressed chunk if it actually shrank
+                auto compressedSize = LZ4Compress(&data[offset], length,
+                    buffer.data(), length - 1);
+
+                if (compressedSize > 0) {
+                    buffer.resize(compressedSize);
+                    sizes[i] = (uint32_t)compressedSize;
+                    return;
+                }
+
+                buffer = std::vector<uint8_t>();
+            }
+
+            sizes[i] = (uint32_t)length | CHUNK_STORED_BIT;
+        });
+
+        size_t total = PAYLOAD_HEADER_SIZE + chunkCount * sizeof(uint32_t);
+        for (auto chunk : sizes) {
+            total += chunk & ~CHUNK_STORED_BIT;
+        }
+
+        size_t cursor = out.size();
+        out.resize(cursor + total);
+        uint8_t* ptr = &out[cursor];
+
+        std::memcpy(ptr, &rawSize, sizeof(rawSize));
+        std::memcpy(ptr + 8, &chunkSize, sizeof(chunkSize));
+        std::memcpy(ptr + 12, &chunkCount, sizeof(chunkCount));
+        ptr += PAYLOAD_HEADER_SIZE;
+
+        if (chunkCount > 0) {
+            std::memcpy(ptr, sizes.data(), chunkCount * sizeof(uint32_t));
+            ptr += chunkCount * sizeof(uint32_t);
+        }
+
+        for (uint32_t i = 0; i < chunkCount; ++i) {
+            if (sizes[i] & CHUNK_STORED_BIT) {
+                size_t length = sizes[i] & ~CHUNK_STORED_BIT;
+                std::memcpy(ptr, &data[(size_t)i * chunkSize], length);
+                ptr += length;
+            } else {
+                std::memcpy(ptr, compressed[i].data(), sizes[i]);
+                ptr += sizes[i];
+            }
+        }
+    }
+
+    void WriteBlock(std::vector<uint8_t>& out, const std::string& block) {
+        uint32_t size = (uint32_t)block.size();
+        size_t cursor = out.size();
+        out.resize(cursor + sizeof(size) + block.size());
+        std::memcpy(&out[cursor], &size, sizeof(size));
+        std::memcpy(&out[cursor + sizeof(size)], block.data(), block.size());
+    }
+
+    uint64_t ChunkedPayloadReader::PeekSize() const {
+        if ((size_t)(mEnd - mCursor) < PAYLOAD_HEADER_SIZE) {
+            throw std::runtime_error("Truncated payload!");
+        }
+
+        uint64_t rawSize;
+        std::memcpy(&rawSize, mCursor, sizeof(rawSize));
+        return rawSize;
+    }
+
+    void ChunkedPayloadReader::Read(uint8_t* dst, size_t dstSize) {
+        if (PeekSize() != dstSize) {
+            throw std::runtime_error("Payload size does not match destination!");
+        }
+
+        uint32_t chunkSize;
+        uint32_t chunkCount;
+        std::memcpy(&chunkSize, mCursor + 8, sizeof(chunkSize));
+        std::memcpy(&chunkCount, mCursor + 12, sizeof(chunkCount));
+
+        const uint8_t* ptr = mCursor + PAYLOAD_HEADER_SIZE;
+        if (chunkSize == 0 ||
+            (uint64_t)chunkSize * chunkCount < dstSize ||
+            (uint64_t)chunkSize * chunkCount >= (uint64_t)dstSize + chunkSize ||
+            (size_t)(mEnd - ptr) < chunkCount * sizeof(uint32_t)) {
+            throw std::runtime_error("Corrupt payload header!");
+        }
+
+        const uint8_t* data = ptr + chunkCount * sizeof(uint32_t);
+
+        for (uint32_t i = 0; i < chunkCount; ++i) {
+            uint32_t stored = Read32(ptr + i * sizeof(uint32_t));
+
+            Chunk chunk;
+            chunk.bStored = (stored & CHUNK_STORED_BIT) != 0;
+            chunk.mSrcSize = stored & ~CHUNK_STORED_BIT;
+            chunk.mSrc = data;
+            chunk.mDst = dst + (size_t)i * chunkSize;
+            chunk.mDstSize = (uint32_t)std::min<size_t>(chunkSize,
+                dstSize - (size_t)i * chunkSize);
+
+            if ((size_t)(mEnd - data) < chunk.mSrcSize ||
+                (chunk.bStored && chunk.mSrcSize != chunk.mDstSize)) {
+                throw std::runtime_error("Corrupt payload chunk table!");
+            }
+
+            data += chunk.mSrcSize;
+            mChunks.emplace_back(chunk);
+        }
+
+        mCursor = data;
+    }
+
+    std::string ChunkedPayloadReader::ReadBlock() {
+        uint32_t size;
+        if ((size_t)(mEnd - mCursor) < sizeof(size)) {
+            throw std::runtime_error("Truncated block!");
+        }
+        std::memcpy(&size, mCursor, sizeof(size));
+
+        auto begin = (const char*)(mCursor + sizeof(size));
+        Skip(sizeof(size) + (size_t)size);
+        return std::string(begin, size);
+    }
+
+    void ChunkedPayloadReader::Skip(size_t size) {
+        if ((size_t)(mEnd - mCursor) < size) {
+            throw std::runtime_error("Truncated payload!");
+        }
+        mCursor += size;
+    }
+
+    void ChunkedPayloadReader::Flush() {
+        std::atomic<bool> bFailed = false;
+
+        ParallelFor(mChunks.size(), [this, &bFailed](size_t i) {
+            auto& chunk = mChunks[i];
+
+            if (chunk.bStored) {
+                std::memcpy(chunk.mDst, chunk.mSrc, chunk.mSrcSize);
+            } else if (!LZ4Decompress(chunk.mSrc, chunk.mSrcSize,
+                chunk.mDst, chunk.mDstSize)) {
+                bFailed = true;
+            }
+        });
+
+        mChunks.clear();
+
+        if (bFailed) {
+            throw std::runtime_error("Corrupt compressed payload!");
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#include <okami/EmbeddedMesh.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace okami::core {
+
+    EmbeddedMesh EmbeddedMesh::From(const uint8_t* begin, const uint8_t* end) {
+        size_t size = end - begin;
+        if (size < sizeof(EmbeddedMeshHeader)) {
+            throw std::runtime_error("Embedded mesh is too small!");
+        }
+        if (reinterpret_cast<uintptr_t>(begin) % alignof(float) != 0) {
+            throw std::runtime_error("Embedded mesh is misaligned!");
+        }
+
+        EmbeddedMesh result;
+        std::memcpy(&result.mHeader, begin, sizeof(EmbeddedMeshHeader));
+
+        const auto& header = result.mHeader;
+        if (header.mMagic != EMBEDDED_MESH_MAGIC) {
+            throw std::runtime_error("Not an embedded mesh!");
+        }
+        if (header.mVersion != EMBEDDED_MESH_VERSION) {
+            throw std::runtime_error("Embedded mesh has an unsupported version!");
+        }
+
+        uint64_t vertexFloats = 14 * (uint64_t)header.mVertexCount;
+        uint64_t expected = sizeof(EmbeddedMeshHeader) +
+            4 * (vertexFloats + header.mIndexCount);
+        if (size < expected) {
+            throw std::runtime_error("Embedded mesh is truncated!");
+        }
+
+        auto floats = reinterpret_cast<const float*>(begin + sizeof(EmbeddedMeshHeader));
+        size_t vertexCount = header.mVertexCount;
+        result.mPositions = floats;
+        result.mUVs = result.mPositions + 3 * vertexCount;
+        result.mNormals = result.mUVs + 2 * vertexCount;
+        result.mTangents = result.mNormals + 3 * vertexCount;
+        result.mBitangents = result.mTangents + 3 * vertexCount;
+        result.mIndices = reinterpret_cast<const uint32_t*>(
+            result.mBitangents + 3 * vertexCount);
+        return result;
+    }
+
+    void EmbeddedMesh::Write(std::ostream& out) const {
+        size_t vertexCount = mHeader.mVertexCount;
+
+        auto write = [&out](const void* data, size_t size) {
+            out.write(reinterpret_cast<const char*>(data), size);
+        };
+
+        write(&mHeader, sizeof(EmbeddedMeshHeader));
+        write(mPositions, 3 * vertexCount * sizeof(float));
+        write(mUVs, 2 * vertexCount * sizeof(float));
+        write(mNormals, 3 * vertexCount * sizeof(float));
+        write(mTangents, 3 * vertexCount * sizeof(float));
+        write(mBitangents, 3 * vertexCount * sizeof(float));
+        write(mIndices, mHeader.mIndexCount * sizeof(uint32_t));
+
+        if (!out) {
+            throw std::runtime_error("Failed to write embedded mesh!");
+        }
+    }
+}
@@ -0,0 +1,180 @@
+#include <okami/Eviction.hpp>
+
+#include <algorithm>
+
+namespace okami::core {
+
+    void EvictionManager::Add(resource_id_t id,
+        IEvictionBackend* backend, uint64_t bytes) {
+        marl::lock lock(mMutex);
+
+        auto entry = mEntries.TryGet(id);
+        if (!entry) {
+            Entry newEntry;
+            newEntry.mBackend = backend;
+            newEntry.mBytes = bytes;
+            newEntry.mLastUse = mFrame;
+            mEntries.Add(id, std::move(newEntry));
+            mResidentBytes += bytes;
+            return;
+        }
+
+        if (entry->bResident) {
+            mResidentBytes -= entry->mBytes;
+        }
+
+        // Coming back from a reload counts as a use, otherwise it could
+        // be evicted again right away.
+        entry->mBackend = backend;
+        entry->mBytes = bytes;
+        entry->mLastUse = mFrame;
+        entry->bResident = true;
+        entry->bReloadRequested = false;
+        mResidentBytes += bytes;
+    }
+
+    void EvictionManager::Resize(resource_id_t id, uint64_t bytes) {
+        marl::lock lock(mMutex);
+
+        auto entry = mEntries.TryGet(id);
+        if (entry && entry->bResident) {
+            mResidentBytes -= entry->mBytes;
+            entry->mBytes = bytes;
+            mResidentBytes += bytes;
+        }
+    }
+
+    void EvictionManager::Remove(resource_id_t id) {
+        marl::lock lock(mMutex);
+
+        auto entry = mEntries.TryGet(id);
+        if (entry) {
+            if (entry->bResident) {
+                mResidentBytes -= entry->mBytes;
+            }
+            mEntries.Remove(id);
+        }
+    }
+
+    bool EvictionManager::Contains(resource_id_t id) const {
+        marl::lock lock(mMutex);
+        return mEntries.Contains(id);
+    }
+
+    void EvictionManager::SetPinned(resource_id_t id, bool pinned) {
+        marl::lock lock(mMutex);
+
+        auto entry = mEntries.TryGet(id);
+        if (entry) {
+            entry->bPinned = pinned;
+        }
+    }
+
+    void EvictionManager::Touch(resource_id_t id) {
+        marl::lock lock(mMutex);
+
+        auto entry = mEntries.TryGet(id);
+        if (!entry) {
+            return;
+        }
+
+        entry->mLastUse = mFrame;
+
+        if (!entry->bResident && !entry->bReloadRequested) {
+            entry->bReloadRequested = true;
+            mPendingReloads.emplace_back(id);
+        }
+    }
+
+    void EvictionManager::Update() {
+        std::vector<std::pair<resource_id_t, IEvictionBackend*>> reloads;
+        std::vector<std::pair<resource_id_t, IEvictionBackend*>> evictions;
+
+        {
+            marl::lock lock(mMutex);
+
+            ++mFrame;
+
+            for (auto id : mPendingReloads) {
+                auto entry = mEntries.TryGet(id);
+                if (entry && !entry->bResident) {
+                    reloads.emplace_back(id, entry->mBackend);
+                    ++mReloadCount;
+                }
+            }
+            mPendingReloads.clear();
+
+            if (mResidentBytes > mParams.mBudget) {
+                std::vector<std::pair<resource_id_t, Entry*>> candidates;
+
+                mEntries.ForEach([&](resource_id_t id, Entry& entry) {
+                    if (entry.bResident && !entry.bPinned &&
+                        mFrame - entry.mLastUse > mParams.mMinIdleFrames) {
+                        candidates.emplace_back(id, &entry);
+                    }
+                });
+
+                // Least recently used first, larger resources first
+                // among those used in the same frame
+                std::sort(candidates.begin(), candidates.end(),
+                    [](const auto& a, const auto& b) {
+                    if (a.second->mLastUse != b.second->mLastUse) {
+                        return a.second->mLastUse < b.second->mLastUse;
+                    }
+                    return a.second->mBytes > b.second->mBytes;
+                });
+
+                for (auto& [id, entry] : candidates) {
+                    if (mResidentBytes <= mParams.mBudget ||
+                        evictions.size() >= mParams.mMaxEvictionsPerUpdate) {
+                        break;
+                    }
+
+                    entry->bResident = false;
+                    mResidentBytes -= entry->mBytes;
+                    evictions.emplace_back(id, entry->mBackend);
+                    ++mEvictionCount;
+                }
+            }
+        }
+
+        // Backends may call back into the manager
+        for (auto& [id, backend] : evictions) {
+            backend->Evict(id);
+        }
+        for (auto& [id, backend] : reloads) {
+            backend->Reload(id);
+        }
+    }
+
+    void EvictionManager::SetBudget(uint64_t bytes) {
+        marl::lock lock(mMutex);
+        mParams.mBudget = bytes;
+    }
+
+    uint64_t EvictionManager::GetBudget() const {
+        marl::lock lock(mMutex);
+        return mParams.mBudget;
+    }
+
+    uint64_t EvictionManager::GetResidentBytes() const {
+        marl::lock lock(mMutex);
+        return mResidentBytes;
+    }
+
+    bool EvictionManager::IsResident(resource_id_t id) const {
+        marl::lock lock(mMutex);
+        auto entry = mEntries.TryGet(id);
+        return entry && entry->bResident;
+    }
+
+    uint64_t EvictionManager::GetEvictionCount() const {
+        marl::lock lock(mMutex);
+        return mEvictionCount;
+    }
+
+    uint64_t EvictionManager::GetReloadCount() const {
+        marl::lock lock(mMutex);
+        return mReloadCount;
+    }
+}
@@ -1,157 +1,228 @@
 #include <okami/Geometry.hpp>
+#include <okami/AssimpImport.hpp>
+#include <okami/MeshOptimizer.hpp>
+#include <okami/VirtualFileSystem.hpp>
+#include <okami/EmbeddedMesh.hpp>
+#include <okami/Incbin.hpp>
+
+#include <marl/mutex.h>
+
+#if OKAMI_HAS_INCBIN
+OKAMI_INCBIN(okami_matball_mesh, OKAMI_EMBED_DIR "matballmesh.bin");
+OKAMI_INCBIN(okami_box_mesh, OKAMI_EMBED_DIR "boxmesh.bin");
+OKAMI_INCBIN(okami_bunny_mesh, OKAMI_EMBED_DIR "bunnymesh.bin");
+OKAMI_INCBIN(okami_monkey_mesh, OKAMI_EMBED_DIR "monkeymesh.bin");
+OKAMI_INCBIN(okami_plane_mesh, OKAMI_EMBED_DIR "planemesh.bin");
+OKAMI_INCBIN(okami_sphere_mesh, OKAMI_EMBED_DIR "spheremesh.bin");
+OKAMI_INCBIN(okami_torus_mesh, OKAMI_EMBED_DIR "torusmesh.bin");
+OKAMI_INCBIN(okami_teapot_mesh, OKAMI_EMBED_DIR "teapotmesh.bin");
+#else
+// Written from the same blobs by core/CMakeLists.txt
+#include <embed/matballmesh.inc>
+#include <embed/boxmesh.inc>
+#include <embed/bunnymesh.inc>
+#include <embed/monkeymesh.inc>
+#include <embed/planemesh.inc>
+#include <embed/spheremesh.inc>
+#include <embed/torusmesh.inc>
+#include <embed/teapotmesh.inc>
+#endif
+
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/vector.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
 
-namespace matball {
-	#include <embed/matballmesh.hpp>
-}
-
-namespace box {
-	#include <embed/boxmesh.hpp>
-}
+using namespace entt;
 
-namespace bunny {
-	#include <embed/bunnymesh.hpp>
-}
+namespace okami::core {
 
-namespace monkey {
-	#include <embed/monkeymesh.hpp>
-}
+	namespace {
+		// Prefabs packed for every vertex format they were asked for.
+		// Packing is what's expensive. The packed buffers are copied for
+		// every Geometry handed out, resource managers share one of them
+		// per prefab and format.
+		class PrefabCache {
+		private:
+			marl::mutex mMutex;
+			std::map<std::pair<const uint8_t*, std::string>,
+				std::shared_ptr<const Geometry::RawData>> mEntries;
+
+		public:
+			// Formats have no comparison of their own, their serialized
+			// form stands in for one
+			static std::string GetLayoutKey(const VertexFormat& layout) {
+				std::ostringstream stream;
+				{
+					cereal::BinaryOutputArchive archive(stream);
+					archive(layout);
+				}
+				return stream.str();
+			}
 
-namespace plane {
-	#include <embed/planemesh.hpp>
-}
+			Geometry Get(const uint8_t* begin,
+				const uint8_t* end,
+				const VertexFormat& layout) {
 
-namespace sphere {
-	#include <embed/spheremesh.hpp>
-}
+				auto key = std::make_pair(begin, GetLayoutKey(layout));
 
-namespace torus {
-	#include <embed/torusmesh.hpp>
-}
+				std::shared_ptr<const Geometry::RawData> entry;
+				{
+					marl::lock lock(mMutex);
+					auto it = mEntries.find(key);
+					if (it != mEntries.end()) {
+						entry = it->second;
+					}
+				}
 
-namespace teapot {
-	#include <embed/teapotmesh.hpp>
-}
+				// Two threads may both pack the same prefab, the first
+				// one to finish is kept
+				if (!entry) {
+					auto mesh = EmbeddedMesh::From(begin, end);
+
+					Geometry::RawData data;
+					data.Pack(layout, Geometry::DataSource
+						<uint32_t, float, float, float>(
+						mesh.mHeader.mVertexCount,
+						mesh.mHeader.mIndexCount,
+						mesh.mIndices,
+						mesh.mPositions,
+						mesh.mUVs,
+						mesh.mNormals,
+						mesh.mTangents,
+						mesh.mBitangents));
+
+					marl::lock lock(mMutex);
+					entry = mEntries.emplace(key,
+						std::make_shared<const Geometry::RawData>(
+							std::move(data))).first->second;
+				}
 
-#include <assimp/postprocess.h>
-#include <assimp/Importer.hpp>
-#include <assimp/scene.h>
+				return Geometry(Geometry::RawData(*entry));
+			}
 
-#include <iostream>
+			Handle<Geometry> Get(ResourceManager& resources,
+				const char* name,
+				const uint8_t* begin,
+				const uint8_t* end,
+				const VertexFormat& layout) {
+
+				auto key = std::string("okami/prefabs/") + name + "/" +
+					GetLayoutKey(layout);
+				return resources.GetOrAdd<Geometry>(key, [&]() {
+					return Get(begin, end, layout);
+				});
+			}
 
-using namespace entt;
+			void Clear() {
+				marl::lock lock(mMutex);
+				mEntries.clear();
+			}
+		};
 
-namespace okami::core {
+		PrefabCache& GetPrefabCache() {
+			static PrefabCache cache;
+			return cache;
+		}
+	}
 
-    Geometry Geometry::Prefabs::MaterialBall(const VertexFormat& layout) {
-		return Geometry(layout, 
-			Geometry::DataSource
-				<uint32_t, float, float, float>(
-				matball::mVertexCount,
-				matball::mIndexCount,
-				matball::mIndices,
-				matball::mPositions,
-				matball::mUVs,
-				matball::mNormals,
-				matball::mTangents,
-				matball::mBitangents));
+	Geometry Geometry::Prefabs::MaterialBall(const VertexFormat& layout) {
+		return GetPrefabCache().Get(
+			g_okami_matball_mesh_data, g_okami_matball_mesh_end, layout);
 	}
 
 	Geometry Geometry::Prefabs::Box(const VertexFormat& layout) {
-		return Geometry(layout, 
-			Geometry::DataSource
-				<uint32_t, float, float, float>(
-				box::mVertexCount,
-				box::mIndexCount,
-				box::mIndices,
-				box::mPositions,
-				box::mUVs,
-				box::mNormals,
-				box::mTangents,
-				box::mBitangents));
+		return GetPrefabCache().Get(
+			g_okami_box_mesh_data, g_okami_box_mesh_end, layout);
 	}
 
 	Geometry Geometry::Prefabs::Sphere(const VertexFormat& layout) {
-		return Geometry(layout, 
-			Geometry::DataSource
-				<uint32_t, float, float, float>(
-				sphere::mVertexCount,
-				sphere::mIndexCount,
-				sphere::mIndices,
-				sphere::mPositions,
-				sphere::mUVs,
-				sphere::mNormals,
-				sphere::mTangents,
-				sphere::mBitangents));
+		return GetPrefabCache().Get(
+			g_okami_sphere_mesh_data, g_okami_sphere_mesh_end, layout);
 	}
 
 	Geometry Geometry::Prefabs::BlenderMonkey(const VertexFormat& layout) {
-		return Geometry(layout, 
-			Geometry::DataSource
-				<uint32_t, float, float, float>(
-				monkey::mVertexCount,
-				monkey::mIndexCount,
-				monkey::mIndices,
-				monkey::mPositions,
-				monkey::mUVs,
-				monkey::mNormals,
-				monkey::mTangents,
-				monkey::mBitangents));
+		return GetPrefabCache().Get(
+			g_okami_monkey_mesh_data, g_okami_monkey_mesh_end, layout);
 	}
 
 	Geometry Geometry::Prefabs::Torus(const VertexFormat& layout) {
-		return Geometry(layout, 
-			Geometry::DataSource
-				<uint32_t, float, float, float>(
-				torus::mVertexCount,
-				torus::mIndexCount,
-				torus::mIndices,
-				torus::mPositions,
-				torus::mUVs,
-				torus::mNormals,
-				torus::mTangents,
-				torus::mBitangents));
+		return GetPrefabCache().Get(
+			g_okami_torus_mesh_data, g_okami_torus_mesh_end, layout);
 	}
 
 	Geometry Geometry::Prefabs::Plane(const VertexFormat& layout) {
-		return Geometry(layout, 
-			Geometry::DataSource
-				<uint32_t, float, float, float>(
-				plane::mVertexCount,
-				plane::mIndexCount,
-				plane::mIndices,
-				plane::mPositions,
-				plane::mUVs,
-				plane::mNormals,
-				plane::mTangents,
-				plane::mBitangents));
+		return GetPrefabCache().Get(
+			g_okami_plane_mesh_data, g_okami_plane_mesh_end, layout);
 	}
 
 	Geometry Geometry::Prefabs::StanfordBunny(const VertexFormat& layout) {
-		return Geometry(layout, 
-			Geometry::DataSource
-				<uint32_t, float, float, float>(
-				bunny::mVertexCount,
-				bunny::mIndexCount,
-				bunny::mIndices,
-				bunny::mPositions,
-				bunny::mUVs,
-				bunny::mNormals,
-				bunny::mTangents,
-				bunny::mBitangents));
+		return GetPrefabCache().Get(
+			g_okami_bunny_mesh_data, g_okami_bunny_mesh_end, layout);
 	}
 
 	Geometry Geometry::Prefabs::UtahTeapot(const VertexFormat& layout) {
-		return Geometry(layout, 
-			Geometry::DataSource
-				<uint32_t, float, float, float>(
-				teapot::mVertexCount,
-				teapot::mIndexCount,
-				teapot::mIndices,
-				teapot::mPositions,
-				teapot::mUVs,
-				teapot::mNormals,
-				teapot::mTangents,
-				teapot::mBitangents));
+		return GetPrefabCache().Get(
+			g_okami_teapot_mesh_data, g_okami_teapot_mesh_end, layout);
+	}
+
+	Handle<Geometry> Geometry::Prefabs::MaterialBall(ResourceManager& resources,
+		const VertexFormat& layout) {
+		return GetPrefabCache().Get(resources, "MaterialBall",
+			g_okami_matball_mesh_data, g_okami_matball_mesh_end, layout);
+	}
+
+	Handle<Geometry> Geometry::Prefabs::Box(ResourceManager& resources,
+		const VertexFormat& layout) {
+		return GetPrefabCache().Get(resources, "Box",
+			g_okami_box_mesh_data, g_okami_box_mesh_end, layout);
+	}
+
+	Handle<Geometry> Geometry::Prefabs::Sphere(ResourceManager& resources,
+		const VertexFormat& layout) {
+		return GetPrefabCache().Get(resources, "Sphere",
+			g_okami_sphere_mesh_data, g_okami_sphere_mesh_end, layout);
+	}
+
+	Handle<Geometry> Geometry::Prefabs::BlenderMonkey(ResourceManager& resources,
+		const VertexFormat& layout) {
+		return GetPrefabCache().Get(resources, "BlenderMonkey",
+			g_okami_monkey_mesh_data, g_okami_monkey_mesh_end, layout);
+	}
+
+	Handle<Geometry> Geometry::Prefabs::Torus(ResourceManager& resources,
+		const VertexFormat& layout) {
+		return GetPrefabCache().Get(resources, "Torus",
+			g_okami_torus_mesh_data, g_okami_torus_mesh_end, layout);
+	}
+
+	Handle<Geometry> Geometry::Prefabs::Plane(ResourceManager& resources,
+		const VertexFormat& layout) {
+		return GetPrefabCache().Get(resources, "Plane",
+			g_okami_plane_mesh_data, g_okami_plane_mesh_end, layout);
+	}
+
+	Handle<Geometry> Geometry::Prefabs::StanfordBunny(ResourceManager& resources,
+		const VertexFormat& layout) {
+		return GetPrefabCache().Get(resources, "StanfordBunny",
+			g_okami_bunny_mesh_data, g_okami_bunny_mesh_end, layout);
+	}
+
+	Handle<Geometry> Geometry::Prefabs::UtahTeapot(ResourceManager& resources,
+		const VertexFormat& layout) {
+		return GetPrefabCache().Get(resources, "UtahTeapot",
+			g_okami_teapot_mesh_data, g_okami_teapot_mesh_end, layout);
+	}
+
+	void Geometry::Prefabs::ClearCache() {
+		GetPrefabCache().Clear();
 	}
 
     entt::meta_type Geometry::GetType() const {
@@ -163,38 +234,6 @@ namespace okami::core {
             .type("Geometry"_hs);
     }
 
-    template <>
-	struct V3Packer<aiVector3D> {
-		static constexpr size_t Stride = 1;
-
-		inline static void Pack(float* dest, const aiVector3D* src) {
-			dest[0] = src->x;
-			dest[1] = src->y;
-			dest[2] = src->z;
-		}
-	};
-
-	template <>
-	struct V2Packer<aiVector3D> {
-		static constexpr size_t Stride = 1;
-
-		inline static void Pack(float* dest, const aiVector3D* src) {
-			dest[0] = src->x;
-			dest[1] = src->y;
-		}
-	};
-
-	template <>
-	struct I3Packer<aiFace> {
-		static constexpr size_t Stride = 1;
-
-		inline static void Pack(uint32_t* dest, const aiFace* src) {
-			dest[0] = src->mIndices[0];
-			dest[1] = src->mIndices[1];
-			dest[2] = src->mIndices[2];
-		}
-	};
-
     void ComputeLayoutProperties(
 		size_t vertex_count,
 		const VertexFormat& layout,
@@ -282,15 +321,19 @@ namespace okami::core {
         auto& layoutElements = layout.mElements;	
         ComputeLayoutProperties(vertex_count, layout, offsets, strides, indexing.mChannelSizes);
 
-        auto verifyAttrib = [](const LayoutElement& element) {
-            if (element.mValueType != ValueType::FLOAT32) {
-                throw std::runtime_error("Attribute type must be VT_FLOAT32!");
-            }
+        // Bytes per vertex that Pack writes into each channel
+        std::vector<size_t> written(indexing.mChannelSizes.size(), 0);
+
+        auto verifyAttrib = [&written](const LayoutElement& element,
+            uint components, bool bIsPosition = false) {
+            ValidateEncoding(element, components, bIsPosition);
+            written[element.mBufferSlot] += 
+                GetSize(element.mValueType) * element.mNumComponents;
         };
 
         if (layout.mPosition >= 0) {
             auto& posAttrib = layoutElements[layout.mPosition];
-            verifyAttrib(posAttrib);
+            verifyAttrib(posAttrib, 3, true);
             indexing.mPositionOffset = offsets[layout.mPosition];
             indexing.mPositionChannel = posAttrib.mBufferSlot;
             indexing.mPositionStride = strides[layout.mPosition];
@@ -298,7 +341,7 @@ namespace okami::core {
 
         for (auto& uv : layout.mUVs) {
             auto& uvAttrib = layoutElements[uv];
-            verifyAttrib(uvAttrib);
+            verifyAttrib(uvAttrib, 2);
             indexing.mUVOffsets.emplace_back((int)offsets[uv]);
             indexing.mUVChannels.emplace_back(uvAttrib.mBufferSlot);
             indexing.mUVStrides.emplace_back(strides[uv]);
@@ -306,7 +349,7 @@ namespace okami::core {
 
         if (layout.mNormal >= 0) {
             auto& normalAttrib = layoutElements[layout.mNormal];
-            verifyAttrib(normalAttrib);
+            verifyAttrib(normalAttrib, 3);
             indexing.mNormalOffset = offsets[layout.mNormal];
             indexing.mNormalChannel = normalAttrib.mBufferSlot;
             indexing.mNormalStride = strides[layout.mNormal];
@@ -314,7 +357,7 @@ namespace okami::core {
 
         if (layout.mTangent >= 0) {
             auto& tangentAttrib = layoutElements[layout.mTangent];
-            verifyAttrib(tangentAttrib);
+            verifyAttrib(tangentAttrib, 3);
             indexing.mTangentOffset = offsets[layout.mTangent];
             indexing.mTangentChannel = tangentAttrib.mBufferSlot;
             indexing.mTangentStride = strides[layout.mTangent];
@@ -322,7 +365,7 @@ namespace okami::core {
 
         if (layout.mBitangent >= 0) {
             auto& bitangentAttrib = layoutElements[layout.mBitangent];
-            verifyAttrib(bitangentAttrib);
+            verifyAttrib(bitangentAttrib, 3);
             indexing.mBitangentOffset = offsets[layout.mBitangent];
             indexing.mBitangentChannel = bitangentAttrib.mBufferSlot;
             indexing.mBitangentStride = strides[layout.mBitangent];
@@ -330,60 +373,175 @@ namespace okami::core {
 
         for (auto& color : layout.mColors) {
             auto& colorAttrib = layoutElements[color];
-            verifyAttrib(colorAttrib);
+            verifyAttrib(colorAttrib, 4);
             indexing.mColorOffsets.emplace_back(offsets[color]);
             indexing.mColorChannels.emplace_back(colorAttrib.mBufferSlot);
             indexing.mColorStrides.emplace_back(strides[color]);
         }
 
+        for (size_t i = 0; i < written.size(); ++i) {
+            indexing.mChannelHasGaps.emplace_back(
+                written[i] * vertex_count != indexing.mChannelSizes[i]);
+        }
+
         return indexing;
     }
 
-    Geometry::RawData Geometry::RawData::Load(
-        const std::filesystem::path& path,
+    constexpr uint32_t COOKED_GEOMETRY_MAGIC = 0x4D474B4F; // "OKGM"
+    constexpr uint32_t COOKED_GEOMETRY_VERSION = 4;
+
+    static bool IsSameLayout(const VertexFormat& a, const VertexFormat& b) {
+        if (a.mElements.size() != b.mElements.size() ||
+            a.mPosition != b.mPosition ||
+            a.mNormal != b.mNormal ||
+            a.mTangent != b.mTangent ||
+            a.mBitangent != b.mBitangent ||
+            a.mTopology != b.mTopology ||
+            a.mUVs != b.mUVs ||
+            a.mColors != b.mColors) {
+            return false;
+        }
+
+        for (size_t i = 0; i < a.mElements.size(); ++i) {
+            auto& x = a.mElements[i];
+            auto& y = b.mElements[i];
+
+            if (x.mInputIndex != y.mInputIndex ||
+                x.mBufferSlot != y.mBufferSlot ||
+                x.mNumComponents != y.mNumComponents ||
+                x.mValueType != y.mValueType ||
+                x.bIsNormalized != y.bIsNormalized ||
+                x.mRelativeOffset != y.mRelativeOffset ||
+                x.mStride != y.mStride ||
+                x.mFrequency != y.mFrequency ||
+                x.mInstanceDataStepRate != y.mInstanceDataStepRate ||
+                x.mEncoding != y.mEncoding) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void Geometry::RawData::Save(std::vector<uint8_t>& out,
+        const ChunkedPayloadParams& params) const {
+
+        std::ostringstream header;
+        {
+            cereal::BinaryOutputArchive archive(header);
+            archive(COOKED_GEOMETRY_MAGIC);
+            archive(COOKED_GEOMETRY_VERSION);
+            archive(mDesc);
+            archive(mBoundingBox.mLower.x, mBoundingBox.mLower.y, mBoundingBox.mLower.z);
+            archive(mBoundingBox.mUpper.x, mBoundingBox.mUpper.y, mBoundingBox.mUpper.z);
+            archive(mMeshlets);
+            archive(mLods);
+            archive((uint32_t)mVertexBuffers.size());
+        }
+
+        WriteBlock(out, header.str());
+
+        for (auto& buffer : mVertexBuffers) {
+            WriteChunkedPayload(out, buffer.mBytes.data(), buffer.mBytes.size(), params);
+        }
+        WriteChunkedPayload(out, mIndexBuffer.mBytes.data(), 
+            mIndexBuffer.mBytes.size(), params);
+    }
+
+    void Geometry::RawData::Save(const std::filesystem::path& path,
+        const ChunkedPayloadParams& params) const {
+
+        std::vector<uint8_t> bytes;
+        Save(bytes, params);
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file || !file.write((const char*)bytes.data(), bytes.size())) {
+            throw std::runtime_error("Failed to write " + path.string());
+        }
+    }
+
+    static Geometry::RawData LoadCooked(
+        const ByteView& bytes,
         const VertexFormat& layout) {
 
-        Assimp::Importer importer;
+        ChunkedPayloadReader reader(bytes.data(), bytes.size());
+        Geometry::RawData result;
+        uint32_t bufferCount = 0;
+
+        {
+            std::istringstream header(reader.ReadBlock());
+            cereal::BinaryInputArchive archive(header);
 
-        unsigned int flags = aiProcess_Triangulate | aiProcess_GenSmoothNormals | 
-            aiProcess_FlipUVs | aiProcess_JoinIdenticalVertices |
-            aiProcess_GenUVCoords | aiProcess_CalcTangentSpace | 
-            aiProcess_ConvertToLeftHanded | aiProcessPreset_TargetRealtime_Quality;
+            uint32_t magic = 0;
+            uint32_t version = 0;
+            archive(magic);
+            archive(version);
+
+            if (magic != COOKED_GEOMETRY_MAGIC || 
+                version != COOKED_GEOMETRY_VERSION) {
+                throw std::runtime_error("Not a cooked geometry or unsupported version!");
+            }
 
-        const aiScene* scene = importer.ReadFile(path.string().c_str(), flags);
-        
-        if (!scene) {
-            std::cout << importer.GetErrorString() << std::endl;
-            throw std::runtime_error("Failed to load geometry!");
+            auto& box = result.mBoundingBox;
+            archive(result.mDesc);
+            archive(box.mLower.x, box.mLower.y, box.mLower.z);
+            archive(box.mUpper.x, box.mUpper.y, box.mUpper.z);
+            archive(result.mMeshlets);
+            archive(result.mLods);
+            archive(bufferCount);
         }
 
-        if (!scene->HasMeshes()) {
-            throw std::runtime_error("Geometry has no meshes!");
+        if (!IsSameLayout(result.mDesc.mLayout, layout)) {
+            throw std::runtime_error("Cooked geometry was packed with a different vertex layout!");
         }
 
-        size_t nVerts;
-		size_t nIndices;
+        // Every buffer is queued before decoding so that all of their
+        // chunks are decompressed in parallel
+        auto readBuffer = [&reader](BufferData& buffer) {
+            buffer.mBytes.resize(reader.PeekSize());
+            buffer.mDesc.mSizeInBytes = (uint32_t)buffer.mBytes.size();
+            reader.Read(buffer.mBytes.data(), buffer.mBytes.size());
+        };
 
-		if (!scene->HasMeshes()) {
-			throw std::runtime_error("Assimp scene has no meshes!");
-		}
+        result.mVertexBuffers.resize(bufferCount);
+        for (auto& buffer : result.mVertexBuffers) {
+            readBuffer(buffer);
+        }
+        readBuffer(result.mIndexBuffer);
 
-		aiMesh* mesh = scene->mMeshes[0];
+        reader.Flush();
+        return result;
+    }
 
-		nVerts = mesh->mNumVertices;
-		nIndices = mesh->mNumFaces * 3;
+    Geometry::RawData Geometry::RawData::Load(
+        const std::filesystem::path& path,
+        const VertexFormat& layout,
+        const MeshOptimizeParams& optimizeParams) {
 
-        Geometry::DataSource<aiFace, aiVector3D, aiVector3D> data(
-			nVerts, nIndices,
-			mesh->mFaces,
-			mesh->mVertices,
-			mesh->mTextureCoords[0],
-			mesh->mNormals,
-			mesh->mTangents,
-			mesh->mBitangents);
+        return Load(path, VirtualFileSystem::Default().Read(path), layout,
+            optimizeParams);
+    }
 
-        Geometry::RawData result;
-		result.Pack<aiFace, aiVector3D, aiVector3D>(layout, data);
+    Geometry::RawData Geometry::RawData::Load(
+        const std::filesystem::path& path,
+        const ByteView& bytes,
+        const VertexFormat& layout,
+        const MeshOptimizeParams& optimizeParams) {
+
+        if (path.extension() == ".okgeo") {
+            return LoadCooked(bytes, layout);
+        }
+
+        auto scene = ReadAssimpScene(path, bytes);
+
+        if (!scene->HasMeshes()) {
+            throw std::runtime_error("Geometry has no meshes!");
+        }
+
+        auto result = ToRawData(scene->mMeshes[0], layout);
+        scene.reset();
+
+        OptimizeMesh(result, optimizeParams);
         return result;
     }
 
@@ -399,6 +557,16 @@ namespace okami::core {
 		}
 	}
 
+	size_t Geometry::GetCPUByteSize() const {
+		size_t result = mData.mIndexBuffer.mBytes.size();
+		for (auto& buffer : mData.mVertexBuffers) {
+			result += buffer.mBytes.size();
+		}
+		result += mData.mMeshlets.size() * sizeof(Meshlet);
+		result += mData.mLods.size() * sizeof(MeshLod);
+		return result;
+	}
+
 	const LoadParams<Geometry>& Geometry::GetLoadParams() const {
 		if (mLoadData) {
 			return mLoadData->mParams;
@@ -407,10 +575,93 @@ namespace okami::core {
 		}
 	}
 
+	std::string Geometry::EncodeLoadParams() const {
+		auto& params = GetLoadParams();
+		auto& optimize = params.mOptimizeParams;
+		std::ostringstream stream;
+		stream << std::setprecision(std::numeric_limits<float>::max_digits10);
+
+		// The vertex layout is looked up by component type, so its id
+		// is all that needs to be stored of it.
+		if (params.mComponentType) {
+			stream << params.mComponentType.id();
+		} else {
+			stream << 0;
+		}
+
+		stream << " " << optimize.bRemoveDuplicateVertices
+			<< " " << optimize.bOptimizeVertexCache
+			<< " " << optimize.bOptimizeVertexFetch
+			<< " " << optimize.bAllow16BitIndices
+			<< " " << optimize.bBuildMeshlets
+			<< " " << optimize.mMeshletParams.mMaxVertices
+			<< " " << optimize.mMeshletParams.mMaxTriangles
+			<< " " << optimize.mMeshletParams.mConeWeight
+			<< " " << optimize.bBuildLodChain
+			<< " " << optimize.mLodChainParams.mLevelCount
+			<< " " << optimize.mLodChainParams.mReduction
+			<< " " << optimize.mLodChainParams.mMaxError;
+		return stream.str();
+	}
+
+	LoadParams<Geometry> Geometry::DecodeLoadParams(const std::string& str) {
+		LoadParams<Geometry> params;
+		auto& optimize = params.mOptimizeParams;
+		std::istringstream stream(str);
+
+		entt::id_type id = 0;
+		if (!(stream >> id)) {
+			throw std::runtime_error("Invalid geometry load parameters: " + str);
+		}
+
+		if (id != 0) {
+			params.mComponentType = entt::resolve(id);
+
+			if (!params.mComponentType) {
+				throw std::runtime_error("Unknown component type in geometry load parameters: " + str);
+			}
+		}
+
+		// Manifests written before the optimization passes were stored
+		// only have the id, those meshes get the import defaults
+		stream >> std::ws;
+		if (stream.eof()) {
+			return params;
+		}
+
+		if (!(stream >> optimize.bRemoveDuplicateVertices
+			>> optimize.bOptimizeVertexCache
+			>> optimize.bOptimizeVertexFetch
+			>> optimize.bAllow16BitIndices
+			>> optimize.bBuildMeshlets
+			>> optimize.mMeshletParams.mMaxVertices
+			>> optimize.mMeshletParams.mMaxTriangles
+			>> optimize.mMeshletParams.mConeWeight
+			>> optimize.bBuildLodChain
+			>> optimize.mLodChainParams.mLevelCount
+			>> optimize.mLodChainParams.mReduction
+			>> optimize.mLodChainParams.mMaxError)) {
+			throw std::runtime_error("Invalid geometry load parameters: " + str);
+		}
+
+		return params;
+	}
+
     Geometry Geometry::Load(
         const std::filesystem::path& path, 
-        const VertexFormat& layout) {
-        auto data = Geometry::RawData::Load(path, layout);
+        const VertexFormat& layout,
+        const MeshOptimizeParams& optimizeParams) {
+        auto data = Geometry::RawData::Load(path, layout, optimizeParams);
+        return Geometry(std::move(data));
+    }
+
+    Geometry Geometry::Load(
+        const std::filesystem::path& path, 
+        const ByteView& bytes,
+        const VertexFormat& layout,
+        const MeshOptimizeParams& optimizeParams) {
+        auto data = Geometry::RawData::Load(path, bytes, layout,
+            optimizeParams);
         return Geometry(std::move(data));
     }
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include <okami/IOThreadPool.hpp>
+#include <okami/ResourceManager.hpp>
+#include <okami/VirtualFileSystem.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace okami::core {
+
+    void IOBuffer::Release() {
+        if (mPool) {
+            mPool->ReleaseBytes(mBytes.size());
+            mPool = nullptr;
+        }
+        mBytes = ByteView();
+    }
+
+    IOThreadPool::IOThreadPool(const IOThreadPoolParams& params,
+        VirtualFileSystem* fileSystem) :
+        mParams(params),
+        mFileSystem(fileSystem ? fileSystem : &VirtualFileSystem::Default()) {
+    }
+
+    IOThreadPool::~IOThreadPool() {
+        Shutdown();
+    }
+
+    void IOThreadPool::ReleaseBytes(uint64_t bytes) {
+        {
+            marl::lock lock(mMutex);
+            mBufferedBytes -= bytes;
+        }
+        mSpaceCondition.notify_all();
+    }
+
+    IOBuffer IOThreadPool::Read(const std::filesystem::path& path,
+        const LoadToken* token) {
+        VirtualFileSystem* fileSystem;
+
+        {
+            marl::lock lock(mMutex);
+
+            // Backpressure, wait for room in flight and for the decode
+            // stage to catch up
+            mSpaceCondition.wait(lock, [this] {
+                return bShutdown || 
+                    (mInFlight < std::max(1u, mParams.mQueueDepth) &&
+                    mBufferedBytes < mParams.mMaxBufferedBytes);
+            });
+
+            fileSystem = mFileSystem;
+
+            if (bShutdown) {
+                lock.unlock();
+                return IOBuffer(fileSystem->Read(path), nullptr);
+            }
+
+            if (token && token->IsCancelled()) {
+                return IOBuffer();
+            }
+
+            ++mInFlight;
+        }
+
+        auto result = fileSystem->ReadAsync(path).Get();
+
+        {
+            marl::lock lock(mMutex);
+            --mInFlight;
+            if (result.IsOk()) {
+                mBufferedBytes += result.mBytes.size();
+            }
+        }
+        mSpaceCondition.notify_all();
+
+        if (!result.IsOk()) {
+            throw std::runtime_error(result.mError);
+        }
+
+        return IOBuffer(std::move(result.mBytes), this);
+    }
+
+    void IOThreadPool::SetFileSystem(VirtualFileSystem* fileSystem) {
+        marl::lock lock(mMutex);
+        mFileSystem = fileSystem;
+    }
+
+    VirtualFileSystem& IOThreadPool::GetFileSystem() {
+        marl::lock lock(mMutex);
+        return *mFileSystem;
+    }
+
+    void IOThreadPool::Shutdown() {
+        {
+            marl::lock lock(mMutex);
+            bShutdown = true;
+        }
+        mSpaceCondition.notify_all();
+    }
+
+    size_t IOThreadPool::GetQueuedCount() {
+        marl::lock lock(mMutex);
+        return mInFlight;
+    }
+
+    uint64_t IOThreadPool::GetBufferedBytes() {
+        marl::lock lock(mMutex);
+        return mBufferedBytes;
+    }
+}
@@ -0,0 +1,103 @@
+#include <okami/LodSelection.hpp>
+
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace okami::core {
+
+    float EstimatePixelsPerUnit(const Camera& camera,
+        const glm::vec3& viewOrigin,
+        float viewportHeight,
+        const Transform& transform,
+        const BoundingBox& bounds) {
+
+        auto scale = glm::abs(transform.mScale);
+        float maxScale = std::max(scale.x, std::max(scale.y, scale.z));
+
+        // Too close to tell, any error could be visible
+        float inf = std::numeric_limits<float>::infinity();
+
+        if (camera.mType == Camera::Type::ORTHOGRAPHIC) {
+            if (camera.mOrthoSize.y <= 0.0f) {
+                return inf;
+            }
+            return viewportHeight / camera.mOrthoSize.y * maxScale;
+        }
+
+        auto center = transform.ApplyToPoint(
+            0.5f * (bounds.mLower + bounds.mUpper));
+        auto extent = (bounds.mUpper - bounds.mLower) * scale;
+        float radius = 0.5f * glm::length(extent);
+
+        float distance = glm::length(center - viewOrigin) - radius;
+        if (distance <= 0.0f) {
+            return inf;
+        }
+
+        float halfFov = std::tan(0.5f * camera.mFieldOfView);
+        return viewportHeight / (2.0f * distance * halfFov) * maxScale;
+    }
+
+    uint32_t SelectLod(const std::vector<MeshLod>& lods,
+        float pixelsPerUnit,
+        uint32_t currentLevel,
+        const LodSelectionParams& params) {
+
+        float limit = params.mMaxScreenError;
+        float strictLimit = limit * (1.0f - params.mHysteresis);
+
+        // Errors grow along the chain
+        uint32_t allowed = 0;
+        uint32_t allowedStrict = 0;
+        for (uint32_t i = 0; i < lods.size(); ++i) {
+            float screenError = lods[i].mError * pixelsPerUnit;
+            if (screenError <= limit) {
+                allowed = i + 1;
+            }
+            if (screenError <= strictLimit) {
+                allowedStrict = i + 1;
+            }
+        }
+
+        if (currentLevel > allowed) {
+            return allowed;
+        }
+        return std::max(currentLevel, allowedStrict);
+    }
+
+    uint32_t LodSelector::Select(uint64_t view,
+        entt::entity entity,
+        const std::vector<MeshLod>& lods,
+        float pixelsPerUnit) {
+        marl::lock lock(mMutex);
+
+        auto& entry = mEntries[Key{ view, entity }];
+        entry.mLevel = SelectLod(lods, pixelsPerUnit, entry.mLevel, mParams);
+        entry.mLastRequest = mUpdateCount;
+        return entry.mLevel;
+    }
+
+    void LodSelector::Update() {
+        marl::lock lock(mMutex);
+
+        ++mUpdateCount;
+        for (auto it = mEntries.begin(); it != mEntries.end();) {
+            if (mUpdateCount - it->second.mLastRequest > mParams.mUnusedUpdates) {
+                it = mEntries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    uint32_t LodSelector::GetLevel(uint64_t view, entt::entity entity) const {
+        marl::lock lock(mMutex);
+
+        auto it = mEntries.find(Key{ view, entity });
+        return it == mEntries.end() ? 0 : it->second.mLevel;
+    }
+}
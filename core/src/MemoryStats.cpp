@@ -0,0 +1,142 @@
+#include <okami/MemoryStats.hpp>
+#include <okami/System.hpp>
+
+#include <sstream>
+
+namespace okami::core {
+
+    static const char* ToString(MemoryCategory category) {
+        switch (category) {
+            case MemoryCategory::CPU:
+                return "CPU";
+            case MemoryCategory::GPU_BUFFER:
+                return "GPU buffer";
+            case MemoryCategory::GPU_TEXTURE:
+                return "GPU texture";
+            case MemoryCategory::IN_FLIGHT:
+                return "in-flight";
+            default:
+                return "unknown";
+        }
+    }
+
+    void MemoryTracker::CheckBudgets(entt::meta_type type, Entry& entry) {
+        for (size_t i = 0; i < entry.mBudgets.size(); ++i) {
+            auto& budget = entry.mBudgets[i];
+            if (budget.mBytes < 0) {
+                continue;
+            }
+
+            auto usage = entry.mUsage.mFootprint.mBytes[i];
+            bool bExceeded = usage > budget.mBytes;
+
+            if (bExceeded && !budget.bExceeded) {
+                ++mViolationCount;
+
+                std::stringstream ss;
+                ss << "Memory budget exceeded for " << 
+                    ToString((MemoryCategory)i);
+                if (type) {
+                    ss << " (type " << type.id() << ")";
+                }
+                ss << ": " << usage << " / " << budget.mBytes << " bytes";
+                PrintWarning(ss.str());
+            }
+
+            budget.bExceeded = bExceeded;
+        }
+    }
+
+    void MemoryTracker::Add(entt::meta_type type,
+        const MemoryFootprint& footprint,
+        int64_t count) {
+        marl::lock lock(mMutex);
+
+        auto& entry = mEntries[type];
+        entry.mUsage.mFootprint += footprint;
+        entry.mUsage.mCount += count;
+        mTotal.mUsage.mFootprint += footprint;
+        mTotal.mUsage.mCount += count;
+
+        CheckBudgets(type, entry);
+        CheckBudgets(entt::meta_type(), mTotal);
+    }
+
+    void MemoryTracker::Remove(entt::meta_type type,
+        const MemoryFootprint& footprint,
+        int64_t count) {
+        marl::lock lock(mMutex);
+
+        auto& entry = mEntries[type];
+        entry.mUsage.mFootprint -= footprint;
+        entry.mUsage.mCount -= count;
+        mTotal.mUsage.mFootprint -= footprint;
+        mTotal.mUsage.mCount -= count;
+
+        CheckBudgets(type, entry);
+        CheckBudgets(entt::meta_type(), mTotal);
+    }
+
+    MemoryUsage MemoryTracker::GetUsage(entt::meta_type type) const {
+        marl::lock lock(mMutex);
+
+        auto it = mEntries.find(type);
+        if (it != mEntries.end()) {
+            return it->second.mUsage;
+        } else {
+            return MemoryUsage();
+        }
+    }
+
+    MemoryUsage MemoryTracker::GetTotalUsage() const {
+        marl::lock lock(mMutex);
+        return mTotal.mUsage;
+    }
+
+    void MemoryTracker::SetBudget(entt::meta_type type,
+        MemoryCategory category, int64_t bytes) {
+        marl::lock lock(mMutex);
+
+        auto& entry = mEntries[type];
+        entry.mBudgets[(size_t)category] = Budget{bytes, false};
+        CheckBudgets(type, entry);
+    }
+
+    void MemoryTracker::SetTotalBudget(
+        MemoryCategory category, int64_t bytes) {
+        marl::lock lock(mMutex);
+
+        mTotal.mBudgets[(size_t)category] = Budget{bytes, false};
+        CheckBudgets(entt::meta_type(), mTotal);
+    }
+
+    std::vector<MemoryBudgetViolation> MemoryTracker::GetViolations() const {
+        marl::lock lock(mMutex);
+
+        std::vector<MemoryBudgetViolation> result;
+        auto collect = [&result](entt::meta_type type, const Entry& entry) {
+            for (size_t i = 0; i < entry.mBudgets.size(); ++i) {
+                if (entry.mBudgets[i].bExceeded) {
+                    MemoryBudgetViolation violation;
+                    violation.mType = type;
+                    violation.mCategory = (MemoryCategory)i;
+                    violation.mBudget = entry.mBudgets[i].mBytes;
+                    violation.mUsage = entry.mUsage.mFootprint.mBytes[i];
+                    result.emplace_back(violation);
+                }
+            }
+        };
+
+        collect(entt::meta_type(), mTotal);
+        for (auto& [type, entry] : mEntries) {
+            collect(type, entry);
+        }
+
+        return result;
+    }
+
+    uint MemoryTracker::GetViolationCount() const {
+        marl::lock lock(mMutex);
+        return mViolationCount;
+    }
+}
@@ -0,0 +1,540 @@
+#include <okami/MeshOptimizer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+namespace okami::core {
+
+    VertexCacheStats AnalyzeVertexCache(const uint32_t* indices,
+        size_t indexCount, size_t vertexCount, uint cacheSize) {
+        VertexCacheStats result;
+        if (indexCount == 0 || vertexCount == 0) {
+            return result;
+        }
+
+        // A vertex is still in a FIFO cache if fewer than cacheSize
+        // misses happened since it was loaded
+        std::vector<size_t> loadedAt(vertexCount, 0);
+        size_t time = cacheSize + 1;
+        size_t misses = 0;
+
+        for (size_t i = 0; i < indexCount; ++i) {
+            auto v = indices[i];
+            if (time - loadedAt[v] > cacheSize) {
+                loadedAt[v] = time++;
+                ++misses;
+            }
+        }
+
+        result.mACMR = (float)misses / (float)(indexCount / 3);
+        result.mATVR = (float)misses / (float)vertexCount;
+        return result;
+    }
+
+    namespace {
+        // Forsyth's recommended constants. The cache here is only used
+        // to score vertices and is larger than the one of any GPU.
+        constexpr uint FORSYTH_CACHE_SIZE = 32;
+        constexpr float CACHE_DECAY_POWER = 1.5f;
+        constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+        constexpr float VALENCE_BOOST_SCALE = 2.0f;
+        constexpr float VALENCE_BOOST_POWER = 0.5f;
+        constexpr uint VALENCE_TABLE_SIZE = 32;
+
+        struct ScoreTables {
+            float mCache[FORSYTH_CACHE_SIZE];
+            float mValence[VALENCE_TABLE_SIZE];
+
+            ScoreTables() {
+                for (uint i = 0; i < FORSYTH_CACHE_SIZE; ++i) {
+                    if (i < 3) {
+                        // The last triangle's vertices are scored the same
+                        // no matter their order, so that its neighbours
+                        // aren't skipped over
+                        mCache[i] = LAST_TRIANGLE_SCORE;
+                    } else {
+                        float scale = 1.0f / (FORSYTH_CACHE_SIZE - 3);
+                        mCache[i] = std::pow(1.0f - (i - 3) * scale, CACHE_DECAY_POWER);
+                    }
+                }
+                for (uint i = 0; i < VALENCE_TABLE_SIZE; ++i) {
+                    mValence[i] = ValenceScore(i);
+                }
+            }
+
+            static float ValenceScore(uint remaining) {
+                return remaining == 0 ? 0.0f :
+                    VALENCE_BOOST_SCALE * std::pow((float)remaining, -VALENCE_BOOST_POWER);
+            }
+
+            // Vertices with few triangles left are preferred, finishing
+            // them frees up the cache
+            inline float Score(int cachePosition, uint remaining) const {
+                if (remaining == 0) {
+                    return -1.0f;
+                }
+
+                float score = cachePosition >= 0 ? mCache[cachePosition] : 0.0f;
+                score += remaining < VALENCE_TABLE_SIZE ?
+                    mValence[remaining] : ValenceScore(remaining);
+                return score;
+            }
+        };
+    }
+
+    void OptimizeVertexCache(uint32_t* destination, const uint32_t* indices,
+        size_t indexCount, size_t vertexCount) {
+        static const ScoreTables tables;
+
+        size_t triangleCount = indexCount / 3;
+        if (triangleCount == 0) {
+            return;
+        }
+
+        // The input may be overwritten while it is read
+        std::vector<uint32_t> source(indices, indices + triangleCount * 3);
+
+        // Triangles of every vertex that haven't been emitted yet. The
+        // first remaining[v] entries after offsets[v] are live.
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        std::vector<uint32_t> remaining(vertexCount, 0);
+        for (auto v : source) {
+            ++remaining[v];
+        }
+        for (size_t v = 0; v < vertexCount; ++v) {
+            offsets[v + 1] = offsets[v] + remaining[v];
+        }
+
+        std::vector<uint32_t> adjacency(source.size());
+        {
+            std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < source.size(); ++i) {
+                adjacency[fill[source[i]]++] = (uint32_t)(i / 3);
+            }
+        }
+
+        std::vector<int> cachePosition(vertexCount, -1);
+        std::vector<float> vertexScore(vertexCount);
+        for (size_t v = 0; v < vertexCount; ++v) {
+            vertexScore[v] = tables.Score(-1, remaining[v]);
+        }
+
+        std::vector<float> triangleScore(triangleCount);
+        std::vector<bool> bEmitted(triangleCount, false);
+
+        int best = -1;
+        float bestScore = -std::numeric_limits<float>::infinity();
+        for (size_t t = 0; t < triangleCount; ++t) {
+            auto tri = &source[t * 3];
+            triangleScore[t] = vertexScore[tri[0]] +
+                vertexScore[tri[1]] + vertexScore[tri[2]];
+            if (triangleScore[t] > bestScore) {
+                bestScore = triangleScore[t];
+                best = (int)t;
+            }
+        }
+
+        std::vector<uint32_t> cache;
+        std::vector<uint32_t> newCache;
+        cache.reserve(FORSYTH_CACHE_SIZE + 3);
+        newCache.reserve(FORSYTH_CACHE_SIZE + 3);
+
+        // Where to look for triangles once nothing in the cache has any
+        // left. Everything before it has been emitted.
+        size_t nextUnemitted = 0;
+
+        for (size_t emitted = 0; emitted < triangleCount; ++emitted) {
+            if (best < 0) {
+                while (bEmitted[nextUnemitted]) {
+                    ++nextUnemitted;
+                }
+                best = (int)nextUnemitted;
+            }
+
+            auto tri = &source[best * 3];
+            std::memcpy(&destination[emitted * 3], tri, sizeof(uint32_t) * 3);
+            bEmitted[best] = true;
+
+            for (int i = 0; i < 3; ++i) {
+                auto v = tri[i];
+                auto begin = &adjacency[offsets[v]];
+                auto end = begin + remaining[v];
+                auto it = std::find(begin, end, (uint32_t)best);
+                std::swap(*it, *(end - 1));
+                --remaining[v];
+            }
+
+            // The triangle's vertices move to the front, everything else
+            // is pushed back and may fall out of the cache
+            newCache.clear();
+            for (int i = 0; i < 3; ++i) {
+                // Degenerate triangles repeat vertices
+                if (std::find(newCache.begin(), newCache.end(), tri[i]) == newCache.end()) {
+                    newCache.emplace_back(tri[i]);
+                }
+            }
+            for (auto v : cache) {
+                if (v != tri[0] && v != tri[1] && v != tri[2]) {
+                    newCache.emplace_back(v);
+                }
+            }
+
+            for (size_t i = 0; i < newCache.size(); ++i) {
+                auto v = newCache[i];
+                cachePosition[v] = i < FORSYTH_CACHE_SIZE ? (int)i : -1;
+                vertexScore[v] = tables.Score(cachePosition[v], remaining[v]);
+            }
+
+            // Only triangles touching the cache changed their score
+            best = -1;
+            bestScore = -std::numeric_limits<float>::infinity();
+            for (auto v : newCache) {
+                auto begin = &adjacency[offsets[v]];
+                for (uint32_t j = 0; j < remaining[v]; ++j) {
+                    auto t = begin[j];
+                    auto other = &source[t * 3];
+                    triangleScore[t] = vertexScore[other[0]] +
+                        vertexScore[other[1]] + vertexScore[other[2]];
+                    if (triangleScore[t] > bestScore) {
+                        bestScore = triangleScore[t];
+                        best = (int)t;
+                    }
+                }
+            }
+
+            if (newCache.size() > FORSYTH_CACHE_SIZE) {
+                newCache.resize(FORSYTH_CACHE_SIZE);
+            }
+            std::swap(cache, newCache);
+        }
+    }
+
+    size_t OptimizeVertexFetchRemap(uint32_t* remap, const uint32_t* indices,
+        size_t indexCount, size_t vertexCount) {
+        std::fill(remap, remap + vertexCount, UINT32_MAX);
+
+        uint32_t next = 0;
+        for (size_t i = 0; i < indexCount; ++i) {
+            auto& target = remap[indices[i]];
+            if (target == UINT32_MAX) {
+                target = next++;
+            }
+        }
+        return next;
+    }
+
+    namespace {
+        // Strides of the per vertex data in each vertex buffer
+        std::vector<size_t> GetVertexStrides(const Geometry::RawData& data,
+            size_t vertexCount) {
+            std::vector<size_t> result;
+            for (auto& buffer : data.mVertexBuffers) {
+                result.emplace_back(buffer.mBytes.size() / vertexCount);
+            }
+            return result;
+        }
+
+        // Vertices that are the same in every vertex buffer map to the
+        // first of them
+        size_t GenerateDuplicateRemap(std::vector<uint32_t>& remap,
+            const Geometry::RawData& data, const std::vector<size_t>& strides,
+            size_t vertexCount) {
+
+            auto hash = [&](uint32_t v) {
+                // FNV-1a over the vertex in every buffer
+                uint64_t h = 14695981039346656037ull;
+                for (size_t b = 0; b < strides.size(); ++b) {
+                    auto bytes = &data.mVertexBuffers[b].mBytes[v * strides[b]];
+                    for (size_t i = 0; i < strides[b]; ++i) {
+                        h = (h ^ bytes[i]) * 1099511628211ull;
+                    }
+                }
+                return (size_t)h;
+            };
+
+            auto equal = [&](uint32_t a, uint32_t b) {
+                for (size_t buffer = 0; buffer < strides.size(); ++buffer) {
+                    auto& bytes = data.mVertexBuffers[buffer].mBytes;
+                    auto stride = strides[buffer];
+                    if (std::memcmp(&bytes[a * stride], &bytes[b * stride], stride) != 0) {
+                        return false;
+                    }
+                }
+                return true;
+            };
+
+            std::unordered_map<uint32_t, uint32_t,
+                decltype(hash), decltype(equal)> unique(vertexCount, hash, equal);
+
+            remap.resize(vertexCount);
+            uint32_t next = 0;
+            for (uint32_t v = 0; v < vertexCount; ++v) {
+                auto it = unique.emplace(v, next);
+                if (it.second) {
+                    ++next;
+                }
+                remap[v] = it.first->second;
+            }
+            return next;
+        }
+
+        // Moves every vertex v to remap[v], dropping those that map to
+        // UINT32_MAX. Vertices that map to the same place have to be
+        // the same, only the first of them is kept. Vertices are swapped
+        // along the cycles of the remap, so the buffers are never held
+        // twice. remap is turned into that permutation.
+        void RemapVertexBuffers(Geometry::RawData& data,
+            const std::vector<size_t>& strides,
+            std::vector<uint32_t>& remap, size_t newVertexCount) {
+
+            std::vector<bool> bPlaced(remap.size(), false);
+            for (auto& target : remap) {
+                if (target == UINT32_MAX) {
+                    continue;
+                }
+                if (bPlaced[target]) {
+                    target = UINT32_MAX;
+                } else {
+                    bPlaced[target] = true;
+                }
+            }
+
+            // Dropped vertices go to the slots nothing else moves to
+            auto freeSlot = (uint32_t)newVertexCount;
+            for (auto& target : remap) {
+                if (target == UINT32_MAX) {
+                    target = freeSlot++;
+                }
+            }
+
+            std::vector<uint8_t> carried;
+            std::vector<uint8_t> pickedUp;
+
+            for (size_t b = 0; b < data.mVertexBuffers.size(); ++b) {
+                auto& buffer = data.mVertexBuffers[b];
+                auto stride = strides[b];
+                auto bytes = buffer.mBytes.data();
+                if (stride == 0) {
+                    continue;
+                }
+
+                std::fill(bPlaced.begin(), bPlaced.end(), false);
+                carried.resize(stride);
+                pickedUp.resize(stride);
+
+                for (size_t start = 0; start < remap.size(); ++start) {
+                    if (bPlaced[start] || remap[start] == start) {
+                        continue;
+                    }
+
+                    // Each step drops the carried vertex in place and
+                    // picks up the one that was there
+                    std::memcpy(carried.data(), &bytes[start * stride], stride);
+                    size_t v = start;
+                    do {
+                        size_t target = remap[v];
+                        auto slot = &bytes[target * stride];
+                        std::memcpy(pickedUp.data(), slot, stride);
+                        std::memcpy(slot, carried.data(), stride);
+                        std::swap(carried, pickedUp);
+                        bPlaced[target] = true;
+                        v = target;
+                    } while (v != start);
+                }
+
+                // Give the memory of a lot of dropped vertices back
+                size_t newSize = newVertexCount * stride;
+                if (newSize < buffer.mBytes.capacity() / 2) {
+                    buffer.mBytes = ByteBuffer(bytes, newSize);
+                } else {
+                    buffer.mBytes.resize(newSize);
+                }
+                buffer.mDesc.mSizeInBytes = (uint32_t)buffer.mBytes.size();
+            }
+        }
+
+        void RemapIndices(std::vector<uint32_t>& indices,
+            const std::vector<uint32_t>& remap) {
+            for (auto& i : indices) {
+                i = remap[i];
+            }
+        }
+
+        std::vector<glm::vec3> DecodePositions(const Geometry::RawData& data,
+            size_t vertexCount) {
+            auto& layout = data.mDesc.mLayout;
+            auto indexing = PackIndexing::From(layout, vertexCount);
+
+            std::vector<glm::vec3> result(vertexCount);
+            UnpackVertexAttribute<3, V3Packer<glm::vec3>>(GetVertexKernels(),
+                layout.mElements[layout.mPosition], result.data(),
+                &data.mVertexBuffers[indexing.mPositionChannel].mBytes[indexing.mPositionOffset],
+                indexing.mPositionStride, vertexCount, data.mBoundingBox);
+            return result;
+        }
+
+        // Cache optimizes every meshlet on its own, so that the triangles
+        // stay in their ranges. Vertices are renumbered to the meshlet
+        // first, which keeps the work proportional to its size.
+        void OptimizeMeshletVertexCache(std::vector<uint32_t>& indices,
+            const std::vector<Meshlet>& meshlets, size_t vertexCount) {
+            std::vector<uint32_t> local(vertexCount, UINT32_MAX);
+            std::vector<uint32_t> global;
+            std::vector<uint32_t> meshletIndices;
+
+            for (auto& meshlet : meshlets) {
+                auto begin = &indices[meshlet.mFirstIndex];
+                global.clear();
+                meshletIndices.resize(meshlet.mIndexCount);
+
+                for (uint32_t i = 0; i < meshlet.mIndexCount; ++i) {
+                    auto& l = local[begin[i]];
+                    if (l == UINT32_MAX) {
+                        l = (uint32_t)global.size();
+                        global.emplace_back(begin[i]);
+                    }
+                    meshletIndices[i] = l;
+                }
+
+                OptimizeVertexCache(meshletIndices.data(), meshletIndices.data(),
+                    meshletIndices.size(), global.size());
+
+                for (uint32_t i = 0; i < meshlet.mIndexCount; ++i) {
+                    begin[i] = global[meshletIndices[i]];
+                }
+                for (auto v : global) {
+                    local[v] = UINT32_MAX;
+                }
+            }
+        }
+    }
+
+    MeshOptimizeStats OptimizeMesh(Geometry::RawData& data,
+        const MeshOptimizeParams& params) {
+        auto& desc = data.mDesc;
+        size_t vertexCount = desc.mAttribs.mNumVertices;
+
+        MeshOptimizeStats stats;
+        stats.mVertexCountBefore = vertexCount;
+        stats.mVertexCountAfter = vertexCount;
+        stats.mIndexType = desc.mIndexedAttribs.mIndexType;
+
+        if (!desc.bIsIndexed ||
+            desc.mLayout.mTopology != Topology::TRIANGLE_LIST ||
+            vertexCount == 0) {
+            return stats;
+        }
+
+        // Work on 32 bit indices, whatever is stored
+        size_t indexCount = desc.mIndexedAttribs.mNumIndices;
+        std::vector<uint32_t> indices(indexCount);
+        auto& indexBytes = data.mIndexBuffer.mBytes;
+        if (desc.mIndexedAttribs.mIndexType == ValueType::UINT16) {
+            for (size_t i = 0; i < indexCount; ++i) {
+                uint16_t index;
+                std::memcpy(&index, &indexBytes[i * sizeof(uint16_t)], sizeof(index));
+                indices[i] = index;
+            }
+        } else if (desc.mIndexedAttribs.mIndexType == ValueType::UINT32) {
+            std::memcpy(indices.data(), indexBytes.data(), indexCount * sizeof(uint32_t));
+        } else {
+            throw std::runtime_error("Index type must be VT_UINT16 or VT_UINT32!");
+        }
+        // Written again at the end, in whatever type fits
+        indexBytes.clear();
+
+        stats.mBefore = AnalyzeVertexCache(indices.data(), indexCount, vertexCount);
+
+        auto strides = GetVertexStrides(data, vertexCount);
+        std::vector<uint32_t> remap;
+
+        if (params.bRemoveDuplicateVertices) {
+            size_t uniqueCount = GenerateDuplicateRemap(remap, data, strides, vertexCount);
+            if (uniqueCount != vertexCount) {
+                RemapIndices(indices, remap);
+                RemapVertexBuffers(data, strides, remap, uniqueCount);
+                vertexCount = uniqueCount;
+            }
+        }
+
+        if (params.bOptimizeVertexCache) {
+            OptimizeVertexCache(indices.data(), indices.data(), indexCount, vertexCount);
+        }
+
+        // Meshlets grow along the cache order, which already keeps
+        // neighbours together. Regrouping triangles costs some of the
+        // reuse between them, so each meshlet is optimized again.
+        data.mMeshlets.clear();
+        data.mLods.clear();
+        bool bHasPositions = desc.mLayout.mPosition >= 0;
+        std::vector<glm::vec3> positions;
+        if (bHasPositions && (params.bBuildMeshlets || params.bBuildLodChain)) {
+            positions = DecodePositions(data, vertexCount);
+        }
+
+        if (params.bBuildMeshlets && bHasPositions) {
+            data.mMeshlets = BuildMeshlets(indices.data(), indexCount,
+                positions.data(), vertexCount, params.mMeshletParams);
+
+            if (params.bOptimizeVertexCache) {
+                OptimizeMeshletVertexCache(indices, data.mMeshlets, vertexCount);
+            }
+        }
+
+        // Levels are appended after the full detail indices, and only
+        // use vertices the full detail mesh uses
+        if (params.bBuildLodChain && bHasPositions) {
+            data.mLods = BuildLodChain(indices, indexCount,
+                positions.data(), vertexCount, params.mLodChainParams);
+
+            if (params.bOptimizeVertexCache) {
+                for (auto& lod : data.mLods) {
+                    auto lodIndices = &indices[lod.mFirstIndex];
+                    OptimizeVertexCache(lodIndices, lodIndices,
+                        lod.mIndexCount, vertexCount);
+                }
+            }
+        }
+
+        // Runs after the cache pass, whose triangle order it follows. It
+        // only renames vertices, so meshlet and level ranges stay valid.
+        if (params.bOptimizeVertexFetch) {
+            remap.resize(vertexCount);
+            size_t usedCount = OptimizeVertexFetchRemap(remap.data(),
+                indices.data(), indexCount, vertexCount);
+            RemapIndices(indices, remap);
+            RemapVertexBuffers(data, strides, remap, usedCount);
+            vertexCount = usedCount;
+        }
+
+        stats.mAfter = AnalyzeVertexCache(indices.data(), indexCount, vertexCount);
+        stats.mVertexCountAfter = vertexCount;
+
+        // 0xFFFF is left free, it is the strip restart index of UINT16
+        bool b16Bit = params.bAllow16BitIndices && vertexCount <= 0xFFFF;
+        if (b16Bit) {
+            ByteBuffer result(indices.size() * sizeof(uint16_t));
+            for (size_t i = 0; i < indices.size(); ++i) {
+                auto index = (uint16_t)indices[i];
+                std::memcpy(&result[i * sizeof(uint16_t)], &index, sizeof(index));
+            }
+            data.mIndexBuffer.mBytes = std::move(result);
+            desc.mIndexedAttribs.mIndexType = ValueType::UINT16;
+        } else {
+            data.mIndexBuffer.mBytes = ByteBuffer(
+                reinterpret_cast<const uint8_t*>(indices.data()),
+                indices.size() * sizeof(uint32_t));
+            desc.mIndexedAttribs.mIndexType = ValueType::UINT32;
+        }
+        data.mIndexBuffer.mDesc.mSizeInBytes = (uint32_t)data.mIndexBuffer.mBytes.size();
+
+        desc.mAttribs.mNumVertices = (uint32_t)vertexCount;
+        stats.mIndexType = desc.mIndexedAttribs.mIndexType;
+        stats.mMeshletCount = data.mMeshlets.size();
+        stats.mLodCount = data.mLods.size();
+        return stats;
+    }
+}
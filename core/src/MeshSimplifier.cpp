@@ -0,0 +1,398 @@
+#include <okami/MeshSimplifier.hpp>
+
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+namespace okami::core {
+
+    namespace {
+        // A collapse may turn a triangle by at most 60 degrees. Looser
+        // limits let turns add up over several collapses until
+        // triangles fold over.
+        constexpr float MIN_NORMAL_DOT = 0.5f;
+        // Levels that keep more than this share of the triangles of the
+        // level before them aren't worth storing
+        constexpr float MAX_LOD_KEEP = 0.9f;
+
+        // Sum of squared distances to a set of planes, weighted by the
+        // area of the triangles they came from
+        struct Quadric {
+            double mA00 = 0.0, mA11 = 0.0, mA22 = 0.0;
+            double mA01 = 0.0, mA02 = 0.0, mA12 = 0.0;
+            double mB0 = 0.0, mB1 = 0.0, mB2 = 0.0;
+            double mC = 0.0;
+            double mWeight = 0.0;
+
+            static Quadric FromPlane(const glm::vec3& n, float d, float weight) {
+                Quadric q;
+                q.mA00 = weight * n.x * n.x;
+                q.mA11 = weight * n.y * n.y;
+                q.mA22 = weight * n.z * n.z;
+                q.mA01 = weight * n.x * n.y;
+                q.mA02 = weight * n.x * n.z;
+                q.mA12 = weight * n.y * n.z;
+                q.mB0 = weight * n.x * d;
+                q.mB1 = weight * n.y * d;
+                q.mB2 = weight * n.z * d;
+                q.mC = weight * d * d;
+                q.mWeight = weight;
+                return q;
+            }
+
+            inline Quadric& operator+=(const Quadric& other) {
+                mA00 += other.mA00; mA11 += other.mA11; mA22 += other.mA22;
+                mA01 += other.mA01; mA02 += other.mA02; mA12 += other.mA12;
+                mB0 += other.mB0; mB1 += other.mB1; mB2 += other.mB2;
+                mC += other.mC;
+                mWeight += other.mWeight;
+                return *this;
+            }
+
+            // Weighted mean squared distance of p to the planes
+            inline double Error(const glm::vec3& p) const {
+                double x = p.x, y = p.y, z = p.z;
+                double r = mA00 * x * x + mA11 * y * y + mA22 * z * z +
+                    2.0 * (mA01 * x * y + mA02 * x * z + mA12 * y * z) +
+                    2.0 * (mB0 * x + mB1 * y + mB2 * z) + mC;
+                return mWeight > 0.0 ? std::abs(r) / mWeight : 0.0;
+            }
+        };
+
+        struct Collapse {
+            uint32_t mFrom;
+            uint32_t mTo;
+            double mError;
+        };
+
+        inline glm::vec3 Cross(const glm::vec3& p0, const glm::vec3& p1,
+            const glm::vec3& p2) {
+            return glm::cross(p1 - p0, p2 - p0);
+        }
+
+        inline uint64_t EdgeKey(uint32_t a, uint32_t b) {
+            return a < b ? ((uint64_t)a << 32) | b : ((uint64_t)b << 32) | a;
+        }
+
+        // Vertices with the same position map to the first of them
+        std::vector<uint32_t> GenerateWedges(const uint32_t* indices,
+            size_t indexCount, const glm::vec3* positions, size_t vertexCount) {
+            struct Hasher {
+                inline size_t operator()(const glm::vec3& p) const {
+                    uint32_t bits[3];
+                    std::memcpy(bits, &p.x, sizeof(bits));
+                    return (size_t)(bits[0] * 73856093u ^ bits[1] * 19349663u ^
+                        bits[2] * 83492791u);
+                }
+            };
+
+            std::vector<uint32_t> result(vertexCount, UINT32_MAX);
+            std::unordered_map<glm::vec3, uint32_t, Hasher> first;
+            for (size_t i = 0; i < indexCount; ++i) {
+                auto v = indices[i];
+                if (result[v] == UINT32_MAX) {
+                    result[v] = first.emplace(positions[v], v).first->second;
+                }
+            }
+            return result;
+        }
+    }
+
+    size_t SimplifyMesh(uint32_t* destination, const uint32_t* indices,
+        size_t indexCount, const glm::vec3* positions, size_t vertexCount,
+        size_t targetIndexCount, float targetError,
+        float* resultError) {
+
+        std::vector<uint32_t> current;
+        current.reserve(indexCount);
+        for (size_t i = 0; i + 2 < indexCount; i += 3) {
+            auto a = indices[i], b = indices[i + 1], c = indices[i + 2];
+            if (a != b && b != c && a != c) {
+                current.insert(current.end(), { a, b, c });
+            }
+        }
+
+        auto wedges = GenerateWedges(current.data(), current.size(),
+            positions, vertexCount);
+
+        // Seams, open borders and non-manifold edges stay where they are
+        std::vector<bool> bLocked(vertexCount, false);
+        {
+            // Every position's wedge is the first vertex at it, any other
+            // vertex there is on a seam
+            for (auto v : current) {
+                if (wedges[v] != v) {
+                    bLocked[wedges[v]] = true;
+                }
+            }
+
+            std::unordered_map<uint64_t, uint32_t> edgeUses;
+            for (size_t i = 0; i < current.size(); i += 3) {
+                for (int e = 0; e < 3; ++e) {
+                    ++edgeUses[EdgeKey(wedges[current[i + e]],
+                        wedges[current[i + (e + 1) % 3]])];
+                }
+            }
+            for (auto& [key, uses] : edgeUses) {
+                if (uses != 2) {
+                    bLocked[(uint32_t)(key >> 32)] = true;
+                    bLocked[(uint32_t)(key & 0xFFFFFFFFu)] = true;
+                }
+            }
+
+            for (auto v : current) {
+                if (bLocked[wedges[v]]) {
+                    bLocked[v] = true;
+                }
+            }
+        }
+
+        // Planes of the triangles around every position
+        std::vector<Quadric> quadrics(vertexCount);
+        for (size_t i = 0; i < current.size(); i += 3) {
+            auto& p0 = positions[current[i]];
+            auto n = Cross(p0, positions[current[i + 1]], positions[current[i + 2]]);
+            float area = glm::length(n);
+            if (area <= 0.0f) {
+                continue;
+            }
+            n /= area;
+
+            auto q = Quadric::FromPlane(n, -glm::dot(n, p0), 0.5f * area);
+            for (int c = 0; c < 3; ++c) {
+                quadrics[wedges[current[i + c]]] += q;
+            }
+        }
+
+        double limit = (double)targetError * (double)targetError;
+        double maxError = 0.0;
+
+        std::vector<uint32_t> offsets(vertexCount + 1);
+        std::vector<uint32_t> adjacency;
+        std::vector<Collapse> candidates;
+        std::vector<uint32_t> collapseTo(vertexCount);
+        std::vector<bool> bDirty(vertexCount);
+        std::vector<uint32_t> stamp(vertexCount, 0);
+        uint32_t stampValue = 0;
+
+        while (current.size() > targetIndexCount) {
+            size_t triangleCount = current.size() / 3;
+
+            // Triangles of every vertex
+            std::fill(offsets.begin(), offsets.end(), 0);
+            for (auto v : current) {
+                ++offsets[v + 1];
+            }
+            for (size_t v = 0; v < vertexCount; ++v) {
+                offsets[v + 1] += offsets[v];
+            }
+            adjacency.resize(current.size());
+            {
+                std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+                for (size_t i = 0; i < current.size(); ++i) {
+                    adjacency[fill[current[i]]++] = (uint32_t)(i / 3);
+                }
+            }
+
+            // An edge between two triangles is seen from both, the other
+            // way around from each, and only listed by the one that sees
+            // it in increasing order. That halves the largest allocation
+            // of the pass. Edges of a single triangle are on a border,
+            // which is locked anyway.
+            candidates.clear();
+            for (size_t i = 0; i < current.size(); i += 3) {
+                for (int e = 0; e < 3; ++e) {
+                    auto from = current[i + e];
+                    auto to = current[i + (e + 1) % 3];
+                    if (from > to) {
+                        continue;
+                    }
+                    for (int dir = 0; dir < 2; ++dir, std::swap(from, to)) {
+                        if (bLocked[from]) {
+                            continue;
+                        }
+                        Quadric q = quadrics[wedges[from]];
+                        q += quadrics[wedges[to]];
+                        candidates.push_back({ from, to, q.Error(positions[to]) });
+                    }
+                }
+            }
+            std::sort(candidates.begin(), candidates.end(),
+                [](const Collapse& a, const Collapse& b) {
+                    return a.mError < b.mError;
+                });
+
+            for (size_t v = 0; v < vertexCount; ++v) {
+                collapseTo[v] = (uint32_t)v;
+            }
+            std::fill(bDirty.begin(), bDirty.end(), false);
+
+            // Collapses in one pass don't touch each other's triangles,
+            // so they can all be checked against the current mesh
+            size_t goal = (current.size() - targetIndexCount) / 3;
+            size_t removed = 0;
+            size_t collapses = 0;
+
+            for (auto& candidate : candidates) {
+                if (candidate.mError > limit || removed >= goal) {
+                    break;
+                }
+
+                auto u = candidate.mFrom;
+                auto v = candidate.mTo;
+                if (bDirty[u] || bDirty[v]) {
+                    continue;
+                }
+
+                // The link condition: u and v may only share the
+                // neighbours of the triangles on their edge, otherwise
+                // the collapse pinches the surface
+                ++stampValue;
+                for (uint32_t j = offsets[u]; j < offsets[u + 1]; ++j) {
+                    auto tri = &current[adjacency[j] * 3];
+                    for (int c = 0; c < 3; ++c) {
+                        stamp[tri[c]] = stampValue;
+                    }
+                }
+                size_t shared = 0;
+                size_t common = 0;
+                ++stampValue;
+                for (uint32_t j = offsets[v]; j < offsets[v + 1]; ++j) {
+                    auto tri = &current[adjacency[j] * 3];
+                    bool bHasU = tri[0] == u || tri[1] == u || tri[2] == u;
+                    shared += bHasU ? 1 : 0;
+                    for (int c = 0; c < 3; ++c) {
+                        auto w = tri[c];
+                        if (w != u && w != v && stamp[w] == stampValue - 1) {
+                            stamp[w] = stampValue;
+                            ++common;
+                        }
+                    }
+                }
+                if (shared == 0 || common != shared) {
+                    continue;
+                }
+
+                // Triangles that stay must not turn over
+                bool bFlips = false;
+                for (uint32_t j = offsets[u]; j < offsets[u + 1] && !bFlips; ++j) {
+                    auto tri = &current[adjacency[j] * 3];
+                    if (tri[0] == v || tri[1] == v || tri[2] == v) {
+                        continue;
+                    }
+
+                    glm::vec3 corners[3];
+                    for (int c = 0; c < 3; ++c) {
+                        corners[c] = positions[tri[c]];
+                    }
+                    auto before = Cross(corners[0], corners[1], corners[2]);
+                    for (int c = 0; c < 3; ++c) {
+                        if (tri[c] == u) {
+                            corners[c] = positions[v];
+                        }
+                    }
+                    auto after = Cross(corners[0], corners[1], corners[2]);
+
+                    bFlips = glm::dot(before, after) <=
+                        MIN_NORMAL_DOT * glm::length(before) * glm::length(after);
+                }
+                if (bFlips) {
+                    continue;
+                }
+
+                collapseTo[u] = v;
+                quadrics[wedges[v]] += quadrics[wedges[u]];
+                maxError = std::max(maxError, candidate.mError);
+                removed += shared;
+                ++collapses;
+
+                for (uint32_t j = offsets[u]; j < offsets[u + 1]; ++j) {
+                    auto tri = &current[adjacency[j] * 3];
+                    for (int c = 0; c < 3; ++c) {
+                        bDirty[tri[c]] = true;
+                    }
+                }
+            }
+
+            if (collapses == 0) {
+                break;
+            }
+
+            size_t written = 0;
+            for (size_t t = 0; t < triangleCount; ++t) {
+                auto a = collapseTo[current[t * 3]];
+                auto b = collapseTo[current[t * 3 + 1]];
+                auto c = collapseTo[current[t * 3 + 2]];
+                if (a != b && b != c && a != c) {
+                    current[written++] = a;
+                    current[written++] = b;
+                    current[written++] = c;
+                }
+            }
+            current.resize(written);
+        }
+
+        std::copy(current.begin(), current.end(), destination);
+        if (resultError) {
+            *resultError = (float)std::sqrt(maxError);
+        }
+        return current.size();
+    }
+
+    std::vector<MeshLod> BuildLodChain(std::vector<uint32_t>& indices,
+        size_t indexCount, const glm::vec3* positions, size_t vertexCount,
+        const LodChainParams& params) {
+
+        std::vector<MeshLod> result;
+        if (indexCount == 0) {
+            return result;
+        }
+
+        float inf = std::numeric_limits<float>::infinity();
+        glm::vec3 lower(inf, inf, inf);
+        glm::vec3 upper(-inf, -inf, -inf);
+        for (size_t i = 0; i < indexCount; ++i) {
+            lower = glm::min(lower, positions[indices[i]]);
+            upper = glm::max(upper, positions[indices[i]]);
+        }
+        float maxError = params.mMaxError * 0.5f * glm::length(upper - lower);
+
+        size_t sourceFirst = 0;
+        size_t sourceCount = indexCount;
+        float error = 0.0f;
+        std::vector<uint32_t> level;
+
+        for (uint i = 0; i < params.mLevelCount; ++i) {
+            auto target = (size_t)((float)(sourceCount / 3) * params.mReduction) * 3;
+
+            // Every level starts from the one before it, so their errors
+            // add up. Each gets what the ones before left of the budget.
+            level.resize(sourceCount);
+            float levelError = 0.0f;
+            auto count = SimplifyMesh(level.data(), &indices[sourceFirst],
+                sourceCount, positions, vertexCount, target,
+                maxError - error, &levelError);
+
+            if (count == 0 || (float)count > MAX_LOD_KEEP * (float)sourceCount) {
+                break;
+            }
+
+            MeshLod lod;
+            lod.mFirstIndex = (uint32_t)indices.size();
+            lod.mIndexCount = (uint32_t)count;
+            lod.mError = error + levelError;
+            indices.insert(indices.end(), level.begin(), level.begin() + count);
+            result.emplace_back(lod);
+
+            sourceFirst = lod.mFirstIndex;
+            sourceCount = count;
+            error = lod.mError;
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,350 @@
+#include <okami/Meshlets.hpp>
+
+#include <glm/geometric.hpp>
+#include <glm/matrix.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace okami::core {
+
+    namespace {
+        // Normals closer to perpendicular to the cone axis than this
+        // make a cone too wide to be worth testing
+        constexpr float MIN_CONE_DOT = 0.1f;
+
+        inline glm::vec3 TriangleNormal(const uint32_t* tri,
+            const glm::vec3* positions) {
+            auto& p0 = positions[tri[0]];
+            auto n = glm::cross(positions[tri[1]] - p0, positions[tri[2]] - p0);
+            float length = glm::length(n);
+            return length > 0.0f ? n / length : glm::vec3(0.0f, 0.0f, 0.0f);
+        }
+
+        // The meshlet being filled and which vertices it has
+        struct MeshletBuilder {
+            std::vector<uint32_t> mVertices;
+            std::vector<uint32_t> mTriangles;
+            glm::vec3 mNormalSum = glm::vec3(0.0f, 0.0f, 0.0f);
+
+            // Meshlet each vertex was last added to, so membership is a
+            // single lookup
+            std::vector<uint32_t> mVertexOwner;
+            uint32_t mMeshletIndex = 0;
+
+            inline bool Contains(uint32_t v) const {
+                return mVertexOwner[v] == mMeshletIndex;
+            }
+
+            inline uint NewVertexCount(const uint32_t* tri) const {
+                uint result = 0;
+                for (int i = 0; i < 3; ++i) {
+                    // Degenerate triangles repeat vertices
+                    bool bRepeated = (i > 0 && tri[i] == tri[0]) ||
+                        (i > 1 && tri[i] == tri[1]);
+                    if (!Contains(tri[i]) && !bRepeated) {
+                        ++result;
+                    }
+                }
+                return result;
+            }
+
+            inline void Add(uint32_t t, const uint32_t* tri, const glm::vec3& normal) {
+                for (int i = 0; i < 3; ++i) {
+                    if (!Contains(tri[i])) {
+                        mVertexOwner[tri[i]] = mMeshletIndex;
+                        mVertices.emplace_back(tri[i]);
+                    }
+                }
+                mTriangles.emplace_back(t);
+                mNormalSum += normal;
+            }
+
+            inline void Reset() {
+                mVertices.clear();
+                mTriangles.clear();
+                mNormalSum = glm::vec3(0.0f, 0.0f, 0.0f);
+                ++mMeshletIndex;
+            }
+        };
+    }
+
+    std::vector<Meshlet> BuildMeshlets(uint32_t* indices, size_t indexCount,
+        const glm::vec3* positions, size_t vertexCount,
+        const MeshletParams& params) {
+
+        std::vector<Meshlet> result;
+        size_t triangleCount = indexCount / 3;
+        if (triangleCount == 0) {
+            return result;
+        }
+
+        uint maxVertices = std::max(params.mMaxVertices, 3u);
+        uint maxTriangles = std::max(params.mMaxTriangles, 1u);
+
+        std::vector<uint32_t> source(indices, indices + triangleCount * 3);
+
+        std::vector<glm::vec3> normals(triangleCount);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            normals[t] = TriangleNormal(&source[t * 3], positions);
+        }
+
+        // Triangles of every vertex
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        for (auto v : source) {
+            ++offsets[v + 1];
+        }
+        for (size_t v = 0; v < vertexCount; ++v) {
+            offsets[v + 1] += offsets[v];
+        }
+        std::vector<uint32_t> adjacency(source.size());
+        {
+            std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < source.size(); ++i) {
+                adjacency[fill[source[i]]++] = (uint32_t)(i / 3);
+            }
+        }
+
+        std::vector<bool> bEmitted(triangleCount, false);
+        size_t nextUnemitted = 0;
+        size_t written = 0;
+
+        MeshletBuilder builder;
+        builder.mVertexOwner.assign(vertexCount, UINT32_MAX);
+
+        auto finish = [&]() {
+            Meshlet meshlet;
+            meshlet.mFirstIndex = (uint32_t)(written * 3);
+            meshlet.mIndexCount = (uint32_t)(builder.mTriangles.size() * 3);
+            meshlet.mVertexCount = (uint32_t)builder.mVertices.size();
+
+            for (auto t : builder.mTriangles) {
+                std::copy(&source[t * 3], &source[t * 3] + 3, &indices[written * 3]);
+                ++written;
+            }
+
+            ComputeMeshletBounds(meshlet, indices, positions);
+            result.emplace_back(meshlet);
+            builder.Reset();
+        };
+
+        for (size_t emitted = 0; emitted < triangleCount; ++emitted) {
+            int best = -1;
+
+            if (!builder.mTriangles.empty()) {
+                // Grow towards neighbours that add few vertices and face
+                // the same way as the rest
+                auto axis = glm::length(builder.mNormalSum) > 0.0f ?
+                    glm::normalize(builder.mNormalSum) : glm::vec3(0.0f, 0.0f, 0.0f);
+                float bestScore = std::numeric_limits<float>::infinity();
+
+                for (auto v : builder.mVertices) {
+                    for (uint32_t j = offsets[v]; j < offsets[v + 1]; ++j) {
+                        auto t = adjacency[j];
+                        if (bEmitted[t]) {
+                            continue;
+                        }
+
+                        auto newVertices = builder.NewVertexCount(&source[t * 3]);
+                        if (builder.mVertices.size() + newVertices > maxVertices) {
+                            continue;
+                        }
+
+                        float score = (float)newVertices + params.mConeWeight *
+                            (1.0f - glm::dot(normals[t], axis));
+                        if (score < bestScore) {
+                            bestScore = score;
+                            best = (int)t;
+                        }
+                    }
+                }
+            }
+
+            if (best < 0) {
+                // Nothing connected fits, continue with whatever comes
+                // next in the index buffer
+                while (bEmitted[nextUnemitted]) {
+                    ++nextUnemitted;
+                }
+                best = (int)nextUnemitted;
+
+                auto newVertices = builder.NewVertexCount(&source[best * 3]);
+                if (!builder.mTriangles.empty() &&
+                    builder.mVertices.size() + newVertices > maxVertices) {
+                    finish();
+                }
+            }
+
+            bEmitted[best] = true;
+            builder.Add((uint32_t)best, &source[best * 3], normals[best]);
+
+            if (builder.mTriangles.size() >= maxTriangles ||
+                builder.mVertices.size() + 1 > maxVertices) {
+                finish();
+            }
+        }
+
+        if (!builder.mTriangles.empty()) {
+            finish();
+        }
+
+        return result;
+    }
+
+    void ComputeMeshletBounds(Meshlet& meshlet, const uint32_t* indices,
+        const glm::vec3* positions) {
+        auto begin = indices + meshlet.mFirstIndex;
+        auto end = begin + meshlet.mIndexCount;
+
+        float inf = std::numeric_limits<float>::infinity();
+        glm::vec3 lower(inf, inf, inf);
+        glm::vec3 upper(-inf, -inf, -inf);
+        for (auto it = begin; it != end; ++it) {
+            lower = glm::min(lower, positions[*it]);
+            upper = glm::max(upper, positions[*it]);
+        }
+
+        meshlet.mCenter = 0.5f * (lower + upper);
+        meshlet.mRadius = 0.0f;
+        for (auto it = begin; it != end; ++it) {
+            meshlet.mRadius = std::max(meshlet.mRadius,
+                glm::length(positions[*it] - meshlet.mCenter));
+        }
+
+        // The cone axis is the average normal, degenerate triangles
+        // don't face anywhere and are left out
+        glm::vec3 normalSum(0.0f, 0.0f, 0.0f);
+        for (auto it = begin; it != end; it += 3) {
+            normalSum += TriangleNormal(it, positions);
+        }
+
+        meshlet.mConeApex = meshlet.mCenter;
+        meshlet.mConeAxis = glm::vec3(0.0f, 0.0f, 0.0f);
+        meshlet.mConeCutoff = 1.0f;
+
+        if (glm::length(normalSum) <= 0.0f) {
+            return;
+        }
+
+        auto axis = glm::normalize(normalSum);
+        float minDot = 1.0f;
+        for (auto it = begin; it != end; it += 3) {
+            auto n = TriangleNormal(it, positions);
+            if (n != glm::vec3(0.0f, 0.0f, 0.0f)) {
+                minDot = std::min(minDot, glm::dot(n, axis));
+            }
+        }
+
+        meshlet.mConeAxis = axis;
+        if (minDot <= MIN_CONE_DOT) {
+            return;
+        }
+
+        // The apex is moved back along the axis until it is behind the
+        // plane of every triangle, so that anything seeing it from the
+        // back sees all of them from the back
+        float maxT = 0.0f;
+        for (auto it = begin; it != end; it += 3) {
+            auto n = TriangleNormal(it, positions);
+            if (n == glm::vec3(0.0f, 0.0f, 0.0f)) {
+                continue;
+            }
+            float dc = glm::dot(meshlet.mCenter - positions[it[0]], n);
+            float dn = glm::dot(axis, n);
+            maxT = std::max(maxT, dc / dn);
+        }
+
+        meshlet.mConeApex = meshlet.mCenter - axis * maxT;
+        meshlet.mConeCutoff = std::sqrt(1.0f - minDot * minDot);
+    }
+
+    MeshletCullView MeshletCullView::From(const glm::mat4& world,
+        const glm::mat4& viewProj,
+        const glm::vec3& viewOrigin,
+        const glm::vec3& viewDirection,
+        bool bOrthographic) {
+
+        MeshletCullView result;
+
+        // Planes of a clip space frustum, pulled back into the mesh's
+        // space (Gribb and Hartmann). The near plane is the one of GL's
+        // [-w, w] depth range, which is a little conservative for D3D's
+        // [0, w].
+        auto m = viewProj * world;
+        auto row = [&m](int i) {
+            return glm::vec4(m[0][i], m[1][i], m[2][i], m[3][i]);
+        };
+
+        result.mPlanes[0] = row(3) + row(0);
+        result.mPlanes[1] = row(3) - row(0);
+        result.mPlanes[2] = row(3) + row(1);
+        result.mPlanes[3] = row(3) - row(1);
+        result.mPlanes[4] = row(3) + row(2);
+        result.mPlanes[5] = row(3) - row(2);
+
+        for (auto& plane : result.mPlanes) {
+            float length = glm::length(glm::vec3(plane));
+            if (length > 0.0f) {
+                plane /= length;
+            }
+        }
+
+        auto inverseWorld = glm::inverse(world);
+        result.mViewOrigin = glm::vec3(inverseWorld * glm::vec4(viewOrigin, 1.0f));
+        result.mViewDirection = glm::vec3(inverseWorld * glm::vec4(viewDirection, 0.0f));
+        if (glm::length(result.mViewDirection) > 0.0f) {
+            result.mViewDirection = glm::normalize(result.mViewDirection);
+        }
+        result.bOrthographic = bOrthographic;
+        result.bCullBackfaces = glm::determinant(glm::mat3(world)) > 0.0f;
+        return result;
+    }
+
+    bool IsMeshletVisible(const Meshlet& meshlet, const MeshletCullView& view) {
+        for (auto& plane : view.mPlanes) {
+            if (glm::dot(glm::vec3(plane), meshlet.mCenter) + plane.w < -meshlet.mRadius) {
+                return false;
+            }
+        }
+
+        if (view.bCullBackfaces && meshlet.mConeCutoff < 1.0f) {
+            glm::vec3 toApex = view.bOrthographic ? view.mViewDirection :
+                meshlet.mConeApex - view.mViewOrigin;
+            float length = glm::length(toApex);
+            if (length > 0.0f &&
+                glm::dot(toApex, meshlet.mConeAxis) >= meshlet.mConeCutoff * length) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    size_t CullMeshlets(const std::vector<Meshlet>& meshlets,
+        const MeshletCullView& view, std::vector<IndexRange>& ranges) {
+        size_t visible = 0;
+        bool bExtendLast = false;
+
+        for (auto& meshlet : meshlets) {
+            if (!IsMeshletVisible(meshlet, view)) {
+                bExtendLast = false;
+                continue;
+            }
+
+            ++visible;
+            if (bExtendLast &&
+                ranges.back().mFirstIndex + ranges.back().mIndexCount == meshlet.mFirstIndex) {
+                ranges.back().mIndexCount += meshlet.mIndexCount;
+            } else {
+                IndexRange range;
+                range.mFirstIndex = meshlet.mFirstIndex;
+                range.mIndexCount = meshlet.mIndexCount;
+                ranges.emplace_back(range);
+            }
+            bExtendLast = true;
+        }
+
+        return visible;
+    }
+}
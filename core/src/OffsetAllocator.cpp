@@ -0,0 +1,437 @@
+#include <okami/OffsetAllocator.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace okami::core {
+
+    namespace {
+        constexpr uint32_t NONE = 0xFFFFFFFF;
+
+        inline uint32_t LeadingZeros(uint32_t value) {
+#ifdef _MSC_VER
+            unsigned long index;
+            return _BitScanReverse(&index, value) ? 31 - index : 32;
+#else
+            return value ? __builtin_clz(value) : 32;
+#endif
+        }
+
+        inline uint32_t TrailingZeros(uint32_t value) {
+#ifdef _MSC_VER
+            unsigned long index;
+            return _BitScanForward(&index, value) ? index : 32;
+#else
+            return value ? __builtin_ctz(value) : 32;
+#endif
+        }
+
+        // Index of the lowest bit of mask at or above start
+        inline uint32_t FindLowestSetBitAfter(uint32_t mask, uint32_t start) {
+            if (start >= 32) {
+                return NONE;
+            }
+            uint32_t after = mask & ~((1u << start) - 1);
+            return after ? TrailingZeros(after) : NONE;
+        }
+    }
+
+    namespace small_float {
+        constexpr uint32_t MANTISSA_BITS = 3;
+        constexpr uint32_t MANTISSA_VALUE = 1 << MANTISSA_BITS;
+        constexpr uint32_t MANTISSA_MASK = MANTISSA_VALUE - 1;
+
+        // Mantissa carries into the exponent when rounding up, which
+        // gives the right result because of the implicit leading one
+        uint32_t UintToFloatRoundUp(uint32_t size) {
+            uint32_t exponent = 0;
+            uint32_t mantissa = 0;
+
+            if (size < MANTISSA_VALUE) {
+                mantissa = size;
+            } else {
+                uint32_t highestSetBit = 31 - LeadingZeros(size);
+                uint32_t mantissaStartBit = highestSetBit - MANTISSA_BITS;
+                exponent = mantissaStartBit + 1;
+                mantissa = (size >> mantissaStartBit) & MANTISSA_MASK;
+
+                uint32_t lowBitsMask = (1u << mantissaStartBit) - 1;
+                if ((size & lowBitsMask) != 0) {
+                    ++mantissa;
+                }
+            }
+
+            return (exponent << MANTISSA_BITS) + mantissa;
+        }
+
+        uint32_t UintToFloatRoundDown(uint32_t size) {
+            uint32_t exponent = 0;
+            uint32_t mantissa = 0;
+
+            if (size < MANTISSA_VALUE) {
+                mantissa = size;
+            } else {
+                uint32_t highestSetBit = 31 - LeadingZeros(size);
+                uint32_t mantissaStartBit = highestSetBit - MANTISSA_BITS;
+                exponent = mantissaStartBit + 1;
+                mantissa = (size >> mantissaStartBit) & MANTISSA_MASK;
+            }
+
+            return (exponent << MANTISSA_BITS) | mantissa;
+        }
+
+        uint32_t FloatToUint(uint32_t floatValue) {
+            uint32_t exponent = floatValue >> MANTISSA_BITS;
+            uint32_t mantissa = floatValue & MANTISSA_MASK;
+            if (exponent == 0) {
+                return mantissa;
+            }
+            return (mantissa | MANTISSA_VALUE) << (exponent - 1);
+        }
+    }
+
+    OffsetAllocator::OffsetAllocator(uint32_t size, uint32_t maxAllocations) :
+        mSize(size),
+        mMaxAllocations(maxAllocations) {
+        Reset();
+    }
+
+    void OffsetAllocator::Reset() {
+        mFreeStorage = 0;
+        mAllocationCount = 0;
+        mUsedBinsTop = 0;
+        std::memset(mUsedBins, 0, sizeof(mUsedBins));
+        std::fill(std::begin(mBinIndices), std::end(mBinIndices), UNUSED);
+
+        mNodes.assign(mMaxAllocations, Node());
+        mFreeNodes.resize(mMaxAllocations);
+
+        // Handed out from the back, lowest nodes first
+        for (uint32_t i = 0; i < mMaxAllocations; ++i) {
+            mFreeNodes[i] = mMaxAllocations - i - 1;
+        }
+
+        if (mSize > 0) {
+            InsertNodeIntoBin(mSize, 0);
+        }
+    }
+
+    uint32_t OffsetAllocator::TakeNode() {
+        if (mFreeNodes.empty()) {
+            throw std::runtime_error("Offset allocator ran out of nodes!");
+        }
+        auto node = mFreeNodes.back();
+        mFreeNodes.pop_back();
+        mNodes[node].bLive = true;
+        return node;
+    }
+
+    void OffsetAllocator::ReleaseNode(uint32_t node) {
+        mNodes[node] = Node();
+        mFreeNodes.emplace_back(node);
+    }
+
+    uint32_t OffsetAllocator::InsertNodeIntoBin(uint32_t size, uint32_t offset) {
+        uint32_t bin = small_float::UintToFloatRoundDown(size);
+        uint32_t topBin = bin >> TOP_BINS_INDEX_SHIFT;
+        uint32_t leafBin = bin & LEAF_BINS_INDEX_MASK;
+
+        if (mBinIndices[bin] == UNUSED) {
+            mUsedBins[topBin] |= 1 << leafBin;
+            mUsedBinsTop |= 1 << topBin;
+        }
+
+        uint32_t head = mBinIndices[bin];
+        uint32_t node = TakeNode();
+
+        auto& entry = mNodes[node];
+        entry.mOffset = offset;
+        entry.mSize = size;
+        entry.mBinNext = head;
+        if (head != UNUSED) {
+            mNodes[head].mBinPrev = node;
+        }
+        mBinIndices[bin] = node;
+
+        mFreeStorage += size;
+        return node;
+    }
+
+    void OffsetAllocator::RemoveNodeFromBin(uint32_t node) {
+        auto& entry = mNodes[node];
+
+        if (entry.mBinPrev != UNUSED) {
+            mNodes[entry.mBinPrev].mBinNext = entry.mBinNext;
+            if (entry.mBinNext != UNUSED) {
+                mNodes[entry.mBinNext].mBinPrev = entry.mBinPrev;
+            }
+        } else {
+            // Head of its bin
+            uint32_t bin = small_float::UintToFloatRoundDown(entry.mSize);
+            uint32_t topBin = bin >> TOP_BINS_INDEX_SHIFT;
+            uint32_t leafBin = bin & LEAF_BINS_INDEX_MASK;
+
+            mBinIndices[bin] = entry.mBinNext;
+            if (entry.mBinNext != UNUSED) {
+                mNodes[entry.mBinNext].mBinPrev = UNUSED;
+            }
+
+            if (mBinIndices[bin] == UNUSED) {
+                mUsedBins[topBin] &= ~(1 << leafBin);
+                if (mUsedBins[topBin] == 0) {
+                    mUsedBinsTop &= ~(1 << topBin);
+                }
+            }
+        }
+
+        mFreeStorage -= entry.mSize;
+        ReleaseNode(node);
+    }
+
+    OffsetAllocation OffsetAllocator::Allocate(uint32_t size) {
+        // Splitting off the rest takes a node
+        if (size == 0 || mFreeNodes.empty()) {
+            return OffsetAllocation();
+        }
+
+        // Smallest bin whose ranges are all large enough
+        uint32_t minBin = small_float::UintToFloatRoundUp(size);
+        uint32_t minTopBin = minBin >> TOP_BINS_INDEX_SHIFT;
+        uint32_t minLeafBin = minBin & LEAF_BINS_INDEX_MASK;
+
+        uint32_t topBin = minTopBin;
+        uint32_t leafBin = NONE;
+
+        if (mUsedBinsTop & (1 << topBin)) {
+            leafBin = FindLowestSetBitAfter(mUsedBins[topBin], minLeafBin);
+        }
+
+        if (leafBin == NONE) {
+            topBin = FindLowestSetBitAfter(mUsedBinsTop, minTopBin + 1);
+            if (topBin == NONE) {
+                return OffsetAllocation();
+            }
+            // Any leaf of a larger top bin fits
+            leafBin = TrailingZeros(mUsedBins[topBin]);
+        }
+
+        uint32_t bin = (topBin << TOP_BINS_INDEX_SHIFT) | leafBin;
+        uint32_t node = mBinIndices[bin];
+
+        auto& entry = mNodes[node];
+        uint32_t totalSize = entry.mSize;
+        entry.mSize = size;
+        entry.bUsed = true;
+
+        mBinIndices[bin] = entry.mBinNext;
+        if (entry.mBinNext != UNUSED) {
+            mNodes[entry.mBinNext].mBinPrev = UNUSED;
+        }
+        entry.mBinPrev = UNUSED;
+        entry.mBinNext = UNUSED;
+        mFreeStorage -= totalSize;
+
+        if (mBinIndices[bin] == UNUSED) {
+            mUsedBins[topBin] &= ~(1 << leafBin);
+            if (mUsedBins[topBin] == 0) {
+                mUsedBinsTop &= ~(1 << topBin);
+            }
+        }
+
+        // The rest goes back as a range of its own
+        uint32_t remainder = totalSize - size;
+        if (remainder > 0) {
+            uint32_t rest = InsertNodeIntoBin(remainder, entry.mOffset + size);
+
+            auto& restEntry = mNodes[rest];
+            if (entry.mNeighborNext != UNUSED) {
+                mNodes[entry.mNeighborNext].mNeighborPrev = rest;
+            }
+            restEntry.mNeighborPrev = node;
+            restEntry.mNeighborNext = entry.mNeighborNext;
+            entry.mNeighborNext = rest;
+        }
+
+        ++mAllocationCount;
+
+        OffsetAllocation result;
+        result.mOffset = entry.mOffset;
+        result.mNode = node;
+        return result;
+    }
+
+    void OffsetAllocator::Free(const OffsetAllocation& allocation) {
+        if (!allocation.IsValid()) {
+            return;
+        }
+        if (allocation.mNode >= mNodes.size() || !mNodes[allocation.mNode].bUsed) {
+            throw std::runtime_error("Allocation is not in use!");
+        }
+
+        auto entry = mNodes[allocation.mNode];
+        uint32_t offset = entry.mOffset;
+        uint32_t size = entry.mSize;
+
+        // Merged with free neighbours on both sides
+        if (entry.mNeighborPrev != UNUSED && !mNodes[entry.mNeighborPrev].bUsed) {
+            auto prev = mNodes[entry.mNeighborPrev];
+            offset = prev.mOffset;
+            size += prev.mSize;
+            RemoveNodeFromBin(entry.mNeighborPrev);
+            entry.mNeighborPrev = prev.mNeighborPrev;
+        }
+
+        if (entry.mNeighborNext != UNUSED && !mNodes[entry.mNeighborNext].bUsed) {
+            auto next = mNodes[entry.mNeighborNext];
+            size += next.mSize;
+            RemoveNodeFromBin(entry.mNeighborNext);
+            entry.mNeighborNext = next.mNeighborNext;
+        }
+
+        ReleaseNode(allocation.mNode);
+        --mAllocationCount;
+
+        uint32_t combined = InsertNodeIntoBin(size, offset);
+        if (entry.mNeighborNext != UNUSED) {
+            mNodes[combined].mNeighborNext = entry.mNeighborNext;
+            mNodes[entry.mNeighborNext].mNeighborPrev = combined;
+        }
+        if (entry.mNeighborPrev != UNUSED) {
+            mNodes[combined].mNeighborPrev = entry.mNeighborPrev;
+            mNodes[entry.mNeighborPrev].mNeighborNext = combined;
+        }
+    }
+
+    void OffsetAllocator::Grow(uint32_t size) {
+        if (size <= mSize) {
+            return;
+        }
+
+        uint32_t added = size - mSize;
+
+        // The range that ends where the new space starts
+        uint32_t tail = UNUSED;
+        for (uint32_t i = 0; i < mNodes.size(); ++i) {
+            auto& entry = mNodes[i];
+            if (entry.bLive && entry.mNeighborNext == UNUSED &&
+                entry.mOffset + entry.mSize == mSize) {
+                tail = i;
+                break;
+            }
+        }
+
+        if (tail != UNUSED && !mNodes[tail].bUsed) {
+            auto entry = mNodes[tail];
+            RemoveNodeFromBin(tail);
+            uint32_t node = InsertNodeIntoBin(entry.mSize + added, entry.mOffset);
+            mNodes[node].mNeighborPrev = entry.mNeighborPrev;
+            if (entry.mNeighborPrev != UNUSED) {
+                mNodes[entry.mNeighborPrev].mNeighborNext = node;
+            }
+        } else {
+            uint32_t node = InsertNodeIntoBin(added, mSize);
+            mNodes[node].mNeighborPrev = tail;
+            if (tail != UNUSED) {
+                mNodes[tail].mNeighborNext = node;
+            }
+        }
+
+        mSize = size;
+    }
+
+    std::vector<OffsetAllocatorMove> OffsetAllocator::Defragment() {
+        std::vector<uint32_t> live;
+        live.reserve(mAllocationCount);
+        for (uint32_t i = 0; i < mNodes.size(); ++i) {
+            if (mNodes[i].bUsed) {
+                live.emplace_back(i);
+            }
+        }
+        std::sort(live.begin(), live.end(), [this](uint32_t a, uint32_t b) {
+            return mNodes[a].mOffset < mNodes[b].mOffset;
+        });
+
+        // Everything but the allocations is built again
+        mFreeStorage = 0;
+        mUsedBinsTop = 0;
+        std::memset(mUsedBins, 0, sizeof(mUsedBins));
+        std::fill(std::begin(mBinIndices), std::end(mBinIndices), UNUSED);
+
+        std::vector<OffsetAllocatorMove> moves;
+        uint32_t offset = 0;
+        uint32_t prev = UNUSED;
+        for (auto node : live) {
+            auto& entry = mNodes[node];
+            if (entry.mOffset != offset) {
+                moves.emplace_back(OffsetAllocatorMove{ node, entry.mOffset, offset, entry.mSize });
+                entry.mOffset = offset;
+            }
+            entry.mNeighborPrev = prev;
+            entry.mNeighborNext = UNUSED;
+            if (prev != UNUSED) {
+                mNodes[prev].mNeighborNext = node;
+            }
+            prev = node;
+            offset += entry.mSize;
+        }
+
+        mFreeNodes.clear();
+        for (uint32_t i = (uint32_t)mNodes.size(); i > 0; --i) {
+            if (!mNodes[i - 1].bUsed) {
+                mNodes[i - 1] = Node();
+                mFreeNodes.emplace_back(i - 1);
+            }
+        }
+
+        if (offset < mSize) {
+            uint32_t node = InsertNodeIntoBin(mSize - offset, offset);
+            mNodes[node].mNeighborPrev = prev;
+            if (prev != UNUSED) {
+                mNodes[prev].mNeighborNext = node;
+            }
+        }
+
+        return moves;
+    }
+
+    uint32_t OffsetAllocator::GetOffset(const OffsetAllocation& allocation) const {
+        return mNodes[allocation.mNode].mOffset;
+    }
+
+    uint32_t OffsetAllocator::GetAllocationSize(const OffsetAllocation& allocation) const {
+        if (!allocation.IsValid()) {
+            return 0;
+        }
+        return mNodes[allocation.mNode].mSize;
+    }
+
+    OffsetAllocatorReport OffsetAllocator::GetReport() const {
+        OffsetAllocatorReport report;
+        report.mTotalFree = mFreeStorage;
+        report.mAllocationCount = mAllocationCount;
+
+        // Sizes within a bin differ, the largest bin has to be searched
+        if (mUsedBinsTop) {
+            uint32_t topBin = 31 - LeadingZeros(mUsedBinsTop);
+            uint32_t leafBin = 31 - LeadingZeros(mUsedBins[topBin]);
+            uint32_t bin = (topBin << TOP_BINS_INDEX_SHIFT) | leafBin;
+            for (auto node = mBinIndices[bin]; node != UNUSED; node = mNodes[node].mBinNext) {
+                report.mLargestFree = std::max(report.mLargestFree, mNodes[node].mSize);
+            }
+        }
+        return report;
+    }
+
+    float OffsetAllocator::GetFragmentation() const {
+        auto report = GetReport();
+        if (report.mTotalFree == 0) {
+            return 0.0f;
+        }
+        return 1.0f - (float)report.mLargestFree / (float)report.mTotalFree;
+    }
+}
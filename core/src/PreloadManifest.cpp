@@ -0,0 +1,128 @@
+#include <okami/PreloadManifest.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#define MANIFEST_HEADER "okami-manifest 1"
+
+namespace okami::core {
+
+    void PreloadManifest::SortByFirstUse() {
+        std::stable_sort(mEntries.begin(), mEntries.end(),
+            [](const ManifestEntry& a, const ManifestEntry& b) {
+            return a.mFirstUseFrame < b.mFirstUseFrame;
+        });
+    }
+
+    void PreloadManifest::Save(std::ostream& stream) const {
+        stream << MANIFEST_HEADER << "\n";
+
+        // The path goes last so that it may contain spaces
+        for (auto& entry : mEntries) {
+            stream << entry.mFirstUseFrame << "\t"
+                << entry.mType << "\t"
+                << entry.mParams << "\t"
+                << entry.mPath.generic_string() << "\n";
+        }
+    }
+
+    void PreloadManifest::Save(const std::filesystem::path& path) const {
+        std::ofstream file(path);
+
+        if (!file) {
+            throw std::runtime_error("Failed to open " + path.string());
+        }
+
+        Save(file);
+    }
+
+    PreloadManifest PreloadManifest::Load(std::istream& stream) {
+        PreloadManifest result;
+        std::string line;
+
+        if (!std::getline(stream, line) || line != MANIFEST_HEADER) {
+            throw std::runtime_error("Not a resource manifest!");
+        }
+
+        while (std::getline(stream, line)) {
+            if (line.empty()) {
+                continue;
+            }
+
+            std::istringstream lineStream(line);
+            std::string frame, type, params, path;
+
+            if (!std::getline(lineStream, frame, '\t') ||
+                !std::getline(lineStream, type, '\t') ||
+                !std::getline(lineStream, params, '\t') ||
+                !std::getline(lineStream, path)) {
+                throw std::runtime_error("Malformed manifest entry: " + line);
+            }
+
+            ManifestEntry entry;
+            entry.mFirstUseFrame = std::stoull(frame);
+            entry.mType = (entt::id_type)std::stoull(type);
+            entry.mParams = std::move(params);
+            entry.mPath = path;
+            result.mEntries.emplace_back(std::move(entry));
+        }
+
+        return result;
+    }
+
+    PreloadManifest PreloadManifest::Load(const std::filesystem::path& path) {
+        std::ifstream file(path);
+
+        if (!file) {
+            throw std::runtime_error("Failed to open " + path.string());
+        }
+
+        return Load(file);
+    }
+
+    void ManifestRecorder::NextFrame() {
+        marl::lock lock(mMutex);
+        ++mFrame;
+    }
+
+    void ManifestRecorder::SetFrame(uint64_t frame) {
+        marl::lock lock(mMutex);
+        mFrame = frame;
+    }
+
+    uint64_t ManifestRecorder::GetFrame() const {
+        marl::lock lock(mMutex);
+        return mFrame;
+    }
+
+    void ManifestRecorder::Record(entt::id_type type,
+        const std::filesystem::path& path,
+        std::string&& params) {
+        marl::lock lock(mMutex);
+
+        if (!mSeen.emplace(path).second) {
+            return;
+        }
+
+        ManifestEntry entry;
+        entry.mPath = path;
+        entry.mType = type;
+        entry.mParams = std::move(params);
+        entry.mFirstUseFrame = mFrame;
+        mManifest.mEntries.emplace_back(std::move(entry));
+    }
+
+    PreloadManifest ManifestRecorder::GetManifest() const {
+        marl::lock lock(mMutex);
+        return mManifest;
+    }
+
+    void ManifestRecorder::Clear() {
+        marl::lock lock(mMutex);
+        mManifest.mEntries.clear();
+        mSeen.clear();
+        mFrame = 0;
+    }
+}
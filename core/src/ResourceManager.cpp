@@ -1,15 +1,39 @@
 #include <okami/ResourceManager.hpp>
-#include <okami/ext/ngraph.hpp>
 
 namespace okami::core {
 
-    using graph_t = NGraph::tGraph<resource_id_t>;
-
+    // Dependency edges point from a child to the parents keeping it
+    // alive. A resource's reference count is its number of parents, and
+    // it is collected once that count drops to zero after a parent dies.
+    // Nodes are indexed by slot index and keep their edge vectors when
+    // the slot is recycled, so steady state churn does not allocate.
     struct ResourceDigraph {
-        graph_t mGraph;
+        struct Node {
+            std::vector<resource_id_t> mParents;
+            std::vector<resource_id_t> mChildren;
+            bool bQueued = false;
+        };
+
+        std::vector<Node> mNodes;
+
+        inline Node& operator[](resource_id_t id) {
+            return mNodes[SlotId<resource_id_t>::Index(id)];
+        }
+
+        inline static void Unlink(
+            std::vector<resource_id_t>& list,
+            resource_id_t id) {
+            for (size_t i = 0; i < list.size(); ++i) {
+                if (list[i] == id) {
+                    list[i] = list.back();
+                    list.pop_back();
+                    return;
+                }
+            }
+        }
     };
 
-    ResourceManager::ResourceManager() : 
+    ResourceManager::ResourceManager() :
         mDependencies(std::make_unique<ResourceDigraph>()) {
     }
 
@@ -17,69 +41,176 @@ namespace okami::core {
     }
 
     resource_id_t ResourceManager::MakeNode() {
-        resource_id_t id = mCurrentId++;
-        mDependencies->mGraph.insert_vertex(id);
+        resource_id_t id = mIds.Alloc();
+        auto index = SlotId<resource_id_t>::Index(id);
+
+        auto& nodes = mDependencies->mNodes;
+        if (index >= nodes.size()) {
+            nodes.resize(index + 1);
+        }
+
         return id;
     }
 
+    void ResourceManager::ReserveNodes(size_t count) {
+        mDependencies->mNodes.reserve(count);
+    }
+
     void ResourceManager::SendToGarbage(resource_id_t id) {
-        mGarbage.emplace(id);
+        std::unique_lock<std::shared_mutex> lock(mMutex);
+        SendToGarbageLocked(id);
+    }
+
+    void ResourceManager::SendToGarbageLocked(resource_id_t id) {
+        // Resources being destroyed keep their id until their backend
+        // has been told, but have no desc anymore
+        if (!mIds.IsAlive(id) || !mResourceDescs.Contains(id)) {
+            return;
+        }
 
-        auto& graph = mDependencies->mGraph;
+        auto& node = (*mDependencies)[id];
+        if (!node.bQueued) {
+            node.bQueued = true;
+            mGarbage.emplace_back(id);
+
+            // GetOrAdd makes a new resource for the key from now on,
+            // rather than handing out one that is about to be freed
+            auto& desc = mResourceDescs.Get(id);
+            if (!desc.mKey.empty()) {
+                mKeyToResource.erase(desc.mKey);
+                desc.mKey.clear();
+            }
+        }
+    }
 
-        std::queue<resource_id_t> potentialGarbage;
-        potentialGarbage.emplace(id);
+    void ResourceManager::AddDependency(
+        resource_id_t child,
+        resource_id_t parent) {
+        std::unique_lock<std::shared_mutex> lock(mMutex);
+        AddDependencyLocked(child, parent);
+    }
 
-        do {
-            auto vert = potentialGarbage.front();
-            potentialGarbage.pop();
+    void ResourceManager::AddDependencyLocked(
+        resource_id_t child,
+        resource_id_t parent) {
+        if (!mResourceDescs.Contains(child) || !mResourceDescs.Contains(parent)) {
+            throw std::runtime_error("Dependency on a dead resource!");
+        }
+
+        auto& graph = *mDependencies;
+        graph[child].mParents.emplace_back(parent);
+        graph[parent].mChildren.emplace_back(child);
+    }
+
+    size_t ResourceManager::CollectGarbage(size_t budget) {
+        std::vector<DestroyedResource> destroyed;
+        size_t remaining;
+        {
+            std::unique_lock<std::shared_mutex> lock(mMutex);
+            remaining = CollectGarbageLocked(budget, destroyed);
+        }
+
+        FinishDestroy(destroyed);
+        return remaining;
+    }
 
-            if (graph.out_degree(vert) == 0 && vert != INVALID_RESOURCE) {
-                auto vertOut = graph.in_neighbors(vert);
+    size_t ResourceManager::CollectGarbageLocked(size_t budget,
+        std::vector<DestroyedResource>& destroyed) {
+        auto& graph = *mDependencies;
 
-                for (auto outIt = vertOut.begin(); outIt != vertOut.end(); ++outIt) {
-                    potentialGarbage.emplace(*outIt);
+        for (size_t i = 0; i < budget && mGarbageHead < mGarbage.size(); ++i) {
+            auto resId = mGarbage[mGarbageHead++];
+            auto& node = graph[resId];
+
+            // Detach from parents that are still around
+            for (auto parent : node.mParents) {
+                if (mIds.IsAlive(parent)) {
+                    ResourceDigraph::Unlink(graph[parent].mChildren, resId);
                 }
+            }
+            node.mParents.clear();
 
-                mGarbage.emplace(vert);
-                graph.remove_vertex(vert);
+            // Children only kept alive by this resource go next
+            for (auto child : node.mChildren) {
+                auto& childNode = graph[child];
+                ResourceDigraph::Unlink(childNode.mParents, resId);
+
+                if (childNode.mParents.empty()) {
+                    SendToGarbageLocked(child);
+                }
             }
+            node.mChildren.clear();
+            node.bQueued = false;
 
-        } while (!potentialGarbage.empty());
-    }
+            auto resDesc = mResourceDescs.Remove(resId);
 
-    void ResourceManager::AddDependency(
-        resource_id_t child, 
-        resource_id_t parent) {
-        auto& graph = mDependencies->mGraph;
+            // Erase records of this resource
+            if (resDesc.bHasLoadParams) {
+                mPathToResource.erase(resDesc.mPath);
+            }
+
+            // The backend is notified once mMutex is released
+            DestroyedResource entry;
+            entry.mId = resId;
+            entry.mType = resDesc.mType;
+            entry.mPointer = std::move(resDesc.mPointer);
+            entry.bIsManaged = resDesc.bIsManaged;
 
-        graph.insert_edge(child, parent);
+            auto destroyerIt = mDestroyNotifiers.find(resDesc.mType);
+            if (destroyerIt != mDestroyNotifiers.end()) {
+                entry.mNotifier = destroyerIt->second;
+            }
+
+            destroyed.emplace_back(std::move(entry));
+        }
+
+        if (mGarbageHead == mGarbage.size()) {
+            mGarbage.clear();
+            mGarbageHead = 0;
+        } else if (mGarbageHead > mGarbage.size() / 2) {
+            mGarbage.erase(mGarbage.begin(), mGarbage.begin() + mGarbageHead);
+            mGarbageHead = 0;
+        }
+
+        return mGarbage.size() - mGarbageHead;
     }
 
     void ResourceManager::CollectGarbage() {
-        for (auto resId : mGarbage) {
-            auto descIt = mResourceDescs.find(resId);
-            auto resDesc = descIt->second;
+        std::vector<DestroyedResource> destroyed;
+        {
+            std::unique_lock<std::shared_mutex> lock(mMutex);
+            while (mGarbageHead < mGarbage.size()) {
+                CollectGarbageLocked(mGarbage.size() - mGarbageHead,
+                    destroyed);
+            }
+        }
 
-            // Notify backend
-            auto destroyerIt = mDestroyNotifiers.find(resDesc.mType);
+        FinishDestroy(destroyed);
+    }
 
-            if (destroyerIt != mDestroyNotifiers.end()) {
-                destroyerIt->second(resId, resDesc.mPointer);
-            }
+    void ResourceManager::FinishDestroy(
+        std::vector<DestroyedResource>& destroyed) {
+        if (destroyed.empty()) {
+            return;
+        }
 
-            // Erase records of this resource
-            if (descIt->second.bHasLoadParams) {
-                mPathToResource.erase(descIt->second.mPath);
+        // Lookups already fail, the descs are gone. The pooled objects
+        // stay put until the backends are done with them.
+        for (auto& entry : destroyed) {
+            if (entry.mNotifier) {
+                entry.mNotifier(entry.mId, entry.mPointer);
             }
-            mResourceDescs.erase(descIt);
+        }
 
+        std::unique_lock<std::shared_mutex> lock(mMutex);
+        for (auto& entry : destroyed) {
             // Deallocate if resource is managed
-            if (resDesc.bIsManaged) {
-                mPools.Remove(resId, resDesc.mType);
+            if (entry.bIsManaged) {
+                mPools.Remove(entry.mId, entry.mType);
             }
-        }
 
-        mGarbage.clear();
+            // Recycle the slot, stale ids will fail the generation check
+            mIds.Free(entry.mId);
+        }
     }
-}
\ No newline at end of file
+}
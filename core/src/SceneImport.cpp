@@ -0,0 +1,333 @@
+#include <okami/SceneImport.hpp>
+#include <okami/AssimpImport.hpp>
+#include <okami/Parallel.hpp>
+#include <okami/System.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <map>
+#include <string>
+
+namespace okami::core {
+
+    namespace {
+        constexpr size_t NO_PARENT = SIZE_MAX;
+        // Nodes whose transforms a single task decomposes
+        constexpr size_t NODES_PER_TASK = 1024;
+
+        struct FlatNode {
+            const aiNode* mNode;
+            size_t mParent;
+            aiMatrix4x4 mWorld;
+        };
+
+        // Lists the nodes depth first, so that every node comes after
+        // its parent, and accumulates their world matrices
+        std::vector<FlatNode> FlattenNodes(const aiNode* root,
+            const aiMatrix4x4& base) {
+            std::vector<FlatNode> result;
+            std::vector<FlatNode> stack;
+            stack.emplace_back(FlatNode{root, NO_PARENT, base * root->mTransformation});
+
+            while (!stack.empty()) {
+                auto node = stack.back();
+                stack.pop_back();
+
+                size_t index = result.size();
+                result.emplace_back(node);
+
+                // Pushed in reverse so that siblings keep their order
+                for (auto i = node.mNode->mNumChildren; i > 0; --i) {
+                    auto child = node.mNode->mChildren[i - 1];
+                    stack.emplace_back(FlatNode{child, index,
+                        node.mWorld * child->mTransformation});
+                }
+            }
+
+            return result;
+        }
+
+        aiMatrix4x4 ToAssimp(const Transform& transform) {
+            auto& t = transform.mTranslation;
+            auto& s = transform.mScale;
+            auto& r = transform.mRotation;
+            return aiMatrix4x4(aiVector3D(s.x, s.y, s.z),
+                aiQuaternion(r.w, r.x, r.y, r.z),
+                aiVector3D(t.x, t.y, t.z));
+        }
+
+        // Shear, which non-uniformly scaled parents of rotated children
+        // can produce, has no Transform equivalent and is lost
+        Transform ToTransform(const aiMatrix4x4& matrix) {
+            aiVector3D scaling;
+            aiQuaternion rotation;
+            aiVector3D position;
+            matrix.Decompose(scaling, rotation, position);
+
+            Transform result;
+            result.mTranslation = glm::vec3(position.x, position.y, position.z);
+            result.mScale = glm::vec3(scaling.x, scaling.y, scaling.z);
+            result.mRotation = glm::quat(rotation.w, rotation.x, rotation.y, rotation.z);
+            return result;
+        }
+
+        // Path of a material's texture, relative to the model. Empty if
+        // there is none or it can't be read.
+        std::filesystem::path GetTexturePath(const aiMaterial* material,
+            aiTextureType type,
+            const std::filesystem::path& modelPath) {
+
+            aiString file;
+            if (material->GetTextureCount(type) == 0 ||
+                material->GetTexture(type, 0, &file) != aiReturn_SUCCESS) {
+                return std::filesystem::path();
+            }
+
+            std::string str = file.C_Str();
+            if (str.empty()) {
+                return std::filesystem::path();
+            }
+            // Textures embedded in the model are named *0, *1, ... and
+            // aren't supported
+            if (str[0] == '*') {
+                PrintWarning("Texture " + str + " of " + modelPath.string() +
+                    " is embedded in the model, which isn't supported!");
+                return std::filesystem::path();
+            }
+            std::replace(str.begin(), str.end(), '\\', '/');
+
+            auto path = (modelPath.parent_path() / str).lexically_normal();
+            if (!VirtualFileSystem::Default().Exists(path)) {
+                PrintWarning("Texture " + path.string() + " of " +
+                    modelPath.string() + " not found!");
+                return std::filesystem::path();
+            }
+            return path;
+        }
+    }
+
+    ImportedScene ImportScene(const std::filesystem::path& path,
+        const ByteView& bytes,
+        ResourceManager& resources,
+        Frame& frame,
+        entt::entity parent,
+        const SceneImportParams& params) {
+
+        auto scene = ReadAssimpScene(path, bytes);
+
+        if (!scene->mRootNode) {
+            throw std::runtime_error("Scene has no nodes!");
+        }
+
+        ImportedScene result;
+        auto nodes = FlattenNodes(scene->mRootNode, ToAssimp(params.mTransform));
+
+        // Only meshes that some node places are packed, each of them
+        // once
+        std::vector<bool> bMeshUsed(scene->mNumMeshes, false);
+        for (auto& node : nodes) {
+            for (uint i = 0; i < node.mNode->mNumMeshes; ++i) {
+                bMeshUsed[node.mNode->mMeshes[i]] = true;
+            }
+        }
+        // Meshes are freed once packed, what is needed of them later is
+        // kept aside
+        std::vector<uint> meshMaterials(scene->mNumMeshes);
+        for (uint i = 0; i < scene->mNumMeshes; ++i) {
+            bMeshUsed[i] = bMeshUsed[i] && IsTriangleMesh(scene->mMeshes[i]);
+            meshMaterials[i] = scene->mMeshes[i]->mMaterialIndex;
+        }
+
+        // Packing and optimizing is where imports spend their time
+        std::vector<Geometry::RawData> meshData(scene->mNumMeshes);
+        std::vector<std::exception_ptr> errors(scene->mNumMeshes);
+        ParallelFor(scene->mNumMeshes, [&](size_t i) {
+            if (!bMeshUsed[i]) {
+                return;
+            }
+            try {
+                meshData[i] = ToRawData(scene->mMeshes[i], params.mLayout);
+                delete scene->mMeshes[i];
+                scene->mMeshes[i] = nullptr;
+                OptimizeMesh(meshData[i], params.mOptimizeParams);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+        for (auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        {
+            std::vector<Geometry> geometries;
+            std::vector<uint> geometryMeshes;
+            for (uint i = 0; i < scene->mNumMeshes; ++i) {
+                if (bMeshUsed[i]) {
+                    geometries.emplace_back(std::move(meshData[i]));
+                    geometryMeshes.emplace_back(i);
+                }
+            }
+            meshData.clear();
+
+            auto handles = resources.AddBatch<Geometry>(std::move(geometries), frame);
+            result.mGeometries.resize(scene->mNumMeshes);
+            for (size_t i = 0; i < handles.size(); ++i) {
+                result.mGeometries[geometryMeshes[i]] = handles[i];
+            }
+        }
+
+        // Materials of the meshes that are used, and their textures.
+        // Textures are shared by path, between materials and with
+        // whatever was loaded before.
+        std::vector<bool> bMaterialUsed(scene->mNumMaterials, false);
+        for (uint i = 0; i < scene->mNumMeshes; ++i) {
+            if (bMeshUsed[i]) {
+                bMaterialUsed[meshMaterials[i]] = true;
+            }
+        }
+
+        struct MaterialTextures {
+            std::filesystem::path mAlbedo;
+            std::filesystem::path mNormal;
+        };
+
+        std::vector<MaterialTextures> materialTextures(scene->mNumMaterials);
+        std::map<std::filesystem::path, Handle<Texture>> textures;
+        std::vector<Texture> newTextures;
+        std::vector<std::filesystem::path> newTexturePaths;
+
+        auto requestTexture = [&](const std::filesystem::path& texturePath, bool bIsSRGB) {
+            if (texturePath.empty() || textures.find(texturePath) != textures.end()) {
+                return;
+            }
+
+            auto handle = resources.TryFind<Texture>(texturePath);
+            textures[texturePath] = handle;
+
+            if (handle.IsValid()) {
+                resources.AddDependency(handle, frame.GetResourceId());
+            } else {
+                newTextures.emplace_back(texturePath, LoadParams<Texture>(bIsSRGB, true));
+                newTexturePaths.emplace_back(texturePath);
+            }
+        };
+
+        for (uint i = 0; i < scene->mNumMaterials; ++i) {
+            if (!bMaterialUsed[i]) {
+                continue;
+            }
+            auto material = scene->mMaterials[i];
+            auto& entry = materialTextures[i];
+            entry.mAlbedo = GetTexturePath(material, aiTextureType_DIFFUSE, path);
+            entry.mNormal = GetTexturePath(material, aiTextureType_NORMALS, path);
+            requestTexture(entry.mAlbedo, true);
+            requestTexture(entry.mNormal, false);
+        }
+
+        {
+            auto handles = resources.AddBatch<Texture>(std::move(newTextures), frame);
+            for (size_t i = 0; i < handles.size(); ++i) {
+                textures[newTexturePaths[i]] = handles[i];
+            }
+        }
+
+        auto findTexture = [&textures](const std::filesystem::path& texturePath) {
+            return texturePath.empty() ? Handle<Texture>() : textures[texturePath];
+        };
+
+        {
+            std::vector<Material<StaticMesh>> materials;
+            std::vector<uint> materialIndices;
+            for (uint i = 0; i < scene->mNumMaterials; ++i) {
+                if (!bMaterialUsed[i]) {
+                    continue;
+                }
+
+                LambertSurface surface;
+                surface.mAlbedo = findTexture(materialTextures[i].mAlbedo);
+                surface.mNormal = findTexture(materialTextures[i].mNormal);
+
+                aiColor3D color(1.0f, 1.0f, 1.0f);
+                if (scene->mMaterials[i]->Get(AI_MATKEY_COLOR_DIFFUSE, color) == aiReturn_SUCCESS) {
+                    surface.mAlbedoFactor = glm::vec3(color.r, color.g, color.b);
+                }
+
+                materials.emplace_back(surface);
+                materialIndices.emplace_back(i);
+            }
+
+            auto handles = resources.AddBatch<Material<StaticMesh>>(std::move(materials), frame);
+            result.mMaterials.resize(scene->mNumMaterials);
+            for (size_t i = 0; i < handles.size(); ++i) {
+                result.mMaterials[materialIndices[i]] = handles[i];
+            }
+        }
+
+        for (auto& texture : textures) {
+            result.mTextures.emplace_back(texture.second);
+        }
+
+        // Decomposing world matrices is the only per node work that can
+        // be spread out, the registry isn't thread safe
+        std::vector<Transform> transforms(nodes.size());
+        size_t taskCount = (nodes.size() + NODES_PER_TASK - 1) / NODES_PER_TASK;
+        ParallelFor(taskCount, [&](size_t task) {
+            size_t begin = task * NODES_PER_TASK;
+            size_t end = std::min(begin + NODES_PER_TASK, nodes.size());
+            for (size_t i = begin; i < end; ++i) {
+                transforms[i] = ToTransform(nodes[i].mWorld);
+            }
+        });
+
+        std::vector<entt::entity> entities(nodes.size());
+        std::vector<uint> meshes;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            auto node = nodes[i].mNode;
+            auto nodeParent = nodes[i].mParent == NO_PARENT ?
+                parent : entities[nodes[i].mParent];
+
+            auto entity = frame.CreateEntity(nodeParent);
+            frame.Emplace<Transform>(entity, transforms[i]);
+            entities[i] = entity;
+
+            meshes.clear();
+            for (uint j = 0; j < node->mNumMeshes; ++j) {
+                if (result.mGeometries[node->mMeshes[j]].IsValid()) {
+                    meshes.emplace_back(node->mMeshes[j]);
+                }
+            }
+
+            // An entity holds a single StaticMesh, further meshes of the
+            // node go on children in the same place
+            for (auto mesh : meshes) {
+                auto meshEntity = entity;
+                if (meshes.size() > 1) {
+                    meshEntity = frame.CreateEntity(entity);
+                    frame.Emplace<Transform>(meshEntity, transforms[i]);
+                }
+
+                frame.Emplace<StaticMesh>(meshEntity, StaticMesh{
+                    result.mGeometries[mesh],
+                    result.mMaterials[meshMaterials[mesh]]});
+            }
+            result.mMeshInstanceCount += meshes.size();
+        }
+
+        result.mRoot = entities.front();
+        result.mNodeCount = nodes.size();
+        return result;
+    }
+
+    ImportedScene ImportScene(const std::filesystem::path& path,
+        ResourceManager& resources,
+        Frame& frame,
+        entt::entity parent,
+        const SceneImportParams& params) {
+
+        return ImportScene(path, VirtualFileSystem::Default().Read(path),
+            resources, frame, parent, params);
+    }
+}
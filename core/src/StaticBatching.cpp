@@ -0,0 +1,339 @@
+#include <okami/StaticBatching.hpp>
+#include <okami/Parallel.hpp>
+
+#include <glm/geometric.hpp>
+
+#include <cmath>
+#include <exception>
+#include <map>
+#include <tuple>
+
+namespace okami::core {
+
+    namespace {
+        // Meshes go into the same batches if they have the same key
+        struct ChunkKey {
+            resource_id_t mMaterial;
+            int mX;
+            int mY;
+            int mZ;
+
+            inline bool operator<(const ChunkKey& other) const {
+                return std::tie(mMaterial, mX, mY, mZ) <
+                    std::tie(other.mMaterial, other.mX, other.mY, other.mZ);
+            }
+        };
+
+        struct PendingBatch {
+            resource_id_t mMaterial;
+            std::vector<size_t> mSources;
+        };
+
+        inline glm::vec3 NormalizeOrKeep(const glm::vec3& v) {
+            float length = glm::length(v);
+            return length > 0.0f ? v / length : v;
+        }
+
+        // Appends a source's vertices and triangles in world space. Data
+        // the layout wants but the source doesn't have is filled in, so
+        // that every array of merged has one entry per vertex.
+        void AppendSource(Geometry::Data<>& merged,
+            const VertexFormat& layout,
+            const StaticBatchSource& source) {
+
+            auto data = source.mData->Unpack<uint32_t, glm::vec2, glm::vec3, glm::vec4>();
+            auto& transform = source.mTransform;
+
+            size_t base = merged.mPositions.size();
+            size_t count = source.mData->mDesc.mAttribs.mNumVertices;
+
+            if (data.mPositions.size() == count) {
+                for (auto& p : data.mPositions) {
+                    merged.mPositions.emplace_back(transform.ApplyToPoint(p));
+                }
+            } else {
+                merged.mPositions.resize(base + count, transform.mTranslation);
+            }
+
+            // Normals take the inverse transpose, which for a rotation
+            // and a scale is dividing by the scale
+            if (layout.mNormal >= 0) {
+                if (data.mNormals.size() == count) {
+                    for (auto& n : data.mNormals) {
+                        merged.mNormals.emplace_back(NormalizeOrKeep(
+                            transform.mRotation * (n / transform.mScale)));
+                    }
+                } else {
+                    merged.mNormals.resize(base + count, glm::vec3(0.0f, 0.0f, 0.0f));
+                }
+            }
+
+            if (layout.mTangent >= 0) {
+                if (data.mTangents.size() == count) {
+                    for (auto& t : data.mTangents) {
+                        merged.mTangents.emplace_back(
+                            NormalizeOrKeep(transform.ApplyToTangent(t)));
+                    }
+                } else {
+                    merged.mTangents.resize(base + count, glm::vec3(0.0f, 0.0f, 0.0f));
+                }
+            }
+
+            if (layout.mBitangent >= 0) {
+                if (data.mBitangents.size() == count) {
+                    for (auto& b : data.mBitangents) {
+                        merged.mBitangents.emplace_back(
+                            NormalizeOrKeep(transform.ApplyToTangent(b)));
+                    }
+                } else {
+                    merged.mBitangents.resize(base + count, glm::vec3(0.0f, 0.0f, 0.0f));
+                }
+            }
+
+            merged.mUVs.resize(layout.mUVs.size());
+            for (size_t i = 0; i < merged.mUVs.size(); ++i) {
+                auto& uvs = merged.mUVs[i];
+                if (i < data.mUVs.size() && data.mUVs[i].size() == count) {
+                    uvs.insert(uvs.end(), data.mUVs[i].begin(), data.mUVs[i].end());
+                } else {
+                    uvs.resize(base + count, glm::vec2(0.0f, 0.0f));
+                }
+            }
+
+            merged.mColors.resize(layout.mColors.size());
+            for (size_t i = 0; i < merged.mColors.size(); ++i) {
+                auto& colors = merged.mColors[i];
+                if (i < data.mColors.size() && data.mColors[i].size() == count) {
+                    colors.insert(colors.end(), data.mColors[i].begin(), data.mColors[i].end());
+                } else {
+                    colors.resize(base + count, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+                }
+            }
+
+            // Mirroring turns triangles inside out
+            auto& s = transform.mScale;
+            bool bFlip = s.x * s.y * s.z < 0.0f;
+
+            if (!source.mData->mDesc.bIsIndexed) {
+                data.mIndices.resize(count);
+                for (size_t i = 0; i < count; ++i) {
+                    data.mIndices[i] = (uint32_t)i;
+                }
+            }
+
+            for (size_t i = 0; i + 2 < data.mIndices.size(); i += 3) {
+                auto a = data.mIndices[i];
+                auto b = data.mIndices[i + 1];
+                auto c = data.mIndices[i + 2];
+                if (bFlip) {
+                    std::swap(b, c);
+                }
+                merged.mIndices.insert(merged.mIndices.end(), {
+                    (uint32_t)(base + a), (uint32_t)(base + b), (uint32_t)(base + c) });
+            }
+        }
+    }
+
+    std::vector<MergedStaticBatch> MergeStaticMeshes(
+        const std::vector<StaticBatchSource>& sources,
+        const VertexFormat& layout,
+        const StaticBatchParams& params) {
+
+        std::map<ChunkKey, std::vector<size_t>> chunks;
+        for (size_t i = 0; i < sources.size(); ++i) {
+            auto& source = sources[i];
+            if (!source.mData || source.mData->mDesc.mAttribs.mNumVertices == 0) {
+                continue;
+            }
+
+            auto bounds = source.mTransform.ApplyToAABB(source.mData->mBoundingBox);
+            auto center = 0.5f * (bounds.mLower + bounds.mUpper);
+
+            ChunkKey key{ source.mMaterial, 0, 0, 0 };
+            if (params.mChunkSize > 0.0f) {
+                key.mX = (int)std::floor(center.x / params.mChunkSize);
+                key.mY = (int)std::floor(center.y / params.mChunkSize);
+                key.mZ = (int)std::floor(center.z / params.mChunkSize);
+            }
+            chunks[key].emplace_back(i);
+        }
+
+        std::vector<PendingBatch> pending;
+        for (auto& [key, members] : chunks) {
+            pending.emplace_back(PendingBatch{ key.mMaterial, {} });
+            size_t vertexCount = 0;
+            for (auto i : members) {
+                // A single mesh above the limit still gets a batch
+                size_t count = sources[i].mData->mDesc.mAttribs.mNumVertices;
+                if (vertexCount > 0 && vertexCount + count > params.mMaxVertices) {
+                    pending.emplace_back(PendingBatch{ key.mMaterial, {} });
+                    vertexCount = 0;
+                }
+                pending.back().mSources.emplace_back(i);
+                vertexCount += count;
+            }
+        }
+
+        std::vector<MergedStaticBatch> result(pending.size());
+        std::vector<std::exception_ptr> errors(pending.size());
+
+        ParallelFor(pending.size(), [&](size_t b) {
+            try {
+                Geometry::Data<> merged;
+                for (auto i : pending[b].mSources) {
+                    AppendSource(merged, layout, sources[i]);
+                }
+
+                auto& batch = result[b];
+                batch.mData.Pack(layout, Geometry::DataSource<>(merged));
+                merged = Geometry::Data<>();
+
+                OptimizeMesh(batch.mData, params.mOptimizeParams);
+                batch.mBounds = batch.mData.mBoundingBox;
+                batch.mMaterial = pending[b].mMaterial;
+                batch.mSources = std::move(pending[b].mSources);
+            } catch (...) {
+                errors[b] = std::current_exception();
+            }
+        });
+
+        for (auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        return result;
+    }
+
+    StaticBatcher::StaticBatcher(ResourceManager& resources,
+        const StaticBatchParams& params) :
+        mResources(&resources),
+        mParams(params) {
+    }
+
+    StaticBatcher::~StaticBatcher() {
+        mUnmarked.dettach();
+        mMoved.dettach();
+        mMeshChanged.dettach();
+        mMeshRemoved.dettach();
+    }
+
+    void StaticBatcher::Attach(Frame& frame) {
+        if (mRegistry == &frame.Registry()) {
+            return;
+        }
+
+        mUnmarked.attach(frame);
+        mMoved.attach(frame);
+        mMeshChanged.attach(frame);
+        mMeshRemoved.attach(frame);
+        mRegistry = &frame.Registry();
+    }
+
+    size_t StaticBatcher::Build(Frame& frame, const VertexFormat& layout) {
+        Attach(frame);
+        Update(frame);
+
+        auto& registry = frame.Registry();
+
+        std::vector<entt::entity> entities;
+        std::vector<StaticBatchSource> sources;
+
+        auto view = registry.view<StaticTag, StaticMesh, Transform>(
+            entt::exclude<StaticBatchMember>);
+        for (auto entity : view) {
+            auto& mesh = view.get<StaticMesh>(entity);
+            auto geometry = mResources->TryGet<Geometry>(mesh.mGeometry);
+            if (!geometry || geometry->DataCPU().mVertexBuffers.empty()) {
+                continue;
+            }
+
+            StaticBatchSource source;
+            source.mData = &geometry->DataCPU();
+            source.mTransform = view.get<Transform>(entity);
+            source.mMaterial = mesh.mMaterial;
+
+            sources.emplace_back(source);
+            entities.emplace_back(entity);
+        }
+
+        auto merged = MergeStaticMeshes(sources, layout, mParams);
+
+        std::vector<Geometry> geometries;
+        geometries.reserve(merged.size());
+        for (auto& batch : merged) {
+            geometries.emplace_back(std::move(batch.mData));
+        }
+        auto handles = mResources->AddBatch<Geometry>(std::move(geometries), frame);
+
+        for (size_t i = 0; i < merged.size(); ++i) {
+            auto batchEntity = frame.CreateEntity();
+            frame.Emplace<StaticMesh>(batchEntity, StaticMesh{
+                handles[i],
+                Handle<Material<StaticMesh>>(merged[i].mMaterial)});
+
+            StaticBatch batch;
+            batch.mBounds = merged[i].mBounds;
+            for (auto s : merged[i].mSources) {
+                auto member = entities[s];
+                batch.mMembers.emplace_back(member);
+                frame.Emplace<StaticBatchMember>(member, StaticBatchMember{ batchEntity });
+                mMemberToBatch[member] = batchEntity;
+            }
+            frame.Emplace<StaticBatch>(batchEntity, std::move(batch));
+        }
+
+        return merged.size();
+    }
+
+    void StaticBatcher::Update(Frame& frame) {
+        std::vector<entt::entity> changed;
+        changed.insert(changed.end(), mUnmarked.begin(), mUnmarked.end());
+        changed.insert(changed.end(), mMoved.begin(), mMoved.end());
+        changed.insert(changed.end(), mMeshChanged.begin(), mMeshChanged.end());
+        changed.insert(changed.end(), mMeshRemoved.begin(), mMeshRemoved.end());
+
+        for (auto entity : changed) {
+            DissolveMemberBatch(frame, entity);
+        }
+
+        // Removing batches shows up as changes as well
+        mUnmarked.clear();
+        mMoved.clear();
+        mMeshChanged.clear();
+        mMeshRemoved.clear();
+    }
+
+    void StaticBatcher::DissolveMemberBatch(Frame& frame, entt::entity member) {
+        auto it = mMemberToBatch.find(member);
+        if (it != mMemberToBatch.end()) {
+            Dissolve(frame, it->second);
+        }
+    }
+
+    void StaticBatcher::Dissolve(Frame& frame, entt::entity batch) {
+        auto& registry = frame.Registry();
+        if (!registry.valid(batch)) {
+            return;
+        }
+
+        auto component = registry.try_get<StaticBatch>(batch);
+        if (!component) {
+            return;
+        }
+
+        for (auto member : component->mMembers) {
+            mMemberToBatch.erase(member);
+            if (registry.valid(member) && registry.try_get<StaticBatchMember>(member)) {
+                registry.remove<StaticBatchMember>(member);
+            }
+        }
+
+        auto mesh = registry.try_get<StaticMesh>(batch);
+        if (mesh) {
+            mResources->SendToGarbage(mesh->mGeometry);
+        }
+        frame.Destroy(batch);
+    }
+}
@@ -1,10 +1,14 @@
 #include <okami/Texture.hpp>
 #include <okami/MipGenerator.hpp>
+#include <okami/VirtualFileSystem.hpp>
 
 #include <cmath>
 #include <cstring>
+#include <fstream>
+#include <sstream>
 
 #include <lodepng.h>
+#include <cereal/archives/binary.hpp>
 #include <cmath>
 
 using namespace entt;
@@ -256,11 +260,11 @@ namespace okami::core {
 
 	    // Compute subresources and sizes
 		size_t currentOffset = 0;
-		for (size_t iarray = 0; iarray < mArraySizeOrDepth; ++iarray) {
+		for (size_t iarray = 0; iarray < GetArraySize(); ++iarray) {
 			for (size_t imip = 0; imip < mip_count; ++imip) {
 				size_t mip_width = mWidth;
 				size_t mip_height = mHeight;
-				size_t mip_depth = mArraySizeOrDepth;
+				size_t mip_depth = GetDepth();
 
 				mip_width = std::max<size_t>(mip_width >> imip, 1u);
 				mip_height = std::max<size_t>(mip_height >> imip, 1u);
@@ -291,11 +295,11 @@ namespace okami::core {
 
 	    // Compute subresources and sizes
 		size_t currentOffset = 0;
-		for (size_t iarray = 0; iarray < mArraySizeOrDepth; ++iarray) {
+		for (size_t iarray = 0; iarray < GetArraySize(); ++iarray) {
 			for (size_t imip = 0; imip < mip_count; ++imip) {
 				size_t mip_width = mWidth;
 				size_t mip_height = mHeight;
-				size_t mip_depth = mArraySizeOrDepth;
+				size_t mip_depth = GetDepth();
 
 				mip_width = std::max<size_t>(mip_width >> imip, 1u);
 				mip_height = std::max<size_t>(mip_height >> imip, 1u);
@@ -315,7 +319,7 @@ namespace okami::core {
 
         Texture::Data result;
         result.mDesc = desc;
-        result.mData.resize(sz);
+        result.mData = ByteBuffer(sz);
 
         return result;
     }
@@ -395,12 +399,6 @@ namespace okami::core {
         const LoadParams<Texture>& params, 
 		const std::vector<uint8_t>& image,
 		uint32_t width, uint32_t height) {
-        
-        std::vector<uint8_t> rawData;
-		std::vector<TextureSubResDataDesc> subDatas;
-		rawData.resize(image.size() * 2);
-
-		size_t currentIndx = 0;
 
 		TextureFormat format;
 
@@ -430,13 +428,14 @@ namespace okami::core {
     }
 
     Texture::Data LoadPNG(
-        const std::filesystem::path& path,
+        const ByteView& bytes,
         const LoadParams<Texture>& params) {
 
         Texture::Data data;
 		std::vector<uint8_t> image;
 		uint32_t width, height;
-		uint32_t error = lodepng::decode(image, width, height, path.string());
+		uint32_t error = lodepng::decode(image, width, height,
+			bytes.data(), bytes.size());
 
 		//if there's an error, display it
 		if (error)
@@ -448,14 +447,86 @@ namespace okami::core {
 			return LoadFromBytes_RGBA8_UNORM(params, image, width, height);
     }
 
+    constexpr uint32_t COOKED_TEXTURE_MAGIC = 0x58544B4F; // "OKTX"
+    constexpr uint32_t COOKED_TEXTURE_VERSION = 1;
+
+    void Texture::Data::Save(std::vector<uint8_t>& out,
+        const ChunkedPayloadParams& params) const {
+
+        std::ostringstream header;
+        {
+            cereal::BinaryOutputArchive archive(header);
+            archive(COOKED_TEXTURE_MAGIC);
+            archive(COOKED_TEXTURE_VERSION);
+            archive(mDesc);
+        }
+
+        WriteBlock(out, header.str());
+        WriteChunkedPayload(out, mData.data(), mData.size(), params);
+    }
+
+    void Texture::Data::Save(const std::filesystem::path& path,
+        const ChunkedPayloadParams& params) const {
+
+        std::vector<uint8_t> bytes;
+        Save(bytes, params);
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file || !file.write((const char*)bytes.data(), bytes.size())) {
+            throw std::runtime_error("Failed to write " + path.string());
+        }
+    }
+
+    static Texture::Data LoadCooked(const ByteView& bytes) {
+        ChunkedPayloadReader reader(bytes.data(), bytes.size());
+        Texture::Data data;
+
+        {
+            std::istringstream header(reader.ReadBlock());
+            cereal::BinaryInputArchive archive(header);
+
+            uint32_t magic = 0;
+            uint32_t version = 0;
+            archive(magic);
+            archive(version);
+
+            if (magic != COOKED_TEXTURE_MAGIC || 
+                version != COOKED_TEXTURE_VERSION) {
+                throw std::runtime_error("Not a cooked texture or unsupported version!");
+            }
+
+            archive(data.mDesc);
+        }
+
+        if (reader.PeekSize() != data.mDesc.GetByteSize()) {
+            throw std::runtime_error("Cooked texture size does not match its description!");
+        }
+
+        data.mData.resize(reader.PeekSize());
+        reader.Read(data.mData.data(), data.mData.size());
+        reader.Flush();
+        return data;
+    }
+
+    Texture::Data Texture::Data::Load(
+        const std::filesystem::path& path,
+        const LoadParams<Texture>& params) {
+        
+        return Load(path, VirtualFileSystem::Default().Read(path), params);
+    }
+
     Texture::Data Texture::Data::Load(
         const std::filesystem::path& path,
+        const ByteView& bytes,
         const LoadParams<Texture>& params) {
         
         auto ext = path.extension();
 
         if (ext == ".png") {
-            return LoadPNG(path, params);
+            return LoadPNG(bytes, params);
+        } else if (ext == ".oktex") {
+            // Mips and format were decided when the texture was cooked
+            return LoadCooked(bytes);
         } else {
             throw std::runtime_error("Unsupported file type!");
         }
@@ -468,6 +539,14 @@ namespace okami::core {
         return Texture(Texture::Data::Load(path, params));
     }
 
+    Texture Texture::Load(
+        const std::filesystem::path& path,
+        const ByteView& bytes,
+        const LoadParams<Texture>& params) {
+
+        return Texture(Texture::Data::Load(path, bytes, params));
+    }
+
 	Texture Texture::Prefabs::SolidColor(
 		uint width,
 		uint height,
@@ -509,6 +588,10 @@ namespace okami::core {
 			throw std::runtime_error("Texture doesn't have load data!");
 		}
 	}
+	size_t Texture::GetCPUByteSize() const {
+		return mData.mData.size();
+	}
+
 	const LoadParams<Texture>& Texture::GetLoadParams() const {
 		if (mLoadData) {
 			return mLoadData->mParams;
@@ -516,4 +599,22 @@ namespace okami::core {
 			throw std::runtime_error("Texture doesn't have load data!");
 		}
 	}
+
+	std::string Texture::EncodeLoadParams() const {
+		auto& params = GetLoadParams();
+		std::ostringstream stream;
+		stream << params.bIsSRGB << " " << params.bGenerateMips;
+		return stream.str();
+	}
+
+	LoadParams<Texture> Texture::DecodeLoadParams(const std::string& str) {
+		LoadParams<Texture> params;
+		std::istringstream stream(str);
+
+		if (!(stream >> params.bIsSRGB >> params.bGenerateMips)) {
+			throw std::runtime_error("Invalid texture load parameters: " + str);
+		}
+
+		return params;
+	}
 }
\ No newline at end of file
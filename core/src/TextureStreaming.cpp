@@ -0,0 +1,265 @@
+#include <okami/TextureStreaming.hpp>
+
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace okami::core {
+
+    MipChain MipChain::From(const Texture::Desc& desc) {
+        MipChain chain;
+        chain.mWidth = desc.mWidth;
+        chain.mHeight = desc.mHeight;
+        chain.mDepth = desc.GetDepth();
+        chain.mArraySize = desc.GetArraySize();
+        chain.mMipCount = desc.GetMipCount();
+        chain.mPixelByteSize = desc.GetPixelByteSize();
+        return chain;
+    }
+
+    uint64_t MipChain::GetMipByteSize(uint32_t mip) const {
+        uint64_t width = std::max<uint64_t>(mWidth >> mip, 1u);
+        uint64_t height = std::max<uint64_t>(mHeight >> mip, 1u);
+        uint64_t depth = std::max<uint64_t>(mDepth >> mip, 1u);
+        return width * height * depth * mArraySize * mPixelByteSize;
+    }
+
+    uint64_t MipChain::GetByteSize(uint32_t firstMip) const {
+        uint64_t result = 0;
+        for (uint32_t mip = firstMip; mip < mMipCount; ++mip) {
+            result += GetMipByteSize(mip);
+        }
+        return result;
+    }
+
+    uint32_t MipChain::GetTailMip(uint32_t tailDimension) const {
+        uint32_t mip = 0;
+        while (mip + 1 < mMipCount &&
+            std::max(mWidth >> mip, mHeight >> mip) > tailDimension) {
+            ++mip;
+        }
+        return mip;
+    }
+
+    uint32_t MipChain::GetDesiredMip(float screenSize) const {
+        float dimension = (float)std::max(mWidth, mHeight);
+
+        if (screenSize <= 0.0f) {
+            return mMipCount - 1;
+        }
+        if (screenSize >= dimension) {
+            return 0;
+        }
+
+        auto mip = (uint32_t)std::floor(std::log2(dimension / screenSize));
+        return std::min(mip, mMipCount - 1);
+    }
+
+    float EstimateScreenSize(const Camera& camera,
+        const glm::vec3& viewOrigin,
+        float viewportHeight,
+        const Transform& transform,
+        const BoundingBox& bounds) {
+
+        auto center = transform.ApplyToPoint(
+            0.5f * (bounds.mLower + bounds.mUpper));
+        auto extent = (bounds.mUpper - bounds.mLower) * transform.mScale;
+        float radius = 0.5f * glm::length(extent);
+
+        if (camera.mType == Camera::Type::ORTHOGRAPHIC) {
+            if (camera.mOrthoSize.y <= 0.0f) {
+                return viewportHeight;
+            }
+            return 2.0f * radius / camera.mOrthoSize.y * viewportHeight;
+        }
+
+        float distance = glm::length(center - viewOrigin);
+        if (distance <= radius) {
+            return viewportHeight;
+        }
+
+        float halfFov = std::tan(0.5f * camera.mFieldOfView);
+        return radius / (distance * halfFov) * viewportHeight;
+    }
+
+    void MipStreamer::SetResident(resource_id_t id, Entry& entry, uint32_t mip,
+        std::vector<std::pair<resource_id_t, uint32_t>>& changes) {
+        mResidentBytes -= entry.mChain.GetByteSize(entry.mResidentMip);
+        mResidentBytes += entry.mChain.GetByteSize(mip);
+        entry.mResidentMip = mip;
+        changes.emplace_back(id, mip);
+    }
+
+    uint32_t MipStreamer::Add(resource_id_t id, const MipChain& chain) {
+        marl::lock lock(mMutex);
+
+        auto tailMip = chain.GetTailMip(mParams.mTailDimension);
+
+        Entry entry;
+        entry.mChain = chain;
+        entry.mTailMip = tailMip;
+        entry.mResidentMip = tailMip;
+        entry.mDesiredMip = tailMip;
+        entry.mLastRequest = mUpdateCount;
+
+        mResidentBytes += chain.GetByteSize(tailMip);
+        mEntries.Add(id, std::move(entry));
+
+        return tailMip;
+    }
+
+    void MipStreamer::Remove(resource_id_t id) {
+        marl::lock lock(mMutex);
+
+        auto entry = mEntries.TryGet(id);
+        if (entry) {
+            mResidentBytes -= entry->mChain.GetByteSize(entry->mResidentMip);
+            mEntries.Remove(id);
+        }
+    }
+
+    bool MipStreamer::Contains(resource_id_t id) const {
+        marl::lock lock(mMutex);
+        return mEntries.Contains(id);
+    }
+
+    void MipStreamer::RequestScreenSize(resource_id_t id, float screenSize) {
+        marl::lock lock(mMutex);
+
+        auto entry = mEntries.TryGet(id);
+        if (entry) {
+            entry->mPendingScreenSize =
+                std::max(entry->mPendingScreenSize, screenSize);
+        }
+    }
+
+    void MipStreamer::Update() {
+        std::vector<std::pair<resource_id_t, uint32_t>> changes;
+        {
+            marl::lock lock(mMutex);
+            PlanUpdate(changes);
+        }
+
+        // The backend takes its own locks, and the renderer calls Add and
+        // Remove with those held. Calling it under mMutex would take them
+        // in the opposite order.
+        for (auto& [id, mip] : changes) {
+            mBackend->SetResidentMip(id, mip);
+        }
+    }
+
+    void MipStreamer::PlanUpdate(
+        std::vector<std::pair<resource_id_t, uint32_t>>& changes) {
+        ++mUpdateCount;
+
+        std::vector<std::pair<resource_id_t, Entry*>> entries;
+        entries.reserve(mEntries.Size());
+
+        mEntries.ForEach([&](resource_id_t id, Entry& entry) {
+            if (entry.mPendingScreenSize > 0.0f) {
+                entry.mScreenSize = entry.mPendingScreenSize;
+                entry.mLastRequest = mUpdateCount;
+                entry.mPendingScreenSize = 0.0f;
+            }
+
+            if (mUpdateCount - entry.mLastRequest > mParams.mUnusedUpdates) {
+                entry.mScreenSize = 0.0f;
+            }
+
+            entry.mDesiredMip = std::min(entry.mTailMip,
+                entry.mChain.GetDesiredMip(entry.mScreenSize));
+            entries.emplace_back(id, &entry);
+        });
+
+        // Drop mips that are finer than anybody needs
+        for (auto& [id, entry] : entries) {
+            if (entry->mResidentMip < entry->mDesiredMip) {
+                SetResident(id, *entry, entry->mDesiredMip, changes);
+            }
+        }
+
+        // Over budget, take the finest mip away from whoever was
+        // requested least recently and appears smallest on screen.
+        if (mResidentBytes > mParams.mBudget) {
+            std::sort(entries.begin(), entries.end(),
+                [](const auto& a, const auto& b) {
+                if (a.second->mLastRequest != b.second->mLastRequest) {
+                    return a.second->mLastRequest < b.second->mLastRequest;
+                }
+                return a.second->mScreenSize < b.second->mScreenSize;
+            });
+
+            bool bEvicted = true;
+            while (mResidentBytes > mParams.mBudget && bEvicted) {
+                bEvicted = false;
+                for (auto& [id, entry] : entries) {
+                    if (entry->mResidentMip < entry->mTailMip) {
+                        SetResident(id, *entry, entry->mResidentMip + 1, changes);
+                        bEvicted = true;
+                        break;
+                    }
+                }
+            }
+
+            // Anything we would upload now is what we just evicted
+            return;
+        }
+
+        // Add one finer mip to the textures that are furthest away from
+        // what they need, as long as it fits.
+        std::sort(entries.begin(), entries.end(),
+            [](const auto& a, const auto& b) {
+            auto gapA = (int)a.second->mResidentMip - (int)a.second->mDesiredMip;
+            auto gapB = (int)b.second->mResidentMip - (int)b.second->mDesiredMip;
+            if (gapA != gapB) {
+                return gapA > gapB;
+            }
+            return a.second->mScreenSize > b.second->mScreenSize;
+        });
+
+        uint32_t uploads = 0;
+        for (auto& [id, entry] : entries) {
+            if (uploads >= mParams.mMaxUploadsPerUpdate ||
+                entry->mResidentMip <= entry->mDesiredMip) {
+                break;
+            }
+
+            auto mip = entry->mResidentMip - 1;
+            auto extra = entry->mChain.GetMipByteSize(mip);
+
+            if (mResidentBytes + extra <= mParams.mBudget) {
+                SetResident(id, *entry, mip, changes);
+                ++uploads;
+            }
+        }
+    }
+
+    void MipStreamer::SetBudget(uint64_t bytes) {
+        marl::lock lock(mMutex);
+        mParams.mBudget = bytes;
+    }
+
+    uint64_t MipStreamer::GetBudget() const {
+        marl::lock lock(mMutex);
+        return mParams.mBudget;
+    }
+
+    uint64_t MipStreamer::GetResidentBytes() const {
+        marl::lock lock(mMutex);
+        return mResidentBytes;
+    }
+
+    uint32_t MipStreamer::GetResidentMip(resource_id_t id) const {
+        marl::lock lock(mMutex);
+        auto entry = mEntries.TryGet(id);
+        return entry ? entry->mResidentMip : 0;
+    }
+
+    uint32_t MipStreamer::GetDesiredMip(resource_id_t id) const {
+        marl::lock lock(mMutex);
+        auto entry = mEntries.TryGet(id);
+        return entry ? entry->mDesiredMip : 0;
+    }
+}
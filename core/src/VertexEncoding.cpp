@@ -0,0 +1,547 @@
+#include <okami/VertexEncoding.hpp>
+
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace okami::core {
+
+    uint16_t FloatToHalf(float value) {
+        constexpr uint32_t F32_INFINITY = 255u << 23;
+        // Smallest float that no longer fits into a half
+        constexpr uint32_t F16_LIMIT = (127u + 16u) << 23;
+        // Adding this lines the mantissa up with the one of a denormal
+        // half, the FPU does the rounding.
+        constexpr uint32_t DENORMAL_MAGIC = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        uint32_t sign = bits & 0x80000000u;
+        bits ^= sign;
+
+        uint16_t result;
+        if (bits >= F16_LIMIT) {
+            // Infinity stays infinity, NaN stays a quiet NaN
+            result = bits > F32_INFINITY ? 0x7E00 : 0x7C00;
+        } else if (bits < (113u << 23)) {
+            // Denormal or zero
+            float f, magic;
+            std::memcpy(&f, &bits, sizeof(f));
+            std::memcpy(&magic, &DENORMAL_MAGIC, sizeof(magic));
+            f += magic;
+            std::memcpy(&bits, &f, sizeof(bits));
+            result = (uint16_t)(bits - DENORMAL_MAGIC);
+        } else {
+            uint32_t mantissaOdd = (bits >> 13) & 1u;
+            // Rebias the exponent and round to nearest even
+            bits += ((uint32_t)(15 - 127) << 23) + 0xFFFu;
+            bits += mantissaOdd;
+            result = (uint16_t)(bits >> 13);
+        }
+
+        return result | (uint16_t)(sign >> 16);
+    }
+
+    float HalfToFloat(uint16_t value) {
+        constexpr uint32_t SHIFTED_EXPONENT = 0x7C00u << 13;
+        constexpr uint32_t MAGIC = 113u << 23;
+
+        uint32_t bits = ((uint32_t)value & 0x7FFFu) << 13;
+        uint32_t exponent = bits & SHIFTED_EXPONENT;
+        bits += (127u - 15u) << 23;
+
+        float result;
+        if (exponent == SHIFTED_EXPONENT) {
+            // Infinity or NaN
+            bits += (128u - 16u) << 23;
+            std::memcpy(&result, &bits, sizeof(result));
+        } else if (exponent == 0) {
+            // Denormal or zero, let the FPU renormalize
+            float magic;
+            bits += 1u << 23;
+            std::memcpy(&result, &bits, sizeof(result));
+            std::memcpy(&magic, &MAGIC, sizeof(magic));
+            result -= magic;
+        } else {
+            std::memcpy(&result, &bits, sizeof(result));
+        }
+
+        uint32_t resultBits;
+        std::memcpy(&resultBits, &result, sizeof(resultBits));
+        resultBits |= ((uint32_t)value & 0x8000u) << 16;
+        std::memcpy(&result, &resultBits, sizeof(result));
+        return result;
+    }
+
+    static inline float SignNotZero(float v) {
+        return v >= 0.0f ? 1.0f : -1.0f;
+    }
+
+    glm::vec2 OctahedralEncode(const glm::vec3& v) {
+        float l1 = std::abs(v.x) + std::abs(v.y) + std::abs(v.z);
+        if (!(l1 > 0.0f)) {
+            return glm::vec2(0.0f, 0.0f);
+        }
+
+        glm::vec2 e(v.x / l1, v.y / l1);
+        if (v.z < 0.0f) {
+            e = glm::vec2(
+                (1.0f - std::abs(e.y)) * SignNotZero(e.x),
+                (1.0f - std::abs(e.x)) * SignNotZero(e.y));
+        }
+        return e;
+    }
+
+    glm::vec3 OctahedralDecode(const glm::vec2& e) {
+        glm::vec3 v(e.x, e.y, 1.0f - std::abs(e.x) - std::abs(e.y));
+        if (v.z < 0.0f) {
+            v.x = (1.0f - std::abs(e.y)) * SignNotZero(e.x);
+            v.y = (1.0f - std::abs(e.x)) * SignNotZero(e.y);
+        }
+        return glm::normalize(v);
+    }
+
+    BoundingBox ComputeBounds(const uint8_t* src, size_t srcStride,
+        size_t count) {
+        float inf = std::numeric_limits<float>::infinity();
+
+        BoundingBox result;
+        result.mLower = glm::vec3(inf, inf, inf);
+        result.mUpper = glm::vec3(-inf, -inf, -inf);
+
+        for (size_t i = 0; i < count; ++i) {
+            float p[3];
+            std::memcpy(p, src + i * srcStride, sizeof(p));
+            for (int c = 0; c < 3; ++c) {
+                result.mLower[c] = std::min(result.mLower[c], p[c]);
+                result.mUpper[c] = std::max(result.mUpper[c], p[c]);
+            }
+        }
+
+        return result;
+    }
+
+    namespace {
+        // Codecs convert a single component. NaNs become the lowest
+        // value of integer types.
+        struct FloatCodec {
+            typedef float type;
+
+            static inline float Encode(float v) {
+                return v;
+            }
+            static inline float Decode(float q) {
+                return q;
+            }
+        };
+
+        struct HalfCodec {
+            typedef uint16_t type;
+
+            static inline uint16_t Encode(float v) {
+                return FloatToHalf(v);
+            }
+            static inline float Decode(uint16_t q) {
+                return HalfToFloat(q);
+            }
+        };
+
+        // [-1, 1] onto [-max, max], with the same rounding GPUs use
+        template <typename T>
+        struct SNormCodec {
+            typedef T type;
+            static constexpr float Max = (float)std::numeric_limits<T>::max();
+
+            static inline T Encode(float v) {
+                v = std::min(1.0f, std::max(-1.0f, v));
+                return (T)std::lround(v * Max);
+            }
+            static inline float Decode(T q) {
+                return std::max((float)q / Max, -1.0f);
+            }
+        };
+
+        template <typename T>
+        struct IsSNorm : std::false_type {};
+        template <typename T>
+        struct IsSNorm<SNormCodec<T>> : std::true_type {};
+
+        template <typename T>
+        struct UNormCodec {
+            typedef T type;
+            static constexpr float Max = (float)std::numeric_limits<T>::max();
+
+            static inline T Encode(float v) {
+                v = std::min(1.0f, std::max(0.0f, v));
+                return (T)std::lround(v * Max);
+            }
+            static inline float Decode(T q) {
+                return (float)q / Max;
+            }
+        };
+
+        // Plain integers, rounded and clamped to the range of T
+        template <typename T>
+        struct IntegerCodec {
+            typedef T type;
+
+            static inline T Encode(float v) {
+                double d = std::min((double)std::numeric_limits<T>::max(),
+                    std::max((double)std::numeric_limits<T>::lowest(), (double)v));
+                return (T)std::llround(d);
+            }
+            static inline float Decode(T q) {
+                return (float)q;
+            }
+        };
+
+        template <typename CodecT>
+        inline void Store(uint8_t* dest, uint component, float v) {
+            auto q = CodecT::Encode(v);
+            std::memcpy(dest + component * sizeof(q), &q, sizeof(q));
+        }
+
+        template <typename CodecT>
+        inline float Load(const uint8_t* src, uint component) {
+            typename CodecT::type q;
+            std::memcpy(&q, src + component * sizeof(q), sizeof(q));
+            return CodecT::Decode(q);
+        }
+
+        template <typename CodecT>
+        void EncodeDirect(uint8_t* dest, size_t destStride, uint destComponents,
+            const uint8_t* src, size_t srcStride, uint srcComponents,
+            size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                float v[4] = {};
+                std::memcpy(v, src + i * srcStride, srcComponents * sizeof(float));
+
+                auto out = dest + i * destStride;
+                for (uint c = 0; c < destComponents; ++c) {
+                    Store<CodecT>(out, c, v[c]);
+                }
+            }
+        }
+
+        template <typename CodecT>
+        void DecodeDirect(uint8_t* dest, size_t destStride, uint destComponents,
+            const uint8_t* src, size_t srcStride, uint srcComponents,
+            size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                auto in = src + i * srcStride;
+
+                float v[4] = {};
+                for (uint c = 0; c < std::min(srcComponents, destComponents); ++c) {
+                    v[c] = Load<CodecT>(in, c);
+                }
+                std::memcpy(dest + i * destStride, v, destComponents * sizeof(float));
+            }
+        }
+
+        // Integer encodings round each component on its own, which is
+        // not what's closest on the sphere. All four neighbouring grid
+        // points are decoded and the one nearest the original direction
+        // is kept, which cuts the worst case error by about a third.
+        template <typename CodecT>
+        void EncodeOctahedral(uint8_t* dest, size_t destStride, uint destComponents,
+            const uint8_t* src, size_t srcStride, size_t count) {
+            typedef typename CodecT::type T;
+
+            for (size_t i = 0; i < count; ++i) {
+                glm::vec3 n;
+                std::memcpy(&n[0], src + i * srcStride, sizeof(float) * 3);
+
+                auto e = OctahedralEncode(n);
+                auto out = dest + i * destStride;
+
+                if constexpr (IsSNorm<CodecT>::value) {
+                    constexpr float max = CodecT::Max;
+                    if (glm::dot(n, n) > 0.0f) {
+                        n = glm::normalize(n);
+                    }
+
+                    float x0 = std::floor(e.x * max);
+                    float y0 = std::floor(e.y * max);
+
+                    T best[2] = { CodecT::Encode(e.x), CodecT::Encode(e.y) };
+                    float bestError = std::numeric_limits<float>::infinity();
+
+                    // Compared by distance, dot products of nearly equal
+                    // unit vectors all round to one in float.
+                    for (int dy = 0; dy < 2; ++dy) {
+                        for (int dx = 0; dx < 2; ++dx) {
+                            T qx = (T)std::min(max, std::max(-max, x0 + dx));
+                            T qy = (T)std::min(max, std::max(-max, y0 + dy));
+                            auto error = OctahedralDecode(glm::vec2(
+                                CodecT::Decode(qx), CodecT::Decode(qy))) - n;
+                            float d = glm::dot(error, error);
+                            if (d < bestError) {
+                                bestError = d;
+                                best[0] = qx;
+                                best[1] = qy;
+                            }
+                        }
+                    }
+
+                    std::memcpy(out, best, sizeof(best));
+                } else {
+                    Store<CodecT>(out, 0, e.x);
+                    Store<CodecT>(out, 1, e.y);
+                }
+
+                for (uint c = 2; c < destComponents; ++c) {
+                    Store<CodecT>(out, c, 0.0f);
+                }
+            }
+        }
+
+        template <typename CodecT>
+        void DecodeOctahedral(uint8_t* dest, size_t destStride,
+            const uint8_t* src, size_t srcStride, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                auto in = src + i * srcStride;
+                auto v = OctahedralDecode(glm::vec2(
+                    Load<CodecT>(in, 0), Load<CodecT>(in, 1)));
+                std::memcpy(dest + i * destStride, &v[0], sizeof(float) * 3);
+            }
+        }
+
+        // A flat box would divide by zero, its positions all encode as
+        // the lower corner instead.
+        inline glm::vec3 InverseExtent(const BoundingBox& bounds) {
+            glm::vec3 extent = bounds.mUpper - bounds.mLower;
+            glm::vec3 result;
+            for (int c = 0; c < 3; ++c) {
+                result[c] = extent[c] > 0.0f ? 1.0f / extent[c] : 0.0f;
+            }
+            return result;
+        }
+
+        template <typename CodecT>
+        void EncodeBoundsRelative(uint8_t* dest, size_t destStride, uint destComponents,
+            const uint8_t* src, size_t srcStride, size_t count,
+            const BoundingBox& bounds) {
+            auto scale = InverseExtent(bounds);
+
+            for (size_t i = 0; i < count; ++i) {
+                glm::vec3 p;
+                std::memcpy(&p[0], src + i * srcStride, sizeof(float) * 3);
+                p = (p - bounds.mLower) * scale;
+
+                auto out = dest + i * destStride;
+                for (uint c = 0; c < destComponents; ++c) {
+                    Store<CodecT>(out, c, c < 3 ? p[c] : 0.0f);
+                }
+            }
+        }
+
+        template <typename CodecT>
+        void DecodeBoundsRelative(uint8_t* dest, size_t destStride,
+            const uint8_t* src, size_t srcStride, size_t count,
+            const BoundingBox& bounds) {
+            glm::vec3 extent = bounds.mUpper - bounds.mLower;
+
+            for (size_t i = 0; i < count; ++i) {
+                auto in = src + i * srcStride;
+                glm::vec3 p(Load<CodecT>(in, 0), Load<CodecT>(in, 1), Load<CodecT>(in, 2));
+                p = bounds.mLower + p * extent;
+                std::memcpy(dest + i * destStride, &p[0], sizeof(float) * 3);
+            }
+        }
+
+        // Calls func with the codec of a direct encoding of element
+        template <typename FuncT>
+        void WithCodec(const LayoutElement& element, FuncT&& func) {
+            bool bNorm = element.bIsNormalized;
+
+            switch (element.mValueType) {
+                case ValueType::FLOAT32:
+                    func(FloatCodec());
+                    break;
+                case ValueType::FLOAT16:
+                    func(HalfCodec());
+                    break;
+                case ValueType::INT8:
+                    bNorm ? func(SNormCodec<int8_t>()) : func(IntegerCodec<int8_t>());
+                    break;
+                case ValueType::INT16:
+                    bNorm ? func(SNormCodec<int16_t>()) : func(IntegerCodec<int16_t>());
+                    break;
+                case ValueType::INT32:
+                    func(IntegerCodec<int32_t>());
+                    break;
+                case ValueType::UINT8:
+                    bNorm ? func(UNormCodec<uint8_t>()) : func(IntegerCodec<uint8_t>());
+                    break;
+                case ValueType::UINT16:
+                    bNorm ? func(UNormCodec<uint16_t>()) : func(IntegerCodec<uint16_t>());
+                    break;
+                case ValueType::UINT32:
+                    func(IntegerCodec<uint32_t>());
+                    break;
+                default:
+                    throw std::runtime_error("Vertex attribute has no value type!");
+            }
+        }
+
+        // Octahedral vectors are signed, so only floats and SNORM work
+        template <typename FuncT>
+        void WithOctahedralCodec(const LayoutElement& element, FuncT&& func) {
+            switch (element.mValueType) {
+                case ValueType::FLOAT32:
+                    func(FloatCodec());
+                    break;
+                case ValueType::FLOAT16:
+                    func(HalfCodec());
+                    break;
+                case ValueType::INT8:
+                    func(SNormCodec<int8_t>());
+                    break;
+                case ValueType::INT16:
+                    func(SNormCodec<int16_t>());
+                    break;
+                default:
+                    throw std::runtime_error("Octahedral attributes must be floats or normalized INT8 or INT16!");
+            }
+        }
+
+        template <typename FuncT>
+        void WithBoundsRelativeCodec(const LayoutElement& element, FuncT&& func) {
+            switch (element.mValueType) {
+                case ValueType::UINT8:
+                    func(UNormCodec<uint8_t>());
+                    break;
+                case ValueType::UINT16:
+                    func(UNormCodec<uint16_t>());
+                    break;
+                default:
+                    throw std::runtime_error("Bounds relative attributes must be normalized UINT8 or UINT16!");
+            }
+        }
+    }
+
+    bool IsPlainFloat(const LayoutElement& element, uint components) {
+        return element.mEncoding == AttributeEncoding::DIRECT &&
+            element.mValueType == ValueType::FLOAT32 &&
+            element.mNumComponents == components;
+    }
+
+    void ValidateEncoding(const LayoutElement& element, uint components,
+        bool bIsPosition) {
+        if (element.mNumComponents < 1 || element.mNumComponents > 4) {
+            throw std::runtime_error("Vertex attributes must have 1 to 4 components!");
+        }
+        if (GetSize(element.mValueType) <= 0) {
+            throw std::runtime_error("Vertex attribute has no value type!");
+        }
+
+        bool bIs32Bit = element.mValueType == ValueType::INT32 ||
+            element.mValueType == ValueType::UINT32;
+        bool bIsSigned = element.mValueType == ValueType::INT8 ||
+            element.mValueType == ValueType::INT16;
+        bool bIsUnsigned = element.mValueType == ValueType::UINT8 ||
+            element.mValueType == ValueType::UINT16;
+        bool bIsFloat = element.mValueType == ValueType::FLOAT32 ||
+            element.mValueType == ValueType::FLOAT16;
+
+        switch (element.mEncoding) {
+            case AttributeEncoding::DIRECT:
+                if (bIs32Bit && element.bIsNormalized) {
+                    throw std::runtime_error("32 bit integer attributes can't be normalized!");
+                }
+                break;
+
+            case AttributeEncoding::OCTAHEDRAL:
+                if (bIsPosition || components != 3) {
+                    throw std::runtime_error("Only normals and tangents can be octahedral!");
+                }
+                if (element.mNumComponents < 2) {
+                    throw std::runtime_error("Octahedral attributes need 2 components!");
+                }
+                if (!bIsFloat && !(bIsSigned && element.bIsNormalized)) {
+                    throw std::runtime_error("Octahedral attributes must be floats or normalized INT8 or INT16!");
+                }
+                break;
+
+            case AttributeEncoding::BOUNDS_RELATIVE:
+                if (!bIsPosition) {
+                    throw std::runtime_error("Only positions can be bounds relative!");
+                }
+                if (element.mNumComponents < 3) {
+                    throw std::runtime_error("Bounds relative attributes need 3 components!");
+                }
+                if (!(bIsUnsigned && element.bIsNormalized)) {
+                    throw std::runtime_error("Bounds relative attributes must be normalized UINT8 or UINT16!");
+                }
+                break;
+
+            default:
+                throw std::runtime_error("Unknown attribute encoding!");
+        }
+    }
+
+    void EncodeAttribute(const LayoutElement& element,
+        uint8_t* dest, size_t destStride,
+        const uint8_t* src, size_t srcStride, uint srcComponents,
+        size_t count, const BoundingBox& bounds) {
+        uint destComponents = element.mNumComponents;
+
+        switch (element.mEncoding) {
+            case AttributeEncoding::DIRECT:
+                WithCodec(element, [&](auto codec) {
+                    EncodeDirect<decltype(codec)>(dest, destStride, destComponents,
+                        src, srcStride, std::min(srcComponents, 4u), count);
+                });
+                break;
+
+            case AttributeEncoding::OCTAHEDRAL:
+                WithOctahedralCodec(element, [&](auto codec) {
+                    EncodeOctahedral<decltype(codec)>(dest, destStride, destComponents,
+                        src, srcStride, count);
+                });
+                break;
+
+            case AttributeEncoding::BOUNDS_RELATIVE:
+                WithBoundsRelativeCodec(element, [&](auto codec) {
+                    EncodeBoundsRelative<decltype(codec)>(dest, destStride, destComponents,
+                        src, srcStride, count, bounds);
+                });
+                break;
+        }
+    }
+
+    void DecodeAttribute(const LayoutElement& element,
+        uint8_t* dest, size_t destStride, uint destComponents,
+        const uint8_t* src, size_t srcStride,
+        size_t count, const BoundingBox& bounds) {
+
+        switch (element.mEncoding) {
+            case AttributeEncoding::DIRECT:
+                WithCodec(element, [&](auto codec) {
+                    DecodeDirect<decltype(codec)>(dest, destStride, std::min(destComponents, 4u),
+                        src, srcStride, element.mNumComponents, count);
+                });
+                break;
+
+            case AttributeEncoding::OCTAHEDRAL:
+                WithOctahedralCodec(element, [&](auto codec) {
+                    DecodeOctahedral<decltype(codec)>(dest, destStride,
+                        src, srcStride, count);
+                });
+                break;
+
+            case AttributeEncoding::BOUNDS_RELATIVE:
+                WithBoundsRelativeCodec(element, [&](auto codec) {
+                    DecodeBoundsRelative<decltype(codec)>(dest, destStride,
+                        src, srcStride, count, bounds);
+                });
+                break;
+        }
+    }
+}
@@ -103,4 +103,52 @@ namespace okami::core {
 		layout.mElements = std::move(layoutElements);
 		return layout;
 	}
-}
\ No newline at end of file
+
+	static LayoutElement CompressedPosition() {
+		LayoutElement element(0, 0, 4, ValueType::UINT16, true, InputElementFrequency::PER_VERTEX);
+		element.mEncoding = AttributeEncoding::BOUNDS_RELATIVE;
+		return element;
+	}
+
+	static LayoutElement CompressedDirection(uint32_t inputIndex) {
+		LayoutElement element(inputIndex, 0, 2, ValueType::INT16, true, InputElementFrequency::PER_VERTEX);
+		element.mEncoding = AttributeEncoding::OCTAHEDRAL;
+		return element;
+	}
+
+	VertexFormat VertexFormat::PositionUVNormalCompressed() {
+		VertexFormat layout;
+		layout.mPosition = 0;
+		layout.mUVs = {1};
+		layout.mNormal = 2;
+
+		// There is no three component 16 bit format, the position is
+		// padded to four.
+		std::vector<LayoutElement> layoutElements = {
+			CompressedPosition(),
+			LayoutElement(1, 0, 2, ValueType::FLOAT16, false, InputElementFrequency::PER_VERTEX),
+			CompressedDirection(2),
+		};
+
+		layout.mElements = std::move(layoutElements);
+		return layout;
+	}
+
+	VertexFormat VertexFormat::PositionUVNormalTangentCompressed() {
+		VertexFormat layout;
+		layout.mPosition = 0;
+		layout.mUVs = {1};
+		layout.mNormal = 2;
+		layout.mTangent = 3;
+
+		std::vector<LayoutElement> layoutElements = {
+			CompressedPosition(),
+			LayoutElement(1, 0, 2, ValueType::FLOAT16, false, InputElementFrequency::PER_VERTEX),
+			CompressedDirection(2),
+			CompressedDirection(3),
+		};
+
+		layout.mElements = std::move(layoutElements);
+		return layout;
+	}
+}
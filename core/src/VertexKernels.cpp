@@ -0,0 +1,405 @@
+#include <okami/VertexKernels.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define OKAMI_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC lets any function use any instruction set, GCC and Clang have to
+// be told per function.
+#if defined(OKAMI_X86) && (defined(__GNUC__) || defined(__clang__))
+#define OKAMI_TARGET_SSE2 __attribute__((target("sse2")))
+#define OKAMI_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define OKAMI_TARGET_SSE2
+#define OKAMI_TARGET_AVX2
+#endif
+
+namespace okami::core {
+
+    constexpr size_t FLOAT3_SIZE = 3 * sizeof(float);
+
+    const char* GetName(SimdLevel level) {
+        switch (level) {
+            case SimdLevel::SCALAR:
+                return "scalar";
+            case SimdLevel::SSE2:
+                return "SSE2";
+            case SimdLevel::AVX2:
+                return "AVX2";
+        }
+        return "unknown";
+    }
+
+    template <uint N>
+    void CopyScalar(uint8_t* dest, size_t destStride,
+        const uint8_t* src, size_t srcStride, size_t count) {
+        constexpr size_t size = N * sizeof(float);
+
+        if (count == 0) {
+            return;
+        }
+
+        if (destStride == size && srcStride == size) {
+            std::memcpy(dest, src, size * count);
+            return;
+        }
+
+        for (size_t i = 0; i < count; ++i, dest += destStride, src += srcStride) {
+            std::memcpy(dest, src, size);
+        }
+    }
+
+    template <uint N>
+    void FillScalar(uint8_t* dest, size_t destStride,
+        size_t count, const float* value) {
+        for (size_t i = 0; i < count; ++i, dest += destStride) {
+            std::memcpy(dest, value, N * sizeof(float));
+        }
+    }
+
+    static void InitBounds(float lower[3], float upper[3]) {
+        for (uint c = 0; c < 3; ++c) {
+            lower[c] = std::numeric_limits<float>::infinity();
+            upper[c] = -std::numeric_limits<float>::infinity();
+        }
+    }
+
+    static void SetBounds(BoundingBox& bounds,
+        const float lower[3], const float upper[3]) {
+        bounds.mLower = glm::vec3(lower[0], lower[1], lower[2]);
+        bounds.mUpper = glm::vec3(upper[0], upper[1], upper[2]);
+    }
+
+    // Finishes up whatever the vector loops left over
+    static void CopyBoundsTail(uint8_t* dest, size_t destStride,
+        const uint8_t* src, size_t srcStride, size_t count,
+        float lower[3], float upper[3]) {
+        for (size_t i = 0; i < count; ++i, dest += destStride, src += srcStride) {
+            float v[3];
+            std::memcpy(v, src, FLOAT3_SIZE);
+            std::memcpy(dest, v, FLOAT3_SIZE);
+
+            for (uint c = 0; c < 3; ++c) {
+                lower[c] = std::min(lower[c], v[c]);
+                upper[c] = std::max(upper[c], v[c]);
+            }
+        }
+    }
+
+    void CopyBoundsScalar(uint8_t* dest, size_t destStride,
+        const uint8_t* src, size_t srcStride, size_t count,
+        BoundingBox& bounds) {
+        float lower[3];
+        float upper[3];
+        InitBounds(lower, upper);
+        CopyBoundsTail(dest, destStride, src, srcStride, count, lower, upper);
+        SetBounds(bounds, lower, upper);
+    }
+
+    // Lane j of the k-th register of a block holds component
+    // (k * lanes + j) % 3, since blocks start on a whole vertex.
+    static void ReduceBlockBounds(const float* lanes, size_t laneCount,
+        float lower[3], float upper[3], bool bUpper) {
+        for (size_t i = 0; i < laneCount; ++i) {
+            auto c = i % 3;
+            if (bUpper) {
+                upper[c] = std::max(upper[c], lanes[i]);
+            } else {
+                lower[c] = std::min(lower[c], lanes[i]);
+            }
+        }
+    }
+
+#ifdef OKAMI_X86
+    OKAMI_TARGET_SSE2
+    void Copy4SSE2(uint8_t* dest, size_t destStride,
+        const uint8_t* src, size_t srcStride, size_t count) {
+        if (count == 0) {
+            return;
+        }
+
+        if (destStride == 16 && srcStride == 16) {
+            std::memcpy(dest, src, 16 * count);
+            return;
+        }
+
+        for (size_t i = 0; i < count; ++i, dest += destStride, src += srcStride) {
+            _mm_storeu_ps((float*)dest, _mm_loadu_ps((const float*)src));
+        }
+    }
+
+    OKAMI_TARGET_SSE2
+    void Fill4SSE2(uint8_t* dest, size_t destStride,
+        size_t count, const float* value) {
+        auto v = _mm_loadu_ps(value);
+        for (size_t i = 0; i < count; ++i, dest += destStride) {
+            _mm_storeu_ps((float*)dest, v);
+        }
+    }
+
+    OKAMI_TARGET_SSE2
+    void CopyBoundsSSE2(uint8_t* dest, size_t destStride,
+        const uint8_t* src, size_t srcStride, size_t count,
+        BoundingBox& bounds) {
+        float lower[3];
+        float upper[3];
+        InitBounds(lower, upper);
+
+        size_t i = 0;
+
+        if (srcStride == FLOAT3_SIZE) {
+            // Four float3s are exactly three registers
+            auto inf = _mm_set1_ps(std::numeric_limits<float>::infinity());
+            auto ninf = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+            __m128 lo[3] = { inf, inf, inf };
+            __m128 hi[3] = { ninf, ninf, ninf };
+
+            for (; i + 4 <= count; i += 4) {
+                auto s = (const float*)(src + i * FLOAT3_SIZE);
+                __m128 v[3] = {
+                    _mm_loadu_ps(s),
+                    _mm_loadu_ps(s + 4),
+                    _mm_loadu_ps(s + 8)
+                };
+
+                for (uint k = 0; k < 3; ++k) {
+                    lo[k] = _mm_min_ps(lo[k], v[k]);
+                    hi[k] = _mm_max_ps(hi[k], v[k]);
+                }
+
+                auto d = dest + i * destStride;
+                if (destStride == FLOAT3_SIZE) {
+                    _mm_storeu_ps((float*)d, v[0]);
+                    _mm_storeu_ps((float*)d + 4, v[1]);
+                    _mm_storeu_ps((float*)d + 8, v[2]);
+                } else {
+                    for (uint j = 0; j < 4; ++j) {
+                        std::memcpy(d + j * destStride, s + j * 3, FLOAT3_SIZE);
+                    }
+                }
+            }
+
+            float lanes[12];
+            for (uint k = 0; k < 3; ++k) {
+                _mm_storeu_ps(&lanes[k * 4], lo[k]);
+            }
+            ReduceBlockBounds(lanes, 12, lower, upper, false);
+            for (uint k = 0; k < 3; ++k) {
+                _mm_storeu_ps(&lanes[k * 4], hi[k]);
+            }
+            ReduceBlockBounds(lanes, 12, lower, upper, true);
+        } else if (count > 0) {
+            // Interleaved source. Reading a whole register runs into the
+            // next element, which is fine for all but the last one.
+            auto lo = _mm_set1_ps(std::numeric_limits<float>::infinity());
+            auto hi = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+
+            for (; i + 1 < count; ++i) {
+                auto v = _mm_loadu_ps((const float*)(src + i * srcStride));
+                lo = _mm_min_ps(lo, v);
+                hi = _mm_max_ps(hi, v);
+                std::memcpy(dest + i * destStride, src + i * srcStride, FLOAT3_SIZE);
+            }
+
+            float lanes[4];
+            _mm_storeu_ps(lanes, lo);
+            ReduceBlockBounds(lanes, 3, lower, upper, false);
+            _mm_storeu_ps(lanes, hi);
+            ReduceBlockBounds(lanes, 3, lower, upper, true);
+        }
+
+        CopyBoundsTail(dest + i * destStride, destStride,
+            src + i * srcStride, srcStride, count - i, lower, upper);
+        SetBounds(bounds, lower, upper);
+    }
+
+    OKAMI_TARGET_AVX2
+    void CopyBoundsAVX2(uint8_t* dest, size_t destStride,
+        const uint8_t* src, size_t srcStride, size_t count,
+        BoundingBox& bounds) {
+        float lower[3];
+        float upper[3];
+        InitBounds(lower, upper);
+
+        size_t i = 0;
+
+        if (srcStride == FLOAT3_SIZE) {
+            // Eight float3s are exactly three registers
+            auto inf = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+            auto ninf = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+            __m256 lo[3] = { inf, inf, inf };
+            __m256 hi[3] = { ninf, ninf, ninf };
+
+            for (; i + 8 <= count; i += 8) {
+                auto s = (const float*)(src + i * FLOAT3_SIZE);
+                __m256 v[3] = {
+                    _mm256_loadu_ps(s),
+                    _mm256_loadu_ps(s + 8),
+                    _mm256_loadu_ps(s + 16)
+                };
+
+                for (uint k = 0; k < 3; ++k) {
+                    lo[k] = _mm256_min_ps(lo[k], v[k]);
+                    hi[k] = _mm256_max_ps(hi[k], v[k]);
+                }
+
+                auto d = dest + i * destStride;
+                if (destStride == FLOAT3_SIZE) {
+                    _mm256_storeu_ps((float*)d, v[0]);
+                    _mm256_storeu_ps((float*)d + 8, v[1]);
+                    _mm256_storeu_ps((float*)d + 16, v[2]);
+                } else {
+                    // Masked stores leave the neighbouring attributes alone
+                    auto mask = _mm_setr_epi32(-1, -1, -1, 0);
+                    for (uint j = 0; j < 8; ++j) {
+                        _mm_maskstore_ps((float*)(d + j * destStride), mask,
+                            _mm_maskload_ps(s + j * 3, mask));
+                    }
+                }
+            }
+
+            float lanes[24];
+            for (uint k = 0; k < 3; ++k) {
+                _mm256_storeu_ps(&lanes[k * 8], lo[k]);
+            }
+            ReduceBlockBounds(lanes, 24, lower, upper, false);
+            for (uint k = 0; k < 3; ++k) {
+                _mm256_storeu_ps(&lanes[k * 8], hi[k]);
+            }
+            ReduceBlockBounds(lanes, 24, lower, upper, true);
+        } else {
+            // Masked loads never touch memory past the element
+            auto mask = _mm_setr_epi32(-1, -1, -1, 0);
+            auto lo = _mm_set1_ps(std::numeric_limits<float>::infinity());
+            auto hi = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+
+            for (; i < count; ++i) {
+                auto v = _mm_maskload_ps((const float*)(src + i * srcStride), mask);
+                lo = _mm_min_ps(lo, v);
+                hi = _mm_max_ps(hi, v);
+                _mm_maskstore_ps((float*)(dest + i * destStride), mask, v);
+            }
+
+            float lanes[4];
+            _mm_storeu_ps(lanes, lo);
+            ReduceBlockBounds(lanes, 3, lower, upper, false);
+            _mm_storeu_ps(lanes, hi);
+            ReduceBlockBounds(lanes, 3, lower, upper, true);
+        }
+
+        CopyBoundsTail(dest + i * destStride, destStride,
+            src + i * srcStride, srcStride, count - i, lower, upper);
+        SetBounds(bounds, lower, upper);
+    }
+#endif
+
+    static VertexKernels MakeScalarKernels() {
+        VertexKernels result;
+        result.mLevel = SimdLevel::SCALAR;
+        result.mCopy[0] = nullptr;
+        result.mCopy[1] = &CopyScalar<1>;
+        result.mCopy[2] = &CopyScalar<2>;
+        result.mCopy[3] = &CopyScalar<3>;
+        result.mCopy[4] = &CopyScalar<4>;
+        result.mFill[0] = nullptr;
+        result.mFill[1] = &FillScalar<1>;
+        result.mFill[2] = &FillScalar<2>;
+        result.mFill[3] = &FillScalar<3>;
+        result.mFill[4] = &FillScalar<4>;
+        result.mCopyBounds = &CopyBoundsScalar;
+        return result;
+    }
+
+    SimdLevel GetSupportedSimdLevel() {
+        static SimdLevel level = []() {
+#if defined(OKAMI_X86) && defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0);
+            int maxLeaf = info[0];
+
+            __cpuid(info, 1);
+            bool bSSE2 = info[3] & (1 << 26);
+            bool bOSXSave = info[2] & (1 << 27);
+
+            if (maxLeaf >= 7 && bOSXSave && (_xgetbv(0) & 6) == 6) {
+                __cpuidex(info, 7, 0);
+                if (info[1] & (1 << 5)) {
+                    return SimdLevel::AVX2;
+                }
+            }
+            return bSSE2 ? SimdLevel::SSE2 : SimdLevel::SCALAR;
+#elif defined(OKAMI_X86)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                return SimdLevel::AVX2;
+            }
+            if (__builtin_cpu_supports("sse2")) {
+                return SimdLevel::SSE2;
+            }
+            return SimdLevel::SCALAR;
+#else
+            return SimdLevel::SCALAR;
+#endif
+        }();
+        return level;
+    }
+
+    const VertexKernels& GetVertexKernels(SimdLevel level) {
+        static VertexKernels scalar = MakeScalarKernels();
+
+#ifdef OKAMI_X86
+        // Only the kernels that gain from wider registers are replaced
+        static VertexKernels sse2 = []() {
+            auto result = MakeScalarKernels();
+            result.mLevel = SimdLevel::SSE2;
+            result.mCopy[4] = &Copy4SSE2;
+            result.mFill[4] = &Fill4SSE2;
+            result.mCopyBounds = &CopyBoundsSSE2;
+            return result;
+        }();
+
+        static VertexKernels avx2 = []() {
+            auto result = sse2;
+            result.mLevel = SimdLevel::AVX2;
+            result.mCopyBounds = &CopyBoundsAVX2;
+            return result;
+        }();
+
+        level = std::min(level, GetSupportedSimdLevel());
+        switch (level) {
+            case SimdLevel::AVX2:
+                return avx2;
+            case SimdLevel::SSE2:
+                return sse2;
+            default:
+                return scalar;
+        }
+#else
+        return scalar;
+#endif
+    }
+
+    static std::atomic<const VertexKernels*> gActiveKernels = nullptr;
+
+    const VertexKernels& GetVertexKernels() {
+        auto kernels = gActiveKernels.load(std::memory_order_acquire);
+        if (!kernels) {
+            kernels = &GetVertexKernels(GetSupportedSimdLevel());
+            gActiveKernels.store(kernels, std::memory_order_release);
+        }
+        return *kernels;
+    }
+
+    void SetSimdLevel(SimdLevel level) {
+        gActiveKernels.store(&GetVertexKernels(level), std::memory_order_release);
+    }
+}
@@ -0,0 +1,733 @@
+#include <okami/VirtualFileSystem.hpp>
+
+#include <marl/conditionvariable.h>
+#include <marl/scheduler.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <thread>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define OKAMI_IO_URING
+#endif
+#endif
+
+namespace okami::core {
+
+    // Blocking read of part of a file, throws on errors
+    static void ReadFileRange(const std::filesystem::path& path,
+        uint64_t offset, uint64_t size, uint8_t* dst) {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file) {
+            throw std::runtime_error("Failed to open " + path.string());
+        }
+
+        if (size > 0 && (!file.seekg((std::streamoff)offset) ||
+            !file.read((char*)dst, (std::streamsize)size))) {
+            throw std::runtime_error("Failed to read " + path.string());
+        }
+    }
+
+    static bool TryStripPrefix(const std::filesystem::path& path,
+        const std::filesystem::path& prefix,
+        std::filesystem::path& rest) {
+        auto it = path.begin();
+        for (auto& part : prefix) {
+            if (it == path.end() || *it != part) {
+                return false;
+            }
+            ++it;
+        }
+
+        rest.clear();
+        for (; it != path.end(); ++it) {
+            rest /= *it;
+        }
+        return true;
+    }
+
+    bool DirectoryMount::Resolve(const std::filesystem::path& path,
+        ResolvedFile& out) const {
+        auto full = mRoot.empty() ? path : mRoot / path;
+
+        std::error_code ec;
+        if (!std::filesystem::is_regular_file(full, ec)) {
+            return false;
+        }
+
+        auto size = std::filesystem::file_size(full, ec);
+        if (ec) {
+            return false;
+        }
+
+        out.bInMemory = false;
+        out.mFile = std::move(full);
+        out.mOffset = 0;
+        out.mSize = size;
+        return true;
+    }
+
+    EmbeddedMount::EmbeddedMount(const embedded_file_loader_t& factory) {
+        file_map_t files;
+        factory(&files);
+
+        mFiles.reserve(files.size());
+        for (auto& file : files) {
+            Add(file.first, reinterpret_cast<const uint8_t*>(file.second),
+                std::strlen(file.second));
+        }
+    }
+
+    void EmbeddedMount::Add(const std::filesystem::path& path,
+        const uint8_t* data, size_t size) {
+        mFiles[path] = ByteView(data, size);
+    }
+
+    bool EmbeddedMount::Resolve(const std::filesystem::path& path,
+        ResolvedFile& out) const {
+        auto it = mFiles.find(path);
+        if (it == mFiles.end()) {
+            return false;
+        }
+
+        out.bInMemory = true;
+        out.mMemory = it->second;
+        return true;
+    }
+
+    constexpr uint32_t PACK_MAGIC = 0x4B504B4F; // "OKPK"
+    constexpr uint32_t PACK_VERSION = 1;
+
+    template <typename T>
+    static void WritePOD(std::ofstream& file, const T& value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    static T ReadPOD(std::ifstream& file) {
+        T value;
+        if (!file.read(reinterpret_cast<char*>(&value), sizeof(T))) {
+            throw std::runtime_error("Pack file is truncated!");
+        }
+        return value;
+    }
+
+    PackMount::PackMount(const std::filesystem::path& packPath) :
+        mPackPath(packPath) {
+        std::ifstream file(packPath, std::ios::binary);
+
+        if (!file) {
+            throw std::runtime_error("Failed to open " + packPath.string());
+        }
+
+        if (ReadPOD<uint32_t>(file) != PACK_MAGIC ||
+            ReadPOD<uint32_t>(file) != PACK_VERSION) {
+            throw std::runtime_error("Not a pack file or unsupported version!");
+        }
+
+        auto count = ReadPOD<uint32_t>(file);
+        mEntries.reserve(count);
+
+        for (uint32_t i = 0; i < count; ++i) {
+            std::string name(ReadPOD<uint32_t>(file), '\0');
+            if (!file.read(name.data(), name.size())) {
+                throw std::runtime_error("Pack file is truncated!");
+            }
+
+            Entry entry;
+            entry.mOffset = ReadPOD<uint64_t>(file);
+            entry.mSize = ReadPOD<uint64_t>(file);
+            mEntries.emplace(std::filesystem::path(name), entry);
+        }
+    }
+
+    bool PackMount::Resolve(const std::filesystem::path& path,
+        ResolvedFile& out) const {
+        auto it = mEntries.find(path);
+        if (it == mEntries.end()) {
+            return false;
+        }
+
+        out.bInMemory = false;
+        out.mFile = mPackPath;
+        out.mOffset = it->second.mOffset;
+        out.mSize = it->second.mSize;
+        return true;
+    }
+
+    void PackMount::Write(const std::filesystem::path& packPath,
+        const std::vector<std::pair<
+            std::filesystem::path, std::filesystem::path>>& files) {
+
+        // Data starts right after the table of contents
+        std::vector<std::string> names;
+        std::vector<uint64_t> sizes;
+        uint64_t offset = sizeof(uint32_t) * 3;
+
+        for (auto& [name, source] : files) {
+            names.emplace_back(name.lexically_normal().generic_string());
+            sizes.emplace_back(std::filesystem::file_size(source));
+            offset += sizeof(uint32_t) + names.back().size() +
+                sizeof(uint64_t) * 2;
+        }
+
+        std::ofstream file(packPath, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("Failed to write " + packPath.string());
+        }
+
+        WritePOD(file, PACK_MAGIC);
+        WritePOD(file, PACK_VERSION);
+        WritePOD(file, (uint32_t)files.size());
+
+        for (size_t i = 0; i < files.size(); ++i) {
+            WritePOD(file, (uint32_t)names[i].size());
+            file.write(names[i].data(), names[i].size());
+            WritePOD(file, offset);
+            WritePOD(file, sizes[i]);
+            offset += sizes[i];
+        }
+
+        std::vector<uint8_t> bytes;
+        for (size_t i = 0; i < files.size(); ++i) {
+            bytes.resize(sizes[i]);
+            ReadFileRange(files[i].second, 0, sizes[i], bytes.data());
+            file.write((const char*)bytes.data(), bytes.size());
+        }
+
+        if (!file) {
+            throw std::runtime_error("Failed to write " + packPath.string());
+        }
+    }
+
+    class ThreadPoolReadBackend : public IFileReadBackend {
+    private:
+        uint mThreadCount;
+
+        marl::mutex mMutex;
+        marl::ConditionVariable mCondition;
+        std::deque<FileReadRequest> mQueue;
+        std::vector<std::thread> mThreads;
+        bool bShutdown = false;
+
+        void ThreadMain() {
+            while (true) {
+                FileReadRequest request;
+
+                {
+                    marl::lock lock(mMutex);
+                    mCondition.wait(lock, [this] {
+                        return bShutdown || !mQueue.empty();
+                    });
+
+                    // Queued reads still finish on shutdown
+                    if (mQueue.empty()) {
+                        return;
+                    }
+
+                    request = std::move(mQueue.front());
+                    mQueue.pop_front();
+                }
+
+                std::string error;
+                try {
+                    ReadFileRange(request.mFile, request.mOffset,
+                        request.mSize, request.mDst);
+                } catch (std::exception& e) {
+                    error = e.what();
+                }
+
+                request.mOnDone(error);
+            }
+        }
+
+    public:
+        inline ThreadPoolReadBackend(uint threadCount) :
+            mThreadCount(std::max(1u, threadCount)) {
+        }
+
+        ~ThreadPoolReadBackend() {
+            {
+                marl::lock lock(mMutex);
+                bShutdown = true;
+            }
+            mCondition.notify_all();
+
+            for (auto& thread : mThreads) {
+                thread.join();
+            }
+        }
+
+        void Submit(FileReadRequest&& request) override {
+            {
+                marl::lock lock(mMutex);
+
+                // Threads are only started once something is read
+                while (mThreads.size() < mThreadCount) {
+                    mThreads.emplace_back([this]() { ThreadMain(); });
+                }
+
+                mQueue.emplace_back(std::move(request));
+            }
+            mCondition.notify_one();
+        }
+
+        const char* GetName() const override {
+            return "threads";
+        }
+    };
+
+    std::unique_ptr<IFileReadBackend> CreateThreadPoolReadBackend(
+        uint threadCount) {
+        return std::make_unique<ThreadPoolReadBackend>(threadCount);
+    }
+
+#ifdef OKAMI_IO_URING
+    // Keeps up to queueDepth reads in the kernel at once without any
+    // thread blocking per read. One thread reaps completions and hands
+    // them to the callbacks. Talks to the kernel directly, so there is no
+    // dependency on liburing.
+    class IOUringReadBackend : public IFileReadBackend {
+    private:
+        struct PendingRead {
+            FileReadRequest mRequest;
+            int mFd = -1;
+            uint64_t mDone = 0;
+            iovec mIov;
+        };
+
+        int mRingFd = -1;
+        unsigned mEntries = 0;
+
+        void* mSqRing = MAP_FAILED;
+        void* mCqRing = MAP_FAILED;
+        size_t mSqRingSize = 0;
+        size_t mCqRingSize = 0;
+        io_uring_sqe* mSqes = (io_uring_sqe*)MAP_FAILED;
+        size_t mSqesSize = 0;
+
+        unsigned* mSqTail = nullptr;
+        unsigned* mSqMask = nullptr;
+        unsigned* mSqArray = nullptr;
+        unsigned* mCqHead = nullptr;
+        unsigned* mCqTail = nullptr;
+        unsigned* mCqMask = nullptr;
+        io_uring_cqe* mCqes = nullptr;
+
+        // Guards the submission ring. One slot is kept free for the
+        // wake up on shutdown.
+        marl::mutex mMutex;
+        marl::ConditionVariable mSpaceCondition;
+        unsigned mInFlight = 0;
+        bool bShutdown = false;
+
+        std::thread mCompletionThread;
+
+        static int Enter(int fd, unsigned toSubmit,
+            unsigned minComplete, unsigned flags) {
+            return (int)syscall(__NR_io_uring_enter, fd,
+                toSubmit, minComplete, flags, nullptr, 0);
+        }
+
+        // Called with mMutex held
+        void Push(uint8_t opcode, PendingRead* read) {
+            auto tail = *mSqTail;
+            auto index = tail & *mSqMask;
+            auto sqe = &mSqes[index];
+
+            std::memset(sqe, 0, sizeof(io_uring_sqe));
+            sqe->opcode = opcode;
+            sqe->fd = -1;
+
+            if (read) {
+                read->mIov.iov_base = read->mRequest.mDst + read->mDone;
+                read->mIov.iov_len = read->mRequest.mSize - read->mDone;
+
+                sqe->fd = read->mFd;
+                sqe->addr = (uint64_t)(uintptr_t)&read->mIov;
+                sqe->len = 1;
+                sqe->off = read->mRequest.mOffset + read->mDone;
+            }
+            sqe->user_data = (uint64_t)(uintptr_t)read;
+
+            mSqArray[index] = index;
+            __atomic_store_n(mSqTail, tail + 1, __ATOMIC_RELEASE);
+
+            while (Enter(mRingFd, 1, 0, 0) < 0 &&
+                (errno == EINTR || errno == EAGAIN || errno == EBUSY)) {
+                std::this_thread::yield();
+            }
+        }
+
+        void Complete(PendingRead* read, int result) {
+            auto& request = read->mRequest;
+            std::string error;
+
+            if (result == -EINTR || result == -EAGAIN) {
+                marl::lock lock(mMutex);
+                Push(IORING_OP_READV, read);
+                return;
+            } else if (result < 0) {
+                error = "Failed to read " + request.mFile.string() +
+                    ": " + std::strerror(-result);
+            } else if (result == 0) {
+                error = "Failed to read " + request.mFile.string() +
+                    ": unexpected end of file";
+            } else {
+                read->mDone += (uint64_t)result;
+
+                // Short read, go again for the rest
+                if (read->mDone < request.mSize) {
+                    marl::lock lock(mMutex);
+                    Push(IORING_OP_READV, read);
+                    return;
+                }
+            }
+
+            close(read->mFd);
+            auto onDone = std::move(request.mOnDone);
+            delete read;
+
+            {
+                marl::lock lock(mMutex);
+                --mInFlight;
+            }
+            mSpaceCondition.notify_one();
+
+            onDone(error);
+        }
+
+        void CompletionMain() {
+            while (true) {
+                if (Enter(mRingFd, 0, 1, IORING_ENTER_GETEVENTS) < 0 &&
+                    errno != EINTR) {
+                    break;
+                }
+
+                auto head = *mCqHead;
+                auto tail = __atomic_load_n(mCqTail, __ATOMIC_ACQUIRE);
+
+                for (; head != tail; ++head) {
+                    auto& cqe = mCqes[head & *mCqMask];
+                    auto read = (PendingRead*)(uintptr_t)cqe.user_data;
+                    auto result = cqe.res;
+                    __atomic_store_n(mCqHead, head + 1, __ATOMIC_RELEASE);
+
+                    if (read) {
+                        Complete(read, result);
+                    }
+                }
+
+                marl::lock lock(mMutex);
+                if (bShutdown && mInFlight == 0) {
+                    return;
+                }
+            }
+        }
+
+    public:
+        IOUringReadBackend() = default;
+
+        bool Init(unsigned queueDepth) {
+            io_uring_params params;
+            std::memset(&params, 0, sizeof(params));
+
+            mRingFd = (int)syscall(__NR_io_uring_setup,
+                std::max(2u, queueDepth + 1), &params);
+            if (mRingFd < 0) {
+                return false;
+            }
+
+            mEntries = params.sq_entries;
+            mSqRingSize = params.sq_off.array +
+                params.sq_entries * sizeof(unsigned);
+            mCqRingSize = params.cq_off.cqes +
+                params.cq_entries * sizeof(io_uring_cqe);
+
+            bool bSingleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+            if (bSingleMap) {
+                mSqRingSize = mCqRingSize = std::max(mSqRingSize, mCqRingSize);
+            }
+
+            mSqRing = mmap(nullptr, mSqRingSize, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_SQ_RING);
+            if (mSqRing == MAP_FAILED) {
+                return false;
+            }
+
+            if (bSingleMap) {
+                mCqRing = mSqRing;
+            } else {
+                mCqRing = mmap(nullptr, mCqRingSize, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_CQ_RING);
+                if (mCqRing == MAP_FAILED) {
+                    return false;
+                }
+            }
+
+            mSqesSize = params.sq_entries * sizeof(io_uring_sqe);
+            mSqes = (io_uring_sqe*)mmap(nullptr, mSqesSize,
+                PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                mRingFd, IORING_OFF_SQES);
+            if (mSqes == MAP_FAILED) {
+                return false;
+            }
+
+            auto sq = (uint8_t*)mSqRing;
+            mSqTail = (unsigned*)(sq + params.sq_off.tail);
+            mSqMask = (unsigned*)(sq + params.sq_off.ring_mask);
+            mSqArray = (unsigned*)(sq + params.sq_off.array);
+
+            auto cq = (uint8_t*)mCqRing;
+            mCqHead = (unsigned*)(cq + params.cq_off.head);
+            mCqTail = (unsigned*)(cq + params.cq_off.tail);
+            mCqMask = (unsigned*)(cq + params.cq_off.ring_mask);
+            mCqes = (io_uring_cqe*)(cq + params.cq_off.cqes);
+
+            mCompletionThread = std::thread([this]() { CompletionMain(); });
+            return true;
+        }
+
+        ~IOUringReadBackend() {
+            if (mCompletionThread.joinable()) {
+                {
+                    marl::lock lock(mMutex);
+                    bShutdown = true;
+                    // Wakes the completion thread up
+                    Push(IORING_OP_NOP, nullptr);
+                }
+                mCompletionThread.join();
+            }
+
+            if (mSqes != MAP_FAILED) {
+                munmap(mSqes, mSqesSize);
+            }
+            if (mCqRing != MAP_FAILED && mCqRing != mSqRing) {
+                munmap(mCqRing, mCqRingSize);
+            }
+            if (mSqRing != MAP_FAILED) {
+                munmap(mSqRing, mSqRingSize);
+            }
+            if (mRingFd >= 0) {
+                close(mRingFd);
+            }
+        }
+
+        void Submit(FileReadRequest&& request) override {
+            if (request.mSize == 0) {
+                request.mOnDone("");
+                return;
+            }
+
+            int fd = open(request.mFile.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                request.mOnDone("Failed to open " + request.mFile.string());
+                return;
+            }
+
+            auto read = new PendingRead();
+            read->mRequest = std::move(request);
+            read->mFd = fd;
+
+            marl::lock lock(mMutex);
+            mSpaceCondition.wait(lock, [this] {
+                return mInFlight + 1 < mEntries;
+            });
+            ++mInFlight;
+            Push(IORING_OP_READV, read);
+        }
+
+        const char* GetName() const override {
+            return "io_uring";
+        }
+    };
+
+    std::unique_ptr<IFileReadBackend> CreateIOUringReadBackend(
+        uint queueDepth) {
+        auto backend = std::make_unique<IOUringReadBackend>();
+        if (!backend->Init(queueDepth)) {
+            return nullptr;
+        }
+        return backend;
+    }
+#else
+    std::unique_ptr<IFileReadBackend> CreateIOUringReadBackend(
+        uint queueDepth) {
+        return nullptr;
+    }
+#endif
+
+    VirtualFileSystem::VirtualFileSystem(const FileSystemParams& params) :
+        mParams(params) {
+    }
+
+    void VirtualFileSystem::Mount(const std::filesystem::path& prefix,
+        std::unique_ptr<IMount>&& mount) {
+        marl::lock lock(mMutex);
+
+        MountPoint point;
+        point.mPrefix = prefix.lexically_normal();
+        point.mMount = std::move(mount);
+        mMounts.emplace_back(std::move(point));
+    }
+
+    void VirtualFileSystem::SetReadBackend(
+        std::unique_ptr<IFileReadBackend>&& backend) {
+        marl::lock lock(mMutex);
+        mBackend = std::move(backend);
+    }
+
+    const char* VirtualFileSystem::GetReadBackendName() {
+        return GetBackend()->GetName();
+    }
+
+    IFileReadBackend* VirtualFileSystem::GetBackend() {
+        marl::lock lock(mMutex);
+
+        // Created on first use, so file systems that only ever serve
+        // memory don't set up rings or threads.
+        if (!mBackend && mParams.bAllowIOUring) {
+            mBackend = CreateIOUringReadBackend(mParams.mQueueDepth);
+        }
+        if (!mBackend) {
+            mBackend = CreateThreadPoolReadBackend(mParams.mThreadCount);
+        }
+
+        return mBackend.get();
+    }
+
+    bool VirtualFileSystem::Resolve(const std::filesystem::path& path,
+        ResolvedFile& out) const {
+        auto normal = path.lexically_normal();
+        std::filesystem::path rest;
+
+        marl::lock lock(mMutex);
+        for (auto it = mMounts.rbegin(); it != mMounts.rend(); ++it) {
+            if (TryStripPrefix(normal, it->mPrefix, rest) &&
+                it->mMount->Resolve(rest, out)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool VirtualFileSystem::Exists(const std::filesystem::path& path) const {
+        ResolvedFile file;
+        return Resolve(path, file);
+    }
+
+    bool VirtualFileSystem::TryFind(const std::filesystem::path& path,
+        std::string* contents) const {
+        ResolvedFile file;
+        if (!Resolve(path, file)) {
+            return false;
+        }
+
+        if (file.bInMemory) {
+            contents->assign((const char*)file.mMemory.data(),
+                file.mMemory.size());
+        } else {
+            contents->resize(file.mSize);
+            ReadFileRange(file.mFile, file.mOffset, file.mSize,
+                (uint8_t*)contents->data());
+        }
+        return true;
+    }
+
+    Future<FileReadResult> VirtualFileSystem::ReadAsync(
+        const std::filesystem::path& path,
+        const FileRange& range) {
+        Promise<FileReadResult> promise;
+        Future<FileReadResult> future(promise);
+
+        ResolvedFile file;
+        if (!Resolve(path, file)) {
+            FileReadResult result;
+            result.mError = "File not found: " + path.string();
+            promise.Set(std::move(result));
+            return future;
+        }
+
+        uint64_t size = file.bInMemory ? file.mMemory.size() : file.mSize;
+        if (range.mOffset > size) {
+            FileReadResult result;
+            result.mError = "Read past the end of " + path.string();
+            promise.Set(std::move(result));
+            return future;
+        }
+
+        uint64_t length = std::min(range.mSize, size - range.mOffset);
+
+        if (file.bInMemory || length == 0) {
+            FileReadResult result;
+            result.mBytes = file.mMemory.Slice(range.mOffset, length);
+            promise.Set(std::move(result));
+            return future;
+        }
+
+        auto buffer = std::make_shared<ByteBuffer>(length);
+
+        // Backend threads have no scheduler, so results are handed to
+        // marl before continuations run on them.
+        auto scheduler = marl::Scheduler::get();
+
+        FileReadRequest request;
+        request.mFile = std::move(file.mFile);
+        request.mOffset = file.mOffset + range.mOffset;
+        request.mSize = length;
+        request.mDst = buffer->data();
+        request.mOnDone = [promise, buffer, scheduler](const std::string& error) {
+            FileReadResult result;
+            if (error.empty()) {
+                result.mBytes = ByteView(buffer->data(), buffer->size(), buffer);
+            } else {
+                result.mError = error;
+            }
+
+            if (scheduler) {
+                scheduler->enqueue(marl::Task(
+                    [promise, result = std::move(result)]() mutable {
+                    promise.Set(std::move(result));
+                }));
+            } else {
+                Promise<FileReadResult>(promise).Set(std::move(result));
+            }
+        };
+
+        GetBackend()->Submit(std::move(request));
+        return future;
+    }
+
+    ByteView VirtualFileSystem::Read(const std::filesystem::path& path,
+        const FileRange& range) {
+        auto future = ReadAsync(path, range);
+        const auto& result = future.Get();
+
+        if (!result.IsOk()) {
+            throw std::runtime_error(result.mError);
+        }
+        return result.mBytes;
+    }
+
+    VirtualFileSystem& VirtualFileSystem::Default() {
+        static VirtualFileSystem* fileSystem = []() {
+            auto result = new VirtualFileSystem();
+            result->Mount("", std::make_unique<DirectoryMount>());
+            return result;
+        }();
+        return *fileSystem;
+    }
+}
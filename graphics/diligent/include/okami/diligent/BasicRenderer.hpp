@@ -7,6 +7,7 @@
 #include <okami/Texture.hpp>
 #include <okami/Material.hpp>
 #include <okami/Graphics.hpp>
+#include <okami/Eviction.hpp>
 
 #include <okami/diligent/Glfw.hpp>
 #include <okami/diligent/Buffers.hpp>
@@ -35,7 +36,9 @@ namespace okami::graphics::diligent {
         public core::IVertexLayoutProvider,
         public IRenderer,
         public IGlobalsBufferProvider,
-        public IRenderPassFormatProvider {
+        public IRenderPassFormatProvider,
+        public core::ITextureResidencyBackend,
+        public core::IEvictionBackend {
     public:
         struct RenderCanvasBackend {
             bool bInitialized = false;
@@ -79,16 +82,21 @@ namespace okami::graphics::diligent {
 
         core::ResourceBackend<
             core::Geometry, GeometryBackend>        mGeometryBackend;
+        GeometryArena                               mGeometryArena;
         core::ResourceBackend<
             core::Texture, TextureBackend>          mTextureBackend;
         core::ResourceBackend<
             RenderCanvas, RenderCanvasBackend>      mRenderCanvasBackend;
 
+        core::MipStreamer                           mMipStreamer;
+        core::EvictionManager                       mEviction;
+
         DynamicUniformBuffer<
             HLSL::SceneGlobals>                     mSceneGlobals;
 
         GeometryBackend     MoveToGPU(const core::Geometry& geometry);
-        TextureBackend      MoveToGPU(const core::Texture& texture);
+        TextureBackend      MoveToGPU(const core::Texture& texture,
+                                uint32_t firstMip = 0);
 
     public:
         BasicRenderer(
@@ -126,18 +134,27 @@ namespace okami::graphics::diligent {
             core::Geometry& geometryOut,
             GeometryBackend& backend);
         void OnDestroy(GeometryBackend& geometry);
+        void OnEvict(GeometryBackend& geometry);
         core::Geometry LoadFrontendGeometry(
             const std::filesystem::path& path, 
-            const core::LoadParams<core::Geometry>& params);
+            const core::LoadParams<core::Geometry>& params,
+            const core::ByteView& bytes);
         GeometryBackend Construct(const core::Geometry& geometry);
 
         // Texture resource handlers
         void OnFinalize(
-            const core::Texture& textureIn,
+            core::Texture& textureIn,
             core::Texture& textureOut,
             TextureBackend& backend);
         void OnDestroy(TextureBackend& texture);
+        void OnEvict(TextureBackend& texture);
         TextureBackend Construct(const core::Texture& texture);
+        void SetResidentMip(resource_id_t id, 
+            uint32_t mostDetailedMip) override;
+
+        // Eviction of textures and geometry
+        void Evict(resource_id_t id) override;
+        void Reload(resource_id_t id) override;
 
         // RenderCanvas resource handlers
         void OnFinalize(
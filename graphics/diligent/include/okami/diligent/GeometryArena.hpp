@@ -0,0 +1,125 @@
+#pragma once
+
+#include <okami/Geometry.hpp>
+#include <okami/OffsetAllocator.hpp>
+
+#include <RenderDevice.h>
+#include <DeviceContext.h>
+#include <RefCntAutoPtr.hpp>
+
+#include <vector>
+
+namespace okami::graphics::diligent {
+    namespace DG = Diligent;
+
+    struct GeometryArenaParams {
+        // Vertices a pool starts out with, pools at least double when
+        // they run out of space
+        uint32_t mInitialVertices = 1u << 18;
+        // Space of the index buffer at the start, in 4 byte words
+        uint32_t mInitialIndexWords = 1u << 19;
+        // Geometry a pool can hold at once
+        uint32_t mMaxAllocations = 1u << 16;
+    };
+
+    // Where a geometry lives in a GeometryArena. Offsets aren't stored,
+    // they change when the arena is compacted.
+    struct GeometryRange {
+        static constexpr uint32_t NO_POOL = 0xFFFFFFFF;
+
+        uint32_t mPool = NO_POOL;
+        core::OffsetAllocation mVertices;
+        core::OffsetAllocation mIndices;
+
+        inline bool IsValid() const {
+            return mPool != NO_POOL;
+        }
+    };
+
+    // Holds the vertices and indices of all geometry in a few large
+    // buffers, so that draws of different geometry don't rebind buffers
+    // and the driver doesn't see thousands of small allocations. Geometry
+    // whose vertex buffers have the same strides shares a pool of vertex
+    // buffers and is drawn with a base vertex. All indices share one
+    // buffer and are drawn from a first index.
+    //
+    // Space is handed out by OffsetAllocators. When a pool has enough
+    // free space in total but not in one piece it is compacted, when it
+    // is out of space it is grown. Both copy into new buffers on the GPU.
+    // Everything has to happen on the thread that owns the context.
+    class GeometryArena {
+    private:
+        // Buffers that are allocated from together. Unit i of the
+        // allocator is unitSizes[b] bytes at i * unitSizes[b] in buffer b.
+        struct Pool {
+            std::vector<uint32_t> mUnitSizes;
+            std::vector<DG::RefCntAutoPtr<DG::IBuffer>> mBuffers;
+            core::OffsetAllocator mAllocator;
+            DG::BIND_FLAGS mBindFlags = DG::BIND_NONE;
+        };
+
+        DG::IRenderDevice* mDevice = nullptr;
+        GeometryArenaParams mParams;
+
+        std::vector<Pool> mVertexPools;
+        // In 4 byte words, so that 16 and 32 bit indices can share it
+        Pool mIndexPool;
+
+        Pool CreatePool(const std::vector<uint32_t>& unitSizes,
+            uint32_t capacity,
+            DG::BIND_FLAGS bindFlags);
+        uint32_t FindOrCreateVertexPool(const std::vector<uint32_t>& strides);
+
+        // Moves the contents of pool into new buffers of capacity units.
+        // Everything below keptUnits stays in place, moves say where the
+        // rest goes. Returns the bytes copied.
+        uint64_t Relocate(DG::IDeviceContext* context,
+            Pool& pool,
+            uint32_t capacity,
+            uint32_t keptUnits,
+            const std::vector<core::OffsetAllocatorMove>& moves);
+
+        uint64_t Defragment(DG::IDeviceContext* context, Pool& pool);
+
+        // Compacts or grows pool if there is no room for size units
+        core::OffsetAllocation AllocateOrMakeRoom(DG::IDeviceContext* context,
+            Pool& pool,
+            uint32_t size);
+
+        void Upload(DG::IDeviceContext* context,
+            DG::IBuffer* buffer,
+            uint64_t offset,
+            const core::BufferData& data);
+
+    public:
+        GeometryArena() = default;
+        GeometryArena(DG::IRenderDevice* device,
+            const GeometryArenaParams& params = GeometryArenaParams());
+
+        GeometryArena(GeometryArena&&) = default;
+        GeometryArena& operator=(GeometryArena&&) = default;
+
+        // Finds space for data and uploads it through context
+        GeometryRange Allocate(DG::IDeviceContext* context,
+            const core::Geometry::RawData& data);
+        // Releases the space of range and invalidates it
+        void Free(GeometryRange& range);
+
+        uint32_t GetBaseVertex(const GeometryRange& range) const;
+        // In indices of indexType, from the start of the index buffer
+        uint32_t GetFirstIndex(const GeometryRange& range,
+            core::ValueType indexType) const;
+
+        // Binds the vertex buffers of the range's pool and the shared
+        // index buffer
+        void Bind(DG::IDeviceContext* context, const GeometryRange& range);
+
+        // Compacts every pool and the index buffer, returns the bytes
+        // that were copied
+        uint64_t Defragment(DG::IDeviceContext* context);
+
+        uint64_t GetSizeInBytes(const GeometryRange& range) const;
+        // GPU memory held by all buffers of the arena
+        uint64_t GetCapacityInBytes() const;
+    };
+}
@@ -38,6 +38,17 @@ namespace okami::graphics::diligent {
     DG::SURFACE_TRANSFORM ToDiligent(
         SurfaceTransform transform);
 
+    inline glm::vec3 ToOkami(const DG::float3& v) {
+        return glm::vec3(v.x, v.y, v.z);
+    }
+    inline glm::mat4x4 ToOkami(const DG::float4x4& m) {
+        return glm::mat4x4(
+            m.m[0][0], m.m[0][1], m.m[0][2], m.m[0][3],
+            m.m[1][0], m.m[1][1], m.m[1][2], m.m[1][3],
+            m.m[2][0], m.m[2][1], m.m[2][2], m.m[2][3],
+            m.m[3][0], m.m[3][1], m.m[3][2], m.m[3][3]);
+    }
+
     inline DG::float4x4 ToMatrix(
         const core::Transform& transform) {
         return ToDiligent(transform.ToMatrix());
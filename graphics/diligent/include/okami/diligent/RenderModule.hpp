@@ -5,6 +5,8 @@
 #include <okami/Geometry.hpp>
 #include <okami/Embed.hpp>
 #include <okami/ResourceManager.hpp>
+#include <okami/TextureStreaming.hpp>
+#include <okami/diligent/GeometryArena.hpp>
 
 #include <DeviceContext.h>
 #include <RenderDevice.h>
@@ -18,11 +20,15 @@ namespace okami::graphics::diligent {
 
     struct GeometryBackend {
         core::Geometry::Desc mDesc;
-        std::vector<DG::RefCntAutoPtr<DG::IBuffer>>
-            mVertexBuffers;
-        DG::RefCntAutoPtr<DG::IBuffer>
-            mIndexBuffer;
+        // Where the vertices and indices live in the renderer's
+        // GeometryArena, invalid while not on the GPU
+        GeometryRange mRange;
         std::unique_ptr<marl::Event> mEvent;
+        uint64_t mSizeInBytes = 0;
+        BoundingBox mBoundingBox;
+        std::vector<core::Meshlet> mMeshlets;
+        std::vector<core::MeshLod> mLods;
+        resource_id_t mId = INVALID_RESOURCE;
 
         inline GeometryBackend() :
             mEvent(std::make_unique<marl::Event>(
@@ -39,6 +45,14 @@ namespace okami::graphics::diligent {
         DG::RefCntAutoPtr<DG::ITexture>
             mTexture;
         std::unique_ptr<marl::Event> mEvent;
+        uint64_t mSizeInBytes = 0;
+
+        // Streamed textures only hold mips [mResidentMip, mipCount) on
+        // the GPU. mTexture is recreated whenever that changes, and
+        // mVersion is bumped so bindings know to refresh.
+        resource_id_t mId = INVALID_RESOURCE;
+        uint32_t mResidentMip = 0;
+        uint32_t mVersion = 0;
 
         inline TextureBackend() : 
             mEvent(std::make_unique<marl::Event>(
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <okami/Frame.hpp>
+#include <okami/Eviction.hpp>
 #include <okami/Transform.hpp>
 #include <okami/ResourceBackend.hpp>
 #include <okami/GraphicsComponents.hpp>
@@ -24,6 +25,7 @@ namespace okami::graphics::diligent {
         SpriteBatch mBatch;
         core::ResourceBackend<
             core::Texture, textureBackendT>* mTextures;
+        core::EvictionManager* mEviction;
 
         struct RenderCall  {
             DG::float3 mPosition;
@@ -34,8 +36,10 @@ namespace okami::graphics::diligent {
 
     public:
         SpriteModule(core::ResourceBackend<
-            core::Texture, textureBackendT>* textures) :
-            mTextures(textures) {
+            core::Texture, textureBackendT>* textures,
+            core::EvictionManager* eviction = nullptr) :
+            mTextures(textures),
+            mEviction(eviction) {
         }
 
         void Startup(
@@ -131,9 +135,18 @@ namespace okami::graphics::diligent {
 
             mBatch.Begin(context, &mState);
             for (auto& c : calls) {
+                if (mEviction) {
+                    mEviction->Touch(c.mSprite.mTexture);
+                }
+
                 auto& backend = mTextures->Get(c.mSprite.mTexture);
                 DG::ITexture* texture = getTexture(&backend);
 
+                // Not loaded yet, or evicted and on its way back
+                if (!texture) {
+                    continue;
+                }
+
                 const auto& desc = texture->GetDesc();
                 DG::float2 size(desc.Width, desc.Height);
                 DG::float2 scaledSize = c.mScale * size;
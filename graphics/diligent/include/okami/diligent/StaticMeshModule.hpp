@@ -7,6 +7,8 @@
 #include <okami/diligent/ShaderTypes.hpp>
 
 #include <okami/Resource.hpp>
+#include <okami/Eviction.hpp>
+#include <okami/LodSelection.hpp>
 #include <okami/ResourceManager.hpp>
 #include <okami/ResourceBackend.hpp>
 #include <okami/GraphicsComponents.hpp>
@@ -14,6 +16,8 @@
 #include <RefCntAutoPtr.hpp>
 #include <RenderDevice.h>
 
+#include <array>
+
 namespace DG = Diligent;
 
 namespace okami::graphics::diligent {
@@ -29,10 +33,18 @@ namespace okami::graphics::diligent {
                 mDefaultBinding;
         };
 
+        // Albedo, roughness, metallic and normal
+        static constexpr size_t MATERIAL_TEXTURE_COUNT = 4;
+
         struct StaticMeshMaterialBackend {
             std::vector<DG::RefCntAutoPtr<
                 DG::IShaderResourceBinding>>        mBindings;
             HLSL::MaterialDesc                      mDesc;
+            core::MetaSurfaceDesc                   mSurface;
+            // Versions of the surface's textures the bindings were made
+            // with, in the order of GetMaterialTextures
+            std::array<uint32_t, 
+                MATERIAL_TEXTURE_COUNT>             mTextureVersions = {};
         };
 
     private:
@@ -62,9 +74,13 @@ namespace okami::graphics::diligent {
         core::ResourceBackend<
             core::Geometry,
             GeometryBackend>*                       mGeometryBackend;
+        GeometryArena*                              mGeometryArena;
         core::ResourceBackend<
             core::Texture,
             TextureBackend>*                        mTextureBackend;
+        core::MipStreamer*                          mMipStreamer;
+        core::EvictionManager*                      mEviction;
+        core::LodSelector                           mLodSelector;
 
         void InitializeMaterial(
             const core::MetaSurfaceDesc& materialData,
@@ -74,8 +90,11 @@ namespace okami::graphics::diligent {
         StaticMeshModule(
             core::ResourceBackend<
                 core::Geometry, GeometryBackend>* geometryBackend,
+            GeometryArena* geometryArena,
             core::ResourceBackend<
-                core::Texture, TextureBackend>* textureBackend);
+                core::Texture, TextureBackend>* textureBackend,
+            core::MipStreamer* mipStreamer,
+            core::EvictionManager* eviction = nullptr);
 
         void OnFinalize(
             const Material& frontendIn,
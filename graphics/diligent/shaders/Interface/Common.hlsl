@@ -45,6 +45,11 @@ struct StaticInstanceData {
     int mPadding0;
     int mPadding1;
     int mPadding2;
+
+    // Positions are stored relative to the bounding box of their
+    // geometry, see AttributeEncoding::BOUNDS_RELATIVE.
+    float4 mPositionOffset;
+    float4 mPositionScale;
 };
 
 CHECK_STRUCT_ALIGNMENT(StaticInstanceData);
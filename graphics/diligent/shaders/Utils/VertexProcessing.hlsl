@@ -7,6 +7,18 @@ struct TransformedVertex
     float3 Normal;
 };
 
+// The reverse of OctahedralEncode in VertexEncoding.hpp
+float3 OctahedralDecode(float2 e)
+{
+    float3 v = float3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+    if (v.z < 0.0)
+    {
+        float2 signs = float2(e.x >= 0.0 ? 1.0 : -1.0, e.y >= 0.0 ? 1.0 : -1.0);
+        v.xy = (1.0 - abs(e.yx)) * signs;
+    }
+    return normalize(v);
+}
+
 float3x3 InverseTranspose3x3(float3x3 M)
 {
     // Note that in HLSL, M_t[0] is the first row, while in GLSL, it is the 
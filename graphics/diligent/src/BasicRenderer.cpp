@@ -2,6 +2,7 @@
 #include <okami/Transform.hpp>
 #include <okami/GraphicsComponents.hpp>
 #include <okami/Embed.hpp>
+#include <okami/VirtualFileSystem.hpp>
 
 #include <okami/diligent/BasicRenderer.hpp>
 #include <okami/diligent/Glfw.hpp>
@@ -31,24 +32,42 @@ namespace okami::graphics::diligent {
             [this](const core::Geometry& geo) { 
                 return Construct(geo); },
             [this](const std::filesystem::path& path, 
-                const core::LoadParams<core::Geometry>& params) {
-                return LoadFrontendGeometry(path, params); },
+                const core::LoadParams<core::Geometry>& params,
+                const core::ByteView& bytes,
+                const core::LoadToken&) {
+                return LoadFrontendGeometry(path, params, bytes); },
             [this](const core::Geometry& geoIn,
                 core::Geometry& geoOut,
                 GeometryBackend& backend) {
                 OnFinalize(geoIn, geoOut, backend); },
             [this](GeometryBackend& backend) {
-                OnDestroy(backend); }),
+                OnDestroy(backend); },
+            [](const GeometryBackend& backend) {
+                core::MemoryFootprint footprint;
+                footprint[core::MemoryCategory::GPU_BUFFER] = backend.mSizeInBytes;
+                return footprint; },
+            [this](GeometryBackend& backend) {
+                OnEvict(backend); }),
         mTextureBackend(
             [this](const core::Texture& geo) { 
                 return Construct(geo); },
-            &core::Texture::Load,
-            [this](const core::Texture& texIn,
+            [](const std::filesystem::path& path,
+                const core::LoadParams<core::Texture>& params,
+                const core::ByteView& bytes,
+                const core::LoadToken&) {
+                return core::Texture::Load(path, bytes, params); },
+            [this](core::Texture& texIn,
                 core::Texture& texOut,
                 TextureBackend& backend) {
                 OnFinalize(texIn, texOut, backend); },
             [this](TextureBackend& backend) {
-                OnDestroy(backend); }),
+                OnDestroy(backend); },
+            [](const TextureBackend& backend) {
+                core::MemoryFootprint footprint;
+                footprint[core::MemoryCategory::GPU_TEXTURE] = backend.mSizeInBytes;
+                return footprint; },
+            [this](TextureBackend& backend) {
+                OnEvict(backend); }),
         mRenderCanvasBackend(
             [this](const RenderCanvas& canvas) {
                 return Construct(canvas); },
@@ -59,6 +78,7 @@ namespace okami::graphics::diligent {
                 OnFinalize(canvIn, canvOut, backend); },
             [this](RenderCanvasBackend& backend) {
                 OnDestroy(backend); }),
+        mMipStreamer(this),
         mResourceInterface(resources) {
 
         // Associate the renderer with the correct resource types 
@@ -68,62 +88,28 @@ namespace okami::graphics::diligent {
     }
 
     void BasicRenderer::OnDestroy(GeometryBackend& geometry) {
+        mEviction.Remove(geometry.mId);
+        mGeometryArena.Free(geometry.mRange);
         geometry = GeometryBackend();
     }
 
+    void BasicRenderer::OnEvict(GeometryBackend& geometry) {
+        mGeometryArena.Free(geometry.mRange);
+        geometry.mSizeInBytes = 0;
+    }
+
    GeometryBackend
         BasicRenderer::MoveToGPU(const core::Geometry& geometry) {
         GeometryBackend result(geometry.GetDesc());
 
-        const auto& geoDesc = result.mDesc;
         const auto& data = geometry.DataCPU();
 
-        for (auto& vertBuffer : data.mVertexBuffers) {
-            DG::BufferDesc bufDesc;
-            bufDesc.BindFlags = BIND_VERTEX_BUFFER;
-            bufDesc.CPUAccessFlags = CPU_ACCESS_NONE;
-            bufDesc.Usage = USAGE_IMMUTABLE;
-            bufDesc.Size = vertBuffer.mDesc.mSizeInBytes;
-            bufDesc.Name = "Generated Vertex Buffer";
-
-            BufferData bufData;
-            bufData.DataSize = vertBuffer.mDesc.mSizeInBytes;
-            bufData.pContext = mContexts[0];
-            bufData.pData = vertBuffer.mBytes.data();
-
-            IBuffer* buffer = nullptr;
-            mDevice->CreateBuffer(bufDesc, &bufData, &buffer);
-
-            if (!buffer) {
-                throw std::runtime_error("Failed to create vertex buffer!");
-            }
-
-            result.mVertexBuffers.emplace_back(buffer);
-        }
-
-        if (geoDesc.bIsIndexed) {
-            DG::BufferDesc bufDesc;
-            bufDesc.BindFlags = BIND_INDEX_BUFFER;
-            bufDesc.CPUAccessFlags = CPU_ACCESS_NONE;
-            bufDesc.Usage = USAGE_IMMUTABLE;
-            bufDesc.Size = data.mIndexBuffer.mDesc.mSizeInBytes;
-            bufDesc.Name = "Generated Index Buffer";
-
-            BufferData bufData;
-            bufData.DataSize = data.mIndexBuffer.mDesc.mSizeInBytes;
-            bufData.pContext = mContexts[0];
-            bufData.pData = data.mIndexBuffer.mBytes.data();
-
-            IBuffer* buffer = nullptr;
-            mDevice->CreateBuffer(bufDesc, &bufData, &buffer);
-
-            if (!buffer) {
-                throw std::runtime_error("Failed to create index buffer!");
-            }
-
-            result.mIndexBuffer.Attach(buffer);
-        }
+        result.mRange = mGeometryArena.Allocate(mContexts[0], data);
+        result.mSizeInBytes = mGeometryArena.GetSizeInBytes(result.mRange);
 
+        // Culled and selected on the CPU, so they stay behind
+        result.mMeshlets = data.mMeshlets;
+        result.mLods = data.mLods;
         return result;
     }
 
@@ -132,24 +118,69 @@ namespace okami::graphics::diligent {
         core::Geometry& geometryOut,
         GeometryBackend& backend) {
 
+        auto id = geometryOut.GetResourceId();
+
+        // Reloads after an eviction finalize again, keep the event
+        // that render threads may already have seen signaled.
+        auto event = std::move(backend.mEvent);
+        mGeometryArena.Free(backend.mRange);
         backend = MoveToGPU(geometryIn);
+        backend.mEvent = std::move(event);
 
         geometryOut.DeallocCPU();
         geometryOut.SetDesc(geometryIn.GetDesc());
         geometryOut.SetBoundingBox(geometryIn.GetBoundingBox());
+        backend.mBoundingBox = geometryIn.GetBoundingBox();
+        backend.mId = id;
+
+        // Without a path the CPU copy we just dropped was the only one
+        if (geometryOut.HasLoadParams()) {
+            mEviction.Add(id, this, backend.mSizeInBytes);
+        }
 
         backend.mEvent->signal();
     }
 
     void BasicRenderer::OnDestroy(TextureBackend& texture) {
+        mEviction.Remove(texture.mId);
+        mMipStreamer.Remove(texture.mId);
         texture = TextureBackend();
     }
 
+    void BasicRenderer::OnEvict(TextureBackend& texture) {
+        // mId and the signaled event stay, bindings see the version
+        // change and fall back to the default texture.
+        mMipStreamer.Remove(texture.mId);
+        texture.mTexture.Release();
+        texture.mSizeInBytes = 0;
+        texture.mResidentMip = 0;
+        ++texture.mVersion;
+    }
+
+    void BasicRenderer::Evict(resource_id_t id) {
+        if (auto texture = mResourceInterface.TryGet<core::Texture>(id)) {
+            mTextureBackend.Evict(id, *texture);
+        } else if (auto geometry = mResourceInterface.TryGet<core::Geometry>(id)) {
+            mGeometryBackend.Evict(id, *geometry);
+        }
+    }
+
+    void BasicRenderer::Reload(resource_id_t id) {
+        // Whatever touched it wants to draw with it right away
+        if (auto texture = mResourceInterface.TryGet<core::Texture>(id)) {
+            mTextureBackend.Reload(id, *texture, core::LoadPriority::VISIBLE_NOW);
+        } else if (auto geometry = mResourceInterface.TryGet<core::Geometry>(id)) {
+            mGeometryBackend.Reload(id, *geometry, core::LoadPriority::VISIBLE_NOW);
+        }
+    }
+
     core::Geometry BasicRenderer::LoadFrontendGeometry(
         const std::filesystem::path& path, 
-        const core::LoadParams<core::Geometry>& params) {
+        const core::LoadParams<core::Geometry>& params,
+        const core::ByteView& bytes) {
         auto& layout = mVertexLayouts.Get(params.mComponentType);
-        return core::Geometry::Load(path, layout);
+        return core::Geometry::Load(path, bytes, layout,
+            params.mOptimizeParams);
     }
 
     GeometryBackend BasicRenderer::Construct(const core::Geometry& geo) {
@@ -275,64 +306,130 @@ namespace okami::graphics::diligent {
     }
 
     TextureBackend
-        BasicRenderer::MoveToGPU(const core::Texture& texture) {
+        BasicRenderer::MoveToGPU(const core::Texture& texture,
+            uint32_t firstMip) {
         TextureBackend result;
 
         const auto& texDesc = texture.GetDesc();
         const auto& data = texture.DataCPU();
+        auto chain = core::MipChain::From(texDesc);
 
         TextureDesc dg_desc;
         dg_desc.BindFlags = BIND_SHADER_RESOURCE;
         dg_desc.CPUAccessFlags = CPU_ACCESS_NONE;
-        dg_desc.Width = texDesc.mWidth;
-        dg_desc.Height = texDesc.mHeight;
-        dg_desc.Depth = texDesc.GetDepth();
+        dg_desc.Width = std::max(texDesc.mWidth >> firstMip, 1u);
+        dg_desc.Height = std::max(texDesc.mHeight >> firstMip, 1u);
+        dg_desc.Depth = std::max(texDesc.GetDepth() >> firstMip, 1u);
         dg_desc.ArraySize = texDesc.GetArraySize();
         dg_desc.Type = ToDiligent(texDesc.mType);
         dg_desc.SampleCount = texDesc.mSampleCount;
-        dg_desc.MipLevels = texDesc.mMipLevels;
+        dg_desc.MipLevels = chain.mMipCount - firstMip;
         dg_desc.Name = "Generated Texture";
         dg_desc.Format = ToDiligent(texDesc.mFormat);
 
         auto subresources = texDesc.GetSubresourceDescs();
 
-        std::vector<TextureSubResData> subres_data(subresources.size());
+        // Diligent expects subresources ordered by slice, then mip, so
+        // skipping the mips that are not resident keeps that order.
+        std::vector<TextureSubResData> subres_data;
+        subres_data.reserve(subresources.size());
+
+        for (auto& subresource : subresources) {
+            if (subresource.mMip < firstMip) {
+                continue;
+            }
 
-        for (uint i = 0; i < subresources.size(); ++i) {
-            subres_data[i].DepthStride = subresources[i].mDepthStride;
-            subres_data[i].SrcOffset = subresources[i].mSrcOffset;
-            subres_data[i].Stride = subresources[i].mStride;
-            subres_data[i].pData = &data.mData[subresources[i].mSrcOffset];
+            TextureSubResData subres;
+            subres.DepthStride = subresource.mDepthStride;
+            subres.SrcOffset = subresource.mSrcOffset;
+            subres.Stride = subresource.mStride;
+            subres.pData = &data.mData[subresource.mSrcOffset];
+            subres_data.emplace_back(subres);
+        }
+
+        if (subres_data.size() != 
+            (size_t)(chain.mMipCount - firstMip) * dg_desc.ArraySize) {
+            throw std::runtime_error("Texture subresources don't match its mip chain!");
         }
 
         TextureData dg_data;
-        dg_data.NumSubresources = subresources.size();
+        dg_data.NumSubresources = (Uint32)subres_data.size();
         dg_data.pContext = mContexts[0];
         dg_data.pSubResources = &subres_data[0];
 
         ITexture* dg_texture = nullptr;
         mDevice->CreateTexture(dg_desc, &dg_data, &dg_texture);
         result.mTexture.Attach(dg_texture);
+        result.mSizeInBytes = chain.GetByteSize(firstMip);
+        result.mResidentMip = firstMip;
 
         return result;
     }
 
     void BasicRenderer::OnFinalize(
-        const core::Texture& textureIn,
+        core::Texture& textureIn,
         core::Texture& textureOut,
         TextureBackend& backend) {
 
-        backend = MoveToGPU(textureIn);
+        auto id = textureOut.GetResourceId();
+        auto chain = core::MipChain::From(textureIn.GetDesc());
+        auto tailMip = chain.GetTailMip(mMipStreamer.GetTailDimension());
+
+        // Reloads after an eviction finalize again. Bindings made with
+        // the evicted texture need to see a new version.
+        auto event = std::move(backend.mEvent);
+        auto version = backend.mVersion + 1;
 
-        textureOut.DeallocCPU();
-        textureOut.SetDesc(textureIn.GetDesc());
+        if (tailMip > 0) {
+            // Streamed, only the tail goes up now. The CPU copy stays
+            // around so finer mips can be uploaded later.
+            backend = MoveToGPU(textureIn, mMipStreamer.Add(id, chain));
+
+            if (&textureIn != &textureOut) {
+                // The loaded proxy is discarded after finalization
+                textureOut.DataCPU() = std::move(textureIn.DataCPU());
+            }
+        } else {
+            backend = MoveToGPU(textureIn);
+
+            textureOut.DeallocCPU();
+            textureOut.SetDesc(textureIn.GetDesc());
+        }
+
+        backend.mEvent = std::move(event);
+        backend.mVersion = version;
+        backend.mId = id;
+
+        if (textureOut.HasLoadParams()) {
+            mEviction.Add(id, this, backend.mSizeInBytes);
+        }
 
         backend.mEvent->signal();
     }
 
+    void BasicRenderer::SetResidentMip(resource_id_t id, 
+        uint32_t mostDetailedMip) {
+        auto backend = mTextureBackend.TryGet(id);
+        auto frontend = mResourceInterface.TryGet<core::Texture>(id);
+
+        if (!backend || !frontend) {
+            return;
+        }
+
+        auto updated = MoveToGPU(*frontend, mostDetailedMip);
+        backend->mTexture = std::move(updated.mTexture);
+        backend->mSizeInBytes = updated.mSizeInBytes;
+        backend->mResidentMip = mostDetailedMip;
+        ++backend->mVersion;
+
+        mTextureBackend.Remeasure(id, *frontend);
+        mEviction.Resize(id, backend->mSizeInBytes);
+    }
+
     void BasicRenderer::Startup(marl::WaitGroup& waitGroup) {
         // Load shaders
-        core::EmbeddedFileLoader fileLoader(&MakeShaderMap);
+        core::VirtualFileSystem fileSystem;
+        fileSystem.Mount("", std::make_unique<core::EmbeddedMount>(&MakeShaderMap));
 
         // Create the graphics device and swap chain
         DG::IEngineFactory* factory = nullptr;
@@ -371,6 +468,8 @@ namespace okami::graphics::diligent {
                 DG::RefCntAutoPtr<DG::IDeviceContext>(context));
         }
 
+        mGeometryArena = GeometryArena(mDevice);
+
         // Create the default texture
         const uint defaultTexWidth = 16;
         const uint defaultTexHeight = 16;
@@ -403,10 +502,11 @@ namespace okami::graphics::diligent {
         mSceneGlobals = DynamicUniformBuffer<HLSL::SceneGlobals>(mDevice);
 
         AddModule(std::make_unique<StaticMeshModule>(
-            &mGeometryBackend, &mTextureBackend));
+            &mGeometryBackend, &mGeometryArena, &mTextureBackend,
+            &mMipStreamer, &mEviction));
         AddModule(std::make_unique<
             SpriteModule<TextureBackend, &GetTextureBackend>>(
-                &mTextureBackend));
+                &mTextureBackend, &mEviction));
 
         // This should spawn requested render canvas backends.
         mRenderCanvasBackend.Run();
@@ -414,7 +514,7 @@ namespace okami::graphics::diligent {
         mColorPass = RenderPass::Final();
 
         RenderModuleParams params;
-        params.mFileSystem = &fileLoader;
+        params.mFileSystem = &fileSystem;
         params.mDefaultTexture = mDefaultTexture;
         params.mRequestedRenderPasses = {
             mColorPass,
@@ -439,6 +539,8 @@ namespace okami::graphics::diligent {
         interfaces.Add<IRenderer>(this);
         interfaces.Add<IGlobalsBufferProvider>(this);
         interfaces.Add<IRenderPassFormatProvider>(this);
+        interfaces.Add<core::IMemoryStats>(&mResourceInterface.GetMemoryStats());
+        interfaces.Add<core::EvictionManager>(&mEviction);
     }
 
     void BasicRenderer::LoadResources(marl::WaitGroup& waitGroup) {
@@ -532,6 +634,8 @@ namespace okami::graphics::diligent {
 
         mGeometryBackend.Run();
         mTextureBackend.Run();
+        mMipStreamer.Update();
+        mEviction.Update();
 
         for (auto& module : mRenderModules) { 
             module->Update(&mResourceInterface);
@@ -759,6 +863,7 @@ namespace okami::graphics::diligent {
         mGeometryBackend.Shutdown();
         mTextureBackend.Shutdown();
         mRenderCanvasBackend.Shutdown();
+        mGeometryArena = GeometryArena();
 
         mSceneGlobals = DynamicUniformBuffer<HLSL::SceneGlobals>();
 
@@ -0,0 +1,286 @@
+#include <okami/diligent/GeometryArena.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace okami::graphics::diligent {
+
+    namespace {
+        constexpr uint32_t INDEX_WORD_SIZE = 4;
+    }
+
+    GeometryArena::GeometryArena(DG::IRenderDevice* device,
+        const GeometryArenaParams& params) :
+        mDevice(device),
+        mParams(params) {
+        mIndexPool = CreatePool({ INDEX_WORD_SIZE },
+            params.mInitialIndexWords, DG::BIND_INDEX_BUFFER);
+    }
+
+    GeometryArena::Pool GeometryArena::CreatePool(
+        const std::vector<uint32_t>& unitSizes,
+        uint32_t capacity,
+        DG::BIND_FLAGS bindFlags) {
+
+        Pool pool;
+        pool.mUnitSizes = unitSizes;
+        pool.mBindFlags = bindFlags;
+        pool.mAllocator = core::OffsetAllocator(capacity, mParams.mMaxAllocations);
+        pool.mBuffers.resize(unitSizes.size());
+        Relocate(nullptr, pool, capacity, 0, {});
+        return pool;
+    }
+
+    uint32_t GeometryArena::FindOrCreateVertexPool(
+        const std::vector<uint32_t>& strides) {
+        for (uint32_t i = 0; i < mVertexPools.size(); ++i) {
+            if (mVertexPools[i].mUnitSizes == strides) {
+                return i;
+            }
+        }
+
+        mVertexPools.emplace_back(CreatePool(strides,
+            mParams.mInitialVertices, DG::BIND_VERTEX_BUFFER));
+        return (uint32_t)(mVertexPools.size() - 1);
+    }
+
+    uint64_t GeometryArena::Relocate(DG::IDeviceContext* context,
+        Pool& pool,
+        uint32_t capacity,
+        uint32_t keptUnits,
+        const std::vector<core::OffsetAllocatorMove>& moves) {
+
+        uint64_t copiedBytes = 0;
+
+        for (size_t b = 0; b < pool.mBuffers.size(); ++b) {
+            uint64_t unitSize = pool.mUnitSizes[b];
+
+            DG::BufferDesc bufDesc;
+            bufDesc.BindFlags = pool.mBindFlags;
+            bufDesc.CPUAccessFlags = DG::CPU_ACCESS_NONE;
+            bufDesc.Usage = DG::USAGE_DEFAULT;
+            bufDesc.Size = unitSize * capacity;
+            bufDesc.Name = pool.mBindFlags == DG::BIND_INDEX_BUFFER ?
+                "Geometry Arena Index Buffer" : "Geometry Arena Vertex Buffer";
+
+            DG::IBuffer* buffer = nullptr;
+            mDevice->CreateBuffer(bufDesc, nullptr, &buffer);
+
+            if (!buffer) {
+                throw std::runtime_error("Failed to create geometry arena buffer!");
+            }
+
+            DG::RefCntAutoPtr<DG::IBuffer> newBuffer;
+            newBuffer.Attach(buffer);
+
+            auto& oldBuffer = pool.mBuffers[b];
+            auto copy = [&](uint64_t from, uint64_t to, uint64_t units) {
+                context->CopyBuffer(
+                    oldBuffer, from * unitSize, DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                    newBuffer, to * unitSize, units * unitSize,
+                    DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                copiedBytes += units * unitSize;
+            };
+
+            if (oldBuffer) {
+                if (keptUnits > 0) {
+                    copy(0, 0, keptUnits);
+                }
+
+                // Neighbours that move together are copied together
+                for (size_t i = 0; i < moves.size();) {
+                    uint64_t from = moves[i].mFrom;
+                    uint64_t to = moves[i].mTo;
+                    uint64_t units = moves[i].mSize;
+                    for (++i; i < moves.size() &&
+                        moves[i].mFrom == from + units &&
+                        moves[i].mTo == to + units; ++i) {
+                        units += moves[i].mSize;
+                    }
+                    copy(from, to, units);
+                }
+            }
+
+            oldBuffer = newBuffer;
+        }
+
+        return copiedBytes;
+    }
+
+    uint64_t GeometryArena::Defragment(DG::IDeviceContext* context, Pool& pool) {
+        auto moves = pool.mAllocator.Defragment();
+        if (moves.empty()) {
+            return 0;
+        }
+
+        // Ranges are packed in order, everything in front of the first
+        // one that moved was packed already
+        return Relocate(context, pool, pool.mAllocator.GetSize(),
+            moves.front().mTo, moves);
+    }
+
+    core::OffsetAllocation GeometryArena::AllocateOrMakeRoom(
+        DG::IDeviceContext* context,
+        Pool& pool,
+        uint32_t size) {
+
+        auto allocation = pool.mAllocator.Allocate(size);
+        if (allocation.IsValid()) {
+            return allocation;
+        }
+
+        // Enough space, just not in one piece
+        if (pool.mAllocator.GetReport().mTotalFree >= size) {
+            Defragment(context, pool);
+            allocation = pool.mAllocator.Allocate(size);
+            if (allocation.IsValid()) {
+                return allocation;
+            }
+        }
+
+        // Twice the request leaves room for the rounding of the
+        // allocator's bins
+        uint64_t oldCapacity = pool.mAllocator.GetSize();
+        uint64_t capacity = oldCapacity + std::max<uint64_t>(oldCapacity, 2 * (uint64_t)size);
+        if (capacity > UINT32_MAX) {
+            throw std::runtime_error("Geometry arena is out of space!");
+        }
+
+        Relocate(context, pool, (uint32_t)capacity, (uint32_t)oldCapacity, {});
+        pool.mAllocator.Grow((uint32_t)capacity);
+
+        allocation = pool.mAllocator.Allocate(size);
+        if (!allocation.IsValid()) {
+            throw std::runtime_error("Geometry arena is out of allocations!");
+        }
+        return allocation;
+    }
+
+    void GeometryArena::Upload(DG::IDeviceContext* context,
+        DG::IBuffer* buffer,
+        uint64_t offset,
+        const core::BufferData& data) {
+        context->UpdateBuffer(buffer, offset, data.mDesc.mSizeInBytes,
+            data.mBytes.data(), DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+
+    GeometryRange GeometryArena::Allocate(DG::IDeviceContext* context,
+        const core::Geometry::RawData& data) {
+
+        uint32_t vertexCount = data.mDesc.mAttribs.mNumVertices;
+        if (vertexCount == 0 || data.mVertexBuffers.empty()) {
+            throw std::runtime_error("Geometry has no vertices!");
+        }
+
+        std::vector<uint32_t> strides;
+        for (auto& buffer : data.mVertexBuffers) {
+            strides.emplace_back(buffer.mDesc.mSizeInBytes / vertexCount);
+        }
+
+        GeometryRange range;
+        range.mPool = FindOrCreateVertexPool(strides);
+
+        auto& pool = mVertexPools[range.mPool];
+        range.mVertices = AllocateOrMakeRoom(context, pool, vertexCount);
+
+        uint32_t baseVertex = pool.mAllocator.GetOffset(range.mVertices);
+        for (size_t b = 0; b < pool.mBuffers.size(); ++b) {
+            Upload(context, pool.mBuffers[b],
+                (uint64_t)baseVertex * strides[b], data.mVertexBuffers[b]);
+        }
+
+        if (data.mDesc.bIsIndexed) {
+            uint32_t words = (data.mIndexBuffer.mDesc.mSizeInBytes +
+                INDEX_WORD_SIZE - 1) / INDEX_WORD_SIZE;
+            range.mIndices = AllocateOrMakeRoom(context, mIndexPool, words);
+
+            Upload(context, mIndexPool.mBuffers[0],
+                (uint64_t)mIndexPool.mAllocator.GetOffset(range.mIndices) * INDEX_WORD_SIZE,
+                data.mIndexBuffer);
+        }
+
+        return range;
+    }
+
+    void GeometryArena::Free(GeometryRange& range) {
+        if (!range.IsValid()) {
+            return;
+        }
+
+        mVertexPools[range.mPool].mAllocator.Free(range.mVertices);
+        mIndexPool.mAllocator.Free(range.mIndices);
+        range = GeometryRange();
+    }
+
+    uint32_t GeometryArena::GetBaseVertex(const GeometryRange& range) const {
+        return mVertexPools[range.mPool].mAllocator.GetOffset(range.mVertices);
+    }
+
+    uint32_t GeometryArena::GetFirstIndex(const GeometryRange& range,
+        core::ValueType indexType) const {
+        if (!range.mIndices.IsValid()) {
+            return 0;
+        }
+        uint32_t offset = mIndexPool.mAllocator.GetOffset(range.mIndices);
+        return offset * INDEX_WORD_SIZE / core::GetSize(indexType);
+    }
+
+    void GeometryArena::Bind(DG::IDeviceContext* context,
+        const GeometryRange& range) {
+        auto& pool = mVertexPools[range.mPool];
+
+        std::vector<DG::IBuffer*> buffers;
+        std::vector<DG::Uint64> offsets(pool.mBuffers.size(), 0);
+        for (auto& buffer : pool.mBuffers) {
+            buffers.emplace_back(buffer.RawPtr());
+        }
+
+        context->SetVertexBuffers(0, (DG::Uint32)buffers.size(),
+            buffers.data(), offsets.data(),
+            DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+            DG::SET_VERTEX_BUFFERS_FLAG_RESET);
+        context->SetIndexBuffer(mIndexPool.mBuffers[0], 0,
+            DG::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+
+    uint64_t GeometryArena::Defragment(DG::IDeviceContext* context) {
+        uint64_t copiedBytes = 0;
+        for (auto& pool : mVertexPools) {
+            copiedBytes += Defragment(context, pool);
+        }
+        copiedBytes += Defragment(context, mIndexPool);
+        return copiedBytes;
+    }
+
+    uint64_t GeometryArena::GetSizeInBytes(const GeometryRange& range) const {
+        if (!range.IsValid()) {
+            return 0;
+        }
+
+        auto& pool = mVertexPools[range.mPool];
+        uint64_t vertexCount = pool.mAllocator.GetAllocationSize(range.mVertices);
+
+        uint64_t result = 0;
+        for (auto stride : pool.mUnitSizes) {
+            result += vertexCount * stride;
+        }
+        result += (uint64_t)mIndexPool.mAllocator.GetAllocationSize(range.mIndices) *
+            INDEX_WORD_SIZE;
+        return result;
+    }
+
+    uint64_t GeometryArena::GetCapacityInBytes() const {
+        uint64_t result = 0;
+        auto addPool = [&result](const Pool& pool) {
+            for (auto unitSize : pool.mUnitSizes) {
+                result += (uint64_t)unitSize * pool.mAllocator.GetSize();
+            }
+        };
+
+        for (auto& pool : mVertexPools) {
+            addPool(pool);
+        }
+        addPool(mIndexPool);
+        return result;
+    }
+}
@@ -352,9 +352,9 @@ namespace okami::graphics::diligent {
         case core::ValueType::INT8:
             return VT_INT8;
         case core::ValueType::INT16:
-            return VT_UINT16;
+            return VT_INT16;
         case core::ValueType::INT32:
-            return VT_UINT32;
+            return VT_INT32;
         case core::ValueType::UINT8:
             return VT_UINT8;
         case core::ValueType::UINT16:
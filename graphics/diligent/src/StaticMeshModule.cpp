@@ -1,5 +1,6 @@
 #include <okami/diligent/StaticMeshModule.hpp>
 #include <okami/Geometry.hpp>
+#include <okami/StaticBatching.hpp>
 #include <okami/diligent/GraphicsUtils.hpp>
 #include <okami/Frame.hpp>
 #include <okami/diligent/Shader.hpp>
@@ -138,12 +139,25 @@ namespace okami::graphics::diligent {
         return pipeline;
     }
 
+    std::array<Handle<core::Texture>, StaticMeshModule::MATERIAL_TEXTURE_COUNT>
+        GetMaterialTextures(const core::MetaSurfaceDesc& surface) {
+        return {
+            surface.mAlbedo,
+            surface.mRoughness,
+            surface.mMetallic,
+            surface.mNormal
+        };
+    }
+
     StaticMeshModule::StaticMeshModule(
         core::ResourceBackend<
             core::Geometry, GeometryBackend>* geometryBackend,
+        GeometryArena* geometryArena,
         core::ResourceBackend<
-            core::Texture, TextureBackend>* textureBackend) :
-        mFormat(core::VertexFormat::PositionUVNormal()),
+            core::Texture, TextureBackend>* textureBackend,
+        core::MipStreamer* mipStreamer,
+        core::EvictionManager* eviction) :
+        mFormat(core::VertexFormat::PositionUVNormalCompressed()),
         mMaterialBackend(
             [](const Material&) { 
                 return StaticMeshMaterialBackend(); 
@@ -158,7 +172,10 @@ namespace okami::graphics::diligent {
                 OnDestroy(backend);
             }),
         mGeometryBackend(geometryBackend),
-        mTextureBackend(textureBackend) {        
+        mGeometryArena(geometryArena),
+        mTextureBackend(textureBackend),
+        mMipStreamer(mipStreamer),
+        mEviction(eviction) {
     }
 
     void StaticMeshModule::OnFinalize(
@@ -231,6 +248,7 @@ namespace okami::graphics::diligent {
     void StaticMeshModule::Update(
         core::ResourceManager*) {
         mMaterialBackend.Run();
+        mLodSelector.Update();
     }
 
     bool StaticMeshModule::IsIdle() {
@@ -268,6 +286,12 @@ namespace okami::graphics::diligent {
         attribs.mRadianceFalloff = 0.0;
     }
 
+    // Tells views apart for level of detail selection. A view is where
+    // it renders to and the camera it renders from.
+    static uint64_t GetLodViewKey(const RenderView& view) {
+        return (uint64_t)view.mTargetId * 31 + (uint64_t)view.mCamera;
+    }
+
     void StaticMeshModule::QueueCommands(
         DG::IDeviceContext* context,
         const core::Frame& frame,
@@ -320,7 +344,19 @@ namespace okami::graphics::diligent {
         }
         mLightsData.Write(context, lights, LIGHT_BUFFER_SIZE);
 
-        auto staticMeshes = registry.view<core::StaticMesh>();
+        // Reused by every mesh
+        std::vector<IndexRange> visibleRanges;
+
+        // Every pass of a view selects the same levels
+        auto lodView = GetLodViewKey(view);
+
+        // Meshes of the same arena pool share their buffers, they are
+        // only bound when the pool changes
+        uint32_t boundPool = GeometryRange::NO_POOL;
+
+        // Batched meshes are drawn by their batch
+        auto staticMeshes = registry.view<core::StaticMesh>(
+            entt::exclude<core::StaticBatchMember>);
         for (auto entity : staticMeshes) {
             const auto& staticMesh = staticMeshes.get<const core::StaticMesh>(entity);
             auto transform = registry.try_get<core::Transform>(entity);
@@ -333,25 +369,94 @@ namespace okami::graphics::diligent {
                 call.mWorldTransform = DG::float4x4::Identity();
             }
 
+            // Touched even when evicted, that is what brings it back
+            if (mEviction) {
+                mEviction->Touch(staticMesh.mGeometry);
+            }
+
             auto geo = mGeometryBackend->TryGet(staticMesh.mGeometry);
-            if (!geo)
+            if (!geo || !geo->mRange.IsValid())
                 continue;
 
-            // Setup vertex buffers
-            DG::IBuffer* vertBuffers[] = { 
-                geo->mVertexBuffers[0] 
-            };
-            DG::Uint64 offsets[] = { 0 };
-            context->SetVertexBuffers(0, 1, vertBuffers, offsets, 
-                RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_NONE);
-            if (geo->mIndexBuffer) {
-                context->SetIndexBuffer(geo->mIndexBuffer, 0, 
-                    RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            const auto& geoDesc = geo->mDesc;
+
+            // Distant meshes are drawn with a coarser level of detail
+            uint32_t lodLevel = 0;
+            if (geoDesc.bIsIndexed && !geo->mLods.empty()) {
+                lodLevel = mLodSelector.Select(lodView, entity, geo->mLods,
+                    core::EstimatePixelsPerUnit(globals.mCamera,
+                        ToOkami(globals.mViewOrigin),
+                        globals.mViewportSize.y,
+                        transform ? *transform : core::Transform(),
+                        geo->mBoundingBox));
+            }
+
+            // Only the meshlets that may be visible are drawn, and
+            // nothing is bound if none are. Meshlets only cover the full
+            // detail level.
+            bool bCullMeshlets = lodLevel == 0 &&
+                geoDesc.bIsIndexed && !geo->mMeshlets.empty();
+            if (bCullMeshlets) {
+                auto cullView = MeshletCullView::From(
+                    ToOkami(call.mWorldTransform),
+                    ToOkami(globals.mView * globals.mProjection),
+                    ToOkami(globals.mViewOrigin),
+                    ToOkami(globals.mViewDirection),
+                    globals.mCamera.mType == core::Camera::Type::ORTHOGRAPHIC);
+
+                visibleRanges.clear();
+                if (CullMeshlets(geo->mMeshlets, cullView, visibleRanges) == 0)
+                    continue;
+            }
+
+            // Setup vertex and index buffers
+            if (geo->mRange.mPool != boundPool) {
+                mGeometryArena->Bind(context, geo->mRange);
+                boundPool = geo->mRange.mPool;
             }
 
             // Bind shader resources for material
             auto mat = mMaterialBackend.TryGet(call.mStaticMesh.mMaterial);
             if (mat) {
+                // Every texture of the surface is kept alive and
+                // streamed, not only the ones the shader samples
+                auto textures = GetMaterialTextures(mat->mSurface);
+                bool bStale = false;
+                float screenSize = -1.0f;
+
+                for (size_t i = 0; i < textures.size(); ++i) {
+                    auto texture = mTextureBackend->TryGet(textures[i]);
+                    if (!texture) {
+                        continue;
+                    }
+
+                    if (mEviction) {
+                        mEviction->Touch(textures[i]);
+                    }
+
+                    // Residency changed, the old texture is gone
+                    if (texture->mVersion != mat->mTextureVersions[i]) {
+                        bStale = true;
+                    }
+
+                    if (transform && mMipStreamer) {
+                        if (screenSize < 0.0f) {
+                            const auto& origin = globals.mViewOrigin;
+                            screenSize = core::EstimateScreenSize(globals.mCamera,
+                                glm::vec3(origin.x, origin.y, origin.z),
+                                globals.mViewportSize.y,
+                                *transform,
+                                geo->mBoundingBox);
+                        }
+                        mMipStreamer->RequestScreenSize(texture->mId, screenSize);
+                    }
+                }
+
+                if (bStale) {
+                    mat->mBindings.clear();
+                    InitializeMaterial(mat->mSurface, *mat);
+                }
+
                 context->CommitShaderResources(
                     mat->mBindings[pipelineId],
                     RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
@@ -367,20 +472,55 @@ namespace okami::graphics::diligent {
             instanceData.mWorld = call.mWorldTransform;
             instanceData.mEntity = (int32_t)entity;
 
+            // The vertex shader scales positions back out of the box
+            const auto& bounds = geo->mBoundingBox;
+            auto extent = bounds.mUpper - bounds.mLower;
+            instanceData.mPositionOffset = DG::float4(
+                bounds.mLower.x, bounds.mLower.y, bounds.mLower.z, 0.0f);
+            instanceData.mPositionScale = DG::float4(
+                extent.x, extent.y, extent.z, 0.0f);
+
             // Submit instance data to the GPU
             mInstanceData.Write(context, instanceData);
             
-            // Submit draw call to GPU
-            const auto& geoDesc = geo->mDesc;
-            if (geo->mIndexBuffer) {
+            // Submit draw call to GPU, offset to where the geometry
+            // lives in the arena
+            uint32_t baseVertex = mGeometryArena->GetBaseVertex(geo->mRange);
+            uint32_t firstIndex = geoDesc.bIsIndexed ?
+                mGeometryArena->GetFirstIndex(geo->mRange,
+                    geoDesc.mIndexedAttribs.mIndexType) : 0;
+
+            if (bCullMeshlets) {
+                DG::DrawIndexedAttribs attribs;
+                attribs.IndexType = ToDiligent(geoDesc.mIndexedAttribs.mIndexType);
+                attribs.BaseVertex = baseVertex;
+                for (auto& range : visibleRanges) {
+                    attribs.NumIndices = range.mIndexCount;
+                    attribs.FirstIndexLocation = firstIndex + range.mFirstIndex;
+                    context->DrawIndexed(attribs);
+                }
+            } else if (lodLevel > 0) {
+                const auto& lod = geo->mLods[lodLevel - 1];
+
+                DG::DrawIndexedAttribs attribs;
+                attribs.NumIndices = lod.mIndexCount;
+                attribs.FirstIndexLocation = firstIndex + lod.mFirstIndex;
+                attribs.BaseVertex = baseVertex;
+                attribs.IndexType = ToDiligent(geoDesc.mIndexedAttribs.mIndexType);
+
+                context->DrawIndexed(attribs);
+            } else if (geoDesc.bIsIndexed) {
                 DG::DrawIndexedAttribs attribs;
                 attribs.NumIndices = geoDesc.mIndexedAttribs.mNumIndices;
+                attribs.FirstIndexLocation = firstIndex;
+                attribs.BaseVertex = baseVertex;
                 attribs.IndexType = ToDiligent(geoDesc.mIndexedAttribs.mIndexType);
 
                 context->DrawIndexed(attribs);
             } else {
                 DG::DrawAttribs attribs;
                 attribs.NumVertices = geoDesc.mAttribs.mNumVertices;
+                attribs.StartVertexLocation = baseVertex;
                 context->Draw(attribs);
             }
 
@@ -444,17 +584,25 @@ namespace okami::graphics::diligent {
 
         auto getTexture = [
             textures = mTextureBackend, 
-            &defaultTex = mDefaultTexture](resource_id_t id) {
+            &defaultTex = mDefaultTexture](Handle<core::Texture> id) {
             auto backend = textures->TryGet(id);
             if (backend) {
                 backend->mEvent->wait();
-                return backend->mTexture;
+                // Evicted textures stay signaled but have no GPU copy
+                return backend->mTexture ? backend->mTexture : defaultTex;
             } else {
                 return defaultTex;
             }
         };
 
         auto albedo = getTexture(data.mAlbedo);
+
+        auto textures = GetMaterialTextures(data);
+        for (size_t i = 0; i < textures.size(); ++i) {
+            auto backend = mTextureBackend->TryGet(textures[i]);
+            impl.mTextureVersions[i] = backend ? backend->mVersion : 0;
+        }
+        impl.mSurface = data;
        
         for (auto& pipeline : mPipelines) {
             DG::IShaderResourceBinding* binding = nullptr;
@@ -0,0 +1,135 @@
+#include <okami/ByteBuffer.hpp>
+#include <okami/Geometry.hpp>
+#include <okami/Texture.hpp>
+
+#include <iostream>
+#include <stdexcept>
+
+using namespace okami;
+using namespace okami::core;
+
+#define TEST_ASSERT(x) \
+    if (!(x)) { \
+        std::cerr << \
+            "LINE " << __LINE__  << ": Test Failed: " << #x << std::endl; \
+        throw std::runtime_error("Test Failed!"); \
+    }
+
+constexpr size_t PASS_COUNT = 3;
+
+// Cooked assets of a small "level", kept as file contents
+struct Level {
+    std::vector<std::vector<uint8_t>> mTextures;
+    std::vector<std::vector<uint8_t>> mGeometries;
+};
+
+Level CookLevel(const VertexFormat& layout) {
+    Level level;
+
+    std::pair<uint, uint> textureSizes[] = {
+        { 256, 256 }, { 64, 64 }, { 512, 128 }, { 100, 30 }
+    };
+    for (auto& size : textureSizes) {
+        auto texture = Texture::Prefabs::SolidColor(size.first, size.second,
+            glm::vec4(0.25f, 0.5f, 0.75f, 1.0f));
+        level.mTextures.emplace_back();
+        texture.DataCPU().Save(level.mTextures.back());
+    }
+
+    Geometry geometries[] = {
+        Geometry::Prefabs::Box(layout),
+        Geometry::Prefabs::Sphere(layout),
+        Geometry::Prefabs::UtahTeapot(layout)
+    };
+    for (auto& geometry : geometries) {
+        level.mGeometries.emplace_back();
+        geometry.DataCPU().Save(level.mGeometries.back());
+    }
+
+    return level;
+}
+
+// Loads everything and keeps it until the end, like a level would
+void LoadLevel(const Level& level, const VertexFormat& layout) {
+    std::vector<Texture::Data> textures;
+    std::vector<Geometry::RawData> geometries;
+
+    for (auto& bytes : level.mTextures) {
+        textures.emplace_back(Texture::Data::Load("level.oktex",
+            ByteView(bytes), LoadParams<Texture>()));
+    }
+    for (auto& bytes : level.mGeometries) {
+        geometries.emplace_back(Geometry::RawData::Load("level.okgeo",
+            ByteView(bytes), layout));
+    }
+
+    TEST_ASSERT(textures[0].mDesc.mWidth == 256);
+    TEST_ASSERT(geometries[0].mDesc.mAttribs.mNumVertices == 24);
+}
+
+void TestReloadIsPooled() {
+    auto layout = VertexFormat::PositionUVNormal();
+    auto& pool = ByteBufferPool::Default();
+
+    auto level = CookLevel(layout);
+    Geometry::Prefabs::ClearCache();
+
+    auto before = pool.GetStats();
+    LoadLevel(level, layout);
+    auto first = pool.GetStats();
+
+    uint64_t firstSystem = first.mSystemAllocations - before.mSystemAllocations;
+    uint64_t firstPooled = first.mPooledAllocations - before.mPooledAllocations;
+    std::cout << "First pass: " << firstSystem << " system, "
+        << firstPooled << " pooled allocations" << std::endl;
+    TEST_ASSERT(first.mCachedBytes > before.mCachedBytes);
+
+    // Later passes ask for the same sizes in the same order, all of
+    // which the first one gave back
+    for (size_t i = 1; i < PASS_COUNT; ++i) {
+        auto start = pool.GetStats();
+        LoadLevel(level, layout);
+        auto end = pool.GetStats();
+
+        uint64_t system = end.mSystemAllocations - start.mSystemAllocations;
+        uint64_t pooled = end.mPooledAllocations - start.mPooledAllocations;
+        std::cout << "Pass " << i + 1 << ": " << system << " system, "
+            << pooled << " pooled allocations" << std::endl;
+
+        TEST_ASSERT(system == 0);
+        TEST_ASSERT(pooled >= firstSystem);
+        TEST_ASSERT(end.mCachedBytes == first.mCachedBytes);
+    }
+}
+
+void TestTrim() {
+    ByteBufferPool pool;
+
+    {
+        ByteBuffer a(1000, &pool);
+        ByteBuffer b(5000, &pool);
+    }
+    auto stats = pool.GetStats();
+    TEST_ASSERT(stats.mSystemAllocations == 2);
+    TEST_ASSERT(stats.mCachedBytes ==
+        ByteBufferPool::GetSizeClass(1000) + ByteBufferPool::GetSizeClass(5000));
+
+    {
+        ByteBuffer a(1000, &pool);
+    }
+    TEST_ASSERT(pool.GetStats().mPooledAllocations == 1);
+
+    pool.Trim();
+    TEST_ASSERT(pool.GetStats().mCachedBytes == 0);
+    {
+        ByteBuffer a(1000, &pool);
+    }
+    TEST_ASSERT(pool.GetStats().mSystemAllocations == 3);
+}
+
+int main() {
+    TestReloadIsPooled();
+    TestTrim();
+    std::cout << "Byte buffer pool tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,213 @@
+#include <okami/Compression.hpp>
+#include <okami/Geometry.hpp>
+#include <okami/Texture.hpp>
+
+#include <marl/defer.h>
+#include <marl/scheduler.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+using namespace okami;
+using namespace okami::core;
+
+#define TEST_ASSERT(x) \
+    if (!(x)) { \
+        std::cerr << \
+            "LINE " << __LINE__  << ": Test Failed: " << #x << std::endl; \
+        throw std::runtime_error("Test Failed!"); \
+    }
+
+// Numbers are for files in the OS cache, which hides the disk. To see
+// the effect on a cold HDD, drop the page cache between runs.
+constexpr uint ITERATIONS = 8;
+
+template <typename FuncT>
+double TimeSeconds(FuncT&& func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (uint i = 0; i < ITERATIONS; ++i) {
+        func();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(end - start).count() / ITERATIONS;
+}
+
+void Report(const char* name, size_t rawBytes, size_t fileBytes, double seconds) {
+    std::cout << name << ": "
+        << fileBytes / 1024 << " KB on disk, "
+        << seconds * 1000.0 << " ms, "
+        << (rawBytes / (1024.0 * 1024.0)) / seconds << " MB/s" << std::endl;
+}
+
+Texture::Data MakeTexture(uint32_t size) {
+    Texture::Desc desc;
+    desc.mType = ResourceDimension::Texture2D;
+    desc.mWidth = size;
+    desc.mHeight = size;
+    desc.mFormat = TextureFormat::RGBA8_UNORM();
+    desc.mMipLevels = MipCount(size, size, 1);
+
+    // Smooth gradients with a bit of noise, like a typical albedo map
+    std::mt19937 rng(7);
+    auto data = Texture::Data::Alloc(desc);
+    for (uint32_t y = 0; y < size; ++y) {
+        for (uint32_t x = 0; x < size; ++x) {
+            auto ptr = &data.mData[(y * size + x) * 4];
+            ptr[0] = (uint8_t)(x * 255 / size);
+            ptr[1] = (uint8_t)(y * 255 / size);
+            ptr[2] = (uint8_t)(128 + 64 * std::sin(x * 0.05f) + (rng() & 7));
+            ptr[3] = 255;
+        }
+    }
+    data.GenerateMips();
+    return data;
+}
+
+void TestRoundTrip() {
+    std::mt19937 rng(3);
+
+    for (uint trial = 0; trial < 64; ++trial) {
+        size_t size = trial < 16 ? trial : rng() % (1 << 20);
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = trial % 2 == 0 ? (uint8_t)rng() : (uint8_t)((i / 9) % 31);
+        }
+
+        ChunkedPayloadParams params;
+        params.mChunkSize = 1 + rng() % (1 << 18);
+        params.bCompress = trial % 3 != 0;
+
+        std::vector<uint8_t> payload;
+        WriteChunkedPayload(payload, data.data(), data.size(), params);
+
+        ChunkedPayloadReader reader(payload.data(), payload.size());
+        TEST_ASSERT(reader.PeekSize() == size);
+        std::vector<uint8_t> result(size);
+        reader.Read(result.data(), result.size());
+        reader.Flush();
+        TEST_ASSERT(result == data);
+        TEST_ASSERT(reader.GetCursor() == payload.data() + payload.size());
+    }
+
+    // Empty blocks, with the null pointers an empty vector hands out
+    uint8_t block[16];
+    auto emptySize = LZ4Compress(nullptr, 0, block, sizeof(block));
+    TEST_ASSERT(emptySize == 1);
+    TEST_ASSERT(LZ4Decompress(block, emptySize, nullptr, 0));
+}
+
+void BenchmarkTexture(const std::filesystem::path& dir) {
+    auto texture = MakeTexture(2048);
+    auto rawPath = dir / "bench_raw.oktex";
+    auto lz4Path = dir / "bench_lz4.oktex";
+
+    ChunkedPayloadParams rawParams;
+    rawParams.bCompress = false;
+    texture.Save(rawPath, rawParams);
+    texture.Save(lz4Path);
+
+    LoadParams<Texture> params;
+    auto loaded = Texture::Data::Load(lz4Path, params);
+    TEST_ASSERT(loaded.mData == texture.mData);
+    TEST_ASSERT(loaded.mDesc.mMipLevels == texture.mDesc.mMipLevels);
+
+    auto rawTime = TimeSeconds([&]() {
+        Texture::Data::Load(rawPath, params);
+    });
+    auto lz4Time = TimeSeconds([&]() {
+        Texture::Data::Load(lz4Path, params);
+    });
+
+    Report("Texture uncompressed", texture.mData.size(),
+        std::filesystem::file_size(rawPath), rawTime);
+    Report("Texture LZ4", texture.mData.size(),
+        std::filesystem::file_size(lz4Path), lz4Time);
+
+    std::filesystem::remove(rawPath);
+    std::filesystem::remove(lz4Path);
+}
+
+void BenchmarkGeometry(const std::filesystem::path& dir) {
+    auto layout = VertexFormat::PositionUVNormalTangent();
+    auto geometry = Geometry::Prefabs::StanfordBunny(layout);
+    auto& data = geometry.DataCPU();
+    auto rawPath = dir / "bench_raw.okgeo";
+    auto lz4Path = dir / "bench_lz4.okgeo";
+
+    ChunkedPayloadParams rawParams;
+    rawParams.bCompress = false;
+    data.Save(rawPath, rawParams);
+    data.Save(lz4Path);
+
+    auto loaded = Geometry::RawData::Load(lz4Path, layout);
+    TEST_ASSERT(loaded.mVertexBuffers.size() == data.mVertexBuffers.size());
+    for (size_t i = 0; i < data.mVertexBuffers.size(); ++i) {
+        TEST_ASSERT(loaded.mVertexBuffers[i].mBytes == data.mVertexBuffers[i].mBytes);
+    }
+    TEST_ASSERT(loaded.mIndexBuffer.mBytes == data.mIndexBuffer.mBytes);
+    TEST_ASSERT(loaded.mDesc.mAttribs.mNumVertices == data.mDesc.mAttribs.mNumVertices);
+
+    // Packed with a different layout
+    bool bThrown = false;
+    try {
+        Geometry::RawData::Load(lz4Path, VertexFormat::Position());
+    } catch (std::runtime_error&) {
+        bThrown = true;
+    }
+    TEST_ASSERT(bThrown);
+
+    auto rawTime = TimeSeconds([&]() {
+        Geometry::RawData::Load(rawPath, layout);
+    });
+    auto lz4Time = TimeSeconds([&]() {
+        Geometry::RawData::Load(lz4Path, layout);
+    });
+
+    Report("Geometry uncompressed", geometry.GetCPUByteSize(),
+        std::filesystem::file_size(rawPath), rawTime);
+    Report("Geometry LZ4", geometry.GetCPUByteSize(),
+        std::filesystem::file_size(lz4Path), lz4Time);
+
+    std::filesystem::remove(rawPath);
+    std::filesystem::remove(lz4Path);
+}
+
+void BenchmarkDecompression(const char* name) {
+    auto texture = MakeTexture(2048);
+    std::vector<uint8_t> payload;
+    WriteChunkedPayload(payload, texture.mData.data(), texture.mData.size());
+
+    ByteBuffer result(texture.mData.size());
+    auto time = TimeSeconds([&]() {
+        ChunkedPayloadReader reader(payload.data(), payload.size());
+        reader.Read(result.data(), result.size());
+        reader.Flush();
+    });
+    TEST_ASSERT(result == texture.mData);
+
+    Report(name, texture.mData.size(), payload.size(), time);
+}
+
+int main() {
+    Texture::Register();
+    Geometry::Register();
+
+    auto dir = std::filesystem::temp_directory_path();
+
+    TestRoundTrip();
+    BenchmarkDecompression("Decompression, one thread");
+
+    marl::Scheduler scheduler(marl::Scheduler::Config::allCores());
+    scheduler.bind();
+    defer(scheduler.unbind());
+
+    TestRoundTrip();
+    BenchmarkDecompression("Decompression, marl");
+    BenchmarkTexture(dir);
+    BenchmarkGeometry(dir);
+
+    return 0;
+}
@@ -52,7 +52,7 @@ void TestBackend(GraphicsBackend backend) {
         auto staticMeshLayout = vertexLayouts->GetVertexLayout<StaticMesh>();
 
         // Create a geometry object from a built-in prefab
-        auto geo = resources.Add(Geometry::Prefabs::MaterialBall(staticMeshLayout));
+        auto geo = Geometry::Prefabs::MaterialBall(resources, staticMeshLayout);
         // Load a texture from disk
         auto texture = resources.Add(Texture("test.png"));
 
@@ -0,0 +1,209 @@
+#include <okami/Eviction.hpp>
+
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+using namespace okami;
+using namespace okami::core;
+
+#define TEST_ASSERT(x) \
+    if (!(x)) { \
+        std::cerr << \
+            "LINE " << __LINE__  << ": Test Failed: " << #x << std::endl; \
+        throw std::runtime_error("Test Failed!"); \
+    }
+
+constexpr uint64_t RESOURCE_SIZE = 100;
+
+// Pretends to be the GPU. Reloads finish whenever the test says so, like
+// a load that takes a few frames.
+class FakeEvictionBackend : public IEvictionBackend {
+public:
+    EvictionManager* mManager = nullptr;
+    std::unordered_map<resource_id_t, bool> mResident;
+    std::vector<resource_id_t> mEvicted;
+    std::vector<resource_id_t> mPendingReloads;
+
+    void Upload(resource_id_t id) {
+        mResident[id] = true;
+        mManager->Add(id, this, RESOURCE_SIZE);
+    }
+
+    void Evict(resource_id_t id) override {
+        TEST_ASSERT(mResident[id]);
+        mResident[id] = false;
+        mEvicted.emplace_back(id);
+    }
+
+    void Reload(resource_id_t id) override {
+        TEST_ASSERT(!mResident[id]);
+        mPendingReloads.emplace_back(id);
+    }
+
+    void FinishReloads() {
+        for (auto id : mPendingReloads) {
+            Upload(id);
+        }
+        mPendingReloads.clear();
+    }
+
+    uint64_t GetResidentBytes() const {
+        uint64_t result = 0;
+        for (auto& [id, bResident] : mResident) {
+            if (bResident) {
+                result += RESOURCE_SIZE;
+            }
+        }
+        return result;
+    }
+};
+
+void TestLeastRecentlyUsed() {
+    EvictionParams params;
+    params.mBudget = RESOURCE_SIZE * 4;
+    params.mMinIdleFrames = 0;
+    EvictionManager manager(params);
+    FakeEvictionBackend gpu;
+    gpu.mManager = &manager;
+
+    for (resource_id_t id = 0; id < 4; ++id) {
+        gpu.Upload(id);
+    }
+    manager.Update();
+    TEST_ASSERT(gpu.mEvicted.empty());
+
+    // Use them in reverse, so 3 is the oldest afterwards
+    for (resource_id_t id = 4; id > 0; --id) {
+        manager.Touch(id - 1);
+        manager.Update();
+    }
+
+    gpu.Upload(4);
+    TEST_ASSERT(manager.GetResidentBytes() == RESOURCE_SIZE * 5);
+    manager.Update();
+    TEST_ASSERT(gpu.mEvicted.size() == 1);
+    TEST_ASSERT(gpu.mEvicted[0] == 3);
+    TEST_ASSERT(!manager.IsResident(3));
+    TEST_ASSERT(manager.GetResidentBytes() == params.mBudget);
+    TEST_ASSERT(manager.GetResidentBytes() == gpu.GetResidentBytes());
+
+    // Two more, the next oldest go
+    gpu.Upload(5);
+    gpu.Upload(6);
+    manager.Update();
+    TEST_ASSERT(gpu.mEvicted.size() == 3);
+    TEST_ASSERT(gpu.mEvicted[1] == 2);
+    TEST_ASSERT(gpu.mEvicted[2] == 1);
+    TEST_ASSERT(manager.GetEvictionCount() == 3);
+
+    // Removed resources no longer count
+    manager.Remove(6);
+    TEST_ASSERT(!manager.Contains(6));
+    TEST_ASSERT(manager.GetResidentBytes() == RESOURCE_SIZE * 3);
+}
+
+void TestPinnedAndIdle() {
+    EvictionParams params;
+    params.mBudget = RESOURCE_SIZE * 2;
+    params.mMinIdleFrames = 2;
+    EvictionManager manager(params);
+    FakeEvictionBackend gpu;
+    gpu.mManager = &manager;
+
+    for (resource_id_t id = 0; id < 4; ++id) {
+        gpu.Upload(id);
+    }
+    manager.SetPinned(0, true);
+
+    // Everything was just used, so nothing may go even over budget
+    manager.Update();
+    manager.Update();
+    TEST_ASSERT(gpu.mEvicted.empty());
+
+    // Keep 1 in use every frame
+    for (uint frame = 0; frame < 8; ++frame) {
+        manager.Touch(1);
+        manager.Update();
+    }
+
+    TEST_ASSERT(manager.IsResident(0));
+    TEST_ASSERT(manager.IsResident(1));
+    TEST_ASSERT(!manager.IsResident(2));
+    TEST_ASSERT(!manager.IsResident(3));
+    TEST_ASSERT(manager.GetResidentBytes() <= params.mBudget);
+
+    // Pinned and in use beats the budget
+    manager.SetBudget(0);
+    for (uint frame = 0; frame < 8; ++frame) {
+        manager.Touch(1);
+        manager.Update();
+    }
+    TEST_ASSERT(manager.IsResident(0));
+    TEST_ASSERT(manager.IsResident(1));
+
+    manager.SetPinned(0, false);
+    manager.Update();
+    TEST_ASSERT(!manager.IsResident(0));
+    TEST_ASSERT(manager.GetResidentBytes() == gpu.GetResidentBytes());
+}
+
+void TestReload() {
+    EvictionParams params;
+    params.mBudget = RESOURCE_SIZE * 2;
+    params.mMinIdleFrames = 1;
+    EvictionManager manager(params);
+    FakeEvictionBackend gpu;
+    gpu.mManager = &manager;
+
+    for (resource_id_t id = 0; id < 3; ++id) {
+        gpu.Upload(id);
+    }
+    manager.Touch(1);
+    manager.Touch(2);
+    manager.Update();
+    manager.Touch(1);
+    manager.Touch(2);
+    manager.Update();
+    TEST_ASSERT(!manager.IsResident(0));
+
+    // Touching it again asks for it back once, however often it is
+    // touched before the reload finishes.
+    manager.Touch(0);
+    manager.Touch(0);
+    manager.Update();
+    TEST_ASSERT(gpu.mPendingReloads.size() == 1);
+    manager.Touch(0);
+    manager.Update();
+    TEST_ASSERT(gpu.mPendingReloads.size() == 1);
+    TEST_ASSERT(manager.GetReloadCount() == 1);
+
+    gpu.FinishReloads();
+    TEST_ASSERT(manager.IsResident(0));
+    TEST_ASSERT(manager.GetResidentBytes() == gpu.GetResidentBytes());
+
+    // Back over budget, the reloaded resource was just used so one of
+    // the others has to make room.
+    manager.Touch(0);
+    manager.Update();
+    manager.Touch(0);
+    manager.Update();
+    TEST_ASSERT(manager.IsResident(0));
+    TEST_ASSERT(manager.GetResidentBytes() <= params.mBudget);
+    TEST_ASSERT(manager.GetResidentBytes() == gpu.GetResidentBytes());
+
+    // Resizing in place does not count as a use
+    manager.Resize(0, RESOURCE_SIZE * 2);
+    TEST_ASSERT(manager.GetResidentBytes() > params.mBudget);
+    manager.Update();
+    manager.Update();
+    TEST_ASSERT(manager.GetResidentBytes() <= params.mBudget);
+}
+
+int main() {
+    TestLeastRecentlyUsed();
+    TestPinnedAndIdle();
+    TestReload();
+    std::cout << "Eviction tests passed" << std::endl;
+    return 0;
+}
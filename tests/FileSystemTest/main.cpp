@@ -0,0 +1,212 @@
+#include <okami/VirtualFileSystem.hpp>
+
+#include <marl/defer.h>
+#include <marl/scheduler.h>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+using namespace okami;
+using namespace okami::core;
+
+#define TEST_ASSERT(x) \
+    if (!(x)) { \
+        std::cerr << \
+            "LINE " << __LINE__  << ": Test Failed: " << #x << std::endl; \
+        throw std::runtime_error("Test Failed!"); \
+    }
+
+constexpr size_t SMALL_SIZE = 1000;
+// Larger than a single read of most backends, and not a multiple of
+// any block size
+constexpr size_t LARGE_SIZE = 3 * 1024 * 1024 + 17;
+constexpr size_t CONCURRENT_READS = 200;
+
+typedef std::function<std::unique_ptr<IFileReadBackend>()> backend_factory_t;
+
+// Every file gets different contents, so that reading the wrong one or
+// the wrong range is noticed
+std::vector<uint8_t> MakeContents(size_t size, uint8_t seed) {
+    std::vector<uint8_t> result(size);
+    for (size_t i = 0; i < size; ++i) {
+        result[i] = (uint8_t)(i * 31 + seed + (i >> 8));
+    }
+    return result;
+}
+
+void WriteFile(const std::filesystem::path& path,
+    const std::vector<uint8_t>& contents) {
+    std::ofstream file(path, std::ios::binary);
+    file.write((const char*)contents.data(), contents.size());
+    if (!file) {
+        throw std::runtime_error("Failed to write " + path.string());
+    }
+}
+
+bool Matches(const ByteView& bytes, const std::vector<uint8_t>& contents,
+    size_t offset, size_t size) {
+    return bytes.size() == size &&
+        (size == 0 || std::memcmp(bytes.data(), &contents[offset], size) == 0);
+}
+
+struct Files {
+    std::filesystem::path mDir;
+    std::filesystem::path mPack;
+    std::vector<uint8_t> mSmall;
+    std::vector<uint8_t> mLarge;
+    std::vector<uint8_t> mText;
+
+    Files() {
+        mDir = std::filesystem::temp_directory_path() / "okami-file-system-test";
+        std::filesystem::create_directories(mDir / "sub");
+
+        mSmall = MakeContents(SMALL_SIZE, 1);
+        mLarge = MakeContents(LARGE_SIZE, 2);
+        std::string text = "float4 main() : SV_Target { return 1; }";
+        mText.assign(text.begin(), text.end());
+
+        WriteFile(mDir / "small.bin", mSmall);
+        WriteFile(mDir / "sub" / "large.bin", mLarge);
+        WriteFile(mDir / "empty.bin", {});
+        WriteFile(mDir / "text.hlsl", mText);
+
+        mPack = mDir / "test.okpak";
+        PackMount::Write(mPack, {
+            { "small.bin", mDir / "small.bin" },
+            { "empty.bin", mDir / "empty.bin" },
+            { "sub/large.bin", mDir / "sub" / "large.bin" },
+            { "./sub/../text.hlsl", mDir / "text.hlsl" }
+        });
+    }
+
+    ~Files() {
+        std::error_code ec;
+        std::filesystem::remove_all(mDir, ec);
+    }
+};
+
+// The same files through a directory mount at the root and a pack
+// mounted under "pack"
+void TestReads(const Files& files, std::unique_ptr<IFileReadBackend>&& backend) {
+    VirtualFileSystem fileSystem;
+    fileSystem.SetReadBackend(std::move(backend));
+    fileSystem.Mount("", std::make_unique<DirectoryMount>(files.mDir));
+    fileSystem.Mount("pack", std::make_unique<PackMount>(files.mPack));
+
+    for (std::filesystem::path prefix : { "", "pack" }) {
+        auto small = prefix / "small.bin";
+        auto large = prefix / "sub" / "large.bin";
+        auto empty = prefix / "empty.bin";
+
+        TEST_ASSERT(fileSystem.Exists(small));
+        TEST_ASSERT(Matches(fileSystem.Read(small), files.mSmall, 0, SMALL_SIZE));
+        TEST_ASSERT(Matches(fileSystem.Read(large), files.mLarge, 0, LARGE_SIZE));
+
+        // Ranges, clamped to the end of the file
+        TEST_ASSERT(Matches(fileSystem.Read(small, { 100, 50 }),
+            files.mSmall, 100, 50));
+        TEST_ASSERT(Matches(fileSystem.Read(small, { 990, 100 }),
+            files.mSmall, 990, 10));
+        TEST_ASSERT(Matches(fileSystem.Read(large, { LARGE_SIZE - 4097, 4096 }),
+            files.mLarge, LARGE_SIZE - 4097, 4096));
+
+        // Reading at the end gives nothing, past it is an error
+        TEST_ASSERT(fileSystem.Read(small, { SMALL_SIZE, 10 }).size() == 0);
+        auto past = fileSystem.ReadAsync(small, { SMALL_SIZE + 1, 10 });
+        TEST_ASSERT(!past.Get().IsOk());
+
+        TEST_ASSERT(fileSystem.Exists(empty));
+        auto emptyRead = fileSystem.ReadAsync(empty);
+        TEST_ASSERT(emptyRead.Get().IsOk());
+        TEST_ASSERT(emptyRead.Get().mBytes.size() == 0);
+
+        std::string text;
+        TEST_ASSERT(fileSystem.TryFind(prefix / "text.hlsl", &text));
+        TEST_ASSERT(text.size() == files.mText.size());
+        TEST_ASSERT(std::memcmp(text.data(), files.mText.data(), text.size()) == 0);
+    }
+
+    // The pack only has what was written into it
+    TEST_ASSERT(!fileSystem.Exists("pack/test.okpak"));
+    auto missing = fileSystem.ReadAsync("missing.bin");
+    TEST_ASSERT(!missing.Get().IsOk());
+    bool bThrown = false;
+    try {
+        fileSystem.Read("pack/missing.bin");
+    } catch (std::runtime_error&) {
+        bThrown = true;
+    }
+    TEST_ASSERT(bThrown);
+
+    // Many reads in flight at once, each of its own range
+    std::vector<Future<FileReadResult>> reads;
+    std::vector<FileRange> ranges;
+    for (size_t i = 0; i < CONCURRENT_READS; ++i) {
+        FileRange range;
+        range.mOffset = (i * 7919) % LARGE_SIZE;
+        range.mSize = 1 + (i * 104729) % 65536;
+        ranges.emplace_back(range);
+        reads.emplace_back(fileSystem.ReadAsync(
+            i % 2 == 0 ? "sub/large.bin" : "pack/sub/large.bin", range));
+    }
+    for (size_t i = 0; i < CONCURRENT_READS; ++i) {
+        auto& result = reads[i].Get();
+        TEST_ASSERT(result.IsOk());
+        size_t size = std::min<size_t>(ranges[i].mSize,
+            LARGE_SIZE - ranges[i].mOffset);
+        TEST_ASSERT(Matches(result.mBytes, files.mLarge,
+            ranges[i].mOffset, size));
+    }
+}
+
+void TestEmbedded() {
+    // Binary data with zeros in it keeps its size
+    static const uint8_t blob[] = { 1, 0, 2, 0, 0, 3 };
+    static const char* text = "hello";
+
+    auto mount = std::make_unique<EmbeddedMount>([](file_map_t* files) {
+        (*files)["text.txt"] = text;
+    });
+    mount->Add("blob.bin", blob, sizeof(blob));
+
+    VirtualFileSystem fileSystem;
+    fileSystem.Mount("", std::move(mount));
+
+    auto bytes = fileSystem.Read("blob.bin");
+    TEST_ASSERT(bytes.size() == sizeof(blob));
+    TEST_ASSERT(bytes.data() == blob);
+    TEST_ASSERT(fileSystem.Read("blob.bin", { 2, 3 }).data() == blob + 2);
+    TEST_ASSERT(fileSystem.Read("text.txt").size() == 5);
+}
+
+void TestBackends(const Files& files) {
+    std::cout << "Thread pool backend" << std::endl;
+    TestReads(files, CreateThreadPoolReadBackend(2));
+
+    auto uring = CreateIOUringReadBackend(64);
+    if (uring) {
+        std::cout << "io_uring backend" << std::endl;
+        TestReads(files, std::move(uring));
+    } else {
+        std::cout << "io_uring is not available, skipped" << std::endl;
+    }
+}
+
+int main() {
+    Files files;
+
+    TestEmbedded();
+    TestBackends(files);
+
+    // Results are handed to marl when a scheduler is bound
+    marl::Scheduler scheduler(marl::Scheduler::Config::allCores());
+    scheduler.bind();
+    defer(scheduler.unbind());
+
+    TestBackends(files);
+
+    std::cout << "File system tests passed" << std::endl;
+    return 0;
+}
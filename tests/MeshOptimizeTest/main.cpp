@@ -0,0 +1,492 @@
+#include <okami/MeshOptimizer.hpp>
+#include <okami/LodSelection.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+using namespace okami;
+using namespace okami::core;
+
+#define TEST_ASSERT(x) \
+    if (!(x)) { \
+        std::cerr << \
+            "LINE " << __LINE__  << ": Test Failed: " << #x << std::endl; \
+        throw std::runtime_error("Test Failed!"); \
+    }
+
+typedef std::array<float, 9> TrianglePositions;
+
+// A grid of size x size quads with its triangles shuffled, the way an
+// unoptimized importer might hand it over. With bSplitVertices every
+// triangle gets vertices of its own, which have to be merged again.
+Geometry::Data<> MakeGrid(uint size, bool bSplitVertices) {
+    Geometry::Data<> data;
+    data.mUVs.resize(1);
+
+    auto corner = [size](uint x, uint y) {
+        return y * (size + 1) + x;
+    };
+
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (uint y = 0; y < size; ++y) {
+        for (uint x = 0; x < size; ++x) {
+            triangles.push_back({ corner(x, y), corner(x + 1, y), corner(x, y + 1) });
+            triangles.push_back({ corner(x + 1, y), corner(x + 1, y + 1), corner(x, y + 1) });
+        }
+    }
+
+    std::mt19937 rng(7);
+    std::shuffle(triangles.begin(), triangles.end(), rng);
+
+    auto addVertex = [&](uint32_t c) {
+        float x = (float)(c % (size + 1));
+        float y = (float)(c / (size + 1));
+        data.mPositions.emplace_back(x, y, 0.0f);
+        data.mUVs[0].emplace_back(x / size, y / size);
+        return (uint32_t)(data.mPositions.size() - 1);
+    };
+
+    if (!bSplitVertices) {
+        for (uint32_t c = 0; c < (size + 1) * (size + 1); ++c) {
+            addVertex(c);
+        }
+    }
+
+    for (auto& tri : triangles) {
+        for (auto c : tri) {
+            data.mIndices.emplace_back(bSplitVertices ? addVertex(c) : c);
+        }
+    }
+
+    return data;
+}
+
+// Triangles as positions, rotated to start at their smallest corner so
+// that reordering triangles or vertices doesn't change the result, but
+// flipping the winding does
+std::vector<TrianglePositions> GetTriangles(const Geometry::Data<>& data) {
+    std::vector<TrianglePositions> result;
+    for (size_t i = 0; i < data.mIndices.size(); i += 3) {
+        std::array<std::array<float, 3>, 3> corners;
+        for (int c = 0; c < 3; ++c) {
+            auto& p = data.mPositions[data.mIndices[i + c]];
+            corners[c] = { p.x, p.y, p.z };
+        }
+        auto first = std::min_element(corners.begin(), corners.end()) - corners.begin();
+        std::rotate(corners.begin(), corners.begin() + first, corners.end());
+
+        TrianglePositions tri;
+        for (int c = 0; c < 3; ++c) {
+            std::copy(corners[c].begin(), corners[c].end(), tri.begin() + 3 * c);
+        }
+        result.emplace_back(tri);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void TestAnalyze() {
+    std::vector<uint32_t> indices = { 0, 1, 2 };
+    auto stats = AnalyzeVertexCache(indices.data(), indices.size(), 3);
+    TEST_ASSERT(stats.mACMR == 3.0f);
+    TEST_ASSERT(stats.mATVR == 1.0f);
+
+    // The second copy is served entirely by the cache
+    indices = { 0, 1, 2, 2, 1, 0 };
+    stats = AnalyzeVertexCache(indices.data(), indices.size(), 3);
+    TEST_ASSERT(stats.mACMR == 1.5f);
+
+    // Vertex 0 falls out of a 3 entry cache before it is used again
+    indices = { 0, 1, 2, 3, 4, 5, 0, 1, 2 };
+    stats = AnalyzeVertexCache(indices.data(), indices.size(), 6, 3);
+    TEST_ASSERT(stats.mACMR == 3.0f);
+    TEST_ASSERT(stats.mATVR == 1.5f);
+}
+
+void TestOptimizeGrid(bool bSplitVertices) {
+    constexpr uint SIZE = 64;
+    auto mesh = MakeGrid(SIZE, bSplitVertices);
+    auto layout = VertexFormat::PositionUV();
+
+    Geometry::RawData data;
+    data.Pack(layout, Geometry::DataSource<>(mesh));
+    auto bounds = data.mBoundingBox;
+
+    auto stats = OptimizeMesh(data);
+    std::cout << (bSplitVertices ? "Split grid" : "Grid")
+        << ": ACMR " << stats.mBefore.mACMR << " -> " << stats.mAfter.mACMR
+        << ", ATVR " << stats.mBefore.mATVR << " -> " << stats.mAfter.mATVR
+        << ", vertices " << stats.mVertexCountBefore
+        << " -> " << stats.mVertexCountAfter << std::endl;
+
+    TEST_ASSERT(stats.mVertexCountBefore == mesh.mPositions.size());
+    TEST_ASSERT(stats.mVertexCountAfter == (SIZE + 1) * (SIZE + 1));
+    TEST_ASSERT(data.mDesc.mAttribs.mNumVertices == stats.mVertexCountAfter);
+
+    // A shuffled grid misses nearly every time, an optimized one
+    // comes close to the 0.5 limit
+    TEST_ASSERT(stats.mBefore.mACMR > 2.0f);
+    TEST_ASSERT(stats.mAfter.mACMR < 0.8f);
+    TEST_ASSERT(stats.mAfter.mATVR < 1.6f);
+
+    TEST_ASSERT(stats.mIndexType == ValueType::UINT16);
+    TEST_ASSERT(data.mDesc.mIndexedAttribs.mIndexType == ValueType::UINT16);
+    TEST_ASSERT(data.mIndexBuffer.mBytes.size() == mesh.mIndices.size() * sizeof(uint16_t));
+    TEST_ASSERT(data.mIndexBuffer.mDesc.mSizeInBytes == data.mIndexBuffer.mBytes.size());
+    TEST_ASSERT(data.mBoundingBox.mLower == bounds.mLower);
+    TEST_ASSERT(data.mBoundingBox.mUpper == bounds.mUpper);
+
+    // Same triangles, same winding
+    auto unpacked = data.Unpack<uint32_t, glm::vec2, glm::vec3, glm::vec4>();
+    TEST_ASSERT(unpacked.mIndices.size() == mesh.mIndices.size());
+    TEST_ASSERT(GetTriangles(unpacked) == GetTriangles(mesh));
+
+    // Vertices are stored in the order they are first used
+    uint32_t next = 0;
+    for (auto index : unpacked.mIndices) {
+        TEST_ASSERT(index <= next);
+        if (index == next) {
+            ++next;
+        }
+    }
+    TEST_ASSERT(next == stats.mVertexCountAfter);
+
+    // The numbers OptimizeMesh reports are the ones of the result
+    auto after = AnalyzeVertexCache(unpacked.mIndices.data(),
+        unpacked.mIndices.size(), stats.mVertexCountAfter);
+    TEST_ASSERT(after.mACMR == stats.mAfter.mACMR);
+}
+
+void TestLargeMeshKeeps32BitIndices() {
+    // 257 x 257 vertices don't fit into 16 bits
+    auto mesh = MakeGrid(256, false);
+
+    Geometry::RawData data;
+    data.Pack(VertexFormat::Position(), Geometry::DataSource<>(mesh));
+    auto stats = OptimizeMesh(data);
+
+    TEST_ASSERT(stats.mIndexType == ValueType::UINT32);
+    TEST_ASSERT(data.mIndexBuffer.mBytes.size() == mesh.mIndices.size() * sizeof(uint32_t));
+    TEST_ASSERT(stats.mAfter.mACMR < stats.mBefore.mACMR);
+
+    auto unpacked = data.Unpack<uint32_t, glm::vec2, glm::vec3, glm::vec4>();
+    TEST_ASSERT(GetTriangles(unpacked) == GetTriangles(mesh));
+}
+
+void TestDisabledPasses() {
+    auto mesh = MakeGrid(16, true);
+
+    Geometry::RawData data;
+    data.Pack(VertexFormat::PositionUV(), Geometry::DataSource<>(mesh));
+    auto original = data.mIndexBuffer.mBytes;
+
+    MeshOptimizeParams params;
+    params.bRemoveDuplicateVertices = false;
+    params.bOptimizeVertexCache = false;
+    params.bOptimizeVertexFetch = false;
+    params.bAllow16BitIndices = false;
+    params.bBuildMeshlets = false;
+    auto stats = OptimizeMesh(data, params);
+
+    TEST_ASSERT(stats.mVertexCountAfter == stats.mVertexCountBefore);
+    TEST_ASSERT(stats.mMeshletCount == 0);
+    TEST_ASSERT(data.mMeshlets.empty());
+    TEST_ASSERT(stats.mAfter.mACMR == stats.mBefore.mACMR);
+    TEST_ASSERT(stats.mIndexType == ValueType::UINT32);
+    TEST_ASSERT(data.mIndexBuffer.mBytes == original);
+}
+
+void TestMeshlets() {
+    auto mesh = MakeGrid(64, true);
+
+    Geometry::RawData data;
+    data.Pack(VertexFormat::PositionUV(), Geometry::DataSource<>(mesh));
+
+    MeshOptimizeParams params;
+    params.mMeshletParams.mMaxVertices = 32;
+    params.mMeshletParams.mMaxTriangles = 40;
+    auto stats = OptimizeMesh(data, params);
+    std::cout << "Meshlets: " << stats.mMeshletCount
+        << ", ACMR " << stats.mAfter.mACMR << std::endl;
+
+    auto unpacked = data.Unpack<uint32_t, glm::vec2, glm::vec3, glm::vec4>();
+    TEST_ASSERT(GetTriangles(unpacked) == GetTriangles(mesh));
+
+    // Meshlets tile the index buffer in order and keep to the limits
+    auto& meshlets = data.mMeshlets;
+    TEST_ASSERT(stats.mMeshletCount == meshlets.size());
+    TEST_ASSERT(meshlets.size() >= mesh.mIndices.size() / 3 / 40);
+
+    uint32_t next = 0;
+    for (auto& meshlet : meshlets) {
+        TEST_ASSERT(meshlet.mFirstIndex == next);
+        TEST_ASSERT(meshlet.mIndexCount > 0);
+        TEST_ASSERT(meshlet.mIndexCount <= 3 * 40);
+        next += meshlet.mIndexCount;
+
+        std::vector<uint32_t> vertices(
+            &unpacked.mIndices[meshlet.mFirstIndex],
+            &unpacked.mIndices[meshlet.mFirstIndex + meshlet.mIndexCount]);
+        std::sort(vertices.begin(), vertices.end());
+        vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+        TEST_ASSERT(meshlet.mVertexCount == vertices.size());
+        TEST_ASSERT(meshlet.mVertexCount <= 32);
+
+        for (auto v : vertices) {
+            auto d = glm::distance(unpacked.mPositions[v], meshlet.mCenter);
+            TEST_ASSERT(d <= meshlet.mRadius * 1.0001f);
+        }
+
+        // The grid is flat and faces +z, so every cone is as narrow
+        // as it gets
+        TEST_ASSERT(meshlet.mConeAxis.z > 0.999f);
+        TEST_ASSERT(meshlet.mConeCutoff < 0.01f);
+    }
+    TEST_ASSERT(next == unpacked.mIndices.size());
+
+    // Survives a round trip through the cooked format
+    std::vector<uint8_t> cooked;
+    data.Save(cooked);
+    auto loaded = Geometry::RawData::Load("grid.okgeo",
+        ByteView(cooked.data(), cooked.size()), VertexFormat::PositionUV());
+    TEST_ASSERT(loaded.mMeshlets.size() == meshlets.size());
+    TEST_ASSERT(loaded.mMeshlets.back().mFirstIndex == meshlets.back().mFirstIndex);
+    TEST_ASSERT(loaded.mMeshlets.back().mCenter == meshlets.back().mCenter);
+}
+
+void TestMeshletCulling() {
+    constexpr uint SIZE = 16;
+    auto mesh = MakeGrid(SIZE, false);
+
+    Geometry::RawData data;
+    data.Pack(VertexFormat::Position(), Geometry::DataSource<>(mesh));
+
+    MeshOptimizeParams params;
+    params.mMeshletParams.mMaxTriangles = 16;
+    OptimizeMesh(data, params);
+    auto unpacked = data.Unpack<uint32_t, glm::vec2, glm::vec3, glm::vec4>();
+    auto& meshlets = data.mMeshlets;
+
+    // An orthographic view of x in [0, 8], all of y and z in [-10, 10]
+    glm::mat4 viewProj(1.0f);
+    viewProj[0][0] = 2.0f / 8.0f;
+    viewProj[3][0] = -1.0f;
+    viewProj[1][1] = 2.0f / SIZE;
+    viewProj[3][1] = -1.0f;
+    viewProj[2][2] = 0.1f;
+    glm::mat4 world(1.0f);
+
+    // Looking down at the front of the grid
+    auto view = MeshletCullView::From(world, viewProj,
+        glm::vec3(4.0f, 8.0f, 10.0f), glm::vec3(0.0f, 0.0f, -1.0f), true);
+    std::vector<IndexRange> ranges;
+    auto visible = CullMeshlets(meshlets, view, ranges);
+    std::cout << "Visible meshlets: " << visible << " of " << meshlets.size()
+        << " in " << ranges.size() << " ranges" << std::endl;
+    TEST_ASSERT(visible < meshlets.size());
+
+    // Culling is conservative, anything with a vertex inside survives
+    size_t expected = 0;
+    uint32_t visibleIndices = 0;
+    for (auto& meshlet : meshlets) {
+        bool bInside = false;
+        for (uint32_t i = 0; i < meshlet.mIndexCount; ++i) {
+            bInside |= unpacked.mPositions[
+                unpacked.mIndices[meshlet.mFirstIndex + i]].x < 7.5f;
+        }
+        bool bVisible = IsMeshletVisible(meshlet, view);
+        TEST_ASSERT(!bInside || bVisible);
+        if (bVisible) {
+            ++expected;
+            visibleIndices += meshlet.mIndexCount;
+        }
+    }
+    TEST_ASSERT(visible == expected);
+
+    uint32_t rangeIndices = 0;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        rangeIndices += ranges[i].mIndexCount;
+        // Neighbouring ranges would have been merged
+        if (i > 0) {
+            TEST_ASSERT(ranges[i - 1].mFirstIndex + ranges[i - 1].mIndexCount <
+                ranges[i].mFirstIndex);
+        }
+    }
+    TEST_ASSERT(rangeIndices == visibleIndices);
+
+    // From below only the backs can be seen, in both kinds of views
+    view = MeshletCullView::From(world, viewProj,
+        glm::vec3(4.0f, 8.0f, -10.0f), glm::vec3(0.0f, 0.0f, 1.0f), true);
+    ranges.clear();
+    TEST_ASSERT(CullMeshlets(meshlets, view, ranges) == 0);
+    TEST_ASSERT(ranges.empty());
+
+    view = MeshletCullView::From(world, viewProj,
+        glm::vec3(4.0f, 8.0f, -10.0f), glm::vec3(0.0f, 0.0f, 1.0f), false);
+    TEST_ASSERT(CullMeshlets(meshlets, view, ranges) == 0);
+
+    view = MeshletCullView::From(world, viewProj,
+        glm::vec3(4.0f, 8.0f, 10.0f), glm::vec3(0.0f, 0.0f, -1.0f), false);
+    TEST_ASSERT(CullMeshlets(meshlets, view, ranges) == visible);
+
+    // A mirrored mesh flips its winding, cones can't be trusted
+    world[2][2] = -1.0f;
+    view = MeshletCullView::From(world, viewProj,
+        glm::vec3(4.0f, 8.0f, -10.0f), glm::vec3(0.0f, 0.0f, 1.0f), true);
+    TEST_ASSERT(!view.bCullBackfaces);
+    TEST_ASSERT(CullMeshlets(meshlets, view, ranges) == visible);
+}
+
+float GetArea(const Geometry::Data<>& data, size_t first, size_t count,
+    bool* bFlipped) {
+    float area = 0.0f;
+    for (size_t i = first; i < first + count; i += 3) {
+        auto& p0 = data.mPositions[data.mIndices[i]];
+        auto n = glm::cross(data.mPositions[data.mIndices[i + 1]] - p0,
+            data.mPositions[data.mIndices[i + 2]] - p0);
+        area += 0.5f * glm::length(n);
+        *bFlipped |= n.z <= 0.0f;
+    }
+    return area;
+}
+
+void TestLodChain(bool bCurved) {
+    constexpr uint SIZE = 32;
+    auto mesh = MakeGrid(SIZE, true);
+    if (bCurved) {
+        for (auto& p : mesh.mPositions) {
+            p.z = 2.0f * std::sin(p.x * 0.2f) * std::cos(p.y * 0.2f);
+        }
+    }
+
+    Geometry::RawData data;
+    data.Pack(VertexFormat::PositionUV(), Geometry::DataSource<>(mesh));
+
+    MeshOptimizeParams params;
+    params.bBuildLodChain = true;
+    auto stats = OptimizeMesh(data, params);
+    auto unpacked = data.Unpack<uint32_t, glm::vec2, glm::vec3, glm::vec4>();
+    TEST_ASSERT(GetTriangles(unpacked) == GetTriangles(mesh));
+
+    auto& lods = data.mLods;
+    TEST_ASSERT(stats.mLodCount == lods.size());
+    TEST_ASSERT(lods.size() == params.mLodChainParams.mLevelCount);
+
+    // The levels follow the full detail indices
+    std::vector<uint32_t> indices(data.mIndexBuffer.mBytes.size() / sizeof(uint16_t));
+    for (size_t i = 0; i < indices.size(); ++i) {
+        uint16_t index;
+        std::memcpy(&index, &data.mIndexBuffer.mBytes[i * sizeof(uint16_t)], sizeof(index));
+        indices[i] = index;
+    }
+    size_t next = unpacked.mIndices.size();
+    unpacked.mIndices = indices;
+
+    // Bounds of the grid, the bump is at most 4 high
+    float maxError = params.mLodChainParams.mMaxError * 0.5f *
+        glm::length(glm::vec3(SIZE, SIZE, bCurved ? 4.0f : 0.0f));
+    float error = 0.0f;
+    uint32_t count = data.mDesc.mIndexedAttribs.mNumIndices;
+
+    for (auto& lod : lods) {
+        std::cout << (bCurved ? "Curved" : "Flat") << " level: "
+            << lod.mIndexCount / 3 << " triangles, error " << lod.mError << std::endl;
+
+        TEST_ASSERT(lod.mFirstIndex == next);
+        TEST_ASSERT(lod.mIndexCount % 3 == 0);
+        TEST_ASSERT(lod.mIndexCount < count);
+        TEST_ASSERT(lod.mError >= error);
+        TEST_ASSERT(lod.mError <= maxError);
+        next += lod.mIndexCount;
+        count = lod.mIndexCount;
+        error = lod.mError;
+
+        for (uint32_t i = 0; i < lod.mIndexCount; ++i) {
+            TEST_ASSERT(indices[lod.mFirstIndex + i] < stats.mVertexCountAfter);
+        }
+
+        bool bFlipped = false;
+        float area = GetArea(unpacked, lod.mFirstIndex, lod.mIndexCount, &bFlipped);
+        TEST_ASSERT(!bFlipped);
+        if (!bCurved) {
+            // Flat meshes simplify without error, and the borders are
+            // left alone
+            TEST_ASSERT(lod.mError == 0.0f);
+            TEST_ASSERT(std::abs(area - SIZE * SIZE) < 0.01f);
+        }
+    }
+    TEST_ASSERT(next == indices.size());
+    TEST_ASSERT(lods.back().mIndexCount * 4 < mesh.mIndices.size());
+}
+
+void TestLodSelection() {
+    std::vector<MeshLod> lods(3);
+    lods[0].mError = 0.01f;
+    lods[1].mError = 0.04f;
+    lods[2].mError = 0.16f;
+
+    // Up close only the full detail mesh will do
+    TEST_ASSERT(SelectLod(lods, 1000.0f, 0) == 0);
+    TEST_ASSERT(SelectLod(lods, 1000.0f, 3) == 0);
+    // Far away the coarsest level
+    TEST_ASSERT(SelectLod(lods, 2.0f, 0) == 3);
+    TEST_ASSERT(SelectLod(lods, 10.0f, 0) == 2);
+
+    // Level 2 shows 0.9 pixels of error, which is enough to stay on
+    // it, but not to switch to it
+    TEST_ASSERT(SelectLod(lods, 22.5f, 1) == 1);
+    TEST_ASSERT(SelectLod(lods, 22.5f, 2) == 2);
+    TEST_ASSERT(SelectLod(lods, 22.5f, 3) == 2);
+    TEST_ASSERT(SelectLod(lods, 26.0f, 2) == 1);
+
+    LodSelector selector;
+    auto entity = entt::entity(1);
+    TEST_ASSERT(selector.Select(0, entity, lods, 22.5f) == 1);
+    TEST_ASSERT(selector.Select(0, entity, lods, 10.0f) == 2);
+    TEST_ASSERT(selector.Select(0, entity, lods, 22.5f) == 2);
+    TEST_ASSERT(selector.GetLevel(0, entity) == 2);
+
+    // Another view of the same mesh keeps its own level
+    TEST_ASSERT(selector.Select(1, entity, lods, 1000.0f) == 0);
+    TEST_ASSERT(selector.Select(1, entity, lods, 22.5f) == 1);
+    TEST_ASSERT(selector.Select(0, entity, lods, 22.5f) == 2);
+    TEST_ASSERT(selector.GetLevel(1, entity) == 1);
+
+    for (uint32_t i = 0; i <= LodSelectionParams().mUnusedUpdates; ++i) {
+        selector.Update();
+    }
+    TEST_ASSERT(selector.GetLevel(0, entity) == 0);
+    TEST_ASSERT(selector.GetLevel(1, entity) == 0);
+
+    // Pixels per unit fall off with distance
+    Camera camera;
+    Transform transform;
+    BoundingBox bounds;
+    bounds.mLower = glm::vec3(-1.0f, -1.0f, -1.0f);
+    bounds.mUpper = glm::vec3(1.0f, 1.0f, 1.0f);
+    auto closeUp = EstimatePixelsPerUnit(camera, glm::vec3(0.0f, 0.0f, -10.0f),
+        1080.0f, transform, bounds);
+    auto distant = EstimatePixelsPerUnit(camera, glm::vec3(0.0f, 0.0f, -100.0f),
+        1080.0f, transform, bounds);
+    TEST_ASSERT(closeUp > distant);
+    TEST_ASSERT(SelectLod(lods, distant, 0) >= SelectLod(lods, closeUp, 0));
+}
+
+int main() {
+    TestAnalyze();
+    TestOptimizeGrid(false);
+    TestOptimizeGrid(true);
+    TestLargeMeshKeeps32BitIndices();
+    TestDisabledPasses();
+    TestMeshlets();
+    TestMeshletCulling();
+    TestLodChain(false);
+    TestLodChain(true);
+    TestLodSelection();
+    std::cout << "Mesh optimize tests passed" << std::endl;
+    return 0;
+}
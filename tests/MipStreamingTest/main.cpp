@@ -0,0 +1,175 @@
+#include <okami/TextureStreaming.hpp>
+
+#include <iostream>
+#include <unordered_map>
+
+using namespace okami;
+using namespace okami::core;
+
+#define TEST_ASSERT(x) \
+    if (!(x)) { \
+        std::cerr << \
+            "LINE " << __LINE__  << ": Test Failed: " << #x << std::endl; \
+        throw std::runtime_error("Test Failed!"); \
+    }
+
+// Pretends to be the GPU, keeping track of what is resident.
+class FakeResidencyBackend : public ITextureResidencyBackend {
+public:
+    std::unordered_map<resource_id_t, MipChain> mChains;
+    std::unordered_map<resource_id_t, uint32_t> mResident;
+    uint mUploads = 0;
+    uint mEvictions = 0;
+
+    void Upload(resource_id_t id, const MipChain& chain, uint32_t mip) {
+        mChains[id] = chain;
+        mResident[id] = mip;
+    }
+
+    void SetResidentMip(resource_id_t id, uint32_t mip) override {
+        if (mip < mResident[id]) {
+            ++mUploads;
+        } else {
+            ++mEvictions;
+        }
+        mResident[id] = mip;
+    }
+
+    uint64_t GetResidentBytes() const {
+        uint64_t result = 0;
+        for (auto& [id, mip] : mResident) {
+            result += mChains.at(id).GetByteSize(mip);
+        }
+        return result;
+    }
+};
+
+MipChain MakeChain(uint32_t size) {
+    MipChain chain;
+    chain.mWidth = size;
+    chain.mHeight = size;
+    chain.mMipCount = 1;
+    while ((size >> chain.mMipCount) > 0) {
+        ++chain.mMipCount;
+    }
+    chain.mPixelByteSize = 4;
+    return chain;
+}
+
+void TestMipChain() {
+    auto chain = MakeChain(1024);
+    TEST_ASSERT(chain.mMipCount == 11);
+    TEST_ASSERT(chain.GetMipByteSize(0) == 1024 * 1024 * 4);
+    TEST_ASSERT(chain.GetByteSize(10) == 4);
+    TEST_ASSERT(chain.GetTailMip(64) == 4);
+    TEST_ASSERT(chain.GetDesiredMip(2048.0f) == 0);
+    TEST_ASSERT(chain.GetDesiredMip(256.0f) == 2);
+    TEST_ASSERT(chain.GetDesiredMip(0.0f) == 10);
+}
+
+void TestStreamIn() {
+    FakeResidencyBackend gpu;
+    MipStreamingParams params;
+    params.mMaxUploadsPerUpdate = 1;
+    MipStreamer streamer(&gpu, params);
+
+    auto chain = MakeChain(1024);
+    auto initial = streamer.Add(0, chain);
+    gpu.Upload(0, chain, initial);
+
+    // Only the tail goes up front
+    TEST_ASSERT(initial == 4);
+    TEST_ASSERT(streamer.GetResidentBytes() == gpu.GetResidentBytes());
+
+    // Nobody looks at it, nothing changes
+    streamer.Update();
+    TEST_ASSERT(gpu.mUploads == 0);
+
+    // Fills the screen, mips come in one level per update
+    for (uint i = 0; i < 4; ++i) {
+        streamer.RequestScreenSize(0, 1024.0f);
+        streamer.Update();
+        TEST_ASSERT(gpu.mResident[0] == 3 - i);
+    }
+    TEST_ASSERT(gpu.mUploads == 4);
+    TEST_ASSERT(streamer.GetResidentBytes() == gpu.GetResidentBytes());
+
+    // Shrinks on screen, fine mips are dropped right away
+    streamer.RequestScreenSize(0, 128.0f);
+    streamer.Update();
+    TEST_ASSERT(gpu.mResident[0] == 3);
+    TEST_ASSERT(streamer.GetResidentBytes() == gpu.GetResidentBytes());
+
+    streamer.Remove(0);
+    TEST_ASSERT(streamer.GetResidentBytes() == 0);
+}
+
+void TestBudget() {
+    FakeResidencyBackend gpu;
+    MipStreamingParams params;
+    params.mMaxUploadsPerUpdate = 16;
+    MipStreamer streamer(&gpu, params);
+
+    auto chain = MakeChain(1024);
+    for (resource_id_t id = 0; id < 4; ++id) {
+        gpu.Upload(id, chain, streamer.Add(id, chain));
+    }
+
+    // Room for roughly two full textures
+    streamer.SetBudget(chain.GetByteSize(0) * 2 + chain.GetByteSize(4) * 2);
+
+    for (uint frame = 0; frame < 16; ++frame) {
+        for (resource_id_t id = 0; id < 4; ++id) {
+            streamer.RequestScreenSize(id, 1024.0f);
+        }
+        streamer.Update();
+        TEST_ASSERT(gpu.GetResidentBytes() <= streamer.GetBudget());
+    }
+
+    // Every texture got something, and whatever is still missing
+    // would not have fit.
+    auto spare = streamer.GetBudget() - gpu.GetResidentBytes();
+    for (resource_id_t id = 0; id < 4; ++id) {
+        auto mip = gpu.mResident[id];
+        TEST_ASSERT(mip < 4);
+        if (mip > 0) {
+            TEST_ASSERT(chain.GetMipByteSize(mip - 1) > spare);
+        }
+    }
+
+    // Only textures 2 and 3 stay in view, the others lose fine mips
+    // once the budget shrinks.
+    streamer.SetBudget(chain.GetByteSize(1) * 2 + chain.GetByteSize(4) * 2);
+    for (uint frame = 0; frame < 16; ++frame) {
+        streamer.RequestScreenSize(2, 1024.0f);
+        streamer.RequestScreenSize(3, 1024.0f);
+        streamer.Update();
+    }
+    TEST_ASSERT(gpu.GetResidentBytes() <= streamer.GetBudget());
+    TEST_ASSERT(streamer.GetResidentBytes() == gpu.GetResidentBytes());
+    TEST_ASSERT(gpu.mEvictions > 0);
+
+    // Unused textures fall back to their tail eventually
+    MipStreamingParams unusedParams;
+    unusedParams.mUnusedUpdates = 2;
+    FakeResidencyBackend gpu2;
+    MipStreamer streamer2(&gpu2, unusedParams);
+    gpu2.Upload(0, chain, streamer2.Add(0, chain));
+    for (uint frame = 0; frame < 8; ++frame) {
+        streamer2.RequestScreenSize(0, 1024.0f);
+        streamer2.Update();
+    }
+    TEST_ASSERT(gpu2.mResident[0] == 0);
+    for (uint frame = 0; frame < 4; ++frame) {
+        streamer2.Update();
+    }
+    TEST_ASSERT(gpu2.mResident[0] == 4);
+}
+
+int main() {
+    TestMipChain();
+    TestStreamIn();
+    TestBudget();
+    std::cout << "Mip streaming tests passed" << std::endl;
+    return 0;
+}
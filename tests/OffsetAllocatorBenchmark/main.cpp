@@ -0,0 +1,211 @@
+#include <okami/OffsetAllocator.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <random>
+
+using namespace okami;
+using namespace okami::core;
+
+#define TEST_ASSERT(x) \
+    if (!(x)) { \
+        std::cerr << \
+            "LINE " << __LINE__  << ": Test Failed: " << #x << std::endl; \
+        throw std::runtime_error("Test Failed!"); \
+    }
+
+// Vertices of a mega buffer, enough for a large scene
+constexpr uint32_t ARENA_SIZE = 1u << 26;
+constexpr uint32_t OPERATION_COUNT = 1u << 20;
+// First fit walks the free list, it only gets a fraction of the churn
+constexpr uint32_t FIRST_FIT_OPERATION_COUNT = OPERATION_COUNT / 32;
+// Allocations that are live at once during the churn
+constexpr size_t LIVE_TARGET = 16384;
+
+// Sizes of a few hundred to a few ten thousand vertices, the way meshes
+// of a scene spread out. Drawn up front so that the random number
+// generator isn't timed.
+std::vector<uint32_t> MakeSizes(size_t count) {
+    std::mt19937 rng(17);
+    std::lognormal_distribution<float> dist(7.0f, 1.0f);
+
+    std::vector<uint32_t> sizes(count);
+    for (auto& size : sizes) {
+        size = std::max(1u, std::min(1u << 16, (uint32_t)dist(rng)));
+    }
+    return sizes;
+}
+
+// First fit over an ordered map of free ranges, the obvious way to
+// write a sub-allocator
+class FirstFitAllocator {
+private:
+    std::map<uint32_t, uint32_t> mFree;
+
+public:
+    FirstFitAllocator(uint32_t size) {
+        mFree[0] = size;
+    }
+
+    uint32_t Allocate(uint32_t size) {
+        for (auto it = mFree.begin(); it != mFree.end(); ++it) {
+            if (it->second >= size) {
+                uint32_t offset = it->first;
+                uint32_t rest = it->second - size;
+                mFree.erase(it);
+                if (rest > 0) {
+                    mFree[offset + size] = rest;
+                }
+                return offset;
+            }
+        }
+        return OffsetAllocation::NO_SPACE;
+    }
+
+    void Free(uint32_t offset, uint32_t size) {
+        auto it = mFree.emplace(offset, size).first;
+
+        auto next = std::next(it);
+        if (next != mFree.end() && it->first + it->second == next->first) {
+            it->second += next->second;
+            mFree.erase(next);
+        }
+        if (it != mFree.begin()) {
+            auto prev = std::prev(it);
+            if (prev->first + prev->second == it->first) {
+                prev->second += it->second;
+                mFree.erase(it);
+            }
+        }
+    }
+};
+
+template <typename FuncT>
+double TimeSeconds(FuncT&& func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+void Report(const char* name, uint32_t operations, double seconds) {
+    std::cout << name << ": "
+        << seconds * 1000.0 << " ms, "
+        << seconds * 1e9 / operations << " ns per operation" << std::endl;
+}
+
+// Fills up to the live target, then frees a random allocation for every
+// new one, like a streaming scene
+template <typename AllocateT, typename FreeT>
+uint32_t Churn(const std::vector<uint32_t>& sizes,
+    uint32_t operationCount,
+    AllocateT&& allocate,
+    FreeT&& free) {
+    struct Live {
+        uint32_t mSize;
+        OffsetAllocation mAllocation;
+    };
+
+    std::mt19937 rng(23);
+    std::vector<Live> live;
+    live.reserve(LIVE_TARGET);
+
+    uint32_t failures = 0;
+    for (uint32_t i = 0; i < operationCount; ++i) {
+        if (live.size() >= LIVE_TARGET) {
+            auto index = rng() % live.size();
+            free(live[index].mAllocation, live[index].mSize);
+            live[index] = live.back();
+            live.pop_back();
+        }
+
+        auto size = sizes[i];
+        auto allocation = allocate(size);
+        if (allocation.IsValid()) {
+            live.emplace_back(Live{ size, allocation });
+        } else {
+            ++failures;
+        }
+    }
+
+    for (auto& entry : live) {
+        free(entry.mAllocation, entry.mSize);
+    }
+    return failures;
+}
+
+void BenchmarkOffsetAllocator(const std::vector<uint32_t>& sizes) {
+    OffsetAllocator allocator(ARENA_SIZE, 2 * LIVE_TARGET + 1024);
+
+    uint32_t failures = 0;
+    auto seconds = TimeSeconds([&]() {
+        failures = Churn(sizes, OPERATION_COUNT,
+            [&](uint32_t size) {
+                return allocator.Allocate(size);
+            },
+            [&](const OffsetAllocation& allocation, uint32_t) {
+                allocator.Free(allocation);
+            });
+    });
+
+    Report("Offset allocator", 2 * OPERATION_COUNT, seconds);
+    std::cout << "Failed allocations: " << failures << std::endl;
+
+    // Everything was freed, it all has to have merged back together
+    TEST_ASSERT(allocator.GetReport().mLargestFree == ARENA_SIZE);
+}
+
+void BenchmarkFirstFit(const std::vector<uint32_t>& sizes) {
+    FirstFitAllocator allocator(ARENA_SIZE);
+
+    uint32_t failures = 0;
+    auto seconds = TimeSeconds([&]() {
+        failures = Churn(sizes, FIRST_FIT_OPERATION_COUNT,
+            [&](uint32_t size) {
+                OffsetAllocation allocation;
+                allocation.mOffset = allocator.Allocate(size);
+                allocation.mNode = allocation.mOffset;
+                return allocation;
+            },
+            [&](const OffsetAllocation& allocation, uint32_t size) {
+                allocator.Free(allocation.mOffset, size);
+            });
+    });
+
+    Report("First fit map", 2 * FIRST_FIT_OPERATION_COUNT, seconds);
+    std::cout << "Failed allocations: " << failures << std::endl;
+}
+
+// A fragmented arena, compacted
+void BenchmarkDefragment(const std::vector<uint32_t>& sizes) {
+    OffsetAllocator allocator(ARENA_SIZE, 2 * LIVE_TARGET + 1024);
+
+    std::vector<OffsetAllocation> allocations;
+    for (size_t i = 0; i < LIVE_TARGET; ++i) {
+        allocations.emplace_back(allocator.Allocate(sizes[i]));
+    }
+    for (size_t i = 0; i < allocations.size(); i += 2) {
+        allocator.Free(allocations[i]);
+    }
+
+    auto before = allocator.GetFragmentation();
+    std::vector<OffsetAllocatorMove> moves;
+    auto seconds = TimeSeconds([&]() {
+        moves = allocator.Defragment();
+    });
+
+    std::cout << "Defragment: " << seconds * 1000.0 << " ms, "
+        << moves.size() << " moves, fragmentation "
+        << before << " -> " << allocator.GetFragmentation() << std::endl;
+    TEST_ASSERT(allocator.GetFragmentation() == 0.0f);
+}
+
+int main() {
+    auto sizes = MakeSizes(OPERATION_COUNT);
+    BenchmarkOffsetAllocator(sizes);
+    BenchmarkFirstFit(sizes);
+    BenchmarkDefragment(sizes);
+    return 0;
+}
@@ -0,0 +1,257 @@
+#include <okami/OffsetAllocator.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+
+using namespace okami;
+using namespace okami::core;
+
+#define TEST_ASSERT(x) \
+    if (!(x)) { \
+        std::cerr << \
+            "LINE " << __LINE__  << ": Test Failed: " << #x << std::endl; \
+        throw std::runtime_error("Test Failed!"); \
+    }
+
+void TestSmallFloat() {
+    for (uint32_t i = 0; i < (1u << 20); ++i) {
+        auto up = small_float::UintToFloatRoundUp(i);
+        auto down = small_float::UintToFloatRoundDown(i);
+        TEST_ASSERT(small_float::FloatToUint(up) >= i);
+        TEST_ASSERT(small_float::FloatToUint(down) <= i);
+        TEST_ASSERT(up - down <= 1);
+    }
+
+    // Small values and powers of two are exact
+    for (uint32_t i = 0; i < 8; ++i) {
+        TEST_ASSERT(small_float::FloatToUint(small_float::UintToFloatRoundUp(i)) == i);
+    }
+    for (uint32_t i = 3; i < 32; ++i) {
+        uint32_t value = 1u << i;
+        TEST_ASSERT(small_float::FloatToUint(small_float::UintToFloatRoundUp(value)) == value);
+        TEST_ASSERT(small_float::FloatToUint(small_float::UintToFloatRoundDown(value)) == value);
+    }
+
+    // The largest sizes still land in a bin
+    TEST_ASSERT(small_float::UintToFloatRoundUp(0xFFFFFFFF) < 256);
+}
+
+void TestBasic() {
+    OffsetAllocator allocator(1000);
+
+    auto a = allocator.Allocate(100);
+    auto b = allocator.Allocate(200);
+    TEST_ASSERT(a.IsValid() && b.IsValid());
+    TEST_ASSERT(a.mOffset == 0);
+    TEST_ASSERT(b.mOffset == 100);
+    TEST_ASSERT(allocator.GetAllocationSize(b) == 200);
+    TEST_ASSERT(allocator.GetReport().mTotalFree == 700);
+    TEST_ASSERT(allocator.GetReport().mAllocationCount == 2);
+
+    // The hole a leaves fits better than the rest at the end
+    allocator.Free(a);
+    auto c = allocator.Allocate(50);
+    TEST_ASSERT(c.mOffset == 0);
+
+    TEST_ASSERT(!allocator.Allocate(1001).IsValid());
+    TEST_ASSERT(!allocator.Allocate(0).IsValid());
+
+    // Freeing twice is caught, as long as the node isn't reused
+    allocator.Free(b);
+    bool bThrown = false;
+    try {
+        allocator.Free(b);
+    } catch (std::runtime_error&) {
+        bThrown = true;
+    }
+    TEST_ASSERT(bThrown);
+
+    // Free ignores invalid allocations
+    allocator.Free(OffsetAllocation());
+}
+
+// Sizes are rounded to bins, only sizes the bins can represent
+// exactly are sure to fill the last free range that is left
+void TestMerge() {
+    OffsetAllocator allocator(1280);
+
+    std::vector<OffsetAllocation> allocations;
+    for (int i = 0; i < 10; ++i) {
+        allocations.emplace_back(allocator.Allocate(128));
+        TEST_ASSERT(allocations.back().mOffset == 128u * i);
+    }
+    TEST_ASSERT(!allocator.Allocate(1).IsValid());
+
+    std::mt19937 rng(3);
+    std::shuffle(allocations.begin(), allocations.end(), rng);
+    for (auto& allocation : allocations) {
+        allocator.Free(allocation);
+    }
+
+    // Back to a single range
+    auto report = allocator.GetReport();
+    TEST_ASSERT(report.mTotalFree == 1280);
+    TEST_ASSERT(report.mLargestFree == 1280);
+    TEST_ASSERT(report.mAllocationCount == 0);
+    TEST_ASSERT(allocator.GetFragmentation() == 0.0f);
+
+    auto all = allocator.Allocate(1280);
+    TEST_ASSERT(all.IsValid() && all.mOffset == 0);
+}
+
+// Random allocations and frees, checked against a map of the ranges
+// that are handed out
+void TestRandom() {
+    constexpr uint32_t SIZE = 1u << 20;
+    OffsetAllocator allocator(SIZE);
+
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<uint32_t> sizeDist(1, 4096);
+
+    std::map<uint32_t, uint32_t> ranges;
+    std::vector<OffsetAllocation> live;
+    uint64_t allocated = 0;
+
+    for (int i = 0; i < 100000; ++i) {
+        if (live.empty() || rng() % 3 != 0) {
+            auto size = sizeDist(rng);
+            auto allocation = allocator.Allocate(size);
+            if (!allocation.IsValid()) {
+                continue;
+            }
+
+            TEST_ASSERT(allocation.mOffset + size <= SIZE);
+            auto next = ranges.lower_bound(allocation.mOffset);
+            if (next != ranges.end()) {
+                TEST_ASSERT(allocation.mOffset + size <= next->first);
+            }
+            if (next != ranges.begin()) {
+                auto prev = std::prev(next);
+                TEST_ASSERT(prev->first + prev->second <= allocation.mOffset);
+            }
+
+            ranges[allocation.mOffset] = size;
+            live.emplace_back(allocation);
+            allocated += size;
+        } else {
+            auto index = rng() % live.size();
+            auto allocation = live[index];
+            live[index] = live.back();
+            live.pop_back();
+
+            allocated -= ranges[allocation.mOffset];
+            ranges.erase(allocation.mOffset);
+            allocator.Free(allocation);
+        }
+
+        TEST_ASSERT(allocator.GetReport().mTotalFree + allocated == SIZE);
+    }
+
+    for (auto& allocation : live) {
+        allocator.Free(allocation);
+    }
+    TEST_ASSERT(allocator.GetReport().mLargestFree == SIZE);
+}
+
+void TestGrow() {
+    OffsetAllocator allocator(128);
+
+    auto a = allocator.Allocate(128);
+    TEST_ASSERT(a.IsValid());
+    TEST_ASSERT(!allocator.Allocate(1).IsValid());
+
+    allocator.Grow(256);
+    TEST_ASSERT(allocator.GetSize() == 256);
+    auto b = allocator.Allocate(128);
+    TEST_ASSERT(b.IsValid() && b.mOffset == 128);
+
+    // Free space at the end is extended rather than split
+    allocator.Free(b);
+    allocator.Grow(384);
+    auto c = allocator.Allocate(256);
+    TEST_ASSERT(c.IsValid() && c.mOffset == 128);
+
+    // Growing an empty allocator
+    OffsetAllocator empty;
+    TEST_ASSERT(!empty.Allocate(1).IsValid());
+    empty.Grow(16);
+    TEST_ASSERT(empty.Allocate(16).mOffset == 0);
+}
+
+void TestDefragment() {
+    OffsetAllocator allocator(640);
+
+    std::vector<OffsetAllocation> allocations;
+    for (int i = 0; i < 10; ++i) {
+        allocations.emplace_back(allocator.Allocate(64));
+    }
+
+    std::vector<OffsetAllocation> kept;
+    for (int i = 0; i < 10; ++i) {
+        if (i % 2) {
+            allocator.Free(allocations[i]);
+        } else {
+            kept.emplace_back(allocations[i]);
+        }
+    }
+
+    // Half is free, but only in pieces
+    TEST_ASSERT(allocator.GetReport().mTotalFree == 320);
+    TEST_ASSERT(allocator.GetFragmentation() > 0.5f);
+    TEST_ASSERT(!allocator.Allocate(128).IsValid());
+
+    auto moves = allocator.Defragment();
+    TEST_ASSERT(moves.size() == 4);
+    for (size_t i = 0; i < moves.size(); ++i) {
+        TEST_ASSERT(moves[i].mNode == kept[i + 1].mNode);
+        TEST_ASSERT(moves[i].mFrom == kept[i + 1].mOffset);
+        TEST_ASSERT(moves[i].mTo == 64 * (i + 1));
+        TEST_ASSERT(moves[i].mSize == 64);
+        TEST_ASSERT(i == 0 || moves[i].mFrom > moves[i - 1].mFrom);
+    }
+
+    // Allocations keep working through their nodes
+    for (size_t i = 0; i < kept.size(); ++i) {
+        TEST_ASSERT(allocator.GetOffset(kept[i]) == 64 * i);
+        TEST_ASSERT(allocator.GetAllocationSize(kept[i]) == 64);
+    }
+    TEST_ASSERT(allocator.GetFragmentation() == 0.0f);
+    TEST_ASSERT(allocator.GetReport().mAllocationCount == 5);
+
+    auto large = allocator.Allocate(320);
+    TEST_ASSERT(large.IsValid() && large.mOffset == 320);
+
+    for (auto& allocation : kept) {
+        allocator.Free(allocation);
+    }
+    allocator.Free(large);
+    TEST_ASSERT(allocator.GetReport().mLargestFree == 640);
+
+    // Nothing to move
+    TEST_ASSERT(allocator.Defragment().empty());
+}
+
+void TestNodeLimit() {
+    OffsetAllocator allocator(1000, 4);
+
+    uint32_t count = 0;
+    while (allocator.Allocate(10).IsValid()) {
+        ++count;
+    }
+    TEST_ASSERT(count > 0 && count <= 4);
+}
+
+int main() {
+    TestSmallFloat();
+    TestBasic();
+    TestMerge();
+    TestRandom();
+    TestGrow();
+    TestDefragment();
+    TestNodeLimit();
+    std::cout << "Offset allocator tests passed" << std::endl;
+    return 0;
+}
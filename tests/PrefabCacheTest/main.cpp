@@ -0,0 +1,210 @@
+#include <okami/Geometry.hpp>
+#include <okami/EmbeddedMesh.hpp>
+#include <okami/ByteBuffer.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+using namespace okami;
+using namespace okami::core;
+
+#define TEST_ASSERT(x) \
+    if (!(x)) { \
+        std::cerr << \
+            "LINE " << __LINE__  << ": Test Failed: " << #x << std::endl; \
+        throw std::runtime_error("Test Failed!"); \
+    }
+
+constexpr size_t SPAWN_COUNT = 10000;
+
+bool SameBuffers(const Geometry& a, const Geometry& b) {
+    const auto& dataA = a.DataCPU();
+    const auto& dataB = b.DataCPU();
+
+    if (dataA.mVertexBuffers.size() != dataB.mVertexBuffers.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < dataA.mVertexBuffers.size(); ++i) {
+        if (dataA.mVertexBuffers[i].mBytes != dataB.mVertexBuffers[i].mBytes) {
+            return false;
+        }
+    }
+    return dataA.mIndexBuffer.mBytes == dataB.mIndexBuffer.mBytes;
+}
+
+template <typename FuncT>
+bool Throws(FuncT&& func) {
+    try {
+        func();
+    } catch (std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+void TestEmbeddedMesh() {
+    float positions[] = { 0, 0, 0, 1, 0, 0, 0, 1, 0 };
+    float uvs[] = { 0, 0, 1, 0, 0, 1 };
+    float normals[] = { 0, 0, 1, 0, 0, 1, 0, 0, 1 };
+    float tangents[] = { 1, 0, 0, 1, 0, 0, 1, 0, 0 };
+    float bitangents[] = { 0, 1, 0, 0, 1, 0, 0, 1, 0 };
+    uint32_t indices[] = { 0, 1, 2 };
+
+    EmbeddedMesh mesh;
+    mesh.mHeader.mVertexCount = 3;
+    mesh.mHeader.mIndexCount = 3;
+    mesh.mPositions = positions;
+    mesh.mUVs = uvs;
+    mesh.mNormals = normals;
+    mesh.mTangents = tangents;
+    mesh.mBitangents = bitangents;
+    mesh.mIndices = indices;
+
+    std::ostringstream stream;
+    mesh.Write(stream);
+    auto str = stream.str();
+
+    // Aligned, like the blobs linked into the binary
+    ByteBuffer blob(reinterpret_cast<const uint8_t*>(str.data()), str.size());
+    auto read = EmbeddedMesh::From(blob.begin(), blob.end());
+    TEST_ASSERT(read.mHeader.mVertexCount == 3);
+    TEST_ASSERT(read.mHeader.mIndexCount == 3);
+    TEST_ASSERT(read.mPositions[3] == 1.0f);
+    TEST_ASSERT(read.mUVs[5] == 1.0f);
+    TEST_ASSERT(read.mNormals[2] == 1.0f);
+    TEST_ASSERT(read.mTangents[0] == 1.0f);
+    TEST_ASSERT(read.mBitangents[1] == 1.0f);
+    TEST_ASSERT(read.mIndices[2] == 2);
+
+    TEST_ASSERT(Throws([&]() {
+        EmbeddedMesh::From(blob.begin(), blob.end() - 1);
+    }));
+
+    blob[0] = 0;
+    TEST_ASSERT(Throws([&]() {
+        EmbeddedMesh::From(blob.begin(), blob.end());
+    }));
+}
+
+void TestPrefabCache() {
+    auto layout = VertexFormat::PositionUVNormal();
+    auto tangentLayout = VertexFormat::PositionUVNormalTangent();
+
+    auto first = Geometry::Prefabs::Box(layout);
+    auto second = Geometry::Prefabs::Box(layout);
+    TEST_ASSERT(first.GetDesc().mAttribs.mNumVertices == 24);
+    TEST_ASSERT(first.GetDesc().mIndexedAttribs.mNumIndices == 36);
+    TEST_ASSERT(SameBuffers(first, second));
+
+    // Another format is packed on its own
+    auto tangents = Geometry::Prefabs::Box(tangentLayout);
+    TEST_ASSERT(tangents.DataCPU().mVertexBuffers[0].mBytes.size() >
+        first.DataCPU().mVertexBuffers[0].mBytes.size());
+    TEST_ASSERT(SameBuffers(Geometry::Prefabs::Box(layout), first));
+
+    // Every prefab is its own entry
+    auto plane = Geometry::Prefabs::Plane(layout);
+    TEST_ASSERT(plane.GetDesc().mAttribs.mNumVertices == 4);
+
+    Geometry::Prefabs::ClearCache();
+    TEST_ASSERT(SameBuffers(Geometry::Prefabs::Box(layout), first));
+}
+
+// Counts the geometry it is handed instead of uploading it
+class CountingBackend : public IResourceBackend<Geometry> {
+public:
+    size_t mAdded = 0;
+
+    void NotifyAdd(resource_id_t id, Geometry& frontend) override {
+        ++mAdded;
+    }
+
+    void NotifyDestroy(resource_id_t id, Geometry& frontend) override {
+    }
+};
+
+void TestSharedPrefabs() {
+    auto layout = VertexFormat::PositionUVNormal();
+    auto tangentLayout = VertexFormat::PositionUVNormalTangent();
+
+    CountingBackend backend;
+    ResourceManager resources;
+    resources.Register<Geometry>(&backend);
+
+    auto first = Geometry::Prefabs::Box(resources, layout);
+    auto second = Geometry::Prefabs::Box(resources, layout);
+    TEST_ASSERT(first == second);
+    TEST_ASSERT(backend.mAdded == 1);
+    TEST_ASSERT(resources.Get(first).GetDesc().mAttribs.mNumVertices == 24);
+
+    // Every format and every prefab is its own resource
+    auto tangents = Geometry::Prefabs::Box(resources, tangentLayout);
+    auto plane = Geometry::Prefabs::Plane(resources, layout);
+    TEST_ASSERT(tangents != first);
+    TEST_ASSERT(plane != first);
+    TEST_ASSERT(backend.mAdded == 3);
+
+    // Once sent to the garbage, the next caller gets a new one, even
+    // before the old one is collected
+    resources.SendToGarbage(first);
+    auto third = Geometry::Prefabs::Box(resources, layout);
+    TEST_ASSERT(third != first);
+    TEST_ASSERT(backend.mAdded == 4);
+    resources.CollectGarbage();
+    TEST_ASSERT(!resources.IsAlive(first));
+    TEST_ASSERT(resources.IsAlive(third));
+    TEST_ASSERT(Geometry::Prefabs::Box(resources, layout) == third);
+
+    // Another manager has its own
+    CountingBackend otherBackend;
+    ResourceManager other;
+    other.Register<Geometry>(&otherBackend);
+    Geometry::Prefabs::Box(other, layout);
+    TEST_ASSERT(otherBackend.mAdded == 1);
+    TEST_ASSERT(backend.mAdded == 4);
+}
+
+void BenchmarkSpawn() {
+    auto layout = VertexFormat::PositionUVNormal();
+
+    Geometry::Prefabs::ClearCache();
+    auto start = std::chrono::high_resolution_clock::now();
+    auto packed = Geometry::Prefabs::UtahTeapot(layout);
+    auto firstCall = std::chrono::high_resolution_clock::now();
+
+    for (size_t i = 0; i < SPAWN_COUNT; ++i) {
+        auto box = Geometry::Prefabs::Box(layout);
+        TEST_ASSERT(box.GetDesc().mAttribs.mNumVertices == 24);
+    }
+    auto copied = std::chrono::high_resolution_clock::now();
+
+    CountingBackend backend;
+    ResourceManager resources;
+    resources.Register<Geometry>(&backend);
+    for (size_t i = 0; i < SPAWN_COUNT; ++i) {
+        Geometry::Prefabs::Box(resources, layout);
+    }
+    TEST_ASSERT(backend.mAdded == 1);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::cout << "Packing the teapot: "
+        << std::chrono::duration<double>(firstCall - start).count() * 1000.0
+        << " ms" << std::endl;
+    std::cout << SPAWN_COUNT << " copied boxes: "
+        << std::chrono::duration<double>(copied - firstCall).count() * 1000.0
+        << " ms" << std::endl;
+    std::cout << SPAWN_COUNT << " shared boxes: "
+        << std::chrono::duration<double>(end - copied).count() * 1000.0
+        << " ms" << std::endl;
+}
+
+int main() {
+    TestEmbeddedMesh();
+    TestPrefabCache();
+    TestSharedPrefabs();
+    BenchmarkSpawn();
+    std::cout << "Prefab cache tests passed" << std::endl;
+    return 0;
+}
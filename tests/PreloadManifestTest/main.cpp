@@ -0,0 +1,289 @@
+#include <okami/ResourcePreloader.hpp>
+#include <okami/Texture.hpp>
+#include <okami/Geometry.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+using namespace entt;
+using namespace okami;
+using namespace okami::core;
+
+#define TEST_ASSERT(x) \
+    if (!(x)) { \
+        std::cerr << \
+            "LINE " << __LINE__  << ": Test Failed: " << #x << std::endl; \
+        throw std::runtime_error("Test Failed!"); \
+    }
+
+struct TestMeshComponent {
+};
+
+struct LoadRecord {
+    std::filesystem::path mPath;
+    std::string mParams;
+    LoadPriority mPriority = LoadPriority::PREFETCH;
+
+    bool operator==(const LoadRecord& other) const {
+        return mPath == other.mPath && mParams == other.mParams;
+    }
+};
+
+// Records the loads it is asked to perform instead of performing them.
+// Both fakes share one log so that the order across types is kept.
+template <typename T>
+class FakeBackend : public IResourceBackend<T> {
+public:
+    std::vector<LoadRecord>* mLog;
+
+    FakeBackend(std::vector<LoadRecord>* log) : mLog(log) {
+    }
+
+    void NotifyAdd(resource_id_t id, T& frontend) override {
+        if (frontend.HasLoadParams()) {
+            LoadRecord record;
+            record.mPath = frontend.GetPath();
+            record.mParams = frontend.EncodeLoadParams();
+            mLog->emplace_back(std::move(record));
+        }
+    }
+
+    void NotifyDestroy(resource_id_t id, T& frontend) override {
+    }
+
+    void SetLoadPriority(resource_id_t id, LoadPriority priority) override {
+        mLog->back().mPriority = priority;
+    }
+};
+
+struct Session {
+    std::vector<LoadRecord> mLog;
+    FakeBackend<Texture> mTextures;
+    FakeBackend<Geometry> mGeometry;
+    ResourceManager mManager;
+
+    Session() : mTextures(&mLog), mGeometry(&mLog) {
+        mManager.Register<Texture>(&mTextures);
+        mManager.Register<Geometry>(&mGeometry);
+    }
+};
+
+void TestParams() {
+    LoadParams<Texture> texParams(true, false);
+    Texture tex("a.png", texParams);
+    auto decoded = Texture::DecodeLoadParams(tex.EncodeLoadParams());
+    TEST_ASSERT(decoded.bIsSRGB == texParams.bIsSRGB);
+    TEST_ASSERT(decoded.bGenerateMips == texParams.bGenerateMips);
+
+    LoadParams<Geometry> geoParams;
+    geoParams.mComponentType = entt::resolve<TestMeshComponent>();
+    Geometry geo("a.obj", geoParams);
+    auto geoDecoded = Geometry::DecodeLoadParams(geo.EncodeLoadParams());
+    TEST_ASSERT(geoDecoded.mComponentType == geoParams.mComponentType);
+    TEST_ASSERT(geoDecoded.mOptimizeParams.bBuildLodChain);
+
+    Geometry noLayout("b.obj");
+    auto noLayoutDecoded = Geometry::DecodeLoadParams(
+        noLayout.EncodeLoadParams());
+    TEST_ASSERT(!noLayoutDecoded.mComponentType);
+
+    LoadParams<Geometry> optimizeParams;
+    optimizeParams.mOptimizeParams.bBuildMeshlets = false;
+    optimizeParams.mOptimizeParams.bAllow16BitIndices = false;
+    optimizeParams.mOptimizeParams.mLodChainParams.mLevelCount = 5;
+    optimizeParams.mOptimizeParams.mLodChainParams.mReduction = 0.3f;
+    optimizeParams.mOptimizeParams.mMeshletParams.mConeWeight = 0.1f;
+    Geometry optimized("c.obj", optimizeParams);
+    auto optimizeDecoded = Geometry::DecodeLoadParams(
+        optimized.EncodeLoadParams()).mOptimizeParams;
+    TEST_ASSERT(!optimizeDecoded.bBuildMeshlets);
+    TEST_ASSERT(!optimizeDecoded.bAllow16BitIndices);
+    TEST_ASSERT(optimizeDecoded.bOptimizeVertexCache);
+    TEST_ASSERT(optimizeDecoded.mLodChainParams.mLevelCount == 5);
+    TEST_ASSERT(optimizeDecoded.mLodChainParams.mReduction == 0.3f);
+    TEST_ASSERT(optimizeDecoded.mMeshletParams.mConeWeight == 0.1f);
+
+    // Only the layout, as older manifests have it
+    auto legacyDecoded = Geometry::DecodeLoadParams("0");
+    TEST_ASSERT(!legacyDecoded.mComponentType);
+    TEST_ASSERT(legacyDecoded.mOptimizeParams.bBuildLodChain);
+}
+
+void TestRecordAndReplay() {
+    LoadParams<Geometry> geoParams;
+    geoParams.mComponentType = entt::resolve<TestMeshComponent>();
+
+    // Run a "scene" with the recorder attached
+    ManifestRecorder recorder;
+    PreloadManifest manifest;
+    std::vector<LoadRecord> recorded;
+    {
+        Session session;
+        session.mManager.SetManifestRecorder(&recorder);
+
+        // Resources without a path are not recorded
+        session.mManager.Add<Texture>(Texture::Prefabs::SolidColor(
+            4, 4, glm::vec4(1.0f)));
+
+        session.mManager.Add<Texture>(
+            Texture("albedo.png", LoadParams<Texture>(true, true)));
+        session.mManager.Add<Geometry>(Geometry("level.obj", geoParams));
+        recorder.NextFrame();
+        recorder.NextFrame();
+        session.mManager.Add<Texture>(
+            Texture("normal.png", LoadParams<Texture>(false, true)));
+        recorder.NextFrame();
+        session.mManager.Add<Texture>(
+            Texture("path with spaces/ui.png", LoadParams<Texture>(false, false)));
+        session.mManager.Add<Geometry>(Geometry("prop.obj"));
+
+        // A path that is requested again only counts once
+        auto handle = session.mManager.TryFind<Texture>("normal.png");
+        TEST_ASSERT(handle.IsValid());
+        session.mManager.Free(handle);
+        recorder.NextFrame();
+        session.mManager.Add<Texture>(
+            Texture("normal.png", LoadParams<Texture>(false, true)));
+
+        session.mManager.SetManifestRecorder(nullptr);
+        session.mManager.Add<Texture>(Texture("not-recorded.png"));
+
+        recorded = session.mLog;
+    }
+
+    manifest = recorder.GetManifest();
+    TEST_ASSERT(manifest.mEntries.size() == 5);
+    TEST_ASSERT(manifest.mEntries[0].mFirstUseFrame == 0);
+    TEST_ASSERT(manifest.mEntries[1].mFirstUseFrame == 0);
+    TEST_ASSERT(manifest.mEntries[2].mFirstUseFrame == 2);
+    TEST_ASSERT(manifest.mEntries[2].mPath == "normal.png");
+    TEST_ASSERT(manifest.mEntries[3].mFirstUseFrame == 3);
+    TEST_ASSERT(manifest.mEntries[1].mType == entt::resolve<Geometry>().id());
+
+    // Round trip through the text format
+    std::stringstream stream;
+    manifest.Save(stream);
+    auto loaded = PreloadManifest::Load(stream);
+    TEST_ASSERT(loaded.mEntries.size() == manifest.mEntries.size());
+    for (size_t i = 0; i < loaded.mEntries.size(); ++i) {
+        TEST_ASSERT(loaded.mEntries[i].mPath == manifest.mEntries[i].mPath);
+        TEST_ASSERT(loaded.mEntries[i].mType == manifest.mEntries[i].mType);
+        TEST_ASSERT(loaded.mEntries[i].mParams == manifest.mEntries[i].mParams);
+        TEST_ASSERT(loaded.mEntries[i].mFirstUseFrame ==
+            manifest.mEntries[i].mFirstUseFrame);
+    }
+
+    // Replay in a fresh session, shuffled to check ordering
+    std::reverse(loaded.mEntries.begin(), loaded.mEntries.end());
+    Session replay;
+    ResourcePreloader preloader(&replay.mManager);
+    preloader.Register<Texture>();
+    preloader.Register<Geometry>();
+    auto ids = preloader.Preload(loaded);
+    TEST_ASSERT(ids.size() == 5);
+
+    // Same loads with the same parameters, in first-use order
+    std::vector<LoadRecord> expected;
+    for (auto& record : recorded) {
+        if (record.mPath != "not-recorded.png" &&
+            std::find(expected.begin(), expected.end(), record) == expected.end()) {
+            expected.emplace_back(record);
+        }
+    }
+    TEST_ASSERT(replay.mLog.size() == expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        TEST_ASSERT(replay.mLog[i] == expected[i]);
+    }
+
+    // Whatever the first frame needed is loaded first
+    TEST_ASSERT(replay.mLog[0].mPriority == LoadPriority::VISIBLE_NOW);
+    TEST_ASSERT(replay.mLog[1].mPriority == LoadPriority::VISIBLE_NOW);
+    for (size_t i = 2; i < replay.mLog.size(); ++i) {
+        TEST_ASSERT(replay.mLog[i].mPriority == LoadPriority::PREFETCH);
+    }
+
+    // Replaying again does not load anything twice
+    auto again = preloader.Preload(loaded);
+    TEST_ASSERT(replay.mLog.size() == expected.size());
+    TEST_ASSERT(again.size() == ids.size());
+    for (auto id : again) {
+        TEST_ASSERT(std::find(ids.begin(), ids.end(), id) != ids.end());
+    }
+}
+
+void TestMalformed() {
+    std::stringstream bad("not a manifest\n");
+    bool bThrown = false;
+    try {
+        PreloadManifest::Load(bad);
+    } catch (std::runtime_error&) {
+        bThrown = true;
+    }
+    TEST_ASSERT(bThrown);
+}
+
+void TestMistypedHandle() {
+    Session session;
+    auto texture = session.mManager.Add<Texture>(
+        Texture::Prefabs::SolidColor(4, 4, glm::vec4(1.0f)));
+
+    // Raw ids convert to any handle type, the lookup has to catch it
+    Handle<Geometry> wrong(texture.mId);
+    TEST_ASSERT(session.mManager.TryGet(wrong) == nullptr);
+    TEST_ASSERT(session.mManager.TryGet(texture) != nullptr);
+}
+
+void TestDuplicatePath() {
+    Session session;
+    auto first = session.mManager.Add<Texture>(Texture("a.png"));
+
+    bool bThrown = false;
+    try {
+        session.mManager.Add<Texture>(Texture("a.png"));
+    } catch (std::runtime_error&) {
+        bThrown = true;
+    }
+    TEST_ASSERT(bThrown);
+
+    // A batch is rejected as a whole, also for a path it repeats itself
+    std::vector<Texture> batch;
+    batch.emplace_back(Texture("b.png"));
+    batch.emplace_back(Texture("b.png"));
+    bThrown = false;
+    try {
+        session.mManager.AddBatch<Texture>(std::move(batch));
+    } catch (std::runtime_error&) {
+        bThrown = true;
+    }
+    TEST_ASSERT(bThrown);
+    TEST_ASSERT(!session.mManager.TryFind<Texture>("b.png").IsValid());
+
+    bThrown = false;
+    try {
+        session.mManager.Add<Texture>(Texture("d.png"),
+            SlotId<resource_id_t>::Make(100, 0));
+    } catch (std::runtime_error&) {
+        bThrown = true;
+    }
+    TEST_ASSERT(bThrown);
+
+    // Nothing was allocated for the rejected resources
+    auto next = session.mManager.Add<Texture>(Texture("c.png"));
+    TEST_ASSERT(SlotId<resource_id_t>::Index(next.mId) ==
+        SlotId<resource_id_t>::Index(first.mId) + 1);
+}
+
+int main() {
+    Texture::Register();
+    Geometry::Register();
+    entt::meta<TestMeshComponent>().type("TestMeshComponent"_hs);
+
+    TestParams();
+    TestRecordAndReplay();
+    TestMalformed();
+    TestMistypedHandle();
+    TestDuplicatePath();
+    std::cout << "Preload manifest tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,293 @@
+#include <okami/StaticBatching.hpp>
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <cmath>
+#include <iostream>
+
+using namespace okami;
+using namespace okami::core;
+
+#define TEST_ASSERT(x) \
+    if (!(x)) { \
+        std::cerr << \
+            "LINE " << __LINE__  << ": Test Failed: " << #x << std::endl; \
+        throw std::runtime_error("Test Failed!"); \
+    }
+
+constexpr float EPSILON = 1e-4f;
+
+bool Near(const glm::vec3& a, const glm::vec3& b) {
+    return glm::length(a - b) < EPSILON;
+}
+
+// A unit quad in the xy plane facing +z, counter clockwise seen from
+// there
+Geometry::RawData MakeQuad(const VertexFormat& layout) {
+    Geometry::Data<> data;
+    data.mPositions = {
+        glm::vec3(0.0f, 0.0f, 0.0f),
+        glm::vec3(1.0f, 0.0f, 0.0f),
+        glm::vec3(1.0f, 1.0f, 0.0f),
+        glm::vec3(0.0f, 1.0f, 0.0f) };
+    data.mNormals.resize(4, glm::vec3(0.0f, 0.0f, 1.0f));
+    data.mUVs.resize(1);
+    data.mUVs[0] = {
+        glm::vec2(0.0f, 0.0f),
+        glm::vec2(1.0f, 0.0f),
+        glm::vec2(1.0f, 1.0f),
+        glm::vec2(0.0f, 1.0f) };
+    data.mIndices = { 0, 1, 2, 0, 2, 3 };
+
+    Geometry::RawData result;
+    result.Pack(layout, Geometry::DataSource<>(data));
+    return result;
+}
+
+Transform MakeTranslation(const glm::vec3& translation) {
+    Transform result;
+    result.mTranslation = translation;
+    return result;
+}
+
+// Normal of a triangle according to its winding
+glm::vec3 FaceNormal(const Geometry::Data<>& data, size_t triangle) {
+    auto& a = data.mPositions[data.mIndices[3 * triangle]];
+    auto& b = data.mPositions[data.mIndices[3 * triangle + 1]];
+    auto& c = data.mPositions[data.mIndices[3 * triangle + 2]];
+    return glm::normalize(glm::cross(b - a, c - a));
+}
+
+void TestGrouping() {
+    auto layout = VertexFormat::PositionUVNormal();
+    auto quad = MakeQuad(layout);
+
+    std::vector<StaticBatchSource> sources = {
+        { &quad, MakeTranslation(glm::vec3(0.0f, 0.0f, 0.0f)), 1 },
+        { &quad, MakeTranslation(glm::vec3(100.0f, 0.0f, 0.0f)), 1 },
+        { &quad, MakeTranslation(glm::vec3(2.0f, 0.0f, 0.0f)), 1 },
+        { &quad, MakeTranslation(glm::vec3(0.0f, 0.0f, 0.0f)), 2 },
+        { nullptr, Transform(), 1 } };
+
+    StaticBatchParams params;
+    params.mChunkSize = 10.0f;
+    auto batches = MergeStaticMeshes(sources, layout, params);
+
+    // Sources without data are left out
+    TEST_ASSERT(batches.size() == 3);
+
+    TEST_ASSERT(batches[0].mMaterial == 1);
+    TEST_ASSERT(batches[0].mSources == std::vector<size_t>({ 0, 2 }));
+    TEST_ASSERT(batches[0].mData.mDesc.mAttribs.mNumVertices == 8);
+    TEST_ASSERT(Near(batches[0].mBounds.mLower, glm::vec3(0.0f, 0.0f, 0.0f)));
+    TEST_ASSERT(Near(batches[0].mBounds.mUpper, glm::vec3(3.0f, 1.0f, 0.0f)));
+
+    TEST_ASSERT(batches[1].mMaterial == 1);
+    TEST_ASSERT(batches[1].mSources == std::vector<size_t>({ 1 }));
+    TEST_ASSERT(Near(batches[1].mBounds.mLower, glm::vec3(100.0f, 0.0f, 0.0f)));
+
+    TEST_ASSERT(batches[2].mMaterial == 2);
+    TEST_ASSERT(batches[2].mSources == std::vector<size_t>({ 3 }));
+
+    // A chunk size of zero only splits by material
+    params.mChunkSize = 0.0f;
+    batches = MergeStaticMeshes(sources, layout, params);
+    TEST_ASSERT(batches.size() == 2);
+    TEST_ASSERT(batches[0].mSources == std::vector<size_t>({ 0, 1, 2 }));
+}
+
+void TestTransform() {
+    auto layout = VertexFormat::PositionUVNormal();
+    auto quad = MakeQuad(layout);
+
+    // Stretched along x, then turned a quarter around y so that it
+    // faces +x
+    Transform transform;
+    transform.mScale = glm::vec3(2.0f, 1.0f, 1.0f);
+    transform.mRotation = glm::angleAxis(glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    transform.mTranslation = glm::vec3(5.0f, 0.0f, 0.0f);
+
+    auto batches = MergeStaticMeshes({ { &quad, transform, 1 } }, layout);
+    TEST_ASSERT(batches.size() == 1);
+
+    auto data = batches[0].mData.Unpack<uint32_t, glm::vec2, glm::vec3, glm::vec4>();
+    TEST_ASSERT(data.mPositions.size() == 4);
+    TEST_ASSERT(data.mIndices.size() == 6);
+
+    for (auto& p : data.mPositions) {
+        bool bFound = false;
+        for (auto corner : { glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f),
+            glm::vec3(1.0f, 1.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f) }) {
+            bFound = bFound || Near(p, transform.ApplyToPoint(corner));
+        }
+        TEST_ASSERT(bFound);
+    }
+
+    for (auto& n : data.mNormals) {
+        TEST_ASSERT(Near(n, glm::vec3(1.0f, 0.0f, 0.0f)));
+    }
+    for (size_t i = 0; i < data.mIndices.size() / 3; ++i) {
+        TEST_ASSERT(Near(FaceNormal(data, i), glm::vec3(1.0f, 0.0f, 0.0f)));
+    }
+
+    auto expected = transform.ApplyToAABB(quad.mBoundingBox);
+    TEST_ASSERT(Near(batches[0].mBounds.mLower, expected.mLower));
+    TEST_ASSERT(Near(batches[0].mBounds.mUpper, expected.mUpper));
+}
+
+void TestMirror() {
+    auto layout = VertexFormat::PositionUVNormal();
+    auto quad = MakeQuad(layout);
+
+    // Mirrored along x, the quad still faces +z
+    Transform transform;
+    transform.mScale = glm::vec3(-1.0f, 1.0f, 1.0f);
+
+    auto batches = MergeStaticMeshes({ { &quad, transform, 1 } }, layout);
+    TEST_ASSERT(batches.size() == 1);
+
+    auto data = batches[0].mData.Unpack<uint32_t, glm::vec2, glm::vec3, glm::vec4>();
+    for (auto& n : data.mNormals) {
+        TEST_ASSERT(Near(n, glm::vec3(0.0f, 0.0f, 1.0f)));
+    }
+    for (size_t i = 0; i < data.mIndices.size() / 3; ++i) {
+        TEST_ASSERT(Near(FaceNormal(data, i), glm::vec3(0.0f, 0.0f, 1.0f)));
+    }
+}
+
+void TestMaxVertices() {
+    auto layout = VertexFormat::PositionUVNormal();
+    auto quad = MakeQuad(layout);
+
+    std::vector<StaticBatchSource> sources;
+    for (int i = 0; i < 5; ++i) {
+        sources.push_back({ &quad, MakeTranslation(glm::vec3(0.0f, 0.0f, (float)i)), 1 });
+    }
+
+    StaticBatchParams params;
+    params.mChunkSize = 0.0f;
+    params.mMaxVertices = 8;
+    auto batches = MergeStaticMeshes(sources, layout, params);
+
+    TEST_ASSERT(batches.size() == 3);
+    size_t sourceCount = 0;
+    for (auto& batch : batches) {
+        TEST_ASSERT(batch.mData.mDesc.mAttribs.mNumVertices <= params.mMaxVertices);
+        TEST_ASSERT(batch.mData.mDesc.mIndexedAttribs.mNumIndices ==
+            6 * batch.mSources.size());
+        sourceCount += batch.mSources.size();
+    }
+    TEST_ASSERT(sourceCount == sources.size());
+}
+
+// Keeps the geometry it is given on the CPU, like a renderer that
+// hasn't uploaded it yet
+class FakeGeometryBackend : public IResourceBackend<Geometry> {
+public:
+    void NotifyAdd(resource_id_t id, Geometry& frontend) override {
+    }
+
+    void NotifyDestroy(resource_id_t id, Geometry& frontend) override {
+    }
+};
+
+void TestBatcher() {
+    auto layout = VertexFormat::PositionUVNormal();
+
+    FakeGeometryBackend backend;
+    ResourceManager resources;
+    resources.Register<Geometry>(&backend);
+
+    Frame frame;
+    auto geometry = resources.Add<Geometry>(Geometry(MakeQuad(layout)));
+    Handle<Material<StaticMesh>> material(7);
+
+    std::vector<entt::entity> entities;
+    for (int i = 0; i < 3; ++i) {
+        auto entity = frame.CreateEntity();
+        frame.Emplace<Transform>(entity, MakeTranslation(glm::vec3((float)i, 0.0f, 0.0f)));
+        frame.Emplace<StaticMesh>(entity, StaticMesh{ geometry, material });
+        frame.AddTag<StaticTag>(entity);
+        entities.emplace_back(entity);
+    }
+
+    // Not tagged, so it stays on its own
+    auto dynamic = frame.CreateEntity();
+    frame.Emplace<Transform>(dynamic, Transform());
+    frame.Emplace<StaticMesh>(dynamic, StaticMesh{ geometry, material });
+
+    auto& registry = frame.Registry();
+    auto countBatches = [&registry]() {
+        auto view = registry.view<StaticBatch>();
+        return (size_t)std::distance(view.begin(), view.end());
+    };
+
+    StaticBatcher batcher(resources);
+    TEST_ASSERT(batcher.Build(frame, layout) == 1);
+    TEST_ASSERT(countBatches() == 1);
+    TEST_ASSERT(!batcher.IsBatched(dynamic));
+
+    auto batch = registry.get<StaticBatchMember>(entities[0]).mBatch;
+    TEST_ASSERT(registry.get<StaticBatch>(batch).mMembers.size() == 3);
+    TEST_ASSERT(registry.get<StaticMesh>(batch).mMaterial == material);
+    TEST_ASSERT(!registry.try_get<Transform>(batch));
+    for (auto entity : entities) {
+        TEST_ASSERT(batcher.IsBatched(entity));
+        TEST_ASSERT(registry.get<StaticBatchMember>(entity).mBatch == batch);
+    }
+
+    // Building again leaves batched entities alone
+    TEST_ASSERT(batcher.Build(frame, layout) == 0);
+
+    // Nothing changed
+    batcher.Update(frame);
+    TEST_ASSERT(countBatches() == 1);
+
+    // Moving a member takes its batch apart
+    frame.Replace<Transform>(entities[1], MakeTranslation(glm::vec3(0.0f, 5.0f, 0.0f)));
+    batcher.Update(frame);
+    TEST_ASSERT(countBatches() == 0);
+    TEST_ASSERT(!registry.valid(batch));
+    for (auto entity : entities) {
+        TEST_ASSERT(!batcher.IsBatched(entity));
+        TEST_ASSERT(!registry.try_get<StaticBatchMember>(entity));
+    }
+
+    // Everything that is still tagged is batched again
+    TEST_ASSERT(batcher.Build(frame, layout) == 1);
+    batch = registry.get<StaticBatchMember>(entities[0]).mBatch;
+    TEST_ASSERT(registry.get<StaticBatch>(batch).mMembers.size() == 3);
+
+    // Becoming dynamic takes the batch apart as well, and the entity
+    // is left out of the next one
+    frame.RemoveTag<StaticTag>(entities[2]);
+    batcher.Update(frame);
+    TEST_ASSERT(countBatches() == 0);
+    TEST_ASSERT(batcher.Build(frame, layout) == 1);
+    TEST_ASSERT(!batcher.IsBatched(entities[2]));
+    batch = registry.get<StaticBatchMember>(entities[0]).mBatch;
+    TEST_ASSERT(registry.get<StaticBatch>(batch).mMembers.size() == 2);
+
+    // So does destroying a member
+    frame.Destroy(entities[0]);
+    batcher.Update(frame);
+    TEST_ASSERT(countBatches() == 0);
+    TEST_ASSERT(!registry.try_get<StaticBatchMember>(entities[1]));
+
+    // Dissolving by hand
+    TEST_ASSERT(batcher.Build(frame, layout) == 1);
+    batch = registry.get<StaticBatchMember>(entities[1]).mBatch;
+    batcher.Dissolve(frame, batch);
+    TEST_ASSERT(countBatches() == 0);
+    TEST_ASSERT(!batcher.IsBatched(entities[1]));
+}
+
+int main() {
+    TestGrouping();
+    TestTransform();
+    TestMirror();
+    TestMaxVertices();
+    TestBatcher();
+    std::cout << "Static batch tests passed" << std::endl;
+    return 0;
+}
@@ -75,7 +75,7 @@ void TestBackend(GraphicsBackend backend) {
 
         // Create a static mesh using the specified geometry
         // Create a geometry object from a built-in prefab
-        auto geo = resources.Add(Geometry::Prefabs::MaterialBall(staticMeshLayout));
+        auto geo = Geometry::Prefabs::MaterialBall(resources, staticMeshLayout);
         // Load a texture from disk
         auto texture = resources.Load<Texture>("test.png");
 
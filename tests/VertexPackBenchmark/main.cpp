@@ -0,0 +1,246 @@
+#include <okami/Geometry.hpp>
+#include <okami/VertexKernels.hpp>
+
+#include <glm/geometric.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+using namespace okami;
+using namespace okami::core;
+
+#define TEST_ASSERT(x) \
+    if (!(x)) { \
+        std::cerr << \
+            "LINE " << __LINE__  << ": Test Failed: " << #x << std::endl; \
+        throw std::runtime_error("Test Failed!"); \
+    }
+
+constexpr size_t VERTEX_COUNT = 1u << 20;
+constexpr uint ITERATIONS = 8;
+
+template <typename FuncT>
+double TimeSeconds(FuncT&& func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (uint i = 0; i < ITERATIONS; ++i) {
+        func();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(end - start).count() / ITERATIONS;
+}
+
+// Bytes read plus bytes written, the way memory bandwidth is measured
+void Report(const char* name, size_t bytes, double seconds) {
+    std::cout << name << ": "
+        << seconds * 1000.0 << " ms, "
+        << (bytes / (1024.0 * 1024.0 * 1024.0)) / seconds << " GB/s" << std::endl;
+}
+
+Geometry::Data<> MakeMesh(size_t vertexCount) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+
+    Geometry::Data<> data;
+    data.mPositions.resize(vertexCount);
+    data.mNormals.resize(vertexCount);
+    data.mTangents.resize(vertexCount);
+    data.mBitangents.resize(vertexCount);
+    data.mUVs.resize(1);
+    data.mUVs[0].resize(vertexCount);
+
+    for (size_t i = 0; i < vertexCount; ++i) {
+        data.mPositions[i] = glm::vec3(dist(rng), dist(rng), dist(rng));
+        data.mNormals[i] = glm::vec3(dist(rng), dist(rng), dist(rng));
+        data.mTangents[i] = glm::vec3(dist(rng), dist(rng), dist(rng));
+        data.mBitangents[i] = glm::vec3(dist(rng), dist(rng), dist(rng));
+        data.mUVs[0][i] = glm::vec2(dist(rng), dist(rng));
+    }
+
+    data.mIndices.resize((vertexCount / 3) * 3);
+    for (size_t i = 0; i < data.mIndices.size(); ++i) {
+        data.mIndices[i] = (uint32_t)(rng() % vertexCount);
+    }
+
+    return data;
+}
+
+BoundingBox ReferenceBounds(const std::vector<glm::vec3>& positions) {
+    BoundingBox result;
+    result.mLower = glm::vec3(std::numeric_limits<float>::infinity());
+    result.mUpper = glm::vec3(-std::numeric_limits<float>::infinity());
+    for (auto& p : positions) {
+        result.mLower = glm::min(result.mLower, p);
+        result.mUpper = glm::max(result.mUpper, p);
+    }
+    return result;
+}
+
+// Every kernel against the scalar one, for awkward counts and strides
+void TestKernels() {
+    auto& scalar = GetVertexKernels(SimdLevel::SCALAR);
+    std::mt19937 rng(5);
+
+    for (uint level = 0; level <= (uint)SimdLevel::AVX2; ++level) {
+        auto& kernels = GetVertexKernels((SimdLevel)level);
+
+        for (size_t count : { 0, 1, 3, 4, 7, 8, 9, 31, 1000 }) {
+            for (size_t srcStride : { 12, 16, 32, 44 }) {
+                for (size_t destStride : { 12, 16, 48 }) {
+                    std::vector<uint8_t> src(count * srcStride);
+                    for (size_t i = 0; i + 4 <= src.size(); i += 4) {
+                        float f = (float)(rng() % 2000) - 1000.0f;
+                        std::memcpy(&src[i], &f, 4);
+                    }
+
+                    std::vector<uint8_t> expected(count * destStride + 16, 0xCD);
+                    std::vector<uint8_t> actual(expected);
+
+                    BoundingBox expectedBounds;
+                    BoundingBox actualBounds;
+                    scalar.mCopyBounds(expected.data(), destStride,
+                        src.data(), srcStride, count, expectedBounds);
+                    kernels.mCopyBounds(actual.data(), destStride,
+                        src.data(), srcStride, count, actualBounds);
+
+                    // Includes the bytes between and after the elements,
+                    // which must not be touched
+                    TEST_ASSERT(expected == actual);
+                    if (count > 0) {
+                        TEST_ASSERT(expectedBounds.mLower == actualBounds.mLower);
+                        TEST_ASSERT(expectedBounds.mUpper == actualBounds.mUpper);
+                    }
+
+                    for (uint components = 1; components <= 4; ++components) {
+                        if (components * 4 > std::min(srcStride, destStride)) {
+                            continue;
+                        }
+
+                        std::fill(expected.begin(), expected.end(), 0xCD);
+                        std::fill(actual.begin(), actual.end(), 0xCD);
+                        scalar.mCopy[components](expected.data(), destStride,
+                            src.data(), srcStride, count);
+                        kernels.mCopy[components](actual.data(), destStride,
+                            src.data(), srcStride, count);
+                        TEST_ASSERT(expected == actual);
+
+                        const float value[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+                        scalar.mFill[components](expected.data(), destStride,
+                            count, value);
+                        kernels.mFill[components](actual.data(), destStride,
+                            count, value);
+                        TEST_ASSERT(expected == actual);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void BenchmarkPack(const Geometry::Data<>& mesh) {
+    auto layout = VertexFormat::PositionUVNormalTangentBitangent();
+    Geometry::DataSource<> source(mesh);
+    auto bounds = ReferenceBounds(mesh.mPositions);
+
+    size_t bytes = 0;
+    Geometry::RawData reference;
+    reference.Pack(layout, source);
+    for (auto& buffer : reference.mVertexBuffers) {
+        bytes += 2 * buffer.mBytes.size();
+    }
+    bytes += 2 * reference.mIndexBuffer.mBytes.size();
+
+    // Plain copy of as many bytes, about as fast as memory goes
+    std::vector<uint8_t> from(bytes / 2, 1);
+    std::vector<uint8_t> to(bytes / 2);
+    auto copyTime = TimeSeconds([&]() {
+        std::memcpy(to.data(), from.data(), from.size());
+    });
+    Report("memcpy", bytes, copyTime);
+
+    for (uint level = 0; level <= (uint)GetSupportedSimdLevel(); ++level) {
+        SetSimdLevel((SimdLevel)level);
+
+        Geometry::RawData packed;
+        packed.Pack(layout, source);
+        TEST_ASSERT(packed.mBoundingBox.mLower == bounds.mLower);
+        TEST_ASSERT(packed.mBoundingBox.mUpper == bounds.mUpper);
+        TEST_ASSERT(packed.mIndexBuffer.mBytes == reference.mIndexBuffer.mBytes);
+        for (size_t i = 0; i < packed.mVertexBuffers.size(); ++i) {
+            TEST_ASSERT(packed.mVertexBuffers[i].mBytes ==
+                reference.mVertexBuffers[i].mBytes);
+        }
+
+        auto unpacked = packed.Unpack<uint32_t, glm::vec2, glm::vec3, glm::vec4>();
+        TEST_ASSERT(unpacked.mPositions == mesh.mPositions);
+        TEST_ASSERT(unpacked.mTangents == mesh.mTangents);
+        TEST_ASSERT(unpacked.mUVs[0] == mesh.mUVs[0]);
+
+        auto packTime = TimeSeconds([&]() {
+            Geometry::RawData result;
+            result.Pack(layout, source);
+        });
+        auto unpackTime = TimeSeconds([&]() {
+            packed.Unpack<uint32_t, glm::vec2, glm::vec3, glm::vec4>();
+        });
+
+        std::string name = GetName((SimdLevel)level);
+        Report(("Pack, " + name).c_str(), bytes, packTime);
+        Report(("Unpack, " + name).c_str(), bytes, unpackTime);
+    }
+
+    SetSimdLevel(GetSupportedSimdLevel());
+}
+
+// Compressed layouts are lossy, so they are checked against the
+// precision of their encoding instead of for equality
+void BenchmarkCompressedPack(const Geometry::Data<>& mesh) {
+    auto plainLayout = VertexFormat::PositionUVNormalTangent();
+    auto layout = VertexFormat::PositionUVNormalTangentCompressed();
+    Geometry::DataSource<> source(mesh);
+
+    Geometry::RawData plain;
+    plain.Pack(plainLayout, source);
+    Geometry::RawData packed;
+    packed.Pack(layout, source);
+
+    size_t plainBytes = plain.mVertexBuffers[0].mBytes.size();
+    size_t packedBytes = packed.mVertexBuffers[0].mBytes.size();
+    std::cout << "Vertex buffer: " << plainBytes << " bytes plain, "
+        << packedBytes << " bytes compressed" << std::endl;
+    TEST_ASSERT(2 * packedBytes <= plainBytes);
+
+    auto unpacked = packed.Unpack<uint32_t, glm::vec2, glm::vec3, glm::vec4>();
+    auto extent = packed.mBoundingBox.mUpper - packed.mBoundingBox.mLower;
+    for (size_t i = 0; i < mesh.mPositions.size(); ++i) {
+        for (int c = 0; c < 3; ++c) {
+            TEST_ASSERT(std::abs(unpacked.mPositions[i][c] - mesh.mPositions[i][c]) <=
+                extent[c] / 65535.0f);
+        }
+        TEST_ASSERT(glm::distance(unpacked.mNormals[i], glm::normalize(mesh.mNormals[i])) < 1e-4f);
+        TEST_ASSERT(glm::distance(unpacked.mTangents[i], glm::normalize(mesh.mTangents[i])) < 1e-4f);
+        TEST_ASSERT(glm::distance(unpacked.mUVs[0][i], mesh.mUVs[0][i]) < 0.05f);
+    }
+
+    size_t bytes = plainBytes + packedBytes;
+    auto packTime = TimeSeconds([&]() {
+        Geometry::RawData result;
+        result.Pack(layout, source);
+    });
+    auto unpackTime = TimeSeconds([&]() {
+        packed.Unpack<uint32_t, glm::vec2, glm::vec3, glm::vec4>();
+    });
+    Report("Pack, compressed", bytes, packTime);
+    Report("Unpack, compressed", bytes, unpackTime);
+}
+
+int main() {
+    TestKernels();
+
+    std::cout << "Best supported: " << GetName(GetSupportedSimdLevel()) << std::endl;
+    auto mesh = MakeMesh(VERTEX_COUNT);
+    BenchmarkPack(mesh);
+    BenchmarkCompressedPack(mesh);
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include <okami/Geometry.hpp>
+#include <okami/EmbeddedMesh.hpp>
 
 #include <iostream>
 #include <fstream>
@@ -6,10 +7,15 @@
 using namespace std;
 using namespace okami::core;
 
+// Writes a mesh as a blob for Geometry::Prefabs, see EmbeddedMesh.hpp.
+// The blob is linked in with OKAMI_INCBIN, so it never goes through the
+// compiler as source.
 int main(int argc, const char *argv[]) {
 
-	if (argc != 3)
-		std::cout << "Incorrect Number of Arguments!" << std::endl;
+	if (argc != 3) {
+		std::cout << "Usage: mesh2cpp <mesh> <output blob>" << std::endl;
+		return 1;
+	}
 
 	LayoutElement elePosition	{0, 0, 3, ValueType::FLOAT32};
 	LayoutElement eleUV			{1, 1, 2, ValueType::FLOAT32};
@@ -35,38 +41,34 @@ int main(int argc, const char *argv[]) {
 
 	auto geo = Geometry::Data<uint32_t, float, float, float>::Load(argv[1], vLayout);
 
-	ofstream out(argv[2]);
-
-	out << "size_t mVertexCount = " << geo.mPositions.size() / 3 << ";" << std::endl;
-	out << "size_t mIndexCount = " << geo.mIndices.size() << ";" << std::endl;
-	out << std::endl;
-
-	auto print_buffer = [&](const std::string& name, const std::vector<float>& data) {
-		out << "float " << name << "[] = {" << std::endl;
-		if (data.size() > 0) {
-			out << data[0];
-			for (int i = 1; i < data.size(); ++i) {
-				out << ", " << data[i]; 
-			}
-		}
+	size_t vertexCount = geo.mPositions.size() / 3;
 
-		out << std::endl << "};" << std::endl << std::endl;
-	};
+	// Attributes the mesh doesn't have are written as zeros, the blob
+	// always has all of them
+	if (geo.mUVs.empty()) {
+		geo.mUVs.emplace_back();
+	}
+	geo.mUVs[0].resize(2 * vertexCount);
+	geo.mNormals.resize(3 * vertexCount);
+	geo.mTangents.resize(3 * vertexCount);
+	geo.mBitangents.resize(3 * vertexCount);
 
-	print_buffer("mPositions", 	geo.mPositions);
-	print_buffer("mUVs", 		geo.mUVs[0]);
-	print_buffer("mNormals", 	geo.mNormals);
-	print_buffer("mTangents", 	geo.mTangents);
-	print_buffer("mBitangents",	geo.mBitangents);
+	EmbeddedMesh mesh;
+	mesh.mHeader.mVertexCount = (uint32_t)vertexCount;
+	mesh.mHeader.mIndexCount = (uint32_t)geo.mIndices.size();
+	mesh.mPositions = geo.mPositions.data();
+	mesh.mUVs = geo.mUVs[0].data();
+	mesh.mNormals = geo.mNormals.data();
+	mesh.mTangents = geo.mTangents.data();
+	mesh.mBitangents = geo.mBitangents.data();
+	mesh.mIndices = geo.mIndices.data();
 
-	out << "uint32_t mIndices[] = {" << std::endl;
-	if (geo.mIndices.size() > 0) {
-		out << geo.mIndices[0];
-		for (int i = 1; i < geo.mIndices.size(); ++i) {
-			out << ", " << geo.mIndices[i];
-		}
+	ofstream out(argv[2], std::ios::binary);
+	if (!out.is_open()) {
+		std::cout << "Failed to open " << argv[2] << std::endl;
+		return 1;
 	}
 
-	out << std::endl << "};";
-	out << std::endl;
-}
\ No newline at end of file
+	mesh.Write(out);
+	return 0;
+}